@@ -579,7 +579,8 @@ class NumericalParamEquationModel(Model):
                               'flexible_conjugate_gradient',
                               'inexact_conjugate_gradient', 'jacobi',
                               'bi_cgstab', 'bi_cgstab2', 'gmres', 'automatic',
-                              'gauss_seidel', 'symmetric_gauss_seidel', 'PCR3'))
+                              'gauss_seidel', 'symmetric_gauss_seidel', 'PCR3',
+                              'pipelined_conjugate_gradient'))
         node = self._getSolverNameNode(name)
 
         default = self._defaultValues()['solver_choice']
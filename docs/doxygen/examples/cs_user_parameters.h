@@ -174,6 +174,31 @@
 
   \snippet cs_user_parameters-base.c param_var_rij_clipping
 
+  Solution-adaptive mesh refinement and coarsening may be activated
+  based on a scalar variable. If an adaptation interval is defined, the
+  mesh is adapted in memory during the computation, and fields are mapped
+  to the adapted mesh. Otherwise, the error indicator is saved with each
+  checkpoint, and the mesh is adapted when restarting from it, using
+  the mesh saved with the checkpoint:
+
+  \snippet cs_user_parameters-base.c param_mesh_adapt
+
+  Weighted repartitioning based on estimated cell costs (including
+  Lagrangian particle counts) may be activated so that the mesh is
+  repartitioned with weighted cells when restarting, if the estimated
+  imbalance is too high. If a check interval is also defined, the
+  mesh and associated data are redistributed in memory during the
+  computation when the imbalance is too high:
+
+  \snippet cs_user_parameters-base.c param_load_balance
+
+  When physical properties are computed using a thermal table library
+  (such as CoolProp or EOS), they may be tabulated over a given range,
+  with values computed by bicubic interpolation. Tables may be cached
+  in a directory shared between runs:
+
+  \snippet cs_user_parameters-base.c param_thermal_table_tabulation
+
 
   \section cs_user_parameters_h_finalize_setup Input-output related examples (usipes)
 
@@ -394,6 +419,15 @@
 
   \snippet cs_user_parameters-linear_solvers.c sles_mgp_2
 
+  \subsection cs_user_parameters_h_sles_ilu0_1 Example: ILU(0) preconditioner
+
+  The following example shows how to use the native ILU(0) preconditioner
+  with a BiCGStab solver for the velocity. In parallel, the factorization
+  is restricted to the local part of the matrix (block Jacobi), and
+  it requires a matrix using MSR storage.
+
+  \snippet cs_user_parameters-linear_solvers.c sles_ilu0_1
+
   \subsection cs_user_parameters_h_sles_mg_parall Multigrid parallel settings
 
   In parallel, grids may optionally be merged across neigboring ranks
@@ -64,4 +64,12 @@
 
   \snippet cs_user_performance_tuning-matrix.c performance_tuning_matrix
 
+  For block diagonal systems with scalar extra-diagonal terms (such as
+  velocity or Reynolds stress systems with scalar diffusion), those terms
+  may be computed on the fly from face mass fluxes and viscosities rather
+  than stored, when the selected solver does not require an MSR matrix
+  (i.e. is not of the Gauss-Seidel type):
+
+  \snippet cs_user_performance_tuning-matrix.c performance_tuning_matrix_free
+
 */
@@ -130,6 +130,7 @@ class SolverChoiceDelegate(QItemDelegate):
         editor.addItem("Gauss Seidel")
         editor.addItem("Symmetric Gauss Seidel")
         editor.addItem("conjugate residual")
+        editor.addItem("Pipelined conjugate gradient")
         if mg:
             editor.addItem("Multigrid, V-cycle")
             editor.addItem("Multigrid, K-cycle")
@@ -149,8 +150,9 @@ class SolverChoiceDelegate(QItemDelegate):
                 "gauss_seidel": 8,
                 "symmetric_gauss_seidel": 9,
                 "PCR3": 10,
-                "multigrid": 11,
-                "multigrid_k_cycle": 12}
+                "pipelined_conjugate_gradient": 11,
+                "multigrid": 12,
+                "multigrid_k_cycle": 13}
         row = index.row()
         string = index.model().dataSolver[row]['iresol']
         idx = dico[string]
@@ -532,6 +534,7 @@ class StandardItemModelSolver(QStandardItemModel):
                        "Gauss Seidel"           : "gauss_seidel",
                        "Symmetric Gauss Seidel" : "symmetric_gauss_seidel",
                        "conjugate residual"     : "PCR3",
+                       "Pipelined conjugate gradient" : "pipelined_conjugate_gradient",
                        "None"                   : "none",
                        "Polynomial"             : "polynomial"}
         self.dicoM2V= {"multigrid"              : 'Multigrid, V-cycle',
@@ -548,6 +551,7 @@ class StandardItemModelSolver(QStandardItemModel):
                        "gauss_seidel"           : "Gauss Seidel",
                        "symmetric_gauss_seidel" : "Symmetric Gauss Seidel",
                        "PCR3"                   : "conjugate residual",
+                       "pipelined_conjugate_gradient" : "Pipelined conjugate gradient",
                        "none"                   : "None",
                        "polynomial"             : "Polynomial"}
 
@@ -93,22 +93,45 @@ extern "C" {
 #define _LOCATE_BB_SENDRECV          100  /* bounding boxes + send-receive */
 #define _LOCATE_BB_SENDRECV_ORDERED  200  /* bounding boxes + send-receive
                                              with communication ordering */
+#define _LOCATE_SUB_BB_SENDRECV_ORDERED  300  /* optional bounding box
+                                                 sub-extents + send-receive
+                                                 with communication
+                                                 ordering */
 
 #define _EXCHANGE_SENDRECV       100  /* Sendrecv */
 #define _EXCHANGE_ISEND_IRECV    200  /* Isend/Irecv/Waitall */
 
+/*
+ * Maximum refinement level of the coarse octree used to group element
+ * extents into per-rank sub-extents (3 bits per level in 3D)
+ */
+
+#define _SUB_EXTENTS_MAX_LEVEL    10
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
 
 typedef struct {
 
-  int       n;       /* Number of intersecting distant ranks */
-  int      *rank;    /* List of intersecting distant ranks */
-  double   *extents; /* List of intersecting distant extents */
+  int       n;            /* Number of intersecting distant ranks */
+  int      *rank;         /* List of intersecting distant ranks */
+  int      *extents_idx;  /* Index of distant extents for each rank
+                             (size: n + 1), or NULL if one extent
+                             per rank */
+  double   *extents;      /* List of intersecting distant extents */
 
 } _rank_intersects_t;
 
+/* Morton code of an element extent's center, used to group extents */
+
+typedef struct {
+
+  uint64_t    code;  /* Morton code in coarse octree */
+  ple_lnum_t  id;    /* Element extent id */
+
+} _sub_extents_code_t;
+
 /*----------------------------------------------------------------------------
  * Structure defining a locator
  *----------------------------------------------------------------------------*/
@@ -269,6 +292,11 @@ typedef int
 
 static int _ple_locator_async_threshold = 128;
 
+/* maximum number of sub-extents describing the mesh on each rank
+   (1 for a single bounding box per rank) */
+
+static int _ple_locator_max_rank_extents = 1;
+
 /* global logging function */
 
 static ple_locator_log_t   *_ple_locator_log_func = NULL;
@@ -756,7 +784,7 @@ _location_ranks(ple_locator_t  *this_locator,
       this_locator->intersect_rank[k++] = j;
   }
 
-  if (this_locator->locate_algorithm == _LOCATE_BB_SENDRECV_ORDERED) {
+  if (this_locator->locate_algorithm >= _LOCATE_BB_SENDRECV_ORDERED) {
     int rank_id;
     MPI_Comm_rank(this_locator->comm, &rank_id);
     PLE_REALLOC(this_locator->comm_order, this_locator->n_intersects, int);
@@ -809,6 +837,237 @@ _location_ranks(ple_locator_t  *this_locator,
   this_locator->location_cpu_time[1] += comm_timing[1];
 }
 
+/*----------------------------------------------------------------------------
+ * Compare Morton codes of element extents (for qsort).
+ *
+ * parameters:
+ *   x <-- pointer to first code
+ *   y <-- pointer to second code
+ *
+ * returns:
+ *   -1 if x < y, 0 if x = y, 1 if x > y
+ *----------------------------------------------------------------------------*/
+
+static int
+_compare_sub_extents_codes(const void  *x,
+                           const void  *y)
+{
+  const _sub_extents_code_t *c_x = x;
+  const _sub_extents_code_t *c_y = y;
+
+  if (c_x->code < c_y->code)
+    return -1;
+  else if (c_x->code > c_y->code)
+    return 1;
+  else if (c_x->id < c_y->id)
+    return -1;
+  else if (c_x->id > c_y->id)
+    return 1;
+
+  return 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute sub-extents of the local mesh.
+ *
+ * Element extents provided by the mesh representation are grouped
+ * using a coarse octree (quadtree in 2D) built over the mesh extents:
+ * the finest level for which the number of non-empty leaves does not exceed
+ * the allowed number of sub-extents is selected, and the extents of elements
+ * whose center lies in a given leaf are merged.
+ *
+ * parameters:
+ *   dim                <-- spatial dimension
+ *   mesh               <-- pointer to mesh representation structure
+ *   tolerance_base     <-- associated fixed tolerance
+ *   tolerance_fraction <-- associated fraction of element bounding
+ *                          boxes added to tolerance
+ *   n_max_sub_extents  <-- maximum number of sub-extents
+ *   mesh_extents_f     <-- pointer to function computing mesh or mesh
+ *                          subset or element extents
+ *   sub_extents        --> pointer to sub-extents, or NULL
+ *                          (size: 2*dim*n_sub_extents)
+ *
+ * returns:
+ *   number of computed sub-extents (0 if the mesh representation does not
+ *   provide element extents)
+ *----------------------------------------------------------------------------*/
+
+static int
+_mesh_sub_extents(int                  dim,
+                  const void          *mesh,
+                  float                tolerance_base,
+                  float                tolerance_fraction,
+                  int                  n_max_sub_extents,
+                  ple_mesh_extents_t  *mesh_extents_f,
+                  double             **sub_extents)
+{
+  const int stride2 = dim * 2;
+  const int max_level = _SUB_EXTENTS_MAX_LEVEL;
+  const uint64_t n_l_cells = ((uint64_t)1) << max_level;
+
+  int n_sub_extents = 0;
+  double mesh_extents[6], *_sub_extents = NULL;
+
+  *sub_extents = NULL;
+
+  /* Query and compute element extents */
+
+  ple_lnum_t n_elts = mesh_extents_f(mesh, -1, tolerance_fraction, NULL);
+
+  if (n_elts < 2 || n_max_sub_extents < 2)
+    return 0;
+
+  double *elt_extents;
+  PLE_MALLOC(elt_extents, n_elts*stride2, double);
+
+  n_elts = mesh_extents_f(mesh, n_elts, tolerance_fraction, elt_extents);
+
+  if (n_elts < 2) {
+    PLE_FREE(elt_extents);
+    return 0;
+  }
+
+  for (int j = 0; j < dim; j++) {
+    mesh_extents[j]       =  HUGE_VAL;
+    mesh_extents[j + dim] = -HUGE_VAL;
+  }
+
+  for (ple_lnum_t i = 0; i < n_elts; i++) {
+    const double *e = elt_extents + i*stride2;
+    for (int j = 0; j < dim; j++) {
+      if (e[j] < mesh_extents[j])
+        mesh_extents[j] = e[j];
+      if (e[j + dim] > mesh_extents[j + dim])
+        mesh_extents[j + dim] = e[j + dim];
+    }
+  }
+
+  /* Morton codes of element extent centers at the finest level */
+
+  _sub_extents_code_t *codes;
+  PLE_MALLOC(codes, n_elts, _sub_extents_code_t);
+
+  for (ple_lnum_t i = 0; i < n_elts; i++) {
+
+    const double *e = elt_extents + i*stride2;
+    uint64_t c[3] = {0, 0, 0};
+
+    for (int j = 0; j < dim; j++) {
+      double w = mesh_extents[j + dim] - mesh_extents[j];
+      if (w > 0) {
+        double x = (0.5*(e[j] + e[j + dim]) - mesh_extents[j]) / w;
+        c[j] = (uint64_t)(x * (double)n_l_cells);
+        if (c[j] >= n_l_cells)
+          c[j] = n_l_cells - 1;
+      }
+    }
+
+    codes[i].code = 0;
+    codes[i].id = i;
+    for (int l = max_level - 1; l >= 0; l--) {
+      for (int j = 0; j < dim; j++)
+        codes[i].code = (codes[i].code << 1) | ((c[j] >> l) & 1);
+    }
+
+  }
+
+  qsort(codes, n_elts, sizeof(_sub_extents_code_t),
+        _compare_sub_extents_codes);
+
+  /* Select finest level with at most n_max_sub_extents non-empty leaves;
+     as codes are ordered, leaves of a given level are contiguous */
+
+  int level = 0;
+
+  for (int l = 1; l <= max_level; l++) {
+    int shift = dim * (max_level - l);
+    int n_leaves = 1;
+    for (ple_lnum_t i = 1; i < n_elts && n_leaves <= n_max_sub_extents; i++) {
+      if ((codes[i].code >> shift) != (codes[i-1].code >> shift))
+        n_leaves++;
+    }
+    if (n_leaves > n_max_sub_extents)
+      break;
+    level = l;
+  }
+
+  /* Merge element extents by leaf */
+
+  const int shift = dim * (max_level - level);
+
+  PLE_MALLOC(_sub_extents, n_max_sub_extents*stride2, double);
+
+  for (ple_lnum_t i = 0; i < n_elts; i++) {
+
+    const double *e = elt_extents + codes[i].id*stride2;
+
+    if (i == 0 || (codes[i].code >> shift) != (codes[i-1].code >> shift)) {
+      double *s = _sub_extents + n_sub_extents*stride2;
+      for (int j = 0; j < stride2; j++)
+        s[j] = e[j];
+      n_sub_extents++;
+    }
+    else {
+      double *s = _sub_extents + (n_sub_extents-1)*stride2;
+      for (int j = 0; j < dim; j++) {
+        if (e[j] < s[j])
+          s[j] = e[j];
+        if (e[j + dim] > s[j + dim])
+          s[j + dim] = e[j + dim];
+      }
+    }
+
+  }
+
+  PLE_FREE(codes);
+  PLE_FREE(elt_extents);
+
+  /* Add base tolerance */
+
+  for (int i = 0; i < n_sub_extents; i++) {
+    double *s = _sub_extents + i*stride2;
+    for (int j = 0; j < dim; j++) {
+      s[j]       -= tolerance_base;
+      s[j + dim] += tolerance_base;
+    }
+  }
+
+  PLE_REALLOC(_sub_extents, n_sub_extents*stride2, double);
+
+  *sub_extents = _sub_extents;
+
+  return n_sub_extents;
+}
+
+/*----------------------------------------------------------------------------
+ * Test if given extents intersect at least one of a set of extents
+ *
+ * parameters:
+ *   dim         <-- spatial dimension
+ *   extents     <-- extents: x_min, y_min, ..., x_max, y_max, ...
+ *                   size: dim*2
+ *   n_extents   <-- number of extents in set
+ *   set_extents <-- extents set (size: dim*2*n_extents)
+ *
+ * returns:
+ *   true if extents intersect, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_intersect_extents_set(int           dim,
+                       const double  extents[],
+                       int           n_extents,
+                       const double  set_extents[])
+{
+  for (int i = 0; i < n_extents; i++) {
+    if (_intersect_extents(dim, extents, set_extents + i*dim*2))
+      return true;
+  }
+
+  return false;
+}
+
 /*----------------------------------------------------------------------------
  * Determine or update possibly intersecting ranks for unlocated elements,
  * in parallel.
@@ -921,42 +1180,146 @@ _intersects_distant(ple_locator_t       *this_locator,
 
   _locator_trace_end_comm(_ple_locator_log_end_g_comm, comm_timing);
 
-  /* Count and mark possible overlaps */
+  /* Optional sub-extents (finer description of each rank's mesh) */
+
+  int n_sub_extents = 0;
+  double *sub_extents = NULL;
+
+  int *sub_count = NULL, *sub_idx = NULL;
+  double *sub_recvbuf = NULL;
+
+  if (   this_locator->locate_algorithm >= _LOCATE_SUB_BB_SENDRECV_ORDERED
+      && _ple_locator_max_rank_extents > 1 && mesh != NULL)
+    n_sub_extents = _mesh_sub_extents(dim,
+                                      mesh,
+                                      tolerance_base,
+                                      tolerance_fraction,
+                                      _ple_locator_max_rank_extents,
+                                      mesh_extents_f,
+                                      &sub_extents);
+
+  PLE_MALLOC(sub_count, comm_size, int);
+  PLE_MALLOC(sub_idx, comm_size + 1, int);
+
+  for (int i = 0; i < comm_size; i++)
+    sub_count[i] = 0;
+
+  /* As settings may differ between ranks (or coupled codes),
+     sub-extent counts are always exchanged if all ranks support it */
+
+  _locator_trace_start_comm(_ple_locator_log_start_g_comm, comm_timing);
+
+  if (this_locator->locate_algorithm >= _LOCATE_SUB_BB_SENDRECV_ORDERED)
+    MPI_Allgather(&n_sub_extents, 1, MPI_INT, sub_count, 1, MPI_INT,
+                  this_locator->comm);
+
+  sub_idx[0] = 0;
+  for (int i = 0; i < comm_size; i++)
+    sub_idx[i+1] = sub_idx[i] + sub_count[i];
+
+  if (sub_idx[comm_size] > 0) {
+
+    PLE_MALLOC(sub_recvbuf, sub_idx[comm_size]*stride2, double);
+
+    for (int i = 0; i < comm_size; i++) {
+      sub_count[i] *= stride2;
+      sub_idx[i] *= stride2;
+    }
+
+    MPI_Allgatherv(sub_extents, n_sub_extents*stride2, MPI_DOUBLE,
+                   sub_recvbuf, sub_count, sub_idx, MPI_DOUBLE,
+                   this_locator->comm);
+
+    for (int i = 0; i < comm_size; i++) {
+      sub_count[i] /= stride2;
+      sub_idx[i] /= stride2;
+    }
+
+  }
+
+  _locator_trace_end_comm(_ple_locator_log_end_g_comm, comm_timing);
+
+  /* Count and mark possible overlaps; element extents of a rank
+     are given by its sub-extents if available */
 
   n_intersects = 0;
   PLE_MALLOC(intersect_rank, this_locator->n_ranks, int);
 
+  int n_intersect_extents = 0;
+
   for (int i = 0; i < this_locator->n_ranks; i++) {
+
     j = this_locator->start_rank + i;
-    if (  (_intersect_extents(dim,
-                              extents + (2*dim),
-                              recvbuf + (j*stride4)) == true)
-        || (_intersect_extents(dim,
-                               extents,
-                               recvbuf + (j*stride4) + (2*dim)) == true)) {
+
+    bool intersect = false;
+
+    if (sub_count[j] > 0)
+      intersect = _intersect_extents_set(dim,
+                                         extents + (2*dim),
+                                         sub_count[j],
+                                         sub_recvbuf + sub_idx[j]*stride2);
+    else
+      intersect = _intersect_extents(dim,
+                                     extents + (2*dim),
+                                     recvbuf + (j*stride4));
+
+    if (intersect == false) {
+      if (n_sub_extents > 0)
+        intersect = _intersect_extents_set(dim,
+                                           recvbuf + (j*stride4) + (2*dim),
+                                           n_sub_extents,
+                                           sub_extents);
+      else
+        intersect = _intersect_extents(dim,
+                                       extents,
+                                       recvbuf + (j*stride4) + (2*dim));
+    }
+
+    if (intersect) {
       intersect_rank[n_intersects] = j;
       n_intersects += 1;
+      n_intersect_extents += (sub_count[j] > 0) ? sub_count[j] : 1;
     }
+
   }
 
   intersects.n = n_intersects;
   PLE_MALLOC(intersects.rank, intersects.n, int);
-  PLE_MALLOC(intersects.extents, intersects.n * stride2, double);
+  PLE_MALLOC(intersects.extents_idx, intersects.n + 1, int);
+  PLE_MALLOC(intersects.extents, n_intersect_extents * stride2, double);
+
+  intersects.extents_idx[0] = 0;
 
   for (int i = 0; i < intersects.n; i++) {
 
-    intersects.rank[i] = intersect_rank[i];
+    int r = intersect_rank[i];
+    int s_id = intersects.extents_idx[i];
+
+    intersects.rank[i] = r;
 
     /* Copy only distant element (and not point) extents */
 
-    for (j = 0; j < stride2; j++)
-      intersects.extents[i*stride2 + j]
-        = recvbuf[intersect_rank[i]*stride4 + j];
+    if (sub_count[r] > 0) {
+      memcpy(intersects.extents + s_id*stride2,
+             sub_recvbuf + sub_idx[r]*stride2,
+             sub_count[r]*stride2*sizeof(double));
+      intersects.extents_idx[i+1] = s_id + sub_count[r];
+    }
+    else {
+      for (j = 0; j < stride2; j++)
+        intersects.extents[s_id*stride2 + j] = recvbuf[r*stride4 + j];
+      intersects.extents_idx[i+1] = s_id + 1;
+    }
 
   }
 
   /* Free temporary memory */
 
+  PLE_FREE(sub_recvbuf);
+  PLE_FREE(sub_idx);
+  PLE_FREE(sub_count);
+  PLE_FREE(sub_extents);
+
   PLE_FREE(intersect_rank);
   PLE_FREE(recvbuf);
 
@@ -1117,7 +1480,6 @@ _locate_distant(ple_locator_t               *this_locator,
   MPI_Status status;
 
   ple_lnum_t _n_points = 0;
-  double extents[6];
 
   double comm_timing[4] = {0., 0., 0., 0.};
 
@@ -1188,7 +1550,7 @@ _locate_distant(ple_locator_t               *this_locator,
     send_tag = NULL;
 
   int *comm_order = NULL;
-  if (this_locator->locate_algorithm == _LOCATE_BB_SENDRECV_ORDERED) {
+  if (this_locator->locate_algorithm >= _LOCATE_BB_SENDRECV_ORDERED) {
     int comm_size, rank_id;
     MPI_Comm_size(this_locator->comm, &comm_size);
     MPI_Comm_rank(this_locator->comm, &rank_id);
@@ -1216,8 +1578,8 @@ _locate_distant(ple_locator_t               *this_locator,
 
     n_coords_loc = 0;
 
-    for (k = 0; k < stride; k++)
-      extents[k] = intersects.extents[dist_index*stride + k];
+    const int s_id = intersects.extents_idx[dist_index];
+    const int e_id = intersects.extents_idx[dist_index + 1];
 
     /* Build partial buffer */
 
@@ -1230,9 +1592,13 @@ _locate_distant(ple_locator_t               *this_locator,
       else
         coord_idx = j;
 
-      if (_within_extents(dim,
-                          &(point_coords[dim*coord_idx]),
-                          extents) == true) {
+      bool within = false;
+      for (k = s_id; k < e_id && within == false; k++)
+        within = _within_extents(dim,
+                                 &(point_coords[dim*coord_idx]),
+                                 intersects.extents + k*stride);
+
+      if (within) {
 
         if (_point_id != NULL)
           send_id[n_coords_loc] = _point_id[j] -idb;
@@ -1366,6 +1732,7 @@ _locate_distant(ple_locator_t               *this_locator,
   }
 
   PLE_FREE(intersects.rank);
+  PLE_FREE(intersects.extents_idx);
   PLE_FREE(intersects.extents);
 
   /* Finalize timing */
@@ -3068,8 +3435,8 @@ ple_locator_extend_search(ple_locator_t               *this_locator,
     int locflag[6] = {-1,
                       -1,
                       1, /* equivalent to _LOCATE_BB_SENDRECV */
-                      -_LOCATE_BB_SENDRECV_ORDERED,
-                      _LOCATE_BB_SENDRECV_ORDERED,
+                      -_LOCATE_SUB_BB_SENDRECV_ORDERED,
+                      _LOCATE_SUB_BB_SENDRECV_ORDERED,
                       0};
     ple_lnum_t  *location_rank_id;
 
@@ -3827,6 +4194,46 @@ ple_locator_set_async_threshold(int threshold)
   _ple_locator_async_threshold = threshold;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get the maximum number of sub-extents used to describe the
+ * mesh of each rank for location.
+ *
+ * \return the maximum number of sub-extents per rank
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+ple_locator_get_max_rank_extents(void)
+{
+  return _ple_locator_max_rank_extents;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the maximum number of sub-extents used to describe the
+ * mesh of each rank for location.
+ *
+ * By default, a single bounding box is used for each rank. With a higher
+ * value, element extents provided by the mesh representation's extents
+ * function are grouped using a coarse octree into at most this number
+ * of boxes, which are exchanged between ranks, so that points are only
+ * sent to ranks for which they lie in one of these boxes. This is useful
+ * for thin or curved meshes, whose bounding boxes overlap strongly.
+ *
+ * Element extents are only used if the mesh representation's extents
+ * function may return more than one extent.
+ *
+ * \param[in] n_max_extents maximum number of sub-extents per rank
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+ple_locator_set_max_rank_extents(int n_max_extents)
+{
+  _ple_locator_max_rank_extents = (n_max_extents > 1) ? n_max_extents : 1;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Register communication logging functions for locator instrumentation.
@@ -543,6 +543,42 @@ ple_locator_set_async_threshold(int threshold);
 
 #endif /* defined(PLE_HAVE_MPI) */
 
+/*----------------------------------------------------------------------------
+ * Get the maximum number of sub-extents used to describe the mesh
+ * of each rank for location.
+ *
+ * returns:
+ *   the maximum number of sub-extents per rank
+ *----------------------------------------------------------------------------*/
+
+#if defined(PLE_HAVE_MPI)
+
+int
+ple_locator_get_max_rank_extents(void);
+
+#endif /* defined(PLE_HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Set the maximum number of sub-extents used to describe the mesh
+ * of each rank for location.
+ *
+ * By default, a single bounding box is used for each rank. With a higher
+ * value, element extents provided by the mesh representation's extents
+ * function are grouped using a coarse octree into at most this number
+ * of boxes, so that points are only sent to ranks for which they lie
+ * in one of these boxes.
+ *
+ * parameters:
+ *   n_max_extents  <-- maximum number of sub-extents per rank
+ *----------------------------------------------------------------------------*/
+
+#if defined(PLE_HAVE_MPI)
+
+void
+ple_locator_set_max_rank_extents(int n_max_extents);
+
+#endif /* defined(PLE_HAVE_MPI) */
+
 /*----------------------------------------------------------------------------
  * Register communication logging functions for locator instrumentation.
  *
@@ -483,6 +483,22 @@ _variant_build_list(int                             n_fill_types,
 
   }
 
+  if (type_filter[CS_MATRIX_SELL]) {
+
+    _variant_add("SELL-C-sigma",
+                 CS_MATRIX_SELL,
+                 n_fill_types,
+                 fill_types,
+                 2, /* ed_flag */
+                 "standard",
+                 "standard",
+                 NULL,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+  }
+
   n_variants_max = *n_variants;
   BFT_REALLOC(*m_variant, *n_variants, cs_matrix_timing_variant_t);
 }
@@ -670,7 +686,7 @@ _matrix_check(int                          n_variants,
 
           /* Check multiplication */
 
-          vector_multiply(ed_flag, m, x, y);
+          vector_multiply(ed_flag, false, m, x, y);
           if (v_id == 0)
             memcpy(yr0, y, n_rows*_block_mult*sizeof(cs_real_t));
           else {
@@ -928,7 +944,7 @@ _matrix_time_test(double                       t_measure,
                   test_sum = 0;
                 wti = cs_timer_wtime(), wtf = wti;
                 if (mpi_flag > 0)
-                  vector_multiply(ed_flag, m, x, y);
+                  vector_multiply(ed_flag, false, m, x, y);
                 else {
                   if (ed_flag == 0)
                     cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m, x, y);
@@ -1423,6 +1439,7 @@ cs_benchmark_matrix(double                 t_measure,
   int  t_id, f_id, v_id, ed_flag;
 
   bool                   type_filter[CS_MATRIX_N_BUILTIN_TYPES] = {true,
+                                                                   true,
                                                                    true,
                                                                    true,
                                                                    true};
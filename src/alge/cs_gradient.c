@@ -143,6 +143,16 @@ typedef struct {
 
 } cs_gradient_quantities_t;
 
+/* Pending halo exchange of a gradient's base variable */
+
+typedef struct {
+
+  cs_halo_state_t  *hs;            /* Halo state of the pending exchange */
+  cs_real_t        *var;           /* Mutable view of the base variable,
+                                      whose ghost values are being received */
+
+} cs_gradient_sync_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -172,6 +182,10 @@ static int _gradient_stat_id = -1;
 static int                        _n_gradient_quantities = 0;
 static cs_gradient_quantities_t  *_gradient_quantities = NULL;
 
+/* Halo state for exchanges overlapped with gradient computations */
+
+static cs_halo_state_t  *_gradient_halo_state = NULL;
+
 /*============================================================================
  * Prototypes for functions intended for use only by Fortran wrappers.
  * (descriptions follow, with function bodies).
@@ -505,6 +519,68 @@ _gradient_info_dump(cs_gradient_info_t *this_info)
                 this_info->t_tot.wall_nsec*1e-9);
 }
 
+/*----------------------------------------------------------------------------
+ * Return halo type required for synchronization of a gradient's inputs.
+ *
+ * The extended halo is only exchanged when the extended neighborhood
+ * is actually used by the selected gradient algorithm.
+ *
+ * parameters:
+ *   m             <-- pointer to associated mesh structure
+ *   gradient_type <-- gradient type
+ *   halo_type     <-- requested halo type
+ *
+ * returns:
+ *   halo type used for synchronization
+ *----------------------------------------------------------------------------*/
+
+static inline cs_halo_type_t
+_sync_halo_type(const cs_mesh_t     *m,
+                cs_gradient_type_t   gradient_type,
+                cs_halo_type_t       halo_type)
+{
+  if (   halo_type == CS_HALO_EXTENDED
+      && (   m->cell_cells_idx == NULL
+          || gradient_type == CS_GRADIENT_GREEN_ITER))
+    return CS_HALO_STANDARD;
+
+  return halo_type;
+}
+
+/*----------------------------------------------------------------------------
+ * Indicate whether the halo exchange of a scalar gradient's base variable
+ * may be overlapped with the gradient computation.
+ *
+ * This is only the case for the standard least-squares reconstruction,
+ * which completes the exchange after its local interior faces loop.
+ *
+ * parameters:
+ *   gradient_type <-- gradient type
+ *   tr_dim        <-- 2 for tensor with periodicity of rotation, 0 otherwise
+ *   hyd_p_flag    <-- flag for hydrostatic pressure
+ *   w_stride      <-- stride for weighting coefficient
+ *   c_weight      <-- weighted gradient coefficient variable, or NULL
+ *
+ * returns:
+ *   true if the exchange may be overlapped, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_overlap_sync(cs_gradient_type_t   gradient_type,
+              int                  tr_dim,
+              int                  hyd_p_flag,
+              int                  w_stride,
+              const cs_real_t     *c_weight)
+{
+  if (   (   gradient_type != CS_GRADIENT_LSQ
+          && gradient_type != CS_GRADIENT_GREEN_LSQ)
+      || tr_dim > 0 || hyd_p_flag != 0
+      || (w_stride == 6 && c_weight != NULL))
+    return false;
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------
  * Return pointer to gradient computation info.
  *
@@ -2474,6 +2550,8 @@ _get_cell_cocg_lsq(const cs_mesh_t               *m,
  *   pvar           <-- variable
  *   c_weight       <-- weighted gradient coefficient variable,
  *                      or NULL
+ *   sync           <-> pending pvar halo exchange (completed here),
+ *                      or NULL if pvar is already synchronized
  *   grad           <-> gradient of pvar (halo prepared for periodicity
  *                      of rotation)
  *----------------------------------------------------------------------------*/
@@ -2493,6 +2571,7 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
                      const cs_real_t                 coefbp[],
                      const cs_real_t                 pvar[],
                      const cs_real_t       *restrict c_weight,
+                     cs_gradient_sync_t             *sync,
                      cs_real_3_t           *restrict grad)
 {
   const cs_lnum_t n_cells = m->n_cells;
@@ -2651,6 +2730,13 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
   /* Compute Right-Hand Side */
   /*-------------------------*/
 
+  /* Overlapping of the pvar halo exchange is only handled
+     for the standard case */
+
+  assert(sync == NULL || (hyd_p_flag == 0 && sync->var == pvar));
+
+  const cs_lnum_t n_cells_val = (sync != NULL) ? n_cells : n_cells_ext;
+
   cs_real_4_t  *restrict rhsv;
   BFT_MALLOC(rhsv, n_cells_ext, cs_real_4_t);
 
@@ -2659,7 +2745,7 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
     rhsv[c_id][0] = 0.0;
     rhsv[c_id][1] = 0.0;
     rhsv[c_id][2] = 0.0;
-    rhsv[c_id][3] = pvar[c_id];
+    rhsv[c_id][3] = (c_id < n_cells_val) ? pvar[c_id] : 0.0;
   }
 
   /* Standard case, without hydrostatic pressure */
@@ -2667,62 +2753,83 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
 
   if (hyd_p_flag == 0) {
 
-    /* Contribution from interior faces */
+    /* Contribution from interior faces; if the halo exchange is still
+       pending, faces adjacent to ghost cells are handled in a second
+       pass, once it is completed */
 
-    for (g_id = 0; g_id < n_i_groups; g_id++) {
+    const int n_passes = (sync != NULL) ? 2 : 1;
 
-#     pragma omp parallel for private(pfac, dc, fctb)
-      for (t_id = 0; t_id < n_i_threads; t_id++) {
+    for (int pass_id = 0; pass_id < n_passes; pass_id++) {
 
-        for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-             f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-             f_id++) {
+      if (pass_id == 1) {
+        cs_halo_sync_wait(m->halo, sync->var, sync->hs);
+#       pragma omp parallel for if (n_cells_ext - n_cells > CS_THR_MIN)
+        for (cs_lnum_t c_id = n_cells; c_id < n_cells_ext; c_id++)
+          rhsv[c_id][3] = pvar[c_id];
+      }
 
-          cs_lnum_t ii = i_face_cells[f_id][0];
-          cs_lnum_t jj = i_face_cells[f_id][1];
+      for (g_id = 0; g_id < n_i_groups; g_id++) {
 
-          cs_real_t pond = weight[f_id];
+#       pragma omp parallel for private(pfac, dc, fctb)
+        for (t_id = 0; t_id < n_i_threads; t_id++) {
 
-          for (cs_lnum_t ll = 0; ll < 3; ll++)
-            dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+          for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+               f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+               f_id++) {
 
-          if (c_weight != NULL) {
-            /* (P_j - P_i) / ||d||^2 */
-            pfac =   (rhsv[jj][3] - rhsv[ii][3])
-                   / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+            cs_lnum_t ii = i_face_cells[f_id][0];
+            cs_lnum_t jj = i_face_cells[f_id][1];
 
-            for (cs_lnum_t ll = 0; ll < 3; ll++)
-              fctb[ll] = dc[ll] * pfac;
+            if (n_passes > 1) {
+              bool ghost_face = (ii >= n_cells || jj >= n_cells);
+              if (ghost_face != (pass_id == 1))
+                continue;
+            }
 
-            cs_real_t denom = 1. / (  pond       *c_weight[ii]
-                                    + (1. - pond)*c_weight[jj]);
+            cs_real_t pond = weight[f_id];
 
             for (cs_lnum_t ll = 0; ll < 3; ll++)
-              rhsv[ii][ll] +=  c_weight[jj] * denom * fctb[ll];
+              dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
 
-            for (cs_lnum_t ll = 0; ll < 3; ll++)
-              rhsv[jj][ll] +=  c_weight[ii] * denom * fctb[ll];
-          }
-          else {
-            /* (P_j - P_i) / ||d||^2 */
-            pfac =   (rhsv[jj][3] - rhsv[ii][3])
-                   / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+            if (c_weight != NULL) {
+              /* (P_j - P_i) / ||d||^2 */
+              pfac =   (rhsv[jj][3] - rhsv[ii][3])
+                     / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
 
-            for (cs_lnum_t ll = 0; ll < 3; ll++)
-              fctb[ll] = dc[ll] * pfac;
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                fctb[ll] = dc[ll] * pfac;
 
-            for (cs_lnum_t ll = 0; ll < 3; ll++)
-              rhsv[ii][ll] += fctb[ll];
+              cs_real_t denom = 1. / (  pond       *c_weight[ii]
+                                      + (1. - pond)*c_weight[jj]);
 
-            for (cs_lnum_t ll = 0; ll < 3; ll++)
-              rhsv[jj][ll] += fctb[ll];
-          }
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                rhsv[ii][ll] +=  c_weight[jj] * denom * fctb[ll];
 
-        } /* loop on faces */
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                rhsv[jj][ll] +=  c_weight[ii] * denom * fctb[ll];
+            }
+            else {
+              /* (P_j - P_i) / ||d||^2 */
+              pfac =   (rhsv[jj][3] - rhsv[ii][3])
+                     / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
 
-      } /* loop on threads */
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                fctb[ll] = dc[ll] * pfac;
 
-    } /* loop on thread groups */
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                rhsv[ii][ll] += fctb[ll];
+
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                rhsv[jj][ll] += fctb[ll];
+            }
+
+          } /* loop on faces */
+
+        } /* loop on threads */
+
+      } /* loop on thread groups */
+
+    } /* loop on passes */
 
     /* Contribution from extended neighborhood */
 
@@ -7535,6 +7642,8 @@ _initialize_tensor_gradient(const cs_mesh_t              *m,
  *                                  or NULL
  * \param[in]       cpl             structure associated with internal coupling,
  *                                  or NULL
+ * \param[in, out]  sync            pending var halo exchange, or NULL
+ *                                  if var is already synchronized
  * \param[out]      grad            gradient
  */
 /*----------------------------------------------------------------------------*/
@@ -7558,14 +7667,23 @@ _gradient_scalar(const char                    *var_name,
                  cs_real_t                      f_ext[][3],
                  const cs_real_t                bc_coeff_a[],
                  const cs_real_t                bc_coeff_b[],
-                 const cs_real_t                var[restrict],
+                 const cs_real_t                var[],
                  const cs_real_t                c_weight[restrict],
                  const cs_internal_coupling_t  *cpl,
+                 cs_gradient_sync_t            *sync,
                  cs_real_t                      grad[restrict][3])
 {
   const cs_mesh_t  *mesh = cs_glob_mesh;
   cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
 
+  /* A pending halo exchange may only be overlapped with the
+     interior faces loop of the least-squares reconstruction */
+
+  assert(   sync == NULL
+         || (   _overlap_sync(gradient_type, tr_dim, hyd_p_flag,
+                              w_stride, c_weight)
+             && sync->var == var));
+
   cs_lnum_t n_b_faces = mesh->n_b_faces;
   cs_lnum_t n_cells_ext = mesh->n_cells_with_ghosts;
 
@@ -7665,6 +7783,7 @@ _gradient_scalar(const char                    *var_name,
                            bc_coeff_b,
                            var,
                            c_weight,
+                           sync,
                            grad);
 
     _scalar_gradient_clipping(halo_type,
@@ -7707,6 +7826,7 @@ _gradient_scalar(const char                    *var_name,
                              bc_coeff_b,
                              var,
                              c_weight,
+                             sync,
                              r_grad);
 
       _scalar_gradient_clipping(halo_type,
@@ -9115,6 +9235,8 @@ cs_gradient_finalize(void)
 {
   _gradient_quantities_destroy();
 
+  cs_halo_state_destroy(&_gradient_halo_state);
+
   cs_log_printf(CS_LOG_PERFORMANCE,
                 _("\n"
                   "Total elapsed time for all gradient computations:  %.3f s\n"),
@@ -9227,28 +9349,44 @@ cs_gradient_scalar(const char                    *var_name,
   if (update_stats == true)
     gradient_info = _find_or_add_system(var_name, gradient_type);
 
-  /* Synchronize variable */
+  /* Synchronize variable; for least-squares gradients, the exchange
+     of var is only started here, and completed once the interior faces
+     not adjacent to ghost cells have been handled */
+
+  cs_gradient_sync_t _sync = {.hs = NULL, .var = var};
+  cs_gradient_sync_t *sync = NULL;
 
   if (mesh->halo != NULL) {
 
+    cs_halo_type_t sync_type = _sync_halo_type(mesh, gradient_type, halo_type);
+
     if (tr_dim > 0)
-      cs_halo_sync_component(mesh->halo, halo_type,
+      cs_halo_sync_component(mesh->halo, sync_type,
                              CS_HALO_ROTATION_IGNORE, var);
+    else if (_overlap_sync(gradient_type, tr_dim, hyd_p_flag,
+                           w_stride, c_weight)) {
+      if (_gradient_halo_state == NULL)
+        _gradient_halo_state = cs_halo_state_create();
+      _sync.hs = _gradient_halo_state;
+      sync = &_sync;
+      cs_halo_sync_start(mesh->halo, sync_type, CS_REAL_TYPE, 1, var,
+                         sync->hs);
+    }
     else
-      cs_halo_sync_var(mesh->halo, halo_type, var);
+      cs_halo_sync_var(mesh->halo, sync_type, var);
 
     if (c_weight != NULL) {
       if (w_stride == 6) {
-        cs_halo_sync_var_strided(mesh->halo, halo_type, c_weight, 6);
-        cs_halo_perio_sync_var_sym_tens(mesh->halo, halo_type, c_weight);
+        cs_halo_sync_var_strided(mesh->halo, sync_type, c_weight, 6);
+        cs_halo_perio_sync_var_sym_tens(mesh->halo, sync_type, c_weight);
       }
       else
-        cs_halo_sync_var(mesh->halo, halo_type, c_weight);
+        cs_halo_sync_var(mesh->halo, sync_type, c_weight);
     }
 
     if (hyd_p_flag == 1) {
-      cs_halo_sync_var_strided(mesh->halo, halo_type, (cs_real_t *)f_ext, 3);
-      cs_halo_perio_sync_var_vect(mesh->halo, halo_type, (cs_real_t *)f_ext, 3);
+      cs_halo_sync_var_strided(mesh->halo, sync_type, (cs_real_t *)f_ext, 3);
+      cs_halo_perio_sync_var_vect(mesh->halo, sync_type, (cs_real_t *)f_ext, 3);
     }
 
   }
@@ -9274,6 +9412,7 @@ cs_gradient_scalar(const char                    *var_name,
                    var,
                    c_weight,
                    cpl,
+                   sync,
                    grad);
 
   t1 = cs_timer_time();
@@ -9348,12 +9487,14 @@ cs_gradient_vector(const char                    *var_name,
 
   if (mesh->halo != NULL) {
 
-    cs_halo_sync_var_strided(mesh->halo, halo_type, (cs_real_t *)var, 3);
+    cs_halo_type_t sync_type = _sync_halo_type(mesh, gradient_type, halo_type);
+
+    cs_halo_sync_var_strided(mesh->halo, sync_type, (cs_real_t *)var, 3);
     if (cs_glob_mesh->n_init_perio > 0)
-      cs_halo_perio_sync_var_vect(mesh->halo, halo_type, (cs_real_t *)var, 3);
+      cs_halo_perio_sync_var_vect(mesh->halo, sync_type, (cs_real_t *)var, 3);
 
     if (c_weight != NULL)
-      cs_halo_sync_var(mesh->halo, halo_type, c_weight);
+      cs_halo_sync_var(mesh->halo, sync_type, c_weight);
 
   }
 
@@ -9447,9 +9588,10 @@ cs_gradient_tensor(const char                *var_name,
      (i.e. we assume it is the gradient of a vector field) */
 
   if (mesh->halo != NULL) {
-    cs_halo_sync_var_strided(mesh->halo, halo_type, (cs_real_t *)var, 6);
+    cs_halo_type_t sync_type = _sync_halo_type(mesh, gradient_type, halo_type);
+    cs_halo_sync_var_strided(mesh->halo, sync_type, (cs_real_t *)var, 6);
     if (mesh->n_init_perio > 0)
-      cs_halo_perio_sync_var_sym_tens(mesh->halo, halo_type, (cs_real_t *)var);
+      cs_halo_perio_sync_var_sym_tens(mesh->halo, sync_type, (cs_real_t *)var);
   }
 
   /* Compute gradient */
@@ -9582,6 +9724,7 @@ cs_gradient_scalar_synced_input(const char                 *var_name,
                    var,
                    c_weight,
                    cpl,
+                   NULL,
                    grad);
 
   t1 = cs_timer_time();
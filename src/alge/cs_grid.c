@@ -5473,6 +5473,25 @@ cs_grid_get_matrix(const cs_grid_t  *g)
   return m;
 }
 
+/*----------------------------------------------------------------------------
+ * Store extra-diagonal coefficients of a grid's matrix in single precision.
+ *
+ * This only applies to grids owning their matrix (i.e. coarse grids),
+ * whose matrix must be a scalar MSR matrix.
+ *
+ * parameters:
+ *   g <-> Grid structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_set_matrix_float(cs_grid_t  *g)
+{
+  assert(g != NULL);
+
+  if (g->_matrix != NULL)
+    cs_matrix_msr_convert_extra_diag_to_float(g->_matrix);
+}
+
 #if defined(HAVE_MPI)
 
 /*----------------------------------------------------------------------------
@@ -6229,6 +6248,199 @@ cs_grid_prolong_row_var(const cs_grid_t  *c,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Compute single-precision coarse row variable values from fine row values.
+ *
+ * Fine values may be given in single or double precision, so this function
+ * may be used both between single-precision levels and at the transition
+ * from double-precision levels.
+ *
+ * parameters:
+ *   f       <-- Fine grid structure
+ *   c       <-- Coarse grid structure
+ *   f_type  <-- Fine variable datatype (CS_REAL_TYPE or CS_FLOAT)
+ *   f_var   <-- Variable defined on fine grid rows
+ *   c_var   --> Variable defined on coarse grid rows
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_restrict_row_var_f(const cs_grid_t  *f,
+                           const cs_grid_t  *c,
+                           cs_datatype_t     f_type,
+                           const void       *f_var,
+                           float            *c_var)
+{
+  cs_lnum_t f_n_rows = f->n_rows;
+  cs_lnum_t c_n_cols_ext = c->n_elts_r[1];
+
+  const cs_lnum_t *coarse_row = c->coarse_row;
+  const cs_lnum_t *db_size = f->db_size;
+
+  assert(f != NULL);
+  assert(c != NULL);
+  assert(c->coarse_row != NULL || f_n_rows == 0);
+  assert(f_var != NULL || f_n_rows == 0);
+  assert(c_var != NULL || c_n_cols_ext == 0);
+
+  if (f_type != CS_REAL_TYPE && f_type != CS_FLOAT)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: unhandled fine variable datatype (%s)."),
+              __func__, cs_datatype_name[f_type]);
+
+  /* Set coarse values (negative coarse row ids may appear
+     due to penalization at the first level) */
+
+  cs_lnum_t _c_n_cols_ext = c_n_cols_ext*db_size[0];
+
+# pragma omp parallel for  if(_c_n_cols_ext > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < _c_n_cols_ext; ii++)
+    c_var[ii] = 0.f;
+
+  if (f_type == CS_REAL_TYPE) {
+    const cs_real_t *_f_var = f_var;
+    for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+      cs_lnum_t i = coarse_row[ii];
+      if (i >= 0) {
+        for (cs_lnum_t j = 0; j < db_size[0]; j++)
+          c_var[i*db_size[1]+j] += (float)(_f_var[ii*db_size[1]+j]);
+      }
+    }
+  }
+  else {
+    const float *_f_var = f_var;
+    for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+      cs_lnum_t i = coarse_row[ii];
+      if (i >= 0) {
+        for (cs_lnum_t j = 0; j < db_size[0]; j++)
+          c_var[i*db_size[1]+j] += _f_var[ii*db_size[1]+j];
+      }
+    }
+  }
+
+#if defined(HAVE_MPI)
+
+  /* If grid merging has taken place, gather coarse data */
+
+  if (c->merge_sub_size > 1) {
+
+    MPI_Comm  comm = cs_glob_mpi_comm;
+    static const int tag = 'r'+'e'+'s'+'t'+'r'+'i'+'c'+'t';
+
+    /* Append data */
+
+    if (c->merge_sub_rank == 0) {
+      int rank_id;
+      MPI_Status status;
+      assert(cs_glob_rank_id == c->merge_sub_root);
+      for (rank_id = 1; rank_id < c->merge_sub_size; rank_id++) {
+        cs_lnum_t n_recv = (  c->merge_cell_idx[rank_id+1]
+                            - c->merge_cell_idx[rank_id]);
+        int dist_rank = c->merge_sub_root + c->merge_stride*rank_id;
+        MPI_Recv(c_var + c->merge_cell_idx[rank_id]*db_size[1],
+                 n_recv*db_size[1], MPI_FLOAT, dist_rank, tag, comm, &status);
+      }
+    }
+    else
+      MPI_Send(c_var, c->n_elts_r[0]*db_size[1], MPI_FLOAT,
+               c->merge_sub_root, tag, comm);
+  }
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------
+ * Compute fine row variable values from single-precision coarse row values.
+ *
+ * Fine values may be set in single or double precision, so this function
+ * may be used both between single-precision levels and at the transition
+ * to double-precision levels.
+ *
+ * parameters:
+ *   c       <-- Coarse grid structure
+ *   f       <-- Fine grid structure
+ *   c_var   <-- Variable defined on coarse grid rows
+ *   f_type  <-- Fine variable datatype (CS_REAL_TYPE or CS_FLOAT)
+ *   f_var   --> Variable defined on fine grid rows
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_prolong_row_var_f(const cs_grid_t  *c,
+                          const cs_grid_t  *f,
+                          float            *c_var,
+                          cs_datatype_t     f_type,
+                          void             *f_var)
+{
+  const cs_lnum_t *db_size = f->db_size;
+
+  cs_lnum_t f_n_rows = f->n_rows;
+
+  assert(f != NULL);
+  assert(c != NULL);
+  assert(c->coarse_row != NULL || f_n_rows == 0);
+  assert(f_var != NULL);
+  assert(c_var != NULL);
+
+  if (f_type != CS_REAL_TYPE && f_type != CS_FLOAT)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: unhandled fine variable datatype (%s)."),
+              __func__, cs_datatype_name[f_type]);
+
+#if defined(HAVE_MPI)
+
+  /* If grid merging has taken place, scatter coarse data */
+
+  if (c->merge_sub_size > 1) {
+
+    MPI_Comm  comm = cs_glob_mpi_comm;
+    static const int tag = 'p'+'r'+'o'+'l'+'o'+'n'+'g';
+
+    /* Append data */
+
+    if (c->merge_sub_rank == 0) {
+      int rank_id;
+      assert(cs_glob_rank_id == c->merge_sub_root);
+      for (rank_id = 1; rank_id < c->merge_sub_size; rank_id++) {
+        cs_lnum_t n_send = (  c->merge_cell_idx[rank_id+1]
+                            - c->merge_cell_idx[rank_id]);
+        int dist_rank = c->merge_sub_root + c->merge_stride*rank_id;
+        MPI_Send(c_var + c->merge_cell_idx[rank_id]*db_size[1],
+                 n_send*db_size[1], MPI_FLOAT, dist_rank, tag, comm);
+      }
+    }
+    else {
+      MPI_Status status;
+      MPI_Recv(c_var, c->n_elts_r[0]*db_size[1], MPI_FLOAT,
+               c->merge_sub_root, tag, comm, &status);
+    }
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  /* Set fine values (possible penalization at first level) */
+
+  const cs_lnum_t *coarse_row = c->coarse_row;
+  const float *_c_var = c_var;
+
+  if (f_type == CS_REAL_TYPE) {
+    cs_real_t *_f_var = f_var;
+#   pragma omp parallel for if(f_n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+      cs_lnum_t ic = coarse_row[ii];
+      for (cs_lnum_t i = 0; i < db_size[0]; i++)
+        _f_var[ii*db_size[1]+i] = (ic >= 0) ? _c_var[ic*db_size[1]+i] : 0;
+    }
+  }
+  else {
+    float *_f_var = f_var;
+#   pragma omp parallel for if(f_n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+      cs_lnum_t ic = coarse_row[ii];
+      for (cs_lnum_t i = 0; i < db_size[0]; i++)
+        _f_var[ii*db_size[1]+i] = (ic >= 0) ? _c_var[ic*db_size[1]+i] : 0;
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Project coarse grid row numbers to base grid.
  *
@@ -254,6 +254,19 @@ cs_grid_get_n_g_rows(const cs_grid_t  *g);
 const cs_matrix_t *
 cs_grid_get_matrix(const cs_grid_t  *g);
 
+/*----------------------------------------------------------------------------
+ * Store extra-diagonal coefficients of a grid's matrix in single precision.
+ *
+ * This only applies to grids owning their matrix (i.e. coarse grids),
+ * whose matrix must be a scalar MSR matrix.
+ *
+ * parameters:
+ *   g <-> Grid structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_set_matrix_float(cs_grid_t  *g);
+
 #if defined(HAVE_MPI)
 
 /*----------------------------------------------------------------------------
@@ -367,6 +380,50 @@ cs_grid_prolong_row_var(const cs_grid_t  *c,
                         cs_real_t        *c_var,
                         cs_real_t        *f_var);
 
+/*----------------------------------------------------------------------------
+ * Compute single-precision coarse row variable values from fine row values.
+ *
+ * Fine values may be given in single or double precision, so this function
+ * may be used both between single-precision levels and at the transition
+ * from double-precision levels.
+ *
+ * parameters:
+ *   f       <-- Fine grid structure
+ *   c       <-- Coarse grid structure
+ *   f_type  <-- Fine variable datatype (CS_REAL_TYPE or CS_FLOAT)
+ *   f_var   <-- Variable defined on fine grid rows
+ *   c_var   --> Variable defined on coarse grid rows
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_restrict_row_var_f(const cs_grid_t  *f,
+                           const cs_grid_t  *c,
+                           cs_datatype_t     f_type,
+                           const void       *f_var,
+                           float            *c_var);
+
+/*----------------------------------------------------------------------------
+ * Compute fine row variable values from single-precision coarse row values.
+ *
+ * Fine values may be set in single or double precision, so this function
+ * may be used both between single-precision levels and at the transition
+ * to double-precision levels.
+ *
+ * parameters:
+ *   c       <-- Coarse grid structure
+ *   f       <-- Fine grid structure
+ *   c_var   <-- Variable defined on coarse grid rows
+ *   f_type  <-- Fine variable datatype (CS_REAL_TYPE or CS_FLOAT)
+ *   f_var   --> Variable defined on fine grid rows
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_prolong_row_var_f(const cs_grid_t  *c,
+                          const cs_grid_t  *f,
+                          float            *c_var,
+                          cs_datatype_t     f_type,
+                          void             *f_var);
+
 /*----------------------------------------------------------------------------
  * Project coarse grid row numbers to base grid.
  *
@@ -135,7 +135,8 @@ BEGIN_C_DECLS
 const char  *cs_matrix_type_name[] = {N_("native"),
                                       N_("CSR"),
                                       N_("symmetric CSR"),
-                                      N_("MSR")};
+                                      N_("MSR"),
+                                      N_("SELL")};
 
 /* Full names for matrix types */
 
@@ -143,7 +144,8 @@ const char
 *cs_matrix_type_fullname[] = {N_("diagonal + faces"),
                               N_("Compressed Sparse Row"),
                               N_("symmetric Compressed Sparse Row"),
-                              N_("Modified Compressed Sparse Row")};
+                              N_("Modified Compressed Sparse Row"),
+                              N_("Sliced ELLPACK (SELL-C-sigma)")};
 
 /* Fill type names for matrices */
 
@@ -211,6 +213,15 @@ _set_fill_info(cs_matrix_t      *matrix,
   matrix->fill_type = cs_matrix_get_fill_type(symmetric,
                                               diag_block_size,
                                               extra_diag_block_size);
+
+  /* No SELL-C-sigma kernel is available for full extradiagonal blocks */
+
+  if (   matrix->type == CS_MATRIX_SELL
+      && matrix->fill_type == CS_MATRIX_BLOCK)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Matrix format %s does not handle fill type %s."),
+              _(cs_matrix_type_fullname[matrix->type]),
+              cs_matrix_fill_type_name[matrix->fill_type]);
 }
 
 /*----------------------------------------------------------------------------
@@ -624,6 +635,149 @@ _6_6_zero_range(cs_real_t  y[restrict],
     y[ii] = 0.0;
 }
 
+/*----------------------------------------------------------------------------
+ * Synchronize ghost values prior to matrix.vector product
+ *
+ * parameters:
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   matrix        <-- pointer to matrix structure
+ *   x             <-> multipliying vector values (ghost values updated)
+ *----------------------------------------------------------------------------*/
+
+static void
+_pre_vector_multiply_sync_x(cs_halo_rotation_t   rotation_mode,
+                            const cs_matrix_t   *matrix,
+                            cs_real_t            x[restrict])
+{
+  assert(matrix->halo != NULL);
+
+  /* Non-blocked version */
+
+  if (matrix->db_size[3] == 1) {
+
+    if (matrix->halo != NULL)
+      cs_halo_sync_component(matrix->halo,
+                             CS_HALO_STANDARD,
+                             rotation_mode,
+                             x);
+
+  }
+
+  /* Blocked version */
+
+  else { /* if (matrix->db_size[3] > 1) */
+
+    const cs_lnum_t *db_size = matrix->db_size;
+
+    /* Update distant ghost rows */
+
+    if (matrix->halo != NULL) {
+
+      cs_halo_sync_var_strided(matrix->halo,
+                               CS_HALO_STANDARD,
+                               x,
+                               db_size[1]);
+
+      /* Synchronize periodic values */
+
+#if !defined(_CS_UNIT_MATRIX_TEST) /* unit tests do not link with full library */
+
+      if (matrix->halo->n_transforms > 0) {
+        if (db_size[0] == 3)
+          cs_halo_perio_sync_var_vect(matrix->halo,
+                                      CS_HALO_STANDARD,
+                                      x,
+                                      db_size[1]);
+        else if (db_size[0] == 6)
+          cs_halo_perio_sync_var_sym_tens(matrix->halo,
+                                          CS_HALO_STANDARD,
+                                          x);
+      }
+
+#endif
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Start synchronization of ghost values prior to matrix.vector product.
+ *
+ * The exchange is completed by _pre_vector_multiply_sync_x_end, so
+ * computations not involving ghost values may be done in between.
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *   x      <-> multipliying vector values (ghost values updated)
+ *
+ * returns:
+ *   pointer to halo state, or NULL if no synchronization is required
+ *----------------------------------------------------------------------------*/
+
+static cs_halo_state_t *
+_pre_vector_multiply_sync_x_start(const cs_matrix_t  *matrix,
+                                  cs_real_t           x[restrict])
+{
+  cs_halo_state_t *hs = NULL;
+
+  if (matrix->halo != NULL) {
+
+    hs = cs_halo_state_get_default();
+
+    cs_halo_sync_start(matrix->halo,
+                       CS_HALO_STANDARD,
+                       CS_REAL_TYPE,
+                       matrix->db_size[1],
+                       x,
+                       hs);
+
+  }
+
+  return hs;
+}
+
+/*----------------------------------------------------------------------------
+ * Complete synchronization of ghost values prior to matrix.vector product.
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *   hs     <-> pointer to halo state
+ *   x      <-> multipliying vector values (ghost values updated)
+ *----------------------------------------------------------------------------*/
+
+static void
+_pre_vector_multiply_sync_x_end(const cs_matrix_t  *matrix,
+                                cs_halo_state_t    *hs,
+                                cs_real_t           x[restrict])
+{
+  if (hs == NULL)
+    return;
+
+  assert(matrix->halo != NULL);
+
+  cs_halo_sync_wait(matrix->halo, x, hs);
+
+  /* Synchronize periodic values */
+
+#if !defined(_CS_UNIT_MATRIX_TEST) /* unit tests do not link with full library */
+
+  if (matrix->db_size[3] > 1 && matrix->halo->n_transforms > 0) {
+    const cs_lnum_t *db_size = matrix->db_size;
+    if (db_size[0] == 3)
+      cs_halo_perio_sync_var_vect(matrix->halo,
+                                  CS_HALO_STANDARD,
+                                  x,
+                                  db_size[1]);
+    else if (db_size[0] == 6)
+      cs_halo_perio_sync_var_sym_tens(matrix->halo,
+                                      CS_HALO_STANDARD,
+                                      x);
+  }
+
+#endif
+}
+
 /*----------------------------------------------------------------------------
  * Create native matrix structure.
  *
@@ -661,6 +815,28 @@ _create_struct_native(cs_lnum_t        n_rows,
 
   ms->edges = edges;
 
+  /* Determine edges adjacent to ghost columns */
+
+  ms->n_halo_edges = 0;
+  ms->halo_edge_id = NULL;
+
+  if (n_cols_ext > n_rows) {
+
+    cs_lnum_t n_halo_edges = 0;
+    for (cs_lnum_t e_id = 0; e_id < n_edges; e_id++) {
+      if (edges[e_id][0] >= n_rows || edges[e_id][1] >= n_rows)
+        n_halo_edges++;
+    }
+
+    BFT_MALLOC(ms->halo_edge_id, n_halo_edges, cs_lnum_t);
+
+    for (cs_lnum_t e_id = 0; e_id < n_edges; e_id++) {
+      if (edges[e_id][0] >= n_rows || edges[e_id][1] >= n_rows)
+        ms->halo_edge_id[ms->n_halo_edges++] = e_id;
+    }
+
+  }
+
   return ms;
 }
 
@@ -676,6 +852,8 @@ _destroy_struct_native(cs_matrix_struct_native_t  **matrix)
 {
   if (matrix != NULL && *matrix !=NULL) {
 
+    BFT_FREE((*matrix)->halo_edge_id);
+
     BFT_FREE(*matrix);
 
   }
@@ -709,6 +887,14 @@ _create_coeff_native(void)
   mc->_da = NULL;
   mc->_xa = NULL;
 
+  mc->conv_coeff = 0;
+  mc->diff_coeff = 0;
+  mc->i_massflux = NULL;
+  mc->i_visc = NULL;
+  mc->fill_type_mf = CS_MATRIX_N_FILL_TYPES;
+  mc->vector_multiply_d[0] = NULL;
+  mc->vector_multiply_d[1] = NULL;
+
   return mc;
 }
 
@@ -737,6 +923,97 @@ _destroy_coeff_native(cs_matrix_coeff_native_t **coeff)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Release face-based (matrix-free) definition of native matrix
+ * extra-diagonal coefficients, if present.
+ *
+ * Extra-diagonal coefficients built from that definition are freed, and
+ * the matrix.vector product functions replaced when defining it
+ * are restored.
+ *
+ * parameters:
+ *   matrix <-> pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_release_face_def_native(cs_matrix_t  *matrix)
+{
+  cs_matrix_coeff_native_t  *mc = matrix->coeffs;
+
+  if (mc == NULL || mc->i_visc == NULL)
+    return;
+
+  if (mc->xa != NULL && mc->xa == mc->_xa) {
+    BFT_FREE(mc->_xa);
+    mc->max_eb_size = 0;
+    mc->xa = NULL;
+  }
+
+  mc->conv_coeff = 0;
+  mc->diff_coeff = 0;
+  mc->i_massflux = NULL;
+  mc->i_visc = NULL;
+
+  for (int ed_flag = 0; ed_flag < 2; ed_flag++) {
+    matrix->vector_multiply[mc->fill_type_mf][ed_flag]
+      = mc->vector_multiply_d[ed_flag];
+    mc->vector_multiply_d[ed_flag] = NULL;
+  }
+  mc->fill_type_mf = CS_MATRIX_N_FILL_TYPES;
+}
+
+/*----------------------------------------------------------------------------
+ * Build native matrix extra-diagonal coefficients from their face-based
+ * (matrix-free) definition, if not already done.
+ *
+ * The built coefficients are kept until the matrix coefficients are
+ * released or redefined.
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *
+ * returns:
+ *   pointer to extra-diagonal coefficients, or NULL if the matrix
+ *   does not use a face-based definition
+ *----------------------------------------------------------------------------*/
+
+static const cs_real_t *
+_build_xa_face_def_native(const cs_matrix_t  *matrix)
+{
+  if (matrix->type != CS_MATRIX_NATIVE)
+    return NULL;
+
+  cs_matrix_coeff_native_t  *mc = matrix->coeffs;
+
+  if (mc == NULL || mc->i_visc == NULL)
+    return NULL;
+
+  if (mc->xa == NULL) {
+
+    const cs_matrix_struct_native_t  *ms = matrix->structure;
+
+    size_t xa_n_vals = ms->n_edges;
+    if (! mc->symmetric)
+      xa_n_vals *= 2;
+
+    BFT_REALLOC(mc->_xa, xa_n_vals, cs_real_t);
+    mc->max_eb_size = 1;
+
+    cs_matrix_extra_diagonal_from_faces(mc->symmetric,
+                                        ms->n_edges,
+                                        mc->conv_coeff,
+                                        mc->diff_coeff,
+                                        mc->i_massflux,
+                                        mc->i_visc,
+                                        mc->_xa);
+
+    mc->xa = mc->_xa;
+
+  }
+
+  return mc->xa;
+}
+
 /*----------------------------------------------------------------------------
  * Set Native matrix coefficients.
  *
@@ -765,6 +1042,8 @@ _set_coeffs_native(cs_matrix_t        *matrix,
   CS_UNUSED(n_edges);
   CS_UNUSED(edges);
 
+  _release_face_def_native(matrix);
+
   cs_matrix_coeff_native_t  *mc = matrix->coeffs;
   const cs_matrix_struct_native_t  *ms = matrix->structure;
   mc->symmetric = symmetric;
@@ -819,6 +1098,8 @@ _set_coeffs_native(cs_matrix_t        *matrix,
 static void
 _release_coeffs_native(cs_matrix_t  *matrix)
 {
+  _release_face_def_native(matrix);
+
   cs_matrix_coeff_native_t  *mc = matrix->coeffs;
   if (mc != NULL) {
     mc->da = NULL;
@@ -843,7 +1124,8 @@ _copy_diagonal_separate(const cs_matrix_t  *matrix,
     const cs_matrix_coeff_native_t  *mc = matrix->coeffs;
     _da = mc->da;
   }
-  else if (matrix->type == CS_MATRIX_MSR) {
+  else if (   matrix->type == CS_MATRIX_MSR
+           || matrix->type == CS_MATRIX_SELL) {
     const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
     _da = mc->d_val;
   }
@@ -887,20 +1169,144 @@ _copy_diagonal_separate(const cs_matrix_t  *matrix,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Add contributions of edges adjacent to ghost columns to a local
+ * matrix.vector product y = A.x with native matrix.
+ *
+ * This is called once ghost values are synchronized. It is not threaded,
+ * as edges adjacent to ghost columns are usually few, and may share rows.
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *   x      <-- multipliying vector values
+ *   y      <-> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_native_halo(const cs_matrix_t  *matrix,
+                         const cs_real_t     x[restrict],
+                         cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_native_t  *ms = matrix->structure;
+  const cs_matrix_coeff_native_t  *mc = matrix->coeffs;
+
+  const cs_real_t  *restrict xa = mc->xa;
+  const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+  const cs_lnum_t *restrict halo_edge_id = ms->halo_edge_id;
+
+  if (mc->symmetric) {
+    for (cs_lnum_t e_id = 0; e_id < ms->n_halo_edges; e_id++) {
+      cs_lnum_t face_id = halo_edge_id[e_id];
+      cs_lnum_t ii = face_cel_p[face_id][0];
+      cs_lnum_t jj = face_cel_p[face_id][1];
+      y[ii] += xa[face_id] * x[jj];
+      y[jj] += xa[face_id] * x[ii];
+    }
+  }
+  else {
+    for (cs_lnum_t e_id = 0; e_id < ms->n_halo_edges; e_id++) {
+      cs_lnum_t face_id = halo_edge_id[e_id];
+      cs_lnum_t ii = face_cel_p[face_id][0];
+      cs_lnum_t jj = face_cel_p[face_id][1];
+      y[ii] += xa[2*face_id] * x[jj];
+      y[jj] += xa[2*face_id + 1] * x[ii];
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Add contributions of edges adjacent to ghost columns to a local
+ * matrix.vector product y = A.x with native matrix, with diagonal blocks
+ * and scalar extra-diagonal terms.
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *   x      <-- multipliying vector values
+ *   y      <-> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_mat_vec_p_l_native_halo(const cs_matrix_t  *matrix,
+                           const cs_real_t     x[restrict],
+                           cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_native_t  *ms = matrix->structure;
+  const cs_matrix_coeff_native_t  *mc = matrix->coeffs;
+
+  const cs_real_t  *restrict xa = mc->xa;
+  const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+  const cs_lnum_t *restrict halo_edge_id = ms->halo_edge_id;
+
+  const cs_lnum_t n = matrix->db_size[0], s = matrix->db_size[1];
+
+  const cs_lnum_t xa_stride = (mc->symmetric) ? 1 : 2;
+  const cs_lnum_t xa_shift = (mc->symmetric) ? 0 : 1;
+
+  for (cs_lnum_t e_id = 0; e_id < ms->n_halo_edges; e_id++) {
+    cs_lnum_t face_id = halo_edge_id[e_id];
+    cs_lnum_t ii = face_cel_p[face_id][0];
+    cs_lnum_t jj = face_cel_p[face_id][1];
+    cs_real_t xa_ij = xa[xa_stride*face_id];
+    cs_real_t xa_ji = xa[xa_stride*face_id + xa_shift];
+    for (cs_lnum_t kk = 0; kk < n; kk++) {
+      y[ii*s + kk] += xa_ij * x[jj*s + kk];
+      y[jj*s + kk] += xa_ji * x[ii*s + kk];
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Add contributions of edges adjacent to ghost columns to a local
+ * matrix.vector product y = A.x with native matrix, with diagonal and
+ * extra-diagonal blocks.
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *   x      <-- multipliying vector values
+ *   y      <-> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_bb_mat_vec_p_l_native_halo(const cs_matrix_t  *matrix,
+                            const cs_real_t     x[restrict],
+                            cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_native_t  *ms = matrix->structure;
+  const cs_matrix_coeff_native_t  *mc = matrix->coeffs;
+
+  const cs_real_t  *restrict xa = mc->xa;
+  const cs_lnum_t *eb_size = matrix->eb_size;
+  const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+  const cs_lnum_t *restrict halo_edge_id = ms->halo_edge_id;
+
+  const cs_lnum_t xa_stride = (mc->symmetric) ? 1 : 2;
+  const cs_lnum_t xa_shift = (mc->symmetric) ? 0 : 1;
+
+  for (cs_lnum_t e_id = 0; e_id < ms->n_halo_edges; e_id++) {
+    cs_lnum_t face_id = halo_edge_id[e_id];
+    cs_lnum_t ii = face_cel_p[face_id][0];
+    cs_lnum_t jj = face_cel_p[face_id][1];
+    _dense_eb_ax_add(ii, jj, xa_stride*face_id, eb_size, xa, x, y);
+    _dense_eb_ax_add(jj, ii, xa_stride*face_id + xa_shift, eb_size, xa, x, y);
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Local matrix.vector product y = A.x with native matrix.
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
  *   matrix       <-- pointer to matrix structure
- *   x            <-- multipliying vector values
+ *   x            <-> multipliying vector values
  *   y            --> resulting vector
  *----------------------------------------------------------------------------*/
 
 static void
 _mat_vec_p_l_native(bool                exclude_diag,
+                    bool                sync,
                     const cs_matrix_t  *matrix,
-                    const cs_real_t     x[restrict],
+                    cs_real_t           x[restrict],
                     cs_real_t           y[restrict])
 {
   cs_lnum_t  ii, jj, face_id;
@@ -910,6 +1316,11 @@ _mat_vec_p_l_native(bool                exclude_diag,
 
   const cs_real_t  *restrict xa = mc->xa;
 
+  /* Initialize ghost values exchange */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+
   /* Diagonal part of matrix.vector product */
 
   if (! exclude_diag) {
@@ -919,21 +1330,26 @@ _mat_vec_p_l_native(bool                exclude_diag,
   else
     _zero_range(y, 0, ms->n_cols_ext);
 
-  /* Note: parallel and periodic synchronization could be delayed to here */
-
   /* non-diagonal terms */
 
   if (mc->xa != NULL) {
 
     const cs_lnum_2_t *restrict face_cel_p = ms->edges;
 
+    /* If ghost values are being exchanged, handle only edges adjacent
+       to local columns here; others are handled once exchange is done */
+
+    const cs_lnum_t n_l_cols = (hs != NULL) ? ms->n_rows : ms->n_cols_ext;
+
     if (mc->symmetric) {
 
       for (face_id = 0; face_id < ms->n_edges; face_id++) {
         ii = face_cel_p[face_id][0];
         jj = face_cel_p[face_id][1];
-        y[ii] += xa[face_id] * x[jj];
-        y[jj] += xa[face_id] * x[ii];
+        if (ii < n_l_cols && jj < n_l_cols) {
+          y[ii] += xa[face_id] * x[jj];
+          y[jj] += xa[face_id] * x[ii];
+        }
       }
 
     }
@@ -942,13 +1358,24 @@ _mat_vec_p_l_native(bool                exclude_diag,
       for (face_id = 0; face_id < ms->n_edges; face_id++) {
         ii = face_cel_p[face_id][0];
         jj = face_cel_p[face_id][1];
-        y[ii] += xa[2*face_id] * x[jj];
-        y[jj] += xa[2*face_id + 1] * x[ii];
+        if (ii < n_l_cols && jj < n_l_cols) {
+          y[ii] += xa[2*face_id] * x[jj];
+          y[jj] += xa[2*face_id + 1] * x[ii];
+        }
       }
 
     }
 
   }
+
+  /* Complete ghost values exchange, then handle edges adjacent
+     to ghost columns */
+
+  if (hs != NULL) {
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+    if (mc->xa != NULL)
+      _mat_vec_p_l_native_halo(matrix, x, y);
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -956,15 +1383,17 @@ _mat_vec_p_l_native(bool                exclude_diag,
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
  *   matrix       <-- pointer to matrix structure
- *   x            <-- multipliying vector values
+ *   x            <-> multipliying vector values
  *   y            --> resulting vector
  *----------------------------------------------------------------------------*/
 
 static void
 _b_mat_vec_p_l_native(bool                exclude_diag,
+                      bool                sync,
                       const cs_matrix_t  *matrix,
-                      const cs_real_t    x[restrict],
+                      cs_real_t          x[restrict],
                       cs_real_t          y[restrict])
 {
   cs_lnum_t  ii, jj, kk, face_id;
@@ -975,6 +1404,11 @@ _b_mat_vec_p_l_native(bool                exclude_diag,
   const cs_real_t  *restrict xa = mc->xa;
   const cs_lnum_t *db_size = matrix->db_size;
 
+  /* Initialize ghost values exchange */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+
   /* Diagonal part of matrix.vector product */
 
   if (! exclude_diag) {
@@ -984,22 +1418,27 @@ _b_mat_vec_p_l_native(bool                exclude_diag,
   else
     _b_zero_range(y, 0, ms->n_cols_ext, db_size);
 
-  /* Note: parallel and periodic synchronization could be delayed to here */
-
   /* non-diagonal terms */
 
   if (mc->xa != NULL) {
 
     const cs_lnum_2_t *restrict face_cel_p = ms->edges;
 
+    /* If ghost values are being exchanged, handle only edges adjacent
+       to local columns here; others are handled once exchange is done */
+
+    const cs_lnum_t n_l_cols = (hs != NULL) ? ms->n_rows : ms->n_cols_ext;
+
     if (mc->symmetric) {
 
       for (face_id = 0; face_id < ms->n_edges; face_id++) {
         ii = face_cel_p[face_id][0];
         jj = face_cel_p[face_id][1];
-        for (kk = 0; kk < db_size[0]; kk++) {
-          y[ii*db_size[1] + kk] += xa[face_id] * x[jj*db_size[1] + kk];
-          y[jj*db_size[1] + kk] += xa[face_id] * x[ii*db_size[1] + kk];
+        if (ii < n_l_cols && jj < n_l_cols) {
+          for (kk = 0; kk < db_size[0]; kk++) {
+            y[ii*db_size[1] + kk] += xa[face_id] * x[jj*db_size[1] + kk];
+            y[jj*db_size[1] + kk] += xa[face_id] * x[ii*db_size[1] + kk];
+          }
         }
       }
     }
@@ -1008,9 +1447,11 @@ _b_mat_vec_p_l_native(bool                exclude_diag,
       for (face_id = 0; face_id < ms->n_edges; face_id++) {
         ii = face_cel_p[face_id][0];
         jj = face_cel_p[face_id][1];
-        for (kk = 0; kk < db_size[0]; kk++) {
-          y[ii*db_size[1] + kk] += xa[2*face_id]     * x[jj*db_size[1] + kk];
-          y[jj*db_size[1] + kk] += xa[2*face_id + 1] * x[ii*db_size[1] + kk];
+        if (ii < n_l_cols && jj < n_l_cols) {
+          for (kk = 0; kk < db_size[0]; kk++) {
+            y[ii*db_size[1] + kk] += xa[2*face_id]     * x[jj*db_size[1] + kk];
+            y[jj*db_size[1] + kk] += xa[2*face_id + 1] * x[ii*db_size[1] + kk];
+          }
         }
       }
 
@@ -1018,22 +1459,32 @@ _b_mat_vec_p_l_native(bool                exclude_diag,
 
   }
 
-}
+  /* Complete ghost values exchange, then handle edges adjacent
+     to ghost columns */
+
+  if (hs != NULL) {
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+    if (mc->xa != NULL)
+      _b_mat_vec_p_l_native_halo(matrix, x, y);
+  }
+}
 
 /*----------------------------------------------------------------------------
  * Local matrix.vector product y = A.x with native matrix.
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
  *   matrix       <-- pointer to matrix structure
- *   x            <-- multipliying vector values
+ *   x            <-> multipliying vector values
  *   y            --> resulting vector
  *----------------------------------------------------------------------------*/
 
 static void
 _bb_mat_vec_p_l_native(bool                exclude_diag,
+                       bool                sync,
                        const cs_matrix_t  *matrix,
-                       const cs_real_t    x[restrict],
+                       cs_real_t          x[restrict],
                        cs_real_t          y[restrict])
 {
   cs_lnum_t  ii, jj, face_id;
@@ -1045,6 +1496,11 @@ _bb_mat_vec_p_l_native(bool                exclude_diag,
   const cs_lnum_t *db_size = matrix->db_size;
   const cs_lnum_t *eb_size = matrix->eb_size;
 
+  /* Initialize ghost values exchange */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+
   /* Diagonal part of matrix.vector product */
 
   if (! exclude_diag) {
@@ -1054,21 +1510,26 @@ _bb_mat_vec_p_l_native(bool                exclude_diag,
   else
     _b_zero_range(y, 0, ms->n_cols_ext, db_size);
 
-  /* Note: parallel and periodic synchronization could be delayed to here */
-
   /* non-diagonal terms */
 
   if (mc->xa != NULL) {
 
     const cs_lnum_2_t *restrict face_cel_p = ms->edges;
 
+    /* If ghost values are being exchanged, handle only edges adjacent
+       to local columns here; others are handled once exchange is done */
+
+    const cs_lnum_t n_l_cols = (hs != NULL) ? ms->n_rows : ms->n_cols_ext;
+
     if (mc->symmetric) {
 
       for (face_id = 0; face_id < ms->n_edges; face_id++) {
         ii = face_cel_p[face_id][0];
         jj = face_cel_p[face_id][1];
-        _dense_eb_ax_add(ii, jj, face_id, eb_size, xa, x, y);
-        _dense_eb_ax_add(jj, ii, face_id, eb_size, xa, x, y);
+        if (ii < n_l_cols && jj < n_l_cols) {
+          _dense_eb_ax_add(ii, jj, face_id, eb_size, xa, x, y);
+          _dense_eb_ax_add(jj, ii, face_id, eb_size, xa, x, y);
+        }
       }
     }
     else {
@@ -1076,14 +1537,24 @@ _bb_mat_vec_p_l_native(bool                exclude_diag,
       for (face_id = 0; face_id < ms->n_edges; face_id++) {
         ii = face_cel_p[face_id][0];
         jj = face_cel_p[face_id][1];
-        _dense_eb_ax_add(ii, jj, 2*face_id, eb_size, xa, x, y);
-        _dense_eb_ax_add(jj, ii, 2*face_id + 1, eb_size, xa, x, y);
+        if (ii < n_l_cols && jj < n_l_cols) {
+          _dense_eb_ax_add(ii, jj, 2*face_id, eb_size, xa, x, y);
+          _dense_eb_ax_add(jj, ii, 2*face_id + 1, eb_size, xa, x, y);
+        }
       }
 
     }
 
   }
 
+  /* Complete ghost values exchange, then handle edges adjacent
+     to ghost columns */
+
+  if (hs != NULL) {
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+    if (mc->xa != NULL)
+      _bb_mat_vec_p_l_native_halo(matrix, x, y);
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -1093,15 +1564,17 @@ _bb_mat_vec_p_l_native(bool                exclude_diag,
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
  *   matrix       <-- pointer to matrix structure
- *   x            <-- multipliying vector values
+ *   x            <-> multipliying vector values
  *   y            --> resulting vector
  *----------------------------------------------------------------------------*/
 
 static void
 _3_3_mat_vec_p_l_native(bool                exclude_diag,
+                        bool                sync,
                         const cs_matrix_t  *matrix,
-                        const cs_real_t     x[restrict],
+                        cs_real_t           x[restrict],
                         cs_real_t           y[restrict])
 {
   cs_lnum_t  ii, jj, kk, face_id;
@@ -1113,6 +1586,11 @@ _3_3_mat_vec_p_l_native(bool                exclude_diag,
 
   assert(matrix->db_size[0] == 3 && matrix->db_size[3] == 9);
 
+  /* Initialize ghost values exchange */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+
   /* Diagonal part of matrix.vector product */
 
   if (! exclude_diag) {
@@ -1122,22 +1600,27 @@ _3_3_mat_vec_p_l_native(bool                exclude_diag,
   else
     _3_3_zero_range(y, 0, ms->n_cols_ext);
 
-  /* Note: parallel and periodic synchronization could be delayed to here */
-
   /* non-diagonal terms */
 
   if (mc->xa != NULL) {
 
     const cs_lnum_2_t *restrict face_cel_p = ms->edges;
 
+    /* If ghost values are being exchanged, handle only edges adjacent
+       to local columns here; others are handled once exchange is done */
+
+    const cs_lnum_t n_l_cols = (hs != NULL) ? ms->n_rows : ms->n_cols_ext;
+
     if (mc->symmetric) {
 
       for (face_id = 0; face_id < ms->n_edges; face_id++) {
         ii = face_cel_p[face_id][0];
         jj = face_cel_p[face_id][1];
-        for (kk = 0; kk < 3; kk++) {
-          y[ii*3 + kk] += xa[face_id] * x[jj*3 + kk];
-          y[jj*3 + kk] += xa[face_id] * x[ii*3 + kk];
+        if (ii < n_l_cols && jj < n_l_cols) {
+          for (kk = 0; kk < 3; kk++) {
+            y[ii*3 + kk] += xa[face_id] * x[jj*3 + kk];
+            y[jj*3 + kk] += xa[face_id] * x[ii*3 + kk];
+          }
         }
       }
     }
@@ -1146,9 +1629,11 @@ _3_3_mat_vec_p_l_native(bool                exclude_diag,
       for (face_id = 0; face_id < ms->n_edges; face_id++) {
         ii = face_cel_p[face_id][0];
         jj = face_cel_p[face_id][1];
-        for (kk = 0; kk < 3; kk++) {
-          y[ii*3 + kk] += xa[2*face_id]     * x[jj*3 + kk];
-          y[jj*3 + kk] += xa[2*face_id + 1] * x[ii*3 + kk];
+        if (ii < n_l_cols && jj < n_l_cols) {
+          for (kk = 0; kk < 3; kk++) {
+            y[ii*3 + kk] += xa[2*face_id]     * x[jj*3 + kk];
+            y[jj*3 + kk] += xa[2*face_id + 1] * x[ii*3 + kk];
+          }
         }
       }
 
@@ -1156,6 +1641,14 @@ _3_3_mat_vec_p_l_native(bool                exclude_diag,
 
   }
 
+  /* Complete ghost values exchange, then handle edges adjacent
+     to ghost columns */
+
+  if (hs != NULL) {
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+    if (mc->xa != NULL)
+      _b_mat_vec_p_l_native_halo(matrix, x, y);
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -1165,15 +1658,17 @@ _3_3_mat_vec_p_l_native(bool                exclude_diag,
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
  *   matrix       <-- pointer to matrix structure
- *   x            <-- multipliying vector values
+ *   x            <-> multipliying vector values
  *   y            --> resulting vector
  *----------------------------------------------------------------------------*/
 
 static void
 _6_6_mat_vec_p_l_native(bool                exclude_diag,
+                        bool                sync,
                         const cs_matrix_t  *matrix,
-                        const cs_real_t     x[restrict],
+                        cs_real_t           x[restrict],
                         cs_real_t           y[restrict])
 {
   cs_lnum_t  ii, jj, kk, face_id;
@@ -1185,6 +1680,11 @@ _6_6_mat_vec_p_l_native(bool                exclude_diag,
 
   assert(matrix->db_size[0] == 6 && matrix->db_size[3] == 36);
 
+  /* Initialize ghost values exchange */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+
   /* Diagonal part of matrix.vector product */
 
   if (! exclude_diag) {
@@ -1194,22 +1694,27 @@ _6_6_mat_vec_p_l_native(bool                exclude_diag,
   else
     _6_6_zero_range(y, 0, ms->n_cols_ext);
 
-  /* Note: parallel and periodic synchronization could be delayed to here */
-
   /* non-diagonal terms */
 
   if (mc->xa != NULL) {
 
     const cs_lnum_2_t *restrict face_cel_p = ms->edges;
 
+    /* If ghost values are being exchanged, handle only edges adjacent
+       to local columns here; others are handled once exchange is done */
+
+    const cs_lnum_t n_l_cols = (hs != NULL) ? ms->n_rows : ms->n_cols_ext;
+
     if (mc->symmetric) {
 
       for (face_id = 0; face_id < ms->n_edges; face_id++) {
         ii = face_cel_p[face_id][0];
         jj = face_cel_p[face_id][1];
-        for (kk = 0; kk < 6; kk++) {
-          y[ii*6 + kk] += xa[face_id] * x[jj*6 + kk];
-          y[jj*6 + kk] += xa[face_id] * x[ii*6 + kk];
+        if (ii < n_l_cols && jj < n_l_cols) {
+          for (kk = 0; kk < 6; kk++) {
+            y[ii*6 + kk] += xa[face_id] * x[jj*6 + kk];
+            y[jj*6 + kk] += xa[face_id] * x[ii*6 + kk];
+          }
         }
       }
     }
@@ -1218,9 +1723,11 @@ _6_6_mat_vec_p_l_native(bool                exclude_diag,
       for (face_id = 0; face_id < ms->n_edges; face_id++) {
         ii = face_cel_p[face_id][0];
         jj = face_cel_p[face_id][1];
-        for (kk = 0; kk < 6; kk++) {
-          y[ii*6 + kk] += xa[2*face_id]     * x[jj*6 + kk];
-          y[jj*6 + kk] += xa[2*face_id + 1] * x[ii*6 + kk];
+        if (ii < n_l_cols && jj < n_l_cols) {
+          for (kk = 0; kk < 6; kk++) {
+            y[ii*6 + kk] += xa[2*face_id]     * x[jj*6 + kk];
+            y[jj*6 + kk] += xa[2*face_id + 1] * x[ii*6 + kk];
+          }
         }
       }
 
@@ -1228,6 +1735,14 @@ _6_6_mat_vec_p_l_native(bool                exclude_diag,
 
   }
 
+  /* Complete ghost values exchange, then handle edges adjacent
+     to ghost columns */
+
+  if (hs != NULL) {
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+    if (mc->xa != NULL)
+      _b_mat_vec_p_l_native_halo(matrix, x, y);
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -1237,25 +1752,27 @@ _6_6_mat_vec_p_l_native(bool                exclude_diag,
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
  *   matrix       <-- pointer to matrix structure
- *   x            <-- multipliying vector values
+ *   x            <-> multipliying vector values
  *   y            --> resulting vector
  *----------------------------------------------------------------------------*/
 
 static void
 _b_mat_vec_p_l_native_fixed(bool                exclude_diag,
+                            bool                sync,
                             const cs_matrix_t  *matrix,
-                            const cs_real_t     x[restrict],
+                            cs_real_t           x[restrict],
                             cs_real_t           y[restrict])
 {
   if (matrix->db_size[0] == 3 && matrix->db_size[3] == 9)
-    _3_3_mat_vec_p_l_native(exclude_diag, matrix, x, y);
+    _3_3_mat_vec_p_l_native(exclude_diag, sync, matrix, x, y);
 
   else if (matrix->db_size[0] == 6 && matrix->db_size[3] == 36)
-    _6_6_mat_vec_p_l_native(exclude_diag, matrix, x, y);
+    _6_6_mat_vec_p_l_native(exclude_diag, sync, matrix, x, y);
 
   else
-    _b_mat_vec_p_l_native(exclude_diag, matrix, x, y);
+    _b_mat_vec_p_l_native(exclude_diag, sync, matrix, x, y);
 }
 
 #if defined(HAVE_OPENMP) /* OpenMP variants */
@@ -1265,15 +1782,17 @@ _b_mat_vec_p_l_native_fixed(bool                exclude_diag,
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
  *   matrix       <-- Pointer to matrix structure
- *   x            <-- Multipliying vector values
+ *   x            <-> Multipliying vector values
  *   y            --> Resulting vector
  *----------------------------------------------------------------------------*/
 
 static void
 _mat_vec_p_l_native_omp(bool                exclude_diag,
+                        bool                sync,
                         const cs_matrix_t  *matrix,
-                        const cs_real_t     x[restrict],
+                        cs_real_t           x[restrict],
                         cs_real_t           y[restrict])
 {
   const int n_threads = matrix->numbering->n_threads;
@@ -1286,6 +1805,11 @@ _mat_vec_p_l_native_omp(bool                exclude_diag,
 
   assert(matrix->numbering->type == CS_NUMBERING_THREADS);
 
+  /* Initialize ghost values exchange */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+
   /* Diagonal part of matrix.vector product */
 
   if (! exclude_diag) {
@@ -1295,14 +1819,17 @@ _mat_vec_p_l_native_omp(bool                exclude_diag,
   else
     _zero_range(y, 0, ms->n_cols_ext);
 
-  /* Note: parallel and periodic synchronization could be delayed to here */
-
   /* non-diagonal terms */
 
   if (mc->xa != NULL) {
 
     const cs_lnum_2_t *restrict face_cel_p = ms->edges;
 
+    /* If ghost values are being exchanged, handle only edges adjacent
+       to local columns here; others are handled once exchange is done */
+
+    const cs_lnum_t n_l_cols = (hs != NULL) ? ms->n_rows : ms->n_cols_ext;
+
     if (mc->symmetric) {
 
       for (int g_id = 0; g_id < n_groups; g_id++) {
@@ -1315,8 +1842,10 @@ _mat_vec_p_l_native_omp(bool                exclude_diag,
                face_id++) {
             cs_lnum_t ii = face_cel_p[face_id][0];
             cs_lnum_t jj = face_cel_p[face_id][1];
-            y[ii] += xa[face_id] * x[jj];
-            y[jj] += xa[face_id] * x[ii];
+            if (ii < n_l_cols && jj < n_l_cols) {
+              y[ii] += xa[face_id] * x[jj];
+              y[jj] += xa[face_id] * x[ii];
+            }
           }
         }
       }
@@ -1333,14 +1862,25 @@ _mat_vec_p_l_native_omp(bool                exclude_diag,
                face_id++) {
             cs_lnum_t ii = face_cel_p[face_id][0];
             cs_lnum_t jj = face_cel_p[face_id][1];
-            y[ii] += xa[2*face_id] * x[jj];
-            y[jj] += xa[2*face_id + 1] * x[ii];
+            if (ii < n_l_cols && jj < n_l_cols) {
+              y[ii] += xa[2*face_id] * x[jj];
+              y[jj] += xa[2*face_id + 1] * x[ii];
+            }
           }
         }
       }
     }
 
   }
+
+  /* Complete ghost values exchange, then handle edges adjacent
+     to ghost columns */
+
+  if (hs != NULL) {
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+    if (mc->xa != NULL)
+      _mat_vec_p_l_native_halo(matrix, x, y);
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -1348,15 +1888,17 @@ _mat_vec_p_l_native_omp(bool                exclude_diag,
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
  *   matrix       <-- Pointer to matrix structure
- *   x            <-- Multipliying vector values
+ *   x            <-> Multipliying vector values
  *   y            --> Resulting vector
  *----------------------------------------------------------------------------*/
 
 static void
 _b_mat_vec_p_l_native_omp(bool                exclude_diag,
+                          bool                sync,
                           const cs_matrix_t  *matrix,
-                          const cs_real_t     x[restrict],
+                          cs_real_t           x[restrict],
                           cs_real_t           y[restrict])
 {
   const cs_lnum_t *db_size = matrix->db_size;
@@ -1371,6 +1913,11 @@ _b_mat_vec_p_l_native_omp(bool                exclude_diag,
 
   assert(matrix->numbering->type == CS_NUMBERING_THREADS);
 
+  /* Initialize ghost values exchange */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+
   /* Diagonal part of matrix.vector product */
 
   if (! exclude_diag) {
@@ -1380,14 +1927,17 @@ _b_mat_vec_p_l_native_omp(bool                exclude_diag,
   else
     _b_zero_range(y, 0, ms->n_cols_ext, db_size);
 
-  /* Note: parallel and periodic synchronization could be delayed to here */
-
   /* non-diagonal terms */
 
   if (mc->xa != NULL) {
 
     const cs_lnum_2_t *restrict face_cel_p = ms->edges;
 
+    /* If ghost values are being exchanged, handle only edges adjacent
+       to local columns here; others are handled once exchange is done */
+
+    const cs_lnum_t n_l_cols = (hs != NULL) ? ms->n_rows : ms->n_cols_ext;
+
     if (mc->symmetric) {
 
       for (int g_id = 0; g_id < n_groups; g_id++) {
@@ -1400,9 +1950,11 @@ _b_mat_vec_p_l_native_omp(bool                exclude_diag,
                face_id++) {
             cs_lnum_t ii = face_cel_p[face_id][0];
             cs_lnum_t jj = face_cel_p[face_id][1];
-            for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
-              y[ii*db_size[1] + kk] += xa[face_id] * x[jj*db_size[1] + kk];
-              y[jj*db_size[1] + kk] += xa[face_id] * x[ii*db_size[1] + kk];
+            if (ii < n_l_cols && jj < n_l_cols) {
+              for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+                y[ii*db_size[1] + kk] += xa[face_id] * x[jj*db_size[1] + kk];
+                y[jj*db_size[1] + kk] += xa[face_id] * x[ii*db_size[1] + kk];
+              }
             }
           }
         }
@@ -1421,9 +1973,13 @@ _b_mat_vec_p_l_native_omp(bool                exclude_diag,
                face_id++) {
             cs_lnum_t ii = face_cel_p[face_id][0];
             cs_lnum_t jj = face_cel_p[face_id][1];
-            for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
-              y[ii*db_size[1] + kk] += xa[2*face_id]     * x[jj*db_size[1] + kk];
-              y[jj*db_size[1] + kk] += xa[2*face_id + 1] * x[ii*db_size[1] + kk];
+            if (ii < n_l_cols && jj < n_l_cols) {
+              for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+                y[ii*db_size[1] + kk]
+                  += xa[2*face_id]     * x[jj*db_size[1] + kk];
+                y[jj*db_size[1] + kk]
+                  += xa[2*face_id + 1] * x[ii*db_size[1] + kk];
+              }
             }
           }
         }
@@ -1432,6 +1988,15 @@ _b_mat_vec_p_l_native_omp(bool                exclude_diag,
     }
 
   }
+
+  /* Complete ghost values exchange, then handle edges adjacent
+     to ghost columns */
+
+  if (hs != NULL) {
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+    if (mc->xa != NULL)
+      _b_mat_vec_p_l_native_halo(matrix, x, y);
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -1439,21 +2004,28 @@ _b_mat_vec_p_l_native_omp(bool                exclude_diag,
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
  *   matrix       <-- Pointer to matrix structure
- *   x            <-- Multipliying vector values
+ *   x            <-> Multipliying vector values
  *   y            --> Resulting vector
  *----------------------------------------------------------------------------*/
 
 static void
 _mat_vec_p_l_native_omp_atomic(bool                exclude_diag,
+                               bool                sync,
                                const cs_matrix_t  *matrix,
-                               const cs_real_t     x[restrict],
+                               cs_real_t           x[restrict],
                                cs_real_t           y[restrict])
 {
   const cs_matrix_struct_native_t  *ms = matrix->structure;
   const cs_matrix_coeff_native_t  *mc = matrix->coeffs;
   const cs_real_t  *restrict xa = mc->xa;
 
+  /* Initialize ghost values exchange */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+
   /* Diagonal part of matrix.vector product */
 
   if (! exclude_diag) {
@@ -1463,24 +2035,29 @@ _mat_vec_p_l_native_omp_atomic(bool                exclude_diag,
   else
     _zero_range(y, 0, ms->n_cols_ext);
 
-  /* Note: parallel and periodic synchronization could be delayed to here */
-
   /* non-diagonal terms */
 
   if (mc->xa != NULL) {
 
     const cs_lnum_2_t *restrict face_cel_p = ms->edges;
 
+    /* If ghost values are being exchanged, handle only edges adjacent
+       to local columns here; others are handled once exchange is done */
+
+    const cs_lnum_t n_l_cols = (hs != NULL) ? ms->n_rows : ms->n_cols_ext;
+
     if (mc->symmetric) {
 
 #     pragma omp parallel for
       for (cs_lnum_t face_id = 0; face_id < ms->n_edges; face_id++) {
         cs_lnum_t ii = face_cel_p[face_id][0];
         cs_lnum_t jj = face_cel_p[face_id][1];
-#       pragma omp atomic
-        y[ii] += xa[face_id] * x[jj];
-#       pragma omp atomic
-        y[jj] += xa[face_id] * x[ii];
+        if (ii < n_l_cols && jj < n_l_cols) {
+  #       pragma omp atomic
+          y[ii] += xa[face_id] * x[jj];
+  #       pragma omp atomic
+          y[jj] += xa[face_id] * x[ii];
+        }
       }
     }
     else {
@@ -1489,14 +2066,25 @@ _mat_vec_p_l_native_omp_atomic(bool                exclude_diag,
       for (cs_lnum_t face_id = 0; face_id < ms->n_edges; face_id++) {
         cs_lnum_t ii = face_cel_p[face_id][0];
         cs_lnum_t jj = face_cel_p[face_id][1];
-#       pragma omp atomic
-        y[ii] += xa[2*face_id] * x[jj];
-#       pragma omp atomic
-        y[jj] += xa[2*face_id + 1] * x[ii];
+        if (ii < n_l_cols && jj < n_l_cols) {
+  #       pragma omp atomic
+          y[ii] += xa[2*face_id] * x[jj];
+  #       pragma omp atomic
+          y[jj] += xa[2*face_id + 1] * x[ii];
+        }
       }
     }
 
   }
+
+  /* Complete ghost values exchange, then handle edges adjacent
+     to ghost columns */
+
+  if (hs != NULL) {
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+    if (mc->xa != NULL)
+      _mat_vec_p_l_native_halo(matrix, x, y);
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -1504,15 +2092,17 @@ _mat_vec_p_l_native_omp_atomic(bool                exclude_diag,
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
  *   matrix       <-- Pointer to matrix structure
- *   x            <-- Multipliying vector values
+ *   x            <-> Multipliying vector values
  *   y            --> Resulting vector
  *----------------------------------------------------------------------------*/
 
 static void
 _b_mat_vec_p_l_native_omp_atomic(bool                exclude_diag,
+                                 bool                sync,
                                  const cs_matrix_t  *matrix,
-                                 const cs_real_t     x[restrict],
+                                 cs_real_t           x[restrict],
                                  cs_real_t           y[restrict])
 {
   const cs_lnum_t *db_size = matrix->db_size;
@@ -1521,6 +2111,11 @@ _b_mat_vec_p_l_native_omp_atomic(bool                exclude_diag,
   const cs_matrix_coeff_native_t  *mc = matrix->coeffs;
   const cs_real_t  *restrict xa = mc->xa;
 
+  /* Initialize ghost values exchange */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+
   /* Diagonal part of matrix.vector product */
 
   if (! exclude_diag) {
@@ -1530,25 +2125,30 @@ _b_mat_vec_p_l_native_omp_atomic(bool                exclude_diag,
   else
     _b_zero_range(y, 0, ms->n_cols_ext, db_size);
 
-  /* Note: parallel and periodic synchronization could be delayed to here */
-
   /* non-diagonal terms */
 
   if (mc->xa != NULL) {
 
     const cs_lnum_2_t *restrict face_cel_p = ms->edges;
 
+    /* If ghost values are being exchanged, handle only edges adjacent
+       to local columns here; others are handled once exchange is done */
+
+    const cs_lnum_t n_l_cols = (hs != NULL) ? ms->n_rows : ms->n_cols_ext;
+
     if (mc->symmetric) {
 
 #     pragma omp parallel for
       for (cs_lnum_t face_id = 0; face_id < ms->n_edges; face_id++) {
         cs_lnum_t ii = face_cel_p[face_id][0];
         cs_lnum_t jj = face_cel_p[face_id][1];
-        for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
-#         pragma omp atomic
-          y[ii*db_size[1] + kk] += xa[face_id] * x[jj*db_size[1] + kk];
-#         pragma omp atomic
-          y[jj*db_size[1] + kk] += xa[face_id] * x[ii*db_size[1] + kk];
+        if (ii < n_l_cols && jj < n_l_cols) {
+          for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+  #         pragma omp atomic
+            y[ii*db_size[1] + kk] += xa[face_id] * x[jj*db_size[1] + kk];
+  #         pragma omp atomic
+            y[jj*db_size[1] + kk] += xa[face_id] * x[ii*db_size[1] + kk];
+          }
         }
       }
 
@@ -1559,17 +2159,28 @@ _b_mat_vec_p_l_native_omp_atomic(bool                exclude_diag,
       for (cs_lnum_t face_id = 0; face_id < ms->n_edges; face_id++) {
         cs_lnum_t ii = face_cel_p[face_id][0];
         cs_lnum_t jj = face_cel_p[face_id][1];
-        for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
-#         pragma omp atomic
-          y[ii*db_size[1] + kk] += xa[2*face_id]   * x[jj*db_size[1] + kk];
-#         pragma omp atomic
-          y[jj*db_size[1] + kk] += xa[2*face_id+1] * x[ii*db_size[1] + kk];
+        if (ii < n_l_cols && jj < n_l_cols) {
+          for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+  #         pragma omp atomic
+            y[ii*db_size[1] + kk] += xa[2*face_id]   * x[jj*db_size[1] + kk];
+  #         pragma omp atomic
+            y[jj*db_size[1] + kk] += xa[2*face_id+1] * x[ii*db_size[1] + kk];
+          }
         }
       }
 
     }
 
   }
+
+  /* Complete ghost values exchange, then handle edges adjacent
+     to ghost columns */
+
+  if (hs != NULL) {
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+    if (mc->xa != NULL)
+      _b_mat_vec_p_l_native_halo(matrix, x, y);
+  }
 }
 
 #endif /* defined(HAVE_OPENMP) */
@@ -1579,15 +2190,17 @@ _b_mat_vec_p_l_native_omp_atomic(bool                exclude_diag,
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
  *   matrix       <-- pointer to matrix structure
- *   x            <-- multipliying vector values
+ *   x            <-> multipliying vector values
  *   y            --> resulting vector
  *----------------------------------------------------------------------------*/
 
 static void
 _mat_vec_p_l_native_vector(bool                exclude_diag,
+                           bool                sync,
                            const cs_matrix_t  *matrix,
-                           const cs_real_t     x[restrict],
+                           cs_real_t           x[restrict],
                            cs_real_t           y[restrict])
 {
   cs_lnum_t  ii, jj, face_id;
@@ -1597,6 +2210,11 @@ _mat_vec_p_l_native_vector(bool                exclude_diag,
 
   assert(matrix->numbering->type == CS_NUMBERING_VECTORIZE);
 
+  /* Initialize ghost values exchange */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+
   /* Diagonal part of matrix.vector product */
 
   if (! exclude_diag) {
@@ -1606,14 +2224,17 @@ _mat_vec_p_l_native_vector(bool                exclude_diag,
   else
     _zero_range(y, 0, ms->n_cols_ext);
 
-  /* Note: parallel and periodic synchronization could be delayed to here */
-
   /* non-diagonal terms */
 
   if (mc->xa != NULL) {
 
     const cs_lnum_2_t *restrict face_cel_p = ms->edges;
 
+    /* If ghost values are being exchanged, handle only edges adjacent
+       to local columns here; others are handled once exchange is done */
+
+    const cs_lnum_t n_l_cols = (hs != NULL) ? ms->n_rows : ms->n_cols_ext;
+
     if (mc->symmetric) {
 
 #     if defined(HAVE_OPENMP_SIMD)
@@ -1626,8 +2247,10 @@ _mat_vec_p_l_native_vector(bool                exclude_diag,
       for (face_id = 0; face_id < ms->n_edges; face_id++) {
         ii = face_cel_p[face_id][0];
         jj = face_cel_p[face_id][1];
-        y[ii] += xa[face_id] * x[jj];
-        y[jj] += xa[face_id] * x[ii];
+        if (ii < n_l_cols && jj < n_l_cols) {
+          y[ii] += xa[face_id] * x[jj];
+          y[jj] += xa[face_id] * x[ii];
+        }
       }
 
     }
@@ -1643,12 +2266,204 @@ _mat_vec_p_l_native_vector(bool                exclude_diag,
       for (face_id = 0; face_id < ms->n_edges; face_id++) {
         ii = face_cel_p[face_id][0];
         jj = face_cel_p[face_id][1];
-        y[ii] += xa[2*face_id] * x[jj];
-        y[jj] += xa[2*face_id + 1] * x[ii];
+        if (ii < n_l_cols && jj < n_l_cols) {
+          y[ii] += xa[2*face_id] * x[jj];
+          y[jj] += xa[2*face_id + 1] * x[ii];
+        }
+      }
+
+    }
+
+  }
+
+  /* Complete ghost values exchange, then handle edges adjacent
+     to ghost columns */
+
+  if (hs != NULL) {
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+    if (mc->xa != NULL)
+      _mat_vec_p_l_native_halo(matrix, x, y);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Add contribution of a given edge to a local matrix.vector product
+ * y = A.x with matrix-free native matrix.
+ *
+ * parameters:
+ *   matrix  <-- pointer to matrix structure
+ *   face_id <-- edge id
+ *   x       <-- multipliying vector values
+ *   y       <-> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_b_mf_edge_ax_add(const cs_matrix_t  *matrix,
+                  cs_lnum_t           face_id,
+                  const cs_real_t     x[restrict],
+                  cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_native_t  *ms = matrix->structure;
+  const cs_matrix_coeff_native_t  *mc = matrix->coeffs;
+
+  const cs_lnum_t n = matrix->db_size[0], s = matrix->db_size[1];
+
+  /* non-diagonal terms:
+   *   X_ij = theta (m_ij)^- - theta visc_ij
+   *   X_ji = -theta (m_ij)^+ - theta visc_ij */
+
+  cs_lnum_t ii = ms->edges[face_id][0];
+  cs_lnum_t jj = ms->edges[face_id][1];
+
+  cs_real_t xa_ij = - mc->diff_coeff*mc->i_visc[face_id];
+  cs_real_t xa_ji = xa_ij;
+  if (mc->i_massflux != NULL) {
+    cs_real_t c_coeff = 0.5 * mc->conv_coeff;
+    cs_real_t m = mc->i_massflux[face_id];
+    xa_ij += c_coeff*(m - fabs(m));
+    xa_ji -= c_coeff*(m + fabs(m));
+  }
+
+  for (cs_lnum_t kk = 0; kk < n; kk++) {
+    y[ii*s + kk] += xa_ij * x[jj*s + kk];
+    y[jj*s + kk] += xa_ji * x[ii*s + kk];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with native matrix whose
+ * extra-diagonal terms are computed on the fly from a face-based
+ * upwind convection/diffusion definition (matrix-free variant).
+ *
+ * Extra-diagonal terms are scalar, and diagonal terms may be blocks.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-> multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_mat_vec_p_l_native_mf(bool                exclude_diag,
+                         bool                sync,
+                         const cs_matrix_t  *matrix,
+                         cs_real_t           x[restrict],
+                         cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_native_t  *ms = matrix->structure;
+  const cs_matrix_coeff_native_t  *mc = matrix->coeffs;
+
+  const cs_lnum_t *db_size = matrix->db_size;
+
+  /* Use thread groups if available, single group otherwise */
+
+  int n_threads = 1, n_groups = 1;
+  cs_lnum_t _group_index[2] = {0, ms->n_edges};
+  const cs_lnum_t *group_index = _group_index;
+
+  if (matrix->numbering != NULL) {
+    if (matrix->numbering->type == CS_NUMBERING_THREADS) {
+      n_threads = matrix->numbering->n_threads;
+      n_groups = matrix->numbering->n_groups;
+      group_index = matrix->numbering->group_index;
+    }
+  }
+
+  /* Initialize ghost values exchange */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+
+  /* Diagonal part of matrix.vector product */
+
+  if (! exclude_diag) {
+    _b_diag_vec_p_l(mc->da, x, y, ms->n_rows, db_size);
+    _b_zero_range(y, ms->n_rows, ms->n_cols_ext, db_size);
+  }
+  else
+    _b_zero_range(y, 0, ms->n_cols_ext, db_size);
+
+  /* non-diagonal terms; if ghost values are being exchanged, handle only
+     edges adjacent to local columns here */
+
+  const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+  const cs_lnum_t n_l_cols = (hs != NULL) ? ms->n_rows : ms->n_cols_ext;
+
+  for (int g_id = 0; g_id < n_groups; g_id++) {
+
+#   pragma omp parallel for if(n_threads > 1)
+    for (int t_id = 0; t_id < n_threads; t_id++) {
+
+      for (cs_lnum_t face_id = group_index[(t_id*n_groups + g_id)*2];
+           face_id < group_index[(t_id*n_groups + g_id)*2 + 1];
+           face_id++) {
+        if (   face_cel_p[face_id][0] < n_l_cols
+            && face_cel_p[face_id][1] < n_l_cols)
+          _b_mf_edge_ax_add(matrix, face_id, x, y);
       }
+    }
+  }
+
+  /* Complete ghost values exchange, then handle edges adjacent
+     to ghost columns */
+
+  if (hs != NULL) {
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+    for (cs_lnum_t e_id = 0; e_id < ms->n_halo_edges; e_id++)
+      _b_mf_edge_ax_add(matrix, ms->halo_edge_id[e_id], x, y);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Determine rows of a CSR matrix structure referencing ghost columns.
+ *
+ * Local rows may be handled while ghost values are exchanged only if
+ * ghost columns are placed last in each row (which is the case when
+ * columns are ordered), so that rows not referencing ghost columns
+ * may be identified using their last column. If this is not the case,
+ * n_halo_rows is set to -1.
+ *
+ * parameters:
+ *   ms  <-> pointer to CSR matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_halo_rows_csr(cs_matrix_struct_csr_t  *ms)
+{
+  const cs_lnum_t n_rows = ms->n_rows;
 
+  ms->n_halo_rows = 0;
+  ms->halo_row_id = NULL;
+
+  if (ms->n_cols_ext <= n_rows)
+    return;
+
+  cs_lnum_t n_halo_rows = 0;
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    const cs_lnum_t s_id = ms->row_index[ii];
+    const cs_lnum_t e_id = ms->row_index[ii+1];
+    cs_lnum_t jj = s_id;
+    while (jj < e_id && ms->col_id[jj] < n_rows)
+      jj++;
+    if (jj < e_id)
+      n_halo_rows++;
+    while (jj < e_id && ms->col_id[jj] >= n_rows)
+      jj++;
+    if (jj < e_id) {
+      ms->n_halo_rows = -1;
+      return;
     }
+  }
+
+  BFT_MALLOC(ms->halo_row_id, n_halo_rows, cs_lnum_t);
 
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    const cs_lnum_t e_id = ms->row_index[ii+1];
+    if (e_id > ms->row_index[ii] && ms->col_id[e_id - 1] >= n_rows)
+      ms->halo_row_id[ms->n_halo_rows++] = ii;
   }
 }
 
@@ -1670,6 +2485,8 @@ _destroy_struct_csr(cs_matrix_struct_csr_t  **matrix)
 
     BFT_FREE(ms->_col_id);
 
+    BFT_FREE(ms->halo_row_id);
+
     BFT_FREE(ms);
 
     *matrix = NULL;
@@ -1828,6 +2645,8 @@ _create_struct_csr(bool                have_diag,
   ms->row_index = ms->_row_index;
   ms->col_id = ms->_col_id;
 
+  _set_halo_rows_csr(ms);
+
   return ms;
 }
 
@@ -1896,6 +2715,8 @@ _create_struct_csr_from_csr(bool         have_diag,
 
   }
 
+  _set_halo_rows_csr(ms);
+
   return ms;
 }
 
@@ -1941,6 +2762,8 @@ _create_struct_csr_from_shared(bool              have_diag,
   ms->_row_index = NULL;
   ms->_col_id = NULL;
 
+  _set_halo_rows_csr(ms);
+
   return ms;
 }
 
@@ -2000,6 +2823,8 @@ _create_struct_csr_from_restrict_local(const cs_matrix_struct_csr_t  *src)
   ms->row_index = ms->_row_index;
   ms->col_id = ms->_col_id;
 
+  _set_halo_rows_csr(ms);
+
   return ms;
 }
 
@@ -2564,82 +3389,124 @@ _copy_diagonal_csr(const cs_matrix_t  *matrix,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product for a given row of a CSR matrix.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   ii           <-- row id
+ *   ms           <-- pointer to matrix structure
+ *   mc           <-- pointer to matrix coefficients
+ *   x            <-- multipliying vector values
+ *
+ * returns:
+ *   resulting value for row
+ *----------------------------------------------------------------------------*/
+
+static inline cs_real_t
+_csr_row_p(bool                            exclude_diag,
+           cs_lnum_t                       ii,
+           const cs_matrix_struct_csr_t   *ms,
+           const cs_matrix_coeff_csr_t    *mc,
+           const cs_real_t                *restrict x)
+{
+  const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+  const cs_real_t *restrict m_row = mc->val + ms->row_index[ii];
+  cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+  cs_real_t sii = 0.0;
+
+  if (!exclude_diag) {
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+      sii += (m_row[jj]*x[col_id[jj]]);
+  }
+  else {
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+      if (col_id[jj] != ii)
+        sii += (m_row[jj]*x[col_id[jj]]);
+    }
+  }
+
+  return sii;
+}
+
 /*----------------------------------------------------------------------------
  * Local matrix.vector product y = A.x with CSR matrix.
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
  *   matrix       <-- pointer to matrix structure
- *   x            <-- multipliying vector values
+ *   x            <-> multipliying vector values
  *   y            --> resulting vector
  *----------------------------------------------------------------------------*/
 
 static void
 _mat_vec_p_l_csr(bool                exclude_diag,
+                 bool                sync,
                  const cs_matrix_t  *matrix,
-                 const cs_real_t    *restrict x,
+                 cs_real_t          *restrict x,
                  cs_real_t          *restrict y)
 {
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
   const cs_matrix_coeff_csr_t  *mc = matrix->coeffs;
   cs_lnum_t  n_rows = ms->n_rows;
 
-  /* Standard case */
-
-  if (!exclude_diag) {
-
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
-
-      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
-      const cs_real_t *restrict m_row = mc->val + ms->row_index[ii];
-      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
-      cs_real_t sii = 0.0;
-
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
-        sii += (m_row[jj]*x[col_id[jj]]);
-
-      y[ii] = sii;
+  /* Initialize ghost values exchange; rows referencing ghost columns
+     are handled once it is complete */
 
-    }
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
 
+  if (hs != NULL && ms->n_halo_rows < 0) {
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+    hs = NULL;
   }
 
-  /* Exclude diagonal */
+  const cs_lnum_t n_l_cols = (hs != NULL) ? n_rows : ms->n_cols_ext;
 
-  else {
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    const cs_lnum_t e_id = ms->row_index[ii+1];
+    if (e_id > ms->row_index[ii] && ms->col_id[e_id-1] >= n_l_cols)
+      continue;
+    y[ii] = _csr_row_p(exclude_diag, ii, ms, mc, x);
+  }
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+  /* Complete ghost values exchange, then handle rows referencing
+     ghost columns */
 
-      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
-      const cs_real_t *restrict m_row = mc->val + ms->row_index[ii];
-      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
-      cs_real_t sii = 0.0;
+  if (hs != NULL) {
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        if (col_id[jj] != ii)
-          sii += (m_row[jj]*x[col_id[jj]]);
-      }
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
 
-      y[ii] = sii;
+    const cs_lnum_t n_halo_rows = ms->n_halo_rows;
 
+#   pragma omp parallel for  if(n_halo_rows > CS_THR_MIN)
+    for (cs_lnum_t r_id = 0; r_id < n_halo_rows; r_id++) {
+      cs_lnum_t ii = ms->halo_row_id[r_id];
+      y[ii] = _csr_row_p(exclude_diag, ii, ms, mc, x);
     }
-  }
 
+  }
 }
 
 #if defined (HAVE_MKL)
 
 static void
 _mat_vec_p_l_csr_mkl(bool                exclude_diag,
+                     bool                sync,
                      const cs_matrix_t  *matrix,
-                     const cs_real_t    *restrict x,
+                     cs_real_t          *restrict x,
                      cs_real_t          *restrict y)
 {
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
   const cs_matrix_coeff_csr_t  *mc = matrix->coeffs;
 
+  /* Ghost values exchange */
+
+  if (sync)
+    _pre_vector_multiply_sync_x(CS_HALO_ROTATION_COPY, matrix, x);
+
   int n_rows = ms->n_rows;
   char transa[] = "n";
 
@@ -3133,15 +4000,17 @@ _copy_diagonal_csr_sym(const cs_matrix_t  *matrix,
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
  *   matrix       <-- pointer to matrix structure
- *   x            <-- multipliying vector values
+ *   x            <-> multipliying vector values
  *   y            --> resulting vector
  *----------------------------------------------------------------------------*/
 
 static void
 _mat_vec_p_l_csr_sym(bool                 exclude_diag,
+                     bool                 sync,
                      const cs_matrix_t   *matrix,
-                     const cs_real_t      x[restrict],
+                     cs_real_t            x[restrict],
                      cs_real_t            y[restrict])
 {
   cs_lnum_t  ii, jj, n_cols;
@@ -3155,6 +4024,11 @@ _mat_vec_p_l_csr_sym(bool                 exclude_diag,
   cs_lnum_t jj_start = 0;
   cs_lnum_t sym_jj_start = 0;
 
+  /* Ghost values exchange */
+
+  if (sync)
+    _pre_vector_multiply_sync_x(CS_HALO_ROTATION_COPY, matrix, x);
+
   /* By construction, the matrix has either a full or an empty
      diagonal structure, so testing this on the first row is enough */
 
@@ -3194,8 +4068,9 @@ _mat_vec_p_l_csr_sym(bool                 exclude_diag,
 
 static void
 _mat_vec_p_l_csr_sym_mkl(bool                exclude_diag,
+                         bool                sync,
                          const cs_matrix_t  *matrix,
-                         const cs_real_t    *restrict x,
+                         cs_real_t          *restrict x,
                          cs_real_t          *restrict y)
 {
   const cs_matrix_struct_csr_sym_t  *ms = matrix->structure;
@@ -3204,6 +4079,11 @@ _mat_vec_p_l_csr_sym_mkl(bool                exclude_diag,
   int n_rows = ms->n_rows;
   char uplo[] = "u";
 
+  /* Ghost values exchange */
+
+  if (sync)
+    _pre_vector_multiply_sync_x(CS_HALO_ROTATION_COPY, matrix, x);
+
   if (exclude_diag)
     bft_error(__FILE__, __LINE__, 0,
               _(_no_exclude_diag_error_str), __func__);
@@ -3246,6 +4126,11 @@ _create_coeff_msr(void)
   mc->_d_val = NULL;
   mc->_x_val = NULL;
 
+  mc->_x_val_f = NULL;
+  mc->fill_type_f = CS_MATRIX_N_FILL_TYPES;
+  mc->vector_multiply_d[0] = NULL;
+  mc->vector_multiply_d[1] = NULL;
+
   return mc;
 }
 
@@ -3263,6 +4148,7 @@ _destroy_coeff_msr(cs_matrix_coeff_msr_t  **coeff)
 
     cs_matrix_coeff_msr_t  *mc = *coeff;
 
+    BFT_FREE(mc->_x_val_f);
     BFT_FREE(mc->_x_val);
 
     BFT_FREE(mc->_d_val);
@@ -3273,30 +4159,57 @@ _destroy_coeff_msr(cs_matrix_coeff_msr_t  **coeff)
 }
 
 /*----------------------------------------------------------------------------
- * Set MSR matrix extradiagonal coefficients to zero.
- *
- * The coefficients should already be allocated.
+ * Release single-precision MSR matrix extradiagonal coefficients, if present.
  *
- * Use of this function is preferrable to a simple loop, as its
- * threading behavior should be consistent with SpMW in NUMA cases.
+ * The matrix.vector product functions replaced when converting
+ * the coefficients are restored.
  *
  * parameters:
- *   matrix           <-> pointer to matrix structure
+ *   matrix <-> pointer to matrix structure
  *----------------------------------------------------------------------------*/
 
 static void
-_zero_x_coeffs_msr(cs_matrix_t  *matrix)
+_release_x_coeffs_msr_f(cs_matrix_t  *matrix)
 {
   cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
 
-  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  if (mc == NULL || mc->_x_val_f == NULL)
+    return;
 
-  const cs_lnum_t  n_rows = ms->n_rows;
-  const cs_lnum_t *eb_size = matrix->eb_size;
+  BFT_FREE(mc->_x_val_f);
 
-  if (eb_size[0] == 1) {
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+  for (int ed_flag = 0; ed_flag < 2; ed_flag++) {
+    matrix->vector_multiply[mc->fill_type_f][ed_flag]
+      = mc->vector_multiply_d[ed_flag];
+    mc->vector_multiply_d[ed_flag] = NULL;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Set MSR matrix extradiagonal coefficients to zero.
+ *
+ * The coefficients should already be allocated.
+ *
+ * Use of this function is preferrable to a simple loop, as its
+ * threading behavior should be consistent with SpMW in NUMA cases.
+ *
+ * parameters:
+ *   matrix           <-> pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_zero_x_coeffs_msr(cs_matrix_t  *matrix)
+{
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t *eb_size = matrix->eb_size;
+
+  if (eb_size[0] == 1) {
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
       const cs_lnum_t  n_cols = ms->row_index[ii+1] - ms->row_index[ii];
       cs_real_t  *m_row = mc->_x_val + ms->row_index[ii];
       for (cs_lnum_t jj = 0; jj < n_cols; jj++)
@@ -3611,6 +4524,8 @@ _set_coeffs_msr(cs_matrix_t         *matrix,
 
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
 
+  _release_x_coeffs_msr_f(matrix);
+
   /* Map or copy diagonal values */
 
   _map_or_copy_da_coeffs_msr(matrix, copy, da);
@@ -3671,6 +4586,8 @@ _set_coeffs_msr_from_msr(cs_matrix_t       *matrix,
 
   bool d_transferred = false, x_transferred = false;
 
+  _release_x_coeffs_msr_f(matrix);
+
   /* TODO: we should use metadata or check that the row_index and
      column id values are consistent, which should be true as long
      as columns are ordered in an identical manner */
@@ -3728,6 +4645,186 @@ _release_coeffs_msr(cs_matrix_t  *matrix)
     /* Unmap shared values */
     mc->d_val = NULL;
     mc->x_val = NULL;
+    _release_x_coeffs_msr_f(matrix);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product for the extra-diagonal terms of a given row
+ * of an MSR matrix.
+ *
+ * parameters:
+ *   ii  <-- row id
+ *   ms  <-- pointer to matrix structure
+ *   mc  <-- pointer to matrix coefficients
+ *   x   <-- multipliying vector values
+ *
+ * returns:
+ *   resulting extra-diagonal contribution for row
+ *----------------------------------------------------------------------------*/
+
+static inline cs_real_t
+_msr_row_p(cs_lnum_t                       ii,
+           const cs_matrix_struct_csr_t   *ms,
+           const cs_matrix_coeff_msr_t    *mc,
+           const cs_real_t                *restrict x)
+{
+  const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+  const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
+  cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+  cs_real_t sii = 0.0;
+
+  for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+    sii += (m_row[jj]*x[col_id[jj]]);
+
+  return sii;
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product for the extra-diagonal terms of a given row
+ * of an MSR matrix with single-precision extra-diagonal coefficients.
+ *
+ * Products are accumulated in double precision.
+ *
+ * parameters:
+ *   ii  <-- row id
+ *   ms  <-- pointer to matrix structure
+ *   mc  <-- pointer to matrix coefficients
+ *   x   <-- multipliying vector values
+ *
+ * returns:
+ *   resulting extra-diagonal contribution for row
+ *----------------------------------------------------------------------------*/
+
+static inline cs_real_t
+_msr_row_p_f(cs_lnum_t                       ii,
+             const cs_matrix_struct_csr_t   *ms,
+             const cs_matrix_coeff_msr_t    *mc,
+             const cs_real_t                *restrict x)
+{
+  const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+  const float *restrict m_row = mc->_x_val_f + ms->row_index[ii];
+  cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+  cs_real_t sii = 0.0;
+
+  for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+    sii += ((cs_real_t)m_row[jj]*x[col_id[jj]]);
+
+  return sii;
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product for a given row of a block MSR matrix.
+ *
+ * parameters:
+ *   ii       <-- row id
+ *   db_size  <-- block sizes for diagonal
+ *   d_val    <-- diagonal matrix coefficients, or NULL if excluded
+ *   ms       <-- pointer to matrix structure
+ *   mc       <-- pointer to matrix coefficients
+ *   x        <-- multipliying vector values
+ *   y        --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_b_msr_row_p(cs_lnum_t                       ii,
+             const cs_lnum_t                 db_size[4],
+             const cs_real_t                *restrict d_val,
+             const cs_matrix_struct_csr_t   *ms,
+             const cs_matrix_coeff_msr_t    *mc,
+             const cs_real_t                *restrict x,
+             cs_real_t                      *restrict y)
+{
+  const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+  const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
+  cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+
+  if (d_val != NULL)
+    _dense_b_ax(ii, db_size, d_val, x, y);
+  else {
+    for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+      y[ii*db_size[1] + kk] = 0.;
+  }
+
+  for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+    for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+      y[ii*db_size[1] + kk]
+        += (m_row[jj]*x[col_id[jj]*db_size[1] + kk]);
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product for a given row of a 3x3 block MSR matrix.
+ *
+ * parameters:
+ *   ii       <-- row id
+ *   d_val    <-- diagonal matrix coefficients, or NULL if excluded
+ *   ms       <-- pointer to matrix structure
+ *   mc       <-- pointer to matrix coefficients
+ *   x        <-- multipliying vector values
+ *   y        --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_3_3_msr_row_p(cs_lnum_t                       ii,
+               const cs_real_t                *restrict d_val,
+               const cs_matrix_struct_csr_t   *ms,
+               const cs_matrix_coeff_msr_t    *mc,
+               const cs_real_t                *restrict x,
+               cs_real_t                      *restrict y)
+{
+  const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+  const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
+  cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+
+  if (d_val != NULL)
+    _dense_3_3_ax(ii, d_val, x, y);
+  else {
+    for (cs_lnum_t kk = 0; kk < 3; kk++)
+      y[ii*3 + kk] = 0.;
+  }
+
+  for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+    for (cs_lnum_t kk = 0; kk < 3; kk++)
+      y[ii*3 + kk] += (m_row[jj]*x[col_id[jj]*3 + kk]);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product for a given row of a 6x6 block MSR matrix.
+ *
+ * parameters:
+ *   ii       <-- row id
+ *   d_val    <-- diagonal matrix coefficients, or NULL if excluded
+ *   ms       <-- pointer to matrix structure
+ *   mc       <-- pointer to matrix coefficients
+ *   x        <-- multipliying vector values
+ *   y        --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_6_6_msr_row_p(cs_lnum_t                       ii,
+               const cs_real_t                *restrict d_val,
+               const cs_matrix_struct_csr_t   *ms,
+               const cs_matrix_coeff_msr_t    *mc,
+               const cs_real_t                *restrict x,
+               cs_real_t                      *restrict y)
+{
+  const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+  const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
+  cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+
+  if (d_val != NULL)
+    _dense_6_6_ax(ii, d_val, x, y);
+  else {
+    for (cs_lnum_t kk = 0; kk < 6; kk++)
+      y[ii*6 + kk] = 0.;
+  }
+
+  for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+    for (cs_lnum_t kk = 0; kk < 6; kk++)
+      y[ii*6 + kk] += (m_row[jj]*x[col_id[jj]*6 + kk]);
   }
 }
 
@@ -3736,38 +4833,49 @@ _release_coeffs_msr(cs_matrix_t  *matrix)
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
  *   matrix       <-- pointer to matrix structure
- *   x            <-- multipliying vector values
+ *   x            <-> multipliying vector values
  *   y            --> resulting vector
  *----------------------------------------------------------------------------*/
 
 static void
 _mat_vec_p_l_msr(bool                exclude_diag,
+                 bool                sync,
                  const cs_matrix_t  *matrix,
-                 const cs_real_t    *restrict x,
+                 cs_real_t          *restrict x,
                  cs_real_t          *restrict y)
 {
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
   const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
   cs_lnum_t  n_rows = ms->n_rows;
 
-  /* Standard case */
+  const cs_real_t *restrict d_val
+    = (!exclude_diag && mc->d_val != NULL) ? mc->d_val : NULL;
 
-  if (!exclude_diag && mc->d_val != NULL) {
+  /* Initialize ghost values exchange; rows referencing ghost columns
+     are handled once it is complete */
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
 
-      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
-      const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
-      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
-      cs_real_t sii = 0.0;
+  if (hs != NULL && ms->n_halo_rows < 0) {
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+    hs = NULL;
+  }
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
-        sii += (m_row[jj]*x[col_id[jj]]);
+  const cs_lnum_t n_l_cols = (hs != NULL) ? n_rows : ms->n_cols_ext;
 
-      y[ii] = sii + mc->d_val[ii]*x[ii];
+  /* Standard case */
+
+  if (d_val != NULL) {
 
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      const cs_lnum_t e_id = ms->row_index[ii+1];
+      if (e_id > ms->row_index[ii] && ms->col_id[e_id-1] >= n_l_cols)
+        continue;
+      y[ii] = _msr_row_p(ii, ms, mc, x) + d_val[ii]*x[ii];
     }
 
   }
@@ -3778,20 +4886,101 @@ _mat_vec_p_l_msr(bool                exclude_diag,
 
 #   pragma omp parallel for  if(n_rows > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      const cs_lnum_t e_id = ms->row_index[ii+1];
+      if (e_id > ms->row_index[ii] && ms->col_id[e_id-1] >= n_l_cols)
+        continue;
+      y[ii] = _msr_row_p(ii, ms, mc, x);
+    }
 
-      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
-      const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
-      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
-      cs_real_t sii = 0.0;
+  }
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
-        sii += (m_row[jj]*x[col_id[jj]]);
+  /* Complete ghost values exchange, then handle rows referencing
+     ghost columns */
 
-      y[ii] = sii;
+  if (hs != NULL) {
+
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+
+    const cs_lnum_t n_halo_rows = ms->n_halo_rows;
 
+#   pragma omp parallel for  if(n_halo_rows > CS_THR_MIN)
+    for (cs_lnum_t r_id = 0; r_id < n_halo_rows; r_id++) {
+      cs_lnum_t ii = ms->halo_row_id[r_id];
+      y[ii] = _msr_row_p(ii, ms, mc, x);
+      if (d_val != NULL)
+        y[ii] += d_val[ii]*x[ii];
     }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix using
+ * single-precision extra-diagonal coefficients.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-> multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_msr_f(bool                exclude_diag,
+                   bool                sync,
+                   const cs_matrix_t  *matrix,
+                   cs_real_t          *restrict x,
+                   cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  cs_lnum_t  n_rows = ms->n_rows;
+
+  const cs_real_t *restrict d_val
+    = (!exclude_diag && mc->d_val != NULL) ? mc->d_val : NULL;
+
+  /* Initialize ghost values exchange; rows referencing ghost columns
+     are handled once it is complete */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+
+  if (hs != NULL && ms->n_halo_rows < 0) {
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+    hs = NULL;
+  }
+
+  const cs_lnum_t n_l_cols = (hs != NULL) ? n_rows : ms->n_cols_ext;
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    const cs_lnum_t e_id = ms->row_index[ii+1];
+    if (e_id > ms->row_index[ii] && ms->col_id[e_id-1] >= n_l_cols)
+      continue;
+    y[ii] = _msr_row_p_f(ii, ms, mc, x);
+    if (d_val != NULL)
+      y[ii] += d_val[ii]*x[ii];
   }
 
+  /* Complete ghost values exchange, then handle rows referencing
+     ghost columns */
+
+  if (hs != NULL) {
+
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+
+    const cs_lnum_t n_halo_rows = ms->n_halo_rows;
+
+#   pragma omp parallel for  if(n_halo_rows > CS_THR_MIN)
+    for (cs_lnum_t r_id = 0; r_id < n_halo_rows; r_id++) {
+      cs_lnum_t ii = ms->halo_row_id[r_id];
+      y[ii] = _msr_row_p_f(ii, ms, mc, x);
+      if (d_val != NULL)
+        y[ii] += d_val[ii]*x[ii];
+    }
+
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -3799,21 +4988,28 @@ _mat_vec_p_l_msr(bool                exclude_diag,
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
  *   matrix       <-- pointer to matrix structure
- *   x            <-- multipliying vector values
+ *   x            <-> multipliying vector values
  *   y            --> resulting vector
  *----------------------------------------------------------------------------*/
 
 static void
 _mat_vec_p_l_msr_omp_sched(bool                exclude_diag,
+                           bool                sync,
                            const cs_matrix_t  *matrix,
-                           const cs_real_t    *restrict x,
+                           cs_real_t          *restrict x,
                            cs_real_t          *restrict y)
 {
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
   const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
   cs_lnum_t  n_rows = ms->n_rows;
 
+  /* Ghost values exchange */
+
+  if (sync)
+    _pre_vector_multiply_sync_x(CS_HALO_ROTATION_COPY, matrix, x);
+
   /* Standard case */
 
   if (!exclude_diag && mc->d_val != NULL) {
@@ -3911,15 +5107,17 @@ _mat_vec_p_l_msr_omp_sched(bool                exclude_diag,
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
  *   matrix       <-- pointer to matrix structure
- *   x            <-- multipliying vector values
+ *   x            <-> multipliying vector values
  *   y            --> resulting vector
  *----------------------------------------------------------------------------*/
 
 static void
 _b_mat_vec_p_l_msr_generic(bool                exclude_diag,
+                           bool                sync,
                            const cs_matrix_t  *matrix,
-                           const cs_real_t     x[restrict],
+                           cs_real_t           x[restrict],
                            cs_real_t           y[restrict])
 {
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
@@ -3927,54 +5125,46 @@ _b_mat_vec_p_l_msr_generic(bool                exclude_diag,
   const cs_lnum_t  n_rows = ms->n_rows;
   const cs_lnum_t *db_size = matrix->db_size;
 
-  /* Standard case */
-
-  if (!exclude_diag && mc->d_val != NULL) {
-
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
-
-      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
-      const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
-      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
-
-      _dense_b_ax(ii, db_size, mc->d_val, x, y);
+  const cs_real_t *restrict d_val
+    = (!exclude_diag && mc->d_val != NULL) ? mc->d_val : NULL;
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
-          y[ii*db_size[1] + kk]
-            += (m_row[jj]*x[col_id[jj]*db_size[1] + kk]);
-        }
-      }
+  /* Initialize ghost values exchange; rows referencing ghost columns
+     are handled once it is complete */
 
-    }
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
 
+  if (hs != NULL && ms->n_halo_rows < 0) {
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+    hs = NULL;
   }
 
-  /* Exclude diagonal */
+  const cs_lnum_t n_l_cols = (hs != NULL) ? n_rows : ms->n_cols_ext;
 
-  else {
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    const cs_lnum_t e_id = ms->row_index[ii+1];
+    if (e_id > ms->row_index[ii] && ms->col_id[e_id-1] >= n_l_cols)
+      continue;
+    _b_msr_row_p(ii, db_size, d_val, ms, mc, x, y);
+  }
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+  /* Complete ghost values exchange, then handle rows referencing
+     ghost columns */
 
-      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
-      const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
-      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+  if (hs != NULL) {
 
-      for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
-        y[ii*db_size[1] + kk] = 0.;
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
-          y[ii*db_size[1] + kk]
-            += (m_row[jj]*x[col_id[jj]*db_size[1] + kk]);
-        }
-      }
+    const cs_lnum_t n_halo_rows = ms->n_halo_rows;
 
+#   pragma omp parallel for  if(n_halo_rows > CS_THR_MIN)
+    for (cs_lnum_t r_id = 0; r_id < n_halo_rows; r_id++) {
+      cs_lnum_t ii = ms->halo_row_id[r_id];
+      _b_msr_row_p(ii, db_size, d_val, ms, mc, x, y);
     }
-  }
 
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -3982,67 +5172,65 @@ _b_mat_vec_p_l_msr_generic(bool                exclude_diag,
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
  *   matrix       <-- pointer to matrix structure
- *   x            <-- multipliying vector values
+ *   x            <-> multipliying vector values
  *   y            --> resulting vector
  *----------------------------------------------------------------------------*/
 
 static void
 _3_3_mat_vec_p_l_msr(bool                exclude_diag,
+                     bool                sync,
                      const cs_matrix_t  *matrix,
-                     const cs_real_t    *restrict x,
-                     cs_real_t          *restrict y)
+                     cs_real_t           x[restrict],
+                     cs_real_t           y[restrict])
 {
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
   const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
   const cs_lnum_t  n_rows = ms->n_rows;
 
-  assert(matrix->db_size[0] == 3 && matrix->db_size[3] == 9);
-
-  /* Standard case */
-
-  if (!exclude_diag && mc->d_val != NULL) {
-
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
-
-      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
-      const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
-      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+  const cs_real_t *restrict d_val
+    = (!exclude_diag && mc->d_val != NULL) ? mc->d_val : NULL;
 
-      _dense_3_3_ax(ii, mc->d_val, x, y);
+  assert(matrix->db_size[0] == 3 && matrix->db_size[3] == 9);
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        for (cs_lnum_t kk = 0; kk < 3; kk++)
-          y[ii*3 + kk] += (m_row[jj]*x[col_id[jj]*3 + kk]);
-      }
+  /* Initialize ghost values exchange; rows referencing ghost columns
+     are handled once it is complete */
 
-    }
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
 
+  if (hs != NULL && ms->n_halo_rows < 0) {
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+    hs = NULL;
   }
 
-  /* Exclude diagonal */
+  const cs_lnum_t n_l_cols = (hs != NULL) ? n_rows : ms->n_cols_ext;
 
-  else {
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    const cs_lnum_t e_id = ms->row_index[ii+1];
+    if (e_id > ms->row_index[ii] && ms->col_id[e_id-1] >= n_l_cols)
+      continue;
+    _3_3_msr_row_p(ii, d_val, ms, mc, x, y);
+  }
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+  /* Complete ghost values exchange, then handle rows referencing
+     ghost columns */
 
-      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
-      const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
-      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+  if (hs != NULL) {
 
-      for (cs_lnum_t kk = 0; kk < 3; kk++)
-        y[ii*3 + kk] = 0.;
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        for (cs_lnum_t kk = 0; kk < 3; kk++)
-          y[ii*3 + kk] += (m_row[jj]*x[col_id[jj]*3 + kk]);
-      }
+    const cs_lnum_t n_halo_rows = ms->n_halo_rows;
 
+#   pragma omp parallel for  if(n_halo_rows > CS_THR_MIN)
+    for (cs_lnum_t r_id = 0; r_id < n_halo_rows; r_id++) {
+      cs_lnum_t ii = ms->halo_row_id[r_id];
+      _3_3_msr_row_p(ii, d_val, ms, mc, x, y);
     }
-  }
 
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -4050,67 +5238,65 @@ _3_3_mat_vec_p_l_msr(bool                exclude_diag,
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
  *   matrix       <-- pointer to matrix structure
- *   x            <-- multipliying vector values
+ *   x            <-> multipliying vector values
  *   y            --> resulting vector
  *----------------------------------------------------------------------------*/
 
 static void
 _6_6_mat_vec_p_l_msr(bool                exclude_diag,
+                     bool                sync,
                      const cs_matrix_t  *matrix,
-                     const cs_real_t     x[restrict],
+                     cs_real_t           x[restrict],
                      cs_real_t           y[restrict])
 {
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
   const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
   const cs_lnum_t  n_rows = ms->n_rows;
 
-  assert(matrix->db_size[0] == 6 && matrix->db_size[3] == 36);
-
-  /* Standard case */
-
-  if (!exclude_diag && mc->d_val != NULL) {
-
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
-
-      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
-      const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
-      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+  const cs_real_t *restrict d_val
+    = (!exclude_diag && mc->d_val != NULL) ? mc->d_val : NULL;
 
-      _dense_6_6_ax(ii, mc->d_val, x, y);
+  assert(matrix->db_size[0] == 6 && matrix->db_size[3] == 36);
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        for (cs_lnum_t kk = 0; kk < 6; kk++)
-          y[ii*6 + kk] += (m_row[jj]*x[col_id[jj]*6 + kk]);
-      }
+  /* Initialize ghost values exchange; rows referencing ghost columns
+     are handled once it is complete */
 
-    }
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
 
+  if (hs != NULL && ms->n_halo_rows < 0) {
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+    hs = NULL;
   }
 
-  /* Exclude diagonal */
+  const cs_lnum_t n_l_cols = (hs != NULL) ? n_rows : ms->n_cols_ext;
 
-  else {
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    const cs_lnum_t e_id = ms->row_index[ii+1];
+    if (e_id > ms->row_index[ii] && ms->col_id[e_id-1] >= n_l_cols)
+      continue;
+    _6_6_msr_row_p(ii, d_val, ms, mc, x, y);
+  }
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+  /* Complete ghost values exchange, then handle rows referencing
+     ghost columns */
 
-      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
-      const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
-      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+  if (hs != NULL) {
 
-      for (cs_lnum_t kk = 0; kk < 6; kk++)
-        y[ii*6 + kk] = 0.;
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        for (cs_lnum_t kk = 0; kk < 6; kk++)
-          y[ii*6 + kk] += (m_row[jj]*x[col_id[jj]*6 + kk]);
-      }
+    const cs_lnum_t n_halo_rows = ms->n_halo_rows;
 
+#   pragma omp parallel for  if(n_halo_rows > CS_THR_MIN)
+    for (cs_lnum_t r_id = 0; r_id < n_halo_rows; r_id++) {
+      cs_lnum_t ii = ms->halo_row_id[r_id];
+      _6_6_msr_row_p(ii, d_val, ms, mc, x, y);
     }
-  }
 
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -4120,25 +5306,27 @@ _6_6_mat_vec_p_l_msr(bool                exclude_diag,
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
  *   matrix       <-- pointer to matrix structure
- *   x            <-- multipliying vector values
+ *   x            <-> multipliying vector values
  *   y            --> resulting vector
  *----------------------------------------------------------------------------*/
 
 static void
 _b_mat_vec_p_l_msr(bool                exclude_diag,
+                   bool                sync,
                    const cs_matrix_t  *matrix,
-                   const cs_real_t     x[restrict],
+                   cs_real_t           x[restrict],
                    cs_real_t           y[restrict])
 {
   if (matrix->db_size[0] == 3 && matrix->db_size[3] == 9)
-    _3_3_mat_vec_p_l_msr(exclude_diag, matrix, x, y);
+    _3_3_mat_vec_p_l_msr(exclude_diag, sync, matrix, x, y);
 
   else if (matrix->db_size[0] == 6 && matrix->db_size[3] == 36)
-    _6_6_mat_vec_p_l_msr(exclude_diag, matrix, x, y);
+    _6_6_mat_vec_p_l_msr(exclude_diag, sync, matrix, x, y);
 
   else
-    _b_mat_vec_p_l_msr_generic(exclude_diag, matrix, x, y);
+    _b_mat_vec_p_l_msr_generic(exclude_diag, sync, matrix, x, y);
 }
 
 /*----------------------------------------------------------------------------
@@ -4146,8 +5334,9 @@ _b_mat_vec_p_l_msr(bool                exclude_diag,
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
  *   matrix       <-- pointer to matrix structure
- *   x            <-- multipliying vector values
+ *   x            <-> multipliying vector values
  *   y            --> resulting vector
  *----------------------------------------------------------------------------*/
 
@@ -4155,13 +5344,19 @@ _b_mat_vec_p_l_msr(bool                exclude_diag,
 
 static void
 _mat_vec_p_l_msr_mkl(bool                exclude_diag,
+                     bool                sync,
                      const cs_matrix_t  *matrix,
-                     const cs_real_t     x[restrict],
+                     cs_real_t           x[restrict],
                      cs_real_t           y[restrict])
 {
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
   const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
 
+  /* Ghost values exchange */
+
+  if (sync)
+    _pre_vector_multiply_sync_x(CS_HALO_ROTATION_COPY, matrix, x);
+
   int n_rows = ms->n_rows;
   char transa[] = "n";
 
@@ -4187,69 +5382,834 @@ _mat_vec_p_l_msr_mkl(bool                exclude_diag,
 #endif /* defined (HAVE_MKL) */
 
 /*----------------------------------------------------------------------------
- * Synchronize ghost values prior to matrix.vector product
+ * Create a SELL-C-sigma matrix structure from an MSR structure.
+ *
+ * Rows not referencing ghost columns are placed first, so that the
+ * associated chunks may be handled while ghost values are exchanged.
+ * Within each of these two groups, rows are sorted by decreasing length
+ * inside windows of CS_MATRIX_SELL_SIGMA rows, which limits padding
+ * while preserving locality.
+ *
+ * The MSR structure's ownership is transferred to the created structure.
  *
  * parameters:
- *   rotation_mode <-- halo update option for rotational periodicity
- *   matrix        <-- pointer to matrix structure
- *   x             <-> multipliying vector values (ghost values updated)
+ *   msr <-> pointer to MSR matrix structure pointer (NULL on return)
+ *
+ * returns:
+ *   a pointer to a created SELL-C-sigma matrix structure
+ *----------------------------------------------------------------------------*/
+
+static cs_matrix_struct_sell_t *
+_create_struct_sell(cs_matrix_struct_csr_t  **msr)
+{
+  const cs_lnum_t c_size = CS_MATRIX_SELL_C;
+
+  cs_matrix_struct_sell_t  *ms;
+  cs_matrix_struct_csr_t  *_msr = *msr;
+
+  const cs_lnum_t n_rows = _msr->n_rows;
+  const cs_lnum_t *restrict row_index = _msr->row_index;
+  const cs_lnum_t *restrict col_id = _msr->col_id;
+
+  BFT_MALLOC(ms, 1, cs_matrix_struct_sell_t);
+
+  ms->n_rows = n_rows;
+  ms->n_cols_ext = _msr->n_cols_ext;
+
+  /* Order rows, placing those not referencing ghost columns first */
+
+  cs_lnum_t *r_order, *r_key;
+  BFT_MALLOC(r_order, n_rows, cs_lnum_t);
+  BFT_MALLOC(r_key, n_rows, cs_lnum_t);
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    r_key[ii] = 0;
+    for (cs_lnum_t jj = row_index[ii]; jj < row_index[ii+1]; jj++) {
+      if (col_id[jj] >= n_rows) {
+        r_key[ii] = 1;
+        break;
+      }
+    }
+  }
+
+  cs_lnum_t n_l_rows = 0;
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    if (r_key[ii] == 0)
+      r_order[n_l_rows++] = ii;
+  }
+  cs_lnum_t k = n_l_rows;
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    if (r_key[ii] != 0)
+      r_order[k++] = ii;
+  }
+
+  /* Sort by decreasing length within windows of each group */
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    r_key[ii] = row_index[r_order[ii]] - row_index[r_order[ii] + 1];
+
+  const cs_lnum_t g_idx[3] = {0, n_l_rows, n_rows};
+
+  for (int g_id = 0; g_id < 2; g_id++) {
+    for (cs_lnum_t s_id = g_idx[g_id];
+         s_id < g_idx[g_id+1];
+         s_id += CS_MATRIX_SELL_SIGMA) {
+      cs_lnum_t e_id = CS_MIN(s_id + CS_MATRIX_SELL_SIGMA, g_idx[g_id+1]);
+      cs_sort_coupled_shell(s_id, e_id, r_key, r_order);
+    }
+  }
+
+  BFT_FREE(r_key);
+
+  /* Build chunks */
+
+  ms->n_l_chunks = (n_l_rows + c_size - 1) / c_size;
+  ms->n_chunks = ms->n_l_chunks + (n_rows - n_l_rows + c_size - 1) / c_size;
+
+  BFT_MALLOC(ms->row_id, ms->n_chunks*c_size, cs_lnum_t);
+  BFT_MALLOC(ms->chunk_index, ms->n_chunks + 1, cs_lnum_t);
+
+  for (cs_lnum_t ii = 0; ii < ms->n_chunks*c_size; ii++)
+    ms->row_id[ii] = -1;
+
+  for (cs_lnum_t ii = 0; ii < n_l_rows; ii++)
+    ms->row_id[ii] = r_order[ii];
+  for (cs_lnum_t ii = n_l_rows; ii < n_rows; ii++)
+    ms->row_id[ms->n_l_chunks*c_size + ii - n_l_rows] = r_order[ii];
+
+  BFT_FREE(r_order);
+
+  ms->chunk_index[0] = 0;
+  for (cs_lnum_t c_id = 0; c_id < ms->n_chunks; c_id++) {
+    cs_lnum_t n_cols = 0;
+    for (cs_lnum_t kk = 0; kk < c_size; kk++) {
+      cs_lnum_t ii = ms->row_id[c_id*c_size + kk];
+      if (ii > -1)
+        n_cols = CS_MAX(n_cols, row_index[ii+1] - row_index[ii]);
+    }
+    ms->chunk_index[c_id+1] = ms->chunk_index[c_id] + n_cols*c_size;
+  }
+
+  /* Column ids, and mapping from MSR entries */
+
+  BFT_MALLOC(ms->col_id, ms->chunk_index[ms->n_chunks], cs_lnum_t);
+  BFT_MALLOC(ms->entry_id, row_index[n_rows], cs_lnum_t);
+
+# pragma omp parallel for  if(ms->n_chunks*c_size > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < ms->n_chunks; c_id++) {
+    const cs_lnum_t s_id = ms->chunk_index[c_id];
+    const cs_lnum_t n_cols = (ms->chunk_index[c_id+1] - s_id) / c_size;
+    for (cs_lnum_t kk = 0; kk < c_size; kk++) {
+      const cs_lnum_t ii = ms->row_id[c_id*c_size + kk];
+      cs_lnum_t jj = 0;
+      if (ii > -1) {
+        const cs_lnum_t n_r_cols = row_index[ii+1] - row_index[ii];
+        for (jj = 0; jj < n_r_cols; jj++) {
+          ms->col_id[s_id + jj*c_size + kk] = col_id[row_index[ii] + jj];
+          ms->entry_id[row_index[ii] + jj] = s_id + jj*c_size + kk;
+        }
+      }
+      const cs_lnum_t p_id = (ii > -1) ? ii : 0;
+      for (; jj < n_cols; jj++)
+        ms->col_id[s_id + jj*c_size + kk] = p_id;
+    }
+  }
+
+  ms->msr = _msr;
+  *msr = NULL;
+
+  return ms;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a SELL-C-sigma matrix structure.
+ *
+ * parameters:
+ *   matrix  <->  pointer to SELL matrix structure pointer
  *----------------------------------------------------------------------------*/
 
 static void
-_pre_vector_multiply_sync_x(cs_halo_rotation_t   rotation_mode,
-                            const cs_matrix_t   *matrix,
-                            cs_real_t            x[restrict])
+_destroy_struct_sell(cs_matrix_struct_sell_t  **matrix)
 {
-  assert(matrix->halo != NULL);
+  if (matrix != NULL && *matrix !=NULL) {
 
-  /* Non-blocked version */
+    cs_matrix_struct_sell_t  *ms = *matrix;
 
-  if (matrix->db_size[3] == 1) {
+    BFT_FREE(ms->chunk_index);
+    BFT_FREE(ms->row_id);
+    BFT_FREE(ms->col_id);
+    BFT_FREE(ms->entry_id);
 
-    if (matrix->halo != NULL)
-      cs_halo_sync_component(matrix->halo,
-                             CS_HALO_STANDARD,
-                             rotation_mode,
-                             x);
+    _destroy_struct_csr(&(ms->msr));
+
+    BFT_FREE(ms);
+
+    *matrix = ms;
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Ensure allocation of SELL matrix extradiagonal coefficients, and set
+ * them to zero (including padding).
+ *
+ * parameters:
+ *   matrix    <-> pointer to matrix structure
+ *   e_stride  <-- extradiagonal block stride
+ *----------------------------------------------------------------------------*/
+
+static void
+_zero_x_coeffs_sell(cs_matrix_t  *matrix,
+                    cs_lnum_t     e_stride)
+{
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+
+  if (mc->_x_val == NULL || mc->max_eb_size < e_stride) {
+    BFT_REALLOC(mc->_x_val,
+                e_stride*ms->chunk_index[ms->n_chunks],
+                cs_real_t);
+    mc->max_eb_size = e_stride;
+  }
+  mc->x_val = mc->_x_val;
+
+  /* Use the same threading behavior as SpMV for NUMA performance */
+
+# pragma omp parallel for  if(ms->n_chunks*CS_MATRIX_SELL_C > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < ms->n_chunks; c_id++) {
+    const cs_lnum_t s_id = ms->chunk_index[c_id]*e_stride;
+    const cs_lnum_t e_id = ms->chunk_index[c_id+1]*e_stride;
+    for (cs_lnum_t jj = s_id; jj < e_id; jj++)
+      mc->_x_val[jj] = 0.0;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Set SELL matrix extradiagonal coefficients from values in MSR order.
+ *
+ * parameters:
+ *   matrix  <-> pointer to matrix structure
+ *   x_vals  <-- extradiagonal values in MSR order (NULL if all zero)
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_xa_coeffs_sell_from_msr(cs_matrix_t      *matrix,
+                             const cs_real_t  *restrict x_vals)
+{
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+  const cs_lnum_t *restrict row_index = ms->msr->row_index;
+  const cs_lnum_t n_rows = ms->n_rows;
+  const cs_lnum_t e_stride = matrix->eb_size[3];
+
+  _zero_x_coeffs_sell(matrix, e_stride);
+
+  if (x_vals == NULL)
+    return;
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    for (cs_lnum_t jj = row_index[ii]; jj < row_index[ii+1]; jj++) {
+      cs_real_t *m_val = mc->_x_val + ms->entry_id[jj]*e_stride;
+      for (cs_lnum_t kk = 0; kk < e_stride; kk++)
+        m_val[kk] = x_vals[jj*e_stride + kk];
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Set SELL matrix coefficients.
+ *
+ * Extradiagonal values are first assembled in MSR order, using the
+ * matching MSR structure, then reordered.
+ *
+ * parameters:
+ *   matrix      <-> pointer to matrix structure
+ *   symmetric   <-- indicates if extradiagonal values are symmetric
+ *   copy        <-- indicates if coefficients should be copied
+ *   n_edges     <-- local number of graph edges
+ *   edges       <-- edges (symmetric row <-> column) connectivity
+ *   da          <-- diagonal values (NULL if all zero)
+ *   xa          <-- extradiagonal values (NULL if all zero)
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_coeffs_sell(cs_matrix_t         *matrix,
+                 bool                 symmetric,
+                 bool                 copy,
+                 cs_lnum_t            n_edges,
+                 const cs_lnum_2_t  *restrict edges,
+                 const cs_real_t    *restrict da,
+                 const cs_real_t    *restrict xa)
+{
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+
+  /* Map or copy diagonal values */
+
+  _map_or_copy_da_coeffs_msr(matrix, copy, da);
+
+  /* Extradiagonal values */
+
+  if (xa == NULL) {
+    _zero_x_coeffs_sell(matrix, matrix->eb_size[3]);
+    return;
+  }
+
+  cs_matrix_t  m_msr;
+  memcpy(&m_msr, matrix, sizeof(cs_matrix_t));
+
+  m_msr.type = CS_MATRIX_MSR;
+  m_msr.structure = ms->msr;
+  m_msr.coeffs = _create_coeff_msr();
+
+  _set_coeffs_msr(&m_msr, symmetric, false, n_edges, edges, NULL, xa);
+
+  cs_matrix_coeff_msr_t  *mc_msr = m_msr.coeffs;
+
+  _set_xa_coeffs_sell_from_msr(matrix, mc_msr->x_val);
+
+  _destroy_coeff_msr(&mc_msr);
+}
+
+/*----------------------------------------------------------------------------
+ * Set SELL matrix coefficients provided in MSR form.
+ *
+ * If da and xa are equal to NULL, then initialize val with zeros.
+ *
+ * parameters:
+ *   matrix           <-> pointer to matrix structure
+ *   copy             <-- indicates if coefficients should be copied
+ *                        when not transferred
+ *   row_index        <-- MSR row index (0 to n-1)
+ *   col_id           <-- MSR column id (0 to n-1)
+ *   d_vals           <-- diagonal values (NULL if all zero)
+ *   d_vals_transfer  <-- diagonal values whose ownership is transferred
+ *                        (NULL or d_vals in, NULL out)
+ *   x_vals           <-- extradiagonal values (NULL if all zero)
+ *   x_vals_transfer  <-- extradiagonal values whose ownership is transferred
+ *                        (NULL or x_vals in, NULL out)
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_coeffs_sell_from_msr(cs_matrix_t       *matrix,
+                          bool               copy,
+                          const cs_lnum_t    row_index[],
+                          const cs_lnum_t    col_id[],
+                          const cs_real_t   *d_vals,
+                          cs_real_t        **d_vals_transfer,
+                          const cs_real_t   *x_vals,
+                          cs_real_t        **x_vals_transfer)
+{
+  CS_UNUSED(row_index);
+  CS_UNUSED(col_id);
+
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  /* Diagonal values are handled as for MSR */
+
+  bool d_transferred = false;
+
+  if (d_vals_transfer != NULL) {
+    if (*d_vals_transfer != NULL) {
+      mc->max_db_size = matrix->db_size[3];
+      if (mc->_d_val != *d_vals_transfer) {
+        BFT_FREE(mc->_d_val);
+        mc->_d_val = *d_vals_transfer;
+      }
+      mc->d_val = mc->_d_val;
+      *d_vals_transfer = NULL;
+      d_transferred = true;
+    }
+  }
+
+  if (d_transferred == false)
+    _map_or_copy_da_coeffs_msr(matrix, copy, d_vals);
+
+  /* Extradiagonal values are always reordered */
+
+  _set_xa_coeffs_sell_from_msr(matrix, x_vals);
+
+  /* Now free transferred arrays */
+
+  if (d_vals_transfer != NULL)
+    BFT_FREE(*d_vals_transfer);
+  if (x_vals_transfer != NULL)
+    BFT_FREE(*x_vals_transfer);
+}
+
+/*----------------------------------------------------------------------------
+ * Initialize coefficients of a SELL matrix assembled using a matrix
+ * assembler.
+ *
+ * parameters:
+ *   matrix_p  <-> untyped pointer to matrix description structure
+ *   db_size   <-- optional diagonal block sizes
+ *   eb_size   <-- optional extra-diagonal block sizes
+ *----------------------------------------------------------------------------*/
+
+static void
+_sell_assembler_values_init(void              *matrix_p,
+                            const cs_lnum_t    db_size[4],
+                            const cs_lnum_t    eb_size[4])
+{
+  cs_matrix_t  *matrix = (cs_matrix_t *)matrix_p;
+
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_lnum_t n_rows = matrix->n_rows;
+
+  cs_lnum_t d_stride = 1;
+  if (db_size != NULL)
+    d_stride = db_size[3];
+  cs_lnum_t e_stride = 1;
+  if (eb_size != NULL)
+    e_stride = eb_size[3];
+
+  /* Initialize diagonal values */
+
+  BFT_REALLOC(mc->_d_val, d_stride*n_rows, cs_real_t);
+  mc->d_val = mc->_d_val;
+  mc->max_db_size = d_stride;
+
+# pragma omp parallel for  if(n_rows*d_stride > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows*d_stride; ii++)
+    mc->_d_val[ii] = 0;
+
+  /* Initialize extradiagonal values */
+
+  _zero_x_coeffs_sell(matrix, e_stride);
+}
+
+/*----------------------------------------------------------------------------
+ * Add to SELL matrix coefficients using local row ids and column indexes.
+ *
+ * Values whose associated row index is negative should be ignored;
+ * Values whose column index is -1 are assumed to be assigned to a
+ * separately stored diagonal. Other indexes should be valid.
+ *
+ * parameters:
+ *   matrix_p  <-> untyped pointer to matrix description structure
+ *   n         <-- number of values to add
+ *   stride    <-- associated data block size
+ *   row_id    <-- associated local row ids
+ *   col_idx   <-- associated local column indexes (in MSR rows)
+ *   vals      <-- pointer to values (size: n*stride)
+ *----------------------------------------------------------------------------*/
+
+static void
+_sell_assembler_values_add(void             *matrix_p,
+                           cs_lnum_t         n,
+                           cs_lnum_t         stride,
+                           const cs_lnum_t   row_id[],
+                           const cs_lnum_t   col_idx[],
+                           const cs_real_t   vals[])
+{
+  cs_matrix_t  *matrix = (cs_matrix_t *)matrix_p;
+
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+  const cs_lnum_t *restrict row_index = ms->msr->row_index;
+
+# pragma omp parallel for  if(n*stride > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n; ii++) {
+    cs_lnum_t r_id = row_id[ii];
+    if (r_id < 0)
+      continue;
+    cs_real_t *m_val;
+    if (col_idx[ii] < 0)
+      m_val = mc->_d_val + r_id*stride;
+    else
+      m_val = mc->_x_val + ms->entry_id[row_index[r_id] + col_idx[ii]]*stride;
+    for (cs_lnum_t jj = 0; jj < stride; jj++) {
+#     pragma omp atomic
+      m_val[jj] += vals[ii*stride + jj];
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x for a range of chunks of a
+ * SELL matrix.
+ *
+ * parameters:
+ *   s_id   <-- id of first chunk handled
+ *   e_id   <-- id of past-the-end chunk handled
+ *   d_val  <-- diagonal matrix coefficients, or NULL if excluded
+ *   ms     <-- pointer to matrix structure
+ *   mc     <-- pointer to matrix coefficients
+ *   x      <-- multipliying vector values
+ *   y      --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_sell_chunks_p(cs_lnum_t                        s_id,
+               cs_lnum_t                        e_id,
+               const cs_real_t                 *restrict d_val,
+               const cs_matrix_struct_sell_t   *ms,
+               const cs_matrix_coeff_msr_t     *mc,
+               const cs_real_t                 *restrict x,
+               cs_real_t                       *restrict y)
+{
+# pragma omp parallel for  if((e_id - s_id)*CS_MATRIX_SELL_C > CS_THR_MIN)
+  for (cs_lnum_t c_id = s_id; c_id < e_id; c_id++) {
+
+    const cs_lnum_t *restrict r_id = ms->row_id + c_id*CS_MATRIX_SELL_C;
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->chunk_index[c_id];
+    const cs_real_t *restrict m_chunk = mc->x_val + ms->chunk_index[c_id];
+    const cs_lnum_t n_cols
+      = (ms->chunk_index[c_id+1] - ms->chunk_index[c_id]) / CS_MATRIX_SELL_C;
+
+    cs_real_t s[CS_MATRIX_SELL_C];
+
+    for (cs_lnum_t kk = 0; kk < CS_MATRIX_SELL_C; kk++)
+      s[kk] = 0.;
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+      const cs_lnum_t *restrict c_j = col_id + jj*CS_MATRIX_SELL_C;
+      const cs_real_t *restrict m_j = m_chunk + jj*CS_MATRIX_SELL_C;
+#     if defined(HAVE_OPENMP_SIMD)
+#       pragma omp simd
+#     endif
+      for (cs_lnum_t kk = 0; kk < CS_MATRIX_SELL_C; kk++)
+        s[kk] += m_j[kk] * x[c_j[kk]];
+    }
+
+    if (d_val != NULL) {
+      for (cs_lnum_t kk = 0; kk < CS_MATRIX_SELL_C; kk++) {
+        const cs_lnum_t ii = r_id[kk];
+        if (ii > -1)
+          y[ii] = d_val[ii]*x[ii] + s[kk];
+      }
+    }
+    else {
+      for (cs_lnum_t kk = 0; kk < CS_MATRIX_SELL_C; kk++) {
+        const cs_lnum_t ii = r_id[kk];
+        if (ii > -1)
+          y[ii] = s[kk];
+      }
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x for a range of chunks of a
+ * block SELL matrix (generic block size).
+ *
+ * parameters:
+ *   s_id     <-- id of first chunk handled
+ *   e_id     <-- id of past-the-end chunk handled
+ *   db_size  <-- block sizes for diagonal
+ *   d_val    <-- diagonal matrix coefficients, or NULL if excluded
+ *   ms       <-- pointer to matrix structure
+ *   mc       <-- pointer to matrix coefficients
+ *   x        <-- multipliying vector values
+ *   y        --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_sell_chunks_p_generic(cs_lnum_t                        s_id,
+                         cs_lnum_t                        e_id,
+                         const cs_lnum_t                  db_size[4],
+                         const cs_real_t                 *restrict d_val,
+                         const cs_matrix_struct_sell_t   *ms,
+                         const cs_matrix_coeff_msr_t     *mc,
+                         const cs_real_t                 *restrict x,
+                         cs_real_t                       *restrict y)
+{
+# pragma omp parallel for  if((e_id - s_id)*CS_MATRIX_SELL_C > CS_THR_MIN)
+  for (cs_lnum_t c_id = s_id; c_id < e_id; c_id++) {
+
+    const cs_lnum_t *restrict r_id = ms->row_id + c_id*CS_MATRIX_SELL_C;
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->chunk_index[c_id];
+    const cs_real_t *restrict m_chunk = mc->x_val + ms->chunk_index[c_id];
+    const cs_lnum_t n_cols
+      = (ms->chunk_index[c_id+1] - ms->chunk_index[c_id]) / CS_MATRIX_SELL_C;
+
+    for (cs_lnum_t kk = 0; kk < CS_MATRIX_SELL_C; kk++) {
+      const cs_lnum_t ii = r_id[kk];
+      if (ii < 0)
+        continue;
+      if (d_val != NULL)
+        _dense_b_ax(ii, db_size, d_val, x, y);
+      else {
+        for (cs_lnum_t ll = 0; ll < db_size[0]; ll++)
+          y[ii*db_size[1] + ll] = 0.;
+      }
+    }
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+      const cs_lnum_t *restrict c_j = col_id + jj*CS_MATRIX_SELL_C;
+      const cs_real_t *restrict m_j = m_chunk + jj*CS_MATRIX_SELL_C;
+      for (cs_lnum_t kk = 0; kk < CS_MATRIX_SELL_C; kk++) {
+        const cs_lnum_t ii = r_id[kk];
+        if (ii < 0)
+          continue;
+        for (cs_lnum_t ll = 0; ll < db_size[0]; ll++)
+          y[ii*db_size[1] + ll] += m_j[kk] * x[c_j[kk]*db_size[1] + ll];
+      }
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x for a range of chunks of a
+ * 3x3 block SELL matrix.
+ *
+ * parameters:
+ *   s_id     <-- id of first chunk handled
+ *   e_id     <-- id of past-the-end chunk handled
+ *   d_val    <-- diagonal matrix coefficients, or NULL if excluded
+ *   ms       <-- pointer to matrix structure
+ *   mc       <-- pointer to matrix coefficients
+ *   x        <-- multipliying vector values
+ *   y        --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_3_3_sell_chunks_p(cs_lnum_t                        s_id,
+                   cs_lnum_t                        e_id,
+                   const cs_real_t                 *restrict d_val,
+                   const cs_matrix_struct_sell_t   *ms,
+                   const cs_matrix_coeff_msr_t     *mc,
+                   const cs_real_t                 *restrict x,
+                   cs_real_t                       *restrict y)
+{
+# pragma omp parallel for  if((e_id - s_id)*CS_MATRIX_SELL_C > CS_THR_MIN)
+  for (cs_lnum_t c_id = s_id; c_id < e_id; c_id++) {
+
+    const cs_lnum_t *restrict r_id = ms->row_id + c_id*CS_MATRIX_SELL_C;
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->chunk_index[c_id];
+    const cs_real_t *restrict m_chunk = mc->x_val + ms->chunk_index[c_id];
+    const cs_lnum_t n_cols
+      = (ms->chunk_index[c_id+1] - ms->chunk_index[c_id]) / CS_MATRIX_SELL_C;
+
+    cs_real_t s[3][CS_MATRIX_SELL_C];
+
+    for (cs_lnum_t kk = 0; kk < CS_MATRIX_SELL_C; kk++) {
+      s[0][kk] = 0.;
+      s[1][kk] = 0.;
+      s[2][kk] = 0.;
+    }
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+      const cs_lnum_t *restrict c_j = col_id + jj*CS_MATRIX_SELL_C;
+      const cs_real_t *restrict m_j = m_chunk + jj*CS_MATRIX_SELL_C;
+#     if defined(HAVE_OPENMP_SIMD)
+#       pragma omp simd
+#     endif
+      for (cs_lnum_t kk = 0; kk < CS_MATRIX_SELL_C; kk++) {
+        const cs_real_t *restrict _x = x + c_j[kk]*3;
+        s[0][kk] += m_j[kk] * _x[0];
+        s[1][kk] += m_j[kk] * _x[1];
+        s[2][kk] += m_j[kk] * _x[2];
+      }
+    }
+
+    for (cs_lnum_t kk = 0; kk < CS_MATRIX_SELL_C; kk++) {
+      const cs_lnum_t ii = r_id[kk];
+      if (ii < 0)
+        continue;
+      if (d_val != NULL)
+        _dense_3_3_ax(ii, d_val, x, y);
+      else {
+        y[ii*3] = 0.;
+        y[ii*3 + 1] = 0.;
+        y[ii*3 + 2] = 0.;
+      }
+      y[ii*3]     += s[0][kk];
+      y[ii*3 + 1] += s[1][kk];
+      y[ii*3 + 2] += s[2][kk];
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x for a range of chunks of a
+ * 6x6 block SELL matrix.
+ *
+ * parameters:
+ *   s_id     <-- id of first chunk handled
+ *   e_id     <-- id of past-the-end chunk handled
+ *   d_val    <-- diagonal matrix coefficients, or NULL if excluded
+ *   ms       <-- pointer to matrix structure
+ *   mc       <-- pointer to matrix coefficients
+ *   x        <-- multipliying vector values
+ *   y        --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_6_6_sell_chunks_p(cs_lnum_t                        s_id,
+                   cs_lnum_t                        e_id,
+                   const cs_real_t                 *restrict d_val,
+                   const cs_matrix_struct_sell_t   *ms,
+                   const cs_matrix_coeff_msr_t     *mc,
+                   const cs_real_t                 *restrict x,
+                   cs_real_t                       *restrict y)
+{
+# pragma omp parallel for  if((e_id - s_id)*CS_MATRIX_SELL_C > CS_THR_MIN)
+  for (cs_lnum_t c_id = s_id; c_id < e_id; c_id++) {
+
+    const cs_lnum_t *restrict r_id = ms->row_id + c_id*CS_MATRIX_SELL_C;
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->chunk_index[c_id];
+    const cs_real_t *restrict m_chunk = mc->x_val + ms->chunk_index[c_id];
+    const cs_lnum_t n_cols
+      = (ms->chunk_index[c_id+1] - ms->chunk_index[c_id]) / CS_MATRIX_SELL_C;
+
+    cs_real_t s[6][CS_MATRIX_SELL_C];
+
+    for (cs_lnum_t kk = 0; kk < CS_MATRIX_SELL_C; kk++) {
+      for (cs_lnum_t ll = 0; ll < 6; ll++)
+        s[ll][kk] = 0.;
+    }
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+      const cs_lnum_t *restrict c_j = col_id + jj*CS_MATRIX_SELL_C;
+      const cs_real_t *restrict m_j = m_chunk + jj*CS_MATRIX_SELL_C;
+#     if defined(HAVE_OPENMP_SIMD)
+#       pragma omp simd
+#     endif
+      for (cs_lnum_t kk = 0; kk < CS_MATRIX_SELL_C; kk++) {
+        const cs_real_t *restrict _x = x + c_j[kk]*6;
+        s[0][kk] += m_j[kk] * _x[0];
+        s[1][kk] += m_j[kk] * _x[1];
+        s[2][kk] += m_j[kk] * _x[2];
+        s[3][kk] += m_j[kk] * _x[3];
+        s[4][kk] += m_j[kk] * _x[4];
+        s[5][kk] += m_j[kk] * _x[5];
+      }
+    }
+
+    for (cs_lnum_t kk = 0; kk < CS_MATRIX_SELL_C; kk++) {
+      const cs_lnum_t ii = r_id[kk];
+      if (ii < 0)
+        continue;
+      if (d_val != NULL)
+        _dense_6_6_ax(ii, d_val, x, y);
+      else {
+        for (cs_lnum_t ll = 0; ll < 6; ll++)
+          y[ii*6 + ll] = 0.;
+      }
+      for (cs_lnum_t ll = 0; ll < 6; ll++)
+        y[ii*6 + ll] += s[ll][kk];
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x for a range of chunks of a
+ * block SELL matrix.
+ *
+ * parameters:
+ *   s_id     <-- id of first chunk handled
+ *   e_id     <-- id of past-the-end chunk handled
+ *   db_size  <-- block sizes for diagonal
+ *   d_val    <-- diagonal matrix coefficients, or NULL if excluded
+ *   ms       <-- pointer to matrix structure
+ *   mc       <-- pointer to matrix coefficients
+ *   x        <-- multipliying vector values
+ *   y        --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_sell_chunks_p(cs_lnum_t                        s_id,
+                 cs_lnum_t                        e_id,
+                 const cs_lnum_t                  db_size[4],
+                 const cs_real_t                 *restrict d_val,
+                 const cs_matrix_struct_sell_t   *ms,
+                 const cs_matrix_coeff_msr_t     *mc,
+                 const cs_real_t                 *restrict x,
+                 cs_real_t                       *restrict y)
+{
+  if (db_size[0] == 3 && db_size[3] == 9)
+    _3_3_sell_chunks_p(s_id, e_id, d_val, ms, mc, x, y);
+
+  else if (db_size[0] == 6 && db_size[3] == 36)
+    _6_6_sell_chunks_p(s_id, e_id, d_val, ms, mc, x, y);
+
+  else
+    _b_sell_chunks_p_generic(s_id, e_id, db_size, d_val, ms, mc, x, y);
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with SELL matrix.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-> multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_sell(bool                exclude_diag,
+                  bool                sync,
+                  const cs_matrix_t  *matrix,
+                  cs_real_t          *restrict x,
+                  cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
 
-  }
+  const cs_real_t *restrict d_val = (exclude_diag) ? NULL : mc->d_val;
 
-  /* Blocked version */
+  /* Initialize ghost values exchange; chunks referencing ghost columns
+     are handled once it is complete */
 
-  else { /* if (matrix->db_size[3] > 1) */
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
 
-    const cs_lnum_t *db_size = matrix->db_size;
+  _sell_chunks_p(0, ms->n_l_chunks, d_val, ms, mc, x, y);
 
-    /* Update distant ghost rows */
+  if (hs != NULL)
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
 
-    if (matrix->halo != NULL) {
+  _sell_chunks_p(ms->n_l_chunks, ms->n_chunks, d_val, ms, mc, x, y);
+}
 
-      cs_halo_sync_var_strided(matrix->halo,
-                               CS_HALO_STANDARD,
-                               x,
-                               db_size[1]);
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with block diagonal SELL matrix.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-> multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
 
-      /* Synchronize periodic values */
+static void
+_b_mat_vec_p_l_sell(bool                exclude_diag,
+                    bool                sync,
+                    const cs_matrix_t  *matrix,
+                    cs_real_t          *restrict x,
+                    cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const cs_lnum_t  *db_size = matrix->db_size;
 
-#if !defined(_CS_UNIT_MATRIX_TEST) /* unit tests do not link with full library */
+  const cs_real_t *restrict d_val = (exclude_diag) ? NULL : mc->d_val;
 
-      if (matrix->halo->n_transforms > 0) {
-        if (db_size[0] == 3)
-          cs_halo_perio_sync_var_vect(matrix->halo,
-                                      CS_HALO_STANDARD,
-                                      x,
-                                      db_size[1]);
-        else if (db_size[0] == 6)
-          cs_halo_perio_sync_var_sym_tens(matrix->halo,
-                                          CS_HALO_STANDARD,
-                                          x);
-      }
+  /* Initialize ghost values exchange; chunks referencing ghost columns
+     are handled once it is complete */
 
-#endif
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
 
-    }
+  _b_sell_chunks_p(0, ms->n_l_chunks, db_size, d_val, ms, mc, x, y);
 
-  }
+  if (hs != NULL)
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+
+  _b_sell_chunks_p(ms->n_l_chunks, ms->n_chunks, db_size, d_val, ms, mc, x, y);
 }
 
 /*----------------------------------------------------------------------------
@@ -4274,16 +6234,26 @@ _pre_vector_multiply_sync_y(const cs_matrix_t   *matrix,
 }
 
 /*----------------------------------------------------------------------------
- * Synchronize ghost values prior to matrix.vector product
+ * Prepare ghost values prior to matrix.vector product
+ *
+ * Ghost values of y are zeroed. Whenever possible, synchronization of
+ * x is deferred to the matrix.vector product function, so as to overlap
+ * the halo exchange with computations on local rows. Rotational periodicity
+ * options other than copy require saving or zeroing values around the
+ * exchange, so x is synchronized here in that case.
  *
  * parameters:
  *   rotation_mode <-- halo update option for rotational periodicity
  *   matrix        <-- pointer to matrix structure
  *   x             <-> multipliying vector values (ghost values updated)
  *   y             --> resulting vector
+ *
+ * returns:
+ *   true if ghost values of x remain to be synchronized by the
+ *   matrix.vector product function, false otherwise
  *----------------------------------------------------------------------------*/
 
-static void
+static bool
 _pre_vector_multiply_sync(cs_halo_rotation_t   rotation_mode,
                           const cs_matrix_t   *matrix,
                           cs_real_t           *restrict x,
@@ -4291,7 +6261,14 @@ _pre_vector_multiply_sync(cs_halo_rotation_t   rotation_mode,
 {
   _pre_vector_multiply_sync_y(matrix, y);
 
-  _pre_vector_multiply_sync_x(rotation_mode, matrix, x);
+  if (   matrix->db_size[3] == 1
+      && matrix->halo->n_rotations > 0
+      && rotation_mode != CS_HALO_ROTATION_COPY) {
+    _pre_vector_multiply_sync_x(rotation_mode, matrix, x);
+    return false;
+  }
+
+  return true;
 }
 
 /*----------------------------------------------------------------------------
@@ -4379,6 +6356,10 @@ _variant_add(const char                        *name,
  *     omp_sched       (Improved scheduling for OpenMP)
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *
+ *   CS_MATRIX_SELL    (all fill types except CS_MATRIX_33_BLOCK)
+ *     default
+ *     standard
+ *
  * parameters:
  *   m_type          <-- Matrix type
  *   numbering       <-- mesh numbering type, or NULL
@@ -4633,6 +6614,28 @@ _set_spmv_func(cs_matrix_type_t             m_type,
 
     break;
 
+  case CS_MATRIX_SELL:
+
+    if (standard > 0) {
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+        spmv[0] = _mat_vec_p_l_sell;
+        spmv[1] = _mat_vec_p_l_sell;
+        break;
+      case CS_MATRIX_BLOCK_D:
+      case CS_MATRIX_BLOCK_D_66:
+      case CS_MATRIX_BLOCK_D_SYM:
+        spmv[0] = _b_mat_vec_p_l_sell;
+        spmv[1] = _b_mat_vec_p_l_sell;
+        break;
+      default:
+        break;
+      }
+    }
+
+    break;
+
   default:
     break;
   }
@@ -4750,6 +6753,13 @@ _structure_from_assembler(cs_matrix_type_t        type,
                                               &_col_id);
     }
     break;
+  case CS_MATRIX_SELL:
+    {
+      cs_matrix_struct_csr_t *msr
+        = _structure_from_assembler(CS_MATRIX_MSR, n_rows, n_cols_ext, ma);
+      structure = _create_struct_sell(&msr);
+    }
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("%s: handling of matrices in %s format\n"
@@ -4804,6 +6814,13 @@ _structure_destroy(cs_matrix_type_t   type,
       *structure = _structure;
     }
     break;
+  case CS_MATRIX_SELL:
+    {
+      cs_matrix_struct_sell_t *_structure = *structure;
+      _destroy_struct_sell(&_structure);
+      *structure = _structure;
+    }
+    break;
   default:
     assert(0);
     break;
@@ -4872,6 +6889,7 @@ _matrix_create(cs_matrix_type_t  type)
     m->coeffs = _create_coeff_csr_sym();
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
     m->coeffs = _create_coeff_msr();
     break;
   default:
@@ -4924,6 +6942,12 @@ _matrix_create(cs_matrix_type_t  type)
     m->copy_diagonal = _copy_diagonal_separate;
     break;
 
+  case CS_MATRIX_SELL:
+    m->set_coefficients = _set_coeffs_sell;
+    m->release_coefficients = _release_coeffs_msr;
+    m->copy_diagonal = _copy_diagonal_separate;
+    break;
+
   default:
     assert(0);
     break;
@@ -5023,6 +7047,16 @@ cs_matrix_structure_create(cs_matrix_type_t       type,
                                        n_edges,
                                        edges);
     break;
+  case CS_MATRIX_SELL:
+    {
+      cs_matrix_struct_csr_t *msr = _create_struct_csr(false,
+                                                       n_rows,
+                                                       n_cols_ext,
+                                                       n_edges,
+                                                       edges);
+      ms->structure = _create_struct_sell(&msr);
+    }
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Handling of matrixes in format type %d\n"
@@ -5112,6 +7146,19 @@ cs_matrix_structure_create_msr(cs_matrix_type_t        type,
                                                 row_index,
                                                 col_id);
     break;
+  case CS_MATRIX_SELL:
+    {
+      cs_matrix_struct_csr_t *msr
+        = _create_struct_csr_from_csr(false,
+                                      transfer,
+                                      false,
+                                      n_rows,
+                                      n_cols_ext,
+                                      row_index,
+                                      col_id);
+      ms->structure = _create_struct_sell(&msr);
+    }
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("%s: handling of matrices in %s format\n"
@@ -5376,6 +7423,7 @@ cs_matrix_create_by_copy(cs_matrix_t   *src)
     m->coeffs = _create_coeff_csr_sym();
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
     m->coeffs = _create_coeff_msr();
     break;
   default:
@@ -5504,6 +7552,7 @@ cs_matrix_destroy(cs_matrix_t **matrix)
       }
       break;
     case CS_MATRIX_MSR:
+    case CS_MATRIX_SELL:
       {
         cs_matrix_coeff_msr_t *coeffs = m->coeffs;
         _destroy_coeff_msr(&coeffs);
@@ -5622,6 +7671,12 @@ cs_matrix_get_n_entries(const cs_matrix_t  *matrix)
       retval = ms->row_index[ms->n_rows] + ms->n_rows;
     }
     break;
+  case CS_MATRIX_SELL:
+    {
+      const cs_matrix_struct_sell_t  *ms = matrix->structure;
+      retval = ms->msr->row_index[ms->n_rows] + ms->n_rows;
+    }
+    break;
   default:
     break;
   }
@@ -5880,6 +7935,139 @@ cs_matrix_copy_coefficients(cs_matrix_t        *matrix,
        cs_matrix_fill_type_name[matrix->fill_type]);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set native matrix coefficients, with extra-diagonal terms
+ *        defined by face-based upwind convection/diffusion values
+ *        rather than assembled.
+ *
+ * Extra-diagonal terms are then computed on the fly by matrix.vector
+ * products (matrix-free operation), as:
+ *   \f$ X_{ij} = c_{conv} \dot{m}_{ij}^- - c_{diff} \mu_{ij} \f$ and
+ *   \f$ X_{ji} = -c_{conv} \dot{m}_{ij}^+ - c_{diff} \mu_{ij} \f$,
+ * which matches the terms built by \ref cs_matrix_wrapper_vector and
+ * \ref cs_matrix_wrapper_tensor with scalar diffusion (and no discontinuous
+ * porosity model).
+ *
+ * Only native matrices with scalar extra-diagonal terms are handled.
+ * If the extra-diagonal coefficients are requested later (for example
+ * to build coarse multigrid levels), they are built and kept until the
+ * matrix coefficients are released.
+ *
+ * Arrays are mapped, not copied, so they must remain available until
+ * the coefficients are released.
+ *
+ * \param[in, out]  matrix           pointer to matrix structure
+ * \param[in]       symmetric        indicates if matrix coefficients
+ *                                   are symmetric
+ * \param[in]       diag_block_size  block sizes for diagonal, or NULL
+ * \param[in]       da               diagonal values (NULL if zero)
+ * \param[in]       conv_coeff       mass flux factor (theta.iconv)
+ * \param[in]       diff_coeff       viscosity factor (theta.idiff)
+ * \param[in]       i_massflux       interior faces mass flux
+ *                                   (ignored if symmetric)
+ * \param[in]       i_visc           interior faces viscosity
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_coefficients_from_faces(cs_matrix_t        *matrix,
+                                      bool                symmetric,
+                                      const cs_lnum_t    *diag_block_size,
+                                      const cs_real_t    *da,
+                                      double              conv_coeff,
+                                      double              diff_coeff,
+                                      const cs_real_t    *i_massflux,
+                                      const cs_real_t    *i_visc)
+{
+  if (matrix == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("The matrix is not defined."));
+
+  if (matrix->type != CS_MATRIX_NATIVE)
+    bft_error
+      (__FILE__, __LINE__, 0,
+       _("%s is only available for native matrices\n"
+         "(here, format %s)."),
+       __func__, cs_matrix_type_name[matrix->type]);
+
+  const cs_matrix_struct_native_t  *ms = matrix->structure;
+
+  cs_matrix_set_coefficients(matrix,
+                             symmetric,
+                             diag_block_size,
+                             NULL,
+                             ms->n_edges,
+                             ms->edges,
+                             da,
+                             NULL);
+
+  cs_matrix_coeff_native_t  *mc = matrix->coeffs;
+
+  mc->xa = NULL;
+
+  mc->conv_coeff = (symmetric) ? 0 : conv_coeff;
+  mc->diff_coeff = diff_coeff;
+  mc->i_massflux = (symmetric) ? NULL : i_massflux;
+  mc->i_visc = i_visc;
+
+  /* Switch to matching matrix.vector product functions */
+
+  mc->fill_type_mf = matrix->fill_type;
+
+  for (int ed_flag = 0; ed_flag < 2; ed_flag++) {
+    mc->vector_multiply_d[ed_flag]
+      = matrix->vector_multiply[matrix->fill_type][ed_flag];
+    matrix->vector_multiply[matrix->fill_type][ed_flag]
+      = _b_mat_vec_p_l_native_mf;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute native extra-diagonal coefficients from face-based
+ *        upwind convection/diffusion values.
+ *
+ * See \ref cs_matrix_set_coefficients_from_faces for the definition
+ * of these coefficients.
+ *
+ * \param[in]   symmetric   indicates if matrix coefficients are symmetric
+ * \param[in]   n_edges     local number of graph edges (interior faces)
+ * \param[in]   conv_coeff  mass flux factor (theta.iconv)
+ * \param[in]   diff_coeff  viscosity factor (theta.idiff)
+ * \param[in]   i_massflux  interior faces mass flux, or NULL
+ * \param[in]   i_visc      interior faces viscosity
+ * \param[out]  xa          extradiagonal values, cast as:
+ *                          xa[n_edges]    if symmetric,
+ *                          xa[n_edges][2] if non symmetric
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_extra_diagonal_from_faces(bool             symmetric,
+                                    cs_lnum_t        n_edges,
+                                    double           conv_coeff,
+                                    double           diff_coeff,
+                                    const cs_real_t  i_massflux[],
+                                    const cs_real_t  i_visc[],
+                                    cs_real_t        xa[])
+{
+  if (symmetric) {
+#   pragma omp parallel for  if(n_edges > CS_THR_MIN)
+    for (cs_lnum_t face_id = 0; face_id < n_edges; face_id++)
+      xa[face_id] = - diff_coeff*i_visc[face_id];
+  }
+  else {
+    const double c_coeff = (i_massflux != NULL) ? 0.5*conv_coeff : 0;
+#   pragma omp parallel for  if(n_edges > CS_THR_MIN)
+    for (cs_lnum_t face_id = 0; face_id < n_edges; face_id++) {
+      cs_real_t m = (i_massflux != NULL) ? i_massflux[face_id] : 0;
+      xa[face_id*2]     =   c_coeff*(m - fabs(m)) - diff_coeff*i_visc[face_id];
+      xa[face_id*2 + 1] = - c_coeff*(m + fabs(m)) - diff_coeff*i_visc[face_id];
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set matrix coefficients in an MSR format, transfering the
@@ -5955,6 +8143,17 @@ cs_matrix_transfer_coefficients_msr(cs_matrix_t         *matrix,
                              x_val);
     break;
 
+  case CS_MATRIX_SELL:
+    _set_coeffs_sell_from_msr(matrix,
+                              false, /* ignored in case of transfer */
+                              row_index,
+                              col_id,
+                              d_val_p,
+                              d_val,
+                              x_val_p,
+                              x_val);
+    break;
+
   default:
     bft_error
       (__FILE__, __LINE__, 0,
@@ -6064,6 +8263,18 @@ cs_matrix_assembler_values_init(cs_matrix_t      *matrix,
                                             NULL,
                                             NULL);
     break;
+  case CS_MATRIX_SELL:
+    mav = cs_matrix_assembler_values_create(matrix->assembler,
+                                            true,
+                                            diag_block_size,
+                                            extra_diag_block_size,
+                                            (void *)matrix,
+                                            _sell_assembler_values_init,
+                                            _sell_assembler_values_add,
+                                            NULL,
+                                            NULL,
+                                            NULL);
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("%s: handling of matrices in %s format\n"
@@ -6141,6 +8352,12 @@ cs_matrix_is_mapped_from_native(const cs_matrix_t  *matrix)
   if (matrix->xa != NULL)
     retval = true;
 
+  else if (matrix->type == CS_MATRIX_NATIVE) {
+    const cs_matrix_coeff_native_t  *mc = matrix->coeffs;
+    if (mc != NULL && mc->i_visc != NULL)
+      retval = true;
+  }
+
   return retval;
 }
 
@@ -6213,6 +8430,7 @@ cs_matrix_get_diagonal(const cs_matrix_t  *matrix)
     break;
 
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
     {
       cs_matrix_coeff_msr_t *mc = matrix->coeffs;
       if (mc->d_val == NULL) {
@@ -6246,7 +8464,9 @@ cs_matrix_get_diagonal(const cs_matrix_t  *matrix)
  *
  * This function only functions if the coefficients were mapped from native
  * coefficients using cs_matrix_set_coefficients(), in which case the pointer
- * returned is the same as the one passed to that function.
+ * returned is the same as the one passed to that function, or defined
+ * using cs_matrix_set_coefficients_from_faces(), in which case they are
+ * built on demand.
  *
  * It is used in the current multgrid code, but should be removed as soon
  * as the dependency to the native format is removed.
@@ -6260,7 +8480,10 @@ cs_matrix_get_diagonal(const cs_matrix_t  *matrix)
 const cs_real_t *
 cs_matrix_get_extra_diagonal(const cs_matrix_t  *matrix)
 {
-  const cs_real_t  *exdiag = NULL;
+  const cs_real_t  *exdiag = _build_xa_face_def_native(matrix);
+
+  if (exdiag != NULL)
+    return exdiag;
 
   if (matrix->xa == NULL)
     bft_error
@@ -6492,7 +8715,8 @@ cs_matrix_get_native_arrays(const cs_matrix_t   *matrix,
       if (d_val != NULL)
         *d_val = mc->da;
       if (x_val != NULL)
-        *x_val = mc->xa;
+        *x_val = (mc->i_visc != NULL) ?
+          _build_xa_face_def_native(matrix) : mc->xa;
     }
   }
 }
@@ -6550,6 +8774,10 @@ cs_matrix_get_csr_arrays(const cs_matrix_t   *matrix,
  * Matrix block sizes can be obtained by cs_matrix_get_diag_block_size()
  * and cs_matrix_get_extra_diag_block_size().
  *
+ * If extra-diagonal values are stored in single precision
+ * (see \ref cs_matrix_msr_convert_extra_diag_to_float), they may not
+ * be accessed through this function, so requesting x_val is an error.
+ *
  * \param[in]   matrix     pointer to matrix structure
  * \param[out]  row_index  MSR row index
  * \param[out]  col_id     MSR column id
@@ -6584,8 +8812,15 @@ cs_matrix_get_msr_arrays(const cs_matrix_t   *matrix,
     if (mc != NULL) {
       if (d_val != NULL)
         *d_val = mc->d_val;
-      if (x_val != NULL)
+      if (x_val != NULL) {
+        if (mc->_x_val_f != NULL)
+          bft_error
+            (__FILE__, __LINE__, 0,
+             _("%s: extra-diagonal values of this matrix are stored\n"
+               "in single precision, so are not available."),
+             __func__);
         *x_val = mc->x_val;
+      }
     }
   }
   else
@@ -6596,6 +8831,165 @@ cs_matrix_get_msr_arrays(const cs_matrix_t   *matrix,
        cs_matrix_type_name[matrix->type]);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Convert extra-diagonal coefficients of an MSR matrix to
+ *        single precision.
+ *
+ * This reduces the memory traffic of matrix.vector products, whose
+ * results are still accumulated in double precision, and is mainly
+ * intended for coarse multigrid levels.
+ *
+ * Only scalar MSR matrices are handled. Once converted, extra-diagonal
+ * values are not accessible through \ref cs_matrix_get_msr_arrays,
+ * so algorithms requiring them (such as Gauss-Seidel smoothers)
+ * may not be used with this matrix. The conversion is undone when
+ * the coefficients are released or redefined.
+ *
+ * \param[in, out]  matrix  pointer to matrix structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_msr_convert_extra_diag_to_float(cs_matrix_t  *matrix)
+{
+  if (   matrix->type != CS_MATRIX_MSR
+      || (   matrix->fill_type != CS_MATRIX_SCALAR
+          && matrix->fill_type != CS_MATRIX_SCALAR_SYM))
+    bft_error
+      (__FILE__, __LINE__, 0,
+       _("%s is only available for scalar MSR matrices\n"
+         "(here, format %s with fill type %s)."),
+       __func__,
+       cs_matrix_type_name[matrix->type],
+       cs_matrix_fill_type_name[matrix->fill_type]);
+
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  if (mc->_x_val_f != NULL)
+    return;
+
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_real_t  *restrict x_val = mc->x_val;
+
+  BFT_MALLOC(mc->_x_val_f, ms->row_index[n_rows], float);
+
+  float *restrict x_val_f = mc->_x_val_f;
+
+  /* Use the same threading behavior as SpMV for NUMA performance */
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    for (cs_lnum_t jj = ms->row_index[ii]; jj < ms->row_index[ii+1]; jj++)
+      x_val_f[jj] = (x_val != NULL) ? (float)(x_val[jj]) : 0.f;
+  }
+
+  BFT_FREE(mc->_x_val);
+  mc->x_val = NULL;
+
+  /* Switch to matching matrix.vector product functions */
+
+  mc->fill_type_f = matrix->fill_type;
+
+  for (int ed_flag = 0; ed_flag < 2; ed_flag++) {
+    mc->vector_multiply_d[ed_flag]
+      = matrix->vector_multiply[matrix->fill_type][ed_flag];
+    matrix->vector_multiply[matrix->fill_type][ed_flag] = _mat_vec_p_l_msr_f;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Matrix.vector product y = A.x with single-precision vectors.
+ *
+ * This function is only available for scalar MSR matrices whose
+ * extra-diagonal coefficients are stored in single precision
+ * (see \ref cs_matrix_msr_convert_extra_diag_to_float). Row products
+ * are accumulated in double precision.
+ *
+ * This function includes a halo update of x, overlapped with the
+ * computation of rows not referencing ghost values.
+ *
+ * \param[in]       matrix  pointer to matrix structure
+ * \param[in, out]  x       multipliying vector values
+ *                          (ghost values updated)
+ * \param[out]      y       resulting vector
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_vector_multiply_f(const cs_matrix_t  *matrix,
+                            float              *restrict x,
+                            float              *restrict y)
+{
+  assert(matrix != NULL);
+
+  const cs_matrix_coeff_msr_t  *mc
+    = (matrix->type == CS_MATRIX_MSR) ? matrix->coeffs : NULL;
+
+  if (mc == NULL || mc->_x_val_f == NULL)
+    bft_error
+      (__FILE__, __LINE__, 0,
+       _("%s is only available for MSR matrices with single-precision\n"
+         "extra-diagonal coefficients."),
+       __func__);
+
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t  *restrict row_index = ms->row_index;
+  const cs_lnum_t  *restrict col_id = ms->col_id;
+  const float  *restrict x_val = mc->_x_val_f;
+  const cs_real_t  *restrict d_val = mc->d_val;
+
+  /* Initialize ghost values exchange; rows referencing ghost columns
+     are handled once it is complete */
+
+  cs_halo_state_t *hs = NULL;
+
+  if (matrix->halo != NULL) {
+    hs = cs_halo_state_get_default();
+    cs_halo_sync_start(matrix->halo, CS_HALO_STANDARD, CS_FLOAT, 1, x, hs);
+    if (ms->n_halo_rows < 0) {
+      cs_halo_sync_wait(matrix->halo, x, hs);
+      hs = NULL;
+    }
+  }
+
+  const cs_lnum_t n_l_cols = (hs != NULL) ? n_rows : ms->n_cols_ext;
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    const cs_lnum_t e_id = row_index[ii+1];
+    if (e_id > row_index[ii] && col_id[e_id-1] >= n_l_cols)
+      continue;
+    double sii = (d_val != NULL) ? d_val[ii]*x[ii] : 0.;
+    for (cs_lnum_t jj = row_index[ii]; jj < e_id; jj++)
+      sii += ((double)x_val[jj]*x[col_id[jj]]);
+    y[ii] = sii;
+  }
+
+  /* Complete ghost values exchange, then handle rows referencing
+     ghost columns */
+
+  if (hs != NULL) {
+
+    cs_halo_sync_wait(matrix->halo, x, hs);
+
+    const cs_lnum_t n_halo_rows = ms->n_halo_rows;
+
+#   pragma omp parallel for  if(n_halo_rows > CS_THR_MIN)
+    for (cs_lnum_t r_id = 0; r_id < n_halo_rows; r_id++) {
+      cs_lnum_t ii = ms->halo_row_id[r_id];
+      double sii = (d_val != NULL) ? d_val[ii]*x[ii] : 0.;
+      for (cs_lnum_t jj = row_index[ii]; jj < row_index[ii+1]; jj++)
+        sii += ((double)x_val[jj]*x[col_id[jj]]);
+      y[ii] = sii;
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Matrix.vector product y = A.x
@@ -6619,14 +9013,16 @@ cs_matrix_vector_multiply(cs_halo_rotation_t   rotation_mode,
 {
   assert(matrix != NULL);
 
+  bool sync = false;
+
   if (matrix->halo != NULL)
-    _pre_vector_multiply_sync(rotation_mode,
-                              matrix,
-                              x,
-                              y);
+    sync = _pre_vector_multiply_sync(rotation_mode,
+                                     matrix,
+                                     x,
+                                     y);
 
   if (matrix->vector_multiply[matrix->fill_type][0] != NULL)
-    matrix->vector_multiply[matrix->fill_type][0](false, matrix, x, y);
+    matrix->vector_multiply[matrix->fill_type][0](false, sync, matrix, x, y);
 
   else
     bft_error
@@ -6644,21 +9040,25 @@ cs_matrix_vector_multiply(cs_halo_rotation_t   rotation_mode,
  * be up to date (in which case we avoid the performance penalty of a
  * redundant update by using this variant of the matrix.vector product).
  *
- * \param[in]   matrix         pointer to matrix structure
- * \param[in]   x              multipliying vector values
- * \param[out]  y              resulting vector
+ * \param[in]       matrix         pointer to matrix structure
+ * \param[in, out]  x              multipliying vector values
+ * \param[out]      y              resulting vector
  */
 /*----------------------------------------------------------------------------*/
 
 void
 cs_matrix_vector_multiply_nosync(const cs_matrix_t  *matrix,
-                                 const cs_real_t    *x,
+                                 cs_real_t          *restrict x,
                                  cs_real_t          *restrict y)
 {
   assert(matrix != NULL);
 
   if (matrix->vector_multiply[matrix->fill_type][0] != NULL)
-    matrix->vector_multiply[matrix->fill_type][0](false, matrix, x, y);
+    matrix->vector_multiply[matrix->fill_type][0](false,
+                                                  false,
+                                                  matrix,
+                                                  x,
+                                                  y);
 
   else
     bft_error
@@ -6690,14 +9090,16 @@ cs_matrix_exdiag_vector_multiply(cs_halo_rotation_t   rotation_mode,
 {
   assert(matrix != NULL);
 
+  bool sync = false;
+
   if (matrix->halo != NULL)
-    _pre_vector_multiply_sync(rotation_mode,
-                              matrix,
-                              x,
-                              y);
+    sync = _pre_vector_multiply_sync(rotation_mode,
+                                     matrix,
+                                     x,
+                                     y);
 
   if (matrix->vector_multiply[matrix->fill_type][1] != NULL)
-    matrix->vector_multiply[matrix->fill_type][1](true, matrix, x, y);
+    matrix->vector_multiply[matrix->fill_type][1](true, sync, matrix, x, y);
 
   else
     bft_error
@@ -6911,6 +9313,8 @@ cs_matrix_msr_assembler_values_init(void              *matrix_p,
 
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
 
+  _release_x_coeffs_msr_f(matrix);
+
   /* Initialize diagonal values */
 
   BFT_REALLOC(mc->_d_val, d_stride*n_rows, cs_real_t);
@@ -7385,6 +9789,36 @@ cs_matrix_variant_build_list(const cs_matrix_t       *m,
 
   }
 
+  /* No SELL-C-sigma variant is available for CS_MATRIX_BLOCK
+     (so none is added, and it may not be selected) */
+
+  if (m->type == CS_MATRIX_SELL) {
+
+    switch(m->fill_type) {
+    case CS_MATRIX_SCALAR:
+    case CS_MATRIX_SCALAR_SYM:
+      vector_multiply = _mat_vec_p_l_sell;
+      break;
+    case CS_MATRIX_BLOCK_D:
+    case CS_MATRIX_BLOCK_D_66:
+    case CS_MATRIX_BLOCK_D_SYM:
+      vector_multiply = _b_mat_vec_p_l_sell;
+      break;
+    default:
+      vector_multiply = NULL;
+    }
+
+    _variant_add(_("SELL-C-sigma"),
+                 m->type,
+                 m->fill_type,
+                 2, /* ed_flag */
+                 vector_multiply,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+  }
+
   n_variants_max = *n_variants;
   BFT_REALLOC(*m_variant, *n_variants, cs_matrix_variant_t);
 }
@@ -7458,6 +9892,10 @@ cs_matrix_variant_apply(cs_matrix_t          *m,
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *     omp_sched       (For OpenMP with scheduling)
  *
+ *   CS_MATRIX_SELL    (all fill types except CS_MATRIX_33_BLOCK)
+ *     default
+ *     standard
+ *
  * parameters:
  *   mv        <-> Pointer to matrix variant
  *   numbering <-- mesh numbering info, or NULL
@@ -59,6 +59,8 @@ typedef enum {
   CS_MATRIX_CSR_SYM,          /*!< Compressed Symmetric Sparse Row storage */
   CS_MATRIX_MSR,              /*!< Modified Compressed Sparse Row storage
                                 (separate diagonal) */
+  CS_MATRIX_SELL,             /*!< Sliced ELLPACK (SELL-C-sigma) storage
+                                (separate diagonal) */
 
   CS_MATRIX_N_BUILTIN_TYPES,  /*!< Number of known and built-in matrix types */
 
@@ -533,6 +535,72 @@ cs_matrix_copy_coefficients(cs_matrix_t        *matrix,
                             const cs_real_t    *da,
                             const cs_real_t    *xa);
 
+/*----------------------------------------------------------------------------
+ * Set native matrix coefficients, with extra-diagonal terms defined by
+ * face-based upwind convection/diffusion values rather than assembled.
+ *
+ * Extra-diagonal terms are computed on the fly by matrix.vector products
+ * (matrix-free operation), as:
+ *   X_ij =  conv_coeff.(m_ij)^- - diff_coeff.visc_ij
+ *   X_ji = -conv_coeff.(m_ij)^+ - diff_coeff.visc_ij
+ *
+ * Only native matrices with scalar extra-diagonal terms are handled.
+ * If extra-diagonal coefficients are requested later (for example to
+ * build coarse multigrid levels), they are built and kept until the
+ * coefficients are released.
+ *
+ * Arrays are mapped, not copied, so they must remain available until
+ * the coefficients are released.
+ *
+ * parameters:
+ *   matrix           <-> pointer to matrix structure
+ *   symmetric        <-- indicates if matrix coefficients are symmetric
+ *   diag_block_size  <-- block sizes for diagonal, or NULL
+ *   da               <-- diagonal values (NULL if zero)
+ *   conv_coeff       <-- mass flux factor (theta.iconv)
+ *   diff_coeff       <-- viscosity factor (theta.idiff)
+ *   i_massflux       <-- interior faces mass flux (ignored if symmetric)
+ *   i_visc           <-- interior faces viscosity
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_coefficients_from_faces(cs_matrix_t        *matrix,
+                                      bool                symmetric,
+                                      const cs_lnum_t    *diag_block_size,
+                                      const cs_real_t    *da,
+                                      double              conv_coeff,
+                                      double              diff_coeff,
+                                      const cs_real_t    *i_massflux,
+                                      const cs_real_t    *i_visc);
+
+/*----------------------------------------------------------------------------
+ * Compute native extra-diagonal coefficients from face-based upwind
+ * convection/diffusion values.
+ *
+ * See cs_matrix_set_coefficients_from_faces() for the definition
+ * of these coefficients.
+ *
+ * parameters:
+ *   symmetric   <-- indicates if matrix coefficients are symmetric
+ *   n_edges     <-- local number of graph edges (interior faces)
+ *   conv_coeff  <-- mass flux factor (theta.iconv)
+ *   diff_coeff  <-- viscosity factor (theta.idiff)
+ *   i_massflux  <-- interior faces mass flux, or NULL
+ *   i_visc      <-- interior faces viscosity
+ *   xa          --> extradiagonal values, cast as:
+ *                     xa[n_edges]    if symmetric,
+ *                     xa[n_edges][2] if non symmetric
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_extra_diagonal_from_faces(bool             symmetric,
+                                    cs_lnum_t        n_edges,
+                                    double           conv_coeff,
+                                    double           diff_coeff,
+                                    const cs_real_t  i_massflux[],
+                                    const cs_real_t  i_visc[],
+                                    cs_real_t        xa[]);
+
 /*----------------------------------------------------------------------------
  * Set matrix coefficients in an MSR format, transferring the
  * property of those arrays to the matrix.
@@ -804,6 +872,44 @@ cs_matrix_get_msr_arrays(const cs_matrix_t   *matrix,
                          const cs_real_t    **d_val,
                          const cs_real_t    **x_val);
 
+/*----------------------------------------------------------------------------
+ * Convert extra-diagonal coefficients of an MSR matrix to single precision.
+ *
+ * Only scalar MSR matrices are handled. Once converted, extra-diagonal
+ * values may not be requested from cs_matrix_get_msr_arrays(), so
+ * algorithms requiring them (such as Gauss-Seidel smoothers) may not be
+ * used with this matrix. The conversion is undone when the coefficients
+ * are released or redefined.
+ *
+ * parameters:
+ *   matrix <-> pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_msr_convert_extra_diag_to_float(cs_matrix_t  *matrix);
+
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x with single-precision vectors.
+ *
+ * This function is only available for scalar MSR matrices whose
+ * extra-diagonal coefficients are stored in single precision
+ * (see cs_matrix_msr_convert_extra_diag_to_float()). Row products
+ * are accumulated in double precision.
+ *
+ * This function includes a halo update of x, overlapped with the
+ * computation of rows not referencing ghost values.
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *   x      <-> multipliying vector values (ghost values updated)
+ *   y      --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_vector_multiply_f(const cs_matrix_t  *matrix,
+                            float              *restrict x,
+                            float              *restrict y);
+
 /*----------------------------------------------------------------------------
  * Assign functions based on a variant to a given matrix.
  *
@@ -850,13 +956,13 @@ cs_matrix_vector_multiply(cs_halo_rotation_t   rotation_mode,
  *
  * parameters:
  *   matrix --> pointer to matrix structure
- *   x      --> multipliying vector values
+ *   x      <-> multipliying vector values
  *   y      --> resulting vector
  *----------------------------------------------------------------------------*/
 
 void
 cs_matrix_vector_multiply_nosync(const cs_matrix_t  *matrix,
-                                 const cs_real_t    *x,
+                                 cs_real_t          *restrict x,
                                  cs_real_t          *restrict y);
 
 /*----------------------------------------------------------------------------
@@ -1086,6 +1192,10 @@ cs_matrix_variant_apply(cs_matrix_t          *m,
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *     omp_sched       (For OpenMP with scheduling)
  *
+ *   CS_MATRIX_SELL    (all fill types except CS_MATRIX_33_BLOCK)
+ *     default
+ *     standard
+ *
  * parameters:
  *   mv        <-> pointer to matrix variant
  *   numbering <-- mesh numbering info, or NULL
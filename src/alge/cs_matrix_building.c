@@ -1024,6 +1024,7 @@ cs_matrix_scalar(const cs_mesh_t          *m,
  *                               at border faces for the matrix
  * \param[out]    da            diagonal part of the matrix
  * \param[out]    xa            extra interleaved diagonal part of the matrix
+ *                               (may be NULL for scalar extra-diagonal)
  */
 /*----------------------------------------------------------------------------*/
 
@@ -1072,33 +1073,27 @@ cs_sym_matrix_vector(const cs_mesh_t          *m,
     }
   }
 
-  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
-    xa[face_id] = 0.;
-  }
-
-  /* 2. Computation of extradiagonal terms */
-
-  for (cs_lnum_t face_id = 0; face_id <n_i_faces; face_id++) {
-
-    xa[face_id] = -thetap*idiffp*i_visc[face_id];
-
-  }
-
-  /* 3. Contribution of the extra-diagonal terms to the diagonal */
+  /* 2. Computation of extradiagonal terms and of their contribution
+   *    to the diagonal (xa may be NULL for matrix-free products) */
 
   for (cs_lnum_t face_id = 0; face_id <n_i_faces; face_id++) {
 
     cs_lnum_t ii = i_face_cells[face_id][0];
     cs_lnum_t jj = i_face_cells[face_id][1];
 
+    cs_real_t xa_f = -thetap*idiffp*i_visc[face_id];
+
+    if (xa != NULL)
+      xa[face_id] = xa_f;
+
     for (int isou = 0; isou < 3; isou++) {
-      da[ii][isou][isou] -= xa[face_id];
-      da[jj][isou][isou] -= xa[face_id];
+      da[ii][isou][isou] -= xa_f;
+      da[jj][isou][isou] -= xa_f;
     }
 
   }
 
-  /* 4. Contribution of border faces to the diagonal */
+  /* 3. Contribution of border faces to the diagonal */
 
   for (cs_lnum_t face_id = 0; face_id <n_b_faces; face_id++) {
 
@@ -1144,6 +1139,7 @@ cs_sym_matrix_vector(const cs_mesh_t          *m,
  *                               at border faces for the matrix
  * \param[out]    da            diagonal part of the matrix
  * \param[out]    xa            extra interleaved diagonal part of the matrix
+ *                               (may be NULL for scalar extra-diagonal)
  */
 /*----------------------------------------------------------------------------*/
 
@@ -1192,33 +1188,27 @@ cs_sym_matrix_tensor(const cs_mesh_t          *m,
     }
   }
 
-  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
-    xa[face_id] = 0.;
-  }
-
-  /* 2. Computation of extradiagonal terms */
-
-  for (cs_lnum_t face_id = 0; face_id <n_i_faces; face_id++) {
-
-    xa[face_id] = -thetap*idiffp*i_visc[face_id];
-
-  }
-
-  /* 3. Contribution of the extra-diagonal terms to the diagonal */
+  /* 2. Computation of extradiagonal terms and of their contribution
+   *    to the diagonal (xa may be NULL for matrix-free products) */
 
   for (cs_lnum_t face_id = 0; face_id <n_i_faces; face_id++) {
 
     cs_lnum_t ii = i_face_cells[face_id][0];
     cs_lnum_t jj = i_face_cells[face_id][1];
 
+    cs_real_t xa_f = -thetap*idiffp*i_visc[face_id];
+
+    if (xa != NULL)
+      xa[face_id] = xa_f;
+
     for (int isou = 0; isou < 6; isou++) {
-      da[ii][isou][isou] -= xa[face_id];
-      da[jj][isou][isou] -= xa[face_id];
+      da[ii][isou][isou] -= xa_f;
+      da[jj][isou][isou] -= xa_f;
     }
 
   }
 
-  /* 4. Contribution of border faces to the diagonal */
+  /* 3. Contribution of border faces to the diagonal */
 
   for (cs_lnum_t face_id = 0; face_id <n_b_faces; face_id++) {
 
@@ -1274,6 +1264,7 @@ cs_sym_matrix_tensor(const cs_mesh_t          *m,
  *                               at border faces for the matrix
  * \param[out]    da            diagonal part of the matrix
  * \param[out]    xa            extra interleaved diagonal part of the matrix
+ *                               (may be NULL for scalar extra-diagonal)
  */
 /*----------------------------------------------------------------------------*/
 
@@ -1353,12 +1344,7 @@ cs_matrix_vector(const cs_mesh_t            *m,
     }
   }
 
-  if (eb_size[0] == 1) {
-    for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
-      xa[face_id][0] = 0.;
-      xa[face_id][1] = 0.;
-    }
-  } else {
+  if (eb_size[0] > 1) {
     for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
       for (cs_lnum_t i = 0; i < eb_size[0]; i++) {
         for (cs_lnum_t j = 0; j < eb_size[1]; j++) {
@@ -1369,11 +1355,16 @@ cs_matrix_vector(const cs_mesh_t            *m,
     }
   }
 
-  /* 2. Computation of extradiagonal terms */
+  /* 2. Computation of extradiagonal terms
+   *    (for scalar extra-diagonal terms, also compute their contribution
+   *    to the diagonal, so that xa may be NULL for matrix-free products) */
 
   if (eb_size[0] == 1) {
     for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
 
+      cs_lnum_t ii = i_face_cells[face_id][0];
+      cs_lnum_t jj = i_face_cells[face_id][1];
+
       /*
        * X_ij = - theta f_j (m_ij)^-
        * X_ji = - theta f_i (m_ij)^+
@@ -1383,10 +1374,31 @@ cs_matrix_vector(const cs_mesh_t            *m,
         -0.5 * iconvp * (i_massflux[face_id] + fabs(i_massflux[face_id]))
       };
 
-      xa[face_id][0] = thetap*(flu[0] -idiffp*i_visc[face_id])
-        * i_f_face_factor[is_p*face_id][1];//FIXME also diffusion? MF thinks so
-      xa[face_id][1] = thetap*(flu[1] -idiffp*i_visc[face_id])
-        * i_f_face_factor[is_p*face_id][0];
+      cs_real_2_t xa_f = {
+        thetap*(flu[0] -idiffp*i_visc[face_id])
+        * i_f_face_factor[is_p*face_id][1],//FIXME also diffusion? MF thinks so
+        thetap*(flu[1] -idiffp*i_visc[face_id])
+        * i_f_face_factor[is_p*face_id][0]
+      };
+
+      if (xa != NULL) {
+        xa[face_id][0] = xa_f[0];
+        xa[face_id][1] = xa_f[1];
+      }
+
+      /* D_ii =  theta f_i (m_ij)^+ - m_ij
+       *      = -X_ij - (1-theta)*m_ij
+       *      = -X_ji - m_ij
+       * D_jj = -theta f_j (m_ij)^- + m_ij
+       *      = -X_ji + (1-theta)*m_ij
+       *      = -X_ij + m_ij
+       */
+      for (int i = 0; i < 3; i++) {
+        da[ii][i][i] -= xa_f[1]
+                      + iconvp*i_massflux[face_id];
+        da[jj][i][i] -= xa_f[0]
+                      - iconvp*i_massflux[face_id];
+      }
 
     }
   }
@@ -1426,30 +1438,9 @@ cs_matrix_vector(const cs_mesh_t            *m,
     }
   }
 
-    /* 3. Contribution of the extra-diagonal terms to the diagonal */
+  /* 3. Contribution of the extra-diagonal block terms to the diagonal */
 
-  if (eb_size[0] == 1) {
-    for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
-
-      cs_lnum_t ii = i_face_cells[face_id][0];
-      cs_lnum_t jj = i_face_cells[face_id][1];
-
-      /* D_ii =  theta f_i (m_ij)^+ - m_ij
-       *      = -X_ij - (1-theta)*m_ij
-       *      = -X_ji - m_ij
-       * D_jj = -theta f_j (m_ij)^- + m_ij
-       *      = -X_ji + (1-theta)*m_ij
-       *      = -X_ij + m_ij
-       */
-      for (int i = 0; i < 3; i++) {
-        da[ii][i][i] -= xa[face_id][1]
-                      + iconvp*i_massflux[face_id];
-        da[jj][i][i] -= xa[face_id][0]
-                      - iconvp*i_massflux[face_id];
-      }
-    }
-  }
-  else {
+  if (eb_size[0] > 1) {
     for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
 
       cs_lnum_t ii = i_face_cells[face_id][0];
@@ -1555,6 +1546,7 @@ cs_matrix_vector(const cs_mesh_t            *m,
  *                               at border faces for the matrix
  * \param[out]    da            diagonal part of the matrix
  * \param[out]    xa            extra interleaved diagonal part of the matrix
+ *                               (may be NULL for scalar extra-diagonal)
  */
 /*----------------------------------------------------------------------------*/
 
@@ -1607,29 +1599,24 @@ cs_matrix_tensor(const cs_mesh_t          *m,
     }
   }
 
-  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
-    xa[face_id][0] = 0.;
-    xa[face_id][1] = 0.;
-  }
-
-  /* 2. Computation of extradiagonal terms */
+  /* 2. Computation of extradiagonal terms and of their contribution
+   *    to the diagonal (xa may be NULL for matrix-free products) */
 
   for (cs_lnum_t face_id = 0; face_id <n_i_faces; face_id++) {
 
+    cs_lnum_t ii = i_face_cells[face_id][0];
+    cs_lnum_t jj = i_face_cells[face_id][1];
+
     double flui = 0.5*( i_massflux[face_id] -fabs(i_massflux[face_id]) );
     double fluj =-0.5*( i_massflux[face_id] +fabs(i_massflux[face_id]) );
 
-    xa[face_id][0] = thetap*(iconvp*flui -idiffp*i_visc[face_id]);
-    xa[face_id][1] = thetap*(iconvp*fluj -idiffp*i_visc[face_id]);
+    cs_real_2_t xa_f = {thetap*(iconvp*flui -idiffp*i_visc[face_id]),
+                       thetap*(iconvp*fluj -idiffp*i_visc[face_id])};
 
-  }
-
-  /* 3. Contribution of the extra-diagonal terms to the diagonal */
-
-  for (cs_lnum_t face_id = 0; face_id <n_i_faces; face_id++) {
-
-    cs_lnum_t ii = i_face_cells[face_id][0];
-    cs_lnum_t jj = i_face_cells[face_id][1];
+    if (xa != NULL) {
+      xa[face_id][0] = xa_f[0];
+      xa[face_id][1] = xa_f[1];
+    }
 
     /* D_ii =  theta (m_ij)^+ - m_ij
      *      = -X_ij - (1-theta)*m_ij
@@ -1637,15 +1624,15 @@ cs_matrix_tensor(const cs_mesh_t          *m,
      *      = -X_ji + (1-theta)*m_ij
      */
     for (int isou = 0; isou < 6; isou++) {
-      da[ii][isou][isou] -= xa[face_id][0]
+      da[ii][isou][isou] -= xa_f[0]
                           + iconvp*(1. - thetap)*i_massflux[face_id];
-      da[jj][isou][isou] -= xa[face_id][1]
+      da[jj][isou][isou] -= xa_f[1]
                           - iconvp*(1. - thetap)*i_massflux[face_id];
     }
 
   }
 
-  /* 4. Contribution of border faces to the diagonal */
+  /* 3. Contribution of border faces to the diagonal */
 
   for (cs_lnum_t face_id = 0; face_id <n_b_faces; face_id++) {
 
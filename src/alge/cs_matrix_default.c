@@ -106,6 +106,10 @@ static bool _initialized = false;
 
 static cs_matrix_type_t  _default_type[CS_MATRIX_N_FILL_TYPES];
 
+/* Use matrix-free extra-diagonal terms when possible for a given fill type */
+
+static bool  _matrix_free[CS_MATRIX_N_FILL_TYPES];
+
 static cs_matrix_variant_t
 *_matrix_variant_tuned[CS_MATRIX_N_BUILTIN_TYPES][CS_MATRIX_N_FILL_TYPES];
 
@@ -418,6 +422,73 @@ cs_matrix_vector_native_multiply(bool                symmetric,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Matrix (native format) vector product, with extra-diagonal terms
+ * defined by face-based upwind convection/diffusion values.
+ *
+ * See cs_matrix_set_coefficients_from_faces() for the definition
+ * of these terms.
+ *
+ * parameters:
+ *   symmetric     <-- Symmetry indicator:
+ *   db_size       <-- block sizes for diagonal
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   f_id          <-- associated field id, or < 0
+ *   dam           <-- Matrix diagonal
+ *   conv_coeff    <-- mass flux factor (theta.iconv)
+ *   diff_coeff    <-- viscosity factor (theta.idiff)
+ *   i_massflux    <-- interior faces mass flux (ignored if symmetric)
+ *   i_visc        <-- interior faces viscosity
+ *   vx            <-- A*vx
+ *   vy            <-> vy = A*vx
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_vector_native_multiply_from_faces(bool                symmetric,
+                                            const cs_lnum_t     db_size[4],
+                                            cs_halo_rotation_t  rotation_mode,
+                                            int                 f_id,
+                                            const cs_real_t    *dam,
+                                            double              conv_coeff,
+                                            double              diff_coeff,
+                                            const cs_real_t    *i_massflux,
+                                            const cs_real_t    *i_visc,
+                                            cs_real_t          *vx,
+                                            cs_real_t          *vy)
+{
+  cs_matrix_t *a = cs_matrix_native(symmetric, db_size, NULL);
+
+  cs_matrix_set_coefficients_from_faces(a,
+                                        symmetric,
+                                        db_size,
+                                        dam,
+                                        conv_coeff,
+                                        diff_coeff,
+                                        i_massflux,
+                                        i_visc);
+
+  cs_matrix_vector_multiply(rotation_mode,
+                            a,
+                            vx,
+                            vy);
+
+  cs_matrix_release_coefficients(a);
+
+  /* Add extended contribution for domain coupling */
+
+  if (f_id != -1) {
+    const cs_field_t *f = cs_field_by_id(f_id);
+    int coupling_id = cs_field_get_key_int(f,
+                                           cs_field_key_id("coupling_entity"));
+
+    if (coupling_id > -1)
+      cs_internal_coupling_spmv_contribution(false,
+                                             f,
+                                             vx,
+                                             vy);
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Initialize sparse matrix API.
  *----------------------------------------------------------------------------*/
@@ -700,6 +771,51 @@ cs_matrix_default_set_type(cs_matrix_fill_type_t  fill_type,
   _default_type[fill_type] = type;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate whether extra-diagonal terms of convection/diffusion
+ *        systems with a given fill type should be computed on the fly
+ *        (matrix-free operation) rather than assembled.
+ *
+ * This only applies to systems whose extra-diagonal terms are scalar
+ * and may be defined from face-based values (see
+ * \ref cs_matrix_set_coefficients_from_faces); it is mainly useful
+ * for block diagonal fill types (such as velocity or Reynolds stress
+ * systems), for which the native matrix format is used anyways.
+ * By default, extra-diagonal terms are assembled for all fill types.
+ *
+ * \param[in]  fill_type    fill type for which behavior is set
+ * \param[in]  matrix_free  true to compute extra-diagonal terms on the fly
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_default_set_matrix_free(cs_matrix_fill_type_t  fill_type,
+                                  bool                   matrix_free)
+{
+  _matrix_free[fill_type] = matrix_free;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query whether extra-diagonal terms of convection/diffusion
+ *        systems with a given fill type should be computed on the fly.
+ *
+ * \param[in]  fill_type  fill type queried
+ *
+ * \return  true if matrix-free operation is requested, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_matrix_default_get_matrix_free(cs_matrix_fill_type_t  fill_type)
+{
+  if (fill_type < 0 || fill_type >= CS_MATRIX_N_FILL_TYPES)
+    return false;
+
+  return _matrix_free[fill_type];
+}
+
 /*----------------------------------------------------------------------------
  * Return a (0-based) global block row numbering.
  *
@@ -85,6 +85,40 @@ cs_matrix_vector_native_multiply(bool                symmetric,
                                  cs_real_t          *vx,
                                  cs_real_t          *vy);
 
+/*----------------------------------------------------------------------------
+ * Matrix (native format) vector product, with extra-diagonal terms
+ * defined by face-based upwind convection/diffusion values.
+ *
+ * See cs_matrix_set_coefficients_from_faces() for the definition
+ * of these terms.
+ *
+ * parameters:
+ *   symmetric     <-- Symmetry indicator:
+ *   db_size       <-- block sizes for diagonal
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   f_id          <-- associated field id, or < 0
+ *   dam           <-- Matrix diagonal
+ *   conv_coeff    <-- mass flux factor (theta.iconv)
+ *   diff_coeff    <-- viscosity factor (theta.idiff)
+ *   i_massflux    <-- interior faces mass flux (ignored if symmetric)
+ *   i_visc        <-- interior faces viscosity
+ *   vx            <-- A*vx
+ *   vy            <-> vy = A*vx
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_vector_native_multiply_from_faces(bool                symmetric,
+                                            const cs_lnum_t     db_size[4],
+                                            cs_halo_rotation_t  rotation_mode,
+                                            int                 f_id,
+                                            const cs_real_t    *dam,
+                                            double              conv_coeff,
+                                            double              diff_coeff,
+                                            const cs_real_t    *i_massflux,
+                                            const cs_real_t    *i_visc,
+                                            cs_real_t          *vx,
+                                            cs_real_t          *vy);
+
 /*----------------------------------------------------------------------------
  * Initialize sparse matrix API.
  *----------------------------------------------------------------------------*/
@@ -214,6 +248,35 @@ void
 cs_matrix_default_set_type(cs_matrix_fill_type_t  fill_type,
                            cs_matrix_type_t       type);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate whether extra-diagonal terms of convection/diffusion
+ *        systems with a given fill type should be computed on the fly
+ *        (matrix-free operation) rather than assembled.
+ *
+ * \param[in]  fill_type    fill type for which behavior is set
+ * \param[in]  matrix_free  true to compute extra-diagonal terms on the fly
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_default_set_matrix_free(cs_matrix_fill_type_t  fill_type,
+                                  bool                   matrix_free);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query whether extra-diagonal terms of convection/diffusion
+ *        systems with a given fill type should be computed on the fly.
+ *
+ * \param[in]  fill_type  fill type queried
+ *
+ * \return  true if matrix-free operation is requested, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_matrix_default_get_matrix_free(cs_matrix_fill_type_t  fill_type);
+
 /*----------------------------------------------------------------------------
  * Return a (0-based) global block row numbering.
  *
@@ -45,6 +45,13 @@ BEGIN_C_DECLS
  * Macro definitions
  *============================================================================*/
 
+/* Number of rows per chunk for SELL-C-sigma storage (8 matches the
+   number of doubles handled by a 512-bit SIMD instruction), and size of
+   row windows within which rows are sorted by decreasing length */
+
+#define CS_MATRIX_SELL_C          8
+#define CS_MATRIX_SELL_SIGMA    256
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -55,6 +62,7 @@ BEGIN_C_DECLS
  *  - Compressed Sparse Row (CSR)
  *  - Modified Compressed Sparse Row (MSR), with separate diagonal
  *  - Symmetric Compressed Sparse Row (CSR_SYM)
+ *  - Sliced ELLPACK (SELL-C-sigma), with separate diagonal
  */
 
 /*----------------------------------------------------------------------------
@@ -79,8 +87,9 @@ typedef void
 
 typedef void
 (cs_matrix_vector_product_t) (bool                exclude_diag,
+                              bool                sync,
                               const cs_matrix_t  *matrix,
-                              const cs_real_t    *restrict x,
+                              cs_real_t          *restrict x,
                               cs_real_t          *restrict y);
 
 /*----------------------------------------------------------------------------
@@ -107,6 +116,14 @@ typedef struct _cs_matrix_struct_native_t {
   const cs_lnum_2_t  *edges;        /* Edges (symmetric row <-> column)
                                        connectivity */
 
+  /* Edges adjacent to ghost columns, used to overlap the local part of
+     matrix.vector products with halo exchanges */
+
+  cs_lnum_t          n_halo_edges;  /* Number of edges adjacent to
+                                       ghost columns */
+  cs_lnum_t         *halo_edge_id;  /* Ids of edges adjacent to ghost
+                                       columns (size: n_halo_edges) */
+
 } cs_matrix_struct_native_t;
 
 /* Native matrix coefficients */
@@ -128,6 +145,19 @@ typedef struct _cs_matrix_coeff_native_t {
   cs_real_t         *_da;           /* Diagonal terms */
   cs_real_t         *_xa;           /* Extra-diagonal terms */
 
+  /* Optional face-based definition of upwind convection/diffusion
+     extra-diagonal terms (if i_visc is non-NULL, these terms are
+     computed on the fly by matrix.vector products, and xa is only
+     built if requested), and matrix.vector product functions to
+     restore for the matching fill type when it is released */
+
+  double                        conv_coeff;    /* Mass flux factor */
+  double                        diff_coeff;    /* Viscosity factor */
+  const cs_real_t              *i_massflux;    /* Face mass flux, or NULL */
+  const cs_real_t              *i_visc;        /* Face viscosity */
+  cs_matrix_fill_type_t         fill_type_mf;
+  cs_matrix_vector_product_t   *vector_multiply_d[2];
+
 } cs_matrix_coeff_native_t;
 
 /* CSR (Compressed Sparse Row) matrix structure representation */
@@ -152,6 +182,15 @@ typedef struct _cs_matrix_struct_csr_t {
   cs_lnum_t        *_row_index;       /* Row index (0 to n-1), if owner */
   cs_lnum_t        *_col_id;          /* Column id (0 to n-1), if owner */
 
+  /* Rows referencing ghost columns, used to overlap the local part of
+     matrix.vector products with halo exchanges */
+
+  cs_lnum_t         n_halo_rows;      /* Number of rows with ghost columns,
+                                         or -1 if ghost columns are not
+                                         placed last in each row */
+  cs_lnum_t        *halo_row_id;      /* Ids of rows with ghost columns
+                                         (size: n_halo_rows) */
+
 } cs_matrix_struct_csr_t;
 
 /* CSR matrix coefficients representation */
@@ -233,8 +272,58 @@ typedef struct _cs_matrix_coeff_msr_t {
   cs_real_t        *_d_val;           /* Diagonal matrix coefficients */
   cs_real_t        *_x_val;           /* Extra-diagonal matrix coefficients */
 
+  /* Optional single-precision copy of extra-diagonal coefficients
+     (if non-NULL, x_val and _x_val are NULL), and matrix.vector
+     product functions to restore for the matching fill type
+     when it is released */
+
+  float                        *_x_val_f;
+  cs_matrix_fill_type_t         fill_type_f;
+  cs_matrix_vector_product_t   *vector_multiply_d[2];
+
 } cs_matrix_coeff_msr_t;
 
+/* SELL-C-sigma (Sliced ELLPACK) matrix structure representation */
+/*---------------------------------------------------------------*/
+
+/* Rows are grouped in chunks of CS_MATRIX_SELL_C rows, after sorting
+   them by decreasing number of extra-diagonal entries within windows of
+   CS_MATRIX_SELL_SIGMA rows. Each chunk is padded to the length of its
+   longest row, and its entries stored column-major, so that entry j of
+   the k-th row of chunk c is at position chunk_index[c] + j*C + k.
+   Rows referencing ghost columns are placed in the last chunks.
+
+   Coefficients use the MSR representation (cs_matrix_coeff_msr_t),
+   with the diagonal in regular row order and extra-diagonal values
+   in SELL order, padding values being 0. */
+
+typedef struct _cs_matrix_struct_sell_t {
+
+  cs_lnum_t         n_rows;           /* Local number of rows */
+  cs_lnum_t         n_cols_ext;       /* Local number of columns + ghosts */
+
+  cs_lnum_t         n_chunks;         /* Number of row chunks */
+  cs_lnum_t         n_l_chunks;       /* Number of leading chunks whose
+                                         rows do not reference ghost
+                                         columns */
+
+  cs_lnum_t        *chunk_index;      /* Start of each chunk's entries
+                                         (size: n_chunks + 1) */
+  cs_lnum_t        *row_id;           /* Row id for each chunk slot, or -1
+                                         for padding (size:
+                                         n_chunks*CS_MATRIX_SELL_C) */
+  cs_lnum_t        *col_id;           /* Column ids (padding entries
+                                         refer to the row itself, or to
+                                         column 0 for padding rows) */
+
+  cs_lnum_t        *entry_id;         /* SELL entry id matching each
+                                         entry of the MSR structure */
+
+  cs_matrix_struct_csr_t  *msr;       /* Matching MSR structure
+                                         (without diagonal) */
+
+} cs_matrix_struct_sell_t;
+
 /* Matrix structure (representation-independent part) */
 /*----------------------------------------------------*/
 
@@ -403,15 +492,17 @@ cs_matrix_destroy_struct_csr(cs_matrix_struct_csr_t  **matrix);
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
  *   matrix       <-- Pointer to matrix structure
- *   x            <-- Multipliying vector values
+ *   x            <-> Multipliying vector values
  *   y            --> Resulting vector
  *----------------------------------------------------------------------------*/
 
 void
 cs_matrix_vec_p_l_csr(bool                exclude_diag,
+                      bool                sync,
                       const cs_matrix_t  *matrix,
-                      const cs_real_t    *restrict x,
+                      cs_real_t          *restrict x,
                       cs_real_t          *restrict y);
 
 #if defined (HAVE_MKL)
@@ -420,15 +511,17 @@ cs_matrix_vec_p_l_csr(bool                exclude_diag,
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
  *   matrix       <-- Pointer to matrix structure
- *   x            <-- Multipliying vector values
+ *   x            <-> Multipliying vector values
  *   y            --> Resulting vector
  *----------------------------------------------------------------------------*/
 
 void
 cs_matrix_vec_p_l_csr_mkl(bool                exclude_diag,
+                          bool                sync,
                           const cs_matrix_t  *matrix,
-                          const cs_real_t    *restrict x,
+                          cs_real_t          *restrict x,
                           cs_real_t          *restrict y);
 
 #endif /* defined (HAVE_MKL) */
@@ -470,15 +563,17 @@ cs_matrix_release_coeffs_msr(cs_matrix_t  *matrix);
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
  *   matrix       <-- Pointer to matrix structure
- *   x            <-- Multipliying vector values
+ *   x            <-> Multipliying vector values
  *   y            --> Resulting vector
  *----------------------------------------------------------------------------*/
 
 void
 cs_matrix_vec_p_l_msr(bool                exclude_diag,
+                      bool                sync,
                       const cs_matrix_t  *matrix,
-                      const cs_real_t    *restrict x,
+                      cs_real_t          *restrict x,
                       cs_real_t          *restrict y);
 
 #if defined (HAVE_MKL)
@@ -487,15 +582,17 @@ cs_matrix_vec_p_l_msr(bool                exclude_diag,
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
+ *   sync         <-- synchronize ghost values if true
  *   matrix       <-- Pointer to matrix structure
- *   x            <-- Multipliying vector values
+ *   x            <-> Multipliying vector values
  *   y            --> Resulting vector
  *----------------------------------------------------------------------------*/
 
 void
 cs_matrix_vec_p_l_msr_mkl(bool                exclude_diag,
+                          bool                sync,
                           const cs_matrix_t  *matrix,
-                          const cs_real_t    *restrict x,
+                          cs_real_t          *restrict x,
                           cs_real_t          *restrict y);
 #endif /* defined (HAVE_MKL) */
 
@@ -589,6 +589,20 @@ _diag_dom_msr(const cs_matrix_t  *matrix,
 
   }
 
+  else if (mc->_x_val_f != NULL) {
+
+#   pragma omp parallel for private(jj, n_cols, sii)
+    for (ii = 0; ii < n_rows; ii++) {
+      const float *restrict m_row_f = mc->_x_val_f + ms->row_index[ii];
+      n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+      sii = 0.0;
+      for (jj = 0; jj < n_cols; jj++)
+        sii -= fabs(m_row_f[jj]);
+      dd[ii] += sii;
+    }
+
+  }
+
   _diag_dom_diag_normalize(mc->d_val, dd, n_rows);
 }
 
@@ -1881,6 +1895,22 @@ _frobenius_norm(const cs_matrix_t  *m)
     }
     break;
 
+  case CS_MATRIX_SELL:
+    /* Padding coefficients are zero, so they may be included in the sum */
+    if (   (m->eb_size[0]*m->eb_size[0] == m->eb_size[3])
+        && (m->db_size[0]*m->db_size[0] == m->db_size[3])) {
+      cs_lnum_t  d_stride = m->db_size[3];
+      cs_lnum_t  e_stride = m->eb_size[3];
+      const cs_matrix_struct_sell_t  *ms = m->structure;
+      const cs_matrix_coeff_msr_t  *mc = m->coeffs;
+      cs_lnum_t n_vals = ms->chunk_index[ms->n_chunks];
+      double d_mult = (m->eb_size[3] == 1) ? m->db_size[0] : 1;
+      retval = cs_dot_xx(d_stride*m->n_rows, mc->d_val);
+      retval += d_mult * cs_dot_xx(e_stride*n_vals, mc->x_val);
+      cs_parall_sum(1, CS_DOUBLE, &retval);
+    }
+    break;
+
     default:
       retval = -1;
   }
@@ -243,6 +243,16 @@ typedef struct _cs_multigrid_setup_data_t {
   cs_real_t    **rhs_vx;                /* Coarse grid "right hand sides"
                                            and corrections */
 
+  int            float_level;           /* First level using single-precision
+                                           vectors, or -1 if none */
+  float         *rhs_vx_buf_f;          /* Single-precision buffer */
+  float        **rhs_vx_f;              /* Single-precision coarse grid
+                                           "right hand sides", corrections,
+                                           and inverse diagonals (3 arrays
+                                           per level from float_level) */
+  float         *work_f[4];             /* Single-precision work arrays
+                                           (residual and smoother) */
+
   /* Options used only when used as a preconditioner */
 
   char          *pc_name;               /* name of preconditioning system */
@@ -278,6 +288,10 @@ struct _cs_multigrid_t {
   double     p0p1_relax;         /* p0/p1 relaxation_parameter */
   double     k_cycle_threshold;  /* threshold for k cycle */
 
+  bool       coarse_float;       /* If true, store coarse level matrix
+                                    extra-diagonal coefficients in
+                                    single precision when possible */
+
   /* Setting for use as a preconditioner */
 
   double     pc_precision;       /* preconditioner precision */
@@ -491,6 +505,10 @@ _multigrid_setup_log(const cs_multigrid_t *mg)
                 _("  Cycle type:                        %s\n"),
                 _(cs_multigrid_type_name[mg->type]));
 
+  if (mg->coarse_float)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("  Coarse matrix coefficients:        float\n"));
+
   const char *stage_name[] = {"Descent smoother",
                               "Ascent smoother",
                               "Coarsest level solver"};
@@ -802,6 +820,12 @@ _multigrid_setup_data_create(void)
   mgd->rhs_vx_buf = NULL;
   mgd->rhs_vx = NULL;
 
+  mgd->float_level = -1;
+  mgd->rhs_vx_buf_f = NULL;
+  mgd->rhs_vx_f = NULL;
+  for (int i = 0; i < 4; i++)
+    mgd->work_f[i] = NULL;
+
   mgd->pc_name = NULL;
   mgd->pc_aux = NULL;
   mgd->pc_verbosity = 0;
@@ -2024,6 +2048,196 @@ _multigrid_setup_sles(cs_multigrid_t  *mg,
   cs_timer_counter_add_diff(&(mg_lv_info->t_tot[0]), &t0, &t1);
 }
 
+/*----------------------------------------------------------------------------
+ * Indicate if a given smoother or solver type requires direct access
+ * to matrix coefficients (as opposed to matrix.vector products only).
+ *
+ * parameters:
+ *   type <-- smoother or solver type
+ *
+ * returns:
+ *   true if matrix coefficients are accessed directly
+ *----------------------------------------------------------------------------*/
+
+static bool
+_uses_matrix_coeffs(cs_sles_it_type_t  type)
+{
+  bool retval = false;
+
+  switch(type) {
+  case CS_SLES_P_GAUSS_SEIDEL:
+  case CS_SLES_P_SYM_GAUSS_SEIDEL:
+  case CS_SLES_TS_F_GAUSS_SEIDEL:
+  case CS_SLES_TS_B_GAUSS_SEIDEL:
+    retval = true;
+    break;
+  default:
+    break;
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Indicate if a given smoother type and preconditioning degree may be
+ * handled with single-precision vectors by _smoothe_f.
+ *
+ * parameters:
+ *   type        <-- smoother type
+ *   poly_degree <-- preconditioning polynomial degree
+ *
+ * returns:
+ *   true if handled, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_float_smoother_type(cs_sles_it_type_t  type,
+                     int                poly_degree)
+{
+  bool retval = false;
+
+  if (type == CS_SLES_JACOBI)
+    retval = true;
+  else if (type == CS_SLES_PCG && poly_degree < 1)
+    retval = true;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Allocate single-precision work arrays for coarse right hand sides,
+ * corrections, and inverse diagonals, and compute the latter.
+ *
+ * parameters:
+ *   mg          <-> pointer to multigrid solver info and context
+ *   float_level <-- first level using single-precision vectors
+ *----------------------------------------------------------------------------*/
+
+static void
+_multigrid_setup_float_work_arrays(cs_multigrid_t  *mg,
+                                   int              float_level)
+{
+  cs_multigrid_setup_data_t *mgd = mg->setup_data;
+
+  const int n_levels = mgd->n_levels;
+
+  mgd->float_level = float_level;
+
+  BFT_MALLOC(mgd->rhs_vx_f, n_levels*3, float *);
+
+  for (int i = 0; i < n_levels*3; i++)
+    mgd->rhs_vx_f[i] = NULL;
+
+  size_t wr_size = 0, buf_size = 0;
+  for (int i = float_level; i < n_levels; i++) {
+    size_t block_size
+      = CS_SIMD_SIZE(cs_grid_get_n_cols_max(mgd->grid_hierarchy[i]));
+    wr_size = CS_MAX(wr_size, block_size);
+    buf_size += block_size*3;
+  }
+
+  BFT_MALLOC(mgd->rhs_vx_buf_f, buf_size + wr_size*4, float);
+
+  float *p = mgd->rhs_vx_buf_f;
+
+  for (int i = float_level; i < n_levels; i++) {
+
+    const cs_grid_t *g = mgd->grid_hierarchy[i];
+    size_t block_size = CS_SIMD_SIZE(cs_grid_get_n_cols_max(g));
+
+    for (int j = 0; j < 3; j++) {
+      mgd->rhs_vx_f[i*3 + j] = p;
+      p += block_size;
+    }
+
+    const cs_matrix_t *m = cs_grid_get_matrix(g);
+    const cs_lnum_t n_rows = cs_matrix_get_n_rows(m);
+    const cs_real_t *restrict ad = cs_matrix_get_diagonal(m);
+
+    float *restrict ad_inv = mgd->rhs_vx_f[i*3 + 2];
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      ad_inv[ii] = 1.0 / ad[ii];
+
+  }
+
+  for (int j = 0; j < 4; j++) {
+    mgd->work_f[j] = p;
+    p += wr_size;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Store coarse level matrix extra-diagonal coefficients in single
+ * precision if requested.
+ *
+ * Levels handled by a smoother or solver requiring direct access to matrix
+ * coefficients (Gauss-Seidel variants, or a coarse solver preconditioned
+ * by another multigrid) are kept in double precision, as are block systems.
+ *
+ * For a V-cycle whose intermediate coarse level matrices could all be
+ * converted, and whose smoothers are handled by _smoothe_f, coarse level
+ * vectors are also stored in single precision (see
+ * _multigrid_setup_float_work_arrays).
+ *
+ * parameters:
+ *   mg <-> pointer to multigrid structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_multigrid_setup_coarse_precision(cs_multigrid_t  *mg)
+{
+  if (mg->coarse_float == false)
+    return;
+
+  cs_multigrid_setup_data_t *mgd = mg->setup_data;
+
+  const unsigned n_levels = mgd->n_levels;
+
+  unsigned n_float_levels = 0;
+
+  for (unsigned i = 1; i < n_levels; i++) {
+
+    cs_grid_t *g = mgd->grid_hierarchy[i];
+    const cs_matrix_t *m = cs_grid_get_matrix(g);
+
+    if (   cs_matrix_get_type(m) != CS_MATRIX_MSR
+        || cs_matrix_get_diag_block_size(m)[0] > 1)
+      continue;
+
+    bool use_float = true;
+
+    if (i < n_levels - 1) {
+      for (int j = 0; j < 2; j++) {
+        if (_uses_matrix_coeffs(mg->info.type[j]))
+          use_float = false;
+      }
+    }
+    else {
+      if (_uses_matrix_coeffs(mg->info.type[2]) || mg->lv_mg[2] != NULL)
+        use_float = false;
+    }
+
+    if (use_float) {
+      cs_grid_set_matrix_float(g);
+      if (i < n_levels - 1)
+        n_float_levels += 1;
+    }
+
+  }
+
+  /* Use single-precision vectors from the first coarse level if possible */
+
+  if (   mg->type == CS_MULTIGRID_V_CYCLE
+      && mg->subtype == CS_MULTIGRID_MAIN
+      && n_levels > 2
+      && n_float_levels == n_levels - 2
+      && _float_smoother_type(mg->info.type[0], mg->info.poly_degree[0])
+      && _float_smoother_type(mg->info.type[1], mg->info.poly_degree[1]))
+    _multigrid_setup_float_work_arrays(mg, 1);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Setup multigrid sparse linear equation solver.
@@ -2210,6 +2424,10 @@ _setup_hierarchy(void             *context,
          "   number of rows in coarsest grid: %llu\n\n"),
        mg->setup_data->n_levels, (unsigned long long)n_g_rows);
 
+  /* Coarse levels are complete, so matrix precision may be reduced */
+
+  _multigrid_setup_coarse_precision(mg);
+
   /* Prepare preprocessing info if necessary */
 
   if (mg->post_row_max > 0) {
@@ -2819,6 +3037,318 @@ _level_names_init(const char  *name,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Sum values over the ranks active on a given grid level.
+ *
+ * parameters:
+ *   g     <-- grid structure
+ *   n     <-- number of values
+ *   s     <-> values to sum
+ *----------------------------------------------------------------------------*/
+
+static void
+_level_sum(const cs_grid_t  *g,
+           int               n,
+           double            s[])
+{
+#if defined(HAVE_MPI)
+
+  MPI_Comm comm = cs_grid_get_comm(g);
+
+  if (comm != MPI_COMM_NULL && cs_glob_n_ranks > 1) {
+    double _s[2];
+    assert(n <= 2);
+    MPI_Allreduce(s, _s, n, MPI_DOUBLE, MPI_SUM, comm);
+    for (int i = 0; i < n; i++)
+      s[i] = _s[i];
+  }
+
+#else
+
+  CS_UNUSED(g);
+  CS_UNUSED(n);
+  CS_UNUSED(s);
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------
+ * Convergence test for single-precision smoothers.
+ *
+ * parameters:
+ *   n_iter     <-- current number of iterations
+ *   n_max_iter <-- maximum number of iterations
+ *   precision  <-- smoother precision
+ *   r_norm     <-- residue normalization
+ *   residue    <-- current residue
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static inline cs_sles_convergence_state_t
+_smoothe_f_convergence(int     n_iter,
+                       int     n_max_iter,
+                       double  precision,
+                       double  r_norm,
+                       double  residue)
+{
+  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
+
+  if (residue < precision*r_norm || residue <= 0.)
+    cvg = CS_SLES_CONVERGED;
+  else if (isnan(residue) || isinf(residue))
+    cvg = CS_SLES_DIVERGED;
+  else if (n_iter >= n_max_iter)
+    cvg = CS_SLES_MAX_ITERATION;
+
+  return cvg;
+}
+
+/*----------------------------------------------------------------------------
+ * Smoothe a level system using single-precision vectors.
+ *
+ * Jacobi and conjugate gradient (unpreconditioned or with Jacobi
+ * preconditioning) smoothers are handled. Matrix.vector products, dot
+ * products and residue norms are accumulated in double precision.
+ *
+ * parameters:
+ *   mg        <-- multigrid system
+ *   level     <-- level id
+ *   stage     <-- 0 for descent, 1 for ascent
+ *   precision <-- smoother precision
+ *   r_norm    <-- residue normalization
+ *   n_iter    --> number of iterations
+ *   residue   --> residue
+ *   rhs       <-- right hand side
+ *   vx        <-> system solution
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_smoothe_f(cs_multigrid_t   *mg,
+           int               level,
+           int               stage,
+           double            precision,
+           double            r_norm,
+           int              *n_iter,
+           double           *residue,
+           const float      *restrict rhs,
+           float            *restrict vx)
+{
+  cs_multigrid_setup_data_t *mgd = mg->setup_data;
+
+  const cs_grid_t *g = mgd->grid_hierarchy[level];
+  const cs_matrix_t *a = cs_grid_get_matrix(g);
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+
+  const cs_sles_it_type_t type = mg->info.type[stage];
+  const int n_max_iter = mg->info.n_max_iter[stage];
+
+  /* Inverse diagonal, or NULL for an unpreconditioned conjugate gradient */
+
+  const float *restrict ad_inv = mgd->rhs_vx_f[level*3 + 2];
+  if (type == CS_SLES_PCG && mg->info.poly_degree[stage] < 0)
+    ad_inv = NULL;
+
+  /* work_f[0] is used by the caller for residuals */
+
+  float *restrict rk = mgd->work_f[1];
+  float *restrict dk = mgd->work_f[2];
+  float *restrict qk = mgd->work_f[3];
+
+  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
+  int _n_iter = 0;
+  double _residue = 0.;
+
+  /* Only smoothe on "active" ranks */
+
+  bool local_solve = true;
+
+#if defined(HAVE_MPI)
+  MPI_Comm comm = cs_grid_get_comm(g);
+  if (comm == MPI_COMM_NULL && n_rows == 0) {
+    local_solve = false;
+    cvg = CS_SLES_CONVERGED;
+  }
+#endif
+
+  if (local_solve && type == CS_SLES_JACOBI) {
+
+    while (cvg == CS_SLES_ITERATING) {
+
+      _n_iter += 1;
+
+      cs_matrix_vector_multiply_f(a, vx, rk);
+
+      double res2 = 0.;
+
+#     pragma omp parallel for reduction(+:res2) if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        float r = rhs[ii] - rk[ii];
+        vx[ii] += r*ad_inv[ii];
+        res2 += (double)r*r;
+      }
+
+      _level_sum(g, 1, &res2);
+
+      _residue = sqrt(res2); /* Actually, residue of previous iteration */
+
+      cvg = _smoothe_f_convergence(_n_iter, n_max_iter,
+                                   precision, r_norm, _residue);
+
+    }
+
+  }
+
+  else if (local_solve) { /* Conjugate gradient */
+
+    double s[2], s0 = 0., s1 = 0.;
+
+    cs_matrix_vector_multiply_f(a, vx, rk);
+
+#   pragma omp parallel for reduction(+:s0, s1) if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      rk[ii] = rhs[ii] - rk[ii];
+      dk[ii] = (ad_inv != NULL) ? rk[ii]*ad_inv[ii] : rk[ii];
+      s0 += (double)rk[ii]*rk[ii];
+      s1 += (double)rk[ii]*dk[ii];
+    }
+
+    s[0] = s0;
+    s[1] = s1;
+    _level_sum(g, 2, s);
+
+    _residue = sqrt(s[0]);
+    double rk_gk = s[1];
+
+    cvg = _smoothe_f_convergence(_n_iter, n_max_iter,
+                                 precision, r_norm, _residue);
+    if (cvg == CS_SLES_MAX_ITERATION)
+      cvg = CS_SLES_ITERATING;
+
+    while (cvg == CS_SLES_ITERATING) {
+
+      _n_iter += 1;
+
+      cs_matrix_vector_multiply_f(a, dk, qk);
+
+      double dk_qk = 0.;
+
+#     pragma omp parallel for reduction(+:dk_qk) if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        dk_qk += (double)dk[ii]*qk[ii];
+
+      _level_sum(g, 1, &dk_qk);
+
+      const float alpha = rk_gk / dk_qk;
+
+      s0 = 0.;
+      s1 = 0.;
+
+#     pragma omp parallel for reduction(+:s0, s1) if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        vx[ii] += alpha*dk[ii];
+        rk[ii] -= alpha*qk[ii];
+        float gk = (ad_inv != NULL) ? rk[ii]*ad_inv[ii] : rk[ii];
+        s0 += (double)rk[ii]*rk[ii];
+        s1 += (double)rk[ii]*gk;
+      }
+
+      s[0] = s0;
+      s[1] = s1;
+      _level_sum(g, 2, s);
+
+      _residue = sqrt(s[0]);
+
+      cvg = _smoothe_f_convergence(_n_iter, n_max_iter,
+                                   precision, r_norm, _residue);
+
+      if (cvg != CS_SLES_ITERATING)
+        break;
+
+      const float beta = s[1] / rk_gk;
+      rk_gk = s[1];
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        float gk = (ad_inv != NULL) ? rk[ii]*ad_inv[ii] : rk[ii];
+        dk[ii] = gk + beta*dk[ii];
+      }
+
+    }
+
+  }
+
+  /* Broadcast convergence info from "active" ranks to others */
+
+#if defined(HAVE_MPI)
+  if (comm != mg->comm && mg->comm != MPI_COMM_NULL) {
+    /* cvg is signed, so shift (with some margin) before copy to unsigned. */
+    unsigned buf[2] = {(unsigned)cvg+10, (unsigned)_n_iter};
+    MPI_Bcast(buf, 2, MPI_UNSIGNED, 0, mg->comm);
+    MPI_Bcast(&_residue, 1, MPI_DOUBLE, 0, mg->comm);
+    cvg = (cs_sles_convergence_state_t)(buf[0] - 10);
+    _n_iter = buf[1];
+  }
+#endif
+
+  *n_iter = _n_iter;
+  *residue = _residue;
+
+  return cvg;
+}
+
+/*----------------------------------------------------------------------------
+ * Log residual A.vx - Rhs for a level using single-precision vectors.
+ *
+ * parameters:
+ *   mg            <-- multigrid context
+ *   cycle_id      <-- id of currect cycle
+ *   var_name      <-- variable name
+ *   a             <-- matrix
+ *   rhs           <-- right hand side
+ *   vx            <-> system solution
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_residual_f(const cs_multigrid_t   *mg,
+                int                     cycle_id,
+                const char             *var_name,
+                const cs_matrix_t      *a,
+                const float            *rhs,
+                float                  *restrict vx)
+{
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+  const cs_lnum_t n_cols = cs_matrix_get_n_columns(a);
+
+  float  *r;
+  BFT_MALLOC(r, n_cols, float);
+
+  cs_matrix_vector_multiply_f(a, vx, r);
+
+  double s = 0.;
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    s += ((double)r[i] - rhs[i])*((double)r[i] - rhs[i]);
+
+  BFT_FREE(r);
+
+#if defined(HAVE_MPI)
+
+  if (mg->comm != MPI_COMM_NULL) {
+    double _sum;
+    MPI_Allreduce(&s, &_sum, 1, MPI_DOUBLE, MPI_SUM, mg->comm);
+    s = _sum;
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  cs_log_printf(CS_LOG_DEFAULT, "  mg cycle %d: %s residual: %.3g\n",
+                cycle_id, var_name, s);
+}
+
 /*----------------------------------------------------------------------------
  * Sparse linear system resolution using multigrid.
  *
@@ -2895,6 +3425,12 @@ _multigrid_v_cycle(cs_multigrid_t       *mg,
 
   coarsest_level = mgd->n_levels - 1;
 
+  /* Levels from float_level on use single-precision vectors */
+
+  const int float_level
+    = (mgd->float_level > 0) ? mgd->float_level : coarsest_level + 1;
+  float *restrict wr_f = mgd->work_f[0];
+
   f = mgd->grid_hierarchy[0];
 
   cs_grid_get_info(f,
@@ -2953,58 +3489,100 @@ _multigrid_v_cycle(cs_multigrid_t       *mg,
 
     _matrix = cs_grid_get_matrix(f);
 
-    cs_mg_sles_t  *mg_sles = &(mgd->sles_hierarchy[level*2]);
+    if (level >= float_level) {
 
-    c_cvg = mg_sles->solve_func(mg_sles->context,
-                                lv_names[level*2],
-                                _matrix,
-                                0, /* verbosity */
-                                rotation_mode,
-                                precision*mg->info.precision_mult[0],
-                                r_norm_l,
-                                &n_iter,
-                                &_residue,
-                                rhs_lv,
-                                vx_lv,
-                                _aux_r_size*sizeof(cs_real_t),
-                                _aux_vectors);
+      const float *rhs_lv_f = mgd->rhs_vx_f[level*3];
+      float *vx_lv_f = mgd->rhs_vx_f[level*3 + 1];
 
-    if (mg->plot_time_stamp > -1)
-      mg->plot_time_stamp += n_iter+1;
+      c_cvg = _smoothe_f(mg,
+                         level,
+                         0, /* descent */
+                         precision*mg->info.precision_mult[0],
+                         r_norm_l,
+                         &n_iter,
+                         &_residue,
+                         rhs_lv_f,
+                         vx_lv_f);
+
+      if (mg->plot_time_stamp > -1)
+        mg->plot_time_stamp += n_iter+1;
 
-    if (mg_sles->solve_func == cs_sles_it_solve)
-      _initial_residue
-        = cs_sles_it_get_last_initial_residue(mg_sles->context);
-    else
       _initial_residue = HUGE_VAL;
 
-    if (level == 0 && cycle_id == 1)
-      *initial_residue = _initial_residue;
+      if (verbosity > 0)
+        _log_residual_f(mg, cycle_id, lv_names[level*2],
+                        _matrix, rhs_lv_f, vx_lv_f);
 
-    if (verbosity > 0)
-      _log_residual(mg, cycle_id, lv_names[level*2],
-                    _matrix, rotation_mode, rhs_lv, vx_lv);
+      if (c_cvg < CS_SLES_BREAKDOWN) {
+        end_cycle = true;
+        break;
+      }
+
+      /* Restrict residue */
+
+      cs_matrix_vector_multiply_f(_matrix, vx_lv_f, wr_f);
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (ii = 0; ii < n_rows; ii++)
+        wr_f[ii] = rhs_lv_f[ii] - wr_f[ii];
 
-    if (c_cvg < CS_SLES_BREAKDOWN) {
-      end_cycle = true;
-      break;
     }
+    else {
 
-    /* Restrict residue
-       TODO: get residue from cs_sles_solve(). This optimisation would
-       require adding an argument and exercising caution to ensure the
-       correct sign and meaning of the residue
-       (regarding timing, this stage is part of the descent smoother) */
+      cs_mg_sles_t  *mg_sles = &(mgd->sles_hierarchy[level*2]);
 
-    cs_matrix_vector_multiply(rotation_mode,
-                              _matrix,
-                              vx_lv,
-                              wr);
+      c_cvg = mg_sles->solve_func(mg_sles->context,
+                                  lv_names[level*2],
+                                  _matrix,
+                                  0, /* verbosity */
+                                  rotation_mode,
+                                  precision*mg->info.precision_mult[0],
+                                  r_norm_l,
+                                  &n_iter,
+                                  &_residue,
+                                  rhs_lv,
+                                  vx_lv,
+                                  _aux_r_size*sizeof(cs_real_t),
+                                  _aux_vectors);
+
+      if (mg->plot_time_stamp > -1)
+        mg->plot_time_stamp += n_iter+1;
+
+      if (mg_sles->solve_func == cs_sles_it_solve)
+        _initial_residue
+          = cs_sles_it_get_last_initial_residue(mg_sles->context);
+      else
+        _initial_residue = HUGE_VAL;
+
+      if (level == 0 && cycle_id == 1)
+        *initial_residue = _initial_residue;
+
+      if (verbosity > 0)
+        _log_residual(mg, cycle_id, lv_names[level*2],
+                      _matrix, rotation_mode, rhs_lv, vx_lv);
+
+      if (c_cvg < CS_SLES_BREAKDOWN) {
+        end_cycle = true;
+        break;
+      }
 
-    _n_rows = n_rows*db_size[1];
-#   pragma omp parallel for if(_n_rows > CS_THR_MIN)
-    for (ii = 0; ii < _n_rows; ii++)
-      wr[ii] = rhs_lv[ii] - wr[ii];
+      /* Restrict residue
+         TODO: get residue from cs_sles_solve(). This optimisation would
+         require adding an argument and exercising caution to ensure the
+         correct sign and meaning of the residue
+         (regarding timing, this stage is part of the descent smoother) */
+
+      cs_matrix_vector_multiply(rotation_mode,
+                                _matrix,
+                                vx_lv,
+                                wr);
+
+      _n_rows = n_rows*db_size[1];
+#     pragma omp parallel for if(_n_rows > CS_THR_MIN)
+      for (ii = 0; ii < _n_rows; ii++)
+        wr[ii] = rhs_lv[ii] - wr[ii];
+
+    }
 
     /* Convergence test in beginning of cycle (fine mesh) */
 
@@ -3046,7 +3624,14 @@ _multigrid_v_cycle(cs_multigrid_t       *mg,
 
     /* Prepare for next level */
 
-    cs_grid_restrict_row_var(f, c, wr, mgd->rhs_vx[(level+1)*2]);
+    if (level >= float_level)
+      cs_grid_restrict_row_var_f(f, c, CS_FLOAT, wr_f,
+                                 mgd->rhs_vx_f[(level+1)*3]);
+    else if (level + 1 == float_level)
+      cs_grid_restrict_row_var_f(f, c, CS_REAL_TYPE, wr,
+                                 mgd->rhs_vx_f[(level+1)*3]);
+    else
+      cs_grid_restrict_row_var(f, c, wr, mgd->rhs_vx[(level+1)*2]);
 
     cs_grid_get_info(c,
                      NULL,
@@ -3063,12 +3648,20 @@ _multigrid_v_cycle(cs_multigrid_t       *mg,
 
     /* Initialize correction */
 
-    cs_real_t *restrict vx_lv1 = mgd->rhs_vx[(level+1)*2 + 1];
+    if (level + 1 >= float_level) {
+      float *restrict vx_lv1_f = mgd->rhs_vx_f[(level+1)*3 + 1];
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (ii = 0; ii < n_rows; ii++)
+        vx_lv1_f[ii] = 0.f;
+    }
+    else {
+      cs_real_t *restrict vx_lv1 = mgd->rhs_vx[(level+1)*2 + 1];
 
-    _n_rows = n_rows*db_size[1];
-#   pragma omp parallel for if(n_rows > CS_THR_MIN)
-    for (ii = 0; ii < _n_rows; ii++)
-      vx_lv1[ii] = 0.0;
+      _n_rows = n_rows*db_size[1];
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (ii = 0; ii < _n_rows; ii++)
+        vx_lv1[ii] = 0.0;
+    }
 
     t0 = cs_timer_time();
     cs_timer_counter_add_diff(&(lv_info->t_tot[4]), &t1, &t0);
@@ -3088,6 +3681,18 @@ _multigrid_v_cycle(cs_multigrid_t       *mg,
     rhs_lv = (level == 0) ?  rhs : mgd->rhs_vx[coarsest_level*2];
     vx_lv = mgd->rhs_vx[level*2 + 1];
 
+    /* The coarsest level is solved in double precision
+       (its size is small, so the conversion cost is negligible) */
+
+    if (level >= float_level) {
+      const float *rhs_lv_f = mgd->rhs_vx_f[level*3];
+      cs_real_t *_rhs_lv = mgd->rhs_vx[level*2];
+      for (ii = 0; ii < n_rows; ii++) {
+        _rhs_lv[ii] = rhs_lv_f[ii];
+        vx_lv[ii] = 0.;
+      }
+    }
+
     _matrix = cs_grid_get_matrix(c);
 
     cs_mg_sles_t  *mg_sles = &(mgd->sles_hierarchy[level*2]);
@@ -3112,6 +3717,12 @@ _multigrid_v_cycle(cs_multigrid_t       *mg,
                                 _aux_r_size*sizeof(cs_real_t),
                                 _aux_vectors);
 
+    if (level >= float_level) {
+      float *vx_lv_f = mgd->rhs_vx_f[level*3 + 1];
+      for (ii = 0; ii < n_rows; ii++)
+        vx_lv_f[ii] = vx_lv[ii];
+    }
+
     t1 = cs_timer_time();
     cs_timer_counter_add_diff(&(lv_info->t_tot[1]), &t0, &t1);
     lv_info->n_calls[1] += 1;
@@ -3163,13 +3774,33 @@ _multigrid_v_cycle(cs_multigrid_t       *mg,
 
       t0 = cs_timer_time();
 
-      cs_real_t *restrict vx_lv1 = mgd->rhs_vx[(level+1)*2 + 1];
-      cs_grid_prolong_row_var(c, f, vx_lv1, wr);
+      if (level >= float_level) {
 
-      _n_rows = n_rows*db_size[1];
-#     pragma omp parallel for if(n_rows > CS_THR_MIN)
-      for (ii = 0; ii < _n_rows; ii++)
-        vx_lv[ii] += wr[ii];
+        float *restrict vx_lv_f = mgd->rhs_vx_f[level*3 + 1];
+        cs_grid_prolong_row_var_f(c, f, mgd->rhs_vx_f[(level+1)*3 + 1],
+                                  CS_FLOAT, wr_f);
+
+#       pragma omp parallel for if(n_rows > CS_THR_MIN)
+        for (ii = 0; ii < n_rows; ii++)
+          vx_lv_f[ii] += wr_f[ii];
+
+      }
+      else {
+
+        if (level + 1 == float_level)
+          cs_grid_prolong_row_var_f(c, f, mgd->rhs_vx_f[(level+1)*3 + 1],
+                                    CS_REAL_TYPE, wr);
+        else {
+          cs_real_t *restrict vx_lv1 = mgd->rhs_vx[(level+1)*2 + 1];
+          cs_grid_prolong_row_var(c, f, vx_lv1, wr);
+        }
+
+        _n_rows = n_rows*db_size[1];
+#       pragma omp parallel for if(n_rows > CS_THR_MIN)
+        for (ii = 0; ii < _n_rows; ii++)
+          vx_lv[ii] += wr[ii];
+
+      }
 
       t1 = cs_timer_time();
       cs_timer_counter_add_diff(&(lv_info->t_tot[5]), &t0, &t1);
@@ -3179,7 +3810,41 @@ _multigrid_v_cycle(cs_multigrid_t       *mg,
          (smoother not called for finest mesh, as it will be called in
          descent phase of the next cycle, before the convergence test). */
 
-      if (level > 0) {
+      if (level >= float_level) {
+
+        const float *rhs_lv_f = mgd->rhs_vx_f[level*3];
+        float *vx_lv_f = mgd->rhs_vx_f[level*3 + 1];
+
+        _matrix = cs_grid_get_matrix(f);
+
+        c_cvg = _smoothe_f(mg,
+                           level,
+                           1, /* ascent */
+                           precision*mg->info.precision_mult[1],
+                           r_norm_l,
+                           &n_iter,
+                           &_residue,
+                           rhs_lv_f,
+                           vx_lv_f);
+
+        t0 = cs_timer_time();
+        cs_timer_counter_add_diff(&(lv_info->t_tot[3]), &t1, &t0);
+        lv_info->n_calls[3] += 1;
+        _lv_info_update_stage_iter(lv_info->n_it_as_smoothe, n_iter);
+
+        _initial_residue = HUGE_VAL;
+
+        *n_equiv_iter += n_iter * n_g_rows * denom_n_g_rows_0;
+
+        if (verbosity > 0)
+          _log_residual_f(mg, cycle_id, lv_names[level*2+1],
+                          _matrix, rhs_lv_f, vx_lv_f);
+
+        if (c_cvg < CS_SLES_BREAKDOWN)
+          break;
+      }
+
+      else if (level > 0) {
 
         rhs_lv = mgd->rhs_vx[level*2];
 
@@ -3226,6 +3891,21 @@ _multigrid_v_cycle(cs_multigrid_t       *mg,
 
   } /* End of tests on end_cycle */
 
+  /* In case of error on a single-precision level, copy its values
+     to the matching double-precision arrays for error postprocessing */
+
+  if (   c_cvg < CS_SLES_BREAKDOWN
+      && level >= float_level && level < coarsest_level) {
+    const float *rhs_lv_f = mgd->rhs_vx_f[level*3];
+    const float *vx_lv_f = mgd->rhs_vx_f[level*3 + 1];
+    cs_real_t *_rhs_lv = mgd->rhs_vx[level*2];
+    vx_lv = mgd->rhs_vx[level*2 + 1];
+    for (ii = 0; ii < n_cols_ext; ii++) {
+      _rhs_lv[ii] = rhs_lv_f[ii];
+      vx_lv[ii] = vx_lv_f[ii];
+    }
+  }
+
   mgd->exit_level = level;
   mgd->exit_residue = _residue;
   if (level == 0)
@@ -3812,6 +4492,8 @@ cs_multigrid_create(cs_multigrid_type_t  mg_type)
   mg->p0p1_relax = 0.;
   mg->k_cycle_threshold = 0;
 
+  mg->coarse_float = false;
+
   _multigrid_info_init(&(mg->info));
   for (int i = 0; i < 3; i++)
     mg->lv_mg[i] = NULL;
@@ -4444,6 +5126,12 @@ cs_multigrid_free(void  *context)
     BFT_FREE(mgd->rhs_vx);
     BFT_FREE(mgd->rhs_vx_buf);
 
+    mgd->float_level = -1;
+    BFT_FREE(mgd->rhs_vx_f);
+    BFT_FREE(mgd->rhs_vx_buf_f);
+    for (int i = 0; i < 4; i++)
+      mgd->work_f[i] = NULL;
+
     /* Destroy solver hierarchy */
 
     for (int i = mgd->n_levels - 1; i > -1; i--) {
@@ -4829,6 +5517,39 @@ cs_multigrid_set_merge_options(cs_multigrid_t  *mg,
 #endif
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set multigrid coarse level precision options.
+ *
+ * If activated, extra-diagonal coefficients of coarse level matrices
+ * are stored in single precision, reducing the memory traffic of
+ * matrix.vector products. This only applies to scalar systems, and
+ * to levels whose smoother or solver relies only on matrix.vector products
+ * (so levels using Gauss-Seidel type smoothers are not affected).
+ *
+ * For V-cycles using Jacobi or conjugate gradient smoothers (with no or
+ * diagonal preconditioning), coarse level right hand sides, corrections,
+ * and smoother work vectors are also stored in single precision, with
+ * conversion at restriction to and prolongation from the first coarse
+ * level. The finest level and the coarsest level solve remain in double
+ * precision, as do dot products and residue norms.
+ *
+ * \param[in, out]  mg            pointer to multigrid info and context
+ * \param[in]       coarse_float  if true, use single-precision coefficients
+ *                                on coarse levels when possible
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_precision_options(cs_multigrid_t  *mg,
+                                   bool             coarse_float)
+{
+  if (mg == NULL)
+    return;
+
+  mg->coarse_float = coarse_float;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -446,6 +446,33 @@ cs_multigrid_set_merge_options(cs_multigrid_t  *mg,
                                int              rows_mean_threshold,
                                cs_gnum_t        rows_glob_threshold);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set multigrid coarse level precision options.
+ *
+ * If activated, extra-diagonal coefficients of coarse level matrices
+ * are stored in single precision, reducing the memory traffic of
+ * matrix.vector products. This only applies to scalar systems, and
+ * to levels whose smoother or solver relies only on matrix.vector products
+ * (so levels using Gauss-Seidel type smoothers are not affected).
+ *
+ * For V-cycles using Jacobi or conjugate gradient smoothers (with no or
+ * diagonal preconditioning), coarse level right hand sides, corrections,
+ * and smoother work vectors are also stored in single precision, with
+ * conversion at restriction to and prolongation from the first coarse
+ * level. The finest level and the coarsest level solve remain in double
+ * precision, as do dot products and residue norms.
+ *
+ * \param[in, out]  mg            pointer to multigrid info and context
+ * \param[in]       coarse_float  if true, use single-precision coefficients
+ *                                on coarse levels when possible
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_precision_options(cs_multigrid_t  *mg,
+                                   bool             coarse_float);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -88,6 +88,17 @@ BEGIN_C_DECLS
  * Local Structure Definitions
  *============================================================================*/
 
+/* Face-based definition of extra-diagonal terms (for matrix-free use) */
+
+typedef struct {
+
+  double            conv_coeff;   /* mass flux factor */
+  double            diff_coeff;   /* viscosity factor */
+  const cs_real_t  *i_massflux;   /* interior faces mass flux */
+  const cs_real_t  *i_visc;       /* interior faces viscosity */
+
+} cs_sles_face_def_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -95,6 +106,7 @@ BEGIN_C_DECLS
 static int           _n_setups = 0;
 static cs_sles_t    *_sles_setup[CS_SLES_DEFAULT_N_SETUPS];
 static cs_matrix_t  *_matrix_setup[CS_SLES_DEFAULT_N_SETUPS][3];
+static cs_real_t    *_xa_setup[CS_SLES_DEFAULT_N_SETUPS];
 
 static const int _poly_degree_default = 0;
 static const int _n_max_iter_default = 10000;
@@ -103,6 +115,36 @@ static const int _n_max_iter_default = 10000;
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Indicate if a given iterative solver or smoother type requires
+ * an MSR matrix (Gauss-Seidel variants).
+ *
+ * parameters:
+ *   type <-- iterative solver or smoother type
+ *
+ * returns:
+ *   true if an MSR matrix is required, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_need_msr(cs_sles_it_type_t  type)
+{
+  bool retval = false;
+
+  switch (type) {
+  case CS_SLES_P_GAUSS_SEIDEL:
+  case CS_SLES_P_SYM_GAUSS_SEIDEL:
+  case CS_SLES_TS_F_GAUSS_SEIDEL:
+  case CS_SLES_TS_B_GAUSS_SEIDEL:
+    retval = true;
+    break;
+  default:
+    break;
+  }
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Default definition of a sparse linear equation solver
@@ -241,6 +283,334 @@ _sles_default_native(int                f_id,
 
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set matrix coefficients from native arrays or from a face-based
+ *        convection/diffusion definition.
+ *
+ * With a face-based definition, native matrices compute extra-diagonal
+ * terms on the fly; for other matrix types, these terms are built and
+ * kept with the matching setup.
+ *
+ * \param[in]       setup_id               associated setup id
+ * \param[in, out]  a                      pointer to matrix structure
+ * \param[in]       symmetric              indicates if matrix coefficients
+ *                                         are symmetric
+ * \param[in]       diag_block_size        block sizes for diagonal, or NULL
+ * \param[in]       extra_diag_block_size  block sizes for extra diagonal,
+ *                                         or NULL
+ * \param[in]       da                     diagonal values (NULL if zero)
+ * \param[in]       xa                     extradiagonal values (NULL if zero)
+ * \param[in]       cd                     face-based definition of
+ *                                         extradiagonal values, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_set_native_coefficients(int                        setup_id,
+                         cs_matrix_t               *a,
+                         bool                       symmetric,
+                         const cs_lnum_t           *diag_block_size,
+                         const cs_lnum_t           *extra_diag_block_size,
+                         const cs_real_t           *da,
+                         const cs_real_t           *xa,
+                         const cs_sles_face_def_t  *cd)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  if (cd != NULL) {
+
+    if (cs_matrix_get_type(a) == CS_MATRIX_NATIVE) {
+      cs_matrix_set_coefficients_from_faces(a,
+                                            symmetric,
+                                            diag_block_size,
+                                            da,
+                                            cd->conv_coeff,
+                                            cd->diff_coeff,
+                                            cd->i_massflux,
+                                            cd->i_visc);
+      return;
+    }
+
+    if (_xa_setup[setup_id] == NULL) {
+      cs_lnum_t xa_n_vals = (symmetric) ? m->n_i_faces : m->n_i_faces*2;
+      BFT_MALLOC(_xa_setup[setup_id], xa_n_vals, cs_real_t);
+      cs_matrix_extra_diagonal_from_faces(symmetric,
+                                          m->n_i_faces,
+                                          cd->conv_coeff,
+                                          cd->diff_coeff,
+                                          cd->i_massflux,
+                                          cd->i_visc,
+                                          _xa_setup[setup_id]);
+    }
+    xa = _xa_setup[setup_id];
+
+  }
+
+  cs_matrix_set_coefficients(a,
+                             symmetric,
+                             diag_block_size,
+                             extra_diag_block_size,
+                             m->n_i_faces,
+                             (const cs_lnum_2_t *)(m->i_face_cells),
+                             da,
+                             xa);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Call sparse linear equation solver using native matrix arrays
+ *        or a face-based definition of extra-diagonal terms.
+ *
+ * \param[in]       f_id                   associated field id, or < 0
+ * \param[in]       name                   associated name if f_id < 0, or NULL
+ * \param[in]       symmetric              indicates if matrix coefficients
+ *                                         are symmetric
+ * \param[in]       diag_block_size        block sizes for diagonal, or NULL
+ * \param[in]       extra_diag_block_size  block sizes for extra diagonal,
+ *                                         or NULL
+ * \param[in]       da                     diagonal values (NULL if zero)
+ * \param[in]       xa                     extradiagonal values (NULL if zero)
+ * \param[in]       cd                     face-based definition of
+ *                                         extradiagonal values, or NULL
+ * \param[in]       rotation_mode          halo update option for
+ *                                         rotational periodicity
+ * \param[in]       precision              solver precision
+ * \param[in]       r_norm                 residue normalization
+ * \param[out]      n_iter                 number of "equivalent" iterations
+ * \param[out]      residue                residue
+ * \param[in]       rhs                    right hand side
+ * \param[in, out]  vx                     system solution
+ *
+ * \return  convergence state
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_sles_solve_native(int                        f_id,
+                   const char                *name,
+                   bool                       symmetric,
+                   const cs_lnum_t           *diag_block_size,
+                   const cs_lnum_t           *extra_diag_block_size,
+                   const cs_real_t           *da,
+                   const cs_real_t           *xa,
+                   const cs_sles_face_def_t  *cd,
+                   cs_halo_rotation_t         rotation_mode,
+                   double                     precision,
+                   double                     r_norm,
+                   int                       *n_iter,
+                   double                    *residue,
+                   const cs_real_t           *rhs,
+                   cs_real_t                 *vx)
+{
+  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
+  cs_matrix_t *a = NULL;
+
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  bool need_msr = false;
+
+  /* Check if this system has already been setup */
+
+  cs_sles_t *sc = cs_sles_find_or_add(f_id, name);
+
+  int setup_id = 0;
+  while (setup_id < _n_setups) {
+    if (_sles_setup[setup_id] == sc)
+      break;
+    else
+      setup_id++;
+  }
+
+  if (setup_id >= _n_setups) {
+
+    _n_setups += 1;
+
+    if (_n_setups > CS_SLES_DEFAULT_N_SETUPS)
+      bft_error
+        (__FILE__, __LINE__, 0,
+         "Too many linear systems solved without calling cs_sles_free_native\n"
+         "  maximum number of systems: %d\n"
+         "If this is not an error, increase CS_SLES_DEFAULT_N_SETUPS\n"
+         "  in file %s.", CS_SLES_DEFAULT_N_SETUPS, __FILE__);
+
+    /* If context has not been defined yet, temporarily set
+       matrix coefficients (using native matrix, which has lowest
+       overhead as coefficients are provided in that form)
+       to define the required context.
+
+       The matrix type might be modified later based on solver
+       constraints.
+
+       With a face-based definition, only the matrix type and structure
+       are needed here, so extra-diagonal terms are not built
+       (they are handled as zero). */
+
+    if (cs_sles_get_context(sc) == NULL) {
+      int eb_size = 1;
+      if (extra_diag_block_size != NULL)
+        eb_size = extra_diag_block_size[1];
+      if (eb_size > 1)
+        a = cs_matrix_native(symmetric,
+                             diag_block_size,
+                             extra_diag_block_size);
+      else
+        a = cs_matrix_msr(symmetric,
+                          diag_block_size,
+                          extra_diag_block_size);
+
+      if (cd != NULL)
+        cs_matrix_set_coefficients(a,
+                                   symmetric,
+                                   diag_block_size,
+                                   extra_diag_block_size,
+                                   m->n_i_faces,
+                                   (const cs_lnum_2_t *)(m->i_face_cells),
+                                   da,
+                                   NULL);
+      else
+        _set_native_coefficients(setup_id,
+                                 a,
+                                 symmetric,
+                                 diag_block_size,
+                                 extra_diag_block_size,
+                                 da,
+                                 xa,
+                                 NULL);
+
+      cs_sles_define_t  *sles_default_func = cs_sles_get_default_define();
+      sles_default_func(f_id, name, a);
+      cs_matrix_release_coefficients(a);
+    }
+
+    assert(cs_sles_get_context(sc) != NULL);
+
+    cs_sles_pc_t  *pc = NULL;
+    cs_multigrid_t *mg = NULL;
+
+    if (strcmp(cs_sles_get_type(sc), "cs_sles_it_t") == 0) {
+      cs_sles_it_t *c = cs_sles_get_context(sc);
+      cs_sles_it_type_t s_type = cs_sles_it_get_type(c);
+      if (_need_msr(s_type))
+        need_msr = true;
+      else {
+        pc = cs_sles_it_get_pc(c);
+        if (pc != NULL) {
+          if (strcmp(cs_sles_pc_get_type(pc), "multigrid") == 0)
+            mg = cs_sles_pc_get_context(pc);
+        }
+      }
+    }
+    else if (strcmp(cs_sles_get_type(sc), "cs_multigrid_t") == 0)
+      mg = cs_sles_get_context(sc);
+
+    if (mg != NULL) {
+      cs_sles_it_type_t fs_type = cs_multigrid_get_fine_solver_type(mg);
+      if (_need_msr(fs_type))
+        need_msr = true;
+    }
+
+    /* MSR not supported yet for full blocks */
+    if (extra_diag_block_size != NULL) {
+      if (extra_diag_block_size[0] > 1)
+        need_msr = false;
+    }
+
+    /* Extra-diagonal terms computed on the fly require a native matrix */
+
+    if (need_msr)
+      a = cs_matrix_msr(symmetric,
+                        diag_block_size,
+                        extra_diag_block_size);
+    else if (cd != NULL)
+      a = cs_matrix_native(symmetric,
+                           diag_block_size,
+                           extra_diag_block_size);
+    else
+      a = cs_matrix_default(symmetric,
+                            diag_block_size,
+                            extra_diag_block_size);
+
+    _set_native_coefficients(setup_id,
+                             a,
+                             symmetric,
+                             diag_block_size,
+                             extra_diag_block_size,
+                             da,
+                             xa,
+                             cd);
+
+    /* Tuned variants would replace the matrix-free product */
+
+    if (cd == NULL || cs_matrix_get_type(a) != CS_MATRIX_NATIVE)
+      cs_matrix_default_set_tuned(a);
+
+    _sles_setup[setup_id] = sc;
+    _matrix_setup[setup_id][0] = a;
+    _matrix_setup[setup_id][1] = NULL;
+    _matrix_setup[setup_id][2] = NULL;
+
+  }
+  else
+    a = _matrix_setup[setup_id][0];
+
+  /* If system uses specific halo (i.e. when matrix contains more than
+     face->cell nonzeroes), allocate specific buffers. */
+
+  cs_real_t *_vx = vx, *_rhs = NULL;
+  const cs_real_t *rhs_p = rhs;
+
+  const cs_halo_t *halo = cs_matrix_get_halo(a);
+  if (halo != NULL && halo != m->halo) {
+
+    size_t stride = 1;
+    if (diag_block_size != NULL)
+      stride = diag_block_size[1];
+    cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+    cs_lnum_t n_cols_ext = cs_matrix_get_n_columns(a);
+    assert(n_rows == m->n_cells);
+    cs_lnum_t _n_rows = n_rows*stride;
+    BFT_MALLOC(_rhs, n_cols_ext*stride, cs_real_t);
+    BFT_MALLOC(_vx, n_cols_ext*stride, cs_real_t);
+#   pragma omp parallel for  if(_n_rows > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < _n_rows; i++) {
+      _rhs[i] = rhs[i];
+      _vx[i] = vx[i];
+    }
+    cs_matrix_pre_vector_multiply_sync(rotation_mode, a, _rhs);
+    rhs_p = _rhs;
+  }
+
+  /* Solve system */
+
+  cvg = cs_sles_solve(sc,
+                      a,
+                      rotation_mode,
+                      precision,
+                      r_norm,
+                      n_iter,
+                      residue,
+                      rhs_p,
+                      _vx,
+                      0,
+                      NULL);
+
+  BFT_FREE(_rhs);
+  if (_vx != vx) {
+    size_t stride = 1;
+    if (diag_block_size != NULL)
+      stride = diag_block_size[1];
+    cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+    cs_lnum_t _n_rows = n_rows*stride;
+#   pragma omp parallel for  if(_n_rows > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < _n_rows; i++)
+      vx[i] = _vx[i];
+    BFT_FREE(_vx);
+  }
+
+  return cvg;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -667,191 +1037,100 @@ cs_sles_solve_native(int                  f_id,
                      const cs_real_t     *rhs,
                      cs_real_t           *vx)
 {
-  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
-  cs_matrix_t *a = NULL;
-
-  const cs_mesh_t *m = cs_glob_mesh;
-
-  bool need_msr = false;
-
-  /* Check if this system has already been setup */
-
-  cs_sles_t *sc = cs_sles_find_or_add(f_id, name);
-
-  int setup_id = 0;
-  while (setup_id < _n_setups) {
-    if (_sles_setup[setup_id] == sc)
-      break;
-    else
-      setup_id++;
-  }
-
-  if (setup_id >= _n_setups) {
-
-    _n_setups += 1;
-
-    if (_n_setups > CS_SLES_DEFAULT_N_SETUPS)
-      bft_error
-        (__FILE__, __LINE__, 0,
-         "Too many linear systems solved without calling cs_sles_free_native\n"
-         "  maximum number of systems: %d\n"
-         "If this is not an error, increase CS_SLES_DEFAULT_N_SETUPS\n"
-         "  in file %s.", CS_SLES_DEFAULT_N_SETUPS, __FILE__);
-
-    /* If context has not been defined yet, temporarily set
-       matrix coefficients (using native matrix, which has lowest
-       overhead as coefficients are provided in that form)
-       to define the required context.
-
-       The matrix type might be modified later based on solver
-       constraints. */
-
-    if (cs_sles_get_context(sc) == NULL) {
-      int eb_size = 1;
-      if (extra_diag_block_size != NULL)
-        eb_size = extra_diag_block_size[1];
-      if (eb_size > 1)
-        a = cs_matrix_native(symmetric,
-                             diag_block_size,
-                             extra_diag_block_size);
-      else
-        a = cs_matrix_msr(symmetric,
-                          diag_block_size,
-                          extra_diag_block_size);
-
-      cs_matrix_set_coefficients(a,
-                                 symmetric,
-                                 diag_block_size,
-                                 extra_diag_block_size,
-                                 m->n_i_faces,
-                                 (const cs_lnum_2_t *)(m->i_face_cells),
-                                 da,
-                                 xa);
-
-      cs_sles_define_t  *sles_default_func = cs_sles_get_default_define();
-      sles_default_func(f_id, name, a);
-      cs_matrix_release_coefficients(a);
-    }
-
-    assert(cs_sles_get_context(sc) != NULL);
-
-    cs_sles_pc_t  *pc = NULL;
-    cs_multigrid_t *mg = NULL;
-
-    if (strcmp(cs_sles_get_type(sc), "cs_sles_it_t") == 0) {
-      cs_sles_it_t *c = cs_sles_get_context(sc);
-      cs_sles_it_type_t s_type = cs_sles_it_get_type(c);
-      if (   s_type >= CS_SLES_P_GAUSS_SEIDEL
-          && s_type <= CS_SLES_TS_B_GAUSS_SEIDEL)
-        need_msr = true;
-      else {
-        pc = cs_sles_it_get_pc(c);
-        if (pc != NULL) {
-          if (strcmp(cs_sles_pc_get_type(pc), "multigrid") == 0)
-            mg = cs_sles_pc_get_context(pc);
-        }
-      }
-    }
-    else if (strcmp(cs_sles_get_type(sc), "cs_multigrid_t") == 0)
-      mg = cs_sles_get_context(sc);
-
-    if (mg != NULL) {
-      cs_sles_it_type_t fs_type = cs_multigrid_get_fine_solver_type(mg);
-      if (   fs_type >= CS_SLES_P_GAUSS_SEIDEL
-          && fs_type <= CS_SLES_TS_B_GAUSS_SEIDEL)
-        need_msr = true;
-    }
-
-    /* MSR not supported yet for full blocks */
-    if (extra_diag_block_size != NULL) {
-      if (extra_diag_block_size[0] > 1)
-        need_msr = false;
-    }
-
-    if (need_msr)
-      a = cs_matrix_msr(symmetric,
-                        diag_block_size,
-                        extra_diag_block_size);
-    else
-      a = cs_matrix_default(symmetric,
+  return _sles_solve_native(f_id,
+                            name,
+                            symmetric,
                             diag_block_size,
-                            extra_diag_block_size);
-
-    cs_matrix_set_coefficients(a,
-                               symmetric,
-                               diag_block_size,
-                               extra_diag_block_size,
-                               m->n_i_faces,
-                               (const cs_lnum_2_t *)(m->i_face_cells),
-                               da,
-                               xa);
-
-    cs_matrix_default_set_tuned(a);
-
-    _sles_setup[setup_id] = sc;
-    _matrix_setup[setup_id][0] = a;
-    _matrix_setup[setup_id][1] = NULL;
-    _matrix_setup[setup_id][2] = NULL;
-
-  }
-  else
-    a = _matrix_setup[setup_id][0];
-
-  /* If system uses specific halo (i.e. when matrix contains more than
-     face->cell nonzeroes), allocate specific buffers. */
-
-  cs_real_t *_vx = vx, *_rhs = NULL;
-  const cs_real_t *rhs_p = rhs;
-
-  const cs_halo_t *halo = cs_matrix_get_halo(a);
-  if (halo != NULL && halo != m->halo) {
-
-    size_t stride = 1;
-    if (diag_block_size != NULL)
-      stride = diag_block_size[1];
-    cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
-    cs_lnum_t n_cols_ext = cs_matrix_get_n_columns(a);
-    assert(n_rows == m->n_cells);
-    cs_lnum_t _n_rows = n_rows*stride;
-    BFT_MALLOC(_rhs, n_cols_ext*stride, cs_real_t);
-    BFT_MALLOC(_vx, n_cols_ext*stride, cs_real_t);
-#   pragma omp parallel for  if(_n_rows > CS_THR_MIN)
-    for (cs_lnum_t i = 0; i < _n_rows; i++) {
-      _rhs[i] = rhs[i];
-      _vx[i] = vx[i];
-    }
-    cs_matrix_pre_vector_multiply_sync(rotation_mode, a, _rhs);
-    rhs_p = _rhs;
-  }
-
-  /* Solve system */
+                            extra_diag_block_size,
+                            da,
+                            xa,
+                            NULL,
+                            rotation_mode,
+                            precision,
+                            r_norm,
+                            n_iter,
+                            residue,
+                            rhs,
+                            vx);
+}
 
-  cvg = cs_sles_solve(sc,
-                      a,
-                      rotation_mode,
-                      precision,
-                      r_norm,
-                      n_iter,
-                      residue,
-                      rhs_p,
-                      _vx,
-                      0,
-                      NULL);
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Call sparse linear equation solver using native matrix arrays,
+ *        with extra-diagonal terms defined by face-based upwind
+ *        convection/diffusion values (matrix-free operation).
+ *
+ * Extra-diagonal terms are scalar, and defined as described for
+ * \ref cs_matrix_set_coefficients_from_faces.
+ *
+ * When the selected solver allows it, a native matrix computing these
+ * terms on the fly is used, so they are never stored for the finest
+ * level (except when coarse multigrid levels are built from it).
+ * Otherwise (for example with Gauss-Seidel type solvers, which require
+ * an MSR matrix), they are built for the duration of the setup.
+ *
+ * \param[in]       f_id             associated field id, or < 0
+ * \param[in]       name             associated name if f_id < 0, or NULL
+ * \param[in]       symmetric        indicates if matrix coefficients
+ *                                   are symmetric
+ * \param[in]       diag_block_size  block sizes for diagonal, or NULL
+ * \param[in]       da               diagonal values (NULL if zero)
+ * \param[in]       conv_coeff       mass flux factor (theta.iconv)
+ * \param[in]       diff_coeff       viscosity factor (theta.idiff)
+ * \param[in]       i_massflux       interior faces mass flux
+ *                                   (ignored if symmetric)
+ * \param[in]       i_visc           interior faces viscosity
+ * \param[in]       rotation_mode    halo update option for
+ *                                   rotational periodicity
+ * \param[in]       precision        solver precision
+ * \param[in]       r_norm           residue normalization
+ * \param[out]      n_iter           number of "equivalent" iterations
+ * \param[out]      residue          residue
+ * \param[in]       rhs              right hand side
+ * \param[in, out]  vx               system solution
+ *
+ * \return  convergence state
+ */
+/*----------------------------------------------------------------------------*/
 
-  BFT_FREE(_rhs);
-  if (_vx != vx) {
-    size_t stride = 1;
-    if (diag_block_size != NULL)
-      stride = diag_block_size[1];
-    cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
-    cs_lnum_t _n_rows = n_rows*stride;
-#   pragma omp parallel for  if(_n_rows > CS_THR_MIN)
-    for (cs_lnum_t i = 0; i < _n_rows; i++)
-      vx[i] = _vx[i];
-    BFT_FREE(_vx);
-  }
+cs_sles_convergence_state_t
+cs_sles_solve_native_matrix_free(int                  f_id,
+                                 const char          *name,
+                                 bool                 symmetric,
+                                 const cs_lnum_t     *diag_block_size,
+                                 const cs_real_t     *da,
+                                 double               conv_coeff,
+                                 double               diff_coeff,
+                                 const cs_real_t     *i_massflux,
+                                 const cs_real_t     *i_visc,
+                                 cs_halo_rotation_t   rotation_mode,
+                                 double               precision,
+                                 double               r_norm,
+                                 int                 *n_iter,
+                                 double              *residue,
+                                 const cs_real_t     *rhs,
+                                 cs_real_t           *vx)
+{
+  const cs_sles_face_def_t  cd = {.conv_coeff = conv_coeff,
+                                  .diff_coeff = diff_coeff,
+                                  .i_massflux = i_massflux,
+                                  .i_visc = i_visc};
 
-  return cvg;
+  return _sles_solve_native(f_id,
+                            name,
+                            symmetric,
+                            diag_block_size,
+                            NULL,
+                            da,
+                            NULL,
+                            &cd,
+                            rotation_mode,
+                            precision,
+                            r_norm,
+                            n_iter,
+                            residue,
+                            rhs,
+                            vx);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -886,10 +1165,13 @@ cs_sles_free_native(int          f_id,
       if (_matrix_setup[setup_id][i] != NULL)
         cs_matrix_destroy(&(_matrix_setup[setup_id][i]));
     }
+    BFT_FREE(_xa_setup[setup_id]);
 
     _n_setups -= 1;
 
     if (setup_id < _n_setups) {
+      _xa_setup[setup_id] = _xa_setup[_n_setups];
+      _xa_setup[_n_setups] = NULL;
       for (int i = 0; i < 3; i++) {
         _matrix_setup[setup_id][i] = _matrix_setup[_n_setups][i];
       _sles_setup[setup_id] = _sles_setup[_n_setups];
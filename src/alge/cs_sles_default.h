@@ -205,6 +205,56 @@ cs_sles_solve_native(int                  f_id,
                      const cs_real_t     *rhs,
                      cs_real_t           *vx);
 
+/*----------------------------------------------------------------------------
+ * Call sparse linear equation solver using native matrix arrays, with
+ * extra-diagonal terms defined by face-based upwind convection/diffusion
+ * values (matrix-free operation).
+ *
+ * Extra-diagonal terms are scalar, and defined as described for
+ * cs_matrix_set_coefficients_from_faces(). When the selected solver
+ * allows it, they are computed on the fly; otherwise, they are built
+ * for the duration of the setup.
+ *
+ * parameters:
+ *   f_id             <-- associated field id, or < 0
+ *   name             <-- associated name if f_id < 0, or NULL
+ *   symmetric        <-- indicates if matrix coefficients are symmetric
+ *   diag_block_size  <-- block sizes for diagonal, or NULL
+ *   da               <-- diagonal values (NULL if zero)
+ *   conv_coeff       <-- mass flux factor (theta.iconv)
+ *   diff_coeff       <-- viscosity factor (theta.idiff)
+ *   i_massflux       <-- interior faces mass flux (ignored if symmetric)
+ *   i_visc           <-- interior faces viscosity
+ *   rotation_mode    <-- halo update option for rotational periodicity
+ *   precision        <-- solver precision
+ *   r_norm           <-- residue normalization
+ *   n_iter           --> number of iterations
+ *   residue          --> residue
+ *   rhs              <-- right hand side
+ *   vx               <-> system solution
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_solve_native_matrix_free(int                  f_id,
+                                 const char          *name,
+                                 bool                 symmetric,
+                                 const cs_lnum_t     *diag_block_size,
+                                 const cs_real_t     *da,
+                                 double               conv_coeff,
+                                 double               diff_coeff,
+                                 const cs_real_t     *i_massflux,
+                                 const cs_real_t     *i_visc,
+                                 cs_halo_rotation_t   rotation_mode,
+                                 double               precision,
+                                 double               r_norm,
+                                 int                 *n_iter,
+                                 double              *residue,
+                                 const cs_real_t     *rhs,
+                                 cs_real_t           *vx);
+
 /*----------------------------------------------------------------------------
  * Free sparse linear equation solver setup using native matrix arrays.
  *
@@ -131,6 +131,7 @@ const char *cs_sles_it_type_name[]
      N_("Gauss-Seidel"),
      N_("Symmetric Gauss-Seidel"),
      N_("3-layer conjugate residual"),
+     N_("Pipelined Conjugate Gradient"),
      N_("None"), /* Smoothers beyond this */
      N_("Truncated forward Gauss-Seidel"),
      N_("Truncated backwards Gauss-Seidel"),
@@ -1401,6 +1402,253 @@ _conjugate_gradient_npc_sr(cs_sles_it_t              *c,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------
+ * Compute 3 local dot products x.x, x.y and y.z, and start summing them
+ * over all ranks.
+ *
+ * When non-blocking collectives are available (MPI 3 or above), the
+ * reduction is only posted here, and must be completed using
+ * _dot_products_finish; otherwise, it is completed immediately.
+ *
+ * parameters:
+ *   c       <-- pointer to solver context info
+ *   x       <-- first vector
+ *   y       <-- second vector
+ *   z       <-- third vector
+ *   s       --> local, then global results (x.x, x.y, y.z)
+ *   request --> associated MPI request, if applicable
+ *----------------------------------------------------------------------------*/
+
+static void
+_dot_products_xx_xy_yz_start(const cs_sles_it_t  *c,
+                             const cs_real_t     *x,
+                             const cs_real_t     *y,
+                             const cs_real_t     *z,
+                             double               s[3],
+                             void                *request)
+{
+  cs_dot_xx_xy_yz(c->setup_data->n_rows, x, y, z, s, s+1, s+2);
+
+#if defined(HAVE_MPI)
+
+  MPI_Request *_request = request;
+  *_request = MPI_REQUEST_NULL;
+
+  if (c->comm != MPI_COMM_NULL) {
+#if (MPI_VERSION >= 3)
+    MPI_Iallreduce(MPI_IN_PLACE, s, 3, MPI_DOUBLE, MPI_SUM, c->comm,
+                   _request);
+#else
+    MPI_Allreduce(MPI_IN_PLACE, s, 3, MPI_DOUBLE, MPI_SUM, c->comm);
+#endif
+  }
+
+#else
+
+  CS_UNUSED(request);
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------
+ * Complete summing of dot products over all ranks.
+ *
+ * parameters:
+ *   request <-> associated MPI request, if applicable
+ *----------------------------------------------------------------------------*/
+
+static void
+_dot_products_finish(void  *request)
+{
+#if defined(HAVE_MPI)
+
+  MPI_Request *_request = request;
+  if (*_request != MPI_REQUEST_NULL)
+    MPI_Wait(_request, MPI_STATUS_IGNORE);
+
+#else
+
+  CS_UNUSED(request);
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using pipelined preconditioned conjugate gradient.
+ *
+ * This variant, described in \cite Ghysels:2014, requires a single global
+ * reduction per iteration, which is overlapped with the preconditioning
+ * and matrix.vector product, at the cost of additional work arrays and
+ * vector updates. It is mostly useful when reductions are latency-bound,
+ * such as at high rank counts or on coarse multigrid levels.
+ *
+ * Note that the preconditioning and matrix.vector product of the last
+ * iteration are computed before convergence is known, so are wasted.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- block size of element ii, ii
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_conjugate_gradient_pipelined(cs_sles_it_t              *c,
+                              const cs_matrix_t         *a,
+                              cs_lnum_t                  diag_block_size,
+                              cs_halo_rotation_t         rotation_mode,
+                              cs_sles_it_convergence_t  *convergence,
+                              const cs_real_t           *rhs,
+                              cs_real_t                 *restrict vx,
+                              size_t                     aux_size,
+                              void                      *aux_vectors)
+{
+  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
+  double  alpha = 0., beta = 0., gamma_km1 = 0., residue;
+  cs_real_t  *_aux_vectors;
+  cs_real_t  *restrict rk, *restrict uk, *restrict wk, *restrict mk;
+  cs_real_t  *restrict nk, *restrict zk, *restrict qk, *restrict sk;
+  cs_real_t  *restrict pk;
+
+#if defined(HAVE_MPI)
+  MPI_Request request;
+#else
+  int request;
+#endif
+
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+    const size_t n_wa = 9;
+    const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+
+    rk = _aux_vectors;
+    uk = _aux_vectors + wa_size;
+    wk = _aux_vectors + wa_size*2;
+    mk = _aux_vectors + wa_size*3;
+    nk = _aux_vectors + wa_size*4;
+    zk = _aux_vectors + wa_size*5;
+    qk = _aux_vectors + wa_size*6;
+    sk = _aux_vectors + wa_size*7;
+    pk = _aux_vectors + wa_size*8;
+  }
+
+  /* Initialize iterative calculation */
+  /*----------------------------------*/
+
+  /* Residue (rk = rhs - A.x0) */
+
+  cs_matrix_vector_multiply(rotation_mode, a, vx, rk);
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    rk[ii] = rhs[ii] - rk[ii];
+
+  /* Preconditioned residue and its product with A */
+
+  c->setup_data->pc_apply(c->setup_data->pc_context,
+                          rotation_mode,
+                          rk,
+                          uk);
+
+  cs_matrix_vector_multiply(rotation_mode, a, uk, wk);
+
+  /* Current Iteration */
+  /*-------------------*/
+
+  while (true) {
+
+    /* Start reduction of rk.rk, rk.uk and uk.wk */
+
+    double s[3];
+    _dot_products_xx_xy_yz_start(c, rk, uk, wk, s, &request);
+
+    /* Overlap with preconditioning and matrix.vector product */
+
+    c->setup_data->pc_apply(c->setup_data->pc_context,
+                            rotation_mode,
+                            wk,
+                            mk);
+
+    cs_matrix_vector_multiply(rotation_mode, a, mk, nk);
+
+    _dot_products_finish(&request);
+
+    residue = sqrt(s[0]);
+
+    /* Convergence test for end of previous iteration */
+
+    if (n_iter == 0)
+      c->setup_data->initial_residue = residue;
+    else {
+      cvg = _convergence_test(c, n_iter, residue, convergence);
+      if (cvg != CS_SLES_ITERATING)
+        break;
+    }
+
+    /* Descent parameters; in case of breakdown (alpha = 0 at the previous
+       iteration), restart from the current residue */
+
+    const double gamma_k = s[1], delta_k = s[2];
+
+    if (n_iter > 0 && CS_ABS(alpha) > DBL_MIN) {
+      beta = (CS_ABS(gamma_km1) > DBL_MIN) ? gamma_k / gamma_km1 : 0.;
+      double denom = delta_k - beta*gamma_k/alpha;
+      alpha = (CS_ABS(denom) > DBL_MIN) ? gamma_k / denom : 0.;
+    }
+    else {
+      beta = 0.;
+      alpha = (CS_ABS(delta_k) > DBL_MIN) ? gamma_k / delta_k : 0.;
+    }
+    gamma_km1 = gamma_k;
+
+    n_iter += 1;
+
+    /* Update vectors */
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      zk[ii] = nk[ii] + beta*zk[ii];
+      qk[ii] = mk[ii] + beta*qk[ii];
+      sk[ii] = wk[ii] + beta*sk[ii];
+      pk[ii] = uk[ii] + beta*pk[ii];
+      vx[ii] += alpha*pk[ii];
+      rk[ii] -= alpha*sk[ii];
+      uk[ii] -= alpha*qk[ii];
+      wk[ii] -= alpha*zk[ii];
+    }
+
+  }
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  return cvg;
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using preconditioned 3-layer conjugate residual.
  *
@@ -2825,11 +3073,98 @@ _gmres(cs_sles_it_t              *c,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------
+ * Build wavefront (level) schedule for ordered Gauss-Seidel.
+ *
+ * Rows are grouped in successive levels, such that rows of a given level
+ * only depend on rows of previous levels among those preceding them in the
+ * ordering. Handling levels in sequence, with rows of a same level
+ * handled in parallel, thus reproduces the sequential ordered sweep.
+ *
+ * parameters:
+ *   a   <-- linear equation matrix (MSR)
+ *   ad  <-> solver additional data (ordering)
+ *----------------------------------------------------------------------------*/
+
+static void
+_ordered_gauss_seidel_levels(const cs_matrix_t  *a,
+                             cs_sles_it_add_t   *ad)
+{
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+
+  const cs_lnum_t  *a_row_index, *a_col_id;
+  const cs_real_t  *a_d_val, *a_x_val;
+
+  cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
+
+  const cs_lnum_t  *order = ad->order;
+
+  cs_lnum_t *rank, *level;
+  BFT_MALLOC(rank, n_rows, cs_lnum_t);
+  BFT_MALLOC(level, n_rows, cs_lnum_t);
+
+  for (cs_lnum_t ll = 0; ll < n_rows; ll++)
+    rank[order[ll]] = ll;
+
+  /* A row's level is one more than the highest level of the
+     rows on which it depends (ghost values are fixed during a sweep) */
+
+  cs_lnum_t n_levels = 0;
+
+  for (cs_lnum_t ll = 0; ll < n_rows; ll++) {
+    cs_lnum_t ii = order[ll];
+    cs_lnum_t l_id = 0;
+    for (cs_lnum_t jj = a_row_index[ii]; jj < a_row_index[ii+1]; jj++) {
+      cs_lnum_t kk = a_col_id[jj];
+      if (kk < n_rows) {
+        if (rank[kk] < ll && level[kk] >= l_id)
+          l_id = level[kk] + 1;
+      }
+    }
+    level[ii] = l_id;
+    if (l_id >= n_levels)
+      n_levels = l_id + 1;
+  }
+
+  /* Group rows by level, keeping the initial ordering inside a level */
+
+  ad->n_level_rows = n_rows;
+  ad->n_levels = n_levels;
+  BFT_REALLOC(ad->level_index, n_levels + 1, cs_lnum_t);
+  BFT_REALLOC(ad->level_order, n_rows, cs_lnum_t);
+
+  cs_lnum_t *level_index = ad->level_index;
+
+  for (cs_lnum_t l_id = 0; l_id < n_levels + 1; l_id++)
+    level_index[l_id] = 0;
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    level_index[level[ii] + 1] += 1;
+  for (cs_lnum_t l_id = 0; l_id < n_levels; l_id++)
+    level_index[l_id + 1] += level_index[l_id];
+
+  /* rank array reused as insertion position */
+
+  for (cs_lnum_t l_id = 0; l_id < n_levels; l_id++)
+    rank[l_id] = level_index[l_id];
+
+  for (cs_lnum_t ll = 0; ll < n_rows; ll++) {
+    cs_lnum_t ii = order[ll];
+    ad->level_order[rank[level[ii]]] = ii;
+    rank[level[ii]] += 1;
+  }
+
+  BFT_FREE(level);
+  BFT_FREE(rank);
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using Process-local Gauss-Seidel.
  *
  * On entry, vx is considered initialized.
  *
+ * When multiple threads are used, rows are handled by wavefront levels,
+ * so that results are identical to those of the sequential ordered sweep.
+ *
  * parameters:
  *   c               <-- pointer to solver context info
  *   a               <-- linear equation matrix
@@ -2873,8 +3208,22 @@ _p_ordered_gauss_seidel_msr(cs_sles_it_t              *c,
   const cs_lnum_t *db_size = cs_matrix_get_diag_block_size(a);
   cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
 
+  /* Wavefront schedule, or single level for sequential sweep */
+
+  cs_lnum_t n_levels = 1;
+  cs_lnum_t _level_index[2] = {0, n_rows};
+  const cs_lnum_t  *level_index = _level_index;
   const cs_lnum_t  *order = c->add_data->order;
 
+  if (cs_glob_n_threads > 1 && n_rows > CS_THR_MIN && !_thread_debug) {
+    cs_sles_it_add_t  *add = c->add_data;
+    if (add->level_index == NULL || add->n_level_rows != n_rows)
+      _ordered_gauss_seidel_levels(a, add);
+    n_levels = add->n_levels;
+    level_index = add->level_index;
+    order = add->level_order;
+  }
+
   cvg = CS_SLES_ITERATING;
 
   /* Current iteration */
@@ -2895,68 +3244,80 @@ _p_ordered_gauss_seidel_msr(cs_sles_it_t              *c,
 
     if (diag_block_size == 1) {
 
-#     pragma omp parallel for reduction(+:res2)      \
-                          if(n_rows > CS_THR_MIN && !_thread_debug)
-      for (cs_lnum_t ll = 0; ll < n_rows; ll++) {
+#     pragma omp parallel reduction(+:res2) if(n_levels > 1)
+      for (cs_lnum_t l_id = 0; l_id < n_levels; l_id++) {
 
-        cs_lnum_t ii = order[ll];
+#       pragma omp for
+        for (cs_lnum_t ll = level_index[l_id];
+             ll < level_index[l_id+1];
+             ll++) {
 
-        const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
-        const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+          cs_lnum_t ii = order[ll];
 
-        cs_real_t vxm1 = vx[ii];
-        cs_real_t vx0 = rhs[ii];
+          const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
+          const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+          const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
 
-        for (cs_lnum_t jj = 0; jj < n_cols; jj++)
-          vx0 -= (m_row[jj]*vx[col_id[jj]]);
+          cs_real_t vxm1 = vx[ii];
+          cs_real_t vx0 = rhs[ii];
 
-        vx0 *= ad_inv[ii];
+          for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+            vx0 -= (m_row[jj]*vx[col_id[jj]]);
 
-        register double r = ad[ii] * (vx0-vxm1);
+          vx0 *= ad_inv[ii];
 
-        vx[ii] = vx0;
+          register double r = ad[ii] * (vx0-vxm1);
+
+          vx[ii] = vx0;
+
+          res2 += (r*r);
+        }
 
-        res2 += (r*r);
       }
 
     }
     else {
 
-#     pragma omp parallel for reduction(+:res2) \
-                          if(n_rows > CS_THR_MIN  && !_thread_debug)
-      for (cs_lnum_t ll = 0; ll < n_rows; ll++) {
+#     pragma omp parallel reduction(+:res2) if(n_levels > 1)
+      for (cs_lnum_t l_id = 0; l_id < n_levels; l_id++) {
 
-        cs_lnum_t ii = order[ll];
+#       pragma omp for
+        for (cs_lnum_t ll = level_index[l_id];
+             ll < level_index[l_id+1];
+             ll++) {
 
-        const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
-        const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+          cs_lnum_t ii = order[ll];
 
-        cs_real_t vx0[DB_SIZE_MAX], vxm1[DB_SIZE_MAX], _vx[DB_SIZE_MAX];
+          const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
+          const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+          const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
 
-        for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
-          vxm1[kk] = vx[ii*db_size[1] + kk];
-          vx0[kk] = rhs[ii*db_size[1] + kk];
-        }
+          cs_real_t vx0[DB_SIZE_MAX], vxm1[DB_SIZE_MAX], _vx[DB_SIZE_MAX];
 
-        for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-          for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
-            vx0[kk] -= (m_row[jj]*vx[col_id[jj]*db_size[1] + kk]);
-        }
+          for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+            vxm1[kk] = vx[ii*db_size[1] + kk];
+            vx0[kk] = rhs[ii*db_size[1] + kk];
+          }
 
-        _fw_and_bw_lu_gs(ad_inv + db_size[3]*ii,
-                         db_size[0],
-                         _vx,
-                         vx0);
+          for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+            for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+              vx0[kk] -= (m_row[jj]*vx[col_id[jj]*db_size[1] + kk]);
+          }
+
+          _fw_and_bw_lu_gs(ad_inv + db_size[3]*ii,
+                           db_size[0],
+                           _vx,
+                           vx0);
+
+          double rr = 0;
+          for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+            register double r = ad[ii*db_size[1] + kk] * (_vx[kk]-vxm1[kk]);
+            rr += (r*r);
+            vx[ii*db_size[1] + kk] = _vx[kk];
+          }
+          res2 += rr;
 
-        double rr = 0;
-        for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
-          register double r = ad[ii*db_size[1] + kk] * (_vx[kk]-vxm1[kk]);
-          rr += (r*r);
-          vx[ii*db_size[1] + kk] = _vx[kk];
         }
-        res2 += rr;
 
       }
 
@@ -3753,6 +4114,8 @@ cs_sles_it_destroy(void **context)
     }
     if (c->add_data != NULL) {
       BFT_FREE(c->add_data->order);
+      BFT_FREE(c->add_data->level_index);
+      BFT_FREE(c->add_data->level_order);
       BFT_FREE(c->add_data);
     }
     BFT_FREE(c);
@@ -3991,6 +4354,10 @@ cs_sles_it_setup(void               *context,
     c->solve = _flexible_conjugate_gradient;
     break;
 
+  case CS_SLES_PCG_PIPELINED:
+    c->solve = _conjugate_gradient_pipelined;
+    break;
+
   case CS_SLES_IPCG:
     c->solve = _conjugate_gradient_ip;
     break;
@@ -4510,10 +4877,19 @@ cs_sles_it_assign_order(cs_sles_it_t   *context,
     if (context->add_data == NULL) {
       BFT_MALLOC(context->add_data, 1, cs_sles_it_add_t);
       context->add_data->order = NULL;
+      context->add_data->level_index = NULL;
+      context->add_data->level_order = NULL;
     }
 
     BFT_FREE(context->add_data->order);
 
+    /* Wavefront levels will be rebuilt for the new ordering */
+
+    context->add_data->n_level_rows = 0;
+    context->add_data->n_levels = 0;
+    BFT_FREE(context->add_data->level_index);
+    BFT_FREE(context->add_data->level_order);
+
     context->add_data->order = *order;
 
     *order = NULL;
@@ -69,6 +69,9 @@ typedef enum {
   CS_SLES_P_GAUSS_SEIDEL,      /*!< Process-local Gauss-Seidel */
   CS_SLES_P_SYM_GAUSS_SEIDEL,  /*!< Process-local symmetric Gauss-Seidel */
   CS_SLES_PCR3,                /*!< 3-layer conjugate residual */
+  CS_SLES_PCG_PIPELINED,       /*!< Pipelined preconditioned conjugate
+                                    gradient, described in
+                                    \cite Ghysels:2014 */
 
   CS_SLES_N_IT_TYPES,          /*!< Number of resolution algorithms
                                     excluding smoother only*/
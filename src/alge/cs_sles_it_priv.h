@@ -146,6 +146,13 @@ typedef struct _cs_sles_it_add_t {
 
   cs_lnum_t           *order;            /* ordering */
 
+  cs_lnum_t            n_level_rows;     /* number of rows associated
+                                            with wavefront levels */
+  cs_lnum_t            n_levels;         /* number of wavefront levels */
+  cs_lnum_t           *level_index;      /* wavefront level index
+                                            (size: n_levels + 1) */
+  cs_lnum_t           *level_order;      /* ordering grouped by level */
+
 } cs_sles_it_add_t;
 
 /* Basic per linear system options and logging */
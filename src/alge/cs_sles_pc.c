@@ -213,6 +213,7 @@ BEGIN_C_DECLS
   - Jacobi
   - polynomial of degree 1
   - polynomial of degree 2
+  - ILU(0), with block variant for matrices with diagonal blocks
 
   Polynomial preconditioning is explained here:
   \a D being the diagonal part of matrix \a A and \a X its extra-diagonal
@@ -250,6 +251,10 @@ BEGIN_C_DECLS
 
 #define CS_SIMD_SIZE(s) (((s-1)/16+1)*16)
 
+/* Maximum diagonal block size handled by ILU(0) preconditioner */
+
+#define CS_SLES_PC_ILU0_DB_SIZE_MAX 8
+
 /*=============================================================================
  * Local Structure Definitions
  *============================================================================*/
@@ -296,6 +301,33 @@ typedef struct {
 
 } cs_sles_pc_poly_t;
 
+/* Structure for ILU(0) preconditioner */
+/*-------------------------------------*/
+
+typedef struct {
+
+  cs_lnum_t            n_rows;            /* Number of associated block rows */
+  cs_lnum_t            db_size;           /* Diagonal block size */
+  cs_lnum_t            v_stride;          /* Vector stride per block row */
+
+  cs_lnum_t           *row_index;         /* Local CSR row index
+                                             (size: n_rows + 1) */
+  cs_lnum_t           *col_id;            /* Local column ids (sorted,
+                                             diagonal included) */
+  cs_lnum_t           *diag_id;           /* Position of diagonal in rows */
+  cs_real_t           *val;               /* Factor values: unit L below
+                                             diagonal, U above, and
+                                             inverted U diagonal blocks */
+
+  int                  n_l_levels;        /* Number of forward levels */
+  int                  n_u_levels;        /* Number of backward levels */
+  cs_lnum_t           *l_level_index;     /* Forward level rows index */
+  cs_lnum_t           *u_level_index;     /* Backward level rows index */
+  cs_lnum_t           *l_level_row_id;    /* Rows ordered by forward level */
+  cs_lnum_t           *u_level_row_id;    /* Rows ordered by backward level */
+
+} cs_sles_pc_ilu0_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -661,6 +693,765 @@ _sles_pc_poly_destroy (void  **context)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Create an ILU(0) preconditioner structure.
+ *
+ * returns:
+ *   pointer to newly created preconditioner object.
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_pc_ilu0_t *
+_sles_pc_ilu0_create(void)
+{
+  cs_sles_pc_ilu0_t *pc;
+
+  BFT_MALLOC(pc, 1, cs_sles_pc_ilu0_t);
+
+  pc->n_rows = 0;
+  pc->db_size = 0;
+  pc->v_stride = 0;
+
+  pc->row_index = NULL;
+  pc->col_id = NULL;
+  pc->diag_id = NULL;
+  pc->val = NULL;
+
+  pc->n_l_levels = 0;
+  pc->n_u_levels = 0;
+  pc->l_level_index = NULL;
+  pc->u_level_index = NULL;
+  pc->l_level_row_id = NULL;
+  pc->u_level_row_id = NULL;
+
+  return pc;
+}
+
+/*----------------------------------------------------------------------------
+ * Function returning the type name of ILU(0) preconditioner context.
+ *
+ * parameters:
+ *   context   <-- pointer to preconditioner context
+ *   logging   <-- if true, logging description; if false, canonical name
+ *----------------------------------------------------------------------------*/
+
+static const char *
+_sles_pc_ilu0_get_type(const void  *context,
+                       bool         logging)
+{
+  CS_UNUSED(context);
+
+  if (logging == false) {
+    static const char t[] = "ilu0";
+    return t;
+  }
+  else {
+    static const char t[] = N_("ILU(0)");
+    return _(t);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Function for freeing of an ILU(0) preconditioner's context data.
+ *
+ * parameters:
+ *   context <-> pointer to preconditioner context
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_pc_ilu0_free(void  *context)
+{
+  cs_sles_pc_ilu0_t  *c = context;
+
+  c->n_rows = 0;
+  c->db_size = 0;
+  c->v_stride = 0;
+
+  BFT_FREE(c->row_index);
+  BFT_FREE(c->col_id);
+  BFT_FREE(c->diag_id);
+  BFT_FREE(c->val);
+
+  c->n_l_levels = 0;
+  c->n_u_levels = 0;
+  BFT_FREE(c->l_level_index);
+  BFT_FREE(c->u_level_index);
+  BFT_FREE(c->l_level_row_id);
+  BFT_FREE(c->u_level_row_id);
+}
+
+/*----------------------------------------------------------------------------
+ * Invert a small dense block in place, using Gauss-Jordan elimination
+ * with partial pivoting.
+ *
+ * parameters:
+ *   n <-- block size
+ *   a <-> block values (row-major), replaced by its inverse
+ *
+ * returns:
+ *   0 if inversion succeeded, 1 if the block is singular
+ *----------------------------------------------------------------------------*/
+
+static inline int
+_ilu0_block_invert(cs_lnum_t   n,
+                   cs_real_t  *a)
+{
+  cs_lnum_t perm[CS_SLES_PC_ILU0_DB_SIZE_MAX];
+
+  for (cs_lnum_t ii = 0; ii < n; ii++)
+    perm[ii] = ii;
+
+  for (cs_lnum_t kk = 0; kk < n; kk++) {
+
+    /* Partial pivoting */
+
+    cs_lnum_t p = kk;
+    cs_real_t p_max = fabs(a[kk*n + kk]);
+    for (cs_lnum_t ii = kk+1; ii < n; ii++) {
+      if (fabs(a[ii*n + kk]) > p_max) {
+        p = ii;
+        p_max = fabs(a[ii*n + kk]);
+      }
+    }
+    if (p_max <= 0.)
+      return 1;
+
+    if (p != kk) {
+      for (cs_lnum_t jj = 0; jj < n; jj++) {
+        cs_real_t t = a[kk*n + jj];
+        a[kk*n + jj] = a[p*n + jj];
+        a[p*n + jj] = t;
+      }
+      cs_lnum_t t = perm[kk]; perm[kk] = perm[p]; perm[p] = t;
+    }
+
+    /* Elimination */
+
+    cs_real_t d_inv = 1. / a[kk*n + kk];
+    a[kk*n + kk] = 1.;
+    for (cs_lnum_t jj = 0; jj < n; jj++)
+      a[kk*n + jj] *= d_inv;
+
+    for (cs_lnum_t ii = 0; ii < n; ii++) {
+      if (ii != kk) {
+        cs_real_t f = a[ii*n + kk];
+        a[ii*n + kk] = 0.;
+        for (cs_lnum_t jj = 0; jj < n; jj++)
+          a[ii*n + jj] -= f * a[kk*n + jj];
+      }
+    }
+
+  }
+
+  /* Undo row permutation (which becomes a column permutation
+     of the inverse) */
+
+  for (cs_lnum_t ii = 0; ii < n; ii++) {
+    cs_real_t t[CS_SLES_PC_ILU0_DB_SIZE_MAX];
+    for (cs_lnum_t jj = 0; jj < n; jj++)
+      t[perm[jj]] = a[ii*n + jj];
+    for (cs_lnum_t jj = 0; jj < n; jj++)
+      a[ii*n + jj] = t[jj];
+  }
+
+  return 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Build level sets for forward and backward substitution.
+ *
+ * Rows in a given level only depend on rows of previous levels, so that
+ * rows of a same level may be handled in parallel.
+ *
+ * parameters:
+ *   c <-> pointer to preconditioner context
+ *----------------------------------------------------------------------------*/
+
+static void
+_ilu0_build_levels(cs_sles_pc_ilu0_t  *c)
+{
+  const cs_lnum_t n_rows = c->n_rows;
+  const cs_lnum_t *restrict row_index = c->row_index;
+  const cs_lnum_t *restrict col_id = c->col_id;
+  const cs_lnum_t *restrict diag_id = c->diag_id;
+
+  int *level;
+  BFT_MALLOC(level, n_rows, int);
+
+  for (int s_id = 0; s_id < 2; s_id++) {
+
+    int n_levels = 0;
+
+    if (s_id == 0) { /* forward: depends on lower part */
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        int l = 0;
+        for (cs_lnum_t jj = row_index[ii]; jj < diag_id[ii]; jj++) {
+          if (level[col_id[jj]] >= l)
+            l = level[col_id[jj]] + 1;
+        }
+        level[ii] = l;
+        if (l >= n_levels)
+          n_levels = l + 1;
+      }
+    }
+    else { /* backward: depends on upper part */
+      for (cs_lnum_t ii = n_rows - 1; ii > -1; ii--) {
+        int l = 0;
+        for (cs_lnum_t jj = diag_id[ii] + 1; jj < row_index[ii+1]; jj++) {
+          if (level[col_id[jj]] >= l)
+            l = level[col_id[jj]] + 1;
+        }
+        level[ii] = l;
+        if (l >= n_levels)
+          n_levels = l + 1;
+      }
+    }
+
+    cs_lnum_t *level_index, *level_row_id;
+    BFT_MALLOC(level_index, n_levels + 1, cs_lnum_t);
+    BFT_MALLOC(level_row_id, n_rows, cs_lnum_t);
+
+    for (int l = 0; l < n_levels + 1; l++)
+      level_index[l] = 0;
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      level_index[level[ii] + 1] += 1;
+    for (int l = 0; l < n_levels; l++)
+      level_index[l+1] += level_index[l];
+
+    /* Rows remain in increasing order inside a level */
+
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      int l = level[ii];
+      level_row_id[level_index[l]] = ii;
+      level_index[l] += 1;
+    }
+    for (int l = n_levels; l > 0; l--)
+      level_index[l] = level_index[l-1];
+    level_index[0] = 0;
+
+    if (s_id == 0) {
+      c->n_l_levels = n_levels;
+      c->l_level_index = level_index;
+      c->l_level_row_id = level_row_id;
+    }
+    else {
+      c->n_u_levels = n_levels;
+      c->u_level_index = level_index;
+      c->u_level_row_id = level_row_id;
+    }
+
+  }
+
+  BFT_FREE(level);
+}
+
+/*----------------------------------------------------------------------------
+ * Factorize a given row for ILU(0), scalar case.
+ *
+ * All rows on which this row depends must have been factorized.
+ *
+ * parameters:
+ *   c  <-> pointer to preconditioner context
+ *   ii <-- row id
+ *
+ * returns:
+ *   0 on success, 1 in case of zero pivot
+ *----------------------------------------------------------------------------*/
+
+static inline int
+_ilu0_factor_row(cs_sles_pc_ilu0_t  *c,
+                 cs_lnum_t           ii)
+{
+  const cs_lnum_t *restrict row_index = c->row_index;
+  const cs_lnum_t *restrict col_id = c->col_id;
+  const cs_lnum_t *restrict diag_id = c->diag_id;
+  cs_real_t *restrict val = c->val;
+
+  const cs_lnum_t e_id = row_index[ii+1];
+
+  for (cs_lnum_t kp = row_index[ii]; kp < diag_id[ii]; kp++) {
+
+    const cs_lnum_t kk = col_id[kp];
+
+    /* Diagonal of previous rows is stored inverted */
+
+    val[kp] *= val[diag_id[kk]];
+    const cs_real_t l_ik = val[kp];
+
+    /* Update row ii entries matching row kk's upper part
+       (both are sorted, so a merge suffices) */
+
+    cs_lnum_t jp = kp + 1;
+    for (cs_lnum_t kj = diag_id[kk] + 1; kj < row_index[kk+1]; kj++) {
+      const cs_lnum_t jj = col_id[kj];
+      while (jp < e_id && col_id[jp] < jj)
+        jp++;
+      if (jp >= e_id)
+        break;
+      if (col_id[jp] == jj)
+        val[jp] -= l_ik * val[kj];
+    }
+
+  }
+
+  if (fabs(val[diag_id[ii]]) <= 0.)
+    return 1;
+
+  val[diag_id[ii]] = 1. / val[diag_id[ii]];
+
+  return 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Factorize a given row for ILU(0), block case.
+ *
+ * All rows on which this row depends must have been factorized.
+ *
+ * parameters:
+ *   c  <-> pointer to preconditioner context
+ *   ii <-- row id
+ *
+ * returns:
+ *   0 on success, 1 in case of singular pivot block
+ *----------------------------------------------------------------------------*/
+
+static inline int
+_ilu0_factor_row_block(cs_sles_pc_ilu0_t  *c,
+                       cs_lnum_t           ii)
+{
+  const cs_lnum_t *restrict row_index = c->row_index;
+  const cs_lnum_t *restrict col_id = c->col_id;
+  const cs_lnum_t *restrict diag_id = c->diag_id;
+  cs_real_t *restrict val = c->val;
+
+  const cs_lnum_t n = c->db_size;
+  const cs_lnum_t b_size = n*n;
+  const cs_lnum_t e_id = row_index[ii+1];
+
+  cs_real_t t[CS_SLES_PC_ILU0_DB_SIZE_MAX*CS_SLES_PC_ILU0_DB_SIZE_MAX];
+
+  for (cs_lnum_t kp = row_index[ii]; kp < diag_id[ii]; kp++) {
+
+    const cs_lnum_t kk = col_id[kp];
+
+    /* L_ik = A_ik.inv(U_kk) (diagonal of previous rows stored inverted) */
+
+    cs_real_t *restrict l_ik = val + kp*b_size;
+    const cs_real_t *restrict u_kk_inv = val + diag_id[kk]*b_size;
+
+    for (cs_lnum_t k0 = 0; k0 < n; k0++) {
+      for (cs_lnum_t k1 = 0; k1 < n; k1++) {
+        cs_real_t s = 0;
+        for (cs_lnum_t k2 = 0; k2 < n; k2++)
+          s += l_ik[k0*n + k2] * u_kk_inv[k2*n + k1];
+        t[k0*n + k1] = s;
+      }
+    }
+    for (cs_lnum_t k0 = 0; k0 < b_size; k0++)
+      l_ik[k0] = t[k0];
+
+    /* A_ij -= L_ik.U_kj for entries matching row kk's upper part */
+
+    cs_lnum_t jp = kp + 1;
+    for (cs_lnum_t kj = diag_id[kk] + 1; kj < row_index[kk+1]; kj++) {
+      const cs_lnum_t jj = col_id[kj];
+      while (jp < e_id && col_id[jp] < jj)
+        jp++;
+      if (jp >= e_id)
+        break;
+      if (col_id[jp] == jj) {
+        cs_real_t *restrict a_ij = val + jp*b_size;
+        const cs_real_t *restrict u_kj = val + kj*b_size;
+        for (cs_lnum_t k0 = 0; k0 < n; k0++) {
+          for (cs_lnum_t k1 = 0; k1 < n; k1++) {
+            cs_real_t s = 0;
+            for (cs_lnum_t k2 = 0; k2 < n; k2++)
+              s += l_ik[k0*n + k2] * u_kj[k2*n + k1];
+            a_ij[k0*n + k1] -= s;
+          }
+        }
+      }
+    }
+
+  }
+
+  return _ilu0_block_invert(n, val + diag_id[ii]*b_size);
+}
+
+/*----------------------------------------------------------------------------
+ * Function for setup of an ILU(0) preconditioner context.
+ *
+ * The factorization is restricted to the local (rank) part of the matrix,
+ * so in parallel this is a block Jacobi preconditioner with ILU(0) blocks.
+ * Rows are grouped by dependency levels, so both the factorization and
+ * triangular solves may be threaded while yielding the same result as a
+ * sequential ILU(0) in the natural order.
+ *
+ * parameters:
+ *   context   <-> pointer to preconditioner context
+ *   name      <-- pointer to name of associated linear system
+ *   a         <-- matrix
+ *   verbosity <-- associated verbosity
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_pc_ilu0_setup(void               *context,
+                    const char         *name,
+                    const cs_matrix_t  *a,
+                    int                 verbosity)
+{
+  cs_sles_pc_ilu0_t  *c = context;
+
+  const cs_matrix_type_t m_type = cs_matrix_get_type(a);
+  const cs_lnum_t *db_size = cs_matrix_get_diag_block_size(a);
+  const cs_lnum_t *eb_size = cs_matrix_get_extra_diag_block_size(a);
+
+  if (   (m_type != CS_MATRIX_MSR && m_type != CS_MATRIX_CSR)
+      || (m_type == CS_MATRIX_CSR && db_size[0] > 1))
+    bft_error
+      (__FILE__, __LINE__, 0,
+       _("ILU(0) preconditioner for linear system \"%s\" only supported\n"
+         "with a matrix using %s (%s) storage, or %s (%s) storage\n"
+         "for scalar systems."),
+       name,
+       cs_matrix_type_name[CS_MATRIX_MSR],
+       _(cs_matrix_type_fullname[CS_MATRIX_MSR]),
+       cs_matrix_type_name[CS_MATRIX_CSR],
+       _(cs_matrix_type_fullname[CS_MATRIX_CSR]));
+
+  if (eb_size[0] > 1 || db_size[0] > CS_SLES_PC_ILU0_DB_SIZE_MAX)
+    bft_error
+      (__FILE__, __LINE__, 0,
+       _("ILU(0) preconditioner for linear system \"%s\" only supported\n"
+         "with diagonal blocks of size up to %d and scalar extra-diagonal\n"
+         "terms."),
+       name, CS_SLES_PC_ILU0_DB_SIZE_MAX);
+
+  const cs_lnum_t  *a_row_index, *a_col_id;
+  const cs_real_t  *a_d_val = NULL, *a_x_val = NULL;
+
+  if (m_type == CS_MATRIX_MSR)
+    cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
+  else
+    cs_matrix_get_csr_arrays(a, &a_row_index, &a_col_id, &a_x_val);
+
+  if (a_x_val == NULL)
+    bft_error
+      (__FILE__, __LINE__, 0,
+       _("ILU(0) preconditioner for linear system \"%s\" requires\n"
+         "access to double precision extra-diagonal matrix coefficients."),
+       name);
+
+  _sles_pc_ilu0_free(c);
+
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+  const cs_lnum_t n = db_size[0];
+  const cs_lnum_t b_size = n*n;
+
+  c->n_rows = n_rows;
+  c->db_size = n;
+  c->v_stride = db_size[1];
+
+  /* Build local structure: columns referencing ghost values are dropped,
+     and the diagonal is included in the row; src_id is the position
+     of matching values in the matrix (-1 for separate diagonal) */
+
+  BFT_MALLOC(c->row_index, n_rows + 1, cs_lnum_t);
+  BFT_MALLOC(c->diag_id, n_rows, cs_lnum_t);
+
+  cs_lnum_t *restrict row_index = c->row_index;
+
+  row_index[0] = 0;
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    cs_lnum_t n_cols = (m_type == CS_MATRIX_MSR) ? 1 : 0;
+    for (cs_lnum_t jj = a_row_index[ii]; jj < a_row_index[ii+1]; jj++) {
+      if (a_col_id[jj] < n_rows)
+        n_cols++;
+    }
+    row_index[ii+1] = row_index[ii] + n_cols;
+  }
+
+  const cs_lnum_t nnz = row_index[n_rows];
+
+  cs_lnum_t *src_id;
+  BFT_MALLOC(c->col_id, nnz, cs_lnum_t);
+  BFT_MALLOC(src_id, nnz, cs_lnum_t);
+  BFT_MALLOC(c->val, nnz*b_size, cs_real_t);
+
+  cs_lnum_t *restrict col_id = c->col_id;
+  cs_lnum_t *restrict diag_id = c->diag_id;
+  cs_real_t *restrict val = c->val;
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+    cs_lnum_t s_id = row_index[ii];
+    cs_lnum_t e_id = s_id;
+
+    if (m_type == CS_MATRIX_MSR) {
+      col_id[e_id] = ii;
+      src_id[e_id] = -1;
+      e_id++;
+    }
+    for (cs_lnum_t jj = a_row_index[ii]; jj < a_row_index[ii+1]; jj++) {
+      if (a_col_id[jj] < n_rows) {
+        col_id[e_id] = a_col_id[jj];
+        src_id[e_id] = jj;
+        e_id++;
+      }
+    }
+
+    /* Sort row by column id (insertion sort, as rows are short) */
+
+    for (cs_lnum_t jj = s_id + 1; jj < e_id; jj++) {
+      cs_lnum_t c_id = col_id[jj], v_id = src_id[jj];
+      cs_lnum_t kk = jj - 1;
+      while (kk >= s_id && col_id[kk] > c_id) {
+        col_id[kk+1] = col_id[kk];
+        src_id[kk+1] = src_id[kk];
+        kk--;
+      }
+      col_id[kk+1] = c_id;
+      src_id[kk+1] = v_id;
+    }
+
+    diag_id[ii] = -1;
+
+    for (cs_lnum_t jj = s_id; jj < e_id; jj++) {
+
+      if (col_id[jj] == ii)
+        diag_id[ii] = jj;
+
+      cs_real_t *restrict _val = val + jj*b_size;
+
+      if (src_id[jj] < 0) {
+        const cs_real_t *restrict _d_val = a_d_val + ii*db_size[3];
+        for (cs_lnum_t k0 = 0; k0 < n; k0++) {
+          for (cs_lnum_t k1 = 0; k1 < n; k1++)
+            _val[k0*n + k1] = _d_val[k0*db_size[2] + k1];
+        }
+      }
+      else {
+        for (cs_lnum_t k0 = 0; k0 < b_size; k0++)
+          _val[k0] = 0.;
+        for (cs_lnum_t k0 = 0; k0 < n; k0++)
+          _val[k0*n + k0] = a_x_val[src_id[jj]];
+      }
+
+    }
+
+  }
+
+  BFT_FREE(src_id);
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    if (diag_id[ii] < 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("ILU(0) preconditioner for linear system \"%s\":\n"
+                  "row %ld has no diagonal coefficient."),
+                name, (long)ii);
+  }
+
+  /* Build levels, then factorize */
+
+  _ilu0_build_levels(c);
+
+  cs_gnum_t n_zero_pivots = 0;
+
+  for (int l = 0; l < c->n_l_levels; l++) {
+
+    const cs_lnum_t s_id = c->l_level_index[l];
+    const cs_lnum_t e_id = c->l_level_index[l+1];
+    const cs_lnum_t *restrict l_row_id = c->l_level_row_id;
+
+    if (n == 1) {
+#     pragma omp parallel for reduction(+:n_zero_pivots) \
+                          if(e_id - s_id > CS_THR_MIN)
+      for (cs_lnum_t ll = s_id; ll < e_id; ll++)
+        n_zero_pivots += _ilu0_factor_row(c, l_row_id[ll]);
+    }
+    else {
+#     pragma omp parallel for reduction(+:n_zero_pivots) \
+                          if(e_id - s_id > CS_THR_MIN)
+      for (cs_lnum_t ll = s_id; ll < e_id; ll++)
+        n_zero_pivots += _ilu0_factor_row_block(c, l_row_id[ll]);
+    }
+
+  }
+
+  if (n_zero_pivots > 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("ILU(0) preconditioner for linear system \"%s\":\n"
+                "%llu zero or singular pivots in factorization."),
+              name, (unsigned long long)n_zero_pivots);
+
+  if (verbosity > 1)
+    bft_printf(_("  ILU(0) setup for \"%s\": %d forward and %d backward\n"
+                 "    levels for %ld rows.\n"),
+               name, c->n_l_levels, c->n_u_levels, (long)n_rows);
+}
+
+/*----------------------------------------------------------------------------
+ * Function for application of an ILU(0) preconditioner.
+ *
+ * In cases where it is desired that the preconditioner modify a vector
+ * "in place", x_in should be set to NULL, and x_out contain the vector to
+ * be modified (\f$x_{out} \leftarrow M^{-1}x_{out})\f$).
+ *
+ * parameters:
+ *   context       <-> pointer to preconditioner context
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   x_in          <-- input vector
+ *   x_out         <-> input/output vector
+ *
+ * returns:
+ *   preconditioner application status
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_pc_state_t
+_sles_pc_ilu0_apply(void                *context,
+                    cs_halo_rotation_t   rotation_mode,
+                    const cs_real_t     *x_in,
+                    cs_real_t           *x_out)
+{
+  CS_UNUSED(rotation_mode);
+
+  cs_sles_pc_ilu0_t  *c = context;
+
+  const cs_lnum_t n = c->db_size;
+  const cs_lnum_t b_size = n*n;
+  const cs_lnum_t stride = c->v_stride;
+
+  const cs_lnum_t *restrict row_index = c->row_index;
+  const cs_lnum_t *restrict col_id = c->col_id;
+  const cs_lnum_t *restrict diag_id = c->diag_id;
+  const cs_real_t *restrict val = c->val;
+
+  if (x_in != NULL) {
+    const cs_lnum_t n_vals = c->n_rows * stride;
+#   pragma omp parallel for if(n_vals > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+      x_out[ii] = x_in[ii];
+  }
+
+  /* Forward substitution (unit lower triangular part), in place */
+
+  for (int l = 0; l < c->n_l_levels; l++) {
+
+    const cs_lnum_t s_id = c->l_level_index[l];
+    const cs_lnum_t e_id = c->l_level_index[l+1];
+    const cs_lnum_t *restrict l_row_id = c->l_level_row_id;
+
+    if (n == 1) {
+#     pragma omp parallel for if(e_id - s_id > CS_THR_MIN)
+      for (cs_lnum_t ll = s_id; ll < e_id; ll++) {
+        const cs_lnum_t ii = l_row_id[ll];
+        cs_real_t s = x_out[ii];
+        for (cs_lnum_t jj = row_index[ii]; jj < diag_id[ii]; jj++)
+          s -= val[jj] * x_out[col_id[jj]];
+        x_out[ii] = s;
+      }
+    }
+    else {
+#     pragma omp parallel for if(e_id - s_id > CS_THR_MIN)
+      for (cs_lnum_t ll = s_id; ll < e_id; ll++) {
+        const cs_lnum_t ii = l_row_id[ll];
+        cs_real_t *restrict _x = x_out + ii*stride;
+        for (cs_lnum_t jj = row_index[ii]; jj < diag_id[ii]; jj++) {
+          const cs_real_t *restrict _v = val + jj*b_size;
+          const cs_real_t *restrict _y = x_out + col_id[jj]*stride;
+          for (cs_lnum_t k0 = 0; k0 < n; k0++) {
+            for (cs_lnum_t k1 = 0; k1 < n; k1++)
+              _x[k0] -= _v[k0*n + k1] * _y[k1];
+          }
+        }
+      }
+    }
+
+  }
+
+  /* Backward substitution (upper triangular part), in place */
+
+  for (int l = 0; l < c->n_u_levels; l++) {
+
+    const cs_lnum_t s_id = c->u_level_index[l];
+    const cs_lnum_t e_id = c->u_level_index[l+1];
+    const cs_lnum_t *restrict u_row_id = c->u_level_row_id;
+
+    if (n == 1) {
+#     pragma omp parallel for if(e_id - s_id > CS_THR_MIN)
+      for (cs_lnum_t ll = s_id; ll < e_id; ll++) {
+        const cs_lnum_t ii = u_row_id[ll];
+        cs_real_t s = x_out[ii];
+        for (cs_lnum_t jj = diag_id[ii] + 1; jj < row_index[ii+1]; jj++)
+          s -= val[jj] * x_out[col_id[jj]];
+        x_out[ii] = s * val[diag_id[ii]];
+      }
+    }
+    else {
+#     pragma omp parallel for if(e_id - s_id > CS_THR_MIN)
+      for (cs_lnum_t ll = s_id; ll < e_id; ll++) {
+        const cs_lnum_t ii = u_row_id[ll];
+        cs_real_t s[CS_SLES_PC_ILU0_DB_SIZE_MAX];
+        cs_real_t *restrict _x = x_out + ii*stride;
+        for (cs_lnum_t k0 = 0; k0 < n; k0++)
+          s[k0] = _x[k0];
+        for (cs_lnum_t jj = diag_id[ii] + 1; jj < row_index[ii+1]; jj++) {
+          const cs_real_t *restrict _v = val + jj*b_size;
+          const cs_real_t *restrict _y = x_out + col_id[jj]*stride;
+          for (cs_lnum_t k0 = 0; k0 < n; k0++) {
+            for (cs_lnum_t k1 = 0; k1 < n; k1++)
+              s[k0] -= _v[k0*n + k1] * _y[k1];
+          }
+        }
+        const cs_real_t *restrict _d_inv = val + diag_id[ii]*b_size;
+        for (cs_lnum_t k0 = 0; k0 < n; k0++) {
+          _x[k0] = 0.;
+          for (cs_lnum_t k1 = 0; k1 < n; k1++)
+            _x[k0] += _d_inv[k0*n + k1] * s[k1];
+        }
+      }
+    }
+
+  }
+
+  return CS_SLES_PC_CONVERGED;
+}
+
+/*----------------------------------------------------------------------------
+ * Function for creation of an ILU(0) preconditioner context based on the
+ * copy of another.
+ *
+ * parameters:
+ *   context  <-- context to clone
+ *
+ * returns:
+ *   pointer to newly created context
+ *----------------------------------------------------------------------------*/
+
+static void *
+_sles_pc_ilu0_clone(const void  *context)
+{
+  CS_UNUSED(context);
+
+  return _sles_pc_ilu0_create();
+}
+
+/*----------------------------------------------------------------------------
+ * Function pointer for destruction of an ILU(0) preconditioner context.
+ *
+ * parameters:
+ *   context <-> pointer to preconditioner context
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_pc_ilu0_destroy(void  **context)
+{
+  if (context != NULL) {
+    _sles_pc_ilu0_free(*context);
+    BFT_FREE(*context);
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1123,6 +1914,41 @@ cs_sles_pc_poly_2_create(void)
   return pc;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create an ILU(0) preconditioner.
+ *
+ * The factorization is based on the local part of the matrix (i.e. it is
+ * a block Jacobi preconditioner with ILU(0) blocks in parallel), and
+ * requires a matrix using MSR storage (or CSR storage for scalar systems).
+ * Matrices with diagonal blocks (such as 3x3 blocks for vector systems)
+ * are handled using a block ILU(0) factorization.
+ *
+ * Factorization and triangular solves are scheduled by dependency levels,
+ * so they may be threaded while using the natural row ordering.
+ *
+ * \return  pointer to newly created preconditioner object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_pc_t *
+cs_sles_pc_ilu0_create(void)
+{
+  cs_sles_pc_ilu0_t *pcp = _sles_pc_ilu0_create();
+
+  cs_sles_pc_t *pc = cs_sles_pc_define(pcp,
+                                       _sles_pc_ilu0_get_type,
+                                       _sles_pc_ilu0_setup,
+                                       NULL,
+                                       _sles_pc_ilu0_apply,
+                                       _sles_pc_ilu0_free,
+                                       NULL,
+                                       _sles_pc_ilu0_clone,
+                                       _sles_pc_ilu0_destroy);
+
+  return pc;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -508,6 +508,23 @@ cs_sles_pc_poly_1_create(void);
 cs_sles_pc_t *
 cs_sles_pc_poly_2_create(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create an ILU(0) preconditioner.
+ *
+ * The factorization is based on the local part of the matrix (i.e. it is
+ * a block Jacobi preconditioner with ILU(0) blocks in parallel), and
+ * requires a matrix using MSR storage (or CSR storage for scalar systems).
+ * Matrices with diagonal blocks (such as 3x3 blocks for vector systems)
+ * are handled using a block ILU(0) factorization.
+ *
+ * \return  pointer to newly created preconditioner object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_pc_t *
+cs_sles_pc_ilu0_create(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -58,6 +58,10 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(HAVE_ZLIB)
+#include <zlib.h>
+#endif
+
 /*----------------------------------------------------------------------------
  *  Local headers
  *----------------------------------------------------------------------------*/
@@ -80,7 +84,7 @@ typedef struct {
   size_t          size;              /* Current number of entries */
   size_t          max_size;          /* Maximum number of entries */
 
-  /* For each entry, we need 8 values, which we store in h_vals :
+  /* For each entry, we need 9 values, which we store in h_vals :
    *   0: number of values in section
    *   1: location_id
    *   2: index id
@@ -89,7 +93,8 @@ typedef struct {
    *   5: index of type name in types array
    *   6: index of embedded data in data array + 1 if data is
    *      embedded, 0 otherwise
-   *   7: associated file id (in case of multiple files)
+   *   7: body encoding (codec) id
+   *   8: size of encoded body in file (0 if not encoded)
    */
 
   long long      *h_vals;            /* Base values associated
@@ -138,6 +143,8 @@ typedef struct {
   const char     *name;           /* Pointer to name field in section header */
   const char     *type_name;      /* Pointer to type field in section header */
   void           *data;           /* Pointer to data in section header */
+  int             codec;          /* Body encoding (0 if none) */
+  size_t          body_size;      /* Size of encoded body */
 
   long long       offset;         /* Current position in file */
   int             swap_endian;    /* Swap big-endian and little-endian ? */
@@ -198,6 +205,13 @@ free(_ptr), _ptr = NULL
  * Static global variables
  *============================================================================*/
 
+/* Codec tags, appended to type names of encoded sections */
+
+static const char  *_codec_tag[] = {"  ", "rl", "zl"};
+static const char  *_codec_name[] = {N_("none"),
+                                     N_("shuffle + run-length"),
+                                     N_("shuffle + deflate")};
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -655,6 +669,8 @@ _open_input(const char  *filename,
   inp.name = NULL;
   inp.type_name = NULL;
   inp.data = NULL;
+  inp.codec = 0;
+  inp.body_size = 0;
 
   inp.offset = 0;
   inp.swap_endian = 0;
@@ -1178,6 +1194,173 @@ _type_size_from_name(const char  *type_name)
   return type_size;
 }
 
+/*----------------------------------------------------------------------------
+ * Revert byte-shuffling of values, converting from file (big-endian)
+ * byte order if necessary.
+ *
+ * parameters:
+ *   type_size <-- size of each value
+ *   n_vals    <-- number of values
+ *   swap      <-- swap byte order ?
+ *   src       <-- shuffled bytes
+ *   dst       --> values
+ *----------------------------------------------------------------------------*/
+
+static void
+_unshuffle(size_t                type_size,
+           size_t                n_vals,
+           int                   swap,
+           const unsigned char  *src,
+           unsigned char        *dst)
+{
+  size_t i, j;
+
+  for (j = 0; j < type_size; j++) {
+    const size_t k = (swap) ? type_size - 1 - j : j;
+    const unsigned char *_src = src + j*n_vals;
+    for (i = 0; i < n_vals; i++)
+      dst[i*type_size + k] = _src[i];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Decode a run-length encoded byte array.
+ *
+ * parameters:
+ *   src      <-- encoded bytes
+ *   n        <-- number of encoded bytes
+ *   dst      --> decoded bytes
+ *   dst_size <-- size of destination buffer
+ *
+ * returns:
+ *   size of decoded data, or 0 in case of inconsistent data
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_rle_decode(const unsigned char  *src,
+            size_t                n,
+            unsigned char        *dst,
+            size_t                dst_size)
+{
+  size_t i = 0, j = 0;
+
+  while (i < n) {
+    size_t c = src[i++];
+    if (c < 128) {
+      if (i + c + 1 > n || j + c + 1 > dst_size)
+        return 0;
+      memcpy(dst + j, src + i, c + 1);
+      i += c + 1;
+      j += c + 1;
+    }
+    else {
+      if (i >= n || j + c - 125 > dst_size)
+        return 0;
+      memset(dst + j, src[i++], c - 125);
+      j += c - 125;
+    }
+  }
+
+  return j;
+}
+
+/*----------------------------------------------------------------------------
+ * Read and decode values of an encoded section.
+ *
+ * The file pointer must be positioned at the start of the section body.
+ *
+ * parameters:
+ *   inp <-> pointer to input object
+ *
+ * returns:
+ *   pointer to allocated array of decoded values, in native byte order
+ *----------------------------------------------------------------------------*/
+
+static void *
+_read_encoded_values(_cs_io_t  *inp)
+{
+  size_t c, n_chunks = 0;
+  size_t raw_size = 0, max_raw_size = 0;
+  long long  n_chunks_l = 0;
+  long long  *table = NULL;
+  unsigned char *enc = NULL, *work = NULL, *dst = NULL;
+  unsigned char *data = NULL;
+
+  const size_t stride = (inp->n_loc_vals > 1) ? inp->n_loc_vals : 1;
+  const size_t n_elts = inp->n_vals / stride;
+  const size_t elt_size = stride*inp->type_size;
+
+  _file_read(&n_chunks_l, 8, 1, inp);
+  n_chunks = n_chunks_l;
+
+  if (16*n_chunks + 8 > inp->body_size)
+    _error(__FILE__, __LINE__, 0,
+           _("Error reading encoded section \"%s\" in file \"%s\"."),
+           inp->name, inp->filename);
+
+  MEM_MALLOC(table, n_chunks*2, long long);
+  MEM_MALLOC(enc, inp->body_size - 16*n_chunks - 8, unsigned char);
+  MEM_MALLOC(data, inp->n_vals*inp->type_size, unsigned char);
+
+  _file_read(table, 8, n_chunks*2, inp);
+  _file_read(enc, 1, inp->body_size - 16*n_chunks - 8, inp);
+
+  for (c = 0; c < n_chunks; c++) {
+    size_t c_end = (c+1 < n_chunks) ? (size_t)table[c*2 + 2] : n_elts + 1;
+    raw_size = (c_end - table[c*2])*elt_size;
+    if (raw_size > max_raw_size)
+      max_raw_size = raw_size;
+  }
+
+  MEM_MALLOC(work, max_raw_size, unsigned char);
+
+  dst = data;
+
+  for (c = 0; c < n_chunks; c++) {
+
+    size_t c_end = (c+1 < n_chunks) ? (size_t)table[c*2 + 2] : n_elts + 1;
+    size_t n_c_vals = (c_end - table[c*2])*stride;
+    size_t e_start = (c > 0) ? table[c*2 - 1] : 0;
+    size_t e_size = table[c*2 + 1] - e_start;
+    size_t dec_size = 0;
+    const unsigned char *shuffled = work;
+
+    raw_size = n_c_vals*inp->type_size;
+
+    if (e_size == raw_size) {
+      shuffled = enc + e_start;
+      dec_size = raw_size;
+    }
+    else if (inp->codec == 1)
+      dec_size = _rle_decode(enc + e_start, e_size, work, raw_size);
+
+#if defined(HAVE_ZLIB)
+    else if (inp->codec == 2) {
+      uLongf z_size = raw_size;
+      if (uncompress(work, &z_size, enc + e_start, e_size) == Z_OK)
+        dec_size = z_size;
+    }
+#endif
+
+    if (dec_size != raw_size)
+      _error(__FILE__, __LINE__, 0,
+             _("Error decoding section \"%s\" in file \"%s\"\n"
+               "(codec: %s, chunk %lu)."),
+             inp->name, inp->filename, _(_codec_name[inp->codec]),
+             (unsigned long)c);
+
+    _unshuffle(inp->type_size, n_c_vals, inp->swap_endian, shuffled, dst);
+
+    dst += raw_size;
+  }
+
+  MEM_FREE(work);
+  MEM_FREE(enc);
+  MEM_FREE(table);
+
+  return data;
+}
+
 /*----------------------------------------------------------------------------
  * Read section header.
  *
@@ -1252,11 +1435,37 @@ _read_section_header(_cs_io_t  *inp)
 
   inp->type_size = 0;
 
+  /* Encoded section: codec is appended to type name, and encoded
+     body size is stored in place of embedded data */
+
+  inp->codec = 0;
+  inp->body_size = 0;
+
+  if (header_vals[1] > 0 && inp->type_name[2] == ':') {
+    int i;
+    unsigned char *data = inp->buffer + 56 + header_vals[5];
+    for (i = 1; i < 3; i++) {
+      if (strncmp(inp->type_name + 3, _codec_tag[i], 2) == 0)
+        inp->codec = i;
+    }
+    if (inp->codec == 0)
+      _error(__FILE__, __LINE__, 0,
+             _("Encoding \"%s\" of section \"%s\" is not recognized."),
+             inp->type_name + 3, inp->name);
+    if (int_endian == 1)
+      _swap_endian(data, 8, 1);
+    _convert_size(data, &(inp->body_size), 1);
+    ((char *)(inp->type_name))[2] = '\0';
+  }
+
   if (inp->n_vals > 0) {
 
     inp->type_size = _type_size_from_name(inp->type_name);
 
-    if (inp->data == NULL)
+    if (inp->codec != 0)
+      body_size = inp->body_size;
+
+    else if (inp->data == NULL)
       body_size = inp->type_size*inp->n_vals;
 
     else if (int_endian == 1 && inp->type_size > 1)
@@ -1291,6 +1500,16 @@ _read_section_values(_cs_io_t    *inp,
   if (inp->data != NULL)
     printf(_("      Values in header\n"));
 
+  /* Encoded values are decoded in full, then handled as embedded values */
+
+  else if (inp->codec != 0) {
+    long long offset = _file_tell(inp);
+    size_t ba = inp->body_align;
+    offset += (ba - (offset % ba)) % ba;
+    _file_seek(inp, offset, SEEK_SET);
+    inp->data = _read_encoded_values(inp);
+  }
+
   /* Compute number of values to skip */
 
   if (inp->n_vals > echo*2) {
@@ -1372,6 +1591,9 @@ _read_section_values(_cs_io_t    *inp,
 
   if (buffer != NULL)
     MEM_FREE(buffer);
+
+  if (inp->codec != 0)
+    MEM_FREE(inp->data);
 }
 
 /*----------------------------------------------------------------------------
@@ -1393,7 +1615,11 @@ _skip_section_values(_cs_io_t    *inp)
   if (inp->data == NULL) {
     long long offset = _file_tell(inp);
     size_t ba = inp->body_align;
-    offset += (ba - (offset % ba)) % ba + inp->n_vals*inp->type_size;
+    offset += (ba - (offset % ba)) % ba;
+    if (inp->codec != 0)
+      offset += inp->body_size;
+    else
+      offset += inp->n_vals*inp->type_size;
     _file_seek(inp, offset, SEEK_SET);
   }
 }
@@ -1425,7 +1651,10 @@ _extract_section_values(_cs_io_t    *inp,
 
     /* Allocate buffer */
 
-    if (n_vals > 0) {
+    if (n_vals > 0 && inp->codec != 0)
+      data = _read_encoded_values(inp);
+
+    else if (n_vals > 0) {
       MEM_MALLOC(data, n_vals*inp->type_size, unsigned char);
       _file_read(data, inp->type_size, n_vals, inp);
     }
@@ -1629,6 +1858,10 @@ _read_section(_cs_io_t    *inp,
     if (inp->n_vals > 0)
       printf(_("    Type:                 \"%s\"\n"), inp->type_name);
 
+    if (inp->codec != 0)
+      printf(_("    Encoding:             %s (%lu bytes)\n"),
+             _(_codec_name[inp->codec]), (unsigned long)(inp->body_size));
+
     printf(_("      Location id:         %lu\n"
              "      Index id:            %lu\n"
              "      Values per location: %lu\n"),
@@ -1674,7 +1907,7 @@ _update_index_and_shift(_cs_io_t  *inp)
       idx->max_size = 32;
     else
       idx->max_size *= 2;
-    MEM_REALLOC(idx->h_vals, idx->max_size*8, long long);
+    MEM_REALLOC(idx->h_vals, idx->max_size*9, long long);
     MEM_REALLOC(idx->offset, idx->max_size, long long);
   };
 
@@ -1712,13 +1945,15 @@ _update_index_and_shift(_cs_io_t  *inp)
 
   id = idx->size;
 
-  idx->h_vals[id*8]     = inp->n_vals;
-  idx->h_vals[id*8 + 1] = inp->location_id;
-  idx->h_vals[id*8 + 2] = inp->index_id;
-  idx->h_vals[id*8 + 3] = inp->n_loc_vals;
-  idx->h_vals[id*8 + 4] = idx->names_size;
-  idx->h_vals[id*8 + 5] = idx->types_size;
-  idx->h_vals[id*8 + 6] = 0;
+  idx->h_vals[id*9]     = inp->n_vals;
+  idx->h_vals[id*9 + 1] = inp->location_id;
+  idx->h_vals[id*9 + 2] = inp->index_id;
+  idx->h_vals[id*9 + 3] = inp->n_loc_vals;
+  idx->h_vals[id*9 + 4] = idx->names_size;
+  idx->h_vals[id*9 + 5] = idx->types_size;
+  idx->h_vals[id*9 + 6] = 0;
+  idx->h_vals[id*9 + 7] = inp->codec;
+  idx->h_vals[id*9 + 8] = inp->body_size;
 
   strcpy(idx->names + idx->names_size, inp->name);
   idx->names[new_names_size - 1] = '\0';
@@ -1731,6 +1966,8 @@ _update_index_and_shift(_cs_io_t  *inp)
   if (inp->data == NULL) {
     long long offset = _file_tell(inp);
     long long data_shift = inp->n_vals * inp->type_size;
+    if (inp->codec != 0)
+      data_shift = inp->body_size;
     if (inp->body_align > 0) {
       size_t ba = inp->body_align;
       idx->offset[id] = offset + (ba - (offset % ba)) % ba;
@@ -1740,7 +1977,7 @@ _update_index_and_shift(_cs_io_t  *inp)
     _file_seek(inp, idx->offset[id] + data_shift, SEEK_SET);
   }
   else {
-    idx->h_vals[id*8 + 6] = idx->data_size + 1;
+    idx->h_vals[id*9 + 6] = idx->data_size + 1;
     memcpy(idx->data + idx->data_size,
            inp->data,
            new_data_size - idx->data_size);
@@ -1772,7 +2009,7 @@ _create_index(_cs_io_t  *inp,
   idx->size = 0;
   idx->max_size = 32;
 
-  MEM_MALLOC(idx->h_vals, idx->max_size*8, long long);
+  MEM_MALLOC(idx->h_vals, idx->max_size*9, long long);
   MEM_MALLOC(idx->offset, idx->max_size, long long);
 
   idx->max_names_size = 256;
@@ -1839,7 +2076,7 @@ _set_indexed_section(_cs_io_t  *inp,
                      int        section_id)
 {
   const _cs_io_sec_index_t *index = inp->index;
-  const long long *h_vals = index->h_vals + section_id*8;
+  const long long *h_vals = index->h_vals + section_id*9;
 
   inp->n_vals = h_vals[0];
   inp->location_id = h_vals[1];
@@ -1853,6 +2090,8 @@ _set_indexed_section(_cs_io_t  *inp,
   inp->type_name = index->types + h_vals[5];
   inp->offset = index->offset[section_id];
   inp->type_size = _type_size_from_name(inp->type_name);
+  inp->codec = h_vals[7];
+  inp->body_size = h_vals[8];
 }
 
 /*----------------------------------------------------------------------------
@@ -1880,7 +2119,7 @@ _find_and_extract_section(_cs_io_t    *inp,
   for (id = 0; id < index->size; id++) {
 
     int match = 1;
-    const long long *h_vals = index->h_vals + id*8;
+    const long long *h_vals = index->h_vals + id*9;
     const char *_name = index->names + h_vals[4];
     const int _location = h_vals[1];
 
@@ -2310,8 +2549,8 @@ _compare_sections(_cs_io_t    *inp1,
   const char no_type[] = " ";
   const _cs_io_sec_index_t  *index1 = inp1->index;
   const _cs_io_sec_index_t  *index2 = inp2->index;
-  const long long *h_vals1 = index1->h_vals + id1*8;
-  const long long *h_vals2 = index2->h_vals + id2*8;
+  const long long *h_vals1 = index1->h_vals + id1*9;
+  const long long *h_vals2 = index2->h_vals + id2*9;
   const char *type1 = no_type;
   const char *type2 = no_type;
   const unsigned long long n_vals1 = h_vals1[0];
@@ -2378,6 +2617,17 @@ _compare_sections(_cs_io_t    *inp1,
     _set_indexed_section(inp1, id1);
     _set_indexed_section(inp2, id2);
 
+    /* Encoded values are decoded in full, then handled as embedded values */
+
+    if (inp1->codec != 0) {
+      _file_seek(inp1, inp1->offset, SEEK_SET);
+      inp1->data = _read_encoded_values(inp1);
+    }
+    if (inp2->codec != 0) {
+      _file_seek(inp2, inp2->offset, SEEK_SET);
+      inp2->data = _read_encoded_values(inp2);
+    }
+
     if (inp1->data == NULL && inp2->data == NULL && block_size > max_block_size)
       block_size = max_block_size;
 
@@ -2445,10 +2695,13 @@ _compare_sections(_cs_io_t    *inp1,
     MEM_FREE(cmp1);
     MEM_FREE(cmp2);
 
-    if (buf1 != inp1->data)
+    if (buf1 != inp1->data || inp1->codec != 0)
       MEM_FREE(buf1);
-    if (buf2 != inp2->data)
+    if (buf2 != inp2->data || inp2->codec != 0)
       MEM_FREE(buf2);
+
+    inp1->data = NULL;
+    inp2->data = NULL;
   }
 
   return retval;
@@ -2466,7 +2719,7 @@ static void
 _echo_indexed_header(const _cs_io_sec_index_t  *index,
                      const size_t               id)
 {
-  const long long *h_vals = index->h_vals + id*8;
+  const long long *h_vals = index->h_vals + id*9;
   const char *name = index->names + h_vals[4];
   const long long n_vals = h_vals[0];
 
@@ -2532,7 +2785,7 @@ _compare_files(_cs_io_t    *inp1,
   for (i = 0; i < index1->size; i++) {
 
     int match_filter = 1;
-    const long long *h_vals1 = index1->h_vals + i*8;
+    const long long *h_vals1 = index1->h_vals + i*9;
     const char *_name1 = index1->names + h_vals1[4];
     const int _location1 = h_vals1[1];
 
@@ -2547,7 +2800,7 @@ _compare_files(_cs_io_t    *inp1,
 
       for (j = 0; j < index2->size; j++) {
 
-        const long long *h_vals2 = index2->h_vals + j*8;
+        const long long *h_vals2 = index2->h_vals + j*9;
         const char *_name2 = index2->names + h_vals2[4];
         const int _location2 = h_vals2[1];
 
@@ -2588,7 +2841,7 @@ _compare_files(_cs_io_t    *inp1,
 
   for (i = 0; i < index2->size; i++) {
 
-    const long long *h_vals2 = index2->h_vals + i*8;
+    const long long *h_vals2 = index2->h_vals + i*9;
     const char *_name2 = index2->names + h_vals2[4];
     const int _location2 = h_vals2[1];
 
@@ -81,6 +81,7 @@
 #include "cs_log_iteration.h"
 #include "cs_matrix_default.h"
 #include "cs_mesh.h"
+#include "cs_mesh_adapt.h"
 #include "cs_mesh_adjacencies.h"
 #include "cs_mesh_coherency.h"
 #include "cs_mesh_location.h"
@@ -541,6 +542,8 @@ _run(void)
 
   cs_lagr_finalize();
 
+  cs_mesh_adapt_finalize();
+
   /* Free main mesh after printing some statistics */
 
   cs_cell_to_vertex_free();
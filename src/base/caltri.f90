@@ -87,7 +87,7 @@ implicit none
 
 ! Local variables
 
-logical(kind=c_bool) :: mesh_modified, log_active
+logical(kind=c_bool) :: mesh_modified, mesh_adapted, log_active
 
 integer          modhis, iappel, iisuit
 integer          iel
@@ -194,6 +194,76 @@ interface
 
   !=============================================================================
 
+  subroutine cs_mesh_adapt_write_indicator()  &
+    bind(C, name='cs_mesh_adapt_write_indicator')
+    use, intrinsic :: iso_c_binding
+    implicit none
+  end subroutine cs_mesh_adapt_write_indicator
+
+  !=============================================================================
+
+  subroutine cs_load_balance_write_weights()  &
+    bind(C, name='cs_load_balance_write_weights')
+    use, intrinsic :: iso_c_binding
+    implicit none
+  end subroutine cs_load_balance_write_weights
+
+  !=============================================================================
+
+  function cs_load_balance_update() result(modified)  &
+    bind(C, name='cs_load_balance_update')
+    use, intrinsic :: iso_c_binding
+    implicit none
+    logical(kind=c_bool) :: modified
+  end function cs_load_balance_update
+
+  !=============================================================================
+
+  function cs_load_balance_get_interval() result(interval)  &
+    bind(C, name='cs_load_balance_get_interval')
+    use, intrinsic :: iso_c_binding
+    implicit none
+    integer(c_int) :: interval
+  end function cs_load_balance_get_interval
+
+  !=============================================================================
+
+  subroutine cs_load_balance_set_interval(interval)  &
+    bind(C, name='cs_load_balance_set_interval')
+    use, intrinsic :: iso_c_binding
+    implicit none
+    integer(c_int), value :: interval
+  end subroutine cs_load_balance_set_interval
+
+  !=============================================================================
+
+  function cs_mesh_adapt_update() result(modified)  &
+    bind(C, name='cs_mesh_adapt_update')
+    use, intrinsic :: iso_c_binding
+    implicit none
+    logical(kind=c_bool) :: modified
+  end function cs_mesh_adapt_update
+
+  !=============================================================================
+
+  function cs_mesh_adapt_get_interval() result(interval)  &
+    bind(C, name='cs_mesh_adapt_get_interval')
+    use, intrinsic :: iso_c_binding
+    implicit none
+    integer(c_int) :: interval
+  end function cs_mesh_adapt_get_interval
+
+  !=============================================================================
+
+  subroutine cs_mesh_adapt_set_interval(interval)  &
+    bind(C, name='cs_mesh_adapt_set_interval')
+    use, intrinsic :: iso_c_binding
+    implicit none
+    integer(c_int), value :: interval
+  end subroutine cs_mesh_adapt_set_interval
+
+  !=============================================================================
+
 end interface
 
 !===============================================================================
@@ -561,6 +631,22 @@ endif
 nent = 0
 call defsyn(nent)
 
+!===============================================================================
+! Options not handled by mesh modification during the computation
+!===============================================================================
+
+if (     ncpdct.gt.0 .or. nctsmt.gt.0 .or. nftcdt.gt.0                &
+    .or. icondv.eq.0 .or. nent.gt.0 .or. i_les_balance.gt.0) then
+  if (cs_load_balance_get_interval().gt.0) then
+    write(nfecra,3030)
+    call cs_load_balance_set_interval(0)
+  endif
+  if (cs_mesh_adapt_get_interval().gt.0) then
+    write(nfecra,3031)
+    call cs_mesh_adapt_set_interval(0)
+  endif
+endif
+
 !===============================================================================
 ! Possible restart
 !===============================================================================
@@ -987,6 +1073,10 @@ if (iisuit.eq.1) then
 
   call ecrava
 
+  call cs_mesh_adapt_write_indicator
+
+  call cs_load_balance_write_weights
+
   if (iturbo.eq.2 .and. iecaux.eq.1) then
     call trbsui
   endif
@@ -1098,6 +1188,21 @@ if (itrale.le.0) then
   write(nfecra,3012)titer2-titer1
 endif
 
+!===============================================================================
+! Possible adaptation or redistribution of the mesh and associated data
+!===============================================================================
+
+if (ntcabs.lt.ntmabs .and. itrale.gt.0) then
+  mesh_adapted = cs_mesh_adapt_update()
+  mesh_modified = cs_load_balance_update()
+  if (mesh_adapted .or. mesh_modified) then
+    call update_mesh_arrays
+    call field_get_val_s_by_name('dt', dt)
+  endif
+  ! Wall distance must be recomputed on the adapted mesh
+  if (mesh_adapted) imajdy = 0
+endif
+
 !===============================================================================
 ! End of time loop
 !===============================================================================
@@ -1248,6 +1353,16 @@ write(nfecra,7000)
  3021 format(/,/,                                                 &
  ' Write final restart files',/,                                  &
  '   checkpoint at iteration ',    I10,  ', Physical time ',E14.5,/,/)
+ 3030 format(/,                                                   &
+ ' Load balancing during the computation is not available with',/,&
+ '   head losses, mass or condensation source terms, synthetic',/,&
+ '   turbulence inlets or LES balance;',/,                        &
+ '   rebalancing will only be done at restart.',/)
+ 3031 format(/,                                                   &
+ ' Mesh adaptation during the computation is not available with',/,&
+ '   head losses, mass or condensation source terms, synthetic',/,&
+ '   turbulence inlets or LES balance;',/,                        &
+ '   adaptation will only be done at restart.',/)
 
  4000 format(/,/,                                                 &
 '===============================================================',&
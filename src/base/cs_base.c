@@ -1029,6 +1029,41 @@ _cs_base_mpi_setup(const char *app_name)
 #endif
 }
 
+#if (MPI_VERSION >= 2) && (defined(HAVE_OPENMP) || defined(HAVE_PTHREAD))
+
+/*----------------------------------------------------------------------------
+ * Return MPI thread support level to request at initialization.
+ *
+ * Background I/O threads (used for asynchronous output or checkpointing)
+ * call MPI functions concurrently, and thus require MPI_THREAD_MULTIPLE.
+ * As this level may degrade performance or not be supported with some
+ * MPI libraries, and MPI is initialized before the computation setup is
+ * known, it is only requested if the CS_MPI_THREAD_MULTIPLE environment
+ * variable is set to a positive value. Otherwise, asynchronous modes
+ * fall back to synchronous I/O.
+ *
+ * returns:
+ *   requested MPI thread support level
+ *----------------------------------------------------------------------------*/
+
+static int
+_mpi_thread_level(void)
+{
+  int level = MPI_THREAD_FUNNELED;
+
+#if defined(HAVE_PTHREAD)
+  const char *p = getenv("CS_MPI_THREAD_MULTIPLE");
+  if (p != NULL) {
+    if (atoi(p) > 0)
+      level = MPI_THREAD_MULTIPLE;
+  }
+#endif
+
+  return level;
+}
+
+#endif /* (MPI_VERSION >= 2) && (HAVE_OPENMP || HAVE_PTHREAD) */
+
 #endif /* HAVE_MPI */
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -1342,9 +1377,9 @@ cs_base_mpi_init(int    *argc,
   if (use_mpi == true) {
     MPI_Initialized(&flag);
     if (!flag) {
-#if (MPI_VERSION >= 2) && defined(HAVE_OPENMP)
+#if (MPI_VERSION >= 2) && (defined(HAVE_OPENMP) || defined(HAVE_PTHREAD))
       int mpi_threads;
-      MPI_Init_thread(argc, argv, MPI_THREAD_FUNNELED, &mpi_threads);
+      MPI_Init_thread(argc, argv, _mpi_thread_level(), &mpi_threads);
 #else
       MPI_Init(argc, argv);
 #endif
@@ -1370,9 +1405,9 @@ cs_base_mpi_init(int    *argc,
 
     MPI_Initialized(&flag);
     if (!flag) {
-#if (MPI_VERSION >= 2) && defined(HAVE_OPENMP)
+#if (MPI_VERSION >= 2) && (defined(HAVE_OPENMP) || defined(HAVE_PTHREAD))
       int mpi_threads;
-      MPI_Init_thread(argc, argv, MPI_THREAD_FUNNELED, &mpi_threads);
+      MPI_Init_thread(argc, argv, _mpi_thread_level(), &mpi_threads);
 #else
       MPI_Init(argc, argv);
 #endif
@@ -1612,6 +1647,13 @@ cs_base_mem_init(void)
           strcpy(file_name, base_name);
         }
 
+        /* Sampled call site statistics instead of full trace
+           if CS_MEM_LOG_SAMPLING is defined */
+
+        const char *s_period = getenv("CS_MEM_LOG_SAMPLING");
+        if (s_period != NULL)
+          bft_mem_sampling_set(atoi(s_period));
+
         /* Actually initialize bft_mem instrumentation only when
            CS_MEM_LOG is defined (for better performance) */
 
@@ -60,10 +60,13 @@
 #include "cs_interface.h"
 #include "cs_interpolate.h"
 #include "cs_internal_coupling.h"
+#include "cs_load_balance.h"
 #include "cs_log.h"
 #include "cs_map.h"
 #include "cs_math.h"
 #include "cs_measures_util.h"
+#include "cs_mesh_adapt.h"
+#include "cs_mesh_transfer.h"
 #include "cs_notebook.h"
 #include "cs_numbering.h"
 #include "cs_order.h"
@@ -773,6 +773,26 @@ cs_boundary_conditions_free(void)
   BFT_FREE(_bc_face_zone);
 }
 
+/*----------------------------------------------------------------------------
+ * Transfer the boundary conditions face type and face zone arrays
+ * after a mesh redistribution.
+ *
+ * parameters:
+ *   mt <-> pointer to mesh transfer structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_boundary_conditions_mesh_transfer(cs_mesh_transfer_t  *mt)
+{
+  cs_mesh_transfer_array(mt, CS_MESH_LOCATION_BOUNDARY_FACES,
+                         CS_INT_TYPE, 1, (void **)&_bc_type);
+  cs_glob_bc_type = _bc_type;
+
+  cs_mesh_transfer_array(mt, CS_MESH_LOCATION_BOUNDARY_FACES,
+                         CS_INT_TYPE, 1, (void **)&_bc_face_zone);
+  cs_glob_bc_face_zone = _bc_face_zone;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set convective oulet boundary condition for a scalar.
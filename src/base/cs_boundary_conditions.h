@@ -44,6 +44,7 @@
 #include "cs_field.h"
 #include "cs_math.h"
 #include "cs_mesh_location.h"
+#include "cs_mesh_transfer.h"
 
 /*----------------------------------------------------------------------------*/
 
@@ -192,6 +193,17 @@ cs_boundary_conditions_create(void);
 void
 cs_boundary_conditions_free(void);
 
+/*----------------------------------------------------------------------------
+ * Transfer the boundary conditions face type and face zone arrays
+ * after a mesh redistribution.
+ *
+ * parameters:
+ *   mt <-> pointer to mesh transfer structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_boundary_conditions_mesh_transfer(cs_mesh_transfer_t  *mt);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set Neumann BC for a scalar for a given face.
@@ -38,6 +38,7 @@
 
 #include <ple_defs.h>
 #include <ple_coupling.h>
+#include <ple_locator.h>
 
 /*----------------------------------------------------------------------------
  * Local headers
@@ -388,6 +389,54 @@ cs_coupling_set_ts_multiplier(double m)
   _cs_coupling_ts_multiplier = m;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the maximum number of bounding boxes used to describe the
+ *        coupled mesh of each rank for point location.
+ *
+ * See \ref cs_coupling_set_locator_max_rank_extents for details.
+ *
+ * \return  maximum number of bounding boxes per rank
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_coupling_get_locator_max_rank_extents(void)
+{
+#if defined(PLE_HAVE_MPI)
+  return ple_locator_get_max_rank_extents();
+#else
+  return 1;
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the maximum number of bounding boxes used to describe the
+ *        coupled mesh of each rank for point location.
+ *
+ * By default, a single bounding box is used for each rank. Using a higher
+ * value (such as 8 or 16) reduces the number of ranks to which points are
+ * sent for thin or curved coupling surfaces, whose bounding boxes overlap.
+ *
+ * This setting applies to all locators built after this call, including
+ * those of couplings with SYRTHES and code_saturne, so it should be
+ * defined in \ref cs_user_parameters.
+ *
+ * \param[in]  n_max_extents  maximum number of bounding boxes per rank
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_coupling_set_locator_max_rank_extents(int  n_max_extents)
+{
+#if defined(PLE_HAVE_MPI)
+  ple_locator_set_max_rank_extents(n_max_extents);
+#else
+  CS_UNUSED(n_max_extents);
+#endif
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Synchronize with applications in the same PLE coupling group.
@@ -628,9 +677,9 @@ cs_coupling_is_sync_active(void)
  *                                 element extents) to compute, or -1 to query
  * \param[in]       tolerance      addition to local extents of each element:
  *                                 extent = base_extent * (1 + tolerance)
- * \param[in, out]  extents        extents associated with mesh:
+ * \param[in, out]  extents        extents associated with mesh or elements:
  *                                 x_min, y_min, ..., x_max, y_max, ...
- *                                 (size: 2*dim)
+ *                                 (size: 2*dim*n_max_extents)
  *
  * \return  the number of extents computed
  */
@@ -648,11 +697,19 @@ cs_coupling_mesh_extents(const void  *mesh,
   if (m == NULL)
     return 0;
 
+  const int max_entity_dim = fvm_nodal_get_max_entity_dim(m);
+  const cs_lnum_t n_elts = fvm_nodal_get_n_entities(m, max_entity_dim);
+
   /* In query mode, return maximum extents available
-     (currently limited to 1) */
+     (extents of each element) */
 
   if (n_max_extents < 0)
-    retval = 1;
+    retval = CS_MAX(n_elts, 1);
+
+  /* If enough extents are requested, return element extents */
+
+  else if (n_max_extents > 1 && n_max_extents >= n_elts)
+    retval = fvm_nodal_element_extents(m, tolerance, extents);
 
   /* If n_max_extents > 0 return global mesh extents */
 
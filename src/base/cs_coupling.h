@@ -219,6 +219,38 @@ cs_coupling_get_ts_multiplier(void);
 void
 cs_coupling_set_ts_multiplier(double m);
 
+/*----------------------------------------------------------------------------
+ * Return the maximum number of bounding boxes used to describe the
+ * coupled mesh of each rank for point location.
+ *
+ * See cs_coupling_set_locator_max_rank_extents() for details.
+ *
+ * returns:
+ *   maximum number of bounding boxes per rank
+ *----------------------------------------------------------------------------*/
+
+int
+cs_coupling_get_locator_max_rank_extents(void);
+
+/*----------------------------------------------------------------------------
+ * Define the maximum number of bounding boxes used to describe the
+ * coupled mesh of each rank for point location.
+ *
+ * By default, a single bounding box is used for each rank. Using a higher
+ * value (such as 8 or 16) reduces the number of ranks to which points are
+ * sent for thin or curved coupling surfaces, whose bounding boxes overlap.
+ *
+ * This setting applies to all locators built after this call, including
+ * those of couplings with SYRTHES and code_saturne, so it should be
+ * defined in cs_user_parameters.
+ *
+ * parameters:
+ *   n_max_extents <-- maximum number of bounding boxes per rank
+ *----------------------------------------------------------------------------*/
+
+void
+cs_coupling_set_locator_max_rank_extents(int n_max_extents);
+
 /*----------------------------------------------------------------------------
  * Synchronize with applications in the same PLE coupling group.
  *
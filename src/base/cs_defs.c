@@ -153,7 +153,7 @@ MPI_Datatype  cs_datatype_to_mpi[] = {MPI_DATATYPE_NULL,
                                       MPI_DOUBLE,
                                       MPI_UNSIGNED_SHORT,
                                       MPI_INT,            /* CS_INT32 */
-                                      MPI_LONG_INT,       /* CS_INT64 */
+                                      MPI_LONG,           /* CS_INT64 */
                                       MPI_UNSIGNED,       /* CS_UINT32 */
                                       MPI_UNSIGNED_LONG}; /* CS_UINT64 */
 
@@ -1310,8 +1310,18 @@ cs_equation_iterative_solve_vector(int                   idtvar,
 
   bool symmetric = (isym == 1) ? true : false;
 
+  /* Extra-diagonal terms may be computed on the fly from face values
+     rather than assembled, if requested and possible
+     (not with the integral porosity model, which modifies face terms) */
+
+  bool matrix_free = false;
+  if (iesize == 1 && coupling_id < 0 && cs_glob_porous_model != 3)
+    matrix_free = cs_matrix_default_get_matrix_free
+                    (cs_matrix_get_fill_type(symmetric, db_size, eb_size));
+
   /*  be carefull here, xam is interleaved*/
-  if (iesize == 1)
+  xam = NULL;
+  if (iesize == 1 && !matrix_free)
     BFT_MALLOC(xam, isym*n_faces, cs_real_t);
   if (iesize == 3)
     BFT_MALLOC(xam, 3*3*isym*n_faces, cs_real_t);
@@ -1526,15 +1536,28 @@ cs_equation_iterative_solve_vector(int                   idtvar,
   /* Allocate a temporary array */
   BFT_MALLOC(w1, n_cells_ext, cs_real_3_t);
 
-  cs_matrix_vector_native_multiply(symmetric,
-                                   db_size,
-                                   eb_size,
-                                   rotation_mode,
-                                   f_id,
-                                   (cs_real_t *)dam,
-                                   xam,
-                                   (cs_real_t *)pvar,
-                                   (cs_real_t *)w1);
+  if (matrix_free)
+    cs_matrix_vector_native_multiply_from_faces(symmetric,
+                                                db_size,
+                                                rotation_mode,
+                                                f_id,
+                                                (cs_real_t *)dam,
+                                                thetap*iconvp,
+                                                thetap*idiffp,
+                                                i_massflux,
+                                                i_viscm,
+                                                (cs_real_t *)pvar,
+                                                (cs_real_t *)w1);
+  else
+    cs_matrix_vector_native_multiply(symmetric,
+                                     db_size,
+                                     eb_size,
+                                     rotation_mode,
+                                     f_id,
+                                     (cs_real_t *)dam,
+                                     xam,
+                                     (cs_real_t *)pvar,
+                                     (cs_real_t *)w1);
 
 # pragma omp parallel for
   for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
@@ -1604,20 +1627,38 @@ cs_equation_iterative_solve_vector(int                   idtvar,
                                     (cs_real_t *)dam,
                                     xam);
 
-    cs_sles_solve_native(f_id,
-                         var_name,
-                         symmetric,
-                         db_size,
-                         eb_size,
-                         (cs_real_t *)dam,
-                         xam,
-                         rotation_mode,
-                         epsilp,
-                         rnorm,
-                         &niterf,
-                         &ressol,
-                         (cs_real_t *)smbrp,
-                         (cs_real_t *)dpvar);
+    if (matrix_free)
+      cs_sles_solve_native_matrix_free(f_id,
+                                       var_name,
+                                       symmetric,
+                                       db_size,
+                                       (cs_real_t *)dam,
+                                       thetap*iconvp,
+                                       thetap*idiffp,
+                                       i_massflux,
+                                       i_viscm,
+                                       rotation_mode,
+                                       epsilp,
+                                       rnorm,
+                                       &niterf,
+                                       &ressol,
+                                       (cs_real_t *)smbrp,
+                                       (cs_real_t *)dpvar);
+    else
+      cs_sles_solve_native(f_id,
+                           var_name,
+                           symmetric,
+                           db_size,
+                           eb_size,
+                           (cs_real_t *)dam,
+                           xam,
+                           rotation_mode,
+                           epsilp,
+                           rnorm,
+                           &niterf,
+                           &ressol,
+                           (cs_real_t *)smbrp,
+                           (cs_real_t *)dpvar);
 
     /* Dynamic relaxation of the system */
     if (iswdyp >= 1) {
@@ -2139,8 +2180,18 @@ cs_equation_iterative_solve_tensor(int                   idtvar,
 
   bool symmetric = (isym == 1) ? true : false;
 
+  /* Extra-diagonal terms may be computed on the fly from face values
+     rather than assembled, if requested and possible
+     (not with the integral porosity model, which modifies face terms) */
+
+  bool matrix_free = false;
+  if (iesize == 1 && coupling_id < 0 && cs_glob_porous_model != 3)
+    matrix_free = cs_matrix_default_get_matrix_free
+                    (cs_matrix_get_fill_type(symmetric, db_size, eb_size));
+
   /*  be carefull here, xam is interleaved*/
-  if (iesize == 1)
+  xam = NULL;
+  if (iesize == 1 && !matrix_free)
     BFT_MALLOC(xam, isym*n_faces, cs_real_t);
   if (iesize == 6)
     BFT_MALLOC(xam, 6*6*isym*n_faces, cs_real_t);
@@ -2339,15 +2390,28 @@ cs_equation_iterative_solve_tensor(int                   idtvar,
   /* Allocate a temporary array */
   BFT_MALLOC(w1, n_cells_ext, cs_real_6_t);
 
-  cs_matrix_vector_native_multiply(symmetric,
-                                   db_size,
-                                   eb_size,
-                                   rotation_mode,
-                                   f_id,
-                                   (cs_real_t *)dam,
-                                   xam,
-                                   (cs_real_t *)pvar,
-                                   (cs_real_t *)w1);
+  if (matrix_free)
+    cs_matrix_vector_native_multiply_from_faces(symmetric,
+                                                db_size,
+                                                rotation_mode,
+                                                f_id,
+                                                (cs_real_t *)dam,
+                                                thetap*iconvp,
+                                                thetap*idiffp,
+                                                i_massflux,
+                                                i_viscm,
+                                                (cs_real_t *)pvar,
+                                                (cs_real_t *)w1);
+  else
+    cs_matrix_vector_native_multiply(symmetric,
+                                     db_size,
+                                     eb_size,
+                                     rotation_mode,
+                                     f_id,
+                                     (cs_real_t *)dam,
+                                     xam,
+                                     (cs_real_t *)pvar,
+                                     (cs_real_t *)w1);
 
 # pragma omp parallel for
   for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
@@ -2417,20 +2481,38 @@ cs_equation_iterative_solve_tensor(int                   idtvar,
                                     (cs_real_t *)dam,
                                     xam);
 
-    cs_sles_solve_native(f_id,
-                         var_name,
-                         symmetric,
-                         db_size,
-                         eb_size,
-                         (cs_real_t *)dam,
-                         xam,
-                         rotation_mode,
-                         epsilp,
-                         rnorm,
-                         &niterf,
-                         &ressol,
-                         (cs_real_t *)smbrp,
-                         (cs_real_t *)dpvar);
+    if (matrix_free)
+      cs_sles_solve_native_matrix_free(f_id,
+                                       var_name,
+                                       symmetric,
+                                       db_size,
+                                       (cs_real_t *)dam,
+                                       thetap*iconvp,
+                                       thetap*idiffp,
+                                       i_massflux,
+                                       i_viscm,
+                                       rotation_mode,
+                                       epsilp,
+                                       rnorm,
+                                       &niterf,
+                                       &ressol,
+                                       (cs_real_t *)smbrp,
+                                       (cs_real_t *)dpvar);
+    else
+      cs_sles_solve_native(f_id,
+                           var_name,
+                           symmetric,
+                           db_size,
+                           eb_size,
+                           (cs_real_t *)dam,
+                           xam,
+                           rotation_mode,
+                           epsilp,
+                           rnorm,
+                           &niterf,
+                           &ressol,
+                           (cs_real_t *)smbrp,
+                           (cs_real_t *)dpvar);
 
     /* Dynamic relaxation of the system */
     if (iswdyp >= 1) {
@@ -62,30 +62,52 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
-/*============================================================================
- * Static global variables
+/*=============================================================================
+ * Local structure definitions
  *============================================================================*/
 
-/* Number of defined halos */
+/* Structure to maintain halo exchange state */
 
-static int _cs_glob_n_halos = 0;
-static int _cs_glob_halo_max_stride = 3;
+struct _cs_halo_state_t {
 
-#if defined(HAVE_MPI)
+  /* Current synchronization state */
+
+  cs_halo_type_t  sync_mode;      /* Standard or extended */
+  cs_datatype_t   data_type;      /* Datatype */
+  int             stride;         /* Number of values per location */
+
+  int             local_rank_id;  /* Id of halo section for own rank
+                                     (in case of periodicity), or -1 */
 
-/* Send buffer for synchronization */
+  size_t          send_buffer_size;  /* Size of send buffer, in bytes */
+  void           *send_buffer;       /* Send buffer */
 
-static size_t _cs_glob_halo_send_buffer_size = 0;
-static void  *_cs_glob_halo_send_buffer = NULL;
+  int             n_requests;        /* Number of pending requests */
 
-/* MPI Request and status arrays */
+#if defined(HAVE_MPI)
+
+  int             request_size;      /* Size of requests and status arrays */
 
-static int           _cs_glob_halo_request_size = 0;
-static MPI_Request  *_cs_glob_halo_request = NULL;
-static MPI_Status   *_cs_glob_halo_status = NULL;
+  MPI_Request    *request;           /* Array of MPI requests */
+  MPI_Status     *status;            /* Array of MPI status */
 
 #endif
 
+};
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Number of defined halos */
+
+static int _cs_glob_n_halos = 0;
+static int _cs_glob_halo_max_stride = 3;
+
+/* Default halo state handler */
+
+static cs_halo_state_t *_halo_state = NULL;
+
 /* Buffer to save rotation halo values */
 
 static size_t  _cs_glob_halo_rot_backup_size = 0;
@@ -347,6 +369,119 @@ _zero_rotation_values(const cs_halo_t  *halo,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Ensure a halo state's buffers are large enough for a given exchange.
+ *
+ * parameters:
+ *   hs               <-> pointer to halo state
+ *   send_buffer_size <-- required send buffer size, in bytes
+ *   n_requests       <-- required number of communication requests
+ *----------------------------------------------------------------------------*/
+
+static void
+_halo_state_resize(cs_halo_state_t  *hs,
+                   size_t            send_buffer_size,
+                   int               n_requests)
+{
+  if (send_buffer_size > hs->send_buffer_size) {
+    hs->send_buffer_size = send_buffer_size;
+    BFT_REALLOC(hs->send_buffer, hs->send_buffer_size, unsigned char);
+  }
+
+#if defined(HAVE_MPI)
+
+  if (n_requests > hs->request_size) {
+    hs->request_size = n_requests;
+    BFT_REALLOC(hs->request, hs->request_size, MPI_Request);
+    BFT_REALLOC(hs->status, hs->request_size, MPI_Status);
+  }
+
+#else
+
+  CS_UNUSED(n_requests);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Copy values of local elements referenced by a halo send list section
+ * to a contiguous destination array.
+ *
+ * The datatype and stride are those of the current halo state.
+ *
+ * parameters:
+ *   halo   <-- pointer to halo structure
+ *   hs     <-- pointer to halo state
+ *   start  <-- start id in halo send list
+ *   length <-- number of elements to copy
+ *   val    <-- values array (source)
+ *   dest   --> destination array (size: length*stride)
+ *----------------------------------------------------------------------------*/
+
+static void
+_copy_send_elts(const cs_halo_t        *halo,
+                const cs_halo_state_t  *hs,
+                cs_lnum_t               start,
+                cs_lnum_t               length,
+                const void             *val,
+                void                   *dest)
+{
+  const cs_lnum_t *restrict send_list = halo->send_list + start;
+  const int stride = hs->stride;
+
+  /* Avoid threading for now, as dynamic scheduling led to slightly
+     higher cost here, and even static scheduling might lead to
+     false sharing for small halos. */
+
+  if (hs->data_type == CS_REAL_TYPE) {
+
+    const cs_real_t *restrict _val = val;
+    cs_real_t *restrict _dest = dest;
+
+    if (stride == 1) {
+      for (cs_lnum_t i = 0; i < length; i++)
+        _dest[i] = _val[send_list[i]];
+    }
+    else if (stride == 3) { /* Unroll loop for this case */
+      for (cs_lnum_t i = 0; i < length; i++) {
+        _dest[i*3]     = _val[send_list[i]*3];
+        _dest[i*3 + 1] = _val[send_list[i]*3 + 1];
+        _dest[i*3 + 2] = _val[send_list[i]*3 + 2];
+      }
+    }
+    else {
+      for (cs_lnum_t i = 0; i < length; i++) {
+        for (cs_lnum_t j = 0; j < stride; j++)
+          _dest[i*stride + j] = _val[send_list[i]*stride + j];
+      }
+    }
+
+  }
+
+  else if (hs->data_type == CS_LNUM_TYPE && stride == 1) {
+
+    const cs_lnum_t *restrict _val = val;
+    cs_lnum_t *restrict _dest = dest;
+
+    for (cs_lnum_t i = 0; i < length; i++)
+      _dest[i] = _val[send_list[i]];
+
+  }
+
+  else {
+
+    const size_t elt_size = cs_datatype_size[hs->data_type] * stride;
+    const unsigned char *restrict _val = val;
+    unsigned char *restrict _dest = dest;
+
+    for (cs_lnum_t i = 0; i < length; i++) {
+      for (size_t j = 0; j < elt_size; j++)
+        _dest[i*elt_size + j] = _val[send_list[i]*elt_size + j];
+    }
+
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -817,24 +952,8 @@ cs_halo_destroy(cs_halo_t  **halo)
 
   /* Delete buffers if no halo remains */
 
-  if (_cs_glob_n_halos == 0) {
-
-#if defined(HAVE_MPI)
-
-    if (cs_glob_n_ranks > 1) {
-
-      _cs_glob_halo_send_buffer_size = 0;
-      _cs_glob_halo_request_size = 0;
-
-      BFT_FREE(_cs_glob_halo_send_buffer);
-
-      BFT_FREE(_cs_glob_halo_request);
-      BFT_FREE(_cs_glob_halo_status);
-    }
-
-#endif
-
-  }
+  if (_cs_glob_n_halos == 0)
+    cs_halo_state_destroy(&_halo_state);
 }
 
 /*----------------------------------------------------------------------------
@@ -857,8 +976,6 @@ cs_halo_update_buffers(const cs_halo_t *halo)
   if (halo == NULL)
     return;
 
-#if defined(HAVE_MPI)
-
   if (cs_glob_n_ranks > 1) {
 
     size_t send_buffer_size =   CS_MAX(halo->n_send_elts[CS_HALO_EXTENDED],
@@ -868,28 +985,13 @@ cs_halo_update_buffers(const cs_halo_t *halo)
 
     int n_requests = halo->n_c_domains*2;
 
-    if (send_buffer_size > _cs_glob_halo_send_buffer_size) {
-      _cs_glob_halo_send_buffer_size =  send_buffer_size;
-      BFT_REALLOC(_cs_glob_halo_send_buffer,
-                  _cs_glob_halo_send_buffer_size,
-                  char);
-    }
+    if (_halo_state == NULL)
+      _halo_state = cs_halo_state_create();
 
-    if (n_requests > _cs_glob_halo_request_size) {
-      _cs_glob_halo_request_size = n_requests;
-      BFT_REALLOC(_cs_glob_halo_request,
-                  _cs_glob_halo_request_size,
-                  MPI_Request);
-      BFT_REALLOC(_cs_glob_halo_status,
-                  _cs_glob_halo_request_size,
-                  MPI_Status);
-
-    }
+    _halo_state_resize(_halo_state, send_buffer_size, n_requests);
 
   }
 
-#endif
-
   /* Buffer to save and restore rotation halo values */
 
   if (halo->n_rotations > 0) {
@@ -1004,6 +1106,9 @@ cs_halo_renumber_ghost_cells(cs_halo_t        *halo,
     int request_count = 0;
     const int local_rank = cs_glob_rank_id;
 
+    cs_halo_state_t *hs = cs_halo_state_get_default();
+    _halo_state_resize(hs, 0, halo->n_c_domains*2);
+
     /* Receive data from distant ranks */
 
     for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
@@ -1020,7 +1125,7 @@ cs_halo_renumber_ghost_cells(cs_halo_t        *halo,
                     halo->c_domain_rank[rank_id],
                     local_rank,
                     cs_glob_mpi_comm,
-                    &(_cs_glob_halo_request[request_count++]));
+                    &(hs->request[request_count++]));
       }
       else
         local_rank_id = rank_id;
@@ -1051,7 +1156,7 @@ cs_halo_renumber_ghost_cells(cs_halo_t        *halo,
                     halo->c_domain_rank[rank_id],
                     halo->c_domain_rank[rank_id],
                     cs_glob_mpi_comm,
-                    &(_cs_glob_halo_request[request_count++]));
+                    &(hs->request[request_count++]));
 
       }
 
@@ -1059,7 +1164,7 @@ cs_halo_renumber_ghost_cells(cs_halo_t        *halo,
 
     /* Wait for all exchanges */
 
-    MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
+    MPI_Waitall(request_count, hs->request, hs->status);
 
   }
 
@@ -1096,124 +1201,198 @@ cs_halo_renumber_ghost_cells(cs_halo_t        *halo,
   BFT_FREE(send_buf);
 }
 
-/*----------------------------------------------------------------------------
- * Update array of any type of halo values in case of parallelism or
- * periodicity.
- *
- * Data is untyped; only its size is given, so this function may also
- * be used to synchronize interleaved multidimendsional data, using
- * size = element_size*dim (assuming a homogeneous environment, at least
- * as far as data encoding goes).
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a halo state structure.
  *
- * This function aims at copying main values from local elements
- * (id between 1 and n_local_elements) to ghost elements on distant ranks
- * (id between n_local_elements + 1 to n_local_elements_with_halo).
+ * A halo state holds the send buffer and communication requests associated
+ * with a halo exchange, so that exchanges may be split in a start and
+ * a wait phase.
  *
- * parameters:
- *   halo      <-- pointer to halo structure
- *   sync_mode <-- synchronization mode (standard or extended)
- *   size      <-- datatype size
- *   num       <-> pointer to local number value array
- *----------------------------------------------------------------------------*/
+ * \return  pointer to created cs_halo_state_t structure.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_halo_state_t *
+cs_halo_state_create(void)
+{
+  cs_halo_state_t *hs;
+  BFT_MALLOC(hs, 1, cs_halo_state_t);
+
+  hs->sync_mode = CS_HALO_STANDARD;
+  hs->data_type = CS_DATATYPE_NULL;
+  hs->stride = 0;
+
+  hs->local_rank_id = -1;
+
+  hs->send_buffer_size = 0;
+  hs->send_buffer = NULL;
+
+  hs->n_requests = 0;
 
-#if defined(__INTEL_COMPILER) && defined(__KNC__)
-#pragma optimization_level 1 /* Crash with O2 on KNC with icc 14.0.0 20130728 */
+#if defined(HAVE_MPI)
+  hs->request_size = 0;
+  hs->request = NULL;
+  hs->status = NULL;
 #endif
 
+  return hs;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a halo state structure.
+ *
+ * \param[in, out]  halo_state  pointer to pointer to cs_halo_state
+ *                              structure to destroy.
+ */
+/*----------------------------------------------------------------------------*/
+
 void
-cs_halo_sync_untyped(const cs_halo_t  *halo,
-                     cs_halo_type_t    sync_mode,
-                     size_t            size,
-                     void             *val)
+cs_halo_state_destroy(cs_halo_state_t  **halo_state)
 {
-  cs_lnum_t i, start, length;
-  size_t j;
+  if (halo_state == NULL)
+    return;
 
-  cs_lnum_t end_shift = 0;
-  int local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
-  unsigned char *src;
-  unsigned char *restrict _val = val;
+  if (*halo_state != NULL) {
+    cs_halo_state_t *hs = *halo_state;
+
+    assert(hs->n_requests == 0);
+
+    BFT_FREE(hs->send_buffer);
 
 #if defined(HAVE_MPI)
+    BFT_FREE(hs->request);
+    BFT_FREE(hs->status);
+#endif
 
-  if (cs_glob_n_ranks > 1) {
-    const size_t send_buffer_size = CS_MAX(halo->n_send_elts[CS_HALO_EXTENDED],
-                                           halo->n_elts[CS_HALO_EXTENDED])
-                                    * size;
-
-    if (send_buffer_size > _cs_glob_halo_send_buffer_size) {
-      _cs_glob_halo_send_buffer_size =  send_buffer_size;
-      BFT_REALLOC(_cs_glob_halo_send_buffer,
-                  _cs_glob_halo_send_buffer_size,
-                  char);
-    }
+    BFT_FREE(*halo_state);
   }
+}
 
-#endif /* defined(HAVE_MPI) */
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get pointer to default halo state structure.
+ *
+ * This state is used by the blocking halo synchronization functions,
+ * so no other synchronization may be done with the default state between
+ * a call to \ref cs_halo_sync_start and the matching
+ * \ref cs_halo_sync_wait using it.
+ *
+ * \return  pointer to default halo state.
+ */
+/*----------------------------------------------------------------------------*/
 
-  if (sync_mode == CS_HALO_STANDARD)
-    end_shift = 1;
+cs_halo_state_t *
+cs_halo_state_get_default(void)
+{
+  if (_halo_state == NULL)
+    _halo_state = cs_halo_state_create();
 
-  else if (sync_mode == CS_HALO_EXTENDED)
-    end_shift = 2;
+  return _halo_state;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start a halo exchange (split-phase synchronization).
+ *
+ * Receives are posted and local values packed and sent, but the function
+ * returns without waiting for the exchange to complete, so that computations
+ * not involving ghost values may be done in the meantime.
+ *
+ * Values of local elements may be read, but neither they nor the ghost values
+ * may be modified until the matching call to \ref cs_halo_sync_wait.
+ *
+ * Ghost values of elements on the same rank (in case of periodicity) are
+ * copied directly by this function.
+ *
+ * \param[in]       halo        pointer to halo structure
+ * \param[in]       sync_mode   synchronization mode (standard or extended)
+ * \param[in]       data_type   data type
+ * \param[in]       stride      number of (interlaced) values by entity
+ * \param[in, out]  val         pointer to values array
+ * \param[in, out]  halo_state  pointer to halo state, or NULL for default
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_start(const cs_halo_t  *halo,
+                   cs_halo_type_t    sync_mode,
+                   cs_datatype_t     data_type,
+                   int               stride,
+                   void             *val,
+                   cs_halo_state_t  *halo_state)
+{
+  if (halo == NULL)
+    return;
+
+  cs_halo_state_t  *hs = (halo_state != NULL) ? halo_state : _halo_state;
+  if (hs == NULL)
+    hs = cs_halo_state_get_default();
+
+  assert(hs->n_requests == 0);
+
+  hs->sync_mode = sync_mode;
+  hs->data_type = data_type;
+  hs->stride = stride;
+  hs->local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
+
+  const size_t elt_size = cs_datatype_size[data_type] * stride;
+  const cs_lnum_t end_shift = (sync_mode == CS_HALO_STANDARD) ? 1 : 2;
+
+  unsigned char *restrict _val = val;
 
 #if defined(HAVE_MPI)
 
   if (cs_glob_n_ranks > 1) {
 
-    int rank_id;
+    const size_t send_buffer_size
+      = CS_MAX(halo->n_send_elts[CS_HALO_EXTENDED],
+               halo->n_elts[CS_HALO_EXTENDED]) * elt_size;
+
+    _halo_state_resize(hs, send_buffer_size, halo->n_c_domains*2);
+
     int request_count = 0;
-    unsigned char *build_buffer = (unsigned char *)_cs_glob_halo_send_buffer;
+    unsigned char *build_buffer = hs->send_buffer;
     const int local_rank = cs_glob_rank_id;
 
     /* Receive data from distant ranks */
 
-    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+    for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
 
-      start = halo->index[2*rank_id];
-      length = (  halo->index[2*rank_id + end_shift]
-                - halo->index[2*rank_id]);
+      cs_lnum_t start = halo->index[2*rank_id];
+      cs_lnum_t length = (  halo->index[2*rank_id + end_shift]
+                          - halo->index[2*rank_id]);
 
       if (halo->c_domain_rank[rank_id] != local_rank) {
 
-        if (length > 0) {
-
-          unsigned char *dest = _val + (halo->n_local_elts*size) + start*size;
-
-          MPI_Irecv(dest,
-                    length * size,
-                    MPI_UNSIGNED_CHAR,
+        if (length > 0)
+          MPI_Irecv(_val + (halo->n_local_elts + start)*elt_size,
+                    length*elt_size,
+                    MPI_BYTE,
                     halo->c_domain_rank[rank_id],
                     halo->c_domain_rank[rank_id],
                     cs_glob_mpi_comm,
-                    &(_cs_glob_halo_request[request_count++]));
+                    &(hs->request[request_count++]));
 
-        }
       }
       else
-        local_rank_id = rank_id;
+        hs->local_rank_id = rank_id;
 
     }
 
-    /* Assemble buffers for halo exchange;
-       avoid threading for now, as dynamic scheduling led to slightly
-       higher cost here, and even static scheduling might lead to
-       false sharing for small halos. */
+    /* Assemble buffers for halo exchange */
 
-    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+    for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
 
       if (halo->c_domain_rank[rank_id] != local_rank) {
 
-        start = halo->send_index[2*rank_id];
-        length = (  halo->send_index[2*rank_id + end_shift]
-                  - halo->send_index[2*rank_id]);
+        cs_lnum_t start = halo->send_index[2*rank_id];
+        cs_lnum_t length = (  halo->send_index[2*rank_id + end_shift]
+                            - halo->send_index[2*rank_id]);
 
-        src = build_buffer + start*size;
-
-        for (i = 0; i < length; i++) {
-          for (j = 0; j < size; j++)
-            src[i*size + j] = _val[halo->send_list[start + i]*size + j];
-        }
+        _copy_send_elts(halo, hs, start, length, val,
+                        build_buffer + start*elt_size);
 
       }
 
@@ -1226,194 +1405,146 @@ cs_halo_sync_untyped(const cs_halo_t  *halo,
 
     /* Send data to distant ranks */
 
-    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+    for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
 
       /* If this is not the local rank */
 
       if (halo->c_domain_rank[rank_id] != local_rank) {
 
-        start = halo->send_index[2*rank_id];
-        length = (  halo->send_index[2*rank_id + end_shift]
-                  - halo->send_index[2*rank_id]);
+        cs_lnum_t start = halo->send_index[2*rank_id];
+        cs_lnum_t length = (  halo->send_index[2*rank_id + end_shift]
+                            - halo->send_index[2*rank_id]);
 
         if (length > 0)
-          MPI_Isend(build_buffer + start*size,
-                    length*size,
-                    MPI_UNSIGNED_CHAR,
+          MPI_Isend(build_buffer + start*elt_size,
+                    length*elt_size,
+                    MPI_BYTE,
                     halo->c_domain_rank[rank_id],
                     local_rank,
                     cs_glob_mpi_comm,
-                    &(_cs_glob_halo_request[request_count++]));
+                    &(hs->request[request_count++]));
 
       }
 
     }
 
-    /* Wait for all exchanges */
-
-    MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
+    hs->n_requests = request_count;
   }
 
 #endif /* defined(HAVE_MPI) */
 
-  /* Copy local values in case of periodicity */
+  /* Copy local values in case of periodicity; these do not depend
+     on communication, so may be handled before waiting for completion */
 
-  if (halo->n_transforms > 0) {
-
-    if (local_rank_id > -1) {
+  if (halo->n_transforms > 0 && hs->local_rank_id > -1) {
 
-      unsigned char *recv
-        = _val + (halo->n_local_elts + halo->index[2*local_rank_id]) * size;
+    const int local_rank_id = hs->local_rank_id;
 
-      start = halo->send_index[2*local_rank_id];
-      length = (  halo->send_index[2*local_rank_id + end_shift]
-                - halo->send_index[2*local_rank_id]);
+    cs_lnum_t start = halo->send_index[2*local_rank_id];
+    cs_lnum_t length = (  halo->send_index[2*local_rank_id + end_shift]
+                        - halo->send_index[2*local_rank_id]);
 
-      for (i = 0; i < length; i++) {
-        for (j = 0; j < size; j++)
-          recv[i*size + j] = _val[halo->send_list[start + i]*size + j];
-      }
-    }
+    _copy_send_elts(halo, hs, start, length, val,
+                    _val + (  halo->n_local_elts
+                            + halo->index[2*local_rank_id])*elt_size);
 
   }
 }
 
-/*----------------------------------------------------------------------------
- * Update array of integer halo values in case of parallelism or periodicity.
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Wait for completion of a halo exchange started with
+ *        \ref cs_halo_sync_start.
  *
- * This function aims at copying main values from local elements
- * (id between 1 and n_local_elements) to ghost elements on distant ranks
- * (id between n_local_elements + 1 to n_local_elements_with_halo).
+ * Upon return, ghost values of the array are up to date.
  *
- * parameters:
- *   halo      <-- pointer to halo structure
- *   sync_mode <-- synchronization mode (standard or extended)
- *   num       <-> pointer to local number value array
- *----------------------------------------------------------------------------*/
+ * \param[in]       halo        pointer to halo structure
+ * \param[in, out]  val         pointer to values array
+ * \param[in, out]  halo_state  pointer to halo state, or NULL for default
+ */
+/*----------------------------------------------------------------------------*/
 
 void
-cs_halo_sync_num(const cs_halo_t  *halo,
-                 cs_halo_type_t    sync_mode,
-                 cs_lnum_t         num[])
+cs_halo_sync_wait(const cs_halo_t  *halo,
+                  void             *val,
+                  cs_halo_state_t  *halo_state)
 {
-  cs_lnum_t i, start, length;
+  CS_UNUSED(val);
 
-  cs_lnum_t end_shift = 0;
-  int local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
+  if (halo == NULL)
+    return;
 
-  if (sync_mode == CS_HALO_STANDARD)
-    end_shift = 1;
+  cs_halo_state_t  *hs = (halo_state != NULL) ? halo_state : _halo_state;
 
-  else if (sync_mode == CS_HALO_EXTENDED)
-    end_shift = 2;
+  if (hs == NULL)
+    return;
 
 #if defined(HAVE_MPI)
 
-  if (cs_glob_n_ranks > 1) {
-
-    int rank_id;
-    int request_count = 0;
-    cs_lnum_t *build_buffer = (cs_lnum_t *)_cs_glob_halo_send_buffer;
-    const int local_rank = cs_glob_rank_id;
-
-    /* Receive data from distant ranks */
-
-    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
-
-      start = halo->index[2*rank_id];
-      length = halo->index[2*rank_id + end_shift] - halo->index[2*rank_id];
-
-      if (halo->c_domain_rank[rank_id] != local_rank) {
-
-        if (length > 0)
-          MPI_Irecv(num + halo->n_local_elts + start,
-                    length,
-                    CS_MPI_LNUM,
-                    halo->c_domain_rank[rank_id],
-                    halo->c_domain_rank[rank_id],
-                    cs_glob_mpi_comm,
-                    &(_cs_glob_halo_request[request_count++]));
-
-      }
-      else
-        local_rank_id = rank_id;
-
-    }
-
-    /* Assemble buffers for halo exchange;
-       avoid threading for now, as dynamic scheduling led to slightly
-       higher cost here, and even static scheduling might lead to
-       false sharing for small halos. */
-
-    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
-
-      if (halo->c_domain_rank[rank_id] != local_rank) {
-
-        start = halo->send_index[2*rank_id];
-        length =   halo->send_index[2*rank_id + end_shift]
-                 - halo->send_index[2*rank_id];
-
-        for (i = 0; i < length; i++)
-          build_buffer[start + i] = num[halo->send_list[start + i]];
-
-      }
-
-    }
-
-    /* We wait for posting all receives (often recommended) */
-
-    if (_cs_glob_halo_use_barrier)
-      MPI_Barrier(cs_glob_mpi_comm);
-
-    /* Send data to distant ranks */
-
-    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
-
-      if (halo->c_domain_rank[rank_id] != local_rank) {
-
-        start = halo->send_index[2*rank_id];
-        length =   halo->send_index[2*rank_id + end_shift]
-                 - halo->send_index[2*rank_id];
-
-        if (length > 0)
-          MPI_Isend(build_buffer + start,
-                    length,
-                    CS_MPI_LNUM,
-                    halo->c_domain_rank[rank_id],
-                    local_rank,
-                    cs_glob_mpi_comm,
-                    &(_cs_glob_halo_request[request_count++]));
-
-      }
-
-    }
-
-    /* Wait for all exchanges */
-
-    MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
-  }
+  if (hs->n_requests > 0)
+    MPI_Waitall(hs->n_requests, hs->request, hs->status);
 
 #endif /* defined(HAVE_MPI) */
 
-  /* Copy local values in case of periodicity */
-
-  if (halo->n_transforms > 0) {
+  hs->n_requests = 0;
+}
 
-    if (local_rank_id > -1) {
+/*----------------------------------------------------------------------------
+ * Update array of any type of halo values in case of parallelism or
+ * periodicity.
+ *
+ * Data is untyped; only its size is given, so this function may also
+ * be used to synchronize interleaved multidimendsional data, using
+ * size = element_size*dim (assuming a homogeneous environment, at least
+ * as far as data encoding goes).
+ *
+ * This function aims at copying main values from local elements
+ * (id between 1 and n_local_elements) to ghost elements on distant ranks
+ * (id between n_local_elements + 1 to n_local_elements_with_halo).
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   size      <-- datatype size
+ *   num       <-> pointer to local number value array
+ *----------------------------------------------------------------------------*/
 
-      cs_lnum_t *recv_num
-        = num + halo->n_local_elts + halo->index[2*local_rank_id];
+void
+cs_halo_sync_untyped(const cs_halo_t  *halo,
+                     cs_halo_type_t    sync_mode,
+                     size_t            size,
+                     void             *val)
+{
+  if (sync_mode == CS_HALO_N_TYPES)
+    return;
 
-      start = halo->send_index[2*local_rank_id];
-      length =   halo->send_index[2*local_rank_id + end_shift]
-               - halo->send_index[2*local_rank_id];
+  cs_halo_sync_start(halo, sync_mode, CS_CHAR, size, val, NULL);
+  cs_halo_sync_wait(halo, val, NULL);
+}
 
-      for (i = 0; i < length; i++)
-        recv_num[i] = num[halo->send_list[start + i]];
+/*----------------------------------------------------------------------------
+ * Update array of integer halo values in case of parallelism or periodicity.
+ *
+ * This function aims at copying main values from local elements
+ * (id between 1 and n_local_elements) to ghost elements on distant ranks
+ * (id between n_local_elements + 1 to n_local_elements_with_halo).
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   num       <-> pointer to local number value array
+ *----------------------------------------------------------------------------*/
 
-    }
+void
+cs_halo_sync_num(const cs_halo_t  *halo,
+                 cs_halo_type_t    sync_mode,
+                 cs_lnum_t         num[])
+{
+  if (sync_mode == CS_HALO_N_TYPES)
+    return;
 
-  }
+  cs_halo_sync_start(halo, sync_mode, CS_LNUM_TYPE, 1, num, NULL);
+  cs_halo_sync_wait(halo, num, NULL);
 }
 
 /*----------------------------------------------------------------------------
@@ -1435,115 +1566,8 @@ cs_halo_sync_var(const cs_halo_t  *halo,
                  cs_halo_type_t    sync_mode,
                  cs_real_t         var[])
 {
-  cs_lnum_t i, start, length;
-
-  int local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
-  const cs_lnum_t end_shift = (sync_mode == CS_HALO_STANDARD) ? 1 : 2;
-
-#if defined(HAVE_MPI)
-
-  if (cs_glob_n_ranks > 1) {
-
-    int rank_id;
-    int request_count = 0;
-    cs_real_t *build_buffer = (cs_real_t *)_cs_glob_halo_send_buffer;
-    const int local_rank = cs_glob_rank_id;
-
-    /* Receive data from distant ranks */
-
-    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
-
-      start = halo->index[2*rank_id];
-      length = halo->index[2*rank_id + end_shift] - halo->index[2*rank_id];
-
-      if (halo->c_domain_rank[rank_id] != local_rank) {
-        if (length > 0)
-          MPI_Irecv(var + halo->n_local_elts + start,
-                    length,
-                    CS_MPI_REAL,
-                    halo->c_domain_rank[rank_id],
-                    halo->c_domain_rank[rank_id],
-                    cs_glob_mpi_comm,
-                    &(_cs_glob_halo_request[request_count++]));
-      }
-      else
-        local_rank_id = rank_id;
-
-    }
-
-    /* Assemble buffers for halo exchange; avoid threading for now, as dynamic
-       scheduling led to slightly higher cost here, and even static scheduling
-       might lead to false sharing for small halos. */
-
-    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
-
-      if (halo->c_domain_rank[rank_id] != local_rank) {
-
-        start = halo->send_index[2*rank_id];
-        length =   halo->send_index[2*rank_id + end_shift]
-                 - halo->send_index[2*rank_id];
-
-        for (i = 0; i < length; i++)
-          build_buffer[start + i] = var[halo->send_list[start + i]];
-
-      }
-
-    }
-
-    /* We wait for posting all receives (often recommended) */
-
-    if (_cs_glob_halo_use_barrier)
-      MPI_Barrier(cs_glob_mpi_comm);
-
-    /* Send data to distant ranks */
-
-    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
-
-      if (halo->c_domain_rank[rank_id] != local_rank) {
-
-        start = halo->send_index[2*rank_id];
-        length =   halo->send_index[2*rank_id + end_shift]
-                 - halo->send_index[2*rank_id];
-
-        if (length > 0)
-          MPI_Isend(build_buffer + start,
-                    length,
-                    CS_MPI_REAL,
-                    halo->c_domain_rank[rank_id],
-                    local_rank,
-                    cs_glob_mpi_comm,
-                    &(_cs_glob_halo_request[request_count++]));
-
-      }
-
-    }
-
-    /* Wait for all exchanges */
-
-    MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
-  }
-
-#endif /* defined(HAVE_MPI) */
-
-  /* Copy local values in case of periodicity */
-
-  if (halo->n_transforms > 0) {
-
-    if (local_rank_id > -1) {
-
-      cs_real_t *recv_var
-        = var + halo->n_local_elts + halo->index[2*local_rank_id];
-
-      start = halo->send_index[2*local_rank_id];
-      length =   halo->send_index[2*local_rank_id + end_shift]
-               - halo->send_index[2*local_rank_id];
-
-      for (i = 0; i < length; i++)
-        recv_var[i] = var[halo->send_list[start + i]];
-
-    }
-
-  }
+  cs_halo_sync_start(halo, sync_mode, CS_REAL_TYPE, 1, var, NULL);
+  cs_halo_sync_wait(halo, var, NULL);
 }
 
 /*----------------------------------------------------------------------------
@@ -1567,161 +1591,14 @@ cs_halo_sync_var_strided(const cs_halo_t  *halo,
                          cs_real_t         var[],
                          int               stride)
 {
-  cs_lnum_t i, j, start, length;
-
-  cs_lnum_t end_shift = 0;
-  int local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
+  if (sync_mode == CS_HALO_N_TYPES)
+    return;
 
   if (stride > _cs_glob_halo_max_stride)
     _cs_glob_halo_max_stride = stride;
-  cs_halo_update_buffers(halo);
-
-  if (sync_mode == CS_HALO_STANDARD)
-    end_shift = 1;
-
-  else if (sync_mode == CS_HALO_EXTENDED)
-    end_shift = 2;
-
-#if defined(HAVE_MPI)
-
-  if (cs_glob_n_ranks > 1) {
-
-    int rank_id;
-    int request_count = 0;
-    cs_real_t *build_buffer = (cs_real_t *)_cs_glob_halo_send_buffer;
-    cs_real_t *buffer = NULL;
-    const int local_rank = cs_glob_rank_id;
-
-    /* Receive data from distant ranks */
-
-    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
-
-      length = (  halo->index[2*rank_id + end_shift]
-                - halo->index[2*rank_id]) * stride;
-
-      if (halo->c_domain_rank[rank_id] != local_rank) {
-
-        if (length > 0) {
-
-          buffer = var + (halo->n_local_elts + halo->index[2*rank_id])*stride;
-
-          MPI_Irecv(buffer,
-                    length,
-                    CS_MPI_REAL,
-                    halo->c_domain_rank[rank_id],
-                    halo->c_domain_rank[rank_id],
-                    cs_glob_mpi_comm,
-                    &(_cs_glob_halo_request[request_count++]));
-
-        }
-      }
-      else
-        local_rank_id = rank_id;
-
-    }
-
-    /* Assemble buffers for halo exchange; avoid threading for now, as dynamic
-       scheduling led to slightly higher cost here, and even static scheduling
-       might lead to false sharing for small halos. */
-
-    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
-
-      if (halo->c_domain_rank[rank_id] != local_rank) {
-
-        start = halo->send_index[2*rank_id];
-        length = (  halo->send_index[2*rank_id + end_shift]
-                  - halo->send_index[2*rank_id]);
-
-        if (stride == 3) { /* Unroll loop for this case */
-          for (i = 0; i < length; i++) {
-            build_buffer[(start + i)*3]
-              = var[(halo->send_list[start + i])*3];
-            build_buffer[(start + i)*3 + 1]
-              = var[(halo->send_list[start + i])*3 + 1];
-            build_buffer[(start + i)*3 + 2]
-              = var[(halo->send_list[start + i])*3 + 2];
-          }
-        }
-        else {
-          for (i = 0; i < length; i++) {
-            for (j = 0; j < stride; j++)
-              build_buffer[(start + i)*stride + j]
-                = var[(halo->send_list[start + i])*stride + j];
-          }
-        }
-
-      }
-
-    }
-
-    /* We wait for posting all receives (often recommended) */
-
-    if (_cs_glob_halo_use_barrier)
-      MPI_Barrier(cs_glob_mpi_comm);
-
-    /* Send data to distant ranks */
-
-    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
-
-      /* If this is not the local rank */
-
-      if (halo->c_domain_rank[rank_id] != local_rank) {
 
-        start = halo->send_index[2*rank_id];
-        length = (  halo->send_index[2*rank_id + end_shift]
-                  - halo->send_index[2*rank_id]);
-
-        if (length > 0)
-          MPI_Isend(build_buffer + start*stride,
-                    length*stride,
-                    CS_MPI_REAL,
-                    halo->c_domain_rank[rank_id],
-                    local_rank,
-                    cs_glob_mpi_comm,
-                    &(_cs_glob_halo_request[request_count++]));
-
-      }
-
-    }
-
-    /* Wait for all exchanges */
-
-    MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
-  }
-
-#endif /* defined(HAVE_MPI) */
-
-  /* Copy local values in case of periodicity */
-
-  if (halo->n_transforms > 0) {
-
-    if (local_rank_id > -1) {
-
-      cs_real_t *recv_var
-        = var + (halo->n_local_elts + halo->index[2*local_rank_id])*stride;
-
-      start = halo->send_index[2*local_rank_id];
-      length =   halo->send_index[2*local_rank_id + end_shift]
-               - halo->send_index[2*local_rank_id];
-
-      if (stride == 3) { /* Unroll loop for this case */
-        for (i = 0; i < length; i++) {
-          recv_var[i*3]     = var[(halo->send_list[start + i])*3];
-          recv_var[i*3 + 1] = var[(halo->send_list[start + i])*3 + 1];
-          recv_var[i*3 + 2] = var[(halo->send_list[start + i])*3 + 2];
-        }
-      }
-      else {
-        for (i = 0; i < length; i++) {
-          for (j = 0; j < stride; j++)
-            recv_var[i*stride + j]
-              = var[(halo->send_list[start + i])*stride + j];
-        }
-      }
-
-    }
-
-  }
+  cs_halo_sync_start(halo, sync_mode, CS_REAL_TYPE, stride, var, NULL);
+  cs_halo_sync_wait(halo, var, NULL);
 }
 
 /*----------------------------------------------------------------------------
@@ -65,6 +65,10 @@ typedef enum {
 
 } cs_halo_rotation_t ;
 
+/* Halo communication state (opaque) */
+
+typedef struct _cs_halo_state_t  cs_halo_state_t;
+
 /* Structure for halo management */
 /* ----------------------------- */
 
@@ -288,6 +292,98 @@ void
 cs_halo_renumber_ghost_cells(cs_halo_t        *halo,
                              const cs_lnum_t   old_cell_id[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a halo state structure.
+ *
+ * A halo state holds the send buffer and communication requests associated
+ * with a halo exchange, so that exchanges may be split in a start and
+ * a wait phase.
+ *
+ * \return  pointer to created cs_halo_state_t structure.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_halo_state_t *
+cs_halo_state_create(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a halo state structure.
+ *
+ * \param[in, out]  halo_state  pointer to pointer to cs_halo_state
+ *                              structure to destroy.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_state_destroy(cs_halo_state_t  **halo_state);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get pointer to default halo state structure.
+ *
+ * This state is used by the blocking halo synchronization functions,
+ * so no other synchronization may be done with the default state between
+ * a call to \ref cs_halo_sync_start and the matching
+ * \ref cs_halo_sync_wait using it.
+ *
+ * \return  pointer to default halo state.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_halo_state_t *
+cs_halo_state_get_default(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start a halo exchange (split-phase synchronization).
+ *
+ * Receives are posted and local values packed and sent, but the function
+ * returns without waiting for the exchange to complete, so that computations
+ * not involving ghost values may be done in the meantime.
+ *
+ * Values of local elements may be read, but neither they nor the ghost values
+ * may be modified until the matching call to \ref cs_halo_sync_wait.
+ *
+ * Ghost values of elements on the same rank (in case of periodicity) are
+ * copied directly by this function.
+ *
+ * \param[in]       halo        pointer to halo structure
+ * \param[in]       sync_mode   synchronization mode (standard or extended)
+ * \param[in]       data_type   data type
+ * \param[in]       stride      number of (interlaced) values by entity
+ * \param[in, out]  val         pointer to values array
+ * \param[in, out]  halo_state  pointer to halo state, or NULL for default
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_start(const cs_halo_t  *halo,
+                   cs_halo_type_t    sync_mode,
+                   cs_datatype_t     data_type,
+                   int               stride,
+                   void             *val,
+                   cs_halo_state_t  *halo_state);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Wait for completion of a halo exchange started with
+ *        \ref cs_halo_sync_start.
+ *
+ * Upon return, ghost values of the array are up to date.
+ *
+ * \param[in]       halo        pointer to halo structure
+ * \param[in, out]  val         pointer to values array
+ * \param[in, out]  halo_state  pointer to halo state, or NULL for default
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_wait(const cs_halo_t  *halo,
+                  void             *val,
+                  cs_halo_state_t  *halo_state);
+
 /*----------------------------------------------------------------------------
  * Update array of any type of halo values in case of parallelism or
  * periodicity.
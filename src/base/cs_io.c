@@ -40,6 +40,10 @@
 #include <mpi.h>
 #endif
 
+#if defined(HAVE_ZLIB)
+#include <zlib.h>
+#endif
+
 #undef HAVE_STDINT_H
 #if defined(__STDC_VERSION__)
 #  if (__STDC_VERSION__ >= 199901L)
@@ -101,7 +105,7 @@ typedef struct {
   size_t          size;              /* Current number of entries */
   size_t          max_size;          /* Maximum number of entries */
 
-  /* For each entry, we need 8 values, which we store in h_vals :
+  /* For each entry, we need 9 values, which we store in h_vals :
    *   0: number of values in section
    *   1: location_id
    *   2: index id
@@ -110,7 +114,8 @@ typedef struct {
    *   5: index of embedded data in data array + 1 if data is
    *      embedded, 0 otherwise
    *   6: datatype id in file
-   *   7: associated file id (in case of multiple files)
+   *   7: body encoding (codec) id
+   *   8: size of encoded body in file (0 if not encoded)
    */
 
   cs_file_off_t  *h_vals;            /* Base values associated
@@ -158,6 +163,10 @@ struct _cs_io_t {
   size_t              index_id;       /* Id of index, or 0 */
   size_t              n_loc_vals;     /* Number of values per location */
   size_t              type_size;      /* Size of current type */
+  cs_io_codec_t       codec;          /* Encoding of current section body
+                                         (read), or of block sections
+                                         (write) */
+  cs_file_off_t       body_size;      /* Size of encoded section body */
   char               *sec_name;       /* Pointer to name in section header */
   char               *type_name;      /* Pointer to type in section header */
   void               *data;           /* Pointer to data in section header
@@ -180,6 +189,18 @@ struct _cs_io_t {
 
 #define CS_IO_MPI_TAG     'C'+'S'+'_'+'I'+'O'
 
+/* Maximum number of values per independently encoded chunk */
+
+#define CS_IO_CODEC_CHUNK_SIZE  65536
+
+#if defined(HAVE_MPI)
+#  if defined(SIZEOF_LONG_LONG)
+#    define CS_IO_MPI_OFFSET  MPI_LONG_LONG
+#  else
+#    define CS_IO_MPI_OFFSET  MPI_LONG
+#  endif
+#endif
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -193,6 +214,13 @@ static char  _type_name_u8[] =   "u8";  /* Unsigned 64 bit integer */
 static char  _type_name_r4[] =   "r4";  /* Single precision real */
 static char  _type_name_r8[] =   "r8";  /* Double precsision real */
 
+/* Codec tags, appended to type names of encoded sections */
+
+static const char  *_codec_tag[] = {"  ", "rl", "zl"};
+static const char  *_codec_name[] = {N_("none"),
+                                     N_("shuffle + run-length"),
+                                     N_("shuffle + deflate")};
+
 /* Logging */
 
 static int _cs_io_map_size[2] = {0, 0};
@@ -365,6 +393,272 @@ _convert_from_offset(unsigned char         buf[],
 #endif
 }
 
+/*----------------------------------------------------------------------------
+ * Byte-shuffle values (group bytes of same significance), converting
+ * to file (big-endian) byte order if necessary.
+ *
+ * parameters:
+ *   type_size <-- size of each value
+ *   n_vals    <-- number of values
+ *   swap      <-- swap byte order ?
+ *   src       <-- values to shuffle
+ *   dst       --> shuffled bytes
+ *----------------------------------------------------------------------------*/
+
+static void
+_shuffle(size_t                type_size,
+         size_t                n_vals,
+         bool                  swap,
+         const unsigned char  *src,
+         unsigned char        *dst)
+{
+  for (size_t j = 0; j < type_size; j++) {
+    const size_t k = (swap) ? type_size - 1 - j : j;
+    unsigned char *_dst = dst + j*n_vals;
+    for (size_t i = 0; i < n_vals; i++)
+      _dst[i] = src[i*type_size + k];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Revert byte-shuffling of values, converting from file (big-endian)
+ * byte order if necessary.
+ *
+ * parameters:
+ *   type_size <-- size of each value
+ *   n_vals    <-- number of values
+ *   swap      <-- swap byte order ?
+ *   src       <-- shuffled bytes
+ *   dst       --> values
+ *----------------------------------------------------------------------------*/
+
+static void
+_unshuffle(size_t                type_size,
+           size_t                n_vals,
+           bool                  swap,
+           const unsigned char  *src,
+           unsigned char        *dst)
+{
+  for (size_t j = 0; j < type_size; j++) {
+    const size_t k = (swap) ? type_size - 1 - j : j;
+    const unsigned char *_src = src + j*n_vals;
+    for (size_t i = 0; i < n_vals; i++)
+      dst[i*type_size + k] = _src[i];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Run-length encode a byte array.
+ *
+ * A control byte c < 128 is followed by c+1 literal bytes; a control
+ * byte c >= 128 is followed by a single byte, repeated c-125 times.
+ *
+ * parameters:
+ *   src      <-- bytes to encode
+ *   n        <-- number of bytes to encode
+ *   dst      --> encoded bytes
+ *   dst_size <-- size of destination buffer
+ *
+ * returns:
+ *   size of encoded data, or 0 if it does not fit in dst_size bytes
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_rle_encode(const unsigned char  *src,
+            size_t                n,
+            unsigned char        *dst,
+            size_t                dst_size)
+{
+  size_t i = 0, j = 0;
+
+  while (i < n) {
+
+    size_t l = 1;
+    while (i + l < n && l < 130 && src[i+l] == src[i])
+      l++;
+
+    if (l >= 3) {
+      if (j + 2 > dst_size)
+        return 0;
+      dst[j++] = (unsigned char)(l + 125);
+      dst[j++] = src[i];
+      i += l;
+    }
+
+    else {
+      /* Literals up to the start of the next run of 3 identical bytes */
+      l = 0;
+      while (i + l < n && l < 128) {
+        if (   i + l + 2 < n
+            && src[i+l] == src[i+l+1] && src[i+l] == src[i+l+2])
+          break;
+        l++;
+      }
+      if (j + 1 + l > dst_size)
+        return 0;
+      dst[j++] = (unsigned char)(l - 1);
+      memcpy(dst + j, src + i, l);
+      i += l;
+      j += l;
+    }
+
+  }
+
+  return j;
+}
+
+/*----------------------------------------------------------------------------
+ * Decode a run-length encoded byte array.
+ *
+ * parameters:
+ *   src      <-- encoded bytes
+ *   n        <-- number of encoded bytes
+ *   dst      --> decoded bytes
+ *   dst_size <-- size of destination buffer
+ *
+ * returns:
+ *   size of decoded data, or 0 in case of inconsistent data
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_rle_decode(const unsigned char  *src,
+            size_t                n,
+            unsigned char        *dst,
+            size_t                dst_size)
+{
+  size_t i = 0, j = 0;
+
+  while (i < n) {
+    size_t c = src[i++];
+    if (c < 128) {
+      if (i + c + 1 > n || j + c + 1 > dst_size)
+        return 0;
+      memcpy(dst + j, src + i, c + 1);
+      i += c + 1;
+      j += c + 1;
+    }
+    else {
+      if (i >= n || j + c - 125 > dst_size)
+        return 0;
+      memset(dst + j, src[i++], c - 125);
+      j += c - 125;
+    }
+  }
+
+  return j;
+}
+
+/*----------------------------------------------------------------------------
+ * Encode a chunk of values.
+ *
+ * Values are byte-shuffled, then compressed. If compression does not
+ * reduce the data size, shuffled values are stored as-is, which is
+ * detected on decoding by the encoded size being equal to the raw size.
+ *
+ * parameters:
+ *   codec     <-- encoding type
+ *   type_size <-- size of each value
+ *   n_vals    <-- number of values
+ *   swap      <-- swap byte order ?
+ *   src       <-- values to encode
+ *   work      <-> work buffer (n_vals*type_size bytes)
+ *   dst       --> encoded values (n_vals*type_size bytes at most)
+ *
+ * returns:
+ *   size of encoded data
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_encode_chunk(cs_io_codec_t         codec,
+              size_t                type_size,
+              size_t                n_vals,
+              bool                  swap,
+              const unsigned char  *src,
+              unsigned char        *work,
+              unsigned char        *dst)
+{
+  size_t retval = 0;
+  const size_t raw_size = n_vals*type_size;
+
+  if (raw_size == 0)
+    return 0;
+
+  _shuffle(type_size, n_vals, swap, src, work);
+
+  if (codec == CS_IO_CODEC_SHUFFLE_RLE)
+    retval = _rle_encode(work, raw_size, dst, raw_size - 1);
+
+#if defined(HAVE_ZLIB)
+  else if (codec == CS_IO_CODEC_SHUFFLE_ZLIB) {
+    uLongf z_size = raw_size - 1;
+    if (compress2(dst, &z_size, work, raw_size, 1) == Z_OK)
+      retval = z_size;
+  }
+#endif
+
+  if (retval == 0 || retval >= raw_size) {
+    memcpy(dst, work, raw_size);
+    retval = raw_size;
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Decode a chunk of values.
+ *
+ * parameters:
+ *   codec     <-- encoding type
+ *   type_size <-- size of each value
+ *   n_vals    <-- number of values
+ *   swap      <-- swap byte order ?
+ *   src       <-- encoded values
+ *   src_size  <-- size of encoded values
+ *   work      <-> work buffer (n_vals*type_size bytes)
+ *   dst       --> decoded values
+ *
+ * returns:
+ *   0 in case of success, 1 in case of inconsistent data
+ *----------------------------------------------------------------------------*/
+
+static int
+_decode_chunk(cs_io_codec_t         codec,
+              size_t                type_size,
+              size_t                n_vals,
+              bool                  swap,
+              const unsigned char  *src,
+              size_t                src_size,
+              unsigned char        *work,
+              unsigned char        *dst)
+{
+  size_t raw_size = n_vals*type_size;
+  size_t dec_size = 0;
+  const unsigned char *shuffled = work;
+
+  if (src_size == raw_size) {
+    shuffled = src;
+    dec_size = raw_size;
+  }
+
+  else if (codec == CS_IO_CODEC_SHUFFLE_RLE)
+    dec_size = _rle_decode(src, src_size, work, raw_size);
+
+#if defined(HAVE_ZLIB)
+  else if (codec == CS_IO_CODEC_SHUFFLE_ZLIB) {
+    uLongf z_size = raw_size;
+    if (uncompress(work, &z_size, src, src_size) == Z_OK)
+      dec_size = z_size;
+  }
+#endif
+
+  if (dec_size != raw_size)
+    return 1;
+
+  _unshuffle(type_size, n_vals, swap, shuffled, dst);
+
+  return 0;
+}
+
 /*----------------------------------------------------------------------------
  * Return an empty kernel IO file structure.
  *
@@ -406,6 +700,8 @@ _cs_io_create(cs_io_mode_t   mode,
 
   cs_io->n_vals = 0;
   cs_io->type_size = 0;
+  cs_io->codec = CS_IO_CODEC_NONE;
+  cs_io->body_size = 0;
   cs_io->sec_name = NULL;
   cs_io->type_name = NULL;
   cs_io->data = NULL;
@@ -442,7 +738,7 @@ _create_index(cs_io_t *inp)
   idx->size = 0;
   idx->max_size = 32;
 
-  BFT_MALLOC(idx->h_vals, idx->max_size*7, cs_file_off_t);
+  BFT_MALLOC(idx->h_vals, idx->max_size*9, cs_file_off_t);
   BFT_MALLOC(idx->offset, idx->max_size, cs_file_off_t);
 
   idx->max_names_size = 256;
@@ -513,7 +809,7 @@ _update_index_and_shift(cs_io_t             *inp,
       idx->max_size = 32;
     else
       idx->max_size *= 2;
-    BFT_REALLOC(idx->h_vals, idx->max_size*7, cs_file_off_t);
+    BFT_REALLOC(idx->h_vals, idx->max_size*9, cs_file_off_t);
     BFT_REALLOC(idx->offset, idx->max_size, cs_file_off_t);
   };
 
@@ -544,13 +840,15 @@ _update_index_and_shift(cs_io_t             *inp,
 
   id = idx->size;
 
-  idx->h_vals[id*7]     = inp->n_vals;
-  idx->h_vals[id*7 + 1] = inp->location_id;
-  idx->h_vals[id*7 + 2] = inp->index_id;
-  idx->h_vals[id*7 + 3] = inp->n_loc_vals;
-  idx->h_vals[id*7 + 4] = idx->names_size;
-  idx->h_vals[id*7 + 5] = 0;
-  idx->h_vals[id*7 + 6] = header->type_read;
+  idx->h_vals[id*9]     = inp->n_vals;
+  idx->h_vals[id*9 + 1] = inp->location_id;
+  idx->h_vals[id*9 + 2] = inp->index_id;
+  idx->h_vals[id*9 + 3] = inp->n_loc_vals;
+  idx->h_vals[id*9 + 4] = idx->names_size;
+  idx->h_vals[id*9 + 5] = 0;
+  idx->h_vals[id*9 + 6] = header->type_read;
+  idx->h_vals[id*9 + 7] = inp->codec;
+  idx->h_vals[id*9 + 8] = inp->body_size;
 
   strcpy(idx->names + idx->names_size, inp->sec_name);
   idx->names[new_names_size - 1] = '\0';
@@ -559,6 +857,8 @@ _update_index_and_shift(cs_io_t             *inp,
   if (inp->data == NULL) {
     cs_file_off_t offset = cs_file_tell(inp->f);
     cs_file_off_t data_shift = inp->n_vals * inp->type_size;
+    if (inp->codec != CS_IO_CODEC_NONE)
+      data_shift = inp->body_size;
     if (inp->body_align > 0) {
       size_t ba = inp->body_align;
       idx->offset[id] = offset + (ba - (offset % ba)) % ba;
@@ -568,7 +868,7 @@ _update_index_and_shift(cs_io_t             *inp,
     cs_file_seek(inp->f, idx->offset[id] + data_shift, CS_FILE_SEEK_SET);
   }
   else {
-    idx->h_vals[id*7 + 5] = idx->data_size + 1;
+    idx->h_vals[id*9 + 5] = idx->data_size + 1;
     memcpy(idx->data + idx->data_size,
            inp->data,
            new_data_size - idx->data_size);
@@ -1260,6 +1560,421 @@ _cs_io_convert_read(void           *buffer,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Read an encoded section body's chunk table.
+ *
+ * The body starts with the number of chunks, followed for each chunk by
+ * the global number of its first element and the past-the-end offset
+ * of its encoded data (relative to the end of the table).
+ *
+ * The table is checked for consistency: element numbers must start at 1
+ * and increase strictly, and data offsets must increase strictly and fit
+ * in the section body.
+ *
+ * parameters:
+ *   n_g_elts <-- number of global elements (locations)
+ *   n_chunks --> number of chunks
+ *   inp      <-> input kernel IO structure
+ *
+ * returns:
+ *   pointer to allocated chunk table
+ *----------------------------------------------------------------------------*/
+
+static cs_file_off_t *
+_read_chunk_table(cs_gnum_t   n_g_elts,
+                  size_t     *n_chunks,
+                  cs_io_t    *inp)
+{
+  unsigned char *buf = NULL;
+  cs_file_off_t _n_chunks = 0;
+  cs_file_off_t *table = NULL;
+  size_t n_read = 0;
+
+  unsigned char  _buf[8];
+
+  n_read = cs_file_read_global(inp->f, _buf, 1, 8);
+  if (n_read == 8) {
+    if (cs_file_get_swap_endian(inp->f) == 1)
+      _swap_endian(_buf, 8, 1);
+    _convert_to_offset(_buf, &_n_chunks, 1);
+  }
+
+  if (n_read < 8 || _n_chunks < 0 || 16*_n_chunks + 8 > inp->body_size)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error reading encoded section \"%s\" in file \"%s\"."),
+              inp->sec_name, cs_file_get_name(inp->f));
+
+  BFT_MALLOC(buf, _n_chunks*16, unsigned char);
+  BFT_MALLOC(table, _n_chunks*2, cs_file_off_t);
+
+  n_read = cs_file_read_global(inp->f, buf, 1, _n_chunks*16);
+  if (n_read < (size_t)(_n_chunks*16))
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error reading encoded section \"%s\" in file \"%s\"."),
+              inp->sec_name, cs_file_get_name(inp->f));
+
+  if (cs_file_get_swap_endian(inp->f) == 1)
+    _swap_endian(buf, 8, _n_chunks*2);
+  _convert_to_offset(buf, table, _n_chunks*2);
+
+  BFT_FREE(buf);
+
+  /* Check table consistency */
+
+  {
+    bool valid = (_n_chunks > 0 || n_g_elts == 0) ? true : false;
+
+    const cs_file_off_t data_size = inp->body_size - 16*_n_chunks - 8;
+
+    for (cs_file_off_t c = 0; c < _n_chunks && valid; c++) {
+      cs_file_off_t g_prev = (c > 0) ? table[c*2 - 2] : 0;
+      cs_file_off_t e_prev = (c > 0) ? table[c*2 - 1] : 0;
+      if (   (c == 0 && table[0] != 1)
+          || table[c*2] <= g_prev
+          || (cs_gnum_t)table[c*2] > n_g_elts
+          || table[c*2 + 1] <= e_prev
+          || table[c*2 + 1] > data_size)
+        valid = false;
+    }
+
+    if (valid == false)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Inconsistent chunk table for encoded section \"%s\"\n"
+                  "in file \"%s\"."),
+                inp->sec_name, cs_file_get_name(inp->f));
+  }
+
+  *n_chunks = _n_chunks;
+
+  return table;
+}
+
+/*----------------------------------------------------------------------------
+ * Decode a contiguous range of chunks of an encoded section body.
+ *
+ * parameters:
+ *   chunk_start <-- id of first chunk to decode
+ *   chunk_end   <-- id of past-the-end chunk to decode
+ *   n_chunks    <-- number of chunks
+ *   table       <-- chunk table
+ *   n_g_elts    <-- number of global elements (locations)
+ *   stride      <-- number of values per element
+ *   type_size   <-- size of each value
+ *   src         <-- encoded data, starting at first chunk
+ *   dst         --> decoded values
+ *   inp         <-- input kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_decode_chunks(size_t                chunk_start,
+               size_t                chunk_end,
+               size_t                n_chunks,
+               const cs_file_off_t   table[],
+               cs_gnum_t             n_g_elts,
+               size_t                stride,
+               size_t                type_size,
+               const unsigned char  *src,
+               unsigned char        *dst,
+               const cs_io_t        *inp)
+{
+  size_t max_chunk_size = 0;
+  unsigned char *work = NULL;
+
+  const bool swap = (cs_file_get_swap_endian(inp->f) == 1) ? true : false;
+  const cs_file_off_t src_shift = (chunk_start > 0) ?
+    table[chunk_start*2 - 1] : 0;
+
+  for (size_t c = chunk_start; c < chunk_end; c++) {
+    cs_gnum_t c_end = (c+1 < n_chunks) ?
+      (cs_gnum_t)table[c*2 + 2] : n_g_elts + 1;
+    size_t c_size = (c_end - (cs_gnum_t)table[c*2])*stride*type_size;
+    if (c_size > max_chunk_size)
+      max_chunk_size = c_size;
+  }
+
+  BFT_MALLOC(work, max_chunk_size, unsigned char);
+
+  for (size_t c = chunk_start; c < chunk_end; c++) {
+
+    cs_gnum_t c_end = (c+1 < n_chunks) ?
+      (cs_gnum_t)table[c*2 + 2] : n_g_elts + 1;
+    size_t n_c_vals = (c_end - (cs_gnum_t)table[c*2])*stride;
+    cs_file_off_t e_start = (c > 0) ? table[c*2 - 1] : 0;
+    cs_file_off_t e_end = table[c*2 + 1];
+
+    int retcode = _decode_chunk(inp->codec,
+                                type_size,
+                                n_c_vals,
+                                swap,
+                                src + (e_start - src_shift),
+                                e_end - e_start,
+                                work,
+                                dst);
+
+    if (retcode != 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error decoding section \"%s\" in file \"%s\"\n"
+                  "(codec: %s, chunk %llu)."),
+                inp->sec_name, cs_file_get_name(inp->f),
+                _(_codec_name[inp->codec]), (unsigned long long)c);
+
+    dst += n_c_vals*type_size;
+  }
+
+  BFT_FREE(work);
+}
+
+/*----------------------------------------------------------------------------
+ * Read and decode an encoded section body.
+ *
+ * Each encoded chunk is read by a single rank (the one whose block
+ * contains the chunk's first element), after which decoded values are
+ * redistributed if blocks are not aligned with chunks (i.e. when read with
+ * a different distribution than that used for writing). In block mode,
+ * blocks on successive ranks must be contiguous, as for regular reads.
+ *
+ * parameters:
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *                        or 0 for global read
+ *   global_num_end   <-- global number of past-the end block item
+ *   stride           <-- number of values per element
+ *   type_size        <-- size of each value
+ *   buf              --> decoded values
+ *   inp              <-> input kernel IO structure
+ *
+ * returns:
+ *   number of bytes read
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_read_body_encoded(cs_gnum_t   global_num_start,
+                   cs_gnum_t   global_num_end,
+                   size_t      stride,
+                   size_t      type_size,
+                   void       *buf,
+                   cs_io_t    *inp)
+{
+  size_t n_chunks = 0;
+  size_t c_range[2] = {0, 0};
+  cs_file_off_t *table = NULL;
+  unsigned char *enc = NULL;
+  size_t retval = 0;
+
+  const cs_gnum_t n_g_elts = inp->n_vals / stride;
+  const size_t elt_size = stride*type_size;
+  const cs_file_off_t body_start = cs_file_tell(inp->f);
+
+  int n_ranks = 1;
+
+  cs_gnum_t s_id = global_num_start, e_id = global_num_end;
+  if (global_num_start == 0) {
+    s_id = 1;
+    e_id = n_g_elts + 1;
+  }
+
+  table = _read_chunk_table(n_g_elts, &n_chunks, inp);
+
+  const cs_file_off_t data_start = cs_file_tell(inp->f);
+
+#if defined(HAVE_MPI)
+  if (inp->comm != MPI_COMM_NULL && global_num_start > 0)
+    MPI_Comm_size(inp->comm, &n_ranks);
+#endif
+
+  /* Read chunks overlapping requested range on each rank */
+
+  if (n_ranks == 1) {
+
+    while (   c_range[0] < n_chunks
+           && (  (c_range[0]+1 < n_chunks) ?
+                 (cs_gnum_t)table[c_range[0]*2 + 2] : n_g_elts + 1) <= s_id)
+      c_range[0]++;
+    c_range[1] = c_range[0];
+    while (   c_range[1] < n_chunks
+           && (cs_gnum_t)table[c_range[1]*2] < e_id)
+      c_range[1]++;
+
+    if (c_range[1] > c_range[0] && e_id > s_id) {
+
+      cs_file_off_t e_start = (c_range[0] > 0) ? table[c_range[0]*2 - 1] : 0;
+      cs_file_off_t e_end = table[c_range[1]*2 - 1];
+      cs_gnum_t d_start = table[c_range[0]*2];
+      cs_gnum_t d_end = (c_range[1] < n_chunks) ?
+        (cs_gnum_t)table[c_range[1]*2] : n_g_elts + 1;
+
+      unsigned char *dec = buf;
+      if (d_start != s_id || d_end != e_id)
+        BFT_MALLOC(dec, (d_end - d_start)*elt_size, unsigned char);
+
+      BFT_MALLOC(enc, e_end - e_start, unsigned char);
+      cs_file_seek(inp->f, data_start + e_start, CS_FILE_SEEK_SET);
+      retval = cs_file_read_global(inp->f, enc, 1, e_end - e_start);
+
+      _decode_chunks(c_range[0], c_range[1], n_chunks, table,
+                     n_g_elts, stride, type_size, enc, dec, inp);
+
+      BFT_FREE(enc);
+
+      if (dec != buf) {
+        memcpy(buf,
+               dec + (s_id - d_start)*elt_size,
+               (e_id - s_id)*elt_size);
+        BFT_FREE(dec);
+      }
+
+    }
+
+  }
+
+#if defined(HAVE_MPI)
+
+  /* In parallel, assign each chunk to a single rank */
+
+  else {
+
+    int rank_id = 0;
+    bool aligned = true;
+    cs_gnum_t  l_range[2] = {s_id, e_id};
+    cs_gnum_t  *g_range = NULL, *d_range = NULL;
+    int  *c_start = NULL;
+    int  *send_count = NULL, *send_shift = NULL;
+    int  *recv_count = NULL, *recv_shift = NULL;
+    unsigned char *dec = NULL;
+
+    MPI_Comm_rank(inp->comm, &rank_id);
+
+    BFT_MALLOC(g_range, n_ranks*2, cs_gnum_t);
+    BFT_MALLOC(d_range, n_ranks*2, cs_gnum_t);
+    BFT_MALLOC(c_start, n_ranks+1, int);
+
+    MPI_Allgather(l_range, 2, CS_MPI_GNUM, g_range, 2, CS_MPI_GNUM,
+                  inp->comm);
+
+    /* A non-empty block takes all chunks starting before
+       the next non-empty block */
+
+    {
+      size_t c_id = 0;
+      for (int i = 0; i < n_ranks; i++) {
+        c_start[i] = c_id;
+        if (g_range[i*2+1] > g_range[i*2]) {
+          int j = i+1;
+          while (j < n_ranks && g_range[j*2+1] <= g_range[j*2])
+            j++;
+          while (c_id < n_chunks
+                 && (j >= n_ranks || (cs_gnum_t)table[c_id*2] < g_range[j*2]))
+            c_id++;
+        }
+      }
+      c_start[n_ranks] = c_id;
+    }
+
+    /* Decoded range of each rank */
+
+    for (int i = 0; i < n_ranks; i++) {
+      d_range[i*2] = 0;
+      d_range[i*2+1] = 0;
+      if (c_start[i] < c_start[i+1]) {
+        d_range[i*2] = table[c_start[i]*2];
+        d_range[i*2+1] = (c_start[i+1] < (int)n_chunks) ?
+          (cs_gnum_t)table[c_start[i+1]*2] : n_g_elts + 1;
+      }
+      if (g_range[i*2+1] > g_range[i*2]) {
+        if (   d_range[i*2] != g_range[i*2]
+            || d_range[i*2+1] != g_range[i*2+1])
+          aligned = false;
+      }
+      else if (c_start[i] < c_start[i+1])
+        aligned = false;
+    }
+
+    c_range[0] = c_start[rank_id];
+    c_range[1] = c_start[rank_id+1];
+
+    /* Read assigned chunks */
+
+    {
+      cs_file_off_t e_start = (c_range[0] > 0) ? table[c_range[0]*2 - 1] : 0;
+      cs_file_off_t e_end = (c_range[1] > 0) ? table[c_range[1]*2 - 1] : 0;
+
+      BFT_MALLOC(enc, e_end - e_start, unsigned char);
+
+      retval = cs_file_read_block(inp->f,
+                                  enc,
+                                  1,
+                                  1,
+                                  e_start + 1,
+                                  e_end + 1);
+    }
+
+    if (aligned)
+      dec = buf;
+    else if (c_range[1] > c_range[0])
+      BFT_MALLOC(dec, (d_range[rank_id*2+1] - d_range[rank_id*2])*elt_size,
+                 unsigned char);
+
+    _decode_chunks(c_range[0], c_range[1], n_chunks, table,
+                   n_g_elts, stride, type_size, enc, dec, inp);
+
+    BFT_FREE(enc);
+
+    /* Redistribute decoded values if necessary */
+
+    if (aligned == false) {
+
+      BFT_MALLOC(send_count, n_ranks, int);
+      BFT_MALLOC(send_shift, n_ranks, int);
+      BFT_MALLOC(recv_count, n_ranks, int);
+      BFT_MALLOC(recv_shift, n_ranks, int);
+
+      const cs_gnum_t d_start = d_range[rank_id*2];
+      const cs_gnum_t d_end = d_range[rank_id*2+1];
+
+      for (int i = 0; i < n_ranks; i++) {
+        cs_gnum_t o_start = CS_MAX(d_start, g_range[i*2]);
+        cs_gnum_t o_end = CS_MIN(d_end, g_range[i*2+1]);
+        send_count[i] = 0; send_shift[i] = 0;
+        if (o_end > o_start) {
+          send_count[i] = (o_end - o_start)*elt_size;
+          send_shift[i] = (o_start - d_start)*elt_size;
+        }
+        o_start = CS_MAX(d_range[i*2], s_id);
+        o_end = CS_MIN(d_range[i*2+1], e_id);
+        recv_count[i] = 0; recv_shift[i] = 0;
+        if (o_end > o_start) {
+          recv_count[i] = (o_end - o_start)*elt_size;
+          recv_shift[i] = (o_start - s_id)*elt_size;
+        }
+      }
+
+      MPI_Alltoallv(dec, send_count, send_shift, MPI_BYTE,
+                    buf, recv_count, recv_shift, MPI_BYTE,
+                    inp->comm);
+
+      BFT_FREE(recv_shift);
+      BFT_FREE(recv_count);
+      BFT_FREE(send_shift);
+      BFT_FREE(send_count);
+
+      BFT_FREE(dec);
+    }
+
+    BFT_FREE(c_start);
+    BFT_FREE(d_range);
+    BFT_FREE(g_range);
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  BFT_FREE(table);
+
+  /* Position pointer after section body */
+
+  cs_file_seek(inp->f, body_start + inp->body_size, CS_FILE_SEEK_SET);
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------
  * Read a section body.
  *
@@ -1371,7 +2086,18 @@ _cs_io_read_body(const cs_io_sec_header_t  *header,
 
     /* Read local or global values */
 
-    if (global_num_start > 0 && global_num_end > 0) {
+    if (inp->codec != CS_IO_CODEC_NONE) {
+      size_t n_read = _read_body_encoded(global_num_start,
+                                         global_num_end,
+                                         stride,
+                                         type_size,
+                                         _buf,
+                                         inp);
+      if (log != NULL)
+        log->data_size[(global_num_start > 0) ? 1 : 0] += n_read;
+    }
+
+    else if (global_num_start > 0 && global_num_end > 0) {
       cs_file_read_block(inp->f,
                          _buf,
                          type_size,
@@ -1573,6 +2299,9 @@ _write_padding(size_t    align,
  *   n_location_vals  <-- number of values per location
  *   elt_type         <-- element type
  *   elts             <-- pointer to element data, if it may be embedded
+ *   codec            <-- body encoding type
+ *   body_size        <-- size of encoded body, if codec is not
+ *                        CS_IO_CODEC_NONE
  *   outp             --> output kernel IO structure
  *
  * returns:
@@ -1587,6 +2316,8 @@ _write_header(const char     *sec_name,
               size_t          n_location_vals,
               cs_datatype_t   elt_type,
               const void     *elts,
+              cs_io_codec_t   codec,
+              cs_file_off_t   body_size,
               cs_io_t        *outp)
 {
   cs_file_off_t header_vals[6];
@@ -1629,10 +2360,15 @@ _write_header(const char     *sec_name,
   header_vals[5] = name_size + name_pad_size;
   header_vals[0] += (name_size + name_pad_size);
 
+  /* Encoded body size is stored in place of embedded data */
+
+  if (codec != CS_IO_CODEC_NONE)
+    header_vals[0] += 8;
+
   /* Decide if data is to be embedded */
 
-  if (   n_vals > 0
-      && elts != NULL
+  else if (   n_vals > 0
+           && elts != NULL
       && (header_vals[0] + data_size <= (cs_file_off_t)(outp->header_size))) {
     header_vals[0] += data_size;
     embed = true;
@@ -1705,6 +2441,16 @@ _write_header(const char     *sec_name,
   if (embed == true)
     outp->type_name[7] = 'e';
 
+  else if (codec != CS_IO_CODEC_NONE) {
+    unsigned char *data =   (unsigned char *)(outp->buffer)
+                          + (56 + name_size + name_pad_size);
+    outp->type_name[2] = ':';
+    memcpy(outp->type_name + 3, _codec_tag[codec], 2);
+    _convert_from_offset(data, &body_size, 1);
+    if (cs_file_get_swap_endian(outp->f) == 1)
+      _swap_endian(data, 8, 1);
+  }
+
   /* Section name */
 
   strcpy((char *)(outp->buffer) + 56, sec_name);
@@ -1747,6 +2493,222 @@ _write_header(const char     *sec_name,
   return embed;
 }
 
+/*----------------------------------------------------------------------------
+ * Write an encoded section to file, each associated process providing
+ * a contiguous part of the section's body.
+ *
+ * Each local block is split into chunks of at most CS_IO_CODEC_CHUNK_SIZE
+ * values, which are encoded independently. The body contains the number
+ * of chunks, the chunk table (global number of each chunk's first element
+ * and past-the-end offset of its encoded data), then the encoded data.
+ *
+ * parameters:
+ *   section_name     <-- section name
+ *   n_g_elts         <-- number of global elements (locations)
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *   global_num_end   <-- global number of past-the end block item
+ *   location_id      <-- id of associated location, or 0
+ *   index_id         <-- id of associated index, or 0
+ *   n_location_vals  <-- number of values per location
+ *   elt_type         <-- element type
+ *   elts             <-- pointer to element data
+ *   outp             <-> output kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_block_encoded(const char     *sec_name,
+                     cs_gnum_t       n_g_elts,
+                     cs_gnum_t       global_num_start,
+                     cs_gnum_t       global_num_end,
+                     size_t          location_id,
+                     size_t          index_id,
+                     size_t          n_location_vals,
+                     cs_datatype_t   elt_type,
+                     const void     *elts,
+                     cs_io_t        *outp)
+{
+  double t_start = 0.;
+  size_t n_written = 0;
+  size_t stride = 1;
+  cs_io_log_t  *log = NULL;
+
+  cs_file_off_t  n_g_chunks = 0, enc_shift = 0;
+  cs_file_off_t  *table = NULL, *g_table = NULL;
+  unsigned char  *enc = NULL, *work = NULL, *table_buf = NULL;
+
+  const size_t type_size = cs_datatype_size[elt_type];
+  const cs_gnum_t n_elts = global_num_end - global_num_start;
+  const bool swap = (cs_file_get_swap_endian(outp->f) == 1) ? true : false;
+
+  if (n_location_vals > 1)
+    stride = n_location_vals;
+
+  if (outp->log_id > -1) {
+    log = _cs_io_log[outp->mode] + outp->log_id;
+    t_start = cs_timer_wtime();
+  }
+
+  /* Encode local chunks */
+
+  size_t chunk_elts = CS_IO_CODEC_CHUNK_SIZE / stride;
+  if (chunk_elts < 1)
+    chunk_elts = 1;
+
+  const size_t n_chunks = (n_elts + chunk_elts - 1) / chunk_elts;
+  const size_t elt_size = stride*type_size;
+
+  cs_file_off_t enc_size = 0;
+
+  BFT_MALLOC(table, n_chunks*2, cs_file_off_t);
+  BFT_MALLOC(enc, n_elts*elt_size, unsigned char);
+  BFT_MALLOC(work, CS_MIN(chunk_elts, n_elts)*elt_size, unsigned char);
+
+  for (size_t c = 0; c < n_chunks; c++) {
+    cs_gnum_t c_start = c*chunk_elts;
+    cs_gnum_t c_end = CS_MIN(c_start + chunk_elts, n_elts);
+    enc_size += _encode_chunk(outp->codec,
+                              type_size,
+                              (c_end - c_start)*stride,
+                              swap,
+                              (const unsigned char *)elts + c_start*elt_size,
+                              work,
+                              enc + enc_size);
+    table[c*2] = global_num_start + c_start;
+    table[c*2 + 1] = enc_size;
+  }
+
+  BFT_FREE(work);
+
+  /* Determine global chunk table */
+
+  n_g_chunks = n_chunks;
+  g_table = table;
+
+#if defined(HAVE_MPI)
+  if (outp->comm != MPI_COMM_NULL) {
+
+    int n_ranks = 1;
+    MPI_Comm_size(outp->comm, &n_ranks);
+
+    if (n_ranks > 1) {
+
+      int rank_id = 0;
+      int l_count = n_chunks*2;
+      int *g_count = NULL, *g_shift = NULL;
+      cs_file_off_t l_vals[2] = {n_chunks, enc_size}, g_vals[2];
+
+      MPI_Comm_rank(outp->comm, &rank_id);
+
+      MPI_Allreduce(l_vals, g_vals, 2, CS_IO_MPI_OFFSET, MPI_SUM,
+                    outp->comm);
+      MPI_Exscan(&enc_size, &enc_shift, 1, CS_IO_MPI_OFFSET, MPI_SUM,
+                 outp->comm);
+
+      if (rank_id == 0)
+        enc_shift = 0;
+
+      n_g_chunks = g_vals[0];
+
+      for (size_t c = 0; c < n_chunks; c++)
+        table[c*2 + 1] += enc_shift;
+
+      g_table = NULL;
+
+      if (rank_id == 0) {
+        BFT_MALLOC(g_count, n_ranks, int);
+        BFT_MALLOC(g_shift, n_ranks, int);
+        BFT_MALLOC(g_table, n_g_chunks*2, cs_file_off_t);
+      }
+
+      MPI_Gather(&l_count, 1, MPI_INT, g_count, 1, MPI_INT, 0, outp->comm);
+
+      if (rank_id == 0) {
+        g_shift[0] = 0;
+        for (int i = 1; i < n_ranks; i++)
+          g_shift[i] = g_shift[i-1] + g_count[i-1];
+      }
+
+      MPI_Gatherv(table, l_count, CS_IO_MPI_OFFSET,
+                  g_table, g_count, g_shift, CS_IO_MPI_OFFSET,
+                  0, outp->comm);
+
+      BFT_FREE(g_shift);
+      BFT_FREE(g_count);
+    }
+
+  }
+#endif /* defined(HAVE_MPI) */
+
+  /* Write header, chunk table, and encoded data */
+
+  const cs_file_off_t table_size = 8 + n_g_chunks*16;
+
+  BFT_MALLOC(table_buf, table_size, unsigned char);
+
+  _convert_from_offset(table_buf, &n_g_chunks, 1);
+  if (g_table != NULL)
+    _convert_from_offset(table_buf + 8, g_table, n_g_chunks*2);
+  if (swap)
+    _swap_endian(table_buf, 8, n_g_chunks*2 + 1);
+
+  if (g_table != table)
+    BFT_FREE(g_table);
+  BFT_FREE(table);
+
+  cs_file_off_t body_size = table_size + enc_shift + enc_size;
+
+#if defined(HAVE_MPI)
+  if (outp->comm != MPI_COMM_NULL) {
+    cs_file_off_t l_body_size = body_size;
+    MPI_Allreduce(&l_body_size, &body_size, 1, CS_IO_MPI_OFFSET, MPI_MAX,
+                  outp->comm);
+  }
+#endif
+
+  _write_header(sec_name,
+                n_g_elts*stride,
+                location_id,
+                index_id,
+                n_location_vals,
+                elt_type,
+                NULL,
+                outp->codec,
+                body_size,
+                outp);
+
+  _write_padding(outp->body_align, outp);
+
+  cs_file_write_global(outp->f, table_buf, 1, table_size);
+
+  BFT_FREE(table_buf);
+
+  n_written = cs_file_write_block_buffer(outp->f,
+                                         enc,
+                                         1,
+                                         1,
+                                         enc_shift + 1,
+                                         enc_shift + enc_size + 1);
+
+  if ((size_t)enc_size != n_written)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error writing %llu bytes to file \"%s\"."),
+              (unsigned long long)enc_size, cs_file_get_name(outp->f));
+
+  BFT_FREE(enc);
+
+  if (log != NULL) {
+    double t_end = cs_timer_wtime();
+    log->wtimes[1] += t_end - t_start;
+    log->data_size[1] += n_written;
+  }
+
+  if (n_elts != 0 && outp->echo > CS_IO_ECHO_HEADERS)
+    _echo_data(outp->echo, n_g_elts*stride,
+               (global_num_start-1)*stride + 1,
+               (global_num_end -1)*stride + 1,
+               elt_type, elts);
+}
+
 /*----------------------------------------------------------------------------
  * Dump a kernel IO file handle's metadata.
  *
@@ -1763,23 +2725,23 @@ _dump_index(const cs_io_sec_index_t  *idx)
 
   bft_printf(_(" %llu indexed records:\n"
                "   (name, n_vals, location_id, index_id, n_loc_vals, type, "
-               "embed, file_id, offset)\n\n"),
+               "embed, codec, offset)\n\n"),
              (unsigned long long)(idx->size));
 
   for (ii = 0; ii < idx->size; ii++) {
 
     char embed = 'n';
-    cs_file_off_t *h_vals = idx->h_vals + ii*7;
+    cs_file_off_t *h_vals = idx->h_vals + ii*9;
     const char *name = idx->names + h_vals[4];
 
     if (h_vals[5] > 0)
       embed = 'y';
 
-    bft_printf(_(" %40s %10llu %2u %2u %2u %6s %c %2u %ld\n"),
+    bft_printf(_(" %40s %10llu %2u %2u %2u %6s %c %s %ld\n"),
                name, (unsigned long long)(h_vals[0]),
                (unsigned)(h_vals[1]), (unsigned)(h_vals[2]),
                (unsigned)(h_vals[3]), cs_datatype_name[h_vals[6]],
-               embed, (unsigned)(h_vals[7]),
+               embed, _codec_tag[h_vals[7]],
                (long)(idx->offset[ii]));
 
   }
@@ -2036,7 +2998,7 @@ cs_io_get_indexed_sec_name(const cs_io_t  *inp,
 
   if (inp != NULL && inp->index != NULL) {
     if (id < inp->index->size) {
-      size_t name_id = inp->index->h_vals[7*id + 4];
+      size_t name_id = inp->index->h_vals[9*id + 4];
       retval = inp->index->names + name_id;
     }
   }
@@ -2066,16 +3028,17 @@ cs_io_get_indexed_sec_header(const cs_io_t  *inp,
   if (inp != NULL && inp->index != NULL) {
     if (id < inp->index->size) {
 
-      size_t name_id = inp->index->h_vals[7*id + 4];
+      size_t name_id = inp->index->h_vals[9*id + 4];
 
       h.sec_name = inp->index->names + name_id;
 
-      h.n_vals          = inp->index->h_vals[7*id];
-      h.location_id     = inp->index->h_vals[7*id + 1];
-      h.index_id        = inp->index->h_vals[7*id + 2];
-      h.n_location_vals = inp->index->h_vals[7*id + 3];
-      h.type_read       = (cs_datatype_t)(inp->index->h_vals[7*id + 6]);
+      h.n_vals          = inp->index->h_vals[9*id];
+      h.location_id     = inp->index->h_vals[9*id + 1];
+      h.index_id        = inp->index->h_vals[9*id + 2];
+      h.n_location_vals = inp->index->h_vals[9*id + 3];
+      h.type_read       = (cs_datatype_t)(inp->index->h_vals[9*id + 6]);
       h.elt_type        = _type_read_to_elt_type(h.type_read);
+      h.codec           = (cs_io_codec_t)(inp->index->h_vals[9*id + 7]);
     }
   }
 
@@ -2086,6 +3049,7 @@ cs_io_get_indexed_sec_header(const cs_io_t  *inp,
     h.n_location_vals = 0;
     h.type_read       = CS_DATATYPE_NULL;
     h.elt_type        = h.type_read;
+    h.codec           = CS_IO_CODEC_NONE;
   }
 
   return h;
@@ -2106,6 +3070,40 @@ cs_io_get_echo(const cs_io_t  *cs_io)
   return (size_t)(cs_io->echo);
 }
 
+/*----------------------------------------------------------------------------
+ * Set encoding of block sections written to a kernel IO structure.
+ *
+ * Sections written with cs_io_write_block() or cs_io_write_block_buffer()
+ * are split in chunks, whose values are byte-shuffled and compressed
+ * independently, so they may be read and decoded in parallel using a
+ * different distribution. Global and character sections are not encoded.
+ * Encoded sections are decoded transparently on read.
+ *
+ * If zlib is not available, CS_IO_CODEC_SHUFFLE_ZLIB is replaced by
+ * CS_IO_CODEC_SHUFFLE_RLE.
+ *
+ * parameters:
+ *   outp  <-> output kernel IO structure
+ *   codec <-- encoding type for block sections
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_set_codec(cs_io_t        *outp,
+                cs_io_codec_t   codec)
+{
+  assert(outp != NULL);
+
+  if (outp->mode != CS_IO_MODE_WRITE)
+    return;
+
+#if !defined(HAVE_ZLIB)
+  if (codec == CS_IO_CODEC_SHUFFLE_ZLIB)
+    codec = CS_IO_CODEC_SHUFFLE_RLE;
+#endif
+
+  outp->codec = codec;
+}
+
 /*----------------------------------------------------------------------------
  * Read a section header.
  *
@@ -2206,6 +3204,37 @@ cs_io_read_header(cs_io_t             *inp,
 
   inp->type_size = 0;
 
+  /* Encoded section: codec is appended to type name, and encoded
+     body size is stored in place of embedded data */
+
+  inp->codec = CS_IO_CODEC_NONE;
+  inp->body_size = 0;
+
+  if (header_vals[1] > 0 && inp->type_name[2] == ':') {
+    unsigned char *data = inp->buffer + 56 + header_vals[5];
+    for (int i = 1; i < 3; i++) {
+      if (strncmp(inp->type_name + 3, _codec_tag[i], 2) == 0)
+        inp->codec = i;
+    }
+    if (inp->codec == CS_IO_CODEC_NONE)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error reading file: \"%s\".\n"
+                  "Encoding \"%s\" of section \"%s\" is not recognized."),
+                cs_file_get_name(inp->f), inp->type_name + 3, inp->sec_name);
+#if !defined(HAVE_ZLIB)
+    if (inp->codec == CS_IO_CODEC_SHUFFLE_ZLIB)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error reading file: \"%s\".\n"
+                  "Section \"%s\" is compressed with zlib, which is not\n"
+                  "available in this build."),
+                cs_file_get_name(inp->f), inp->sec_name);
+#endif
+    if (cs_file_get_swap_endian(inp->f) == 1)
+      _swap_endian(data, 8, 1);
+    _convert_to_offset(data, &(inp->body_size), 1);
+    inp->type_name[2] = '\0';  /* Base type name only from here on */
+  }
+
   /* Return immediately if we have an end-of file marker */
 
   if ((inp->n_vals == 0) && (strcmp(inp->sec_name, "EOF") == 0))
@@ -2255,6 +3284,7 @@ cs_io_read_header(cs_io_t             *inp,
   header->location_id = inp->location_id;
   header->index_id = inp->index_id;
   header->n_location_vals = inp->n_loc_vals;
+  header->codec = inp->codec;
 
   /* Initialize data type */
   /*----------------------*/
@@ -2345,20 +3375,23 @@ cs_io_set_indexed_position(cs_io_t             *inp,
   if (id >= inp->index->size)
     return 1;
 
-  header->sec_name = inp->index->names + inp->index->h_vals[7*id + 4];
+  header->sec_name = inp->index->names + inp->index->h_vals[9*id + 4];
 
-  header->n_vals          = inp->index->h_vals[7*id];
-  header->location_id     = inp->index->h_vals[7*id + 1];
-  header->index_id        = inp->index->h_vals[7*id + 2];
-  header->n_location_vals = inp->index->h_vals[7*id + 3];
-  header->type_read       = (cs_datatype_t)(inp->index->h_vals[7*id + 6]);
+  header->n_vals          = inp->index->h_vals[9*id];
+  header->location_id     = inp->index->h_vals[9*id + 1];
+  header->index_id        = inp->index->h_vals[9*id + 2];
+  header->n_location_vals = inp->index->h_vals[9*id + 3];
+  header->type_read       = (cs_datatype_t)(inp->index->h_vals[9*id + 6]);
   header->elt_type        = _type_read_to_elt_type(header->type_read);
+  header->codec           = (cs_io_codec_t)(inp->index->h_vals[9*id + 7]);
 
   inp->n_vals      = header->n_vals;
   inp->location_id = header->location_id;
   inp->index_id    = header->index_id;
   inp->n_loc_vals  = header->n_location_vals;
   inp->type_size   = cs_datatype_size[header->type_read];
+  inp->codec       = header->codec;
+  inp->body_size   = inp->index->h_vals[9*id + 8];
 
   /* The following values are not taken from the header buffer as
      usual, but are base on the index */
@@ -2369,7 +3402,7 @@ cs_io_set_indexed_position(cs_io_t             *inp,
 
   /* Non-embedded values */
 
-  if (inp->index->h_vals[7*id + 5] == 0) {
+  if (inp->index->h_vals[9*id + 5] == 0) {
     cs_file_off_t offset = inp->index->offset[id];
     retval = cs_file_seek(inp->f, offset, CS_FILE_SEEK_SET);
   }
@@ -2377,7 +3410,7 @@ cs_io_set_indexed_position(cs_io_t             *inp,
   /* Embedded values */
 
   else {
-    size_t data_id = inp->index->h_vals[7*id + 5] - 1;
+    size_t data_id = inp->index->h_vals[9*id + 5] - 1;
     unsigned char *_data = inp->index->data + data_id;
     inp->data = _data;
   }
@@ -2803,6 +3836,8 @@ cs_io_write_global(const char     *sec_name,
                         n_location_vals,
                         elt_type,
                         elts,
+                        CS_IO_CODEC_NONE,
+                        0,
                         outp);
 
   if (n_vals > 0 && embed == false) {
@@ -2891,6 +3926,20 @@ cs_io_write_block(const char     *sec_name,
   size_t stride = 1;
   cs_io_log_t  *log = NULL;
 
+  if (outp->codec != CS_IO_CODEC_NONE && cs_datatype_size[elt_type] > 1) {
+    _write_block_encoded(sec_name,
+                         n_g_elts,
+                         global_num_start,
+                         global_num_end,
+                         location_id,
+                         index_id,
+                         n_location_vals,
+                         elt_type,
+                         elts,
+                         outp);
+    return;
+  }
+
   if (n_location_vals > 1) {
     stride = n_location_vals;
     n_g_vals *= n_location_vals;
@@ -2904,6 +3953,8 @@ cs_io_write_block(const char     *sec_name,
                 n_location_vals,
                 elt_type,
                 NULL,
+                CS_IO_CODEC_NONE,
+                0,
                 outp);
 
   if (outp->log_id > -1) {
@@ -2992,6 +4043,20 @@ cs_io_write_block_buffer(const char     *sec_name,
   size_t stride = 1;
   cs_io_log_t  *log = NULL;
 
+  if (outp->codec != CS_IO_CODEC_NONE && cs_datatype_size[elt_type] > 1) {
+    _write_block_encoded(sec_name,
+                         n_g_elts,
+                         global_num_start,
+                         global_num_end,
+                         location_id,
+                         index_id,
+                         n_location_vals,
+                         elt_type,
+                         elts,
+                         outp);
+    return;
+  }
+
   if (n_location_vals > 1) {
     stride = n_location_vals;
     n_g_vals *= n_location_vals;
@@ -3005,6 +4070,8 @@ cs_io_write_block_buffer(const char     *sec_name,
                 n_location_vals,
                 elt_type,
                 NULL,
+                CS_IO_CODEC_NONE,
+                0,
                 outp);
 
   if (outp->log_id > -1) {
@@ -3078,7 +4145,10 @@ cs_io_skip(const cs_io_sec_header_t  *header,
       cs_file_off_t offset = cs_file_tell(pp_io->f);
       size_t ba = pp_io->body_align;
       offset += (ba - (offset % ba)) % ba;
-      offset += n_vals*type_size;
+      if (pp_io->codec != CS_IO_CODEC_NONE)
+        offset += pp_io->body_size;
+      else
+        offset += n_vals*type_size;
       cs_file_seek(pp_io->f, offset, CS_FILE_SEEK_SET);
     }
 
@@ -63,6 +63,16 @@ BEGIN_C_DECLS
 
 } cs_io_mode_t;
 
+/* Section body encoding (optional lossless compression of block sections) */
+
+typedef enum {
+
+  CS_IO_CODEC_NONE,          /* Raw values */
+  CS_IO_CODEC_SHUFFLE_RLE,   /* Byte shuffle + run-length coding (built-in) */
+  CS_IO_CODEC_SHUFFLE_ZLIB   /* Byte shuffle + deflate (requires zlib) */
+
+} cs_io_codec_t;
+
 /* Structure associated with opaque pre-processing structure object */
 
 typedef struct _cs_io_t cs_io_t;
@@ -79,6 +89,7 @@ typedef struct {
   size_t          n_location_vals;    /* Number of values per location */
   cs_datatype_t   elt_type;           /* Type if n_elts > 0 */
   cs_datatype_t   type_read;          /* Type in file */
+  cs_io_codec_t   codec;              /* Encoding of section body */
 
 } cs_io_sec_header_t;
 
@@ -259,6 +270,27 @@ cs_io_get_indexed_sec_header(const cs_io_t  *inp,
 size_t
 cs_io_get_echo(const cs_io_t  *pp_io);
 
+/*----------------------------------------------------------------------------
+ * Set encoding of block sections written to a kernel IO structure.
+ *
+ * Sections written with cs_io_write_block() or cs_io_write_block_buffer()
+ * are split in chunks, whose values are byte-shuffled and compressed
+ * independently, so they may be read and decoded in parallel using a
+ * different distribution. Global and character sections are not encoded.
+ * Encoded sections are decoded transparently on read.
+ *
+ * If zlib is not available, CS_IO_CODEC_SHUFFLE_ZLIB is replaced by
+ * CS_IO_CODEC_SHUFFLE_RLE.
+ *
+ * parameters:
+ *   outp  <-> output kernel IO structure
+ *   codec <-- encoding type for block sections
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_set_codec(cs_io_t        *outp,
+                cs_io_codec_t   codec);
+
 /*----------------------------------------------------------------------------
  * Read a message header.
  *
@@ -0,0 +1,605 @@
+/*============================================================================
+ * Weighted repartitioning based on estimated cell costs
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_error.h"
+#include "bft_printf.h"
+
+#include "cs_1d_wall_thermal.h"
+#include "cs_ale.h"
+#include "cs_base.h"
+#include "cs_boundary_conditions.h"
+#include "cs_domain.h"
+#include "cs_fan.h"
+#include "cs_file.h"
+#include "cs_internal_coupling.h"
+#include "cs_lagr.h"
+#include "cs_lagr_particle.h"
+#include "cs_lagr_stat.h"
+#include "cs_log.h"
+#include "cs_mesh.h"
+#include "cs_mesh_builder.h"
+#include "cs_mesh_from_builder.h"
+#include "cs_mesh_location.h"
+#include "cs_mesh_quantities.h"
+#include "cs_mesh_to_builder.h"
+#include "cs_mesh_transfer.h"
+#include "cs_parall.h"
+#include "cs_partition.h"
+#include "cs_physical_model.h"
+#include "cs_post.h"
+#include "cs_preprocess.h"
+#include "cs_rad_transfer.h"
+#include "cs_restart.h"
+#include "cs_sat_coupling.h"
+#include "cs_syr_coupling.h"
+#include "cs_time_moment.h"
+#include "cs_time_step.h"
+#include "cs_turbomachinery.h"
+#include "cs_vof.h"
+#include "cs_volume_zone.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_load_balance.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_load_balance.c
+        Weighted repartitioning based on estimated cell costs.
+
+  The cost of each cell is estimated at each checkpoint and saved with it.
+  When restarting, if the estimated load imbalance is above a given
+  threshold, the mesh is repartitioned using those costs as cell weights,
+  and restart data is read on the new partition.
+
+  If a check interval is defined, the imbalance is also estimated
+  periodically during the computation; when it is too high, the mesh is
+  repartitioned in memory, and fields, boundary condition data, time
+  moments and particles are migrated to the new distribution.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static bool    _active = false;
+static double  _particle_weight = 1.;
+static double  _imbalance_threshold = 1.1;
+static int     _interval = 0;
+
+static const char _restart_name[] = "load_balance";
+static const char _section_name[] = "load_balance:cell_weight";
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Repartition and redistribute the mesh based on cell weights.
+ *
+ * parameters:
+ *   m       <-> pointer to mesh structure
+ *   weight  <-- estimated cost of each cell (size: n_cells)
+ *----------------------------------------------------------------------------*/
+
+static void
+_repartition_mesh(cs_mesh_t    *m,
+                  const float   weight[])
+{
+  bool partition_preprocess = cs_partition_get_preprocess();
+
+  int verbosity = m->verbosity;
+  m->verbosity = 0;
+
+  cs_partition_set_cell_weights(m, weight);
+  cs_partition_set_preprocess(true);
+
+  cs_mesh_builder_t *mb = cs_mesh_builder_create();
+
+  cs_mesh_to_builder(m, mb, true, NULL);
+  cs_partition(m, mb, CS_PARTITION_MAIN);
+  cs_mesh_from_builder(m, mb);
+  cs_mesh_init_halo(m, mb, m->halo_type);
+  cs_mesh_update_auxiliary(m);
+
+  cs_mesh_builder_destroy(&mb);
+
+  cs_partition_set_preprocess(partition_preprocess);
+
+  m->verbosity = verbosity;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate weighted repartitioning based on estimated cell costs.
+ *
+ * Cell costs are estimated at each checkpoint, and saved with it. When
+ * restarting from that checkpoint, the mesh is repartitioned using
+ * those costs as cell weights if the estimated load imbalance is too high.
+ * The mesh is also redistributed during a run if a check interval is
+ * defined using \ref cs_load_balance_set_interval.
+ *
+ * \param[in]  particle_weight      cost of a particle relative to that
+ *                                  of a cell
+ * \param[in]  imbalance_threshold  repartition if the ratio of maximum
+ *                                  to mean rank costs exceeds this value
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_define(double  particle_weight,
+                       double  imbalance_threshold)
+{
+  _active = true;
+  _particle_weight = particle_weight;
+  _imbalance_threshold = imbalance_threshold;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the time step interval at which the load imbalance is
+ *        checked during the computation.
+ *
+ * \param[in]  interval  check interval (in time steps), or 0 to
+ *                       only rebalance at restart
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_set_interval(int  interval)
+{
+  _interval = CS_MAX(interval, 0);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the time step interval at which the load imbalance is
+ *        checked during the computation.
+ *
+ * \return  check interval (in time steps), or 0 if only rebalancing
+ *          at restart
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_load_balance_get_interval(void)
+{
+  return _interval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute estimated cell costs.
+ *
+ * The cost of a cell is 1, plus the relative particle cost multiplied
+ * by the number of particles in that cell.
+ *
+ * \param[in]   m       pointer to mesh structure
+ * \param[out]  weight  estimated cost of each cell (size: n_cells)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_compute_weights(const cs_mesh_t  *m,
+                                float             weight[])
+{
+  for (cs_lnum_t i = 0; i < m->n_cells; i++)
+    weight[i] = 1.;
+
+  const cs_lagr_particle_set_t *p_set = NULL;
+  if (cs_glob_lagr_time_scheme != NULL) {
+    if (cs_glob_lagr_time_scheme->iilagr != CS_LAGR_OFF)
+      p_set = cs_lagr_get_particle_set();
+  }
+
+  if (p_set != NULL) {
+    const float p_w = _particle_weight;
+    for (cs_lnum_t p_id = 0; p_id < p_set->n_particles; p_id++) {
+      cs_lnum_t c_id = cs_lagr_particles_get_lnum(p_set, p_id,
+                                                  CS_LAGR_CELL_ID);
+      if (c_id > -1 && c_id < m->n_cells)
+        weight[c_id] += p_w;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute ratio of maximum to mean rank costs.
+ *
+ * \param[in]  m       pointer to mesh structure
+ * \param[in]  weight  estimated cost of each cell (size: n_cells)
+ *
+ * \return  load imbalance ratio (1 for a perfect balance)
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_load_balance_imbalance(const cs_mesh_t  *m,
+                          const float       weight[])
+{
+  double imbalance = 1.;
+
+  double w_sum[2] = {0, 0};
+  for (cs_lnum_t i = 0; i < m->n_cells; i++)
+    w_sum[0] += weight[i];
+  w_sum[1] = w_sum[0];
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    cs_parall_max(1, CS_DOUBLE, w_sum);
+    cs_parall_sum(1, CS_DOUBLE, w_sum + 1);
+    double w_mean = w_sum[1] / cs_glob_n_ranks;
+    if (w_mean > 0)
+      imbalance = w_sum[0] / w_mean;
+  }
+#endif
+
+  return imbalance;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write estimated cell costs to the current checkpoint if
+ *        load balancing is active.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_write_weights(void)
+{
+  if (_active == false)
+    return;
+
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  float *weight;
+  cs_real_t *_weight;
+  BFT_MALLOC(weight, m->n_cells, float);
+  BFT_MALLOC(_weight, m->n_cells, cs_real_t);
+
+  cs_load_balance_compute_weights(m, weight);
+
+  for (cs_lnum_t i = 0; i < m->n_cells; i++)
+    _weight[i] = weight[i];
+
+  double imbalance = cs_load_balance_imbalance(m, weight);
+
+  cs_log_printf(CS_LOG_DEFAULT,
+                _("\n Estimated load imbalance (max/mean): %g\n"),
+                imbalance);
+
+  cs_restart_t *r = cs_restart_create(_restart_name,
+                                      NULL,
+                                      CS_RESTART_MODE_WRITE);
+
+  cs_restart_write_section(r,
+                           _section_name,
+                           CS_MESH_LOCATION_CELLS,
+                           1,
+                           CS_TYPE_cs_real_t,
+                           _weight);
+
+  cs_restart_destroy(&r);
+
+  BFT_FREE(_weight);
+  BFT_FREE(weight);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Request repartitioning of the mesh based on cell costs read from
+ *        the restart directory, if load balancing is active and the
+ *        estimated imbalance is too high.
+ *
+ * This function is called during the mesh preprocessing stage.
+ *
+ * \param[in]  m  pointer to mesh structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_apply(const cs_mesh_t  *m)
+{
+  if (_active == false || cs_glob_n_ranks < 2 || cs_restart_present() == 0)
+    return;
+
+  if (   cs_file_isreg("restart/load_balance.csc") == 0
+      && cs_file_isreg("restart/load_balance") == 0)
+    return;
+
+  cs_real_t *_weight;
+  BFT_MALLOC(_weight, m->n_cells, cs_real_t);
+
+  cs_restart_t *r = cs_restart_create(_restart_name,
+                                      NULL,
+                                      CS_RESTART_MODE_READ);
+
+  int retval = cs_restart_read_section(r,
+                                       _section_name,
+                                       CS_MESH_LOCATION_CELLS,
+                                       1,
+                                       CS_TYPE_cs_real_t,
+                                       _weight);
+
+  cs_restart_destroy(&r);
+
+  /* Cell costs do not match the mesh if it was modified */
+
+  if (retval != CS_RESTART_SUCCESS) {
+    BFT_FREE(_weight);
+    return;
+  }
+
+  float *weight;
+  BFT_MALLOC(weight, m->n_cells, float);
+
+  for (cs_lnum_t i = 0; i < m->n_cells; i++)
+    weight[i] = _weight[i];
+
+  BFT_FREE(_weight);
+
+  double imbalance = cs_load_balance_imbalance(m, weight);
+
+  bft_printf(_("\n Estimated load imbalance (max/mean) from checkpoint: %g\n"),
+             imbalance);
+
+  if (imbalance > _imbalance_threshold) {
+    bft_printf(_("   repartitioning based on estimated cell costs.\n"));
+    cs_partition_set_cell_weights(m, weight);
+    cs_partition_set_preprocess(true);
+  }
+
+  BFT_FREE(weight);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check if the current setup allows modifying the mesh during
+ *        the computation.
+ *
+ * \return  NULL if supported, or description of the first unsupported option
+ */
+/*----------------------------------------------------------------------------*/
+
+const char *
+cs_load_balance_runtime_unsupported(void)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  if (cs_glob_ale > 0)
+    return _("ALE");
+  if (cs_turbomachinery_get_model() != CS_TURBOMACHINERY_NONE)
+    return _("turbomachinery");
+  if (cs_glob_porous_model > 0)
+    return _("porosity");
+  if (cs_internal_coupling_n_couplings() > 0)
+    return _("internal coupling");
+  if (cs_glob_domain != NULL) {
+    if (cs_domain_get_cdo_mode(cs_glob_domain) != CS_DOMAIN_CDO_MODE_OFF)
+      return _("CDO schemes");
+  }
+  if (   cs_sat_coupling_n_couplings() > 0
+      || cs_syr_coupling_n_couplings() > 0)
+    return _("code coupling");
+  if (cs_fan_n_fans() > 0)
+    return _("fans");
+  if (   cs_volume_zone_n_type_zones(CS_VOLUME_ZONE_HEAD_LOSS) > 0
+      || cs_volume_zone_n_type_zones(CS_VOLUME_ZONE_MASS_SOURCE_TERM) > 0)
+    return _("head losses or mass source terms");
+  if (cs_glob_1d_wall_thermal != NULL) {
+    if (cs_glob_1d_wall_thermal->nfpt1t > 0)
+      return _("1D wall thermal model");
+  }
+  if (cs_glob_rad_transfer_params->type != CS_RAD_TRANSFER_NONE)
+    return _("radiative transfer");
+  if (cs_glob_physical_model_flag[CS_PHYSICAL_MODEL_FLAG] > 0)
+    return _("specific physics");
+  if (cs_get_glob_vof_parameters()->vof_model & CS_VOF_MERKLE_MASS_TRANSFER)
+    return _("cavitation");
+  if (m->n_b_faces != m->n_b_faces_all)
+    return _("ignored boundary faces");
+
+  if (cs_glob_lagr_time_scheme->iilagr != CS_LAGR_OFF) {
+    const cs_lagr_model_t *lagr_model = cs_glob_lagr_model;
+    if (   lagr_model->deposition > 0
+        || lagr_model->dlvo > 0
+        || lagr_model->roughness > 0
+        || lagr_model->resuspension > 0
+        || lagr_model->clogging > 0
+        || lagr_model->consolidation > 0
+        || lagr_model->precipitation > 0
+        || lagr_model->fouling > 0)
+      return _("Lagrangian deposition models");
+  }
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Repartition the mesh in memory based on given cell weights, and
+ *        migrate associated data to the new distribution.
+ *
+ * Field values, boundary condition coefficients and types, time moments,
+ * and Lagrangian particles and arrays are migrated to the new distribution,
+ * and mesh-dependent structures are rebuilt.
+ *
+ * \param[in]  weight  estimated cost of each cell (size: n_cells)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_redistribute(const float  weight[])
+{
+  cs_mesh_t *m = cs_glob_mesh;
+
+  /* Save previous distribution, then rebuild mesh */
+
+  cs_mesh_transfer_t *mt = cs_mesh_transfer_create(m);
+
+  _repartition_mesh(m, weight);
+
+  cs_preprocess_mesh_update_runtime();
+
+  /* Migrate data */
+
+  cs_mesh_transfer_fields(mt);
+  cs_boundary_conditions_mesh_transfer(mt);
+  cs_time_moment_mesh_transfer(mt);
+
+  if (cs_glob_lagr_time_scheme->iilagr != CS_LAGR_OFF) {
+    cs_lagr_stat_mesh_transfer(mt);
+    cs_lagr_mesh_transfer(mt);
+  }
+
+  cs_post_redistribute_meshes();
+
+  cs_mesh_transfer_destroy(&mt);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Redistribute the mesh and associated data during the computation
+ *        if load balancing is active, the current time step matches the
+ *        check interval, and the estimated imbalance is too high.
+ *
+ * The mesh is repartitioned in memory, and field values, boundary
+ * condition coefficients and types, time moments, and Lagrangian
+ * particles and arrays are migrated to the new distribution.
+ * Mesh-dependent structures are then rebuilt.
+ *
+ * \return  true if the mesh was redistributed, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_load_balance_update(void)
+{
+  if (_active == false || _interval < 1 || cs_glob_n_ranks < 2)
+    return false;
+
+  if (cs_glob_time_step->nt_cur % _interval != 0)
+    return false;
+
+  const char *unsupported = cs_load_balance_runtime_unsupported();
+
+  if (unsupported != NULL) {
+    cs_log_printf(CS_LOG_DEFAULT,
+                  _("\n Load balancing during the computation is not "
+                    "available with %s;\n"
+                    " rebalancing will only be done at restart.\n"),
+                  unsupported);
+    _interval = 0;
+    return false;
+  }
+
+  cs_mesh_t *m = cs_glob_mesh;
+
+  float *weight;
+  BFT_MALLOC(weight, m->n_cells, float);
+
+  cs_load_balance_compute_weights(m, weight);
+
+  double imbalance = cs_load_balance_imbalance(m, weight);
+
+  cs_log_printf(CS_LOG_DEFAULT,
+                _("\n Estimated load imbalance (max/mean): %g\n"),
+                imbalance);
+
+  if (imbalance <= _imbalance_threshold) {
+    BFT_FREE(weight);
+    return false;
+  }
+
+  cs_log_printf(CS_LOG_DEFAULT,
+                _("   redistributing mesh based on estimated cell costs.\n"));
+
+  cs_load_balance_redistribute(weight);
+
+  BFT_REALLOC(weight, m->n_cells, float);
+
+  cs_load_balance_compute_weights(m, weight);
+
+  imbalance = cs_load_balance_imbalance(m, weight);
+
+  BFT_FREE(weight);
+
+  cs_log_printf(CS_LOG_DEFAULT,
+                _("   estimated load imbalance after redistribution: %g\n"),
+                imbalance);
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,206 @@
+#ifndef __CS_LOAD_BALANCE_H__
+#define __CS_LOAD_BALANCE_H__
+
+/*============================================================================
+ * Weighted repartitioning based on estimated cell costs
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+#include "cs_mesh.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate weighted repartitioning based on estimated cell costs.
+ *
+ * Cell costs are estimated at each checkpoint, and saved with it. When
+ * restarting from that checkpoint, the mesh is repartitioned using
+ * those costs as cell weights if the estimated load imbalance is too high.
+ * The mesh is also redistributed during a run if a check interval is
+ * defined using \ref cs_load_balance_set_interval.
+ *
+ * \param[in]  particle_weight      cost of a particle relative to that
+ *                                  of a cell
+ * \param[in]  imbalance_threshold  repartition if the ratio of maximum
+ *                                  to mean rank costs exceeds this value
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_define(double  particle_weight,
+                       double  imbalance_threshold);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the time step interval at which the load imbalance is
+ *        checked during the computation.
+ *
+ * \param[in]  interval  check interval (in time steps), or 0 to
+ *                       only rebalance at restart
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_set_interval(int  interval);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the time step interval at which the load imbalance is
+ *        checked during the computation.
+ *
+ * \return  check interval (in time steps), or 0 if only rebalancing
+ *          at restart
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_load_balance_get_interval(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute estimated cell costs.
+ *
+ * The cost of a cell is 1, plus the relative particle cost multiplied
+ * by the number of particles in that cell.
+ *
+ * \param[in]   m       pointer to mesh structure
+ * \param[out]  weight  estimated cost of each cell (size: n_cells)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_compute_weights(const cs_mesh_t  *m,
+                                float             weight[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute ratio of maximum to mean rank costs.
+ *
+ * \param[in]  m       pointer to mesh structure
+ * \param[in]  weight  estimated cost of each cell (size: n_cells)
+ *
+ * \return  load imbalance ratio (1 for a perfect balance)
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_load_balance_imbalance(const cs_mesh_t  *m,
+                          const float       weight[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write estimated cell costs to the current checkpoint if
+ *        load balancing is active.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_write_weights(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Request repartitioning of the mesh based on cell costs read from
+ *        the restart directory, if load balancing is active and the
+ *        estimated imbalance is too high.
+ *
+ * This function is called during the mesh preprocessing stage.
+ *
+ * \param[in]  m  pointer to mesh structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_apply(const cs_mesh_t  *m);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check if the current setup allows modifying the mesh during
+ *        the computation.
+ *
+ * \return  NULL if supported, or description of the first unsupported option
+ */
+/*----------------------------------------------------------------------------*/
+
+const char *
+cs_load_balance_runtime_unsupported(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Repartition the mesh in memory based on given cell weights, and
+ *        migrate associated data to the new distribution.
+ *
+ * Field values, boundary condition coefficients and types, time moments,
+ * and Lagrangian particles and arrays are migrated to the new distribution,
+ * and mesh-dependent structures are rebuilt.
+ *
+ * \param[in]  weight  estimated cost of each cell (size: n_cells)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_balance_redistribute(const float  weight[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Redistribute the mesh and associated data during the computation
+ *        if load balancing is active, the current time step matches the
+ *        check interval, and the estimated imbalance is too high.
+ *
+ * The mesh is repartitioned in memory, and field values, boundary
+ * condition coefficients and types, time moments, and Lagrangian
+ * particles and arrays are migrated to the new distribution.
+ * Mesh-dependent structures are then rebuilt.
+ *
+ * \return  true if the mesh was redistributed, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_load_balance_update(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_LOAD_BALANCE_H__ */
@@ -537,6 +537,10 @@ _log_fields(void)
   cs_mesh_t *m = cs_glob_mesh;
   const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
 
+  /* All global reductions for a given location are grouped */
+
+  cs_parall_reduce_t *r = cs_parall_reduce_create();
+
   /* Allocate working arrays */
 
   log_count_max = n_fields;
@@ -566,6 +570,7 @@ _log_fields(void)
     int loc_id = m_l[li];
     cs_lnum_t have_weight = 0;
     double total_weight = -1;
+    bool sum_total_weight = false;
     cs_gnum_t n_g_elts = 0;
     cs_real_t *gather_array = NULL; /* only if CS_MESH_LOCATION_VERTICES */
     const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(loc_id);
@@ -584,14 +589,14 @@ _log_fields(void)
         n_g_elts = m->n_g_i_faces;
         weight = mq->i_face_surf;
         cs_array_reduce_sum_l(_n_elts, 1, NULL, weight, &total_weight);
-        cs_parall_sum(1, CS_DOUBLE, &total_weight);
+        sum_total_weight = true;
         have_weight = 1;
         break;
       case CS_MESH_LOCATION_BOUNDARY_FACES:
         n_g_elts = m->n_g_b_faces;
         weight = mq->b_face_surf;
         cs_array_reduce_sum_l(_n_elts, 1, NULL, weight, &total_weight);
-        cs_parall_sum(1, CS_DOUBLE, &total_weight);
+        sum_total_weight = true;
         have_weight = 1;
         break;
       case CS_MESH_LOCATION_VERTICES:
@@ -695,10 +700,8 @@ _log_fields(void)
                                        vmax + log_count,
                                        vsum + log_count);
 
-        if (have_weight) {
-          for (c_id = 0; c_id < _dim; c_id++)
-            wsum[log_count + c_id] = 0.;
-        }
+        for (c_id = 0; c_id < _dim; c_id++)
+          wsum[log_count + c_id] = 0.;
       }
 
       log_count += _dim;
@@ -725,15 +728,18 @@ _log_fields(void)
 
     /* Group MPI operations if required */
 
-    cs_parall_min(log_count, CS_DOUBLE, vmin);
-    cs_parall_max(log_count, CS_DOUBLE, vmax);
-    cs_parall_sum(log_count, CS_DOUBLE, vsum);
+    cs_parall_reduce_add(r, CS_PARALL_REDUCE_MIN, CS_DOUBLE, log_count, vmin);
+    cs_parall_reduce_add(r, CS_PARALL_REDUCE_MAX, CS_DOUBLE, log_count, vmax);
+    cs_parall_reduce_add(r, CS_PARALL_REDUCE_SUM, CS_DOUBLE, log_count, vsum);
+    cs_parall_reduce_add(r, CS_PARALL_REDUCE_SUM, CS_DOUBLE, log_count, wsum);
+    cs_parall_reduce_add(r, CS_PARALL_REDUCE_MAX, CS_LNUM_TYPE, 1,
+                         &have_weight);
+    if (sum_total_weight)
+      cs_parall_reduce_add(r, CS_PARALL_REDUCE_SUM, CS_DOUBLE, 1,
+                           &total_weight);
 
-#   if defined(HAVE_MPI)
-    cs_parall_counter_max(&have_weight, 1);
-    if (have_weight)
-      cs_parall_sum(log_count, CS_DOUBLE, wsum);
-#   endif
+    cs_parall_reduce_start(r);
+    cs_parall_reduce_wait(r);
 
     /* Print headers */
 
@@ -839,6 +845,8 @@ _log_fields(void)
     bft_error(__FILE__, __LINE__, 0,
                 _("Invalid (not-a-number) values detected for a field."));
 
+  cs_parall_reduce_destroy(&r);
+
   BFT_FREE(moment_id);
   BFT_FREE(wsum);
   BFT_FREE(vsum);
@@ -883,10 +891,20 @@ _log_sstats(void)
 
   /* Group MPI operations if required */
 
-  cs_parall_min(_sstats_val_size, CS_DOUBLE, vmin);
-  cs_parall_max(_sstats_val_size, CS_DOUBLE, vmax);
-  cs_parall_sum(_sstats_val_size, CS_DOUBLE, vsum);
-  cs_parall_sum(_sstats_val_size, CS_DOUBLE, wsum);
+  cs_parall_reduce_t *r = cs_parall_reduce_create();
+
+  cs_parall_reduce_add(r, CS_PARALL_REDUCE_MIN, CS_DOUBLE,
+                       _sstats_val_size, vmin);
+  cs_parall_reduce_add(r, CS_PARALL_REDUCE_MAX, CS_DOUBLE,
+                       _sstats_val_size, vmax);
+  cs_parall_reduce_add(r, CS_PARALL_REDUCE_SUM, CS_DOUBLE,
+                       _sstats_val_size, vsum);
+  cs_parall_reduce_add(r, CS_PARALL_REDUCE_SUM, CS_DOUBLE,
+                       _sstats_val_size, wsum);
+
+  cs_parall_reduce_start(r);
+  cs_parall_reduce_wait(r);
+  cs_parall_reduce_destroy(&r);
 
   /* Loop on statistics */
 
@@ -1222,11 +1240,19 @@ _log_clips(void)
   memcpy(vmax, _clips_vmax, _clips_val_size*sizeof(double));
   memcpy(vcount, _clips_count, _clips_val_size*sizeof(cs_gnum_t)*2);
 
-  /* Group MPI operations if required */
+  /* Group MPI operations if required; the reduction is completed
+     after the name widths are determined. */
+
+  cs_parall_reduce_t *r = cs_parall_reduce_create();
 
-  cs_parall_min(_clips_val_size, CS_DOUBLE, vmin);
-  cs_parall_max(_clips_val_size, CS_DOUBLE, vmax);
-  cs_parall_sum(_clips_val_size*2, CS_GNUM_TYPE, vcount);
+  cs_parall_reduce_add(r, CS_PARALL_REDUCE_MIN, CS_DOUBLE,
+                       _clips_val_size, vmin);
+  cs_parall_reduce_add(r, CS_PARALL_REDUCE_MAX, CS_DOUBLE,
+                       _clips_val_size, vmax);
+  cs_parall_reduce_add(r, CS_PARALL_REDUCE_SUM, CS_GNUM_TYPE,
+                       _clips_val_size*2, vcount);
+
+  cs_parall_reduce_start(r);
 
   /* Fist loop on clippings for counting */
 
@@ -1266,6 +1292,9 @@ _log_clips(void)
 
   max_name_width = CS_MIN(max_name_width, 63);
 
+  cs_parall_reduce_wait(r);
+  cs_parall_reduce_destroy(&r);
+
   /* Loop on types */
 
   for (int cat_id = 0; cat_id < 2; cat_id++) {
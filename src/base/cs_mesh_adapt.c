@@ -0,0 +1,1262 @@
+/*============================================================================
+ * Solution-adaptive mesh refinement and coarsening
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_error.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_boundary_conditions.h"
+#include "cs_field.h"
+#include "cs_field_operator.h"
+#include "cs_field_pointer.h"
+#include "cs_file.h"
+#include "cs_halo.h"
+#include "cs_lagr.h"
+#include "cs_load_balance.h"
+#include "cs_log.h"
+#include "cs_math.h"
+#include "cs_mesh.h"
+#include "cs_mesh_coarsen.h"
+#include "cs_mesh_location.h"
+#include "cs_mesh_quantities.h"
+#include "cs_divergence.h"
+#include "cs_mesh_refine.h"
+#include "cs_mesh_save.h"
+#include "cs_order.h"
+#include "cs_parall.h"
+#include "cs_parameters.h"
+#include "cs_partition.h"
+#include "cs_post.h"
+#include "cs_preprocess.h"
+#include "cs_restart.h"
+#include "cs_restart_map.h"
+#include "cs_time_moment.h"
+#include "cs_time_step.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_mesh_adapt.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_mesh_adapt.c
+        Solution-adaptive mesh refinement and coarsening.
+
+  If an adaptation interval is defined, the mesh is adapted in memory
+  every N time steps: cells are coarsened then refined based on the
+  current error indicator, mesh-dependent structures are rebuilt, and
+  fields are mapped to the adapted mesh. Values of merged cells are the
+  volume-weighted mean of the previous cell values, and refined cells
+  inherit the value of their parent, so that volume integrals are
+  preserved. The interior mass flux is recomputed from the mapped
+  velocity and density.
+
+  Otherwise, adaptation is done at restart boundaries: an error indicator
+  is saved with each checkpoint, and when restarting, the mesh read (which
+  should be the mesh saved with the checkpoint) is refined or coarsened
+  based on that indicator. Restart data is then mapped to the adapted mesh
+  using the same conservative mapping for merged cells.
+
+  In both cases, the mesh is repartitioned if the load imbalance is
+  too high.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Adaptation options */
+
+typedef struct {
+
+  char    *field_name;           /* Name of associated field */
+
+  double   refine_threshold;     /* Relative refinement threshold */
+  double   coarsen_threshold;    /* Relative coarsening threshold */
+  int      max_level;            /* Maximum refinement level */
+  double   imbalance_threshold;  /* Repartitioning threshold */
+
+} cs_mesh_adapt_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static cs_mesh_adapt_t  *_adapt = NULL;
+static int               _interval = 0;
+
+static const char _restart_name[] = "mesh_adapt";
+static const char _section_name[] = "mesh_adapt:indicator";
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Compute the current cell refinement level.
+ *
+ * parameters:
+ *   m <-- pointer to mesh structure
+ *
+ * returns:
+ *   refinement level for each cell (size: n_cells_with_ghosts)
+ *----------------------------------------------------------------------------*/
+
+static char *
+_cell_r_level(const cs_mesh_t  *m)
+{
+  char *c_r_level;
+  BFT_MALLOC(c_r_level, m->n_cells_with_ghosts, char);
+
+  for (cs_lnum_t i = 0; i < m->n_cells_with_ghosts; i++)
+    c_r_level[i] = 0;
+
+  if (m->i_face_r_gen == NULL)
+    return c_r_level;
+
+  for (cs_lnum_t f_id = 0; f_id < m->n_i_faces; f_id++) {
+    for (cs_lnum_t i = 0; i < 2; i++) {
+      cs_lnum_t c_id = m->i_face_cells[f_id][i];
+      if (m->i_face_r_gen[f_id] > c_r_level[c_id])
+        c_r_level[c_id] = m->i_face_r_gen[f_id];
+    }
+  }
+
+  return c_r_level;
+}
+
+/*----------------------------------------------------------------------------
+ * Return ratio of maximum to mean local cell counts.
+ *
+ * parameters:
+ *   m <-- pointer to mesh structure
+ *----------------------------------------------------------------------------*/
+
+static double
+_cell_imbalance(const cs_mesh_t  *m)
+{
+  double imbalance = 1.;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    cs_lnum_t n_max = m->n_cells;
+    cs_parall_max(1, CS_LNUM_TYPE, &n_max);
+    double n_mean = (double)(m->n_g_cells) / cs_glob_n_ranks;
+    if (n_mean > 0)
+      imbalance = n_max / n_mean;
+  }
+#else
+  CS_UNUSED(m);
+#endif
+
+  return imbalance;
+}
+
+/*----------------------------------------------------------------------------
+ * Return the field associated with adaptation.
+ *
+ * returns:
+ *   pointer to field
+ *----------------------------------------------------------------------------*/
+
+static const cs_field_t *
+_indicator_field(void)
+{
+  const cs_field_t *f = cs_field_by_name_try(_adapt->field_name);
+
+  if (f == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Mesh adaptation field \"%s\" is not defined."),
+              _adapt->field_name);
+
+  return f;
+}
+
+/*----------------------------------------------------------------------------
+ * Coarsen then refine flagged cells.
+ *
+ * Cells are coarsened first, so as to transfer refinement flags to the
+ * new cells.
+ *
+ * parameters:
+ *   m              <-> pointer to mesh structure
+ *   refine_flag    <-- refinement flag (size: n_cells)
+ *   coarsen_flag   <-- coarsening flag (size: n_cells)
+ *   n_g_flagged    <-- global number of cells flagged for refinement
+ *                      and coarsening
+ *   c_o2n          --> if non-NULL, old to coarsened cell ids
+ *                      (NULL if no cell was coarsened)
+ *   c_o2n_idx      --> if non-NULL, coarsened to refined cells index
+ *                      (NULL if no cell was refined)
+ *   b_face_o2n_idx --> if non-NULL, old to refined boundary faces index
+ *                      (NULL if no cell was refined)
+ *
+ * returns:
+ *   number of cells after coarsening
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_coarsen_and_refine(cs_mesh_t         *m,
+                    const int          refine_flag[],
+                    const int          coarsen_flag[],
+                    const cs_gnum_t    n_g_flagged[2],
+                    cs_lnum_t        **c_o2n,
+                    cs_lnum_t        **c_o2n_idx,
+                    cs_lnum_t        **b_face_o2n_idx)
+{
+  const int *_refine_flag = refine_flag;
+  int *c_refine_flag = NULL;
+  cs_lnum_t *_c_o2n = NULL;
+
+  if (n_g_flagged[1] > 0) {
+
+    cs_lnum_t n_cells_ini = m->n_cells;
+
+    cs_mesh_coarsen_simple_map(m, coarsen_flag, &_c_o2n);
+
+    BFT_MALLOC(c_refine_flag, m->n_cells, int);
+    for (cs_lnum_t i = 0; i < m->n_cells; i++)
+      c_refine_flag[i] = 0;
+    for (cs_lnum_t i = 0; i < n_cells_ini; i++) {
+      if (refine_flag[i] > 0)
+        c_refine_flag[_c_o2n[i]] = 1;
+    }
+
+    _refine_flag = c_refine_flag;
+
+  }
+
+  cs_lnum_t n_cells_c = m->n_cells;
+
+  if (n_g_flagged[0] > 0)
+    cs_mesh_refine_simple_map(m, true, _refine_flag,
+                              c_o2n_idx, b_face_o2n_idx);
+
+  BFT_FREE(c_refine_flag);
+
+  if (c_o2n != NULL)
+    *c_o2n = _c_o2n;
+  else
+    BFT_FREE(_c_o2n);
+
+  return n_cells_c;
+}
+
+/*----------------------------------------------------------------------------
+ * Log adaptation counts.
+ *
+ * parameters:
+ *   n_g_flagged   <-- global number of cells flagged for refinement
+ *                     and coarsening
+ *   n_g_cells_ini <-- global number of cells before adaptation
+ *   n_g_cells     <-- global number of cells after adaptation
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_adaptation(const cs_gnum_t  n_g_flagged[2],
+                cs_gnum_t        n_g_cells_ini,
+                cs_gnum_t        n_g_cells)
+{
+  bft_printf(_("\n Mesh adaptation based on \"%s\":\n"
+               "   cells flagged for refinement: %llu\n"
+               "   cells flagged for coarsening: %llu\n"
+               "   number of cells: %llu -> %llu\n"),
+             _adapt->field_name,
+             (unsigned long long)n_g_flagged[0],
+             (unsigned long long)n_g_flagged[1],
+             (unsigned long long)n_g_cells_ini,
+             (unsigned long long)n_g_cells);
+}
+
+/*----------------------------------------------------------------------------
+ * Copy global element numbers, using implicit numbering when no global
+ * numbering is defined.
+ *
+ * parameters:
+ *   n_elts <-- number of elements
+ *   g_num  <-- global element numbers, or NULL
+ *
+ * returns:
+ *   newly allocated global element numbers array
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t *
+_copy_gnum(cs_lnum_t         n_elts,
+           const cs_gnum_t  *g_num)
+{
+  cs_gnum_t *gnum;
+  BFT_MALLOC(gnum, n_elts, cs_gnum_t);
+
+  if (g_num != NULL)
+    memcpy(gnum, g_num, n_elts*sizeof(cs_gnum_t));
+  else {
+    for (cs_lnum_t i = 0; i < n_elts; i++)
+      gnum[i] = (cs_gnum_t)i + 1;
+  }
+
+  return gnum;
+}
+
+/*----------------------------------------------------------------------------
+ * Build the local renumbering of elements based on global numbers saved
+ * before renumbering.
+ *
+ * parameters:
+ *   n_elts    <-- number of elements
+ *   gnum_prev <-- global element numbers before renumbering
+ *   g_num     <-- current global element numbers, or NULL
+ *
+ * returns:
+ *   newly allocated new to old element ids array
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t *
+_renum_n2o(cs_lnum_t         n_elts,
+           const cs_gnum_t   gnum_prev[],
+           const cs_gnum_t  *g_num)
+{
+  cs_gnum_t *gnum = _copy_gnum(n_elts, g_num);
+
+  cs_lnum_t *order_prev = cs_order_gnum(NULL, gnum_prev, n_elts);
+  cs_lnum_t *order = cs_order_gnum(NULL, gnum, n_elts);
+
+  cs_lnum_t *n2o;
+  BFT_MALLOC(n2o, n_elts, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    assert(gnum[order[i]] == gnum_prev[order_prev[i]]);
+    n2o[order[i]] = order_prev[i];
+  }
+
+  BFT_FREE(order);
+  BFT_FREE(order_prev);
+  BFT_FREE(gnum);
+
+  return n2o;
+}
+
+/*----------------------------------------------------------------------------
+ * Map a boundary face array to the adapted mesh.
+ *
+ * parameters:
+ *   n_b_faces <-- number of boundary faces
+ *   b_src     <-- previous boundary face matching each boundary face
+ *   stride    <-- number of values per face
+ *   val       <-> pointer to array of values
+ *----------------------------------------------------------------------------*/
+
+static void
+_remap_b_face_array(cs_lnum_t         n_b_faces,
+                    const cs_lnum_t   b_src[],
+                    cs_lnum_t         stride,
+                    cs_real_t       **val)
+{
+  cs_real_t *val_prev = *val;
+
+  if (val_prev == NULL)
+    return;
+
+  cs_real_t *_val;
+  BFT_MALLOC(_val, n_b_faces*stride, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_b_faces; i++) {
+    for (cs_lnum_t k = 0; k < stride; k++)
+      _val[i*stride + k] = val_prev[b_src[i]*stride + k];
+  }
+
+  BFT_FREE(*val);
+  *val = _val;
+}
+
+/*----------------------------------------------------------------------------
+ * Map field values and boundary condition coefficients to the adapted mesh.
+ *
+ * Values of coarsened cells are the volume-weighted mean of the previous
+ * cell values, and refined cells inherit the value of their parent, so
+ * that volume integrals are preserved. Boundary face values are inherited
+ * from the parent face, and boundary mass fluxes are scaled by the face
+ * surface ratio. Values on other locations are reset to zero.
+ *
+ * parameters:
+ *   m                <-- pointer to mesh structure
+ *   n_cells_prev     <-- previous number of cells
+ *   c_o2n            <-- previous to coarsened cell ids, or NULL
+ *   cell_vol_prev    <-- previous cell volumes
+ *   n_cells_c        <-- number of cells after coarsening
+ *   c_src            <-- coarsened cell matching each cell
+ *   b_src            <-- previous boundary face matching each boundary face
+ *   b_face_surf_prev <-- previous boundary face surfaces
+ *   b_face_surf      <-- boundary face surfaces
+ *----------------------------------------------------------------------------*/
+
+static void
+_remap_fields(const cs_mesh_t  *m,
+              cs_lnum_t         n_cells_prev,
+              const cs_lnum_t  *c_o2n,
+              const cs_real_t   cell_vol_prev[],
+              cs_lnum_t         n_cells_c,
+              const cs_lnum_t   c_src[],
+              const cs_lnum_t   b_src[],
+              const cs_real_t   b_face_surf_prev[],
+              const cs_real_t   b_face_surf[])
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+
+  const int n_fields = cs_field_n_fields();
+  const int coupled_key_id = cs_field_key_id_try("coupled");
+  const int kbmasf = cs_field_key_id_try("boundary_mass_flux_id");
+
+  /* Boundary mass fluxes are scaled by the face surface ratio */
+
+  bool *is_b_flux;
+  BFT_MALLOC(is_b_flux, n_fields, bool);
+  for (int f_id = 0; f_id < n_fields; f_id++)
+    is_b_flux[f_id] = false;
+
+  for (int f_id = 0; f_id < n_fields; f_id++) {
+    const cs_field_t *f = cs_field_by_id(f_id);
+    if (f->type & CS_FIELD_VARIABLE && kbmasf > -1) {
+      int b_flux_id = cs_field_get_key_int(f, kbmasf);
+      if (b_flux_id > -1)
+        is_b_flux[b_flux_id] = true;
+    }
+  }
+
+  /* Total volume of each coarsened cell */
+
+  cs_real_t *cell_vol_c = NULL;
+
+  if (c_o2n != NULL) {
+    BFT_MALLOC(cell_vol_c, n_cells_c, cs_real_t);
+    for (cs_lnum_t i = 0; i < n_cells_c; i++)
+      cell_vol_c[i] = 0.;
+    for (cs_lnum_t i = 0; i < n_cells_prev; i++)
+      cell_vol_c[c_o2n[i]] += cell_vol_prev[i];
+  }
+
+  for (int f_id = 0; f_id < n_fields; f_id++) {
+
+    cs_field_t *f = cs_field_by_id(f_id);
+
+    if (f->is_owner == false)
+      continue;
+
+    const cs_lnum_t dim = f->dim;
+
+    for (int kk = 0; kk < f->n_time_vals; kk++) {
+
+      cs_real_t *val_prev = f->vals[kk];
+      cs_real_t *val = NULL;
+
+      if (f->location_id == CS_MESH_LOCATION_CELLS) {
+
+        const cs_real_t *val_c = val_prev;
+        cs_real_t *_val_c = NULL;
+
+        if (c_o2n != NULL) {
+          BFT_MALLOC(_val_c, n_cells_c*dim, cs_real_t);
+          for (cs_lnum_t i = 0; i < n_cells_c*dim; i++)
+            _val_c[i] = 0.;
+          for (cs_lnum_t i = 0; i < n_cells_prev; i++) {
+            cs_lnum_t j = c_o2n[i];
+            for (cs_lnum_t k = 0; k < dim; k++)
+              _val_c[j*dim + k] += cell_vol_prev[i] * val_prev[i*dim + k];
+          }
+          for (cs_lnum_t j = 0; j < n_cells_c; j++) {
+            for (cs_lnum_t k = 0; k < dim; k++)
+              _val_c[j*dim + k] /= cell_vol_c[j];
+          }
+          val_c = _val_c;
+        }
+
+        BFT_MALLOC(val, n_cells_ext*dim, cs_real_t);
+        for (cs_lnum_t i = 0; i < n_cells; i++) {
+          cs_lnum_t j = c_src[i];
+          for (cs_lnum_t k = 0; k < dim; k++)
+            val[i*dim + k] = val_c[j*dim + k];
+        }
+        for (cs_lnum_t i = n_cells*dim; i < n_cells_ext*dim; i++)
+          val[i] = 0.;
+
+        BFT_FREE(_val_c);
+
+      }
+
+      else if (f->location_id == CS_MESH_LOCATION_BOUNDARY_FACES) {
+
+        BFT_MALLOC(val, n_b_faces*dim, cs_real_t);
+        for (cs_lnum_t i = 0; i < n_b_faces; i++) {
+          cs_lnum_t j = b_src[i];
+          cs_real_t s = 1.;
+          if (is_b_flux[f_id] && b_face_surf_prev[j] > 0)
+            s = b_face_surf[i] / b_face_surf_prev[j];
+          for (cs_lnum_t k = 0; k < dim; k++)
+            val[i*dim + k] = s * val_prev[j*dim + k];
+        }
+
+      }
+
+      else {
+
+        const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(f->location_id);
+        BFT_MALLOC(val, n_elts[2]*dim, cs_real_t);
+        for (cs_lnum_t i = 0; i < n_elts[2]*dim; i++)
+          val[i] = 0.;
+
+      }
+
+      BFT_FREE(f->vals[kk]);
+      f->vals[kk] = val;
+
+    }
+
+    if (f->n_time_vals > 1)
+      f->val_pre = f->vals[1];
+
+    /* cs_field_synchronize handles current values only */
+
+    for (int kk = f->n_time_vals - 1; kk >= 0; kk--) {
+      f->val = f->vals[kk];
+      cs_field_synchronize(f, CS_HALO_EXTENDED);
+    }
+
+    /* Boundary condition coefficients */
+
+    cs_field_bc_coeffs_t *bc_coeffs = f->bc_coeffs;
+
+    if (bc_coeffs == NULL)
+      continue;
+
+    cs_lnum_t a_mult = dim, b_mult = dim;
+    if (f->type & CS_FIELD_VARIABLE && coupled_key_id > -1) {
+      if (cs_field_get_key_int(f, coupled_key_id))
+        b_mult *= dim;
+    }
+
+    cs_real_t **a_coeffs[] = {&(bc_coeffs->a), &(bc_coeffs->af),
+                              &(bc_coeffs->ad), &(bc_coeffs->ac)};
+    cs_real_t **b_coeffs[] = {&(bc_coeffs->b), &(bc_coeffs->bf),
+                              &(bc_coeffs->bd), &(bc_coeffs->bc)};
+
+    for (int i = 0; i < 4; i++) {
+      _remap_b_face_array(n_b_faces, b_src, a_mult, a_coeffs[i]);
+      _remap_b_face_array(n_b_faces, b_src, b_mult, b_coeffs[i]);
+    }
+
+    _remap_b_face_array(n_b_faces, b_src, 1, &(bc_coeffs->hint));
+    _remap_b_face_array(n_b_faces, b_src, 1, &(bc_coeffs->hext));
+
+  }
+
+  BFT_FREE(cell_vol_c);
+  BFT_FREE(is_b_flux);
+}
+
+/*----------------------------------------------------------------------------
+ * Recompute the interior mass flux from the mapped velocity and density.
+ *
+ * parameters:
+ *   m  <-- pointer to mesh structure
+ *   mq <-- pointer to mesh quantities structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_mass_flux(const cs_mesh_t       *m,
+                  cs_mesh_quantities_t  *mq)
+{
+  cs_field_t *f_vel = CS_F_(vel);
+
+  if (f_vel == NULL || CS_F_(rho) == NULL || CS_F_(rho_b) == NULL)
+    return;
+
+  const int kimasf = cs_field_key_id_try("inner_mass_flux_id");
+  int i_flux_id = (kimasf > -1) ? cs_field_get_key_int(f_vel, kimasf) : -1;
+
+  if (i_flux_id < 0)
+    return;
+
+  cs_field_t *f_i_flux = cs_field_by_id(i_flux_id);
+
+  cs_var_cal_opt_t vcopt;
+  cs_field_get_key_struct(f_vel, cs_field_key_id("var_cal_opt"), &vcopt);
+
+  /* Boundary mass flux was already mapped */
+
+  cs_real_t *b_flux;
+  BFT_MALLOC(b_flux, m->n_b_faces, cs_real_t);
+
+  cs_mass_flux(m,
+               mq,
+               f_vel->id,
+               1,  /* itypfl: rho.u */
+               1,  /* iflmb0 */
+               1,  /* init */
+               1,  /* inc */
+               vcopt.imrgra,
+               vcopt.nswrgr,
+               vcopt.imligr,
+               vcopt.iwarni,
+               vcopt.epsrgr,
+               vcopt.climgr,
+               CS_F_(rho)->val,
+               CS_F_(rho_b)->val,
+               (const cs_real_3_t *)f_vel->val,
+               (const cs_real_3_t *)f_vel->bc_coeffs->a,
+               (const cs_real_33_t *)f_vel->bc_coeffs->b,
+               f_i_flux->val,
+               b_flux);
+
+  BFT_FREE(b_flux);
+
+  for (int kk = 1; kk < f_i_flux->n_time_vals; kk++)
+    memcpy(f_i_flux->vals[kk], f_i_flux->val,
+           m->n_i_faces*sizeof(cs_real_t));
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate solution-adaptive mesh refinement and coarsening.
+ *
+ * An error indicator based on the given field is saved with each
+ * checkpoint. When restarting from that checkpoint, cells are refined
+ * or coarsened based on that indicator during the mesh preprocessing
+ * stage, and restart data is mapped to the adapted mesh.
+ *
+ * The mesh may instead be adapted periodically during the computation,
+ * using \ref cs_mesh_adapt_set_interval.
+ *
+ * Cells are refined when their indicator is above refine_threshold times
+ * the global maximum indicator, and coarsened when it is below
+ * coarsen_threshold times that maximum.
+ *
+ * \param[in]  field_name           name of associated (scalar) cell field
+ * \param[in]  refine_threshold     relative refinement threshold
+ * \param[in]  coarsen_threshold    relative coarsening threshold
+ *                                  (< 0 to disable coarsening)
+ * \param[in]  max_level            maximum refinement level
+ * \param[in]  imbalance_threshold  repartition if the ratio of maximum
+ *                                  to mean local cell counts exceeds
+ *                                  this value (< 1 to disable)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_define(const char  *field_name,
+                     double       refine_threshold,
+                     double       coarsen_threshold,
+                     int          max_level,
+                     double       imbalance_threshold)
+{
+  if (_adapt == NULL) {
+    BFT_MALLOC(_adapt, 1, cs_mesh_adapt_t);
+    _adapt->field_name = NULL;
+  }
+
+  size_t l = strlen(field_name);
+  BFT_REALLOC(_adapt->field_name, l + 1, char);
+  strcpy(_adapt->field_name, field_name);
+
+  _adapt->refine_threshold = refine_threshold;
+  _adapt->coarsen_threshold = coarsen_threshold;
+  _adapt->max_level = max_level;
+  _adapt->imbalance_threshold = imbalance_threshold;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the time step interval at which the mesh is adapted
+ *        during the computation.
+ *
+ * When an interval is defined, the mesh is adapted in memory, so
+ * post-processing writers defined after this call allow changing
+ * connectivity, and the error indicator is not saved with checkpoints.
+ *
+ * \param[in]  interval  adaptation interval (in time steps), or 0 to
+ *                       only adapt at restart
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_set_interval(int  interval)
+{
+  _interval = interval;
+
+  if (_interval > 0)
+    cs_post_set_changing_connectivity();
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the time step interval at which the mesh is adapted
+ *        during the computation.
+ *
+ * \return  adaptation interval (in time steps), or 0 if only adapting
+ *          at restart
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_mesh_adapt_get_interval(void)
+{
+  return _interval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute a cell error indicator based on gradient jumps.
+ *
+ * For each cell, the indicator is the maximum over its interior faces of
+ * the jump between values reconstructed at the face center from the
+ * gradients of each adjacent cell.
+ *
+ * \param[in]   f          pointer to scalar cell field
+ * \param[out]  indicator  error indicator (size: n_cells)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_compute_indicator(const cs_field_t  *f,
+                                cs_real_t          indicator[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+
+  if (   f->location_id != CS_MESH_LOCATION_CELLS || f->dim != 1
+      || f->bc_coeffs == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: field \"%s\" is not a scalar cell-based variable\n"
+                "with boundary condition coefficients."),
+              __func__, f->name);
+
+  cs_real_3_t *grad;
+  BFT_MALLOC(grad, n_cells_ext, cs_real_3_t);
+
+  cs_field_gradient_scalar(f,
+                           false,  /* use_previous_t */
+                           1,      /* inc */
+                           true,   /* recompute_cocg */
+                           grad);
+
+  if (m->halo != NULL)
+    cs_halo_sync_var_strided(m->halo, CS_HALO_STANDARD, (cs_real_t *)grad, 3);
+
+  const cs_real_t *restrict val = f->val;
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)mq->cell_cen;
+  const cs_real_3_t *restrict i_face_cog
+    = (const cs_real_3_t *restrict)mq->i_face_cog;
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    indicator[c_id] = 0.;
+
+  for (cs_lnum_t f_id = 0; f_id < m->n_i_faces; f_id++) {
+
+    cs_lnum_t c_id0 = m->i_face_cells[f_id][0];
+    cs_lnum_t c_id1 = m->i_face_cells[f_id][1];
+
+    cs_real_t d0[3], d1[3];
+    for (int k = 0; k < 3; k++) {
+      d0[k] = i_face_cog[f_id][k] - cell_cen[c_id0][k];
+      d1[k] = i_face_cog[f_id][k] - cell_cen[c_id1][k];
+    }
+
+    cs_real_t jump = fabs(  val[c_id0] + cs_math_3_dot_product(grad[c_id0], d0)
+                          - val[c_id1] - cs_math_3_dot_product(grad[c_id1], d1));
+
+    if (c_id0 < n_cells && jump > indicator[c_id0])
+      indicator[c_id0] = jump;
+    if (c_id1 < n_cells && jump > indicator[c_id1])
+      indicator[c_id1] = jump;
+
+  }
+
+  BFT_FREE(grad);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Flag cells for refinement or coarsening based on an indicator.
+ *
+ * \param[in]   m            pointer to mesh structure
+ * \param[in]   indicator    error indicator (size: n_cells)
+ * \param[out]  refine_flag  refinement flag (size: n_cells)
+ * \param[out]  coarsen_flag coarsening flag (size: n_cells)
+ * \param[out]  n_g_flagged  global number of cells flagged for refinement
+ *                           and coarsening
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_flag_cells(const cs_mesh_t  *m,
+                         const cs_real_t   indicator[],
+                         int               refine_flag[],
+                         int               coarsen_flag[],
+                         cs_gnum_t         n_g_flagged[2])
+{
+  assert(_adapt != NULL);
+
+  const cs_lnum_t n_cells = m->n_cells;
+
+  cs_real_t i_max = 0.;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    if (indicator[c_id] > i_max)
+      i_max = indicator[c_id];
+  }
+  cs_parall_max(1, CS_REAL_TYPE, &i_max);
+
+  const cs_real_t r_threshold = _adapt->refine_threshold * i_max;
+  const cs_real_t c_threshold = _adapt->coarsen_threshold * i_max;
+
+  char *c_r_level = _cell_r_level(m);
+
+  n_g_flagged[0] = 0;
+  n_g_flagged[1] = 0;
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    refine_flag[c_id] = 0;
+    coarsen_flag[c_id] = 0;
+    if (i_max <= 0.)
+      continue;
+    if (   indicator[c_id] > r_threshold
+        && c_r_level[c_id] < _adapt->max_level) {
+      refine_flag[c_id] = 1;
+      n_g_flagged[0] += 1;
+    }
+    else if (   _adapt->coarsen_threshold >= 0
+             && indicator[c_id] < c_threshold
+             && c_r_level[c_id] > 0) {
+      coarsen_flag[c_id] = 1;
+      n_g_flagged[1] += 1;
+    }
+  }
+
+  BFT_FREE(c_r_level);
+
+  cs_parall_counter(n_g_flagged, 2);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write the error indicator to the current checkpoint if
+ *        adaptation is active and only done at restart.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_write_indicator(void)
+{
+  if (_adapt == NULL || _interval > 0)
+    return;
+
+  const cs_field_t *f = _indicator_field();
+
+  cs_real_t *indicator;
+  BFT_MALLOC(indicator, cs_glob_mesh->n_cells, cs_real_t);
+
+  cs_mesh_adapt_compute_indicator(f, indicator);
+
+  cs_restart_t *r = cs_restart_create(_restart_name,
+                                      NULL,
+                                      CS_RESTART_MODE_WRITE);
+
+  cs_restart_write_section(r,
+                           _section_name,
+                           CS_MESH_LOCATION_CELLS,
+                           1,
+                           CS_TYPE_cs_real_t,
+                           indicator);
+
+  cs_restart_destroy(&r);
+
+  BFT_FREE(indicator);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Adapt the mesh based on the error indicator read from the
+ *        restart directory, if adaptation is active.
+ *
+ * This function is called during the mesh preprocessing stage.
+ *
+ * \param[in, out]  m  pointer to mesh structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_apply(cs_mesh_t  *m)
+{
+  if (_adapt == NULL || cs_restart_present() == 0)
+    return;
+
+  char path[] = "restart/mesh_adapt.csc";
+  if (cs_file_isreg(path) == 0 && cs_file_isreg("restart/mesh_adapt") == 0)
+    return;
+
+  /* Read indicator; this requires the mesh read to be the one
+     saved with the checkpoint */
+
+  cs_real_t *indicator;
+  BFT_MALLOC(indicator, m->n_cells, cs_real_t);
+
+  cs_restart_t *r = cs_restart_create(_restart_name,
+                                      NULL,
+                                      CS_RESTART_MODE_READ);
+
+  int retval = cs_restart_read_section(r,
+                                       _section_name,
+                                       CS_MESH_LOCATION_CELLS,
+                                       1,
+                                       CS_TYPE_cs_real_t,
+                                       indicator);
+
+  cs_restart_destroy(&r);
+
+  if (retval != CS_RESTART_SUCCESS) {
+    cs_base_warn(__FILE__, __LINE__);
+    bft_printf(_("Mesh adaptation indicator could not be read from the\n"
+                 "restart directory; the mesh used for the computation\n"
+                 "should be the one saved with the checkpoint\n"
+                 "(restart/mesh_input.csm). The mesh is not adapted.\n"));
+    BFT_FREE(indicator);
+    return;
+  }
+
+  /* Flag cells */
+
+  int *refine_flag, *coarsen_flag;
+  BFT_MALLOC(refine_flag, m->n_cells, int);
+  BFT_MALLOC(coarsen_flag, m->n_cells, int);
+
+  cs_gnum_t n_g_flagged[2];
+  cs_mesh_adapt_flag_cells(m, indicator, refine_flag, coarsen_flag,
+                           n_g_flagged);
+
+  BFT_FREE(indicator);
+
+  cs_gnum_t n_g_cells_ini = m->n_g_cells;
+
+  _coarsen_and_refine(m, refine_flag, coarsen_flag, n_g_flagged,
+                      NULL, NULL, NULL);
+
+  BFT_FREE(coarsen_flag);
+  BFT_FREE(refine_flag);
+
+  _log_adaptation(n_g_flagged, n_g_cells_ini, m->n_g_cells);
+
+  if (n_g_flagged[0] + n_g_flagged[1] == 0)
+    return;
+
+  /* Map restart data from the previous mesh; if the run environment
+     did not already provide it, use the checkpointed mesh.
+     Cell values of merged cells are mapped conservatively. */
+
+  if (cs_file_isreg("restart_mesh_input") == 0) {
+    if (cs_file_isreg("restart/mesh_input.csm"))
+      cs_restart_map_set_mesh_input("restart/mesh_input.csm");
+    else if (cs_file_isreg("restart/mesh_input"))
+      cs_restart_map_set_mesh_input("restart/mesh_input");
+  }
+
+  cs_restart_map_set_conservative(true);
+
+  /* Repartition if needed */
+
+  if (_adapt->imbalance_threshold >= 1.) {
+    double imbalance = _cell_imbalance(m);
+    if (imbalance > _adapt->imbalance_threshold) {
+      bft_printf(_("   cell imbalance: %g; repartitioning.\n"), imbalance);
+      cs_partition_set_preprocess(true);
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Adapt the mesh and map associated data during the computation
+ *        if adaptation is active and the current time step matches the
+ *        adaptation interval.
+ *
+ * Cells are coarsened then refined in memory based on the current error
+ * indicator, and mesh-dependent structures (halos, renumbering, matrix
+ * structures, ...) are rebuilt. Cell values are mapped conservatively,
+ * boundary values and condition coefficients are inherited from parent
+ * faces, and the interior mass flux is recomputed. The mesh is then
+ * repartitioned if the cell imbalance is too high.
+ *
+ * \return  true if the mesh was modified, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_adapt_update(void)
+{
+  if (_adapt == NULL || _interval < 1)
+    return false;
+
+  if (cs_glob_time_step->nt_cur % _interval != 0)
+    return false;
+
+  const char *unsupported = cs_load_balance_runtime_unsupported();
+
+  if (unsupported == NULL) {
+    if (cs_glob_lagr_time_scheme->iilagr != CS_LAGR_OFF)
+      unsupported = _("Lagrangian particle tracking");
+    else if (cs_time_moment_n_moments() > 0)
+      unsupported = _("time moments");
+  }
+
+  if (unsupported != NULL) {
+    cs_log_printf(CS_LOG_DEFAULT,
+                  _("\n Mesh adaptation during the computation is not "
+                    "available with %s;\n"
+                    " adaptation will only be done at restart.\n"),
+                  unsupported);
+    _interval = 0;
+    return false;
+  }
+
+  cs_mesh_t *m = cs_glob_mesh;
+  cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+
+  /* Flag cells */
+
+  cs_real_t *indicator;
+  BFT_MALLOC(indicator, m->n_cells, cs_real_t);
+
+  cs_mesh_adapt_compute_indicator(_indicator_field(), indicator);
+
+  int *refine_flag, *coarsen_flag;
+  BFT_MALLOC(refine_flag, m->n_cells, int);
+  BFT_MALLOC(coarsen_flag, m->n_cells, int);
+
+  cs_gnum_t n_g_flagged[2];
+  cs_mesh_adapt_flag_cells(m, indicator, refine_flag, coarsen_flag,
+                           n_g_flagged);
+
+  BFT_FREE(indicator);
+
+  if (n_g_flagged[0] + n_g_flagged[1] == 0) {
+    _log_adaptation(n_g_flagged, m->n_g_cells, m->n_g_cells);
+    BFT_FREE(coarsen_flag);
+    BFT_FREE(refine_flag);
+    return false;
+  }
+
+  /* Save previous quantities, then adapt mesh */
+
+  const cs_gnum_t n_g_cells_ini = m->n_g_cells;
+  const cs_lnum_t n_cells_prev = m->n_cells;
+  const cs_lnum_t n_b_faces_prev = m->n_b_faces;
+
+  cs_real_t *cell_vol_prev, *b_face_surf_prev;
+  BFT_MALLOC(cell_vol_prev, n_cells_prev, cs_real_t);
+  BFT_MALLOC(b_face_surf_prev, n_b_faces_prev, cs_real_t);
+  memcpy(cell_vol_prev, mq->cell_vol, n_cells_prev*sizeof(cs_real_t));
+  memcpy(b_face_surf_prev, mq->b_face_surf,
+         n_b_faces_prev*sizeof(cs_real_t));
+
+  cs_lnum_t *c_o2n = NULL, *c_o2n_idx = NULL, *b_face_o2n_idx = NULL;
+
+  cs_lnum_t n_cells_c = _coarsen_and_refine(m, refine_flag, coarsen_flag,
+                                            n_g_flagged, &c_o2n,
+                                            &c_o2n_idx, &b_face_o2n_idx);
+
+  BFT_FREE(coarsen_flag);
+  BFT_FREE(refine_flag);
+
+  _log_adaptation(n_g_flagged, n_g_cells_ini, m->n_g_cells);
+
+  /* Coarsened cell (resp. previous boundary face) matching each
+     adapted cell (resp. boundary face) */
+
+  cs_lnum_t *c_src, *b_src;
+  BFT_MALLOC(c_src, m->n_cells, cs_lnum_t);
+  BFT_MALLOC(b_src, m->n_b_faces, cs_lnum_t);
+
+  if (c_o2n_idx != NULL) {
+    for (cs_lnum_t i = 0; i < n_cells_c; i++) {
+      for (cs_lnum_t j = c_o2n_idx[i]; j < c_o2n_idx[i+1]; j++)
+        c_src[j] = i;
+    }
+    for (cs_lnum_t i = 0; i < n_b_faces_prev; i++) {
+      for (cs_lnum_t j = b_face_o2n_idx[i]; j < b_face_o2n_idx[i+1]; j++)
+        b_src[j] = i;
+    }
+  }
+  else {
+    for (cs_lnum_t i = 0; i < m->n_cells; i++)
+      c_src[i] = i;
+    for (cs_lnum_t i = 0; i < m->n_b_faces; i++)
+      b_src[i] = i;
+  }
+
+  BFT_FREE(c_o2n_idx);
+  BFT_FREE(b_face_o2n_idx);
+
+  /* Save adapted mesh so that checkpoints may be restarted from */
+
+  if (m->save_if_modified > 0)
+    cs_mesh_save(m, NULL, NULL, "mesh_output.csm");
+
+  /* Rebuild mesh structures, accounting for renumbering */
+
+  cs_gnum_t *c_gnum = _copy_gnum(m->n_cells, m->global_cell_num);
+  cs_gnum_t *b_gnum = _copy_gnum(m->n_b_faces, m->global_b_face_num);
+
+  cs_preprocess_mesh_update_runtime();
+
+  {
+    cs_lnum_t *c_n2o = _renum_n2o(m->n_cells, c_gnum, m->global_cell_num);
+    cs_lnum_t *c_src_renum;
+    BFT_MALLOC(c_src_renum, m->n_cells, cs_lnum_t);
+    for (cs_lnum_t i = 0; i < m->n_cells; i++)
+      c_src_renum[i] = c_src[c_n2o[i]];
+    BFT_FREE(c_n2o);
+    BFT_FREE(c_src);
+    c_src = c_src_renum;
+
+    cs_lnum_t *b_n2o = _renum_n2o(m->n_b_faces, b_gnum, m->global_b_face_num);
+    cs_lnum_t *b_src_renum;
+    BFT_MALLOC(b_src_renum, m->n_b_faces, cs_lnum_t);
+    for (cs_lnum_t i = 0; i < m->n_b_faces; i++)
+      b_src_renum[i] = b_src[b_n2o[i]];
+    BFT_FREE(b_n2o);
+    BFT_FREE(b_src);
+    b_src = b_src_renum;
+  }
+
+  BFT_FREE(b_gnum);
+  BFT_FREE(c_gnum);
+
+  /* Map data */
+
+  _remap_fields(m,
+                n_cells_prev,
+                c_o2n,
+                cell_vol_prev,
+                n_cells_c,
+                c_src,
+                b_src,
+                b_face_surf_prev,
+                mq->b_face_surf);
+
+  BFT_FREE(b_src);
+  BFT_FREE(c_src);
+  BFT_FREE(c_o2n);
+  BFT_FREE(b_face_surf_prev);
+  BFT_FREE(cell_vol_prev);
+
+  /* Boundary condition types are redefined at each time step */
+
+  cs_boundary_conditions_free();
+  cs_boundary_conditions_create();
+
+  _update_mass_flux(m, mq);
+
+  cs_post_redistribute_meshes();
+
+  /* Repartition if needed */
+
+  if (_adapt->imbalance_threshold >= 1.) {
+    double imbalance = _cell_imbalance(m);
+    if (imbalance > _adapt->imbalance_threshold) {
+      bft_printf(_("   cell imbalance: %g; repartitioning.\n"), imbalance);
+      float *weight;
+      BFT_MALLOC(weight, m->n_cells, float);
+      cs_load_balance_compute_weights(m, weight);
+      cs_load_balance_redistribute(weight);
+      BFT_FREE(weight);
+    }
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free solution-adaptive mesh refinement settings.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_finalize(void)
+{
+  if (_adapt != NULL) {
+    BFT_FREE(_adapt->field_name);
+    BFT_FREE(_adapt);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
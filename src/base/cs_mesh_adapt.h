@@ -0,0 +1,212 @@
+#ifndef __CS_MESH_ADAPT_H__
+#define __CS_MESH_ADAPT_H__
+
+/*============================================================================
+ * Solution-adaptive mesh refinement and coarsening
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+#include "cs_field.h"
+#include "cs_mesh.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate solution-adaptive mesh refinement and coarsening.
+ *
+ * An error indicator based on the given field is saved with each
+ * checkpoint. When restarting from that checkpoint, cells are refined
+ * or coarsened based on that indicator during the mesh preprocessing
+ * stage, and restart data is mapped to the adapted mesh.
+ *
+ * The mesh may instead be adapted periodically during the computation,
+ * using \ref cs_mesh_adapt_set_interval.
+ *
+ * Cells are refined when their indicator is above refine_threshold times
+ * the global maximum indicator, and coarsened when it is below
+ * coarsen_threshold times that maximum.
+ *
+ * \param[in]  field_name           name of associated (scalar) cell field
+ * \param[in]  refine_threshold     relative refinement threshold
+ * \param[in]  coarsen_threshold    relative coarsening threshold
+ *                                  (< 0 to disable coarsening)
+ * \param[in]  max_level            maximum refinement level
+ * \param[in]  imbalance_threshold  repartition if the ratio of maximum
+ *                                  to mean local cell counts exceeds
+ *                                  this value (< 1 to disable)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_define(const char  *field_name,
+                     double       refine_threshold,
+                     double       coarsen_threshold,
+                     int          max_level,
+                     double       imbalance_threshold);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the time step interval at which the mesh is adapted
+ *        during the computation.
+ *
+ * When an interval is defined, the mesh is adapted in memory, so
+ * post-processing writers defined after this call allow changing
+ * connectivity, and the error indicator is not saved with checkpoints.
+ *
+ * \param[in]  interval  adaptation interval (in time steps), or 0 to
+ *                       only adapt at restart
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_set_interval(int  interval);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the time step interval at which the mesh is adapted
+ *        during the computation.
+ *
+ * \return  adaptation interval (in time steps), or 0 if only adapting
+ *          at restart
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_mesh_adapt_get_interval(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute a cell error indicator based on gradient jumps.
+ *
+ * For each cell, the indicator is the maximum over its interior faces of
+ * the jump between values reconstructed at the face center from the
+ * gradients of each adjacent cell.
+ *
+ * \param[in]   f          pointer to scalar cell field
+ * \param[out]  indicator  error indicator (size: n_cells)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_compute_indicator(const cs_field_t  *f,
+                                cs_real_t          indicator[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Flag cells for refinement or coarsening based on an indicator.
+ *
+ * \param[in]   m            pointer to mesh structure
+ * \param[in]   indicator    error indicator (size: n_cells)
+ * \param[out]  refine_flag  refinement flag (size: n_cells)
+ * \param[out]  coarsen_flag coarsening flag (size: n_cells)
+ * \param[out]  n_g_flagged  global number of cells flagged for refinement
+ *                           and coarsening
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_flag_cells(const cs_mesh_t  *m,
+                         const cs_real_t   indicator[],
+                         int               refine_flag[],
+                         int               coarsen_flag[],
+                         cs_gnum_t         n_g_flagged[2]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write the error indicator to the current checkpoint if
+ *        adaptation is active and only done at restart.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_write_indicator(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Adapt the mesh based on the error indicator read from the
+ *        restart directory, if adaptation is active.
+ *
+ * This function is called during the mesh preprocessing stage.
+ *
+ * \param[in, out]  m  pointer to mesh structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_apply(cs_mesh_t  *m);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Adapt the mesh and map associated data during the computation
+ *        if adaptation is active and the current time step matches the
+ *        adaptation interval.
+ *
+ * Cells are coarsened then refined in memory based on the current error
+ * indicator, and mesh-dependent structures (halos, renumbering, matrix
+ * structures, ...) are rebuilt. Cell values are mapped conservatively,
+ * boundary values and condition coefficients are inherited from parent
+ * faces, and the interior mass flux is recomputed. The mesh is then
+ * repartitioned if the cell imbalance is too high.
+ *
+ * \return  true if the mesh was modified, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_adapt_update(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free solution-adaptive mesh refinement settings.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_finalize(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_MESH_ADAPT_H__ */
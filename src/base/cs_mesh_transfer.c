@@ -0,0 +1,838 @@
+/*============================================================================
+ * Transfer of mesh-based arrays after a mesh redistribution
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_error.h"
+#include "bft_printf.h"
+
+#include "cs_all_to_all.h"
+#include "cs_base.h"
+#include "cs_block_dist.h"
+#include "cs_field.h"
+#include "cs_halo.h"
+#include "cs_halo_perio.h"
+#include "cs_mesh.h"
+#include "cs_mesh_location.h"
+#include "cs_parall.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_mesh_transfer.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_mesh_transfer.c
+        Transfer of mesh-based arrays after a mesh redistribution.
+
+  When the mesh is redistributed among ranks in memory (for example
+  for load balancing), the global numbering of cells, faces and vertices
+  is preserved, but their local numbering and distribution change.
+
+  The global numbers of the elements of each mesh location are saved
+  before the mesh is redistributed, and arrays defined on the previous
+  distribution are then exchanged through a block distribution based on
+  those global numbers, as when reading or writing restart files.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+struct _cs_mesh_transfer_t {
+
+  int                     n_locations;   /* Number of mesh locations */
+
+  cs_lnum_3_t            *n_elts_prev;   /* Previous numbers of elements
+                                            of each location */
+  cs_gnum_t              *n_g_elts;      /* Global number of elements of
+                                            the base type of each location */
+
+  cs_gnum_t             **gnum_prev;     /* Previous global element numbers
+                                            of each location */
+  cs_gnum_t             **gnum_cur;      /* Current global element numbers
+                                            of each location, or NULL
+                                            if not built yet */
+
+#if defined(HAVE_MPI)
+  cs_all_to_all_t       **d_prev;        /* Previous elements to blocks */
+  cs_all_to_all_t       **d_cur;         /* Current elements to blocks */
+#endif
+
+};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Indicate if values on a given mesh location may be transferred.
+ *
+ * parameters:
+ *   location_id <-- id of mesh location
+ *
+ * returns:
+ *   true if the location is based on cells, faces, or vertices
+ *----------------------------------------------------------------------------*/
+
+static bool
+_is_transferable(int  location_id)
+{
+  bool retval = false;
+
+  if (location_id > CS_MESH_LOCATION_NONE) {
+    cs_mesh_location_type_t type = cs_mesh_location_get_type(location_id);
+    if (type >= CS_MESH_LOCATION_CELLS && type <= CS_MESH_LOCATION_FACES)
+      retval = true;
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Copy global numbers of a given element type, using implicit numbering
+ * when no global numbering is defined.
+ *
+ * parameters:
+ *   n_elts  <-- number of elements
+ *   g_num   <-- global element numbers, or NULL
+ *   shift   <-- shift added to global numbers
+ *   gnum    --> copied global numbers
+ *----------------------------------------------------------------------------*/
+
+static void
+_copy_gnum(cs_lnum_t         n_elts,
+           const cs_gnum_t  *g_num,
+           cs_gnum_t         shift,
+           cs_gnum_t         gnum[])
+{
+  if (g_num != NULL) {
+    for (cs_lnum_t i = 0; i < n_elts; i++)
+      gnum[i] = g_num[i] + shift;
+  }
+  else {
+    for (cs_lnum_t i = 0; i < n_elts; i++)
+      gnum[i] = (cs_gnum_t)i + 1 + shift;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Build global numbers of the elements of a mesh location.
+ *
+ * Faces are numbered with interior faces first, then boundary faces.
+ *
+ * parameters:
+ *   m           <-- pointer to mesh structure
+ *   location_id <-- id of mesh location
+ *   n_g_elts    --> global number of elements of location's base type
+ *
+ * returns:
+ *   newly allocated global element numbers array
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t *
+_location_gnum(const cs_mesh_t  *m,
+               int               location_id,
+               cs_gnum_t        *n_g_elts)
+{
+  cs_mesh_location_type_t type = cs_mesh_location_get_type(location_id);
+
+  cs_lnum_t n_base_elts = 0;
+  cs_gnum_t *base_gnum = NULL;
+
+  switch(type) {
+  case CS_MESH_LOCATION_CELLS:
+    n_base_elts = m->n_cells;
+    BFT_MALLOC(base_gnum, n_base_elts, cs_gnum_t);
+    _copy_gnum(m->n_cells, m->global_cell_num, 0, base_gnum);
+    *n_g_elts = m->n_g_cells;
+    break;
+  case CS_MESH_LOCATION_INTERIOR_FACES:
+    n_base_elts = m->n_i_faces;
+    BFT_MALLOC(base_gnum, n_base_elts, cs_gnum_t);
+    _copy_gnum(m->n_i_faces, m->global_i_face_num, 0, base_gnum);
+    *n_g_elts = m->n_g_i_faces;
+    break;
+  case CS_MESH_LOCATION_BOUNDARY_FACES:
+    n_base_elts = m->n_b_faces;
+    BFT_MALLOC(base_gnum, n_base_elts, cs_gnum_t);
+    _copy_gnum(m->n_b_faces, m->global_b_face_num, 0, base_gnum);
+    *n_g_elts = m->n_g_b_faces;
+    break;
+  case CS_MESH_LOCATION_VERTICES:
+    n_base_elts = m->n_vertices;
+    BFT_MALLOC(base_gnum, n_base_elts, cs_gnum_t);
+    _copy_gnum(m->n_vertices, m->global_vtx_num, 0, base_gnum);
+    *n_g_elts = m->n_g_vertices;
+    break;
+  case CS_MESH_LOCATION_FACES:
+    n_base_elts = m->n_i_faces + m->n_b_faces;
+    BFT_MALLOC(base_gnum, n_base_elts, cs_gnum_t);
+    _copy_gnum(m->n_i_faces, m->global_i_face_num, 0, base_gnum);
+    _copy_gnum(m->n_b_faces, m->global_b_face_num, m->n_g_i_faces,
+               base_gnum + m->n_i_faces);
+    *n_g_elts = m->n_g_i_faces + m->n_g_b_faces;
+    break;
+  default:
+    assert(0);
+    *n_g_elts = 0;
+    return NULL;
+  }
+
+  /* Restrict to selected elements for sub-locations */
+
+  const cs_lnum_t *elt_ids = cs_mesh_location_get_elt_ids_try(location_id);
+
+  if (elt_ids == NULL)
+    return base_gnum;
+
+  const cs_lnum_t n_elts = cs_mesh_location_get_n_elts(location_id)[0];
+
+  cs_gnum_t *gnum;
+  BFT_MALLOC(gnum, n_elts, cs_gnum_t);
+
+  for (cs_lnum_t i = 0; i < n_elts; i++)
+    gnum[i] = base_gnum[elt_ids[i]];
+
+  BFT_FREE(base_gnum);
+
+  return gnum;
+}
+
+/*----------------------------------------------------------------------------
+ * Build current global numbers and distributors for a mesh location
+ * if not done yet.
+ *
+ * parameters:
+ *   mt          <-> pointer to mesh transfer structure
+ *   location_id <-- id of mesh location
+ *----------------------------------------------------------------------------*/
+
+static void
+_ensure_location(cs_mesh_transfer_t  *mt,
+                 int                  location_id)
+{
+  if (location_id >= mt->n_locations)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Mesh location %d was not defined when the mesh\n"
+                "transfer structure was created."), location_id);
+
+  if (mt->gnum_cur[location_id] != NULL)
+    return;
+
+  cs_gnum_t n_g_elts = 0;
+  mt->gnum_cur[location_id] = _location_gnum(cs_glob_mesh,
+                                             location_id,
+                                             &n_g_elts);
+
+  /* Global numbering is preserved by redistribution */
+
+  assert(n_g_elts == mt->n_g_elts[location_id]);
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    cs_block_dist_info_t bi
+      = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                    cs_glob_n_ranks,
+                                    1,
+                                    0,
+                                    mt->n_g_elts[location_id]);
+
+    mt->d_prev[location_id]
+      = cs_all_to_all_create_from_block(mt->n_elts_prev[location_id][0],
+                                        CS_ALL_TO_ALL_USE_DEST_ID,
+                                        mt->gnum_prev[location_id],
+                                        bi,
+                                        cs_glob_mpi_comm);
+
+    mt->d_cur[location_id]
+      = cs_all_to_all_create_from_block
+          (cs_mesh_location_get_n_elts(location_id)[0],
+           CS_ALL_TO_ALL_USE_DEST_ID,
+           mt->gnum_cur[location_id],
+           bi,
+           cs_glob_mpi_comm);
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------
+ * Copy values defined on a mesh location between the previous and
+ * current distributions.
+ *
+ * parameters:
+ *   mt          <-> pointer to mesh transfer structure
+ *   location_id <-- id of mesh location
+ *   datatype    <-- type of data considered
+ *   stride      <-- number of values per element (interlaced)
+ *   from_prev   <-- true for previous to current, false for current
+ *                   to previous distribution
+ *   src         <-- source values
+ *   dest        --> destination values
+ *----------------------------------------------------------------------------*/
+
+static void
+_copy_array(cs_mesh_transfer_t  *mt,
+            int                  location_id,
+            cs_datatype_t        datatype,
+            int                  stride,
+            bool                 from_prev,
+            const void          *src,
+            void                *dest)
+{
+  _ensure_location(mt, location_id);
+
+  const size_t elt_size = cs_datatype_size[datatype]*stride;
+
+  unsigned char *b_buf = NULL;
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    cs_block_dist_info_t bi
+      = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                    cs_glob_n_ranks,
+                                    1,
+                                    0,
+                                    mt->n_g_elts[location_id]);
+
+    size_t b_size = (bi.gnum_range[1] - bi.gnum_range[0]) * elt_size;
+
+    BFT_MALLOC(b_buf, b_size, unsigned char);
+    if (b_size > 0)
+      memset(b_buf, 0, b_size);
+
+    cs_all_to_all_t *d_src = mt->d_cur[location_id];
+    cs_all_to_all_t *d_dest = mt->d_prev[location_id];
+    if (from_prev) {
+      d_src = mt->d_prev[location_id];
+      d_dest = mt->d_cur[location_id];
+    }
+
+    cs_all_to_all_copy_array(d_src,
+                             datatype,
+                             stride,
+                             false,
+                             src,
+                             b_buf);
+
+    cs_all_to_all_copy_array(d_dest,
+                             datatype,
+                             stride,
+                             true, /* reverse */
+                             b_buf,
+                             dest);
+
+    BFT_FREE(b_buf);
+
+    return;
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  /* Local case: the block is the whole array */
+
+  const cs_lnum_t n_prev = mt->n_elts_prev[location_id][0];
+  const cs_lnum_t n_cur = cs_mesh_location_get_n_elts(location_id)[0];
+
+  cs_lnum_t n_src = n_cur, n_dest = n_prev;
+  const cs_gnum_t *src_gnum = mt->gnum_cur[location_id];
+  const cs_gnum_t *dest_gnum = mt->gnum_prev[location_id];
+
+  if (from_prev) {
+    n_src = n_prev;
+    n_dest = n_cur;
+    src_gnum = mt->gnum_prev[location_id];
+    dest_gnum = mt->gnum_cur[location_id];
+  }
+
+  const unsigned char *_src = src;
+  unsigned char *_dest = dest;
+
+  BFT_MALLOC(b_buf, mt->n_g_elts[location_id]*elt_size, unsigned char);
+
+  for (cs_lnum_t i = 0; i < n_src; i++)
+    memcpy(b_buf + (src_gnum[i] - 1)*elt_size, _src + i*elt_size, elt_size);
+
+  for (cs_lnum_t i = 0; i < n_dest; i++)
+    memcpy(_dest + i*elt_size, b_buf + (dest_gnum[i] - 1)*elt_size, elt_size);
+
+  BFT_FREE(b_buf);
+}
+
+/*----------------------------------------------------------------------------
+ * Transfer an array defined on a mesh location to the current distribution,
+ * reallocating it, unless it is NULL on all ranks.
+ *
+ * parameters:
+ *   mt          <-> pointer to mesh transfer structure
+ *   location_id <-- id of mesh location
+ *   datatype    <-- type of data considered
+ *   stride      <-- number of values per element (interlaced)
+ *   val         <-> pointer to array of values
+ *
+ * returns:
+ *   true if the array was transferred, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_transfer_array(cs_mesh_transfer_t  *mt,
+                int                  location_id,
+                cs_datatype_t        datatype,
+                int                  stride,
+                void               **val)
+{
+  /* Arrays of size 0 may be NULL on some ranks only */
+
+  int allocated = (*val != NULL) ? 1 : 0;
+  cs_parall_max(1, CS_INT_TYPE, &allocated);
+
+  if (allocated == 0)
+    return false;
+
+  const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(location_id);
+  const size_t elt_size = cs_datatype_size[datatype]*stride;
+
+  unsigned char *_val;
+  BFT_MALLOC(_val, n_elts[2]*elt_size, unsigned char);
+
+  _copy_array(mt, location_id, datatype, stride, true, *val, _val);
+
+  BFT_FREE(*val);
+  *val = _val;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Synchronize ghost cell values of a field.
+ *
+ * parameters:
+ *   m   <-- pointer to mesh structure
+ *   dim <-- field dimension
+ *   val <-> field values
+ *----------------------------------------------------------------------------*/
+
+static void
+_sync_cell_values(const cs_mesh_t  *m,
+                  int               dim,
+                  cs_real_t         val[])
+{
+  const cs_halo_t *halo = m->halo;
+
+  if (halo == NULL)
+    return;
+
+  if (dim == 1)
+    cs_halo_sync_var(halo, CS_HALO_EXTENDED, val);
+
+  else {
+
+    cs_halo_sync_var_strided(halo, CS_HALO_EXTENDED, val, dim);
+
+    if (m->n_init_perio > 0) {
+      switch(dim) {
+      case 9:
+        cs_halo_perio_sync_var_tens(halo, CS_HALO_EXTENDED, val);
+        break;
+      case 6:
+        cs_halo_perio_sync_var_sym_tens(halo, CS_HALO_EXTENDED, val);
+        break;
+      case 3:
+        cs_halo_perio_sync_var_vect(halo, CS_HALO_EXTENDED, val, 3);
+        break;
+      default:
+        break;
+      }
+    }
+
+  }
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a mesh transfer structure, saving the global numbering
+ *        of the elements of each mesh location before the mesh is
+ *        redistributed.
+ *
+ * The mesh may then be redistributed, as long as the global numbers of
+ * its elements are preserved. Once the mesh and its locations have been
+ * rebuilt, arrays defined on the previous distribution may be transferred
+ * to the new one.
+ *
+ * \param[in]  m  pointer to mesh structure
+ *
+ * \return  pointer to new mesh transfer structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_mesh_transfer_t *
+cs_mesh_transfer_create(const cs_mesh_t  *m)
+{
+  cs_mesh_transfer_t *mt;
+
+  BFT_MALLOC(mt, 1, cs_mesh_transfer_t);
+
+  const int n_locations = cs_mesh_location_n_locations();
+
+  mt->n_locations = n_locations;
+
+  BFT_MALLOC(mt->n_elts_prev, n_locations, cs_lnum_3_t);
+  BFT_MALLOC(mt->n_g_elts, n_locations, cs_gnum_t);
+  BFT_MALLOC(mt->gnum_prev, n_locations, cs_gnum_t *);
+  BFT_MALLOC(mt->gnum_cur, n_locations, cs_gnum_t *);
+
+#if defined(HAVE_MPI)
+  BFT_MALLOC(mt->d_prev, n_locations, cs_all_to_all_t *);
+  BFT_MALLOC(mt->d_cur, n_locations, cs_all_to_all_t *);
+#endif
+
+  for (int l_id = 0; l_id < n_locations; l_id++) {
+
+    const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(l_id);
+    for (int i = 0; i < 3; i++)
+      mt->n_elts_prev[l_id][i] = n_elts[i];
+
+    mt->n_g_elts[l_id] = 0;
+    mt->gnum_prev[l_id] = NULL;
+    mt->gnum_cur[l_id] = NULL;
+
+    if (_is_transferable(l_id))
+      mt->gnum_prev[l_id] = _location_gnum(m, l_id, mt->n_g_elts + l_id);
+
+#if defined(HAVE_MPI)
+    mt->d_prev[l_id] = NULL;
+    mt->d_cur[l_id] = NULL;
+#endif
+
+  }
+
+  return mt;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a mesh transfer structure.
+ *
+ * \param[in, out]  mt  pointer to mesh transfer structure pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_transfer_destroy(cs_mesh_transfer_t  **mt)
+{
+  if (mt == NULL)
+    return;
+
+  cs_mesh_transfer_t *_mt = *mt;
+
+  if (_mt == NULL)
+    return;
+
+  for (int l_id = 0; l_id < _mt->n_locations; l_id++) {
+    BFT_FREE(_mt->gnum_prev[l_id]);
+    BFT_FREE(_mt->gnum_cur[l_id]);
+#if defined(HAVE_MPI)
+    if (_mt->d_prev[l_id] != NULL)
+      cs_all_to_all_destroy(&(_mt->d_prev[l_id]));
+    if (_mt->d_cur[l_id] != NULL)
+      cs_all_to_all_destroy(&(_mt->d_cur[l_id]));
+#endif
+  }
+
+#if defined(HAVE_MPI)
+  BFT_FREE(_mt->d_cur);
+  BFT_FREE(_mt->d_prev);
+#endif
+
+  BFT_FREE(_mt->gnum_cur);
+  BFT_FREE(_mt->gnum_prev);
+  BFT_FREE(_mt->n_g_elts);
+  BFT_FREE(_mt->n_elts_prev);
+
+  BFT_FREE(*mt);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the previous numbers of elements of a mesh location.
+ *
+ * A pointer to a array of 3 values is returned, with the same
+ * definition as for \ref cs_mesh_location_get_n_elts.
+ *
+ * \param[in]  mt           pointer to mesh transfer structure
+ * \param[in]  location_id  id of mesh location
+ *
+ * \return  array of previous numbers of elements
+ */
+/*----------------------------------------------------------------------------*/
+
+const cs_lnum_t *
+cs_mesh_transfer_get_n_elts_prev(const cs_mesh_transfer_t  *mt,
+                                 int                        location_id)
+{
+  assert(location_id < mt->n_locations);
+
+  return mt->n_elts_prev[location_id];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Copy values defined on a mesh location from the previous to
+ *        the current mesh distribution.
+ *
+ * Only values of the main elements (excluding ghost cells) are copied.
+ *
+ * This is a collective operation, which must be called on all ranks
+ * with the same location, datatype and stride.
+ *
+ * \param[in, out]  mt           pointer to mesh transfer structure
+ * \param[in]       location_id  id of mesh location
+ * \param[in]       datatype     type of data considered
+ * \param[in]       stride       number of values per element (interlaced)
+ * \param[in]       src          values on previous distribution
+ * \param[out]      dest         values on current distribution
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_transfer_copy_array(cs_mesh_transfer_t  *mt,
+                            int                  location_id,
+                            cs_datatype_t        datatype,
+                            int                  stride,
+                            const void          *src,
+                            void                *dest)
+{
+  _copy_array(mt, location_id, datatype, stride, true, src, dest);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Transfer an array defined on a mesh location to the current
+ *        mesh distribution.
+ *
+ * The array is reallocated, with ghost cell values included and
+ * synchronized for the cells location. Arrays which are NULL on all
+ * ranks are left unchanged.
+ *
+ * \param[in, out]  mt           pointer to mesh transfer structure
+ * \param[in]       location_id  id of mesh location
+ * \param[in]       datatype     type of data considered
+ * \param[in]       stride       number of values per element (interlaced)
+ * \param[in, out]  val          pointer to array of values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_transfer_array(cs_mesh_transfer_t  *mt,
+                       int                  location_id,
+                       cs_datatype_t        datatype,
+                       int                  stride,
+                       void               **val)
+{
+  bool transferred = _transfer_array(mt, location_id, datatype, stride, val);
+
+  const cs_halo_t *halo = cs_glob_mesh->halo;
+
+  if (   transferred
+      && location_id == CS_MESH_LOCATION_CELLS
+      && halo != NULL)
+    cs_halo_sync_untyped(halo,
+                         CS_HALO_EXTENDED,
+                         cs_datatype_size[datatype]*stride,
+                         *val);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the current rank and local id of previous cells.
+ *
+ * The caller is responsible for freeing the returned arrays.
+ *
+ * \param[in, out]  mt         pointer to mesh transfer structure
+ * \param[out]      dest_rank  current rank of each previous cell
+ * \param[out]      dest_id    current local id of each previous cell
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_transfer_cell_dest(cs_mesh_transfer_t   *mt,
+                           int                 **dest_rank,
+                           cs_lnum_t           **dest_id)
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_lnum_t n_cells_prev = mt->n_elts_prev[CS_MESH_LOCATION_CELLS][0];
+  const cs_lnum_t rank_id = CS_MAX(cs_glob_rank_id, 0);
+
+  cs_lnum_t *c_dest, *c_dest_prev;
+  BFT_MALLOC(c_dest, n_cells*2, cs_lnum_t);
+  BFT_MALLOC(c_dest_prev, n_cells_prev*2, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    c_dest[i*2] = rank_id;
+    c_dest[i*2 + 1] = i;
+  }
+
+  _copy_array(mt,
+              CS_MESH_LOCATION_CELLS,
+              CS_LNUM_TYPE,
+              2,
+              false,
+              c_dest,
+              c_dest_prev);
+
+  BFT_FREE(c_dest);
+
+  BFT_MALLOC(*dest_rank, n_cells_prev, int);
+  BFT_MALLOC(*dest_id, n_cells_prev, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_cells_prev; i++) {
+    (*dest_rank)[i] = c_dest_prev[i*2];
+    (*dest_id)[i] = c_dest_prev[i*2 + 1];
+  }
+
+  BFT_FREE(c_dest_prev);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Transfer values and boundary condition coefficients of all fields
+ *        owning their values to the current mesh distribution.
+ *
+ * \param[in, out]  mt  pointer to mesh transfer structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_transfer_fields(cs_mesh_transfer_t  *mt)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  const int n_fields = cs_field_n_fields();
+  const int coupled_key_id = cs_field_key_id_try("coupled");
+
+  for (int f_id = 0; f_id < n_fields; f_id++) {
+
+    cs_field_t *f = cs_field_by_id(f_id);
+
+    if (f->is_owner == false || _is_transferable(f->location_id) == false)
+      continue;
+
+    for (int kk = 0; kk < f->n_time_vals; kk++) {
+
+      bool transferred = _transfer_array(mt,
+                                         f->location_id,
+                                         CS_REAL_TYPE,
+                                         f->dim,
+                                         (void **)(f->vals + kk));
+
+      if (transferred && f->location_id == CS_MESH_LOCATION_CELLS)
+        _sync_cell_values(m, f->dim, f->vals[kk]);
+
+    }
+
+    f->val = f->vals[0];
+    if (f->n_time_vals > 1)
+      f->val_pre = f->vals[1];
+
+    /* Boundary condition coefficients */
+
+    cs_field_bc_coeffs_t *bc_coeffs = f->bc_coeffs;
+
+    if (bc_coeffs == NULL)
+      continue;
+
+    int a_mult = f->dim, b_mult = f->dim;
+    if (f->type & CS_FIELD_VARIABLE && coupled_key_id > -1) {
+      if (cs_field_get_key_int(f, coupled_key_id))
+        b_mult *= f->dim;
+    }
+
+    const int l_id = bc_coeffs->location_id;
+
+    cs_real_t **a_coeffs[] = {&(bc_coeffs->a), &(bc_coeffs->af),
+                              &(bc_coeffs->ad), &(bc_coeffs->ac)};
+    cs_real_t **b_coeffs[] = {&(bc_coeffs->b), &(bc_coeffs->bf),
+                              &(bc_coeffs->bd), &(bc_coeffs->bc)};
+
+    for (int i = 0; i < 4; i++) {
+      _transfer_array(mt, l_id, CS_REAL_TYPE, a_mult, (void **)a_coeffs[i]);
+      _transfer_array(mt, l_id, CS_REAL_TYPE, b_mult, (void **)b_coeffs[i]);
+    }
+
+    _transfer_array(mt, l_id, CS_REAL_TYPE, 1, (void **)&(bc_coeffs->hint));
+    _transfer_array(mt, l_id, CS_REAL_TYPE, 1, (void **)&(bc_coeffs->hext));
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,189 @@
+#ifndef __CS_MESH_TRANSFER_H__
+#define __CS_MESH_TRANSFER_H__
+
+/*============================================================================
+ * Transfer of mesh-based arrays after a mesh redistribution
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+#include "cs_mesh.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Opaque mesh transfer structure */
+
+typedef struct _cs_mesh_transfer_t  cs_mesh_transfer_t;
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a mesh transfer structure, saving the global numbering
+ *        of the elements of each mesh location before the mesh is
+ *        redistributed.
+ *
+ * The mesh may then be redistributed, as long as the global numbers of
+ * its elements are preserved. Once the mesh and its locations have been
+ * rebuilt, arrays defined on the previous distribution may be transferred
+ * to the new one.
+ *
+ * \param[in]  m  pointer to mesh structure
+ *
+ * \return  pointer to new mesh transfer structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_mesh_transfer_t *
+cs_mesh_transfer_create(const cs_mesh_t  *m);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a mesh transfer structure.
+ *
+ * \param[in, out]  mt  pointer to mesh transfer structure pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_transfer_destroy(cs_mesh_transfer_t  **mt);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the previous numbers of elements of a mesh location.
+ *
+ * A pointer to a array of 3 values is returned, with the same
+ * definition as for \ref cs_mesh_location_get_n_elts.
+ *
+ * \param[in]  mt           pointer to mesh transfer structure
+ * \param[in]  location_id  id of mesh location
+ *
+ * \return  array of previous numbers of elements
+ */
+/*----------------------------------------------------------------------------*/
+
+const cs_lnum_t *
+cs_mesh_transfer_get_n_elts_prev(const cs_mesh_transfer_t  *mt,
+                                 int                        location_id);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Copy values defined on a mesh location from the previous to
+ *        the current mesh distribution.
+ *
+ * Only values of the main elements (excluding ghost cells) are copied.
+ *
+ * This is a collective operation, which must be called on all ranks
+ * with the same location, datatype and stride.
+ *
+ * \param[in, out]  mt           pointer to mesh transfer structure
+ * \param[in]       location_id  id of mesh location
+ * \param[in]       datatype     type of data considered
+ * \param[in]       stride       number of values per element (interlaced)
+ * \param[in]       src          values on previous distribution
+ * \param[out]      dest         values on current distribution
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_transfer_copy_array(cs_mesh_transfer_t  *mt,
+                            int                  location_id,
+                            cs_datatype_t        datatype,
+                            int                  stride,
+                            const void          *src,
+                            void                *dest);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Transfer an array defined on a mesh location to the current
+ *        mesh distribution.
+ *
+ * The array is reallocated, with ghost cell values included and
+ * synchronized for the cells location.
+ *
+ * \param[in, out]  mt           pointer to mesh transfer structure
+ * \param[in]       location_id  id of mesh location
+ * \param[in]       datatype     type of data considered
+ * \param[in]       stride       number of values per element (interlaced)
+ * \param[in, out]  val          pointer to array of values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_transfer_array(cs_mesh_transfer_t  *mt,
+                       int                  location_id,
+                       cs_datatype_t        datatype,
+                       int                  stride,
+                       void               **val);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the current rank and local id of previous cells.
+ *
+ * The caller is responsible for freeing the returned arrays.
+ *
+ * \param[in, out]  mt         pointer to mesh transfer structure
+ * \param[out]      dest_rank  current rank of each previous cell
+ * \param[out]      dest_id    current local id of each previous cell
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_transfer_cell_dest(cs_mesh_transfer_t   *mt,
+                           int                 **dest_rank,
+                           cs_lnum_t           **dest_id);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Transfer values and boundary condition coefficients of all fields
+ *        owning their values to the current mesh distribution.
+ *
+ * \param[in, out]  mt  pointer to mesh transfer structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_transfer_fields(cs_mesh_transfer_t  *mt);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_MESH_TRANSFER_H__ */
@@ -53,6 +53,28 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Radix sort digit size */
+
+#define _RADIX_BITS      8
+#define _RADIX_BUCKETS   256
+
+/* Minimum number of elements for which radix sort (for global numbers)
+   or merge sort (for real values) is considered instead of heapsort */
+
+#define _SORT_MIN_SIZE   4096
+
+/* Minimum number of elements per thread for threaded sorting */
+
+#define _SORT_THR_MIN    4096
+
+/* Size of blocks initially sorted by insertion in merge sort */
+
+#define _MERGE_BLOCK_SIZE  16
+
 /*============================================================================
  * Local structure definitions
  *============================================================================*/
@@ -61,6 +83,460 @@ BEGIN_C_DECLS
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Return the number of threads used for sorting a given number of elements.
+ *
+ * parameters:
+ *   n <-- number of elements to sort
+ *
+ * returns:
+ *   number of threads to use
+ *----------------------------------------------------------------------------*/
+
+static int
+_n_sort_threads(size_t  n)
+{
+  int n_threads = 1;
+
+#if defined(HAVE_OPENMP)
+  if (!omp_in_parallel()) {
+    size_t n_max = n / _SORT_THR_MIN;
+    n_threads = cs_glob_n_threads;
+    if ((size_t)n_threads > n_max)
+      n_threads = (n_max > 0) ? n_max : 1;
+  }
+#else
+  CS_UNUSED(n);
+#endif
+
+  return n_threads;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute array index bounds for a local thread.
+ *
+ * When called inside an OpenMP parallel section, this will return the
+ * start and past-the-end indexes for the array range assigned to that
+ * thread. In other cases, the start index is 0, and the past-the-end
+ * index is n.
+ *
+ * parameters:
+ *   n    <-- size of array
+ *   s_id --> start index for the current thread
+ *   e_id --> past-the-end index for the current thread
+ *   t_id --> current thread id
+ *   n_t  --> number of threads
+ *----------------------------------------------------------------------------*/
+
+static void
+_thread_range(size_t   n,
+              size_t  *s_id,
+              size_t  *e_id,
+              int     *t_id,
+              int     *n_t)
+{
+#if defined(HAVE_OPENMP)
+  *t_id = omp_get_thread_num();
+  *n_t = omp_get_num_threads();
+  size_t t_n = (n + *n_t - 1) / *n_t;
+  *s_id = CS_MIN(n, (size_t)(*t_id) * t_n);
+  *e_id = CS_MIN(n, (size_t)(*t_id + 1) * t_n);
+#else
+  *s_id = 0;
+  *e_id = n;
+  *t_id = 0;
+  *n_t = 1;
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Return the number of radix sort passes needed for keys whose differing
+ * bits are given by a mask.
+ *
+ * parameters:
+ *   mask <-- bitwise or of (key xor first key) over all keys
+ *
+ * returns:
+ *   number of passes
+ *----------------------------------------------------------------------------*/
+
+static int
+_radix_n_passes(cs_gnum_t  mask)
+{
+  int n_passes = 0;
+
+  for (size_t shift = 0; shift < sizeof(cs_gnum_t)*8; shift += _RADIX_BITS) {
+    if ((mask >> shift) & (_RADIX_BUCKETS - 1))
+      n_passes += 1;
+  }
+
+  return n_passes;
+}
+
+/*----------------------------------------------------------------------------
+ * Indicate if radix sort should be used rather than heapsort, based on the
+ * number of elements and required number of radix sort passes.
+ *
+ * Each radix sort pass is a linear operation, while heapsort has
+ * a complexity in n.log(n).
+ *
+ * parameters:
+ *   nb_ent   <-- number of entities considered
+ *   n_passes <-- number of radix sort passes
+ *
+ * returns:
+ *   true if radix sort should be used, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_radix_is_preferred(size_t  nb_ent,
+                    int     n_passes)
+{
+  int log2_n = 0;
+
+  if (nb_ent < _SORT_MIN_SIZE)
+    return false;
+
+  for (size_t n = nb_ent; n > 1; n /= 2)
+    log2_n++;
+
+  return (n_passes <= log2_n) ? true : false;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the mask of bits differing between keys.
+ *
+ * parameters:
+ *   n         <-- number of keys
+ *   keys      <-- keys array
+ *   n_threads <-- number of threads to use
+ *
+ * returns:
+ *   bitwise or of (key xor first key) over all keys
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_radix_key_mask(size_t           n,
+                const cs_gnum_t  keys[],
+                int              n_threads)
+{
+  cs_gnum_t mask = 0;
+
+  if (n > 0) {
+    const cs_gnum_t k0 = keys[0];
+#   pragma omp parallel for reduction(|:mask) if (n_threads > 1) \
+                            num_threads(n_threads)
+    for (size_t i = 0; i < n; i++)
+      mask |= (keys[i] ^ k0);
+  }
+
+  CS_NO_WARN_IF_UNUSED(n_threads);
+
+  return mask;
+}
+
+/*----------------------------------------------------------------------------
+ * Stable LSD radix sort of (key, order) pairs.
+ *
+ * Digits for which all keys are identical are skipped. After the call,
+ * keys[0] and order[0] point to the sorted arrays (which may have been
+ * swapped with keys[1] and order[1]).
+ *
+ * Each thread handles a contiguous range of elements, and the
+ * scatter positions are determined by (digit, thread) order, so the
+ * sort remains stable and results do not depend on the number of threads.
+ *
+ * parameters:
+ *   n         <-- number of elements
+ *   mask      <-- bitwise or of (key xor first key) over all keys
+ *   n_threads <-- number of threads to use
+ *   keys      <-> key arrays (input and work arrays)
+ *   order     <-> order arrays (input and work arrays)
+ *----------------------------------------------------------------------------*/
+
+static void
+_radix_sort_pairs(size_t       n,
+                  cs_gnum_t    mask,
+                  int          n_threads,
+                  cs_gnum_t   *keys[2],
+                  cs_lnum_t   *order[2])
+{
+  size_t *count = NULL;
+
+  BFT_MALLOC(count, (size_t)n_threads*_RADIX_BUCKETS, size_t);
+
+  for (size_t shift = 0; shift < sizeof(cs_gnum_t)*8; shift += _RADIX_BITS) {
+
+    if (((mask >> shift) & (_RADIX_BUCKETS - 1)) == 0)
+      continue;
+
+    const cs_gnum_t *k_in = keys[0];
+    const cs_lnum_t *o_in = order[0];
+    cs_gnum_t *k_out = keys[1];
+    cs_lnum_t *o_out = order[1];
+
+#   pragma omp parallel if (n_threads > 1) num_threads(n_threads)
+    {
+      size_t s_id, e_id;
+      int t_id, n_t;
+
+      _thread_range(n, &s_id, &e_id, &t_id, &n_t);
+
+      size_t *_count = count + (size_t)t_id*_RADIX_BUCKETS;
+
+      for (int d = 0; d < _RADIX_BUCKETS; d++)
+        _count[d] = 0;
+
+      for (size_t i = s_id; i < e_id; i++)
+        _count[(k_in[i] >> shift) & (_RADIX_BUCKETS - 1)] += 1;
+
+#     pragma omp barrier
+#     pragma omp single
+      {
+        size_t pos = 0;
+        for (int d = 0; d < _RADIX_BUCKETS; d++) {
+          for (int t = 0; t < n_t; t++) {
+            size_t c = count[t*_RADIX_BUCKETS + d];
+            count[t*_RADIX_BUCKETS + d] = pos;
+            pos += c;
+          }
+        }
+      }
+
+      for (size_t i = s_id; i < e_id; i++) {
+        size_t j = _count[(k_in[i] >> shift) & (_RADIX_BUCKETS - 1)]++;
+        k_out[j] = k_in[i];
+        o_out[j] = o_in[i];
+      }
+    }
+
+    keys[1] = keys[0];
+    keys[0] = k_out;
+    order[1] = order[0];
+    order[0] = o_out;
+
+  }
+
+  BFT_FREE(count);
+}
+
+/*----------------------------------------------------------------------------
+ * Order a strided array of global numbers using radix sort, if this
+ * is expected to be faster than heapsort.
+ *
+ * Words are handled from last to first, each word being itself sorted
+ * by digit, which leads to a lexicographical ordering.
+ *
+ * parameters:
+ *   number   <-- array of entity numbers
+ *   stride   <-- stride of array (number of values to compare)
+ *   order    --> pre-allocated ordering table
+ *   nb_ent   <-- number of entities considered
+ *
+ * returns:
+ *   true if ordering was done, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_order_gnum_radix_s(const cs_gnum_t   number[],
+                    size_t            stride,
+                    cs_lnum_t         order[],
+                    const size_t      nb_ent)
+{
+  if (nb_ent < _SORT_MIN_SIZE)
+    return false;
+
+  int n_threads = _n_sort_threads(nb_ent);
+  int n_passes = 0;
+
+  cs_gnum_t *mask = NULL;
+  BFT_MALLOC(mask, stride, cs_gnum_t);
+
+  for (size_t w = 0; w < stride; w++) {
+    cs_gnum_t _mask = 0;
+    const cs_gnum_t k0 = number[w];
+#   pragma omp parallel for reduction(|:_mask) if (n_threads > 1) \
+                            num_threads(n_threads)
+    for (size_t i = 0; i < nb_ent; i++)
+      _mask |= (number[i*stride + w] ^ k0);
+    mask[w] = _mask;
+    n_passes += _radix_n_passes(mask[w]);
+  }
+
+  if (!_radix_is_preferred(nb_ent, n_passes)) {
+    BFT_FREE(mask);
+    return false;
+  }
+
+  cs_gnum_t *_keys = NULL;
+  cs_lnum_t *_order = NULL;
+  BFT_MALLOC(_keys, nb_ent*2, cs_gnum_t);
+  BFT_MALLOC(_order, nb_ent, cs_lnum_t);
+
+  cs_gnum_t *keys[2] = {_keys, _keys + nb_ent};
+  cs_lnum_t *o[2] = {order, _order};
+
+# pragma omp parallel for if (n_threads > 1) num_threads(n_threads)
+  for (size_t i = 0; i < nb_ent; i++)
+    order[i] = i;
+
+  for (size_t w = stride; w > 0; w--) {
+
+    if (mask[w-1] == 0)
+      continue;
+
+    const cs_lnum_t *_o = o[0];
+    cs_gnum_t *_k = keys[0];
+
+#   pragma omp parallel for if (n_threads > 1) num_threads(n_threads)
+    for (size_t i = 0; i < nb_ent; i++)
+      _k[i] = number[(size_t)(_o[i])*stride + w-1];
+
+    _radix_sort_pairs(nb_ent, mask[w-1], n_threads, keys, o);
+
+  }
+
+  if (o[0] != order)
+    memcpy(order, o[0], nb_ent*sizeof(cs_lnum_t));
+
+  BFT_FREE(_order);
+  BFT_FREE(_keys);
+  BFT_FREE(mask);
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Order an indexed array of global numbers using radix sort, if this
+ * is expected to be faster than heapsort.
+ *
+ * Entities with fewer values are handled as if padded with values
+ * lower than any actual value, so that an entity whose values are a
+ * prefix of those of another entity is ordered first.
+ *
+ * parameters:
+ *   number   <-- array of entity numbers
+ *   index    <-- number of values to compare for each entity
+ *   order    --> pre-allocated ordering table
+ *   nb_ent   <-- number of entities considered
+ *
+ * returns:
+ *   true if ordering was done, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_order_gnum_radix_i(const cs_gnum_t   number[],
+                    const cs_lnum_t   index[],
+                    cs_lnum_t         order[],
+                    const size_t      nb_ent)
+{
+  if (nb_ent < _SORT_MIN_SIZE)
+    return false;
+
+  int n_threads = _n_sort_threads(nb_ent);
+  int n_passes = 0;
+  cs_lnum_t max_len = 0;
+
+  for (size_t i = 0; i < nb_ent; i++) {
+    cs_lnum_t l = index[i+1] - index[i];
+    if (l > max_len)
+      max_len = l;
+  }
+
+  /* Avoid analyzing values when many passes would probably be needed */
+
+  if (!_radix_is_preferred(nb_ent, max_len))
+    return false;
+
+  cs_gnum_t *_keys = NULL;
+  cs_gnum_t *shift = NULL, *mask = NULL;
+  BFT_MALLOC(_keys, nb_ent*2, cs_gnum_t);
+  BFT_MALLOC(shift, max_len*2, cs_gnum_t);
+  mask = shift + max_len;
+
+  /* Values at a given position are shifted so that the lowest
+     value is 1, 0 being used for entities with fewer values */
+
+  for (cs_lnum_t w = 0; w < max_len && n_passes > -1; w++) {
+
+    cs_gnum_t v_min = 0, v_max = 0;
+    bool initialized = false;
+
+    for (size_t i = 0; i < nb_ent; i++) {
+      if (index[i] + w < index[i+1]) {
+        cs_gnum_t v = number[index[i] + w];
+        if (!initialized) {
+          v_min = v;
+          v_max = v;
+          initialized = true;
+        }
+        else if (v < v_min)
+          v_min = v;
+        else if (v > v_max)
+          v_max = v;
+      }
+    }
+
+    if (v_max - v_min + 1 == 0) /* Shifted values would overflow */
+      n_passes = -1;
+
+    else {
+      shift[w] = v_min - 1;
+      for (size_t i = 0; i < nb_ent; i++)
+        _keys[i] = (index[i] + w < index[i+1]) ?
+          number[index[i] + w] - shift[w] : 0;
+      mask[w] = _radix_key_mask(nb_ent, _keys, n_threads);
+      n_passes += _radix_n_passes(mask[w]);
+    }
+
+  }
+
+  if (n_passes < 0 || !_radix_is_preferred(nb_ent, n_passes)) {
+    BFT_FREE(shift);
+    BFT_FREE(_keys);
+    return false;
+  }
+
+  cs_lnum_t *_order = NULL;
+  BFT_MALLOC(_order, nb_ent, cs_lnum_t);
+
+  cs_gnum_t *keys[2] = {_keys, _keys + nb_ent};
+  cs_lnum_t *o[2] = {order, _order};
+
+# pragma omp parallel for if (n_threads > 1) num_threads(n_threads)
+  for (size_t i = 0; i < nb_ent; i++)
+    order[i] = i;
+
+  for (cs_lnum_t w = max_len; w > 0; w--) {
+
+    if (mask[w-1] == 0)
+      continue;
+
+    const cs_lnum_t *_o = o[0];
+    cs_gnum_t *_k = keys[0];
+    const cs_gnum_t _shift = shift[w-1];
+
+#   pragma omp parallel for if (n_threads > 1) num_threads(n_threads)
+    for (size_t i = 0; i < nb_ent; i++) {
+      cs_lnum_t e_id = _o[i];
+      _k[i] = (index[e_id] + w-1 < index[e_id+1]) ?
+        number[index[e_id] + w-1] - _shift : 0;
+    }
+
+    _radix_sort_pairs(nb_ent, mask[w-1], n_threads, keys, o);
+
+  }
+
+  if (o[0] != order)
+    memcpy(order, o[0], nb_ent*sizeof(cs_lnum_t));
+
+  BFT_FREE(_order);
+  BFT_FREE(shift);
+  BFT_FREE(_keys);
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------
  * Descend binary tree for the ordering of a cs_gnum_t (integer) array.
  *
@@ -110,7 +586,7 @@ _order_gnum_descend_tree(const cs_gnum_t   number[],
 }
 
 /*----------------------------------------------------------------------------
- * Order an array of global numbers.
+ * Order an array of global numbers using heapsort.
  *
  * parameters:
  *   number   <-- array of entity numbers (if NULL, a default 1 to n
@@ -120,9 +596,9 @@ _order_gnum_descend_tree(const cs_gnum_t   number[],
  *----------------------------------------------------------------------------*/
 
 static void
-_order_gnum(const cs_gnum_t   number[],
-            cs_lnum_t         order[],
-            const size_t      nb_ent)
+_order_gnum_heap(const cs_gnum_t   number[],
+                 cs_lnum_t         order[],
+                 const size_t      nb_ent)
 {
   size_t i;
   cs_lnum_t o_save;
@@ -153,6 +629,28 @@ _order_gnum(const cs_gnum_t   number[],
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Order an array of global numbers.
+ *
+ * Radix sort is used for large arrays when it is expected to be faster,
+ * heapsort otherwise.
+ *
+ * parameters:
+ *   number   <-- array of entity numbers (if NULL, a default 1 to n
+ *                numbering is considered)
+ *   order    <-- pre-allocated ordering table
+ *   nb_ent   <-- number of entities considered
+ *----------------------------------------------------------------------------*/
+
+static void
+_order_gnum(const cs_gnum_t   number[],
+            cs_lnum_t         order[],
+            const size_t      nb_ent)
+{
+  if (!_order_gnum_radix_s(number, 1, order, nb_ent))
+    _order_gnum_heap(number, order, nb_ent);
+}
+
 /*----------------------------------------------------------------------------
  * Descend binary tree for the lexicographical ordering of a strided
  * cs_gnum_t array.
@@ -220,7 +718,7 @@ _order_gnum_descend_tree_s(const cs_gnum_t   number[],
 }
 
 /*----------------------------------------------------------------------------
- * Order a strided array of global numbers lexicographically.
+ * Order a strided array of global numbers lexicographically using heapsort.
  *
  * parameters:
  *   number   <-- array of entity numbers (if NULL, a default 1 to n
@@ -231,10 +729,10 @@ _order_gnum_descend_tree_s(const cs_gnum_t   number[],
  *----------------------------------------------------------------------------*/
 
 static void
-_order_gnum_s(const cs_gnum_t   number[],
-              size_t            stride,
-              cs_lnum_t         order[],
-              const size_t      nb_ent)
+_order_gnum_s_heap(const cs_gnum_t   number[],
+                   size_t            stride,
+                   cs_lnum_t         order[],
+                   const size_t      nb_ent)
 {
   size_t i;
   cs_lnum_t o_save;
@@ -265,6 +763,30 @@ _order_gnum_s(const cs_gnum_t   number[],
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Order a strided array of global numbers lexicographically.
+ *
+ * Radix sort is used for large arrays when it is expected to be faster,
+ * heapsort otherwise.
+ *
+ * parameters:
+ *   number   <-- array of entity numbers (if NULL, a default 1 to n
+ *                numbering is considered)
+ *   stride   <-- stride of array (number of values to compare)
+ *   order    --> pre-allocated ordering table
+ *   nb_ent   <-- number of entities considered
+ *----------------------------------------------------------------------------*/
+
+static void
+_order_gnum_s(const cs_gnum_t   number[],
+              size_t            stride,
+              cs_lnum_t         order[],
+              const size_t      nb_ent)
+{
+  if (!_order_gnum_radix_s(number, stride, order, nb_ent))
+    _order_gnum_s_heap(number, stride, order, nb_ent);
+}
+
 /*----------------------------------------------------------------------------
  * Indicate if element i1 from an indexed list is lexicographically
  * greater than or equal to element i2.
@@ -425,7 +947,7 @@ _order_gnum_descend_tree_i(const cs_gnum_t   number[],
 }
 
 /*----------------------------------------------------------------------------
- * Order an indexed array of global numbers lexicographically.
+ * Order an indexed array of global numbers lexicographically using heapsort.
  *
  * parameters:
  *   number   <-- array of entity numbers (if NULL, a default 1 to n
@@ -436,10 +958,10 @@ _order_gnum_descend_tree_i(const cs_gnum_t   number[],
  *----------------------------------------------------------------------------*/
 
 static void
-_order_gnum_i(const cs_gnum_t   number[],
-              const cs_lnum_t   index[],
-              cs_lnum_t         order[],
-              const size_t      nb_ent)
+_order_gnum_i_heap(const cs_gnum_t   number[],
+                   const cs_lnum_t   index[],
+                   cs_lnum_t         order[],
+                   const size_t      nb_ent)
 {
   size_t i;
   cs_lnum_t o_save;
@@ -472,6 +994,30 @@ _order_gnum_i(const cs_gnum_t   number[],
 
 }
 
+/*----------------------------------------------------------------------------
+ * Order an indexed array of global numbers lexicographically.
+ *
+ * Radix sort is used for large arrays when it is expected to be faster,
+ * heapsort otherwise.
+ *
+ * parameters:
+ *   number   <-- array of entity numbers (if NULL, a default 1 to n
+ *                numbering is considered)
+ *   index    <-- number of values to compare for each entity
+ *   order    --> pre-allocated ordering table
+ *   nb_ent   <-- number of entities considered
+ *----------------------------------------------------------------------------*/
+
+static void
+_order_gnum_i(const cs_gnum_t   number[],
+              const cs_lnum_t   index[],
+              cs_lnum_t         order[],
+              const size_t      nb_ent)
+{
+  if (!_order_gnum_radix_i(number, index, order, nb_ent))
+    _order_gnum_i_heap(number, index, order, nb_ent);
+}
+
 /*----------------------------------------------------------------------------
  * Descend binary tree for the ordering of a cs_lnum_t (integer) array.
  *
@@ -724,7 +1270,11 @@ _order_real_descend_tree(const cs_real_t   value[],
 }
 
 /*----------------------------------------------------------------------------
- * Order an array of local values.
+ * Order an array of local values using a stable merge sort.
+ *
+ * Small blocks are first sorted by insertion, then pairs of sorted runs
+ * of increasing size are merged, different pairs being merged by
+ * different threads.
  *
  * parameters:
  *   value   <-- array of entity values
@@ -733,9 +1283,95 @@ _order_real_descend_tree(const cs_real_t   value[],
  *----------------------------------------------------------------------------*/
 
 static void
-_order_real(const cs_real_t   value[],
-            cs_lnum_t         order[],
-            const size_t      nb_ent)
+_order_real_merge(const cs_real_t   value[],
+                  cs_lnum_t         order[],
+                  const size_t      nb_ent)
+{
+  const int n_threads = _n_sort_threads(nb_ent);
+  const size_t n_blocks = (nb_ent + _MERGE_BLOCK_SIZE - 1) / _MERGE_BLOCK_SIZE;
+
+  /* Insertion sort of small blocks */
+
+# pragma omp parallel for if (n_threads > 1) num_threads(n_threads)
+  for (size_t b_id = 0; b_id < n_blocks; b_id++) {
+
+    size_t s_id = b_id*_MERGE_BLOCK_SIZE;
+    size_t e_id = CS_MIN(s_id + _MERGE_BLOCK_SIZE, nb_ent);
+
+    for (size_t i = s_id; i < e_id; i++)
+      order[i] = i;
+
+    for (size_t i = s_id + 1; i < e_id; i++) {
+      cs_lnum_t o_save = order[i];
+      size_t j = i;
+      while (j > s_id && value[order[j-1]] > value[o_save]) {
+        order[j] = order[j-1];
+        j--;
+      }
+      order[j] = o_save;
+    }
+
+  }
+
+  /* Merge sorted runs */
+
+  cs_lnum_t *_order = NULL;
+  BFT_MALLOC(_order, nb_ent, cs_lnum_t);
+
+  cs_lnum_t *o_src = order, *o_dst = _order;
+
+  for (size_t w = _MERGE_BLOCK_SIZE; w < nb_ent; w *= 2) {
+
+    const size_t n_pairs = (nb_ent + 2*w - 1) / (2*w);
+
+#   pragma omp parallel for if (n_threads > 1) num_threads(n_threads)
+    for (size_t p_id = 0; p_id < n_pairs; p_id++) {
+
+      size_t s_id = p_id*2*w;
+      size_t m_id = CS_MIN(s_id + w, nb_ent);
+      size_t e_id = CS_MIN(s_id + 2*w, nb_ent);
+      size_t i = s_id, j = m_id, k = s_id;
+
+      while (i < m_id && j < e_id) {
+        if (value[o_src[j]] < value[o_src[i]])
+          o_dst[k++] = o_src[j++];
+        else
+          o_dst[k++] = o_src[i++];
+      }
+      while (i < m_id)
+        o_dst[k++] = o_src[i++];
+      while (j < e_id)
+        o_dst[k++] = o_src[j++];
+
+    }
+
+    cs_lnum_t *o_tmp = o_src;
+    o_src = o_dst;
+    o_dst = o_tmp;
+
+  }
+
+  if (o_src != order)
+    memcpy(order, o_src, nb_ent*sizeof(cs_lnum_t));
+
+  BFT_FREE(_order);
+
+  CS_NO_WARN_IF_UNUSED(n_threads);
+}
+
+/*----------------------------------------------------------------------------
+ * Order an array of local values using heapsort.
+ *
+ * parameters:
+ *   value   <-- array of entity values
+ *   order   <-- pre-allocated ordering table
+ *   nb_ent  <-- number of entities considered
+ *----------------------------------------------------------------------------*/
+
+static void
+_order_real_heap(const cs_real_t   value[],
+                 cs_lnum_t         order[],
+                 const size_t      nb_ent)
 {
   size_t i;
   cs_lnum_t o_save;
@@ -766,6 +1402,135 @@ _order_real(const cs_real_t   value[],
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Order an array of local values.
+ *
+ * Merge sort is used for large arrays, heapsort otherwise.
+ *
+ * parameters:
+ *   value   <-- array of entity values
+ *   order   <-- pre-allocated ordering table
+ *   nb_ent  <-- number of entities considered
+ *----------------------------------------------------------------------------*/
+
+static void
+_order_real(const cs_real_t   value[],
+            cs_lnum_t         order[],
+            const size_t      nb_ent)
+{
+  if (nb_ent >= _SORT_MIN_SIZE)
+    _order_real_merge(value, order, nb_ent);
+  else
+    _order_real_heap(value, order, nb_ent);
+}
+
+#if defined(_CS_UNIT_ORDER_TEST) /* access to algorithms for unit tests */
+
+bool
+cs_order_unit_test_gnum_s(const cs_gnum_t   number[],
+                          size_t            stride,
+                          cs_lnum_t         order[],
+                          size_t            nb_ent,
+                          bool              heapsort);
+
+bool
+cs_order_unit_test_gnum_i(const cs_gnum_t   number[],
+                          const cs_lnum_t   index[],
+                          cs_lnum_t         order[],
+                          size_t            nb_ent,
+                          bool              heapsort);
+
+void
+cs_order_unit_test_real(const cs_real_t   value[],
+                        cs_lnum_t         order[],
+                        size_t            nb_ent,
+                        bool              heapsort);
+
+/*----------------------------------------------------------------------------
+ * Order a strided array of global numbers with a given algorithm.
+ *
+ * parameters:
+ *   number   <-- array of entity numbers
+ *   stride   <-- stride of array (number of values to compare)
+ *   order    --> pre-allocated ordering table
+ *   nb_ent   <-- number of entities considered
+ *   heapsort <-- use heapsort if true, radix sort otherwise
+ *
+ * returns:
+ *   true if ordering was done, false if radix sort was not used
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_order_unit_test_gnum_s(const cs_gnum_t   number[],
+                          size_t            stride,
+                          cs_lnum_t         order[],
+                          size_t            nb_ent,
+                          bool              heapsort)
+{
+  if (heapsort == false)
+    return _order_gnum_radix_s(number, stride, order, nb_ent);
+
+  if (stride == 1)
+    _order_gnum_heap(number, order, nb_ent);
+  else
+    _order_gnum_s_heap(number, stride, order, nb_ent);
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Order an indexed array of global numbers with a given algorithm.
+ *
+ * parameters:
+ *   number   <-- array of entity numbers
+ *   index    <-- number of values to compare for each entity
+ *   order    --> pre-allocated ordering table
+ *   nb_ent   <-- number of entities considered
+ *   heapsort <-- use heapsort if true, radix sort otherwise
+ *
+ * returns:
+ *   true if ordering was done, false if radix sort was not used
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_order_unit_test_gnum_i(const cs_gnum_t   number[],
+                          const cs_lnum_t   index[],
+                          cs_lnum_t         order[],
+                          size_t            nb_ent,
+                          bool              heapsort)
+{
+  if (heapsort == false)
+    return _order_gnum_radix_i(number, index, order, nb_ent);
+
+  _order_gnum_i_heap(number, index, order, nb_ent);
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Order an array of local values with a given algorithm.
+ *
+ * parameters:
+ *   value    <-- array of entity values
+ *   order    --> pre-allocated ordering table
+ *   nb_ent   <-- number of entities considered
+ *   heapsort <-- use heapsort if true, merge sort otherwise
+ *----------------------------------------------------------------------------*/
+
+void
+cs_order_unit_test_real(const cs_real_t   value[],
+                        cs_lnum_t         order[],
+                        size_t            nb_ent,
+                        bool              heapsort)
+{
+  if (heapsort)
+    _order_real_heap(value, order, nb_ent);
+  else
+    _order_real_merge(value, order, nb_ent);
+}
+
+#endif /* defined(_CS_UNIT_ORDER_TEST) */
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
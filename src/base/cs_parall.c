@@ -141,6 +141,42 @@ typedef struct
   int     rank;
 } _mpi_double_int_t;
 
+/* Header of each entry in a packed deferred reduction buffer
+   (size is a multiple of 8 bytes, to ensure alignment of values) */
+
+typedef struct
+{
+  int     op;        /* associated cs_parall_reduce_op_t */
+  int     datatype;  /* associated cs_datatype_t */
+  int     n;         /* number of values */
+  int     pad;       /* padding */
+} _reduce_header_t;
+
+/* Deferred reduction structure */
+
+struct _cs_parall_reduce_t {
+
+  int                n_entries;      /* Number of registered arrays */
+  int                n_entries_max;  /* Maximum number of registered arrays
+                                        before reallocation */
+
+  _reduce_header_t  *entries;        /* Description of registered arrays */
+  void             **val;            /* Pointers to registered arrays */
+
+  size_t             size;           /* Size of packed buffer */
+  unsigned char     *buffer;         /* Packed send and receive buffers
+                                        (size: 2*size) */
+
+  bool               active;         /* true if reduction is in progress */
+
+#if defined(HAVE_MPI)
+  MPI_Datatype       mpi_type;       /* Contiguous type for packed buffer */
+  MPI_Op             mpi_op;         /* Packed buffer reduction operation */
+  MPI_Request        request;        /* Associated request */
+#endif
+
+};
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -264,6 +300,168 @@ _cs_parall_allreduce(int             n,
 
 #endif
 
+/*----------------------------------------------------------------------------
+ * Return the size of values associated with a deferred reduction entry
+ * in a packed buffer.
+ *
+ * For location operations, the rank is appended to the values.
+ *
+ * parameters:
+ *   h <-- pointer to entry header
+ *
+ * returns:
+ *   size of packed values, rounded up to a multiple of 8 bytes
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_reduce_entry_size(const _reduce_header_t  *h)
+{
+  size_t size = (size_t)(h->n) * cs_datatype_size[h->datatype];
+
+  if (   h->op == CS_PARALL_REDUCE_MIN_LOC
+      || h->op == CS_PARALL_REDUCE_MAX_LOC)
+    size += sizeof(double);
+
+  return (size + 7) / 8 * 8;
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Apply a sum, min, or max operation to values of a given type.
+ *----------------------------------------------------------------------------*/
+
+#define _REDUCE_VALUES(_type) {                                \
+    const _type *a = (const _type *)in;                        \
+    _type *b = (_type *)inout;                                 \
+    switch(h->op) {                                            \
+    case CS_PARALL_REDUCE_SUM:                                 \
+      for (int i = 0; i < h->n; i++)                           \
+        b[i] += a[i];                                          \
+      break;                                                   \
+    case CS_PARALL_REDUCE_MIN:                                 \
+      for (int i = 0; i < h->n; i++)                           \
+        if (a[i] < b[i]) b[i] = a[i];                          \
+      break;                                                   \
+    case CS_PARALL_REDUCE_MAX:                                 \
+      for (int i = 0; i < h->n; i++)                           \
+        if (a[i] > b[i]) b[i] = a[i];                          \
+      break;                                                   \
+    default:                                                   \
+      break;                                                   \
+    }                                                          \
+  }
+
+/*----------------------------------------------------------------------------
+ * Reduce values associated with a deferred reduction entry.
+ *
+ * parameters:
+ *   h     <-- pointer to entry header
+ *   in    <-- input values
+ *   inout <-> input and output values
+ *----------------------------------------------------------------------------*/
+
+static void
+_reduce_entry(const _reduce_header_t  *h,
+              const unsigned char     *in,
+              unsigned char           *inout)
+{
+  if (   h->op == CS_PARALL_REDUCE_MIN_LOC
+      || h->op == CS_PARALL_REDUCE_MAX_LOC) {
+
+    /* Values are followed by the associated rank; in case of ties,
+       the lowest rank is used, so the operation is commutative */
+
+    const double *a = (const double *)in;
+    double *b = (double *)inout;
+    const int n = h->n;
+    bool replace = false;
+
+    if (h->op == CS_PARALL_REDUCE_MIN_LOC)
+      replace = (a[0] < b[0] || (a[0] <= b[0] && a[n] < b[n]));
+    else
+      replace = (a[0] > b[0] || (a[0] >= b[0] && a[n] < b[n]));
+
+    if (replace) {
+      for (int i = 0; i < n + 1; i++)
+        b[i] = a[i];
+    }
+
+    return;
+  }
+
+  switch(h->datatype) {
+  case CS_FLOAT:
+    _REDUCE_VALUES(float);
+    break;
+  case CS_DOUBLE:
+    _REDUCE_VALUES(double);
+    break;
+  case CS_UINT16:
+    _REDUCE_VALUES(uint16_t);
+    break;
+  case CS_INT32:
+    _REDUCE_VALUES(int32_t);
+    break;
+  case CS_INT64:
+    _REDUCE_VALUES(int64_t);
+    break;
+  case CS_UINT32:
+    _REDUCE_VALUES(uint32_t);
+    break;
+  case CS_UINT64:
+    _REDUCE_VALUES(uint64_t);
+    break;
+  default:
+    break;
+  }
+}
+
+#undef _REDUCE_VALUES
+
+/*----------------------------------------------------------------------------
+ * MPI user function for reduction of packed deferred reduction buffers.
+ *
+ * Each buffer starts with its total size, followed by entries, each
+ * made of a header and associated values, so the buffer is
+ * self-describing.
+ *
+ * parameters:
+ *   invec    <-- input buffers
+ *   inoutvec <-> input and output buffers
+ *   len      <-- number of buffers
+ *   dtype    <-- associated MPI datatype (unused)
+ *----------------------------------------------------------------------------*/
+
+static void
+_reduce_packed(void          *invec,
+               void          *inoutvec,
+               int           *len,
+               MPI_Datatype  *dtype)
+{
+  CS_UNUSED(dtype);
+
+  const size_t size = *((const size_t *)invec);
+
+  for (int j = 0; j < *len; j++) {
+
+    const unsigned char *in = (const unsigned char *)invec + j*size;
+    unsigned char *inout = (unsigned char *)inoutvec + j*size;
+
+    size_t pos = 2*sizeof(size_t);
+
+    while (pos < size) {
+      const _reduce_header_t *h = (const _reduce_header_t *)(in + pos);
+      pos += sizeof(_reduce_header_t);
+      _reduce_entry(h, in + pos, inout + pos);
+      pos += _reduce_entry_size(h);
+    }
+
+  }
+}
+
+#endif /* defined(HAVE_MPI) */
+
 /*============================================================================
  * Fortran wrapper function definitions
  *============================================================================*/
@@ -884,6 +1082,285 @@ cs_parall_allgather_r(int        n_elts,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a deferred reduction structure.
+ *
+ * Such a structure allows grouping reductions of multiple arrays of
+ * different types and operations in a single (possibly non-blocking)
+ * collective operation on all default communicator processes, so as to
+ * reduce latency costs.
+ *
+ * A typical use is:
+ * \code{.c}
+ *   cs_parall_reduce_t *r = cs_parall_reduce_create();
+ *   cs_parall_reduce_add(r, CS_PARALL_REDUCE_MIN, CS_DOUBLE, n, vmin);
+ *   cs_parall_reduce_add(r, CS_PARALL_REDUCE_SUM, CS_GNUM_TYPE, 1, &count);
+ *   cs_parall_reduce_start(r);
+ *   // work not requiring vmin or count
+ *   cs_parall_reduce_wait(r);
+ *   cs_parall_reduce_destroy(&r);
+ * \endcode
+ *
+ * \return  pointer to new deferred reduction structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_parall_reduce_t *
+cs_parall_reduce_create(void)
+{
+  cs_parall_reduce_t *r = NULL;
+
+  BFT_MALLOC(r, 1, cs_parall_reduce_t);
+
+  r->n_entries = 0;
+  r->n_entries_max = 0;
+  r->entries = NULL;
+  r->val = NULL;
+
+  r->size = 0;
+  r->buffer = NULL;
+
+  r->active = false;
+
+#if defined(HAVE_MPI)
+  r->mpi_type = MPI_DATATYPE_NULL;
+  r->mpi_op = MPI_OP_NULL;
+  r->request = MPI_REQUEST_NULL;
+#endif
+
+  return r;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a deferred reduction structure.
+ *
+ * If a reduction is in progress, it is completed first.
+ *
+ * \param[in, out]  r  pointer to deferred reduction structure pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_reduce_destroy(cs_parall_reduce_t  **r)
+{
+  if (r == NULL)
+    return;
+
+  cs_parall_reduce_t *_r = *r;
+
+  if (_r != NULL) {
+
+    if (_r->active)
+      cs_parall_reduce_wait(_r);
+
+    BFT_FREE(_r->buffer);
+    BFT_FREE(_r->val);
+    BFT_FREE(_r->entries);
+
+    BFT_FREE(*r);
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Register an array of values for a deferred reduction.
+ *
+ * Local values are read when \ref cs_parall_reduce_start is called, and
+ * replaced by global values when \ref cs_parall_reduce_wait is called,
+ * so the array must remain available until then.
+ *
+ * For \ref CS_PARALL_REDUCE_MIN_LOC and \ref CS_PARALL_REDUCE_MAX_LOC
+ * operations, the datatype must be CS_DOUBLE; the first value is compared,
+ * and the following values are those of the rank having the global
+ * minimum or maximum (the lowest such rank in case of ties).
+ *
+ * \param[in, out]  r         pointer to deferred reduction structure
+ * \param[in]       op        reduction operation
+ * \param[in]       datatype  matching Code_Saturne datatype
+ * \param[in]       n         number of values
+ * \param[in, out]  val       local values in, global values out (size: n)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_reduce_add(cs_parall_reduce_t     *r,
+                     cs_parall_reduce_op_t   op,
+                     cs_datatype_t           datatype,
+                     int                     n,
+                     void                   *val)
+{
+  if (r->active)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: values may not be added to a reduction in progress."),
+              __func__);
+
+  if (   datatype == CS_DATATYPE_NULL || datatype == CS_CHAR
+      || (   (   op == CS_PARALL_REDUCE_MIN_LOC
+              || op == CS_PARALL_REDUCE_MAX_LOC)
+          && (datatype != CS_DOUBLE || n < 1)))
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: datatype %s not handled for operation %d."),
+              __func__, cs_datatype_name[datatype], (int)op);
+
+  if (n < 1)
+    return;
+
+  if (r->n_entries >= r->n_entries_max) {
+    r->n_entries_max = CS_MAX(8, r->n_entries_max*2);
+    BFT_REALLOC(r->entries, r->n_entries_max, _reduce_header_t);
+    BFT_REALLOC(r->val, r->n_entries_max, void *);
+  }
+
+  _reduce_header_t *h = r->entries + r->n_entries;
+
+  h->op = op;
+  h->datatype = datatype;
+  h->n = n;
+  h->pad = 0;
+
+  r->val[r->n_entries] = val;
+
+  r->n_entries += 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start a deferred reduction of all registered values.
+ *
+ * All registered values are packed in a single buffer, reduced using
+ * a single (non-blocking if available) MPI_Allreduce operation.
+ *
+ * \param[in, out]  r  pointer to deferred reduction structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_reduce_start(cs_parall_reduce_t  *r)
+{
+  if (r->active)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: reduction already in progress."),
+              __func__);
+
+  r->active = true;
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks < 2 || r->n_entries < 1)
+    return;
+
+  /* Compute packed buffer size and pack values */
+
+  size_t size = 2*sizeof(size_t);
+
+  for (int e_id = 0; e_id < r->n_entries; e_id++)
+    size += sizeof(_reduce_header_t) + _reduce_entry_size(r->entries + e_id);
+
+  if (size > r->size) {
+    r->size = size;
+    BFT_REALLOC(r->buffer, r->size*2, unsigned char);
+  }
+
+  unsigned char *send_buf = r->buffer;
+  unsigned char *recv_buf = r->buffer + size;
+
+  memset(send_buf, 0, size);
+  memcpy(send_buf, &size, sizeof(size_t));
+
+  size_t pos = 2*sizeof(size_t);
+
+  for (int e_id = 0; e_id < r->n_entries; e_id++) {
+
+    const _reduce_header_t *h = r->entries + e_id;
+    size_t val_size = (size_t)(h->n) * cs_datatype_size[h->datatype];
+
+    memcpy(send_buf + pos, h, sizeof(_reduce_header_t));
+    pos += sizeof(_reduce_header_t);
+
+    memcpy(send_buf + pos, r->val[e_id], val_size);
+
+    if (   h->op == CS_PARALL_REDUCE_MIN_LOC
+        || h->op == CS_PARALL_REDUCE_MAX_LOC) {
+      double rank = cs_glob_rank_id;
+      memcpy(send_buf + pos + val_size, &rank, sizeof(double));
+    }
+
+    pos += _reduce_entry_size(h);
+
+  }
+
+  /* Reduce as a single element of a contiguous datatype,
+     so that the buffer is never split */
+
+  MPI_Type_contiguous(size, MPI_BYTE, &(r->mpi_type));
+  MPI_Type_commit(&(r->mpi_type));
+
+  MPI_Op_create((MPI_User_function *)_reduce_packed, 1, &(r->mpi_op));
+
+#if (MPI_VERSION >= 3)
+  MPI_Iallreduce(send_buf, recv_buf, 1, r->mpi_type, r->mpi_op,
+                 cs_glob_mpi_comm, &(r->request));
+#else
+  MPI_Allreduce(send_buf, recv_buf, 1, r->mpi_type, r->mpi_op,
+                cs_glob_mpi_comm);
+  r->request = MPI_REQUEST_NULL;
+#endif
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Complete a deferred reduction, updating all registered values.
+ *
+ * Registered values are then released, so the structure may be reused
+ * for another set of values.
+ *
+ * \param[in, out]  r  pointer to deferred reduction structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_reduce_wait(cs_parall_reduce_t  *r)
+{
+  if (!r->active)
+    return;
+
+#if defined(HAVE_MPI)
+
+  if (r->mpi_op != MPI_OP_NULL) {
+
+    MPI_Wait(&(r->request), MPI_STATUS_IGNORE);
+
+    /* Unpack values */
+
+    size_t size = *((const size_t *)(r->buffer));
+    const unsigned char *recv_buf = r->buffer + size;
+    size_t pos = 2*sizeof(size_t);
+
+    for (int e_id = 0; e_id < r->n_entries; e_id++) {
+      const _reduce_header_t *h = r->entries + e_id;
+      pos += sizeof(_reduce_header_t);
+      memcpy(r->val[e_id],
+             recv_buf + pos,
+             (size_t)(h->n) * cs_datatype_size[h->datatype]);
+      pos += _reduce_entry_size(h);
+    }
+
+    MPI_Op_free(&(r->mpi_op));
+    MPI_Type_free(&(r->mpi_type));
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  r->n_entries = 0;
+  r->active = false;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return minimum recommended scatter or gather buffer size.
@@ -37,6 +37,28 @@
 
 BEGIN_C_DECLS
 
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Operation types for deferred (grouped) reductions */
+
+typedef enum {
+
+  CS_PARALL_REDUCE_SUM,      /* sum of values */
+  CS_PARALL_REDUCE_MIN,      /* minimum of values */
+  CS_PARALL_REDUCE_MAX,      /* maximum of values */
+  CS_PARALL_REDUCE_MIN_LOC,  /* minimum of first value, other values
+                                being those of the rank with the minimum */
+  CS_PARALL_REDUCE_MAX_LOC   /* maximum of first value, other values
+                                being those of the rank with the maximum */
+
+} cs_parall_reduce_op_t;
+
+/* Opaque deferred reduction structure */
+
+typedef struct _cs_parall_reduce_t  cs_parall_reduce_t;
+
 /*=============================================================================
  * Public function prototypes
  *============================================================================*/
@@ -313,6 +335,82 @@ cs_parall_min_id_rank_r(cs_lnum_t  *elt_id,
                         int        *rank_id,
                         cs_real_t   dis2mn);
 
+/*----------------------------------------------------------------------------
+ * Create a deferred reduction structure.
+ *
+ * Such a structure allows grouping reductions of multiple arrays of
+ * different types and operations in a single (possibly non-blocking)
+ * collective operation on all default communicator processes.
+ *
+ * returns:
+ *   pointer to new deferred reduction structure
+ *----------------------------------------------------------------------------*/
+
+cs_parall_reduce_t *
+cs_parall_reduce_create(void);
+
+/*----------------------------------------------------------------------------
+ * Destroy a deferred reduction structure.
+ *
+ * If a reduction is in progress, it is completed first.
+ *
+ * parameters:
+ *   r <-> pointer to deferred reduction structure pointer
+ *----------------------------------------------------------------------------*/
+
+void
+cs_parall_reduce_destroy(cs_parall_reduce_t  **r);
+
+/*----------------------------------------------------------------------------
+ * Register an array of values for a deferred reduction.
+ *
+ * Local values are read when cs_parall_reduce_start is called, and
+ * replaced by global values when cs_parall_reduce_wait is called,
+ * so the array must remain available until then.
+ *
+ * For CS_PARALL_REDUCE_MIN_LOC and CS_PARALL_REDUCE_MAX_LOC operations,
+ * the datatype must be CS_DOUBLE; the first value is compared, and the
+ * following values are those of the rank having the global minimum or
+ * maximum (the lowest such rank in case of ties).
+ *
+ * parameters:
+ *   r        <-> pointer to deferred reduction structure
+ *   op       <-- reduction operation
+ *   datatype <-- matching Code_Saturne datatype
+ *   n        <-- number of values
+ *   val      <-> local values in, global values out (size: n)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_parall_reduce_add(cs_parall_reduce_t     *r,
+                     cs_parall_reduce_op_t   op,
+                     cs_datatype_t           datatype,
+                     int                     n,
+                     void                   *val);
+
+/*----------------------------------------------------------------------------
+ * Start a deferred reduction of all registered values.
+ *
+ * parameters:
+ *   r <-> pointer to deferred reduction structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_parall_reduce_start(cs_parall_reduce_t  *r);
+
+/*----------------------------------------------------------------------------
+ * Complete a deferred reduction, updating all registered values.
+ *
+ * Registered values are then released, so the structure may be reused
+ * for another set of values.
+ *
+ * parameters:
+ *   r <-> pointer to deferred reduction structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_parall_reduce_wait(cs_parall_reduce_t  *r);
+
 /*----------------------------------------------------------------------------
  * Return minimum recommended scatter or gather buffer size.
  *
@@ -49,6 +49,11 @@
  *  Header for the current file
  *----------------------------------------------------------------------------*/
 
+#include "cs_base.h"
+#include "cs_file.h"
+#include "cs_log.h"
+#include "cs_parall.h"
+
 #include "cs_physical_properties.h"
 #if defined(HAVE_EOS)
 #include "cs_eos.hxx"
@@ -114,6 +119,35 @@ typedef struct {
 
 } cs_thermal_table_t;
 
+/* Tabulation settings */
+
+typedef struct {
+
+  double       var_min[2];           /* minimum values on each axis */
+  double       var_max[2];           /* maximum values on each axis */
+  int          n_nodes[2];           /* initial number of nodes on each axis */
+  double       tolerance;            /* relative error tolerance */
+  char        *cache_dir;            /* directory for cached tables,
+                                        or NULL */
+
+} cs_phys_prop_tab_settings_t;
+
+/* Tabulated property (bicubic Hermite interpolation) */
+
+typedef struct {
+
+  int          n_nodes[2];           /* number of nodes on each axis */
+  double       var_min[2];           /* minimum values on each axis */
+  double       var_max[2];           /* maximum values on each axis */
+  double       d_inv[2];             /* inverse of node spacing */
+  double      *f;                    /* value and scaled derivatives
+                                        (f, df/dx, df/dy, d2f/dxdy)
+                                        at each node (interlaced) */
+  double       max_err[2];           /* maximum absolute and relative
+                                        errors measured at cell centers */
+
+} cs_phys_prop_tab_t;
+
 /*----------------------------------------------------------------------------
  * Function pointer types
  *----------------------------------------------------------------------------*/
@@ -157,6 +191,23 @@ static cs_phys_prop_eos_t       *_cs_phys_prop_eos = NULL;
 
 #endif
 
+static cs_phys_prop_tab_settings_t  *_tab_settings = NULL;
+static cs_phys_prop_tab_t  *_tab[CS_PHYS_PROP_SPEED_OF_SOUND + 1];
+
+static const char *_phys_prop_name[] = {"pressure",
+                                        "temperature",
+                                        "enthalpy",
+                                        "entropy",
+                                        "isobaric_heat_capacity",
+                                        "isochoric_heat_capacity",
+                                        "specific_volume",
+                                        "density",
+                                        "internal_energy",
+                                        "quality",
+                                        "thermal_conductivity",
+                                        "dynamic_viscosity",
+                                        "speed_of_sound"};
+
 #if defined(HAVE_COOLPROP)
 
 static cs_phys_prop_coolprop_t  *_cs_phys_prop_coolprop = NULL;
@@ -186,6 +237,598 @@ _thermal_table_create(void)
   return tt;
 }
 
+/*----------------------------------------------------------------------------
+ * Compute a physical property using the selected library.
+ *
+ * parameters:
+ *   property <-- property queried
+ *   n_vals   <-- number of values
+ *   var1     <-- values on first plane axis
+ *   var2     <-- values on second plane axis (in Kelvin for temperature)
+ *   val      --> resulting property values
+ *----------------------------------------------------------------------------*/
+
+static void
+_compute_direct(cs_phys_prop_type_t   property,
+                cs_lnum_t             n_vals,
+                const cs_real_t       var1[],
+                const cs_real_t       var2[],
+                cs_real_t             val[])
+{
+  if (cs_glob_thermal_table->type == 1) {
+    cs_phys_prop_freesteam(cs_glob_thermal_table->thermo_plane,
+                           property,
+                           n_vals,
+                           var1,
+                           var2,
+                           val);
+  }
+#if defined(HAVE_EOS)
+  else if (cs_glob_thermal_table->type == 2) {
+    _cs_phys_prop_eos(cs_glob_thermal_table->thermo_plane,
+                      property,
+                      n_vals,
+                      (double *)var1,
+                      (double *)var2,
+                      val);
+  }
+#endif
+#if defined(HAVE_COOLPROP)
+  else if (cs_glob_thermal_table->type == 3) {
+    _cs_phys_prop_coolprop(cs_glob_thermal_table->material,
+                           cs_glob_thermal_table->thermo_plane,
+                           property,
+                           n_vals,
+                           var1,
+                           var2,
+                           val);
+  }
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Compute property values at a set of points of the (var1, var2) plane,
+ * distributing the computation over ranks.
+ *
+ * parameters:
+ *   property <-- property queried
+ *   n_vals   <-- number of values
+ *   var      <-- interlaced (var1, var2) values
+ *   val      --> resulting property values
+ *----------------------------------------------------------------------------*/
+
+static void
+_compute_direct_distributed(cs_phys_prop_type_t   property,
+                            cs_lnum_t             n_vals,
+                            const cs_real_t       var[],
+                            cs_real_t             val[])
+{
+  int rank_id = CS_MAX(cs_glob_rank_id, 0);
+  int n_ranks = cs_glob_n_ranks;
+
+  cs_lnum_t n_loc = 0;
+  for (cs_lnum_t i = rank_id; i < n_vals; i += n_ranks)
+    n_loc++;
+
+  cs_real_t *v1, *v2, *v;
+  BFT_MALLOC(v1, n_loc, cs_real_t);
+  BFT_MALLOC(v2, n_loc, cs_real_t);
+  BFT_MALLOC(v, n_loc, cs_real_t);
+
+  n_loc = 0;
+  for (cs_lnum_t i = rank_id; i < n_vals; i += n_ranks) {
+    v1[n_loc] = var[i*2];
+    v2[n_loc] = var[i*2 + 1];
+    n_loc++;
+  }
+
+  if (n_loc > 0)
+    _compute_direct(property, n_loc, v1, v2, v);
+
+  for (cs_lnum_t i = 0; i < n_vals; i++)
+    val[i] = 0;
+
+  n_loc = 0;
+  for (cs_lnum_t i = rank_id; i < n_vals; i += n_ranks)
+    val[i] = v[n_loc++];
+
+  BFT_FREE(v);
+  BFT_FREE(v2);
+  BFT_FREE(v1);
+
+  cs_parall_sum(n_vals, CS_REAL_TYPE, val);
+}
+
+/*----------------------------------------------------------------------------
+ * Create a tabulated property structure with given nodes.
+ *
+ * parameters:
+ *   var_min <-- minimum values on each axis
+ *   var_max <-- maximum values on each axis
+ *   n_nodes <-- number of nodes on each axis
+ *
+ * returns:
+ *   pointer to tabulated property
+ *----------------------------------------------------------------------------*/
+
+static cs_phys_prop_tab_t *
+_tab_create(const double  var_min[2],
+            const double  var_max[2],
+            const int     n_nodes[2])
+{
+  cs_phys_prop_tab_t *t;
+  BFT_MALLOC(t, 1, cs_phys_prop_tab_t);
+
+  for (int k = 0; k < 2; k++) {
+    t->n_nodes[k] = n_nodes[k];
+    t->var_min[k] = var_min[k];
+    t->var_max[k] = var_max[k];
+    t->d_inv[k] = (n_nodes[k] - 1) / (var_max[k] - var_min[k]);
+  }
+
+  BFT_MALLOC(t->f, (size_t)n_nodes[0]*n_nodes[1]*4, double);
+
+  t->max_err[0] = 0;
+  t->max_err[1] = 0;
+
+  return t;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a tabulated property structure.
+ *
+ * parameters:
+ *   t <-> pointer to tabulated property
+ *----------------------------------------------------------------------------*/
+
+static void
+_tab_destroy(cs_phys_prop_tab_t  **t)
+{
+  if (*t != NULL) {
+    BFT_FREE((*t)->f);
+    BFT_FREE(*t);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Compute node values and derivatives for a tabulated property.
+ *
+ * Derivatives are estimated using finite differences, and scaled
+ * to a unit cell size.
+ *
+ * parameters:
+ *   t        <-> pointer to tabulated property
+ *   property <-- property queried
+ *----------------------------------------------------------------------------*/
+
+static void
+_tab_fill(cs_phys_prop_tab_t   *t,
+          cs_phys_prop_type_t   property)
+{
+  const int n0 = t->n_nodes[0], n1 = t->n_nodes[1];
+  const cs_lnum_t n_nodes = (cs_lnum_t)n0*n1;
+
+  cs_real_t *var, *f;
+  BFT_MALLOC(var, n_nodes*2, cs_real_t);
+  BFT_MALLOC(f, n_nodes, cs_real_t);
+
+  for (int j = 0; j < n1; j++) {
+    for (int i = 0; i < n0; i++) {
+      cs_lnum_t n_id = (cs_lnum_t)j*n0 + i;
+      var[n_id*2]     = t->var_min[0] + i / t->d_inv[0];
+      var[n_id*2 + 1] = t->var_min[1] + j / t->d_inv[1];
+    }
+  }
+
+  _compute_direct_distributed(property, n_nodes, var, f);
+
+  BFT_FREE(var);
+
+  /* Values and first derivatives */
+
+  for (int j = 0; j < n1; j++) {
+    for (int i = 0; i < n0; i++) {
+      cs_lnum_t n_id = (cs_lnum_t)j*n0 + i;
+      int i0 = CS_MAX(i-1, 0), i1 = CS_MIN(i+1, n0-1);
+      int j0 = CS_MAX(j-1, 0), j1 = CS_MIN(j+1, n1-1);
+      double *fn = t->f + n_id*4;
+      fn[0] = f[n_id];
+      fn[1] = (f[j*n0 + i1] - f[j*n0 + i0]) / (i1 - i0);
+      fn[2] = (f[j1*n0 + i] - f[j0*n0 + i]) / (j1 - j0);
+    }
+  }
+
+  /* Cross derivatives */
+
+  for (int j = 0; j < n1; j++) {
+    for (int i = 0; i < n0; i++) {
+      cs_lnum_t n_id = (cs_lnum_t)j*n0 + i;
+      int j0 = CS_MAX(j-1, 0), j1 = CS_MIN(j+1, n1-1);
+      t->f[n_id*4 + 3] = (  t->f[((cs_lnum_t)j1*n0 + i)*4 + 1]
+                          - t->f[((cs_lnum_t)j0*n0 + i)*4 + 1]) / (j1 - j0);
+    }
+  }
+
+  BFT_FREE(f);
+}
+
+/*----------------------------------------------------------------------------
+ * Evaluate a tabulated property at points inside the table range.
+ *
+ * parameters:
+ *   t      <-- pointer to tabulated property
+ *   n_vals <-- number of values
+ *   var1   <-- values on first plane axis
+ *   var2   <-- values on second plane axis
+ *   val    --> resulting property values
+ *----------------------------------------------------------------------------*/
+
+static void
+_tab_eval(const cs_phys_prop_tab_t  *t,
+          cs_lnum_t                  n_vals,
+          const cs_real_t            var1[],
+          const cs_real_t            var2[],
+          cs_real_t                  val[])
+{
+  const int n0 = t->n_nodes[0], n1 = t->n_nodes[1];
+  const double *restrict tf = t->f;
+
+# pragma omp parallel for if (n_vals > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_vals; ii++) {
+
+    double x = (var1[ii] - t->var_min[0]) * t->d_inv[0];
+    double y = (var2[ii] - t->var_min[1]) * t->d_inv[1];
+
+    int i = CS_MIN(CS_MAX((int)x, 0), n0 - 2);
+    int j = CS_MIN(CS_MAX((int)y, 0), n1 - 2);
+
+    double u = x - i, v = y - j;
+
+    /* Cubic Hermite basis functions */
+
+    double hu[2] = {(2*u - 3)*u*u + 1, (3 - 2*u)*u*u};
+    double gu[2] = {((u - 2)*u + 1)*u, (u - 1)*u*u};
+    double hv[2] = {(2*v - 3)*v*v + 1, (3 - 2*v)*v*v};
+    double gv[2] = {((v - 2)*v + 1)*v, (v - 1)*v*v};
+
+    double p = 0;
+
+    for (int b = 0; b < 2; b++) {
+      for (int a = 0; a < 2; a++) {
+        const double *fn = tf + ((cs_lnum_t)(j+b)*n0 + (i+a))*4;
+        p +=   fn[0]*hu[a]*hv[b] + fn[1]*gu[a]*hv[b]
+             + fn[2]*hu[a]*gv[b] + fn[3]*gu[a]*gv[b];
+      }
+    }
+
+    val[ii] = p;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Estimate tabulation errors at cell centers.
+ *
+ * parameters:
+ *   t        <-> pointer to tabulated property
+ *   property <-- property queried
+ *----------------------------------------------------------------------------*/
+
+static void
+_tab_estimate_error(cs_phys_prop_tab_t   *t,
+                    cs_phys_prop_type_t   property)
+{
+  const int n0 = t->n_nodes[0] - 1, n1 = t->n_nodes[1] - 1;
+  const cs_lnum_t n_cells = (cs_lnum_t)n0*n1;
+
+  cs_real_t *var, *v1, *v2, *f_ref, *f_tab;
+  BFT_MALLOC(var, n_cells*2, cs_real_t);
+  BFT_MALLOC(v1, n_cells, cs_real_t);
+  BFT_MALLOC(v2, n_cells, cs_real_t);
+  BFT_MALLOC(f_ref, n_cells, cs_real_t);
+  BFT_MALLOC(f_tab, n_cells, cs_real_t);
+
+  for (int j = 0; j < n1; j++) {
+    for (int i = 0; i < n0; i++) {
+      cs_lnum_t c_id = (cs_lnum_t)j*n0 + i;
+      v1[c_id] = t->var_min[0] + (i + 0.5) / t->d_inv[0];
+      v2[c_id] = t->var_min[1] + (j + 0.5) / t->d_inv[1];
+      var[c_id*2] = v1[c_id];
+      var[c_id*2 + 1] = v2[c_id];
+    }
+  }
+
+  _compute_direct_distributed(property, n_cells, var, f_ref);
+  _tab_eval(t, n_cells, v1, v2, f_tab);
+
+  double f_max = 0;
+  t->max_err[0] = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    t->max_err[0] = CS_MAX(t->max_err[0], CS_ABS(f_tab[c_id] - f_ref[c_id]));
+    f_max = CS_MAX(f_max, CS_ABS(f_ref[c_id]));
+  }
+  t->max_err[1] = (f_max > 0) ? t->max_err[0] / f_max : t->max_err[0];
+
+  BFT_FREE(f_tab);
+  BFT_FREE(f_ref);
+  BFT_FREE(v2);
+  BFT_FREE(v1);
+  BFT_FREE(var);
+}
+
+/*----------------------------------------------------------------------------
+ * Build file name for a cached tabulated property.
+ *
+ * parameters:
+ *   property <-- property queried
+ *
+ * returns:
+ *   allocated file name
+ *----------------------------------------------------------------------------*/
+
+static char *
+_tab_cache_name(cs_phys_prop_type_t  property)
+{
+  const cs_thermal_table_t *tt = cs_glob_thermal_table;
+  const char *dir = _tab_settings->cache_dir;
+
+  size_t l =   strlen(dir) + strlen(tt->material) + strlen(tt->method)
+             + strlen(_phys_prop_name[property]) + 32;
+
+  char *name;
+  BFT_MALLOC(name, l, char);
+
+  snprintf(name, l, "%s%c%s_%s_%d_%s.cstab",
+           dir, DIR_SEPARATOR, tt->material, tt->method,
+           (int)tt->thermo_plane, _phys_prop_name[property]);
+  name[l-1] = '\0';
+
+  return name;
+}
+
+/*----------------------------------------------------------------------------
+ * Read a tabulated property from the cache directory if present and
+ * matching current settings.
+ *
+ * parameters:
+ *   property <-- property queried
+ *   var_min  <-- minimum values on each axis
+ *   var_max  <-- maximum values on each axis
+ *
+ * returns:
+ *   pointer to tabulated property, or NULL
+ *----------------------------------------------------------------------------*/
+
+static cs_phys_prop_tab_t *
+_tab_read_cache(cs_phys_prop_type_t  property,
+                const double         var_min[2],
+                const double         var_max[2])
+{
+  cs_phys_prop_tab_t *t = NULL;
+
+  char *name = _tab_cache_name(property);
+
+  if (cs_file_isreg(name)) {
+
+    double header[8];
+    cs_file_t *f = cs_file_open_serial(name, CS_FILE_MODE_READ);
+
+    if (cs_file_read_global(f, header, sizeof(double), 8) == 8) {
+
+      int n_nodes[2] = {header[4], header[5]};
+
+      /* Bounds are written from the same settings, so compare
+         bit patterns rather than using floating-point equality */
+
+      const double bounds[4] = {var_min[0], var_max[0],
+                                var_min[1], var_max[1]};
+
+      if (   memcmp(header, bounds, 4*sizeof(double)) == 0
+          && header[7] <= _tab_settings->tolerance
+          && n_nodes[0] > 1 && n_nodes[1] > 1) {
+
+        size_t n = (size_t)n_nodes[0]*n_nodes[1]*4;
+
+        t = _tab_create(var_min, var_max, n_nodes);
+        t->max_err[0] = header[6];
+        t->max_err[1] = header[7];
+
+        if (cs_file_read_global(f, t->f, sizeof(double), n) != n)
+          _tab_destroy(&t);
+
+      }
+
+    }
+
+    cs_file_free(f);
+  }
+
+  BFT_FREE(name);
+
+  return t;
+}
+
+/*----------------------------------------------------------------------------
+ * Write a tabulated property to the cache directory.
+ *
+ * parameters:
+ *   t        <-- pointer to tabulated property
+ *   property <-- property queried
+ *----------------------------------------------------------------------------*/
+
+static void
+_tab_write_cache(const cs_phys_prop_tab_t  *t,
+                 cs_phys_prop_type_t        property)
+{
+  if (cs_glob_rank_id < 1) {
+    if (cs_file_mkdir_default(_tab_settings->cache_dir) != 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("The %s directory cannot be created"),
+                _tab_settings->cache_dir);
+  }
+
+  char *name = _tab_cache_name(property);
+
+  double header[8] = {t->var_min[0], t->var_max[0],
+                      t->var_min[1], t->var_max[1],
+                      t->n_nodes[0], t->n_nodes[1],
+                      t->max_err[0], t->max_err[1]};
+
+  cs_file_t *f = cs_file_open_serial(name, CS_FILE_MODE_WRITE);
+
+  cs_file_write_global(f, header, sizeof(double), 8);
+  cs_file_write_global(f, t->f, sizeof(double),
+                       (size_t)t->n_nodes[0]*t->n_nodes[1]*4);
+
+  cs_file_free(f);
+
+  BFT_FREE(name);
+}
+
+/*----------------------------------------------------------------------------
+ * Build (or load) a tabulated property.
+ *
+ * The number of nodes is doubled until the error measured at cell
+ * centers is below the tolerance, or a maximum table size is reached.
+ *
+ * parameters:
+ *   property <-- property queried
+ *
+ * returns:
+ *   pointer to tabulated property
+ *----------------------------------------------------------------------------*/
+
+static cs_phys_prop_tab_t *
+_tab_build(cs_phys_prop_type_t  property)
+{
+  const cs_phys_prop_tab_settings_t *ts = _tab_settings;
+  const int n_nodes_max = 2049;
+
+  double var_min[2] = {ts->var_min[0], ts->var_min[1]};
+  double var_max[2] = {ts->var_max[0], ts->var_max[1]};
+
+  if (cs_glob_thermal_table->temp_scale == 2) {
+    var_min[1] += 273.15;
+    var_max[1] += 273.15;
+  }
+
+  cs_phys_prop_tab_t *t = NULL;
+
+  if (ts->cache_dir != NULL)
+    t = _tab_read_cache(property, var_min, var_max);
+
+  if (t != NULL) {
+    cs_log_printf(CS_LOG_DEFAULT,
+                  _("\n Tabulated %s read from cache\n"
+                    "   %d x %d nodes, max. error: %g (relative: %g)\n"),
+                  _phys_prop_name[property],
+                  t->n_nodes[0], t->n_nodes[1], t->max_err[0], t->max_err[1]);
+    return t;
+  }
+
+  int n_nodes[2] = {ts->n_nodes[0], ts->n_nodes[1]};
+
+  while (true) {
+
+    t = _tab_create(var_min, var_max, n_nodes);
+
+    _tab_fill(t, property);
+    _tab_estimate_error(t, property);
+
+    if (   t->max_err[1] <= ts->tolerance
+        || (n_nodes[0]-1)*2 + 1 > n_nodes_max
+        || (n_nodes[1]-1)*2 + 1 > n_nodes_max)
+      break;
+
+    _tab_destroy(&t);
+
+    for (int k = 0; k < 2; k++)
+      n_nodes[k] = (n_nodes[k]-1)*2 + 1;
+
+  }
+
+  cs_log_printf(CS_LOG_DEFAULT,
+                _("\n Tabulated %s\n"
+                  "   %d x %d nodes, max. error: %g (relative: %g)\n"),
+                _phys_prop_name[property],
+                t->n_nodes[0], t->n_nodes[1], t->max_err[0], t->max_err[1]);
+
+  if (t->max_err[1] > ts->tolerance) {
+    cs_base_warn(__FILE__, __LINE__);
+    bft_printf(_("Tabulated %s does not reach the requested tolerance (%g)\n"
+                 "with the maximum table size.\n"),
+               _phys_prop_name[property], ts->tolerance);
+  }
+
+  if (ts->cache_dir != NULL)
+    _tab_write_cache(t, property);
+
+  return t;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute a physical property using a tabulation, falling back to the
+ * selected library outside the table range.
+ *
+ * parameters:
+ *   property <-- property queried
+ *   n_vals   <-- number of values
+ *   var1     <-- values on first plane axis
+ *   var2     <-- values on second plane axis (in Kelvin for temperature)
+ *   val      --> resulting property values
+ *----------------------------------------------------------------------------*/
+
+static void
+_compute_tabulated(cs_phys_prop_type_t   property,
+                   cs_lnum_t             n_vals,
+                   const cs_real_t       var1[],
+                   const cs_real_t       var2[],
+                   cs_real_t             val[])
+{
+  const cs_phys_prop_tab_t *t = _tab[property];
+
+  _tab_eval(t, n_vals, var1, var2, val);
+
+  /* Direct computation for values outside table */
+
+  cs_lnum_t n_out = 0;
+  for (cs_lnum_t i = 0; i < n_vals; i++) {
+    if (   var1[i] < t->var_min[0] || var1[i] > t->var_max[0]
+        || var2[i] < t->var_min[1] || var2[i] > t->var_max[1])
+      n_out++;
+  }
+
+  if (n_out == 0)
+    return;
+
+  cs_lnum_t *out_id;
+  cs_real_t *v1, *v2, *v;
+  BFT_MALLOC(out_id, n_out, cs_lnum_t);
+  BFT_MALLOC(v1, n_out, cs_real_t);
+  BFT_MALLOC(v2, n_out, cs_real_t);
+  BFT_MALLOC(v, n_out, cs_real_t);
+
+  n_out = 0;
+  for (cs_lnum_t i = 0; i < n_vals; i++) {
+    if (   var1[i] < t->var_min[0] || var1[i] > t->var_max[0]
+        || var2[i] < t->var_min[1] || var2[i] > t->var_max[1]) {
+      out_id[n_out] = i;
+      v1[n_out] = var1[i];
+      v2[n_out] = var2[i];
+      n_out++;
+    }
+  }
+
+  _compute_direct(property, n_out, v1, v2, v);
+
+  for (cs_lnum_t i = 0; i < n_out; i++)
+    val[out_id[i]] = v[i];
+
+  BFT_FREE(v);
+  BFT_FREE(v2);
+  BFT_FREE(v1);
+  BFT_FREE(out_id);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
@@ -308,6 +951,83 @@ cs_thermal_table_finalize(void)
     BFT_FREE(cs_glob_thermal_table->method);
     BFT_FREE(cs_glob_thermal_table);
   }
+
+  if (_tab_settings != NULL) {
+    for (int i = 0; i < CS_PHYS_PROP_SPEED_OF_SOUND + 1; i++)
+      _tab_destroy(&(_tab[i]));
+    BFT_FREE(_tab_settings->cache_dir);
+    BFT_FREE(_tab_settings);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate tabulation of physical properties computed by the
+ *        thermal table library.
+ *
+ * Each property is tabulated over the given range of the thermodynamic
+ * plane the first time it is queried, and further values are computed by
+ * bicubic interpolation in that table. Values outside the table range are
+ * computed by the library directly.
+ *
+ * The number of table nodes is doubled until the maximum relative error
+ * measured at the table cell centers is below the given tolerance; the
+ * resulting error is logged.
+ *
+ * Ranges are given in the units used for \ref cs_phys_prop_compute
+ * (so in Celsius for temperature if the thermal table uses this scale).
+ *
+ * Tables are built when a property is first queried, so the first call
+ * to \ref cs_phys_prop_compute for each property must be done on all ranks.
+ *
+ * \param[in]  var1_min   minimum value on first plane axis (pressure)
+ * \param[in]  var1_max   maximum value on first plane axis (pressure)
+ * \param[in]  var2_min   minimum value on second plane axis
+ * \param[in]  var2_max   maximum value on second plane axis
+ * \param[in]  n_nodes    initial number of nodes on each axis
+ * \param[in]  tolerance  relative error tolerance
+ * \param[in]  cache_dir  directory in which tables are cached between
+ *                        runs, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_thermal_table_set_tabulation(double       var1_min,
+                                double       var1_max,
+                                double       var2_min,
+                                double       var2_max,
+                                int          n_nodes,
+                                double       tolerance,
+                                const char  *cache_dir)
+{
+  if (var1_max <= var1_min || var2_max <= var2_min)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: empty tabulation range."), __func__);
+
+  if (_tab_settings == NULL) {
+    BFT_MALLOC(_tab_settings, 1, cs_phys_prop_tab_settings_t);
+    _tab_settings->cache_dir = NULL;
+    for (int i = 0; i < CS_PHYS_PROP_SPEED_OF_SOUND + 1; i++)
+      _tab[i] = NULL;
+  }
+  else {
+    for (int i = 0; i < CS_PHYS_PROP_SPEED_OF_SOUND + 1; i++)
+      _tab_destroy(&(_tab[i]));
+  }
+
+  _tab_settings->var_min[0] = var1_min;
+  _tab_settings->var_max[0] = var1_max;
+  _tab_settings->var_min[1] = var2_min;
+  _tab_settings->var_max[1] = var2_max;
+  _tab_settings->n_nodes[0] = CS_MAX(n_nodes, 2);
+  _tab_settings->n_nodes[1] = CS_MAX(n_nodes, 2);
+  _tab_settings->tolerance = tolerance;
+
+  BFT_FREE(_tab_settings->cache_dir);
+  if (cache_dir != NULL) {
+    BFT_MALLOC(_tab_settings->cache_dir, strlen(cache_dir) + 1, char);
+    strcpy(_tab_settings->cache_dir, cache_dir);
+  }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -343,6 +1063,15 @@ cs_phys_prop_compute(cs_phys_prop_type_t          property,
   cs_real_t        *_var1_c = NULL, *_var2_c = NULL;
   const cs_real_t  *var1_c = var1, *var2_c = var2;
 
+  /* Build tables on first (collective) call if tabulation is active */
+
+  bool use_tab = false;
+  if (_tab_settings != NULL && cs_glob_thermal_table->type > 0) {
+    if (_tab[property] == NULL)
+      _tab[property] = _tab_build(property);
+    use_tab = true;
+  }
+
   if (n_vals < 1)
     return;
 
@@ -379,37 +1108,13 @@ cs_phys_prop_compute(cs_phys_prop_type_t          property,
     }
   }
 
-  /* Compute proper */
+  /* Compute property */
+
+  if (use_tab)
+    _compute_tabulated(property, _n_vals, var1_c, var2_c, val);
+  else
+    _compute_direct(property, _n_vals, var1_c, var2_c, val);
 
-  if (cs_glob_thermal_table->type == 1) {
-    cs_phys_prop_freesteam(cs_glob_thermal_table->thermo_plane,
-                           property,
-                           _n_vals,
-                           var1_c,
-                           var2_c,
-                           val);
-  }
-#if defined(HAVE_EOS)
-  else if (cs_glob_thermal_table->type == 2) {
-    _cs_phys_prop_eos(cs_glob_thermal_table->thermo_plane,
-                      property,
-                      _n_vals,
-                      var1_c,
-                      var2_c,
-                      val);
-  }
-#endif
-#if defined(HAVE_COOLPROP)
-  else if (cs_glob_thermal_table->type == 3) {
-    _cs_phys_prop_coolprop(cs_glob_thermal_table->material,
-                           cs_glob_thermal_table->thermo_plane,
-                           property,
-                           _n_vals,
-                           var1_c,
-                           var2_c,
-                           val);
-  }
-#endif
   BFT_FREE(_var1_c);
   BFT_FREE(_var2_c);
 
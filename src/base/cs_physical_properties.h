@@ -89,6 +89,35 @@ cs_thermal_table_set(const char                        *material,
 void
 cs_thermal_table_finalize(void);
 
+/*----------------------------------------------------------------------------
+ * Activate tabulation of physical properties computed by the thermal
+ * table library.
+ *
+ * Each property is tabulated over the given range of the thermodynamic
+ * plane the first time it is queried, and further values are computed by
+ * bicubic interpolation in that table. Values outside the table range are
+ * computed by the library directly.
+ *
+ * parameters:
+ *   var1_min  <-- minimum value on first plane axis (pressure)
+ *   var1_max  <-- maximum value on first plane axis (pressure)
+ *   var2_min  <-- minimum value on second plane axis
+ *   var2_max  <-- maximum value on second plane axis
+ *   n_nodes   <-- initial number of nodes on each axis
+ *   tolerance <-- relative error tolerance
+ *   cache_dir <-- directory in which tables are cached between runs,
+ *                 or NULL
+ *----------------------------------------------------------------------------*/
+
+void
+cs_thermal_table_set_tabulation(double       var1_min,
+                                double       var1_max,
+                                double       var2_min,
+                                double       var2_max,
+                                int          n_nodes,
+                                double       tolerance,
+                                const char  *cache_dir);
+
 /*----------------------------------------------------------------------------
  * Compute a physical property.
  *
@@ -1113,6 +1113,21 @@ _update_mesh_writer_associations(cs_post_mesh_t  *post_mesh)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Wait for completion of pending output operations of all writers, so that
+ * associated exportable meshes may be modified or destroyed.
+ *----------------------------------------------------------------------------*/
+
+static void
+_sync_writers(void)
+{
+  for (int i = 0; i < _cs_post_n_writers; i++) {
+    cs_post_writer_t  *writer = _cs_post_writers + i;
+    if (writer->writer != NULL)
+      fvm_writer_sync(writer->writer);
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Add or select a post-processing mesh, do basic initialization, and return
  * a pointer to the associated structure.
@@ -1161,8 +1176,10 @@ _predefine_mesh(int        mesh_id,
       BFT_FREE(post_mesh->writer_id);
 
       post_mesh->exp_mesh = NULL;
-      if (post_mesh->_exp_mesh != NULL)
+      if (post_mesh->_exp_mesh != NULL) {
+        _sync_writers();
         post_mesh->_exp_mesh = fvm_nodal_destroy(post_mesh->_exp_mesh);
+      }
 
       break;
 
@@ -1271,8 +1288,10 @@ _free_mesh(int _mesh_id)
   int i;
   cs_post_mesh_t  *post_mesh = _cs_post_meshes + _mesh_id;
 
-  if (post_mesh->_exp_mesh != NULL)
+  if (post_mesh->_exp_mesh != NULL) {
+    _sync_writers();
     post_mesh->_exp_mesh = fvm_nodal_destroy(post_mesh->_exp_mesh);
+  }
 
   BFT_FREE(post_mesh->writer_id);
   post_mesh->n_writers = 0;
@@ -1859,8 +1878,10 @@ _redefine_mesh(cs_post_mesh_t        *post_mesh,
   if (post_mesh->exp_mesh != NULL) {
     if (post_mesh->_exp_mesh == NULL)
       return;
-    else
+    else {
+      _sync_writers();
       post_mesh->_exp_mesh = fvm_nodal_destroy(post_mesh->_exp_mesh);
+    }
   }
   post_mesh->exp_mesh = NULL;
 
@@ -1925,13 +1946,17 @@ _divide_poly(cs_post_mesh_t    *post_mesh,
 {
   if (fvm_writer_needs_tesselation(writer->writer,
                                    post_mesh->exp_mesh,
-                                   FVM_CELL_POLY) > 0)
+                                   FVM_CELL_POLY) > 0) {
+    _sync_writers();
     fvm_nodal_tesselate(post_mesh->_exp_mesh, FVM_CELL_POLY, NULL);
+  }
 
   if (fvm_writer_needs_tesselation(writer->writer,
                                    post_mesh->exp_mesh,
-                                   FVM_FACE_POLY) > 0)
+                                   FVM_FACE_POLY) > 0) {
+    _sync_writers();
     fvm_nodal_tesselate(post_mesh->_exp_mesh, FVM_FACE_POLY, NULL);
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -3751,6 +3776,12 @@ _check_non_transient(const cs_post_writer_t  *writer,
  *         pyramids), so that any post-processing tool can recognize them.
  * - \c \b separate_meshes to multiple meshes and associated fields to
  *         separate outputs.
+ * - \c \b async to export fields and flush output in a background
+ *         thread, so that computation may proceed during output (for
+ *         formats not using external libraries, such as \c \b EnSight;
+ *         requires POSIX threads and, in parallel, MPI_THREAD_MULTIPLE
+ *         support, requested only when the \c CS_MPI_THREAD_MULTIPLE
+ *         environment variable is set to 1).
  *
  * Note that the white-spaces in the beginning or in the end of the
  * character strings given as arguments here are suppressed automatically.
@@ -3863,7 +3894,7 @@ cs_post_define_writer(int                     writer_id,
   }
   w->ot = NULL;
 
-  wd->time_dep = time_dep;
+  wd->time_dep = CS_MAX(time_dep, _cs_post_mod_flag_min);
 
   BFT_MALLOC(wd->case_name, strlen(case_name) + 1, char);
   strcpy(wd->case_name, case_name);
@@ -5453,8 +5484,10 @@ cs_post_write_meshes(const cs_time_step_t  *ts)
     _cs_post_write_mesh(post_mesh, ts);
     /* reduce mesh definitions if not required anymore */
     if (   post_mesh->mod_flag_max == FVM_WRITER_FIXED_MESH
-        && post_mesh->_exp_mesh != NULL)
+        && post_mesh->_exp_mesh != NULL) {
+      _sync_writers();
       fvm_nodal_reduce(post_mesh->_exp_mesh, 0);
+    }
   }
 
   cs_timer_stats_switch(t_top_id);
@@ -6313,16 +6346,59 @@ cs_post_renum_faces(const cs_lnum_t  init_i_face_num[],
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Rebuild post-processing meshes after the computational mesh has
+ * been redistributed among ranks or adapted.
+ *
+ * Meshes based on selection criteria or functions are rebuilt based on
+ * the new distribution. As the global numbering of the computational mesh
+ * elements is unchanged by redistribution, already output meshes remain
+ * valid, so this also applies to meshes associated with writers with a
+ * fixed mesh time dependency. When the mesh is adapted, writers should
+ * allow changing connectivity (see \ref cs_post_set_changing_connectivity).
+ * Lagrangian meshes and meshes not owned by the post-processing layer
+ * are not modified.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_post_redistribute_meshes(void)
+{
+  for (int i = 0; i < _cs_post_n_meshes; i++) {
+
+    cs_post_mesh_t  *post_mesh = _cs_post_meshes + i;
+
+    if (post_mesh->ent_flag[3] != 0 || post_mesh->exp_mesh == NULL)
+      continue;
+
+    _redefine_mesh(post_mesh, NULL);
+
+    if (post_mesh->exp_mesh == NULL)
+      continue;
+
+    /* Apply the same element division as for the initial output */
+
+    for (int j = 0; j < post_mesh->n_writers; j++) {
+      cs_post_writer_t  *writer = _cs_post_writers + post_mesh->writer_id[j];
+      if (writer->writer != NULL)
+        _divide_poly(post_mesh, writer);
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Configure the post-processing output so that mesh connectivity
  * may be automatically updated.
  *
- * This is done for meshes defined using selection criteria or functions.
+ * This is done for meshes defined using selection criteria or functions,
+ * and writers defined after this call allow changing connectivity.
  * The behavior of Lagrangian meshes is unchanged.
  *
  * To be effective, this function should be called before defining
- * postprocessing meshes.
+ * postprocessing writers and meshes.
  */
 /*----------------------------------------------------------------------------*/
 
@@ -6942,6 +7018,7 @@ cs_post_time_step_end(void)
     if (post_mesh->_exp_mesh != NULL) {
       if (   post_mesh->ent_flag[3]
           || post_mesh->mod_flag_min == FVM_WRITER_TRANSIENT_CONNECT) {
+        _sync_writers();
         post_mesh->exp_mesh = NULL;
         post_mesh->_exp_mesh = fvm_nodal_destroy(post_mesh->_exp_mesh);
       }
@@ -7029,6 +7106,8 @@ cs_post_finalize(void)
 
   /* Exportable meshes */
 
+  _sync_writers();
+
   for (i = 0; i < _cs_post_n_meshes; i++) {
     post_mesh = _cs_post_meshes + i;
     if (post_mesh->_exp_mesh != NULL)
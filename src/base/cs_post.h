@@ -262,6 +262,12 @@ typedef void
  *         pyramids), so that any post-processing tool can recognize them.
  * - \c \b separate_meshes to multiple meshes and associated fields to
  *         separate outputs.
+ * - \c \b async to export fields and flush output in a background
+ *         thread, so that computation may proceed during output (for
+ *         formats not using external libraries, such as \c \b EnSight;
+ *         requires POSIX threads and, in parallel, MPI_THREAD_MULTIPLE
+ *         support, requested only when the \c CS_MPI_THREAD_MULTIPLE
+ *         environment variable is set to 1).
  *
  * Note that the white-spaces in the beginning or in the end of the
  * character strings given as arguments here are suppressed automatically.
@@ -1192,16 +1198,36 @@ void
 cs_post_renum_faces(const cs_lnum_t  init_i_face_num[],
                     const cs_lnum_t  init_b_face_num[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Rebuild post-processing meshes after the computational mesh has
+ * been redistributed among ranks or adapted.
+ *
+ * Meshes based on selection criteria or functions are rebuilt based on
+ * the new distribution. As the global numbering of the computational mesh
+ * elements is unchanged by redistribution, already output meshes remain
+ * valid, so this also applies to meshes associated with writers with a
+ * fixed mesh time dependency. When the mesh is adapted, writers should
+ * allow changing connectivity (see \ref cs_post_set_changing_connectivity).
+ * Lagrangian meshes and meshes not owned by the post-processing layer
+ * are not modified.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_post_redistribute_meshes(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Configure the post-processing output so that mesh connectivity
  * may be automatically updated.
  *
- * This is done for meshes defined using selection criteria or functions.
+ * This is done for meshes defined using selection criteria or functions,
+ * and writers defined after this call allow changing connectivity.
  * The behavior of Lagrangian meshes is unchanged.
  *
  * To be effective, this function should be called before defining
- * postprocessing meshes.
+ * postprocessing writers and meshes.
  */
 /*----------------------------------------------------------------------------*/
 
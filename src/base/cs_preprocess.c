@@ -46,14 +46,21 @@
 #include "bft_printf.h"
 
 #include "cs_boundary_zone.h"
+#include "cs_cell_to_vertex.h"
 #include "cs_ext_neighborhood.h"
+#include "cs_gradient.h"
+#include "cs_gradient_perio.h"
 #include "cs_gui.h"
 #include "cs_gui_mesh.h"
 #include "cs_internal_coupling.h"
 #include "cs_join.h"
+#include "cs_load_balance.h"
 #include "cs_log.h"
 #include "cs_map.h"
+#include "cs_matrix_default.h"
 #include "cs_mesh.h"
+#include "cs_mesh_adapt.h"
+#include "cs_mesh_adjacencies.h"
 #include "cs_mesh_from_builder.h"
 #include "cs_mesh_location.h"
 #include "cs_mesh_quantities.h"
@@ -314,6 +321,10 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
     cs_gui_mesh_extrude(cs_glob_mesh);
     cs_user_mesh_modify(cs_glob_mesh);
 
+    /* Solution-based adaptation when restarting */
+
+    cs_mesh_adapt_apply(cs_glob_mesh);
+
     /* Discard isolated faces if present */
 
     cs_post_add_free_faces();
@@ -350,6 +361,10 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
 
   }
 
+  /* Possible repartitioning based on estimated cell costs */
+
+  cs_load_balance_apply(cs_glob_mesh);
+
   bool partition_preprocess = cs_partition_get_preprocess();
   bool need_save = false;
   if (   (cs_glob_mesh->modified > 0 && cs_glob_mesh->save_if_modified > 0)
@@ -522,6 +537,77 @@ cs_preprocess_mesh_selected_b_faces_ignore(cs_mesh_t             *m,
   cs_timer_stats_switch(t_top_id);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update mesh-dependent structures after the mesh has been modified
+ *        or redistributed during a computation.
+ *
+ * The mesh connectivity, halo and auxiliary structures are assumed to be
+ * already built (and the mesh builder destroyed). Numbering, group classes,
+ * quantities, selectors, locations and zones are rebuilt, Fortran mappings
+ * are updated, and mesh-based linear algebra structures are reset.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_preprocess_mesh_update_runtime(void)
+{
+  cs_mesh_t *m = cs_glob_mesh;
+  cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+
+  int t_stat_id = cs_timer_stats_id_by_name("mesh_processing");
+
+  int t_top_id = cs_timer_stats_switch(t_stat_id);
+
+  m->n_b_faces_all = m->n_b_faces;
+  m->n_g_b_faces_all = m->n_g_b_faces;
+
+  /* Renumber mesh based on code options */
+
+  cs_user_numbering();
+
+  cs_renumber_mesh(m);
+
+  /* Initialize group classes */
+
+  cs_mesh_init_group_classes(m);
+
+  if (m->verbosity > 0)
+    cs_mesh_print_info(m, _("Mesh"));
+
+  /* Compute geometric quantities related to the mesh */
+
+  cs_mesh_quantities_free_all(mq);
+  cs_mesh_quantities_compute(m, mq);
+
+  cs_mesh_bad_cells_detect(m, mq);
+  cs_user_mesh_bad_cells_tag(m, mq);
+
+  cs_ext_neighborhood_reduce(m, mq);
+
+  /* Initialize selectors and locations for the mesh */
+
+  cs_mesh_init_selectors();
+  cs_mesh_location_build(m, -1);
+  cs_volume_zone_build_all(true);
+  cs_boundary_zone_build_all(true);
+
+  /* Update Fortran mesh sizes and quantities */
+
+  cs_preprocess_mesh_update_fortran();
+
+  /* Update gradient and linear algebra APIs relative to mesh */
+
+  cs_gradient_free_quantities();
+  cs_cell_to_vertex_free();
+  cs_mesh_adjacencies_update_mesh();
+
+  cs_gradient_perio_update_mesh();
+  cs_matrix_update_mesh();
+
+  cs_timer_stats_switch(t_top_id);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Update fortran arrays relative to the global mesh.
@@ -102,6 +102,21 @@ cs_preprocess_mesh_selected_b_faces_ignore(cs_mesh_t             *m,
                                            cs_lnum_t              n_faces,
                                            const cs_lnum_t        face_ids[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update mesh-dependent structures after the mesh has been modified
+ *        or redistributed during a computation.
+ *
+ * The mesh connectivity, halo and auxiliary structures are assumed to be
+ * already built (and the mesh builder destroyed). Numbering, group classes,
+ * quantities, selectors, locations and zones are rebuilt, Fortran mappings
+ * are updated, and mesh-based linear algebra structures are reset.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_preprocess_mesh_update_runtime(void);
+
 /*----------------------------------------------------------------------------
  * Update fortran arrays relative to the global mesh.
  *----------------------------------------------------------------------------*/
@@ -48,6 +48,10 @@
 #include <mpi.h>
 #endif
 
+#if defined(HAVE_PTHREAD)
+#include <pthread.h>
+#endif
+
 /*----------------------------------------------------------------------------
  * Local headers
  *----------------------------------------------------------------------------*/
@@ -97,6 +101,13 @@ BEGIN_C_DECLS
  * Local macro definitions
  *============================================================================*/
 
+/* Asynchronous checkpointing requires POSIX threads, and OpenMP locks
+   for thread-safe memory management */
+
+#if defined(HAVE_PTHREAD) && defined(HAVE_OPENMP)
+#define CS_RESTART_HAVE_ASYNC 1
+#endif
+
 /*============================================================================
  * Local type definitions
  *============================================================================*/
@@ -128,6 +139,15 @@ struct _cs_restart_t {
 
   cs_restart_mode_t  mode;           /* Read or write */
 
+#if defined(HAVE_MPI)
+  MPI_Comm           comm;           /* Associated MPI communicator */
+#endif
+
+  struct _cs_restart_t  *shadow;     /* In asynchronous write mode,
+                                        structure used by the background
+                                        thread (with the actual file
+                                        handle), or NULL */
+
 };
 
 typedef struct {
@@ -145,6 +165,45 @@ typedef struct {
 
 } _restart_multiwriter_t;
 
+#if defined(CS_RESTART_HAVE_ASYNC)
+
+/* Type of operation queued for asynchronous checkpointing */
+
+typedef enum {
+
+  CS_RESTART_ASYNC_OPEN,       /* Open file */
+  CS_RESTART_ASYNC_LOCATION,   /* Add location */
+  CS_RESTART_ASYNC_SECTION,    /* Write section */
+  CS_RESTART_ASYNC_CLOSE       /* Close file and rename it */
+
+} _async_op_type_t;
+
+/* Operation queued for asynchronous checkpointing
+   (with private copies of all referenced data) */
+
+typedef struct _async_op_t {
+
+  _async_op_type_t        type;             /* Operation type */
+  cs_restart_t           *r;                /* Associated background
+                                               restart structure */
+
+  char                   *name;             /* Section or location name,
+                                               or final file name */
+  int                     location_id;      /* Section location id */
+  int                     n_location_vals;  /* Values per location entity */
+  cs_restart_val_type_t   val_type;         /* Section value type */
+  void                   *val;              /* Staged section values */
+
+  cs_gnum_t               n_glob_ents;      /* Location global size */
+  cs_lnum_t               n_ents;           /* Location local size */
+  cs_gnum_t              *ent_global_num;   /* Location global numbers */
+
+  struct _async_op_t     *next;             /* Next queued operation */
+
+} _async_op_t;
+
+#endif /* defined(CS_RESTART_HAVE_ASYNC) */
+
 /*============================================================================
  * Prototypes for private functions
  *============================================================================*/
@@ -185,6 +244,10 @@ static const char _dir_separator = '\\';
 static const char _dir_separator = '/';
 #endif
 
+/* Checkpoint file header */
+
+static const char _magic_string[] = "Checkpoint / restart, R0";
+
 /* Monitoring info */
 
 static int    _restart_n_opens[2] = {0, 0};
@@ -207,6 +270,9 @@ static double _checkpoint_wt_interval = -1.; /* wall-clock interval */
 static double _checkpoint_wt_next = -1.;     /* next forced wall-clock value */
 static double _checkpoint_wt_last = 0.;      /* wall-clock time of last
                                                 checkpointing */
+static int    _checkpoint_async = 0;         /* asynchronous write mode */
+static cs_io_codec_t  _checkpoint_codec = CS_IO_CODEC_NONE; /* compression */
+
 /* Are we restarting from a NCFD file ? */
 
 static int    _restart_from_ncfd = 0;
@@ -228,6 +294,34 @@ static int                       _n_restart_directories_to_write = 1;
 static int                       _n_restart_multiwriters          = 0;
 static _restart_multiwriter_t  **_restart_multiwriter             = NULL;
 
+/* Asynchronous checkpointing (single background thread, with operations
+   processed in order; counters are used to wait for completion of all
+   operations queued up to a given point) */
+
+#if defined(CS_RESTART_HAVE_ASYNC)
+
+static bool              _async_active = false;
+static bool              _async_stop = false;
+static pthread_t         _async_thread;
+static pthread_mutex_t   _async_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t    _async_queued = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t    _async_done = PTHREAD_COND_INITIALIZER;
+
+static _async_op_t      *_async_head = NULL;
+static _async_op_t      *_async_tail = NULL;
+static long long         _async_n_queued = 0;   /* operations queued */
+static long long         _async_n_done = 0;     /* operations completed */
+static long long         _async_n_prev = 0;     /* operations queued before
+                                                   end of last checkpoint */
+
+#if defined(HAVE_MPI)
+static int               _async_rank_step = 1;
+static MPI_Comm          _async_comm = MPI_COMM_NULL;
+static MPI_Comm          _async_block_comm = MPI_COMM_NULL;
+#endif
+
+#endif /* defined(CS_RESTART_HAVE_ASYNC) */
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -336,7 +430,6 @@ _add_file(cs_restart_t  *r)
   double timing[2];
   cs_file_access_t method;
 
-  const char magic_string[] = "Checkpoint / restart, R0";
   const long echo = CS_IO_ECHO_NONE;
 
   timing[0] = cs_timer_wtime();
@@ -359,7 +452,7 @@ _add_file(cs_restart_t  *r)
     if (r->mode == CS_RESTART_MODE_READ) {
       cs_file_get_default_access(CS_FILE_MODE_READ, &method, &hints);
       r->fh = cs_io_initialize_with_index(r->name,
-                                          magic_string,
+                                          _magic_string,
                                           method,
                                           echo,
                                           hints,
@@ -370,7 +463,7 @@ _add_file(cs_restart_t  *r)
     else {
       cs_file_get_default_access(CS_FILE_MODE_WRITE, &method, &hints);
       r->fh = cs_io_initialize(r->name,
-                               magic_string,
+                               _magic_string,
                                CS_IO_MODE_WRITE,
                                method,
                                echo,
@@ -384,7 +477,7 @@ _add_file(cs_restart_t  *r)
     if (r->mode == CS_RESTART_MODE_READ) {
       cs_file_get_default_access(CS_FILE_MODE_READ, &method);
       r->fh = cs_io_initialize_with_index(r->name,
-                                          magic_string,
+                                          _magic_string,
                                           method,
                                           echo);
       _locations_from_index(r);
@@ -392,7 +485,7 @@ _add_file(cs_restart_t  *r)
     else {
       cs_file_get_default_access(CS_FILE_MODE_WRITE, &method);
       r->fh = cs_io_initialize(r->name,
-                               magic_string,
+                               _magic_string,
                                CS_IO_MODE_WRITE,
                                method,
                                echo);
@@ -400,6 +493,9 @@ _add_file(cs_restart_t  *r)
   }
 #endif
 
+  if (r->mode == CS_RESTART_MODE_WRITE)
+    cs_io_set_codec(r->fh, _checkpoint_codec);
+
   timing[1] = cs_timer_wtime();
   _restart_wtime[r->mode] += timing[1] - timing[0];
 
@@ -568,7 +664,7 @@ _write_ent_values(const cs_restart_t     *r,
                                    r->min_block_size / nbr_byte_ent,
                                    n_glob_ents);
 
-  d = cs_part_to_block_create_by_gnum(cs_glob_mpi_comm,
+  d = cs_part_to_block_create_by_gnum(r->comm,
                                       bi,
                                       n_ents,
                                       ent_global_num);
@@ -1748,6 +1844,515 @@ _restart_multiwriter_increment(_restart_multiwriter_t  *mw,
   strcpy(mw->prev_files[mw->n_prev_files - 1], fname);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free structure associated with a restart file (closing the file).
+ *
+ * \param[in, out]  restart  pointer to restart file structure pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_free_restart(cs_restart_t  **restart)
+{
+  cs_restart_t *r = *restart;
+
+  if (r->fh != NULL)
+    cs_io_finalize(&(r->fh));
+
+  /* Free locations array */
+
+  if (r->n_locations > 0) {
+    size_t loc_id;
+    for (loc_id = 0; loc_id < r->n_locations; loc_id++) {
+      BFT_FREE((r->location[loc_id]).name);
+      BFT_FREE((r->location[loc_id])._ent_global_num);
+    }
+  }
+  if (r->location != NULL)
+    BFT_FREE(r->location);
+
+  /* Free remaining memory */
+
+  BFT_FREE(r->name);
+
+  BFT_FREE(*restart);
+}
+
+#if defined(CS_RESTART_HAVE_ASYNC)
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Create an operation for asynchronous checkpointing.
+ *
+ * \param[in]  type  operation type
+ * \param[in]  r     associated background restart structure
+ *
+ * \return  pointer to the allocated operation
+ */
+/*----------------------------------------------------------------------------*/
+
+static _async_op_t *
+_async_op_create(_async_op_type_t   type,
+                 cs_restart_t      *r)
+{
+  _async_op_t *op = NULL;
+  BFT_MALLOC(op, 1, _async_op_t);
+
+  op->type = type;
+  op->r = r;
+
+  op->name = NULL;
+  op->location_id = 0;
+  op->n_location_vals = 0;
+  op->val_type = CS_TYPE_char;
+  op->val = NULL;
+
+  op->n_glob_ents = 0;
+  op->n_ents = 0;
+  op->ent_global_num = NULL;
+
+  op->next = NULL;
+
+  return op;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Append an operation to the asynchronous checkpointing queue.
+ *
+ * \param[in]  op  pointer to operation (ownership is transferred)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_async_queue(_async_op_t  *op)
+{
+  pthread_mutex_lock(&_async_mutex);
+
+  if (_async_tail != NULL)
+    _async_tail->next = op;
+  else
+    _async_head = op;
+  _async_tail = op;
+
+  _async_n_queued += 1;
+
+  pthread_cond_signal(&_async_queued);
+
+  pthread_mutex_unlock(&_async_mutex);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Wait for completion of a given number of queued operations.
+ *
+ * \param[in]  n_ops  number of operations (counted from the start)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_async_wait(long long  n_ops)
+{
+  pthread_mutex_lock(&_async_mutex);
+  while (_async_n_done < n_ops)
+    pthread_cond_wait(&_async_done, &_async_mutex);
+  pthread_mutex_unlock(&_async_mutex);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Run a queued operation (called from the background thread).
+ *
+ * \param[in, out]  op  pointer to operation
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_async_op_run(_async_op_t  *op)
+{
+  cs_restart_t *r = op->r;
+
+  switch(op->type) {
+
+  case CS_RESTART_ASYNC_OPEN:
+    {
+      cs_file_access_t method;
+
+#if defined(HAVE_MPI)
+      MPI_Info  hints;
+      cs_file_get_default_access(CS_FILE_MODE_WRITE, &method, &hints);
+      r->fh = cs_io_initialize(r->name,
+                               _magic_string,
+                               CS_IO_MODE_WRITE,
+                               method,
+                               CS_IO_ECHO_NONE,
+                               hints,
+                               _async_block_comm,
+                               _async_comm);
+#else
+      cs_file_get_default_access(CS_FILE_MODE_WRITE, &method);
+      r->fh = cs_io_initialize(r->name,
+                               _magic_string,
+                               CS_IO_MODE_WRITE,
+                               method,
+                               CS_IO_ECHO_NONE);
+#endif
+      cs_io_set_codec(r->fh, _checkpoint_codec);
+    }
+    break;
+
+  case CS_RESTART_ASYNC_LOCATION:
+    {
+      cs_datatype_t gnum_type
+        = (sizeof(cs_gnum_t) == 8) ? CS_UINT64 : CS_UINT32;
+
+      r->n_locations += 1;
+      BFT_REALLOC(r->location, r->n_locations, _location_t);
+
+      _location_t  *loc = r->location + r->n_locations - 1;
+
+      loc->name = op->name;
+      loc->id = r->n_locations;
+      loc->n_glob_ents = op->n_glob_ents;
+      loc->n_glob_ents_f = op->n_glob_ents;
+      loc->n_ents = op->n_ents;
+      loc->ent_global_num = op->ent_global_num;
+      loc->_ent_global_num = op->ent_global_num;
+
+      op->name = NULL;
+      op->ent_global_num = NULL;
+
+      cs_io_write_global(loc->name, 1, r->n_locations, 0, 0,
+                         gnum_type, &(loc->n_glob_ents),
+                         r->fh);
+    }
+    break;
+
+  case CS_RESTART_ASYNC_SECTION:
+    _write_section(r,
+                   NULL,
+                   op->name,
+                   op->location_id,
+                   op->n_location_vals,
+                   op->val_type,
+                   op->val);
+    break;
+
+  case CS_RESTART_ASYNC_CLOSE:
+    {
+      /* Close file, then move it to its final name,
+         so that only complete checkpoint files are seen */
+
+      cs_io_finalize(&(r->fh));
+
+      if (cs_glob_rank_id < 1) {
+        if (rename(r->name, op->name) != 0)
+          bft_error(__FILE__, __LINE__, errno,
+                    _("Error renaming checkpoint file \"%s\" to \"%s\"."),
+                    r->name, op->name);
+      }
+
+#if defined(HAVE_MPI)
+      if (_async_comm != MPI_COMM_NULL)
+        MPI_Barrier(_async_comm);
+#endif
+
+      _free_restart(&r);
+      op->r = NULL;
+    }
+    break;
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Main function of the asynchronous checkpointing thread.
+ *
+ * \param[in]  arg  unused
+ *
+ * \return  NULL pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+static void *
+_async_thread_main(void  *arg)
+{
+  CS_UNUSED(arg);
+
+  pthread_mutex_lock(&_async_mutex);
+
+  while (true) {
+
+    while (_async_head == NULL && _async_stop == false)
+      pthread_cond_wait(&_async_queued, &_async_mutex);
+
+    _async_op_t *op = _async_head;
+
+    if (op == NULL)
+      break;
+
+    pthread_mutex_unlock(&_async_mutex);
+
+    _async_op_run(op);
+
+    BFT_FREE(op->name);
+    BFT_FREE(op->val);
+    BFT_FREE(op->ent_global_num);
+
+    pthread_mutex_lock(&_async_mutex);
+
+    _async_head = op->next;
+    if (_async_head == NULL)
+      _async_tail = NULL;
+    _async_n_done += 1;
+
+    BFT_FREE(op);
+
+    pthread_cond_broadcast(&_async_done);
+
+  }
+
+  pthread_mutex_unlock(&_async_mutex);
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Start the asynchronous checkpointing thread if possible.
+ *
+ * In parallel, MPI calls are made concurrently by the background thread,
+ * so asynchronous mode is only used if MPI_THREAD_MULTIPLE is supported.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_async_start(void)
+{
+#if defined(HAVE_MPI)
+  if (cs_glob_mpi_comm != MPI_COMM_NULL) {
+
+    int thread_level = MPI_THREAD_SINGLE;
+    MPI_Query_thread(&thread_level);
+    if (thread_level < MPI_THREAD_MULTIPLE)
+      return;
+
+    /* Use separate communicators so that collective operations of the
+       background thread do not interfere with others */
+
+    cs_file_get_default_comm(&_async_rank_step, NULL, NULL, NULL);
+
+    MPI_Comm_dup(cs_glob_mpi_comm, &_async_comm);
+    _async_block_comm = cs_file_block_comm(_async_rank_step, _async_comm);
+
+  }
+#endif
+
+  _async_stop = false;
+
+  bft_mem_background_threads_add(1);
+
+  int retval = pthread_create(&_async_thread, NULL, _async_thread_main, NULL);
+
+  if (retval != 0)
+    bft_error(__FILE__, __LINE__, retval,
+              _("Error creating asynchronous checkpoint thread."));
+
+  _async_active = true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Complete pending asynchronous checkpoint operations and stop
+ *         the associated thread.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_async_finalize(void)
+{
+  if (_async_active == false)
+    return;
+
+  pthread_mutex_lock(&_async_mutex);
+  _async_stop = true;
+  pthread_cond_signal(&_async_queued);
+  pthread_mutex_unlock(&_async_mutex);
+
+  pthread_join(_async_thread, NULL);
+
+  bft_mem_background_threads_add(-1);
+
+#if defined(HAVE_MPI)
+  if (_async_block_comm != MPI_COMM_NULL)
+    MPI_Comm_free(&_async_block_comm);
+  if (_async_comm != MPI_COMM_NULL)
+    MPI_Comm_free(&_async_comm);
+#endif
+
+  _async_active = false;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Create the structure used by the background thread for a restart
+ *         file in asynchronous write mode, and queue opening of the file.
+ *
+ * The file is written under a temporary name, and renamed on completion.
+ *
+ * \param[in]  r  associated restart file structure
+ *
+ * \return  pointer to the background restart structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_restart_t *
+_async_shadow_create(const cs_restart_t  *r)
+{
+  const char _tmp_extension[] = ".tmp";
+
+  cs_restart_t *shadow = NULL;
+  BFT_MALLOC(shadow, 1, cs_restart_t);
+
+  BFT_MALLOC(shadow->name, strlen(r->name) + strlen(_tmp_extension) + 1, char);
+  strcpy(shadow->name, r->name);
+  strcat(shadow->name, _tmp_extension);
+
+  shadow->fh = NULL;
+  shadow->rank_step = 1;
+  shadow->min_block_size = 0;
+
+#if defined(HAVE_MPI)
+  if (_async_comm != MPI_COMM_NULL) {
+    cs_file_get_default_comm(NULL, &(shadow->min_block_size), NULL, NULL);
+    shadow->rank_step = _async_rank_step;
+  }
+#endif
+
+  shadow->n_locations = 0;
+  shadow->location = NULL;
+
+  shadow->mode = CS_RESTART_MODE_WRITE;
+
+#if defined(HAVE_MPI)
+  shadow->comm = _async_comm;
+#endif
+
+  shadow->shadow = NULL;
+
+  _async_queue(_async_op_create(CS_RESTART_ASYNC_OPEN, shadow));
+
+  return shadow;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Queue addition of a location in asynchronous write mode.
+ *
+ * \param[in]  r               associated restart file structure
+ * \param[in]  location_name   name associated with the location
+ * \param[in]  n_glob_ents     global number of entities
+ * \param[in]  n_ents          local number of entities
+ * \param[in]  ent_global_num  global entity numbers, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_async_add_location(cs_restart_t     *r,
+                    const char       *location_name,
+                    cs_gnum_t         n_glob_ents,
+                    cs_lnum_t         n_ents,
+                    const cs_gnum_t  *ent_global_num)
+{
+  _async_op_t *op = _async_op_create(CS_RESTART_ASYNC_LOCATION, r->shadow);
+
+  BFT_MALLOC(op->name, strlen(location_name) + 1, char);
+  strcpy(op->name, location_name);
+
+  op->n_glob_ents = n_glob_ents;
+  op->n_ents = n_ents;
+
+  /* Global numbers may change (for example if the mesh is modified)
+     before the section is actually written, so they are copied */
+
+  if (ent_global_num != NULL) {
+    BFT_MALLOC(op->ent_global_num, n_ents, cs_gnum_t);
+    memcpy(op->ent_global_num, ent_global_num, n_ents*sizeof(cs_gnum_t));
+  }
+
+  _async_queue(op);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Queue writing of a section in asynchronous write mode.
+ *
+ * Values are copied to a staging buffer, so the caller may modify them
+ * as soon as this function returns.
+ *
+ * \param[in]  r                associated restart file structure
+ * \param[in]  sec_name         section name
+ * \param[in]  location_id      id of corresponding location
+ * \param[in]  n_location_vals  number of values per location (interlaced)
+ * \param[in]  val_type         value type
+ * \param[in]  val              array of values
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_async_write_section(cs_restart_t           *r,
+                     const char             *sec_name,
+                     int                     location_id,
+                     int                     n_location_vals,
+                     cs_restart_val_type_t   val_type,
+                     const void             *val)
+{
+  size_t n_vals = n_location_vals;
+  size_t elt_size = 0;
+
+  if (location_id > 0) {
+    assert(location_id <= (int)(r->n_locations));
+    n_vals *= (r->location[location_id-1]).n_ents;
+  }
+
+  switch (val_type) {
+  case CS_TYPE_char:
+    elt_size = 1;
+    break;
+  case CS_TYPE_int:
+    elt_size = sizeof(int);
+    break;
+  case CS_TYPE_cs_gnum_t:
+    elt_size = sizeof(cs_gnum_t);
+    break;
+  case CS_TYPE_cs_real_t:
+    elt_size = sizeof(cs_real_t);
+    break;
+  default:
+    assert(0);
+  }
+
+  _async_op_t *op = _async_op_create(CS_RESTART_ASYNC_SECTION, r->shadow);
+
+  BFT_MALLOC(op->name, strlen(sec_name) + 1, char);
+  strcpy(op->name, sec_name);
+
+  op->location_id = location_id;
+  op->n_location_vals = n_location_vals;
+  op->val_type = val_type;
+
+  if (n_vals*elt_size > 0) {
+    BFT_MALLOC(op->val, n_vals*elt_size, unsigned char);
+    memcpy(op->val, val, n_vals*elt_size);
+  }
+
+  _async_queue(op);
+}
+
+#endif /* defined(CS_RESTART_HAVE_ASYNC) */
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1911,6 +2516,62 @@ cs_restart_checkpoint_set_mesh_mode(int  mode)
   _checkpoint_mesh = mode;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define checkpoint write mode.
+ *
+ * In asynchronous mode, values written to checkpoint files are copied to
+ * staging buffers, and files are written by a background thread, so that
+ * the computation may resume without waiting for the actual output.
+ * Files are written under a temporary name, and renamed on completion,
+ * so that incomplete files are never present under the final name.
+ * At most one checkpoint is in progress: when a checkpoint file is
+ * created, writing of the previous checkpoint's files is completed first.
+ *
+ * Asynchronous mode requires POSIX threads and, in parallel,
+ * MPI_THREAD_MULTIPLE support (requested at MPI initialization only
+ * when the CS_MPI_THREAD_MULTIPLE environment variable is set to 1);
+ * it is ignored otherwise, or if a user-defined section write function
+ * is set.
+ *
+ * \param[in]  mode  if 0, write checkpoint files synchronously (default)
+ *                   if 1, write checkpoint files asynchronously
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_async_mode(int  mode)
+{
+  _checkpoint_async = mode;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define checkpoint file compression mode.
+ *
+ * When compression is active, sections written by blocks (i.e. values
+ * defined on mesh locations) are split in chunks whose values are
+ * byte-shuffled and losslessly compressed. Compressed files are read
+ * transparently, possibly with a different number of ranks.
+ *
+ * \param[in]  mode  if 0, do not compress (default)
+ *                   if 1, use built-in byte shuffle + run-length coding
+ *                   if 2, use byte shuffle + deflate (zlib), or mode 1
+ *                   if zlib is not available
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_compression(int  mode)
+{
+  _checkpoint_codec = CS_IO_CODEC_NONE;
+
+  if (mode == 1)
+    _checkpoint_codec = CS_IO_CODEC_SHUFFLE_RLE;
+  else if (mode > 1)
+    _checkpoint_codec = CS_IO_CODEC_SHUFFLE_ZLIB;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Define last forced checkpoint time step.
@@ -2051,6 +2712,13 @@ cs_restart_checkpoint_done(const cs_time_step_t  *ts)
 {
   assert(ts != NULL);
 
+  /* All files of this checkpoint have been queued in asynchronous mode */
+
+#if defined(CS_RESTART_HAVE_ASYNC)
+  if (_async_active)
+    _async_n_prev = _async_n_queued;
+#endif
+
   double t = ts->t_cur - ts->t_prev;
 
   if (_checkpoint_nt_next >= 0 && _checkpoint_nt_next <= ts->nt_cur)
@@ -2127,6 +2795,30 @@ cs_restart_create(const char         *name,
 
   const cs_mesh_t  *mesh = cs_glob_mesh;
 
+#if defined(CS_RESTART_HAVE_ASYNC)
+
+  bool use_async = false;
+
+  /* In asynchronous mode, at most one checkpoint may be in progress,
+     so complete writing of the previous one first (also ensuring that
+     previous files are present for the rotation below) */
+
+  if (   mode == CS_RESTART_MODE_WRITE
+      && _checkpoint_async > 0
+      && _write_section_f == _write_section) {
+    if (_async_active == false)
+      _async_start();
+    if (_async_active) {
+      use_async = true;
+      timing[0] = cs_timer_wtime();
+      _async_wait(_async_n_prev);
+      timing[1] = cs_timer_wtime();
+      _restart_wtime[mode] += timing[1] - timing[0];
+    }
+  }
+
+#endif
+
   /* Ensure mesh checkpoint is updated on first call */
 
   if (    mode == CS_RESTART_MODE_WRITE
@@ -2253,14 +2945,28 @@ cs_restart_create(const char         *name,
   restart->rank_step = 1;
   restart->min_block_size = 0;
 
+#if defined(HAVE_MPI)
+  restart->comm = cs_glob_mpi_comm;
+#endif
+
+  restart->shadow = NULL;
+
   /* Initialize location data */
 
   restart->n_locations = 0;
   restart->location = NULL;
 
-  /* Open associated file, and build an index of sections in read mode */
+  /* Open associated file, and build an index of sections in read mode
+     (in asynchronous mode, the file is opened by the background thread) */
 
-  _add_file(restart);
+#if defined(CS_RESTART_HAVE_ASYNC)
+  if (use_async) {
+    restart->shadow = _async_shadow_create(restart);
+    _restart_n_opens[mode] += 1;
+  }
+  else
+#endif
+    _add_file(restart);
 
   /* Add basic location definitions */
 
@@ -2306,26 +3012,20 @@ cs_restart_destroy(cs_restart_t  **restart)
 
   mode = r->mode;
 
-  if (r->fh != NULL)
-    cs_io_finalize(&(r->fh));
-
-  /* Free locations array */
+  /* In asynchronous mode, the file is closed (and renamed) once
+     all queued sections are written */
 
-  if (r->n_locations > 0) {
-    size_t loc_id;
-    for (loc_id = 0; loc_id < r->n_locations; loc_id++) {
-      BFT_FREE((r->location[loc_id]).name);
-      BFT_FREE((r->location[loc_id])._ent_global_num);
-    }
+#if defined(CS_RESTART_HAVE_ASYNC)
+  if (r->shadow != NULL) {
+    _async_op_t *op = _async_op_create(CS_RESTART_ASYNC_CLOSE, r->shadow);
+    BFT_MALLOC(op->name, strlen(r->name) + 1, char);
+    strcpy(op->name, r->name);
+    _async_queue(op);
+    r->shadow = NULL;
   }
-  if (r->location != NULL)
-    BFT_FREE(r->location);
-
-  /* Free remaining memory */
-
-  BFT_FREE(r->name);
+#endif
 
-  BFT_FREE(*restart);
+  _free_restart(restart);
 
   timing[1] = cs_timer_wtime();
   _restart_wtime[mode] += timing[1] - timing[0];
@@ -2471,9 +3171,15 @@ cs_restart_add_location(cs_restart_t     *restart,
     (restart->location[restart->n_locations-1]).ent_global_num = ent_global_num;
     (restart->location[restart->n_locations-1])._ent_global_num = NULL;
 
-    cs_io_write_global(location_name, 1, restart->n_locations, 0, 0,
-                       gnum_type, &n_glob_ents,
-                       restart->fh);
+#if defined(CS_RESTART_HAVE_ASYNC)
+    if (restart->shadow != NULL)
+      _async_add_location(restart, location_name,
+                          n_glob_ents, n_ents, ent_global_num);
+    else
+#endif
+      cs_io_write_global(location_name, 1, restart->n_locations, 0, 0,
+                         gnum_type, &n_glob_ents,
+                         restart->fh);
 
     timing[1] = cs_timer_wtime();
     _restart_wtime[restart->mode] += timing[1] - timing[0];
@@ -2821,13 +3527,23 @@ cs_restart_write_section(cs_restart_t           *restart,
 
   assert(restart != NULL);
 
-  _write_section_f(restart,
-                   _restart_context,
-                   sec_name,
-                   location_id,
-                   n_location_vals,
-                   val_type,
-                   val);
+#if defined(CS_RESTART_HAVE_ASYNC)
+  if (restart->shadow != NULL)
+    _async_write_section(restart,
+                         sec_name,
+                         location_id,
+                         n_location_vals,
+                         val_type,
+                         val);
+  else
+#endif
+    _write_section_f(restart,
+                     _restart_context,
+                     sec_name,
+                     location_id,
+                     n_location_vals,
+                     val_type,
+                     val);
 
   timing[1] = cs_timer_wtime();
   _restart_wtime[restart->mode] += timing[1] - timing[0];
@@ -4104,6 +4820,12 @@ cs_restart_clean_multiwriters_history(void)
 void
 cs_restart_multiwriters_destroy_all(void)
 {
+  /* Complete asynchronous checkpointing if active */
+
+#if defined(CS_RESTART_HAVE_ASYNC)
+  _async_finalize();
+#endif
+
   if (_restart_multiwriter != NULL) {
     for (int i = 0; i < _n_restart_multiwriters; i++) {
       _restart_multiwriter_t *w = _restart_multiwriter[i];
@@ -314,6 +314,51 @@ cs_restart_checkpoint_set_defaults(int     nt_interval,
 void
 cs_restart_checkpoint_set_mesh_mode(int  mode);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define checkpoint write mode.
+ *
+ * In asynchronous mode, values written to checkpoint files are copied to
+ * staging buffers, and files are written by a background thread, so that
+ * the computation may resume without waiting for the actual output.
+ * Files are written under a temporary name, and renamed on completion,
+ * so that incomplete files are never present under the final name.
+ * At most one checkpoint is in progress: when a checkpoint file is
+ * created, writing of the previous checkpoint's files is completed first.
+ *
+ * Asynchronous mode requires POSIX threads and, in parallel,
+ * MPI_THREAD_MULTIPLE support (requested at MPI initialization only
+ * when the CS_MPI_THREAD_MULTIPLE environment variable is set to 1);
+ * it is ignored otherwise, or if a user-defined section write function
+ * is set.
+ *
+ * \param[in]  mode  if 0, write checkpoint files synchronously (default)
+ *                   if 1, write checkpoint files asynchronously
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_async_mode(int  mode);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define checkpoint file compression mode.
+ *
+ * When compression is active, sections written by blocks (i.e. values
+ * defined on mesh locations) are split in chunks whose values are
+ * byte-shuffled and losslessly compressed. Compressed files are read
+ * transparently, possibly with a different number of ranks.
+ *
+ * \param[in]  mode  if 0, do not compress (default)
+ *                   if 1, use built-in byte shuffle + run-length coding
+ *                   if 2, use byte shuffle + deflate (zlib), or mode 1
+ *                   if zlib is not available
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_compression(int  mode);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Define last forced checkpoint time step.
@@ -99,6 +99,13 @@ static cs_restart_read_section_t   *_read_section_f  = NULL;
 
 static  ple_locator_t  *_locator = NULL;  /* PLE locator for restart */
 
+/* Conservative mapping: previous cell centers located in current mesh,
+   and previous cell volumes */
+
+static bool            _conservative = false;
+static ple_locator_t  *_locator_r = NULL;
+static cs_real_t      *_src_cell_vol = NULL;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -189,6 +196,86 @@ _interpolate_p0(ple_locator_t          *locator,
   BFT_FREE(send_var);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Replace cell values by the volume-weighted mean of source cell
+ *        values whose centers are located in each cell.
+ *
+ * Cells containing no source cell center keep their value.
+ *
+ * \param[in]       n_location_vals  number of values per location (interlaced)
+ * \param[in]       val_src          array of source values
+ * \param[in, out]  val              array of values
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_remap_conservative(int               n_location_vals,
+                    const cs_real_t  *val_src,
+                    cs_real_t        *val)
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const int stride = n_location_vals + 1;
+
+  /* Send volume-weighted values and volumes of located source cells */
+
+  const ple_lnum_t n_interior = ple_locator_get_n_interior(_locator_r);
+  const ple_lnum_t *interior_list = ple_locator_get_interior_list(_locator_r);
+
+  cs_real_t *send_var;
+  BFT_MALLOC(send_var, n_interior*stride, cs_real_t);
+
+  for (ple_lnum_t i = 0; i < n_interior; i++) {
+    const cs_lnum_t s_id = interior_list[i];
+    const cs_real_t vol = _src_cell_vol[s_id];
+    for (int j = 0; j < n_location_vals; j++)
+      send_var[i*stride + j] = vol * val_src[s_id*n_location_vals + j];
+    send_var[i*stride + n_location_vals] = vol;
+  }
+
+  size_t  n_dist = ple_locator_get_n_dist_points(_locator_r);
+  const cs_lnum_t  *dist_loc = ple_locator_get_dist_locations(_locator_r);
+
+  cs_real_t *recv_var;
+  BFT_MALLOC(recv_var, n_dist*stride, cs_real_t);
+
+  ple_locator_exchange_point_var(_locator_r,
+                                 recv_var,
+                                 send_var,
+                                 NULL,
+                                 sizeof(cs_real_t),
+                                 stride,
+                                 1);
+
+  BFT_FREE(send_var);
+
+  /* Sum contributions in each cell */
+
+  cs_real_t *sum;
+  BFT_MALLOC(sum, n_cells*stride, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_cells*stride; i++)
+    sum[i] = 0.;
+
+  for (size_t i = 0; i < n_dist; i++) {
+    const cs_lnum_t c_id = dist_loc[i];
+    for (int j = 0; j < stride; j++)
+      sum[c_id*stride + j] += recv_var[i*stride + j];
+  }
+
+  BFT_FREE(recv_var);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    const cs_real_t vol = sum[c_id*stride + n_location_vals];
+    if (vol > 0) {
+      for (int j = 0; j < n_location_vals; j++)
+        val[c_id*n_location_vals + j] = sum[c_id*stride + j] / vol;
+    }
+  }
+
+  BFT_FREE(sum);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Read a section with interpolation.
@@ -252,12 +339,17 @@ _read_section_interpolate(cs_restart_t           *restart,
                              val_type,
                              read_buffer);
 
-    if (retval == CS_RESTART_SUCCESS)
+    if (retval == CS_RESTART_SUCCESS) {
       _interpolate_p0(_locator,
                       n_location_vals,
                       val_type,
                       read_buffer,
                       val);
+      if (_locator_r != NULL && val_type == CS_TYPE_cs_real_t)
+        _remap_conservative(n_location_vals,
+                            (const cs_real_t *)read_buffer,
+                            val);
+    }
 
     BFT_FREE(read_buffer);
   }
@@ -312,6 +404,26 @@ cs_restart_map_set_options(float  tolerance_base,
   _tolerance[1] = tolerance_fraction;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Indicate whether cell values should be mapped conservatively.
+ *
+ * When active, each cell of the current mesh containing the centers of one
+ * or more cells of the previous mesh takes the volume-weighted mean of
+ * their values, so that cell integrals are preserved when previous cells
+ * are merged. Other cells (such as those obtained by splitting a previous
+ * cell) use the value at their center. This applies to real values only.
+ *
+ * \param[in]  conservative  true for conservative mapping of cell values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_map_set_conservative(bool  conservative)
+{
+  _conservative = conservative;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Build mapping of restart files to different mesh if defined.
@@ -338,6 +450,9 @@ cs_restart_map_build(void)
 
   fvm_nodal_t  *nm = NULL;
 
+  cs_lnum_t n_src_cells = 0;
+  cs_real_t *src_cell_cen = NULL;
+
   {
     /* Read mesh */
 
@@ -380,6 +495,35 @@ cs_restart_map_build(void)
 
     fvm_nodal_make_vertices_private(nm);
 
+    /* Previous cell volumes and centers for conservative mapping */
+
+    if (_conservative) {
+
+      cs_real_t  *i_face_cog = NULL, *i_face_normal = NULL;
+      cs_real_t  *b_face_cog = NULL, *b_face_normal = NULL;
+
+      cs_mesh_quantities_i_faces(m, &i_face_cog, &i_face_normal);
+      cs_mesh_quantities_b_faces(m, &b_face_cog, &b_face_normal);
+
+      n_src_cells = m->n_cells;
+      BFT_MALLOC(src_cell_cen, m->n_cells_with_ghosts*3, cs_real_t);
+
+      cs_mesh_quantities_cell_faces_cog(m,
+                                        i_face_normal,
+                                        i_face_cog,
+                                        b_face_normal,
+                                        b_face_cog,
+                                        src_cell_cen);
+
+      BFT_FREE(b_face_normal);
+      BFT_FREE(b_face_cog);
+      BFT_FREE(i_face_normal);
+      BFT_FREE(i_face_cog);
+
+      _src_cell_vol = cs_mesh_quantities_cell_volume(m);
+
+    }
+
     /* Destroy temporary mesh structures */
 
     cs_glob_mesh = m;
@@ -428,6 +572,46 @@ cs_restart_map_build(void)
 
   nm = fvm_nodal_destroy(nm);
 
+  /* For conservative mapping, also locate previous cell centers
+     in the current mesh */
+
+  if (_conservative) {
+
+    nm = cs_mesh_connect_cells_to_nodal(m_c,
+                                        "restart_mesh_current",
+                                        false,
+                                        m_c->n_cells,
+                                        NULL);
+
+#if defined(PLE_HAVE_MPI)
+    _locator_r = ple_locator_create(cs_glob_mpi_comm,
+                                    cs_glob_n_ranks,
+                                    0);
+#else
+    _locator_r = ple_locator_create();
+#endif
+
+    ple_locator_set_mesh(_locator_r,
+                         nm,
+                         options,
+                         _tolerance[0],
+                         _tolerance[1],
+                         3, /* dim */
+                         n_src_cells,
+                         NULL,
+                         NULL, /* point_tag */
+                         src_cell_cen,
+                         NULL, /* distance */
+                         cs_coupling_mesh_extents,
+                         cs_coupling_point_in_mesh_p);
+
+    ple_locator_shift_locations(_locator_r, -1);
+
+    nm = fvm_nodal_destroy(nm);
+
+    BFT_FREE(src_cell_cen);
+  }
+
 
   /* Set associated read function if not already set */
 
@@ -521,6 +705,11 @@ cs_restart_map_free(void)
   cs_log_separator(CS_LOG_PERFORMANCE);
 
   _locator = ple_locator_destroy(_locator);
+
+  if (_locator_r != NULL)
+    _locator_r = ple_locator_destroy(_locator_r);
+  BFT_FREE(_src_cell_vol);
+  _conservative = false;
 }
 
 /*----------------------------------------------------------------------------*/
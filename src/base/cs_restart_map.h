@@ -87,6 +87,23 @@ void
 cs_restart_map_set_options(float  tolerance_base,
                            float  tolerance_fraction);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Indicate whether cell values should be mapped conservatively.
+ *
+ * When active, each cell of the current mesh containing the centers of one
+ * or more cells of the previous mesh takes the volume-weighted mean of
+ * their values, so that cell integrals are preserved when previous cells
+ * are merged. Other cells (such as those obtained by splitting a previous
+ * cell) use the value at their center. This applies to real values only.
+ *
+ * \param[in]  conservative  true for conservative mapping of cell values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_map_set_conservative(bool  conservative);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Build mapping of restart files to different mesh if defined.
@@ -32,6 +32,7 @@
 
 #include <assert.h>
 #include <stdio.h>
+#include <string.h>
 
 /*----------------------------------------------------------------------------
  *  Local headers
@@ -40,6 +41,8 @@
 #include "bft_mem.h"
 #include "bft_printf.h"
 
+#include "cs_order.h"
+
 /*----------------------------------------------------------------------------
  *  Header for the current file
  *----------------------------------------------------------------------------*/
@@ -52,6 +55,15 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Minimum number of elements for which global number arrays are sorted
+   through an ordering (using radix sort) rather than in place */
+
+#define _SORT_BY_ORDER_MIN_SIZE  4096
+
 /*============================================================================
  * Local structure definitions
  *============================================================================*/
@@ -246,6 +258,46 @@ _sort_descend_tree_gnum_2(cs_gnum_t  number[],
   number[level*2+1] = num_save[1];
 }
 
+/*----------------------------------------------------------------------------
+ * Sort a strided array of global numbers lexicographically, using
+ * an ordering array, for large arrays.
+ *
+ * For large arrays, cs_order_gnum_allocated_s uses a (threaded) radix
+ * sort, so ordering and then reordering the array is faster than
+ * an in-place heapsort.
+ *
+ * parameters:
+ *   number <-> array of numbers to sort
+ *   stride <-- stride of array (number of values to compare)
+ *   n_elts <-- number of elements considered
+ *----------------------------------------------------------------------------*/
+
+static void
+_sort_gnum_by_order_s(cs_gnum_t  number[],
+                      size_t     stride,
+                      size_t     n_elts)
+{
+  cs_lnum_t *order = NULL;
+  cs_gnum_t *number_tmp = NULL;
+
+  BFT_MALLOC(order, n_elts, cs_lnum_t);
+
+  cs_order_gnum_allocated_s(NULL, number, stride, order, n_elts);
+
+  BFT_MALLOC(number_tmp, n_elts*stride, cs_gnum_t);
+
+# pragma omp parallel for  if(n_elts > CS_THR_MIN)
+  for (size_t i = 0; i < n_elts; i++) {
+    for (size_t j = 0; j < stride; j++)
+      number_tmp[i*stride + j] = number[(size_t)(order[i])*stride + j];
+  }
+
+  memcpy(number, number_tmp, n_elts*stride*sizeof(cs_gnum_t));
+
+  BFT_FREE(number_tmp);
+  BFT_FREE(order);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
@@ -778,9 +830,14 @@ cs_sort_and_compact_gnum(cs_lnum_t  n_elts,
   if (no_need)
     return n_elts;
 
+  /* Use radix-sort based ordering for large arrays */
+
+  if (n_elts >= _SORT_BY_ORDER_MIN_SIZE)
+    _sort_gnum_by_order_s(elts, 1, n_elts);
+
   /* Use shell sort for short arrays */
 
-  if (n_elts < 50) {
+  else if (n_elts < 50) {
 
     cs_lnum_t inc;
 
@@ -876,9 +933,14 @@ cs_sort_and_compact_gnum_2(cs_lnum_t  n_elts,
   if (no_need)
     return n_elts;
 
+  /* Use radix-sort based ordering for large arrays */
+
+  if (n_elts >= _SORT_BY_ORDER_MIN_SIZE)
+    _sort_gnum_by_order_s(elts, 2, n_elts);
+
   /* Use shell sort for short arrays */
 
-  if (n_elts < 50) {
+  else if (n_elts < 50) {
 
     cs_lnum_t inc;
 
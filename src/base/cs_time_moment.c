@@ -1962,6 +1962,44 @@ cs_time_moment_map_cell_dt(const cs_real_t  *dt)
   _p_dt = dt;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Transfer moment accumulators not based on fields after a mesh
+ *        redistribution.
+ *
+ * A mapped time step values array is unmapped, so the field referenced
+ * by field pointer CS_F_(dt) is used after this call.
+ *
+ * \param[in, out]  mt  pointer to mesh transfer structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_time_moment_mesh_transfer(cs_mesh_transfer_t  *mt)
+{
+  _p_dt = NULL;
+
+  for (int i = 0; i < _n_moment_wa; i++) {
+    cs_time_moment_wa_t *mwa = _moment_wa + i;
+    if (mwa->location_id != CS_MESH_LOCATION_NONE)
+      cs_mesh_transfer_array(mt,
+                             mwa->location_id,
+                             CS_REAL_TYPE,
+                             1,
+                             (void **)&(mwa->val));
+  }
+
+  for (int i = 0; i < _n_moments; i++) {
+    cs_time_moment_t *mt_i = _moment + i;
+    if (mt_i->f_id < 0 && mt_i->location_id != CS_MESH_LOCATION_NONE)
+      cs_mesh_transfer_array(mt,
+                             mt_i->location_id,
+                             CS_REAL_TYPE,
+                             mt_i->dim,
+                             (void **)&(mt_i->val));
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Update all moment accumulators.
@@ -2484,10 +2522,20 @@ cs_time_moment_log_iteration(void)
 
     /* Group MPI operations if required */
 
-    cs_parall_counter(n_g_elts, n_active_wa[1]);
-    cs_parall_min(n_active_wa[1], CS_DOUBLE, vmin);
-    cs_parall_max(n_active_wa[1], CS_DOUBLE, vmax);
-    cs_parall_sum(n_active_wa[1], CS_DOUBLE, vsum);
+    cs_parall_reduce_t *r = cs_parall_reduce_create();
+
+    cs_parall_reduce_add(r, CS_PARALL_REDUCE_SUM, CS_GNUM_TYPE,
+                         n_active_wa[1], n_g_elts);
+    cs_parall_reduce_add(r, CS_PARALL_REDUCE_MIN, CS_DOUBLE,
+                         n_active_wa[1], vmin);
+    cs_parall_reduce_add(r, CS_PARALL_REDUCE_MAX, CS_DOUBLE,
+                         n_active_wa[1], vmax);
+    cs_parall_reduce_add(r, CS_PARALL_REDUCE_SUM, CS_DOUBLE,
+                         n_active_wa[1], vsum);
+
+    cs_parall_reduce_start(r);
+    cs_parall_reduce_wait(r);
+    cs_parall_reduce_destroy(&r);
 
     /* Now log values */
 
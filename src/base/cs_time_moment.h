@@ -37,6 +37,7 @@
 
 #include "cs_base.h"
 #include "cs_field.h"
+#include "cs_mesh_transfer.h"
 #include "cs_restart.h"
 
 /*----------------------------------------------------------------------------*/
@@ -119,6 +120,20 @@ cs_time_moment_destroy_all(void);
 void
 cs_time_moment_map_cell_dt(const cs_real_t  *dt);
 
+/*----------------------------------------------------------------------------
+ * Transfer moment accumulators not based on fields after a mesh
+ * redistribution.
+ *
+ * A mapped time step values array is unmapped, so the field referenced
+ * by field pointer CS_F_(dt) is used after this call.
+ *
+ * parameters:
+ *   mt <-> pointer to mesh transfer structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_time_moment_mesh_transfer(cs_mesh_transfer_t  *mt);
+
 /*----------------------------------------------------------------------------
  * Update all moment accumulators.
  *----------------------------------------------------------------------------*/
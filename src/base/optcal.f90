@@ -886,6 +886,7 @@ module optcal
   integer, save :: ifrslb
 
   !> max of ifrslb on all ranks, standard outlet face presence indicator
+  !> (-1 if ifrslb must be searched for again, after a mesh redistribution)
   integer, save :: itbslb
 
   !> compute the hydrostatic pressure in order to compute the Dirichlet
@@ -416,6 +416,47 @@ contains
 
   !=============================================================================
 
+  ! Update mesh-based arrays and mappings after the mesh has been
+  ! redistributed (data having been transferred on the C side)
+
+  subroutine update_mesh_arrays
+
+    use, intrinsic :: iso_c_binding
+    use mesh, only: nfabor
+    use optcal, only: itbslb
+    use lagran, only: iilagr, update_lagr_arrays
+    use cs_c_bindings
+
+    implicit none
+
+    ! Local variables
+
+    type(c_ptr) :: c_itypfb, c_izfppp
+
+    ! Boundary-face related arrays
+
+    deallocate(itrifb)
+    allocate(itrifb(nfabor))
+
+    call cs_f_boundary_conditions_get_pointers(c_itypfb, c_izfppp)
+
+    call c_f_pointer(c_itypfb, itypfb, [nfabor])
+    call c_f_pointer(c_izfppp, izfppp, [nfabor])
+
+    ! Local reference outlet face must be searched for again
+
+    itbslb = -1
+
+    ! Lagrangian arrays
+
+    if (iilagr.gt.0) then
+      call update_lagr_arrays(tslagr)
+    endif
+
+  end subroutine update_mesh_arrays
+
+  !=============================================================================
+
   ! Free auxiliary arrays
 
   subroutine finalize_aux_arrays
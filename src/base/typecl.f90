@@ -470,9 +470,10 @@ enddo
 ! origin), we choose the face whose center is closest to it, so
 ! as to be mesh numbering (and partitioning) independent.
 
-if (ntcabs.eq.ntpabs+1) then
+if (ntcabs.eq.ntpabs+1 .or. itbslb.lt.0) then
 
   d0min = rinfin
+  ifrslb = 0
 
   ideb = idebty(isolib)
   ifin = ifinty(isolib)
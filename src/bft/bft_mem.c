@@ -143,6 +143,15 @@ BEGIN_C_DECLS
 
 #define DIR_SEPARATOR '/'
 
+/* Number of independent hash tables (shards) for block tracing;
+   must be a power of 2 */
+
+#define BFT_MEM_N_SHARDS 64
+
+/* Maximum number of call sites listed in the sampled allocations summary */
+
+#define BFT_MEM_N_SITES_LOG 50
+
 /*-------------------------------------------------------------------------------
  * Local type definitions
  *-----------------------------------------------------------------------------*/
@@ -153,8 +162,62 @@ BEGIN_C_DECLS
 
 struct _bft_mem_block_t {
 
-  void    *p_bloc;  /* Allocated memory block start adress */
-  size_t   size;    /* Allocated memory block length */
+  void    *p_bloc;   /* Allocated memory block start adress */
+  size_t   size;     /* Allocated memory block length */
+  int      site_id;  /* Associated call site id if sampled, -1 otherwise */
+
+};
+
+/*
+ * Open-addressing (linear probing) hash table of allocated blocks.
+ *
+ * Blocks are distributed among several such tables based on their
+ * address hash, so that threads do not all contend for the same lock.
+ * The load factor is kept under 1/2, so a free slot is always found.
+ */
+
+struct _bft_mem_shard_t {
+
+  struct _bft_mem_block_t  *blocks;     /* Blocks (p_bloc = NULL if free) */
+  size_t                    n_blocks;   /* Number of used slots */
+  size_t                    capacity;   /* Number of slots (power of 2) */
+
+#if defined(HAVE_OPENMP)
+  omp_lock_t                lock;       /* Associated lock */
+#endif
+
+};
+
+/*
+ * Allocation counters, updated by a given thread inside parallel regions
+ * and folded into global counters outside such regions.
+ */
+
+struct _bft_mem_counter_t {
+
+  long long  alloc_cur;    /* Allocated size increment since last fold */
+  long long  alloc_max;    /* Maximum of alloc_cur since last fold */
+
+  size_t     n_allocs;     /* Number of allocations since last fold */
+  size_t     n_reallocs;   /* Number of reallocations since last fold */
+  size_t     n_frees;      /* Number of frees since last fold */
+
+  char       _pad[64 - 2*sizeof(long long) - 3*sizeof(size_t)];
+
+};
+
+/*
+ * Call site statistics for sampled allocations
+ */
+
+struct _bft_mem_site_t {
+
+  const char  *file_name;   /* Calling source file */
+  int          line_num;    /* Line number in calling source file */
+
+  size_t       n_allocs;    /* Number of sampled allocations */
+  size_t       size_tot;    /* Cumulative size of sampled allocations */
+  size_t       size_cur;    /* Current size of sampled blocks not freed */
 
 };
 
@@ -192,10 +255,7 @@ static int  _bft_mem_global_initialized = 0;
 
 static FILE *_bft_mem_global_file = NULL;
 
-static struct _bft_mem_block_t  *_bft_mem_global_block_array = NULL;
-
-static unsigned long  _bft_mem_global_block_nbr = 0 ;
-static unsigned long  _bft_mem_global_block_max = 512 ;
+static struct _bft_mem_shard_t  *_bft_mem_global_shards = NULL;
 
 static size_t  _bft_mem_global_alloc_cur = 0;
 static size_t  _bft_mem_global_alloc_max = 0;
@@ -204,6 +264,25 @@ static size_t  _bft_mem_global_n_allocs = 0;
 static size_t  _bft_mem_global_n_reallocs = 0;
 static size_t  _bft_mem_global_n_frees = 0;
 
+/* Per-thread counters (the last one is shared by threads whose id
+   exceeds the initial number of threads, and protected by a lock) */
+
+static int                         _bft_mem_n_counters = 0;
+static struct _bft_mem_counter_t  *_bft_mem_counters = NULL;
+static int                         _bft_mem_counters_pending = 0;
+
+/* Number of active background threads not managed by OpenMP */
+
+static int  _bft_mem_n_bg_threads = 0;
+
+/* Sampled call sites */
+
+static int                       _bft_mem_sampling_period = 0;
+static int                       _bft_mem_n_sites = 0;
+static int                       _bft_mem_n_sites_max = 0;
+static struct _bft_mem_site_t   *_bft_mem_sites = NULL;
+static int                      *_bft_mem_site_index = NULL;
+
 static bft_error_handler_t  *_bft_mem_error_handler
                               = (_bft_mem_error_handler_default);
 
@@ -277,6 +356,201 @@ _bft_mem_size_val(const size_t    counter,
   *unit = units[i];
 }
 
+/*
+ * Indicate if we are inside an OpenMP parallel region, or if background
+ * threads may be running concurrently.
+ *
+ * returns:
+ *   1 if called from inside a parallel region, 0 otherwise.
+ */
+
+static inline int
+_bft_mem_in_parallel(void)
+{
+#if defined(HAVE_OPENMP)
+  if (_bft_mem_n_bg_threads > 0)
+    return 1;
+  return omp_in_parallel();
+#else
+  return 0;
+#endif
+}
+
+/*
+ * Lock or unlock the global lock if inside a parallel region.
+ *
+ * parameters:
+ *   in_parallel: <-- 1 if inside a parallel region, 0 otherwise.
+ *   lock:        <-- 1 to lock, 0 to unlock.
+ */
+
+static inline void
+_bft_mem_global_lock(int  in_parallel,
+                     int  lock)
+{
+#if defined(HAVE_OPENMP)
+  if (in_parallel) {
+    if (lock)
+      omp_set_lock(&_bft_mem_lock);
+    else
+      omp_unset_lock(&_bft_mem_lock);
+  }
+#endif
+}
+
+/*
+ * Fold per-thread counters into global counters.
+ *
+ * This must be called outside parallel regions. As the exact sequence of
+ * operations in different threads is not known, the maximum allocated
+ * memory during a parallel region is estimated as an upper bound,
+ * based on the maximum increment for each thread.
+ */
+
+static void
+_bft_mem_counters_fold(void)
+{
+  long long  alloc_cur = _bft_mem_global_alloc_cur;
+  long long  alloc_max = alloc_cur;
+
+  for (int i = 0; i < _bft_mem_n_counters; i++) {
+    struct _bft_mem_counter_t  *c = _bft_mem_counters + i;
+    alloc_cur += c->alloc_cur;
+    alloc_max += c->alloc_max;
+    _bft_mem_global_n_allocs += c->n_allocs;
+    _bft_mem_global_n_reallocs += c->n_reallocs;
+    _bft_mem_global_n_frees += c->n_frees;
+    memset(c, 0, sizeof(struct _bft_mem_counter_t));
+  }
+
+  _bft_mem_global_alloc_cur = (alloc_cur > 0) ? alloc_cur : 0;
+  if (alloc_max > 0 && (size_t)alloc_max > _bft_mem_global_alloc_max)
+    _bft_mem_global_alloc_max = alloc_max;
+
+  _bft_mem_counters_pending = 0;
+}
+
+/*
+ * Update allocation counters.
+ *
+ * Outside parallel regions, global counters are updated directly.
+ * Inside parallel regions, each thread only updates its own counters,
+ * so no lock is needed (except for the overflow counter).
+ *
+ * parameters:
+ *   in_parallel: <-- 1 if inside a parallel region, 0 otherwise.
+ *   op_type:     <-- 0 for allocation, 1 for reallocation, 2 for free.
+ *   size_diff:   <-- allocated size increment.
+ *
+ * returns:
+ *   1 if this operation is an allocation selected for sampling, 0 otherwise.
+ */
+
+static int
+_bft_mem_counters_update(int        in_parallel,
+                         int        op_type,
+                         long long  size_diff)
+{
+  size_t n_allocs = 0;
+
+  if (in_parallel == 0) {
+
+    if (_bft_mem_counters_pending)
+      _bft_mem_counters_fold();
+
+    if (size_diff < 0 && (size_t)(-size_diff) > _bft_mem_global_alloc_cur)
+      _bft_mem_global_alloc_cur = 0;
+    else
+      _bft_mem_global_alloc_cur += size_diff;
+
+    if (_bft_mem_global_alloc_max < _bft_mem_global_alloc_cur)
+      _bft_mem_global_alloc_max = _bft_mem_global_alloc_cur;
+
+    switch(op_type) {
+    case 0:
+      n_allocs = ++_bft_mem_global_n_allocs;
+      break;
+    case 1:
+      _bft_mem_global_n_reallocs += 1;
+      break;
+    default:
+      _bft_mem_global_n_frees += 1;
+    }
+
+  }
+
+#if defined(HAVE_OPENMP)
+
+  else {
+
+    /* Thread ids are not unique when background threads are active,
+       so the shared (locked) counter is used in that case */
+
+    int c_id = omp_get_thread_num();
+    int overflow = 0;
+    if (c_id >= _bft_mem_n_counters - 1 || _bft_mem_n_bg_threads > 0) {
+      c_id = _bft_mem_n_counters - 1;
+      overflow = 1;
+      omp_set_lock(&_bft_mem_lock);
+    }
+
+    struct _bft_mem_counter_t  *c = _bft_mem_counters + c_id;
+
+    c->alloc_cur += size_diff;
+    if (c->alloc_max < c->alloc_cur)
+      c->alloc_max = c->alloc_cur;
+
+    switch(op_type) {
+    case 0:
+      n_allocs = ++(c->n_allocs);
+      break;
+    case 1:
+      c->n_reallocs += 1;
+      break;
+    default:
+      c->n_frees += 1;
+    }
+
+    if (overflow)
+      omp_unset_lock(&_bft_mem_lock);
+
+    int pending;
+#   pragma omp atomic read
+    pending = _bft_mem_counters_pending;
+    if (pending == 0) {
+#     pragma omp atomic write
+      _bft_mem_counters_pending = 1;
+    }
+
+  }
+
+#endif
+
+  if (   op_type == 0 && _bft_mem_sampling_period > 0
+      && n_allocs % _bft_mem_sampling_period == 0)
+    return 1;
+
+  return 0;
+}
+
+/*
+ * Return current allocated size, without folding per-thread counters.
+ *
+ * returns:
+ *   current allocated size (in bytes).
+ */
+
+static size_t
+_bft_mem_alloc_cur(void)
+{
+  long long alloc_cur = _bft_mem_global_alloc_cur;
+
+  for (int i = 0; i < _bft_mem_n_counters; i++)
+    alloc_cur += _bft_mem_counters[i].alloc_cur;
+
+  return (alloc_cur > 0) ? alloc_cur : 0;
+}
+
 /*
  * Memory usage summary.
  */
@@ -290,6 +564,9 @@ static void _bft_mem_summary(FILE  *f)
   if (f == NULL)
     return;
 
+  if (_bft_mem_counters_pending && _bft_mem_in_parallel() == 0)
+    _bft_mem_counters_fold();
+
   fprintf(f, "\n\n");
   fprintf(f, "Memory allocation summary\n"
           "-------------------------\n\n");
@@ -410,162 +687,551 @@ _bft_mem_error(const char  *file_name,
 }
 
 /*
- * Return the _bft_mem_block structure corresponding to a given
- * allocated block.
+ * Compute hash value associated with a block address.
  *
  * parameters:
- *   p_in: <-- allocated block's start adress.
+ *   p: <-- block start adress.
  *
  * returns:
- *   corresponding _bft_mem_block structure.
+ *   associated hash value.
  */
 
-static struct _bft_mem_block_t *
-_bft_mem_block_info(const void *p_get)
+static inline uint64_t
+_bft_mem_hash(const void  *p)
 {
-  struct _bft_mem_block_t  *pinfo = NULL;
-  unsigned long idx;
-
-  if (_bft_mem_global_block_array != NULL) {
-
-    for (idx = _bft_mem_global_block_nbr - 1;
-         idx > 0 && (_bft_mem_global_block_array + idx)->p_bloc != p_get;
-         idx--);
-
-    if ((_bft_mem_global_block_array + idx)->p_bloc != p_get)
-      _bft_mem_error(__FILE__, __LINE__, 0,
-                     _("Adress [%10p] does not correspond to "
-                       "the beginning of an allocated block."),
-                     p_get);
-    else {
-      pinfo = _bft_mem_global_block_array + idx;
-      assert(p_get == pinfo->p_bloc);
-    }
+  uint64_t h = (uint64_t)((uintptr_t)p >> 4);
 
-  }
+  h *= 0x9E3779B97F4A7C15ULL;
 
-  return pinfo;
+  return h ^ (h >> 29);
 }
 
 /*
- * Return the size of a given allocated block.
+ * Return the shard associated with a given block hash value.
+ */
+
+static inline struct _bft_mem_shard_t *
+_bft_mem_shard(uint64_t  h)
+{
+  return _bft_mem_global_shards + ((h >> 58) & (BFT_MEM_N_SHARDS - 1));
+}
+
+/*
+ * Lock or unlock a shard if inside a parallel region.
  *
  * parameters:
- *   p_in: <-- allocated block's start adress.
+ *   s:           <-> pointer to shard.
+ *   in_parallel: <-- 1 if inside a parallel region, 0 otherwise.
+ *   lock:        <-- 1 to lock, 0 to unlock.
+ */
+
+static inline void
+_bft_mem_shard_lock(struct _bft_mem_shard_t  *s,
+                    int                       in_parallel,
+                    int                       lock)
+{
+#if defined(HAVE_OPENMP)
+  if (in_parallel) {
+    if (lock)
+      omp_set_lock(&(s->lock));
+    else
+      omp_unset_lock(&(s->lock));
+  }
+#else
+  (void)s;
+  (void)in_parallel;
+  (void)lock;
+#endif
+}
+
+/*
+ * Return the slot of a shard containing a given block.
+ *
+ * parameters:
+ *   s: <-- pointer to shard.
+ *   p: <-- block start adress.
+ *   h: <-- block hash value.
  *
  * returns:
- *   block size.
+ *   pointer to matching slot, or NULL if not found.
  */
 
-static size_t
-_bft_mem_block_size(const void  *p_in)
+static struct _bft_mem_block_t *
+_bft_mem_shard_find(struct _bft_mem_shard_t  *s,
+                    const void               *p,
+                    uint64_t                  h)
 {
-  struct _bft_mem_block_t *pinfo = _bft_mem_block_info(p_in);
+  if (s->capacity == 0)
+    return NULL;
 
-  if (pinfo != NULL)
-    return pinfo->size;
-  else
-    return 0;
+  const size_t mask = s->capacity - 1;
+
+  for (size_t i = h & mask; ; i = (i+1) & mask) {
+    if (s->blocks[i].p_bloc == p)
+      return s->blocks + i;
+    else if (s->blocks[i].p_bloc == NULL)
+      return NULL;
+  }
 }
 
 /*
- * Fill a _bft_mem_block_t structure for an allocated pointer.
+ * Insert a block in a shard.
+ *
+ * parameters:
+ *   s:       <-> pointer to shard.
+ *   p:       <-- block start adress.
+ *   h:       <-- block hash value.
+ *   size:    <-- block size.
+ *   site_id: <-- associated call site id, or -1.
  */
 
 static void
-_bft_mem_block_malloc(void          *p_new,
-                      const size_t   size_new)
+_bft_mem_shard_insert(struct _bft_mem_shard_t  *s,
+                      void                     *p,
+                      uint64_t                  h,
+                      size_t                    size,
+                      int                       site_id)
 {
-  struct _bft_mem_block_t *pinfo;
+  /* Resize table if needed, keeping a load factor < 1/2 */
 
-  assert(size_new != 0);
+  if ((s->n_blocks + 1)*2 > s->capacity) {
 
-  if (_bft_mem_global_block_array == NULL)
-    return;
-
-  if (_bft_mem_global_block_nbr >= _bft_mem_global_block_max) {
+    size_t old_capacity = s->capacity;
+    struct _bft_mem_block_t *old_blocks = s->blocks;
 
-    _bft_mem_global_block_max *= 2;
-    _bft_mem_global_block_array
-      = (struct _bft_mem_block_t *) realloc(_bft_mem_global_block_array,
-                                            sizeof(struct _bft_mem_block_t)
-                                            * _bft_mem_global_block_max);
+    s->capacity = (old_capacity > 0) ? old_capacity*2 : 64;
+    s->blocks = calloc(s->capacity, sizeof(struct _bft_mem_block_t));
 
-    if (_bft_mem_global_block_array == NULL) {
+    if (s->blocks == NULL) {
       _bft_mem_error(__FILE__, __LINE__, errno,
                      _("Memory allocation failure"));
       return;
     }
 
+    const size_t mask = s->capacity - 1;
+
+    for (size_t j = 0; j < old_capacity; j++) {
+      if (old_blocks[j].p_bloc != NULL) {
+        size_t i = _bft_mem_hash(old_blocks[j].p_bloc) & mask;
+        while (s->blocks[i].p_bloc != NULL)
+          i = (i+1) & mask;
+        s->blocks[i] = old_blocks[j];
+      }
+    }
+
+    free(old_blocks);
+
   }
 
-  _bft_mem_global_block_nbr += 1;
+  const size_t mask = s->capacity - 1;
 
-  pinfo = _bft_mem_global_block_array + _bft_mem_global_block_nbr - 1;
+  size_t i = h & mask;
+  while (s->blocks[i].p_bloc != NULL)
+    i = (i+1) & mask;
 
-  /* Start adress and size of allocated block */
+  s->blocks[i].p_bloc = p;
+  s->blocks[i].size = size;
+  s->blocks[i].site_id = site_id;
 
-  pinfo->p_bloc = p_new;
-  pinfo->size   = size_new;
+  s->n_blocks += 1;
 }
 
 /*
- * Update a _bft_mem_block_t structure for an reallocated pointer.
+ * Remove a given slot from a shard.
+ *
+ * Following entries of the same probe sequence are shifted back,
+ * so no deletion markers are needed.
+ *
+ * parameters:
+ *   s:     <-> pointer to shard.
+ *   pinfo: <-> pointer to slot to remove.
  */
 
 static void
-_bft_mem_block_realloc(const void    *p_old,
-                       void          *p_new,
-                       size_t         size_new)
+_bft_mem_shard_remove(struct _bft_mem_shard_t  *s,
+                      struct _bft_mem_block_t  *pinfo)
 {
-  struct _bft_mem_block_t *pinfo;
+  const size_t mask = s->capacity - 1;
 
-  assert(size_new != 0);
+  size_t i = pinfo - s->blocks;
+  size_t j = i;
+
+  while (true) {
+    j = (j+1) & mask;
+    if (s->blocks[j].p_bloc == NULL)
+      break;
+    size_t k = _bft_mem_hash(s->blocks[j].p_bloc) & mask;
+    /* Move entry j to i unless its home slot k lies cyclically in (i, j] */
+    if ((j > i && (k <= i || k > j)) || (j < i && (k <= i && k > j))) {
+      s->blocks[i] = s->blocks[j];
+      i = j;
+    }
+  }
 
-  pinfo = _bft_mem_block_info(p_old);
+  s->blocks[i].p_bloc = NULL;
+  s->blocks[i].size = 0;
+  s->blocks[i].site_id = -1;
 
-  if (pinfo != NULL) {
-    pinfo->p_bloc = p_new;
-    pinfo->size   = size_new;
+  s->n_blocks -= 1;
+}
+
+/*
+ * Return the id of the call site matching a given source file and line,
+ * adding it if not present.
+ *
+ * The global lock must be held by the caller inside parallel regions.
+ *
+ * parameters:
+ *   file_name: <-- name of calling source file.
+ *   line_num:  <-- line number in calling source file.
+ *
+ * returns:
+ *   call site id, or -1 in case of failure.
+ */
+
+static int
+_bft_mem_site_id(const char  *file_name,
+                 int          line_num)
+{
+  uint64_t h = _bft_mem_hash(file_name) + (uint64_t)line_num*0x100000001B3ULL;
+
+  /* Resize index if needed, keeping a load factor < 1/2 */
+
+  if ((_bft_mem_n_sites + 1)*2 > _bft_mem_n_sites_max) {
+
+    int n_sites_max = (_bft_mem_n_sites_max > 0) ?
+                      _bft_mem_n_sites_max*2 : 1024;
+
+    struct _bft_mem_site_t *sites
+      = realloc(_bft_mem_sites, n_sites_max*sizeof(struct _bft_mem_site_t));
+    int *site_index = malloc(n_sites_max*sizeof(int));
+
+    if (sites == NULL || site_index == NULL) {
+      free(site_index);
+      if (sites != NULL)
+        _bft_mem_sites = sites;
+      return -1;
+    }
+
+    _bft_mem_sites = sites;
+    _bft_mem_n_sites_max = n_sites_max;
+
+    free(_bft_mem_site_index);
+    _bft_mem_site_index = site_index;
+
+    for (int i = 0; i < n_sites_max; i++)
+      _bft_mem_site_index[i] = -1;
+
+    for (int j = 0; j < _bft_mem_n_sites; j++) {
+      struct _bft_mem_site_t *site = _bft_mem_sites + j;
+      uint64_t hj =   _bft_mem_hash(site->file_name)
+                    + (uint64_t)(site->line_num)*0x100000001B3ULL;
+      int i = hj & (n_sites_max - 1);
+      while (_bft_mem_site_index[i] > -1)
+        i = (i+1) & (n_sites_max - 1);
+      _bft_mem_site_index[i] = j;
+    }
+
+  }
+
+  const int mask = _bft_mem_n_sites_max - 1;
+
+  int i = h & mask;
+  while (_bft_mem_site_index[i] > -1) {
+    struct _bft_mem_site_t *site = _bft_mem_sites + _bft_mem_site_index[i];
+    if (site->file_name == file_name && site->line_num == line_num)
+      return _bft_mem_site_index[i];
+    i = (i+1) & mask;
   }
+
+  int site_id = _bft_mem_n_sites;
+  _bft_mem_n_sites += 1;
+
+  struct _bft_mem_site_t *site = _bft_mem_sites + site_id;
+  site->file_name = file_name;
+  site->line_num = line_num;
+  site->n_allocs = 0;
+  site->size_tot = 0;
+  site->size_cur = 0;
+
+  _bft_mem_site_index[i] = site_id;
+
+  return site_id;
+}
+
+/*
+ * Record a sampled allocation.
+ *
+ * parameters:
+ *   in_parallel: <-- 1 if inside a parallel region, 0 otherwise.
+ *   file_name:   <-- name of calling source file.
+ *   line_num:    <-- line number in calling source file.
+ *   size:        <-- allocated size.
+ *
+ * returns:
+ *   associated call site id, or -1 in case of failure.
+ */
+
+static int
+_bft_mem_site_add(int          in_parallel,
+                  const char  *file_name,
+                  int          line_num,
+                  size_t       size)
+{
+  _bft_mem_global_lock(in_parallel, 1);
+
+  int site_id = _bft_mem_site_id(file_name, line_num);
+
+  if (site_id > -1) {
+    struct _bft_mem_site_t *site = _bft_mem_sites + site_id;
+    site->n_allocs += 1;
+    site->size_tot += size;
+    site->size_cur += size;
+  }
+
+  _bft_mem_global_lock(in_parallel, 0);
+
+  return site_id;
+}
+
+/*
+ * Update the current size of sampled blocks for a given call site.
+ *
+ * parameters:
+ *   in_parallel: <-- 1 if inside a parallel region, 0 otherwise.
+ *   site_id:     <-- call site id.
+ *   size_diff:   <-- allocated size increment.
+ */
+
+static void
+_bft_mem_site_update(int        in_parallel,
+                     int        site_id,
+                     long long  size_diff)
+{
+  _bft_mem_global_lock(in_parallel, 1);
+
+  struct _bft_mem_site_t *site = _bft_mem_sites + site_id;
+  if (size_diff < 0 && (size_t)(-size_diff) > site->size_cur)
+    site->size_cur = 0;
+  else
+    site->size_cur += size_diff;
+
+  _bft_mem_global_lock(in_parallel, 0);
+}
+
+/*
+ * Compare call sites by decreasing current, then cumulative size
+ * (qsort function).
+ */
+
+static int
+_bft_mem_site_compare(const void  *x,
+                      const void  *y)
+{
+  const struct _bft_mem_site_t *s0 = _bft_mem_sites + *(const int *)x;
+  const struct _bft_mem_site_t *s1 = _bft_mem_sites + *(const int *)y;
+
+  if (s0->size_cur != s1->size_cur)
+    return (s0->size_cur < s1->size_cur) ? 1 : -1;
+  else if (s0->size_tot != s1->size_tot)
+    return (s0->size_tot < s1->size_tot) ? 1 : -1;
+
+  return 0;
 }
 
 /*
- * Free a _bft_mem_block_t structure for a freed pointer.
+ * Sampled call sites summary.
  */
 
 static void
-_bft_mem_block_free(const void *p_free)
+_bft_mem_sites_summary(FILE  *f)
 {
-  struct _bft_mem_block_t *pinfo, *pmove;
-  unsigned long idx;
+  if (f == NULL || _bft_mem_n_sites == 0)
+    return;
 
-  if (_bft_mem_global_block_array == NULL)
+  int *order = malloc(_bft_mem_n_sites * sizeof(int));
+  if (order == NULL)
     return;
 
-  for (idx = _bft_mem_global_block_nbr - 1;
-       idx > 0 && (_bft_mem_global_block_array + idx)->p_bloc != p_free;
-       idx--);
+  for (int i = 0; i < _bft_mem_n_sites; i++)
+    order[i] = i;
+
+  qsort(order, _bft_mem_n_sites, sizeof(int), _bft_mem_site_compare);
+
+  fprintf(f,
+          "\nSampled allocation sites (1 in %d allocations):\n\n"
+          "  FILE NAME                  : LINE  : N SAMPLES : "
+          "SAMPLED BYTES : NON FREED BYTES\n",
+          _bft_mem_sampling_period);
+
+  int n_log = (_bft_mem_n_sites < BFT_MEM_N_SITES_LOG) ?
+               _bft_mem_n_sites : BFT_MEM_N_SITES_LOG;
+
+  for (int i = 0; i < n_log; i++) {
+    const struct _bft_mem_site_t *site = _bft_mem_sites + order[i];
+    fprintf(f, "  %-27s:%6d : %9lu : %13lu : %15lu\n",
+            _bft_mem_basename(site->file_name), site->line_num,
+            (unsigned long)site->n_allocs,
+            (unsigned long)site->size_tot,
+            (unsigned long)site->size_cur);
+  }
+
+  if (n_log < _bft_mem_n_sites)
+    fprintf(f, "  (%d other sites not listed)\n", _bft_mem_n_sites - n_log);
+
+  fprintf(f, "\n");
+
+  free(order);
+}
+
+/*
+ * Return the size of a given allocated block.
+ *
+ * parameters:
+ *   in_parallel: <-- 1 if inside a parallel region, 0 otherwise.
+ *   p_in:        <-- allocated block's start adress.
+ *
+ * returns:
+ *   block size.
+ */
+
+static size_t
+_bft_mem_block_size(int          in_parallel,
+                    const void  *p_in)
+{
+  size_t size = 0;
+  int found = 0;
+
+  if (_bft_mem_global_shards == NULL)
+    return 0;
+
+  uint64_t h = _bft_mem_hash(p_in);
+  struct _bft_mem_shard_t *s = _bft_mem_shard(h);
+
+  _bft_mem_shard_lock(s, in_parallel, 1);
+
+  struct _bft_mem_block_t *pinfo = _bft_mem_shard_find(s, p_in, h);
+  if (pinfo != NULL) {
+    size = pinfo->size;
+    found = 1;
+  }
 
-  if ((_bft_mem_global_block_array + idx)->p_bloc != p_free)
+  _bft_mem_shard_lock(s, in_parallel, 0);
+
+  if (found == 0)
     _bft_mem_error(__FILE__, __LINE__, 0,
                    _("Adress [%10p] does not correspond to "
                      "the beginning of an allocated block."),
-                   p_free);
+                   p_in);
 
-  else {
+  return size;
+}
+
+/*
+ * Add tracing info for an allocated pointer.
+ */
+
+static void
+_bft_mem_block_malloc(int            in_parallel,
+                      void          *p_new,
+                      const size_t   size_new,
+                      int            site_id)
+{
+  assert(size_new != 0);
+
+  if (_bft_mem_global_shards == NULL)
+    return;
+
+  uint64_t h = _bft_mem_hash(p_new);
+  struct _bft_mem_shard_t *s = _bft_mem_shard(h);
+
+  _bft_mem_shard_lock(s, in_parallel, 1);
+
+  _bft_mem_shard_insert(s, p_new, h, size_new, site_id);
+
+  _bft_mem_shard_lock(s, in_parallel, 0);
+}
+
+/*
+ * Detach tracing info from a pointer about to be reallocated.
+ *
+ * As the previous pointer may not be used after reallocation, its
+ * tracing info is removed before, and the reallocated pointer is then
+ * added using _bft_mem_block_malloc().
+ *
+ * returns:
+ *   associated call site id, or -1.
+ */
+
+static int
+_bft_mem_block_detach(int          in_parallel,
+                      const void  *p_old)
+{
+  int site_id = -1;
+
+  if (_bft_mem_global_shards == NULL)
+    return -1;
+
+  uint64_t h = _bft_mem_hash(p_old);
+  struct _bft_mem_shard_t *s = _bft_mem_shard(h);
+
+  _bft_mem_shard_lock(s, in_parallel, 1);
+
+  struct _bft_mem_block_t *pinfo = _bft_mem_shard_find(s, p_old, h);
+
+  if (pinfo != NULL) {
+    site_id = pinfo->site_id;
+    _bft_mem_shard_remove(s, pinfo);
+  }
+
+  _bft_mem_shard_lock(s, in_parallel, 0);
+
+  return site_id;
+}
+
+/*
+ * Remove tracing info for a freed pointer.
+ *
+ * returns:
+ *   size of freed block.
+ */
 
-    /* We move the contents of the array's final block to the position
-       of the freed block, and shorten the array's useful part by one. */
+static size_t
+_bft_mem_block_free(int          in_parallel,
+                    const void  *p_free)
+{
+  size_t size = 0;
+  int site_id = -1, found = 0;
 
-    pinfo = _bft_mem_global_block_array + idx;
-    pmove = _bft_mem_global_block_array + _bft_mem_global_block_nbr - 1;
-    pinfo->p_bloc = pmove->p_bloc;
-    pinfo->size   = pmove->size;
+  if (_bft_mem_global_shards == NULL)
+    return 0;
 
-    _bft_mem_global_block_nbr -= 1;
+  uint64_t h = _bft_mem_hash(p_free);
+  struct _bft_mem_shard_t *s = _bft_mem_shard(h);
 
+  _bft_mem_shard_lock(s, in_parallel, 1);
+
+  struct _bft_mem_block_t *pinfo = _bft_mem_shard_find(s, p_free, h);
+
+  if (pinfo != NULL) {
+    size = pinfo->size;
+    site_id = pinfo->site_id;
+    found = 1;
+    _bft_mem_shard_remove(s, pinfo);
   }
+
+  _bft_mem_shard_lock(s, in_parallel, 0);
+
+  if (found == 0)
+    _bft_mem_error(__FILE__, __LINE__, 0,
+                   _("Adress [%10p] does not correspond to "
+                     "the beginning of an allocated block."),
+                   p_free);
+
+  else if (site_id > -1)
+    _bft_mem_site_update(in_parallel, site_id, -(long long)size);
+
+  return size;
 }
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -605,15 +1271,49 @@ bft_mem_init(const char *log_file_name)
   }
   _bft_mem_global_initialized = 1;
 
-  alloc_size = sizeof(struct _bft_mem_block_t) * _bft_mem_global_block_max;
+  alloc_size = sizeof(struct _bft_mem_shard_t) * BFT_MEM_N_SHARDS;
+
+  _bft_mem_global_shards = malloc(alloc_size);
+
+  if (_bft_mem_global_shards == NULL) {
+    _bft_mem_error(__FILE__, __LINE__, errno,
+                   _("Failure to allocate \"%s\" (%lu bytes)"),
+                   "_bft_mem_global_shards", (unsigned long)alloc_size);
+    return;
+  }
+
+  for (int i = 0; i < BFT_MEM_N_SHARDS; i++) {
+    struct _bft_mem_shard_t *s = _bft_mem_global_shards + i;
+    s->blocks = NULL;
+    s->n_blocks = 0;
+    s->capacity = 0;
+#if defined(HAVE_OPENMP)
+    omp_init_lock(&(s->lock));
+#endif
+  }
+
+  /* Per-thread counters, with an additional shared overflow counter */
+
+  _bft_mem_n_counters = 1;
 
-  _bft_mem_global_block_array
-    = malloc(sizeof(struct _bft_mem_block_t) * _bft_mem_global_block_max);
+#if defined(HAVE_OPENMP)
+  {
+    int n_threads = omp_get_max_threads();
+    if (n_threads < omp_get_num_procs())
+      n_threads = omp_get_num_procs();
+    _bft_mem_n_counters = n_threads + 1;
+  }
+#endif
 
-  if (_bft_mem_global_block_array == NULL) {
+  _bft_mem_counters = calloc(_bft_mem_n_counters,
+                             sizeof(struct _bft_mem_counter_t));
+
+  if (_bft_mem_counters == NULL) {
     _bft_mem_error(__FILE__, __LINE__, errno,
                    _("Failure to allocate \"%s\" (%lu bytes)"),
-                   "_bft_mem_global_block_array", (unsigned long)alloc_size);
+                   "_bft_mem_counters",
+                   (unsigned long)(  _bft_mem_n_counters
+                                   * sizeof(struct _bft_mem_counter_t)));
     return;
   }
 
@@ -642,7 +1342,7 @@ bft_mem_init(const char *log_file_name)
 
   /* Log file header */
 
-  if (_bft_mem_global_file != NULL) {
+  if (_bft_mem_global_file != NULL && _bft_mem_sampling_period < 1) {
 
     fprintf(_bft_mem_global_file,
             "       :     FILE NAME              : LINE  :"
@@ -682,24 +1382,32 @@ void bft_mem_end(void)
   if (_bft_mem_global_file != NULL) {
 
     unsigned long  non_free = 0;
-    struct _bft_mem_block_t  *pinfo;
 
     /* Memory usage summary */
 
     _bft_mem_summary(_bft_mem_global_file);
 
+    /* Sampled call sites */
+
+    if (_bft_mem_sampling_period > 0)
+      _bft_mem_sites_summary(_bft_mem_global_file);
+
     /* List of non-freed pointers */
 
-    if (_bft_mem_global_block_array != NULL) {
+    if (_bft_mem_global_shards != NULL) {
 
       fprintf(_bft_mem_global_file, "List of non freed pointers:\n");
 
-      for (pinfo = _bft_mem_global_block_array;
-           pinfo < _bft_mem_global_block_array + _bft_mem_global_block_nbr;
-           pinfo++) {
+      for (int i = 0; i < BFT_MEM_N_SHARDS; i++) {
+
+        const struct _bft_mem_shard_t *s = _bft_mem_global_shards + i;
 
-        fprintf(_bft_mem_global_file,"[%10p]\n", pinfo->p_bloc);
-        non_free++;
+        for (size_t j = 0; j < s->capacity; j++) {
+          if (s->blocks[j].p_bloc != NULL) {
+            fprintf(_bft_mem_global_file,"[%10p]\n", s->blocks[j].p_bloc);
+            non_free++;
+          }
+        }
 
       }
 
@@ -710,17 +1418,34 @@ void bft_mem_end(void)
     }
 
     fclose(_bft_mem_global_file);
+    _bft_mem_global_file = NULL;
   }
 
   /* Reset defaults in case of later initialization */
 
-  if (_bft_mem_global_block_array != NULL) {
-    free(_bft_mem_global_block_array);
-    _bft_mem_global_block_array = NULL;
+  if (_bft_mem_global_shards != NULL) {
+    for (int i = 0; i < BFT_MEM_N_SHARDS; i++) {
+      struct _bft_mem_shard_t *s = _bft_mem_global_shards + i;
+      free(s->blocks);
+#if defined(HAVE_OPENMP)
+      omp_destroy_lock(&(s->lock));
+#endif
+    }
+    free(_bft_mem_global_shards);
+    _bft_mem_global_shards = NULL;
   }
 
-  _bft_mem_global_block_nbr   = 0 ;
-  _bft_mem_global_block_max   = 512 ;
+  free(_bft_mem_counters);
+  _bft_mem_counters = NULL;
+  _bft_mem_n_counters = 0;
+  _bft_mem_counters_pending = 0;
+
+  free(_bft_mem_sites);
+  free(_bft_mem_site_index);
+  _bft_mem_sites = NULL;
+  _bft_mem_site_index = NULL;
+  _bft_mem_n_sites = 0;
+  _bft_mem_n_sites_max = 0;
 
   _bft_mem_global_alloc_cur = 0;
   _bft_mem_global_alloc_max = 0;
@@ -743,6 +1468,47 @@ bft_mem_initialized(void)
   return _bft_mem_global_initialized;
 }
 
+/*!
+ * \brief Set sampling period for allocation call site statistics.
+ *
+ * When active, one allocation out of every given period (per thread)
+ * records its calling source file and line, and a summary of the
+ * associated cumulative and non-freed sizes by call site is written
+ * to the log file when bft_mem_end() is called. Individual operations
+ * are then not logged, so tracing remains usable on large cases.
+ *
+ * This function should be called before bft_mem_init().
+ *
+ * \param [in] period  sampling period, or 0 to deactivate sampling.
+ */
+
+void
+bft_mem_sampling_set(int  period)
+{
+  _bft_mem_sampling_period = (period > 0) ? period : 0;
+}
+
+/*!
+ * \brief Indicate that threads not managed by OpenMP may call
+ *        bft_mem_...() functions.
+ *
+ * This should be called from the main thread before starting such a
+ * background thread (with a positive value), and after it has been joined
+ * (with a negative value). While background threads are active, memory
+ * tracing and counter updates are protected by locks.
+ *
+ * \param [in] n_threads  number of background threads added
+ *                        (or removed if negative).
+ */
+
+void
+bft_mem_background_threads_add(int  n_threads)
+{
+  _bft_mem_n_bg_threads += n_threads;
+  if (_bft_mem_n_bg_threads < 0)
+    _bft_mem_n_bg_threads = 0;
+}
+
 /*!
  * \brief Allocate memory for ni elements of size bytes.
  *
@@ -788,36 +1554,27 @@ bft_mem_malloc(size_t       ni,
   /* Memory allocation counting */
 
   {
-#if defined(HAVE_OPENMP)
-    int in_parallel = omp_in_parallel();
-    if (in_parallel)
-      omp_set_lock(&_bft_mem_lock);
-#endif
-
-    _bft_mem_global_alloc_cur += alloc_size;
+    int in_parallel = _bft_mem_in_parallel();
+    int site_id = -1;
 
-    if (_bft_mem_global_alloc_max < _bft_mem_global_alloc_cur)
-      _bft_mem_global_alloc_max = _bft_mem_global_alloc_cur;
+    if (_bft_mem_counters_update(in_parallel, 0, alloc_size))
+      site_id = _bft_mem_site_add(in_parallel, file_name, line_num,
+                                  alloc_size);
 
-    if (_bft_mem_global_file != NULL) {
+    if (_bft_mem_global_file != NULL && _bft_mem_sampling_period < 1) {
+      _bft_mem_global_lock(in_parallel, 1);
       fprintf(_bft_mem_global_file, "\n  alloc: %-27s:%6d : %-39s: %9lu",
               _bft_mem_basename(file_name), line_num,
               var_name, (unsigned long)alloc_size);
       fprintf(_bft_mem_global_file, " : (+%9lu) : %12lu : [%10p]",
               (unsigned long)alloc_size,
-              (unsigned long)_bft_mem_global_alloc_cur,
+              (unsigned long)_bft_mem_alloc_cur(),
               p_loc);
       fflush(_bft_mem_global_file);
+      _bft_mem_global_lock(in_parallel, 0);
     }
 
-    _bft_mem_block_malloc(p_loc, alloc_size);
-
-    _bft_mem_global_n_allocs += 1;
-
-#if defined(HAVE_OPENMP)
-    if (in_parallel)
-      omp_unset_lock(&_bft_mem_lock);
-#endif
+    _bft_mem_block_malloc(in_parallel, p_loc, alloc_size, site_id);
   }
 
   /* Return pointer to allocated memory */
@@ -872,18 +1629,9 @@ bft_mem_realloc(void        *ptr,
 
   /* If the old size equals the new size, nothing needs to be done. */
 
-#if defined(HAVE_OPENMP)
-  int in_parallel = omp_in_parallel();
-  if (in_parallel)
-    omp_set_lock(&_bft_mem_lock);
-#endif
+  int in_parallel = _bft_mem_in_parallel();
 
-  old_size = _bft_mem_block_size(ptr);
-
-#if defined(HAVE_OPENMP)
-  if (in_parallel)
-    omp_unset_lock(&_bft_mem_lock);
-#endif
+  old_size = _bft_mem_block_size(in_parallel, ptr);
 
   if (new_size == old_size)
     return ptr;
@@ -905,6 +1653,10 @@ bft_mem_realloc(void        *ptr,
 
     size_diff = new_size - old_size;
 
+    int site_id = -1;
+    if (_bft_mem_global_initialized != 0)
+      site_id = _bft_mem_block_detach(in_parallel, ptr);
+
     p_loc = realloc(ptr, new_size);
 
     if (p_loc == NULL) {
@@ -917,39 +1669,26 @@ bft_mem_realloc(void        *ptr,
       return p_loc;
 
     {
-#if defined(HAVE_OPENMP)
-      if (in_parallel)
-        omp_set_lock(&_bft_mem_lock);
-#endif
-
-      _bft_mem_global_alloc_cur += size_diff;
-
-      if (size_diff > 0) {
-        if (_bft_mem_global_alloc_max < _bft_mem_global_alloc_cur)
-          _bft_mem_global_alloc_max = _bft_mem_global_alloc_cur;
-      }
+      _bft_mem_counters_update(in_parallel, 1, size_diff);
 
-      if (_bft_mem_global_file != NULL) {
+      if (_bft_mem_global_file != NULL && _bft_mem_sampling_period < 1) {
         char sgn = (size_diff > 0) ? '+' : '-';
+        _bft_mem_global_lock(in_parallel, 1);
         fprintf(_bft_mem_global_file, "\nrealloc: %-27s:%6d : %-39s: %9lu",
                 _bft_mem_basename(file_name), line_num,
                 var_name, (unsigned long)new_size);
         fprintf(_bft_mem_global_file, " : (%c%9lu) : %12lu : [%10p]",
                 sgn,
                 (unsigned long) ((size_diff > 0) ? size_diff : -size_diff),
-                (unsigned long)_bft_mem_global_alloc_cur,
+                (unsigned long)_bft_mem_alloc_cur(),
                 p_loc);
         fflush(_bft_mem_global_file);
+        _bft_mem_global_lock(in_parallel, 0);
       }
 
-      _bft_mem_block_realloc(ptr, p_loc, new_size);
-
-      _bft_mem_global_n_reallocs += 1;
-
-#if defined(HAVE_OPENMP)
-      if (in_parallel)
-        omp_unset_lock(&_bft_mem_lock);
-#endif
+      _bft_mem_block_malloc(in_parallel, p_loc, new_size, site_id);
+      if (site_id > -1)
+        _bft_mem_site_update(in_parallel, site_id, size_diff);
     }
 
     return p_loc;
@@ -991,35 +1730,25 @@ bft_mem_free(void        *ptr,
 
   if (_bft_mem_global_initialized != 0) {
 
-#if defined(HAVE_OPENMP)
-    int in_parallel = omp_in_parallel();
-    if (in_parallel)
-      omp_set_lock(&_bft_mem_lock);
-#endif
+    int in_parallel = _bft_mem_in_parallel();
 
-    size_info = _bft_mem_block_size(ptr);
+    size_info = _bft_mem_block_free(in_parallel, ptr);
 
-    _bft_mem_global_alloc_cur -= size_info;
+    _bft_mem_counters_update(in_parallel, 2, -(long long)size_info);
 
-    if (_bft_mem_global_file != NULL) {
+    if (_bft_mem_global_file != NULL && _bft_mem_sampling_period < 1) {
+      _bft_mem_global_lock(in_parallel, 1);
       fprintf(_bft_mem_global_file,"\n   free: %-27s:%6d : %-39s: %9lu",
               _bft_mem_basename(file_name), line_num,
               var_name, (unsigned long)size_info);
       fprintf(_bft_mem_global_file, " : (-%9lu) : %12lu : [%10p]",
               (unsigned long)size_info,
-              (unsigned long)_bft_mem_global_alloc_cur,
+              (unsigned long)_bft_mem_alloc_cur(),
               ptr);
       fflush(_bft_mem_global_file);
+      _bft_mem_global_lock(in_parallel, 0);
     }
 
-    _bft_mem_block_free(ptr);
-
-    _bft_mem_global_n_frees += 1;
-
-#if defined(HAVE_OPENMP)
-    if (in_parallel)
-      omp_unset_lock(&_bft_mem_lock);
-#endif
   }
 
   free(ptr);
@@ -1090,36 +1819,27 @@ bft_mem_memalign(size_t       alignment,
   /* Memory allocation counting */
 
   {
-#if defined(HAVE_OPENMP)
-    int in_parallel = omp_in_parallel();
-    if (in_parallel)
-      omp_set_lock(&_bft_mem_lock);
-#endif
+    int in_parallel = _bft_mem_in_parallel();
+    int site_id = -1;
 
-    _bft_mem_global_alloc_cur += alloc_size;
+    if (_bft_mem_counters_update(in_parallel, 0, alloc_size))
+      site_id = _bft_mem_site_add(in_parallel, file_name, line_num,
+                                  alloc_size);
 
-    if (_bft_mem_global_alloc_max < _bft_mem_global_alloc_cur)
-      _bft_mem_global_alloc_max = _bft_mem_global_alloc_cur;
-
-    if (_bft_mem_global_file != NULL) {
+    if (_bft_mem_global_file != NULL && _bft_mem_sampling_period < 1) {
+      _bft_mem_global_lock(in_parallel, 1);
       fprintf(_bft_mem_global_file, "\n  alloc: %-27s:%6d : %-39s: %9lu",
               _bft_mem_basename(file_name), line_num,
               var_name, (unsigned long)alloc_size);
       fprintf(_bft_mem_global_file, " : (+%9lu) : %12lu : [%10p]",
               (unsigned long)alloc_size,
-              (unsigned long)_bft_mem_global_alloc_cur,
+              (unsigned long)_bft_mem_alloc_cur(),
               p_loc);
       fflush(_bft_mem_global_file);
+      _bft_mem_global_lock(in_parallel, 0);
     }
 
-    _bft_mem_block_malloc(p_loc, alloc_size);
-
-    _bft_mem_global_n_allocs += 1;
-
-#if defined(HAVE_OPENMP)
-    if (in_parallel)
-      omp_unset_lock(&_bft_mem_lock);
-#endif
+    _bft_mem_block_malloc(in_parallel, p_loc, alloc_size, site_id);
   }
 
   /* Return pointer to allocated memory */
@@ -1145,18 +1865,25 @@ bft_mem_memalign(size_t       alignment,
 size_t
 bft_mem_size_current(void)
 {
-  return (_bft_mem_global_alloc_cur / 1024);
+  return (_bft_mem_alloc_cur() / 1024);
 }
 
 /*!
  * \brief Return maximum theoretical dynamic memory allocated.
  *
+ * Allocations made inside parallel regions are only accounted for
+ * when this function (or another bft_mem_...() function) is called
+ * outside such regions; their contribution is then an upper bound.
+ *
  * \return maximum memory handled through bft_mem_...() (in kB).
  */
 
 size_t
 bft_mem_size_max(void)
 {
+  if (_bft_mem_counters_pending && _bft_mem_in_parallel() == 0)
+    _bft_mem_counters_fold();
+
   return (_bft_mem_global_alloc_max / 1024);
 }
 
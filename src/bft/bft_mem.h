@@ -174,6 +174,36 @@ bft_mem_end(void);
 int
 bft_mem_initialized(void);
 
+/*
+ * Set sampling period for allocation call site statistics.
+ *
+ * When active, one allocation out of every period (per thread) records
+ * its calling file and line, and a summary by call site is written to
+ * the log file by bft_mem_end(), instead of logging each operation.
+ * This function should be called before bft_mem_init().
+ *
+ * parameter:
+ *   period <-- sampling period, or 0 to deactivate sampling.
+ */
+
+void
+bft_mem_sampling_set(int  period);
+
+/*
+ * Indicate that threads not managed by OpenMP may call bft_mem_...()
+ * functions.
+ *
+ * This should be called from the main thread before starting such a
+ * background thread (with a positive value), and after it has been joined
+ * (with a negative value).
+ *
+ * parameter:
+ *   n_threads <-- number of background threads added (or removed if < 0).
+ */
+
+void
+bft_mem_background_threads_add(int  n_threads);
+
 /*
  * Allocate memory for ni items of size bytes.
  *
@@ -93,6 +93,9 @@ static const cs_cdo_connect_t  *cs_cdo_connect;
 static int  _n_adv_fields = 0;
 static cs_adv_field_t  **_adv_fields = NULL;
 
+/* Number of definitions set for advection fields (to detect updates) */
+static int  _n_adv_field_updates = 0;
+
 /*============================================================================
  * Inline private function prototypes
  *============================================================================*/
@@ -238,6 +241,22 @@ cs_advection_field_get_n_fields(void)
   return _n_adv_fields;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Get the number of definitions set for advection fields so far.
+ *         A change of this value means that at least one advection field has
+ *         been updated.
+ *
+ * \return the number of advection field updates
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_advection_field_get_update_count(void)
+{
+  return _n_adv_field_updates;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Search in the array of advection field structures which one has
@@ -596,6 +615,7 @@ cs_advection_field_def_by_value(cs_adv_field_t    *adv,
   cs_flag_t  meta_flag = CS_FLAG_FULL_LOC;
   int  dim = _get_dim_def(adv);
 
+  _n_adv_field_updates++;
   adv->definition = cs_xdef_volume_create(CS_XDEF_BY_VALUE,
                                           dim,
                                           0,  /* zone_id = 0 => all cells */
@@ -627,6 +647,7 @@ cs_advection_field_def_by_analytic(cs_adv_field_t        *adv,
   cs_xdef_analytic_input_t  anai = {.func = func, .input = input };
   int  dim = _get_dim_def(adv);
 
+  _n_adv_field_updates++;
   adv->definition = cs_xdef_volume_create(CS_XDEF_BY_ANALYTIC_FUNCTION,
                                           dim,
                                           0,  /* zone_id = 0 => all cells */
@@ -668,6 +689,7 @@ cs_advection_field_def_by_array(cs_adv_field_t    *adv,
 
   input.stride = _get_dim_def(adv);
 
+  _n_adv_field_updates++;
   adv->definition = cs_xdef_volume_create(CS_XDEF_BY_ARRAY,
                                           input.stride,
                                           0,  /* zone_id = all cells */
@@ -702,6 +724,7 @@ cs_advection_field_def_by_field(cs_adv_field_t    *adv,
               " %s: Inconsistency found between the field dimension and the"
               " definition of the advection field.\n", __func__);
 
+  _n_adv_field_updates++;
   adv->definition = cs_xdef_volume_create(CS_XDEF_BY_FIELD,
                                           dim,
                                           0,  /* zone_id */
@@ -739,6 +762,7 @@ cs_advection_field_def_boundary_flux_by_value(cs_adv_field_t    *adv,
                                           meta_flag,
                                           (void *)&normal_flux);
 
+  _n_adv_field_updates++;
   int  def_id = adv->n_bdy_flux_defs;
   adv->n_bdy_flux_defs += 1;
   BFT_REALLOC(adv->bdy_flux_defs, adv->n_bdy_flux_defs, cs_xdef_t *);
@@ -778,6 +802,7 @@ cs_advection_field_def_boundary_flux_by_analytic(cs_adv_field_t        *adv,
                                           meta_flag,
                                           &anai);
 
+  _n_adv_field_updates++;
   int  def_id = adv->n_bdy_flux_defs;
   adv->n_bdy_flux_defs += 1;
   BFT_REALLOC(adv->bdy_flux_defs, adv->n_bdy_flux_defs, cs_xdef_t *);
@@ -829,6 +854,7 @@ cs_advection_field_def_boundary_flux_by_array(cs_adv_field_t    *adv,
                                           meta_flag,
                                           (void *)&input);
 
+  _n_adv_field_updates++;
   int  def_id = adv->n_bdy_flux_defs;
   adv->n_bdy_flux_defs += 1;
   BFT_REALLOC(adv->bdy_flux_defs, adv->n_bdy_flux_defs, cs_xdef_t *);
@@ -419,6 +419,19 @@ cs_advection_field_set_shared_pointers(const cs_cdo_quantities_t  *quant,
 int
 cs_advection_field_get_n_fields(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Get the number of definitions set for advection fields so far.
+ *         A change of this value means that at least one advection field has
+ *         been updated.
+ *
+ * \return the number of advection field updates
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_advection_field_get_update_count(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Search in the array of advection field structures which one has
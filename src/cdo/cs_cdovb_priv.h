@@ -101,6 +101,18 @@ struct _cs_cdovb_t {
   cs_hodge_t              **mass_hodge;
   cs_hodge_compute_t       *get_mass_matrix;
 
+  /* Cache of the cellwise diffusion/advection operators when these terms
+     do not depend on time (only for scalar-valued variables). Operators are
+     stored for the cells with an id lower than n_cached_cells. cw_op_idx and
+     cw_op_val are NULL if no cache is used. The cache is rebuilt when one
+     of the mesh, property or advection field update counters stored in
+     cw_op_counts has changed. */
+  cs_lnum_t                 n_cached_cells;
+  size_t                   *cw_op_idx;
+  cs_real_t                *cw_op_val;
+  bool                      cw_op_is_set;
+  int                       cw_op_counts[3];
+
 };
 
 /*============================================================================
@@ -57,6 +57,7 @@
 #include "cs_log.h"
 #include "cs_math.h"
 #include "cs_mesh_location.h"
+#include "cs_mesh_quantities.h"
 #include "cs_parall.h"
 #include "cs_param.h"
 #include "cs_post.h"
@@ -225,6 +226,125 @@ _svb_setup(cs_real_t                      t_eval,
 
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Allocate the cache storing the cellwise diffusion/advection
+ *         operators if requested and if these operators do not depend on
+ *         time. Cells are cached in their numbering order until the memory
+ *         budget set in eqp->operator_cache_size is reached.
+ *         Case of scalar-valued CDO-Vb schemes
+ *
+ * \param[in]      eqp      pointer to a cs_equation_param_t structure
+ * \param[in, out] eqc      context for this kind of discretization
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_svb_init_operator_cache(const cs_equation_param_t   *eqp,
+                         cs_cdovb_scaleq_t           *eqc)
+{
+  if (eqp->operator_cache_size <= 0)
+    return;
+
+  eqc->cw_op_counts[0] = cs_mesh_quantities_compute_count();
+  eqc->cw_op_counts[1] = cs_property_get_update_count();
+  eqc->cw_op_counts[2] = cs_advection_field_get_update_count();
+
+  bool  has_diffusion = cs_equation_param_has_diffusion(eqp);
+  bool  has_convection = cs_equation_param_has_convection(eqp);
+  bool  is_steady = (has_diffusion || has_convection) ? true : false;
+
+  if (has_diffusion && !cs_property_is_steady(eqp->diffusion_property))
+    is_steady = false;
+
+  if (has_convection) {
+    if (!(eqp->adv_field->status & CS_ADVECTION_FIELD_STEADY))
+      is_steady = false;
+    if (!cs_property_is_steady(eqp->adv_scaling_property))
+      is_steady = false;
+  }
+
+  if (!is_steady) {
+    cs_base_warn(__FILE__, __LINE__);
+    cs_log_printf(CS_LOG_DEFAULT,
+                  "%s: Equation %s: No steady diffusion or advection term.\n"
+                  " The cache of cellwise operators is not used.\n",
+                  __func__, eqp->name);
+    return;
+  }
+
+  const cs_cdo_connect_t  *connect = cs_shared_connect;
+  const cs_adjacency_t  *c2v = connect->c2v;
+  const cs_lnum_t  n_cells = connect->n_cells;
+
+  const size_t  max_size
+    = eqp->operator_cache_size*1024.*1024./sizeof(cs_real_t);
+
+  /* Each cell stores a dense n_vc x n_vc block */
+  BFT_MALLOC(eqc->cw_op_idx, n_cells + 1, size_t);
+  eqc->cw_op_idx[0] = 0;
+
+  cs_lnum_t  n_cached_cells = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+    const size_t  n_vc = c2v->idx[c_id+1] - c2v->idx[c_id];
+    if (eqc->cw_op_idx[c_id] + n_vc*n_vc > max_size)
+      break;
+
+    eqc->cw_op_idx[c_id+1] = eqc->cw_op_idx[c_id] + n_vc*n_vc;
+    n_cached_cells++;
+
+  }
+
+  BFT_REALLOC(eqc->cw_op_idx, n_cached_cells + 1, size_t);
+  BFT_MALLOC(eqc->cw_op_val, eqc->cw_op_idx[n_cached_cells], cs_real_t);
+
+  eqc->n_cached_cells = n_cached_cells;
+  eqc->cw_op_is_set = false;
+
+  if (eqp->verbosity > 0)
+    cs_log_printf(CS_LOG_DEFAULT,
+                  " %s: Equation %s: cellwise operators cached for %ld/%ld"
+                  " cells (%.1f MB)\n", __func__, eqp->name,
+                  (long)n_cached_cells, (long)n_cells,
+                  eqc->cw_op_idx[n_cached_cells]*sizeof(cs_real_t)
+                  / (1024.*1024.));
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Rebuild the cache storing the cellwise diffusion/advection
+ *         operators if the mesh, a property or an advection field has been
+ *         updated since the cache was set. The layout of the cache depends
+ *         on the mesh and its use on the steadiness of the definitions, so
+ *         that the cache is built again from scratch.
+ *         Case of scalar-valued CDO-Vb schemes
+ *
+ * \param[in]      eqp      pointer to a cs_equation_param_t structure
+ * \param[in, out] eqc      context for this kind of discretization
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_svb_update_operator_cache(const cs_equation_param_t   *eqp,
+                           cs_cdovb_scaleq_t           *eqc)
+{
+  if (eqp->operator_cache_size <= 0)
+    return;
+
+  if (   eqc->cw_op_counts[0] == cs_mesh_quantities_compute_count()
+      && eqc->cw_op_counts[1] == cs_property_get_update_count()
+      && eqc->cw_op_counts[2] == cs_advection_field_get_update_count())
+    return;
+
+  eqc->n_cached_cells = 0;
+  eqc->cw_op_is_set = false;
+  BFT_FREE(eqc->cw_op_idx);
+  BFT_FREE(eqc->cw_op_val);
+
+  _svb_init_operator_cache(eqp, eqc);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Initialize the local structure for the current cell
@@ -333,10 +453,8 @@ _svb_init_cell_system(const cs_cell_mesh_t          *cm,
 
 /*----------------------------------------------------------------------------*/
 /*!
- * \brief  Build the local matrices arising from the diffusion, advection,
- *         reaction terms.
- *         mass_hodge could be set to NULL if a Voronoi algo. is used.
- *         Otherwise, the mass matrix is computed.
+ * \brief  Build the local matrices arising from the diffusion and advection
+ *         terms and add them to the local system.
  *         Case of scalar-valued CDO-Vb schemes
  *
  * \param[in]      eqp         pointer to a cs_equation_param_t structure
@@ -344,7 +462,6 @@ _svb_init_cell_system(const cs_cell_mesh_t          *cm,
  * \param[in]      eqc         context for this kind of discretization
  * \param[in]      cm          pointer to a cellwise view of the mesh
  * \param[in, out] fm          pointer to a facewise view of the mesh
- * \param[in, out] mass_hodge  pointer to a cs_hodge_t structure (mass matrix)
  * \param[in, out] diff_hodge  pointer to a cs_hodge_t structure (diffusion)
  * \param[in, out] csys        pointer to a cellwise view of the system
  * \param[in, out] cb          pointer to a cellwise builder
@@ -352,32 +469,15 @@ _svb_init_cell_system(const cs_cell_mesh_t          *cm,
 /*----------------------------------------------------------------------------*/
 
 static void
-_svb_conv_diff_reac(const cs_equation_param_t     *eqp,
-                    const cs_equation_builder_t   *eqb,
-                    const cs_cdovb_scaleq_t       *eqc,
-                    const cs_cell_mesh_t          *cm,
-                    cs_face_mesh_t                *fm,
-                    cs_hodge_t                    *mass_hodge,
-                    cs_hodge_t                    *diff_hodge,
-                    cs_cell_sys_t                 *csys,
-                    cs_cell_builder_t             *cb)
+_svb_conv_diff(const cs_equation_param_t     *eqp,
+               const cs_equation_builder_t   *eqb,
+               const cs_cdovb_scaleq_t       *eqc,
+               const cs_cell_mesh_t          *cm,
+               cs_face_mesh_t                *fm,
+               cs_hodge_t                    *diff_hodge,
+               cs_cell_sys_t                 *csys,
+               cs_cell_builder_t             *cb)
 {
-  if (eqb->sys_flag & CS_FLAG_SYS_MASS_MATRIX) { /* MASS MATRIX
-                                                  * =========== */
-    assert(mass_hodge != NULL);
-
-    /* Build the mass matrix and store it in mass_hodge->matrix */
-    eqc->get_mass_matrix(cm, mass_hodge, cb);
-
-#if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 1
-    if (cs_dbg_cw_test(eqp, cm, csys)) {
-      cs_log_printf(CS_LOG_DEFAULT, ">> Celll mass matrix");
-      cs_sdm_dump(csys->c_id, csys->dof_ids, csys->dof_ids,
-                  mass_hodge->matrix);
-    }
-#endif
-  }
-
   if (cs_equation_param_has_diffusion(eqp)) {   /* DIFFUSION TERM
                                                  * ============== */
     assert(diff_hodge != NULL);
@@ -435,6 +535,81 @@ _svb_conv_diff_reac(const cs_equation_param_t     *eqp,
       cs_cell_sys_dump("\n>> Cell system after advection", csys);
 #endif
   }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build the local matrices arising from the diffusion, advection,
+ *         reaction terms.
+ *         mass_hodge could be set to NULL if a Voronoi algo. is used.
+ *         Otherwise, the mass matrix is computed.
+ *         The diffusion and advection operators are retrieved from the cache
+ *         when it is available and already filled.
+ *         Case of scalar-valued CDO-Vb schemes
+ *
+ * \param[in]      eqp         pointer to a cs_equation_param_t structure
+ * \param[in]      eqb         pointer to a cs_equation_builder_t structure
+ * \param[in]      eqc         context for this kind of discretization
+ * \param[in]      cm          pointer to a cellwise view of the mesh
+ * \param[in, out] fm          pointer to a facewise view of the mesh
+ * \param[in, out] mass_hodge  pointer to a cs_hodge_t structure (mass matrix)
+ * \param[in, out] diff_hodge  pointer to a cs_hodge_t structure (diffusion)
+ * \param[in, out] csys        pointer to a cellwise view of the system
+ * \param[in, out] cb          pointer to a cellwise builder
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_svb_conv_diff_reac(const cs_equation_param_t     *eqp,
+                    const cs_equation_builder_t   *eqb,
+                    const cs_cdovb_scaleq_t       *eqc,
+                    const cs_cell_mesh_t          *cm,
+                    cs_face_mesh_t                *fm,
+                    cs_hodge_t                    *mass_hodge,
+                    cs_hodge_t                    *diff_hodge,
+                    cs_cell_sys_t                 *csys,
+                    cs_cell_builder_t             *cb)
+{
+  if (eqb->sys_flag & CS_FLAG_SYS_MASS_MATRIX) { /* MASS MATRIX
+                                                  * =========== */
+    assert(mass_hodge != NULL);
+
+    /* Build the mass matrix and store it in mass_hodge->matrix */
+    eqc->get_mass_matrix(cm, mass_hodge, cb);
+
+#if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 1
+    if (cs_dbg_cw_test(eqp, cm, csys)) {
+      cs_log_printf(CS_LOG_DEFAULT, ">> Celll mass matrix");
+      cs_sdm_dump(csys->c_id, csys->dof_ids, csys->dof_ids,
+                  mass_hodge->matrix);
+    }
+#endif
+  }
+
+  /* Diffusion and advection terms: use the cached operator if available */
+  cs_real_t  *cw_op = NULL;
+  if (cm->c_id < eqc->n_cached_cells)
+    cw_op = eqc->cw_op_val + eqc->cw_op_idx[cm->c_id];
+
+  if (cw_op != NULL && eqc->cw_op_is_set) {
+
+    /* The value of the diffusion property is still needed to apply the
+       boundary conditions */
+    if (cs_equation_param_has_diffusion(eqp) && !(eqb->diff_pty_uniform))
+      cs_hodge_set_property_value_cw(cm, cb->t_pty_eval, cb->cell_flag,
+                                     diff_hodge);
+
+    memcpy(csys->mat->val, cw_op, cm->n_vc*cm->n_vc*sizeof(cs_real_t));
+
+  }
+  else {
+
+    _svb_conv_diff(eqp, eqb, eqc, cm, fm, diff_hodge, csys, cb);
+
+    if (cw_op != NULL)
+      memcpy(cw_op, csys->mat->val, cm->n_vc*cm->n_vc*sizeof(cs_real_t));
+
+  }
 
   if (cs_equation_param_has_reaction(eqp)) { /* REACTION TERM
                                               * ============= */
@@ -1284,6 +1459,16 @@ cs_cdovb_scaleq_init_context(const cs_equation_param_t   *eqp,
   /* Array used for extra-operations */
   eqc->cell_values = NULL;
 
+  /* Cache of cellwise operators (if requested) */
+  eqc->n_cached_cells = 0;
+  eqc->cw_op_idx = NULL;
+  eqc->cw_op_val = NULL;
+  eqc->cw_op_is_set = false;
+  for (int k = 0; k < 3; k++)
+    eqc->cw_op_counts[k] = -1;
+
+  _svb_init_operator_cache(eqp, eqc);
+
   return eqc;
 }
 
@@ -1309,6 +1494,8 @@ cs_cdovb_scaleq_free_context(void   *builder)
   BFT_FREE(eqc->source_terms);
   BFT_FREE(eqc->cell_values);
   BFT_FREE(eqc->vtx_bc_flag);
+  BFT_FREE(eqc->cw_op_idx);
+  BFT_FREE(eqc->cw_op_val);
 
   cs_hodge_free_context(&(eqc->diffusion_hodge));
   cs_hodge_free_context(&(eqc->mass_hodge));
@@ -1319,6 +1506,26 @@ cs_cdovb_scaleq_free_context(void   *builder)
   return NULL;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Invalidate the cached cellwise diffusion/advection operators (if
+ *         any) so that they are rebuilt during the next build of the system
+ *
+ * \param[in, out]  context   pointer to a cs_cdovb_scaleq_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdovb_scaleq_reset_operator_cache(void   *context)
+{
+  cs_cdovb_scaleq_t  *eqc = (cs_cdovb_scaleq_t *)context;
+
+  if (eqc == NULL)
+    return;
+
+  eqc->cw_op_is_set = false;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Set the initial values of the variable field taking into account
@@ -1475,6 +1682,9 @@ cs_cdovb_scaleq_solve_steady_state(bool                        cur2prev,
   if (eqb->init_step)
     eqb->init_step = false;
 
+  /* Cached cellwise operators are rebuilt if an update occurred */
+  _svb_update_operator_cache(eqp, eqc);
+
   /* Initialize the local system: matrix and rhs */
   cs_matrix_t  *matrix = cs_matrix_create(cs_shared_ms);
   cs_real_t  *rhs = NULL;
@@ -1597,6 +1807,10 @@ cs_cdovb_scaleq_solve_steady_state(bool                        cur2prev,
 
   } /* OPENMP Block */
 
+  /* Cached cellwise operators (if any) are now up-to-date */
+  if (eqc->cw_op_val != NULL)
+    eqc->cw_op_is_set = true;
+
   cs_matrix_assembler_values_done(mav); /* optional */
 
   /* Free temporary buffers and structures */
@@ -1692,6 +1906,9 @@ cs_cdovb_scaleq_solve_implicit(bool                        cur2prev,
   if (eqb->init_step)
     eqb->init_step = false;
 
+  /* Cached cellwise operators are rebuilt if an update occurred */
+  _svb_update_operator_cache(eqp, eqc);
+
   /* Initialize the local system: matrix and rhs */
   cs_matrix_t  *matrix = cs_matrix_create(cs_shared_ms);
   cs_real_t  *rhs = NULL;
@@ -1867,6 +2084,10 @@ cs_cdovb_scaleq_solve_implicit(bool                        cur2prev,
 
   } /* OPENMP Block */
 
+  /* Cached cellwise operators (if any) are now up-to-date */
+  if (eqc->cw_op_val != NULL)
+    eqc->cw_op_is_set = true;
+
   cs_matrix_assembler_values_done(mav); /* optional */
 
   /* Free temporary buffers and structures */
@@ -1960,6 +2181,9 @@ cs_cdovb_scaleq_solve_theta(bool                        cur2prev,
   _svb_setup(ts->t_cur + ts->dt[0], mesh, eqp, eqb, eqc->vtx_bc_flag,
              &dir_values, &forced_ids);
 
+  /* Cached cellwise operators are rebuilt if an update occurred */
+  _svb_update_operator_cache(eqp, eqc);
+
   /* Initialize the local system: rhs */
   cs_real_t  *rhs = NULL;
   BFT_MALLOC(rhs, n_vertices, cs_real_t);
@@ -2209,6 +2433,10 @@ cs_cdovb_scaleq_solve_theta(bool                        cur2prev,
 
   } /* OPENMP Block */
 
+  /* Cached cellwise operators (if any) are now up-to-date */
+  if (eqc->cw_op_val != NULL)
+    eqc->cw_op_is_set = true;
+
   cs_matrix_assembler_values_done(mav); /* optional */
 
   /* Free temporary buffers and structures */
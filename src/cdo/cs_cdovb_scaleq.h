@@ -141,6 +141,18 @@ cs_cdovb_scaleq_init_context(const cs_equation_param_t   *eqp,
 void *
 cs_cdovb_scaleq_free_context(void   *builder);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Invalidate the cached cellwise diffusion/advection operators (if
+ *         any) so that they are rebuilt during the next build of the system
+ *
+ * \param[in, out]  context   pointer to a cs_cdovb_scaleq_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdovb_scaleq_reset_operator_cache(void   *context);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Set the initial values of the variable field taking into account
@@ -1076,6 +1076,14 @@ cs_cdovb_vecteq_init_context(const cs_equation_param_t   *eqp,
   /* Array used for extra-operations */
   eqc->cell_values = NULL;
 
+  /* No cache of cellwise operators for vector-valued equations */
+  eqc->n_cached_cells = 0;
+  eqc->cw_op_idx = NULL;
+  eqc->cw_op_val = NULL;
+  eqc->cw_op_is_set = false;
+  for (int k = 0; k < 3; k++)
+    eqc->cw_op_counts[k] = -1;
+
   return eqc;
 }
 
@@ -2632,6 +2632,31 @@ cs_equation_current_to_previous(const cs_equation_t    *eq)
     cs_timer_stats_stop(eq->main_ts_id);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Invalidate the cached cellwise operators of an equation (if any)
+ *         so that they are rebuilt at the next solve. New definitions of
+ *         properties or advection fields and mesh updates are detected
+ *         automatically. This function is only needed when an existing
+ *         definition is modified in place during the computation.
+ *
+ * \param[in]   eq       pointer to a \ref cs_equation_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_reset_operator_cache(const cs_equation_t    *eq)
+{
+  if (eq == NULL)
+    bft_error(__FILE__, __LINE__, 0, "%s: Empty equation structure", __func__);
+
+  const cs_equation_param_t  *eqp = eq->param;
+
+  /* Only scalar-valued CDO-Vb schemes handle a cache up to now */
+  if (eqp->space_scheme == CS_SPACE_SCHEME_CDOVB && eqp->dim == 1)
+    cs_cdovb_scaleq_reset_operator_cache(eq->scheme_context);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  For a given equation, retrieve the related cellwise builder
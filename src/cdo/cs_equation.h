@@ -735,6 +735,21 @@ cs_equation_get_type(const cs_equation_t    *eq);
 void
 cs_equation_current_to_previous(const cs_equation_t    *eq);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Invalidate the cached cellwise operators of an equation (if any)
+ *         so that they are rebuilt at the next solve. New definitions of
+ *         properties or advection fields and mesh updates are detected
+ *         automatically. This function is only needed when an existing
+ *         definition is modified in place during the computation.
+ *
+ * \param[in]   eq       pointer to a \ref cs_equation_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_reset_operator_cache(const cs_equation_t    *eq);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  For a given equation, retrieve the related cellwise builder
@@ -952,6 +952,12 @@ _set_saturne_sles(cs_equation_param_t   *eqp)
     } /* Switch on the type of AMG */
     break; /* AMG as preconditioner */
 
+  case CS_PARAM_PRECOND_BJACOB_ILU0:
+  case CS_PARAM_PRECOND_ILU0:
+    poly_degree = -1;
+    pc = cs_sles_pc_ilu0_create();
+    break;
+
   case CS_PARAM_PRECOND_GKB_CG:
   case CS_PARAM_PRECOND_GKB_GMRES:
     poly_degree = -1;
@@ -1166,6 +1172,19 @@ _set_saturne_sles(cs_equation_param_t   *eqp)
 
   } /* AMG as preconditioner */
 
+  else if (pc != NULL) { /* ILU(0) as preconditioner */
+
+    /* Not used by stationary solvers */
+    if (   it != NULL
+        && slesp.solver != CS_PARAM_ITSOL_JACOBI
+        && slesp.solver != CS_PARAM_ITSOL_GAUSS_SEIDEL
+        && slesp.solver != CS_PARAM_ITSOL_SYM_GAUSS_SEIDEL)
+      cs_sles_it_transfer_pc(it, &pc);
+    else
+      cs_sles_pc_destroy(&pc);
+
+  }
+
   /* Define the level of verbosity for SLES structure */
   if (slesp.verbosity > 3) {
 
@@ -1517,6 +1536,10 @@ _set_key(const char            *label,
     }
     break;
 
+  case CS_EQKEY_OPERATOR_CACHE_SIZE:
+    eqp->operator_cache_size = atof(keyval);
+    break;
+
   case CS_EQKEY_PRECOND:
     if (strcmp(keyval, "none") == 0) {
       eqp->sles_param.precond = CS_PARAM_PRECOND_NONE;
@@ -1894,6 +1917,9 @@ cs_equation_create_param(const char            *name,
   /* Settings for the OpenMP strategy */
   eqp->omp_assembly_choice = CS_PARAM_ASSEMBLE_OMP_CRITICAL;
 
+  /* No cache of the cellwise operators by default */
+  eqp->operator_cache_size = 0.;
+
   return eqp;
 }
 
@@ -2033,6 +2059,7 @@ cs_equation_param_update_from(const cs_equation_param_t   *ref,
 
   /* Settings for performance */
   dst->omp_assembly_choice = ref->omp_assembly_choice;
+  dst->operator_cache_size = ref->operator_cache_size;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2368,6 +2395,10 @@ cs_equation_summary_param(const cs_equation_param_t   *eqp)
                     eqname, "atomic");
   }
 
+  if (eqp->operator_cache_size > 0)
+    cs_log_printf(CS_LOG_SETUP, "  * %s | Operator cache size: %g MB\n",
+                  eqname, eqp->operator_cache_size);
+
   /* Boundary conditions */
   cs_log_printf(CS_LOG_SETUP, "\n### %s | Boundary condition settings\n",
                 eqname);
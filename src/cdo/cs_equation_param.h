@@ -516,9 +516,15 @@ typedef struct {
    *
    * \var omp_assembly_choice
    * When OpenMP is active, choice of parallel reduction for the assembly
+   *
+   * \var operator_cache_size
+   * Memory budget (in MB) used to keep the cellwise operators which do not
+   * depend on time (diffusion and advection terms) from one time step to
+   * the next. A value lower or equal to 0 disables this cache.
    */
 
   cs_param_assemble_omp_strategy_t     omp_assembly_choice;
+  double                               operator_cache_size;
 
   /*! @} */
 
@@ -716,15 +722,26 @@ typedef struct {
  * Available choices are:
  * - "atomic" or "critical"
  *
+ * \var CS_EQKEY_OPERATOR_CACHE_SIZE
+ * Memory budget (in MB) for keeping the cellwise diffusion and advection
+ * operators across time steps when the related property and advection field
+ * are steady. Cells are cached in their numbering order until the budget is
+ * reached; the operators of the remaining cells are rebuilt at each time step.
+ * Only available with scalar-valued CDO vertex-based schemes up to now.
+ * - "0" (default) to disable the cache
+ * - Example: "512"
+ *
  * \var CS_EQKEY_PRECOND
  * Specify the preconditioner associated to an iterative solver. Available
  * choices are:
  * - "jacobi" --> diagonal preconditoner
- * - "block_jacobi" --> Only with PETSc
+ * - "block_jacobi" --> block Jacobi with ILU(0) in each block (with
+ *   Code_Saturne, each rank-local block uses the native ILU(0))
  * - "poly1" --> Neumann polynomial of order 1 (only with Code_Saturne)
  * - "poly2" --> Neumann polynomial of order 2 (only with Code_Saturne)
  * - "ssor" --> symmetric successive over-relaxation (only with PETSC)
- * - "ilu0" --> incomplete LU factorization (only with PETSc)
+ * - "ilu0" --> incomplete LU factorization (with Code_Saturne, this is
+ *   restricted to rank-local parts of the matrix, as for "block_jacobi")
  * - "icc0" --> incomplete Cholesky factorization (for symmetric matrices and
  *   only with PETSc)
  * - "amg" --> algebraic multigrid
@@ -788,6 +805,7 @@ typedef enum {
   CS_EQKEY_ITSOL_MAX_ITER,
   CS_EQKEY_ITSOL_RESNORM_TYPE,
   CS_EQKEY_OMP_ASSEMBLY_STRATEGY,
+  CS_EQKEY_OPERATOR_CACHE_SIZE,
   CS_EQKEY_PRECOND,
   CS_EQKEY_SLES_VERBOSITY,
   CS_EQKEY_SOLVER_FAMILY,
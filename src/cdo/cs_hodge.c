@@ -255,13 +255,14 @@ _check_vector_hodge(cs_lnum_t                c_id,
 /*----------------------------------------------------------------------------*/
 
 inline static void
-_partial_matvec(const int         i,
+_partial_matvec(const int         n_ent,
+                const int         i,
                 const cs_sdm_t   *dq_pq,
                 const double     *restrict vec,
                 double           *mvec)
 
 {
-  const int n_ent = dq_pq->n_rows;
+  assert(n_ent == dq_pq->n_rows);
 
   for (int irow = i; irow < n_ent; irow++) {
     const double  *restrict m_i = dq_pq->val + irow*n_ent;
@@ -670,6 +671,8 @@ _compute_cost_quant(const int               n_ent,
 /*!
  * \brief   Compute the discrete EpFd Hodge operator (the upper right part).
  *          Co+St algo. in case of isotropic material property.
+ *          Inlined version: n_ent is a compile-time constant for the most
+ *          common cell types (see the calling function)
  *
  * \param[in]      n_ent    number of local entities
  * \param[in]      dbeta2   space dim * squared value of the stabilization coef.
@@ -682,15 +685,15 @@ _compute_cost_quant(const int               n_ent,
  */
 /*----------------------------------------------------------------------------*/
 
-static void
-_compute_iso_hodge_ur(const int               n_ent,
-                      const double            dbeta2,
-                      const double            ovc,
-                      const cs_real_t         pty,
-                      const cs_real_3_t      *pq,
-                      const cs_real_3_t      *dq,
-                      cs_cell_builder_t      *cb,
-                      cs_sdm_t               *hmat)
+static inline void
+_compute_iso_hodge_ur_n(const int               n_ent,
+                        const double            dbeta2,
+                        const double            ovc,
+                        const cs_real_t         pty,
+                        const cs_real_3_t      *pq,
+                        const cs_real_3_t      *dq,
+                        cs_cell_builder_t      *cb,
+                        cs_sdm_t               *hmat)
 {
   const double  ptyc = pty*ovc;
 
@@ -734,7 +737,7 @@ _compute_iso_hodge_ur(const int               n_ent,
     for (int k = 0; k < n_ent;k++)
       kappa_pq_dqi[k] = kappa[k] * dqi_pq[k];
 
-    _partial_matvec(i, cb->aux, kappa_pq_dqi, stab);
+    _partial_matvec(n_ent, i, cb->aux, kappa_pq_dqi, stab);
 
     double  *hi = hmat->val + i*n_ent;
 
@@ -752,10 +755,60 @@ _compute_iso_hodge_ur(const int               n_ent,
   } /* Loop on rows (entities i) */
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Compute the discrete EpFd Hodge operator (the upper right part).
+ *          Co+St algo. in case of isotropic material property.
+ *          Dispatch to versions with a size known at compile time for the
+ *          most common cell types so that the small dense loops can be
+ *          unrolled and vectorized.
+ *
+ * \param[in]      n_ent    number of local entities
+ * \param[in]      dbeta2   space dim * squared value of the stabilization coef.
+ * \param[in]      ovc      reciprocal of the cell volume
+ * \param[in]      pty      values of the material pty in this cell
+ * \param[in]      pq       pointer to the first set of quantities
+ * \param[in]      dq       pointer to the second set of quantities
+ * \param[in, out] cb       temporary buffers
+ * \param[in, out] hmat     pointer to a cs_sdm_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_compute_iso_hodge_ur(const int               n_ent,
+                      const double            dbeta2,
+                      const double            ovc,
+                      const cs_real_t         pty,
+                      const cs_real_3_t      *pq,
+                      const cs_real_3_t      *dq,
+                      cs_cell_builder_t      *cb,
+                      cs_sdm_t               *hmat)
+{
+  switch (n_ent) {
+
+  case 4:   /* Faces of a tetrahedron */
+    _compute_iso_hodge_ur_n(4, dbeta2, ovc, pty, pq, dq, cb, hmat);
+    break;
+  case 6:   /* Edges of a tetrahedron or faces of a hexahedron */
+    _compute_iso_hodge_ur_n(6, dbeta2, ovc, pty, pq, dq, cb, hmat);
+    break;
+  case 12:  /* Edges of a hexahedron */
+    _compute_iso_hodge_ur_n(12, dbeta2, ovc, pty, pq, dq, cb, hmat);
+    break;
+
+  default:
+    _compute_iso_hodge_ur_n(n_ent, dbeta2, ovc, pty, pq, dq, cb, hmat);
+    break;
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Compute the discrete EpFd Hodge operator (the upper right part).
  *          Co+St algo. in case of anisotropic material property.
+ *          Inlined version: n_ent is a compile-time constant for the most
+ *          common cell types (see the calling function)
  *
  * \param[in]      n_ent    number of local entities
  * \param[in]      dbeta2   space dim * squared value of the stabilization coef.
@@ -768,15 +821,15 @@ _compute_iso_hodge_ur(const int               n_ent,
  */
 /*----------------------------------------------------------------------------*/
 
-static void
-_compute_aniso_hodge_ur(const int               n_ent,
-                        const double            dbeta2,
-                        const double            ovc,
-                        const cs_real_t         pty[3][3],
-                        const cs_real_3_t      *pq,
-                        const cs_real_3_t      *dq,
-                        cs_cell_builder_t      *cb,
-                        cs_sdm_t               *hmat)
+static inline void
+_compute_aniso_hodge_ur_n(const int               n_ent,
+                          const double            dbeta2,
+                          const double            ovc,
+                          const cs_real_t         pty[3][3],
+                          const cs_real_3_t      *pq,
+                          const cs_real_3_t      *dq,
+                          cs_cell_builder_t      *cb,
+                          cs_sdm_t               *hmat)
 {
   double  *kappa = cb->values;                /* size = n_ent */
   double  *kappa_pq_dqi = cb->values + n_ent; /* size = n_ent */
@@ -824,7 +877,7 @@ _compute_aniso_hodge_ur(const int               n_ent,
     for (int k = 0; k < n_ent; k++)
       kappa_pq_dqi[k] = kappa[k] * dqi_pq[k];
 
-    _partial_matvec(i, cb->aux, kappa_pq_dqi, stab);
+    _partial_matvec(n_ent, i, cb->aux, kappa_pq_dqi, stab);
 
     double  *hi = hmat->val + i*n_ent;
 
@@ -842,6 +895,54 @@ _compute_aniso_hodge_ur(const int               n_ent,
   } /* Loop on rows (entities i) */
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Compute the discrete EpFd Hodge operator (the upper right part).
+ *          Co+St algo. in case of anisotropic material property.
+ *          Dispatch to versions with a size known at compile time for the
+ *          most common cell types so that the small dense loops can be
+ *          unrolled and vectorized.
+ *
+ * \param[in]      n_ent    number of local entities
+ * \param[in]      dbeta2   space dim * squared value of the stabilization coef.
+ * \param[in]      ovc      reciprocal of the cell volume
+ * \param[in]      pty      values of the material pty in this cell
+ * \param[in]      pq       pointer to the first set of quantities
+ * \param[in]      dq       pointer to the second set of quantities
+ * \param[in, out] cb       temporary buffers
+ * \param[in, out] hmat     pointer to a cs_sdm_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_compute_aniso_hodge_ur(const int               n_ent,
+                        const double            dbeta2,
+                        const double            ovc,
+                        const cs_real_t         pty[3][3],
+                        const cs_real_3_t      *pq,
+                        const cs_real_3_t      *dq,
+                        cs_cell_builder_t      *cb,
+                        cs_sdm_t               *hmat)
+{
+  switch (n_ent) {
+
+  case 4:   /* Faces of a tetrahedron */
+    _compute_aniso_hodge_ur_n(4, dbeta2, ovc, pty, pq, dq, cb, hmat);
+    break;
+  case 6:   /* Edges of a tetrahedron or faces of a hexahedron */
+    _compute_aniso_hodge_ur_n(6, dbeta2, ovc, pty, pq, dq, cb, hmat);
+    break;
+  case 12:  /* Edges of a hexahedron */
+    _compute_aniso_hodge_ur_n(12, dbeta2, ovc, pty, pq, dq, cb, hmat);
+    break;
+
+  default:
+    _compute_aniso_hodge_ur_n(n_ent, dbeta2, ovc, pty, pq, dq, cb, hmat);
+    break;
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Compute the discrete Hodge operator (the upper right part).
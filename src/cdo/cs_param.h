@@ -480,7 +480,9 @@ typedef enum {
  * Variant with GMRES as inner solver.
  *
  * \var CS_PARAM_PRECOND_ILU0
- * Incomplute LU factorization (fill-in coefficient set to 0)
+ * Incomplute LU factorization (fill-in coefficient set to 0). With
+ * Code_Saturne's own solvers, the factorization is restricted to the
+ * rank-local part of the matrix (i.e. same as CS_PARAM_PRECOND_BJACOB_ILU0)
  *
  * \var CS_PARAM_PRECOND_ICC0
  * Incomplute Cholesky factorization (fill-in coefficient set to 0). This is
@@ -510,7 +512,7 @@ typedef enum {
   CS_PARAM_PRECOND_DIAG,
   CS_PARAM_PRECOND_GKB_CG,
   CS_PARAM_PRECOND_GKB_GMRES,
-  CS_PARAM_PRECOND_ILU0,        /*!< Only with PETSc */
+  CS_PARAM_PRECOND_ILU0,
   CS_PARAM_PRECOND_ICC0,        /*!< Only with PETSc*/
   CS_PARAM_PRECOND_POLY1,
   CS_PARAM_PRECOND_POLY2,
@@ -83,6 +83,9 @@ static int  _n_properties = 0;
 static int  _n_max_properties = 0;
 static cs_property_t  **_properties = NULL;
 
+/* Number of definitions added to properties (used to detect updates) */
+static int  _n_property_updates = 0;
+
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
 /*============================================================================
@@ -144,6 +147,8 @@ _add_new_def(cs_property_t     *pty)
 {
   int  new_id = pty->n_definitions;
 
+  _n_property_updates++;
+
   pty->n_definitions += 1;
   BFT_REALLOC(pty->defs, pty->n_definitions, cs_xdef_t *);
   BFT_REALLOC(pty->get_eval_at_cell, pty->n_definitions,
@@ -647,6 +652,22 @@ cs_property_get_n_properties(void)
   return _n_properties;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Retrieve the number of definitions added to properties so far.
+ *         A change of this value means that at least one property has been
+ *         updated, so that operators depending on properties may be rebuilt.
+ *
+ * \return the number of property updates
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_property_get_update_count(void)
+{
+  return _n_property_updates;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Create and initialize a new property structure
@@ -806,6 +827,42 @@ cs_property_by_id(int         id)
   return  _properties[id];
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Check if all the definitions of a property are steady, i.e. if
+ *         the property does not depend on time
+ *
+ * \param[in]  pty    pointer to a cs_property_t structure
+ *
+ * \return true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_property_is_steady(const cs_property_t   *pty)
+{
+  if (pty == NULL)
+    return true; /* Treated as the "unity" property */
+
+  if (pty->type & CS_PROPERTY_BY_PRODUCT) {
+
+    for (int i = 0; i < pty->n_related_properties; i++)
+      if (!cs_property_is_steady(pty->related_properties[i]))
+        return false;
+
+    return true;
+  }
+
+  if (pty->n_definitions < 1)
+    return false;
+
+  for (int i = 0; i < pty->n_definitions; i++)
+    if (!(pty->defs[i]->state & CS_FLAG_STATE_STEADY))
+      return false;
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Set optional parameters related to a cs_property_t structure
@@ -305,6 +305,19 @@ cs_property_set_shared_pointers(const cs_cdo_quantities_t    *quant,
 int
 cs_property_get_n_properties(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Retrieve the number of definitions added to properties so far.
+ *         A change of this value means that at least one property has been
+ *         updated, so that operators depending on properties may be rebuilt.
+ *
+ * \return the number of property updates
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_property_get_update_count(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Create and initialize a new property structure
@@ -367,6 +380,20 @@ cs_property_by_name(const char   *name);
 cs_property_t *
 cs_property_by_id(int         id);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Check if all the definitions of a property are steady, i.e. if
+ *         the property does not depend on time
+ *
+ * \param[in]  pty    pointer to a cs_property_t structure
+ *
+ * \return true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_property_is_steady(const cs_property_t   *pty);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Set optional parameters related to a cs_property_t structure
@@ -116,6 +116,75 @@ _create_sdm(cs_flag_t   flag,
   return mat;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Compute a dense matrix-vector product for a small square matrix.
+ *          Inlined version: n is a compile-time constant for the most common
+ *          sizes (see \ref cs_sdm_square_matvec)
+ *
+ * \param[in]      n      number of rows (and columns)
+ * \param[in]      m      matrix values (row-major)
+ * \param[in]      vec    local vector to use
+ * \param[in, out] mv     result of the local matrix-vector product
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_square_matvec_n(const int                  n,
+                 const cs_real_t  *restrict m,
+                 const cs_real_t  *restrict vec,
+                 cs_real_t        *restrict mv)
+{
+  for (int i = 0; i < n; i++) {
+    const cs_real_t  *restrict m_i = m + i*n;
+    cs_real_t  s = 0;
+    for (int j = 0; j < n; j++)
+      s += m_i[j] * vec[j];
+    mv[i] = s;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Compute a row-row matrix product c += a*b^T.
+ *          Inlined version: n_cols is a compile-time constant for the most
+ *          common sizes (see \ref cs_sdm_multiply_rowrow)
+ *
+ * \param[in]      n_cols    number of columns of a and b
+ * \param[in]      n_rows_a  number of rows of a
+ * \param[in]      n_rows_b  number of rows of b
+ * \param[in]      a         values of a (row-major)
+ * \param[in]      b         values of b (row-major)
+ * \param[in, out] c         values of c (row-major) which are updated
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_multiply_rowrow_n(const int                  n_cols,
+                   const int                  n_rows_a,
+                   const int                  n_rows_b,
+                   const cs_real_t  *restrict a,
+                   const cs_real_t  *restrict b,
+                   cs_real_t        *restrict c)
+{
+  for (int i = 0; i < n_rows_a; i++) {
+
+    const cs_real_t  *restrict a_i = a + i*n_cols;
+    cs_real_t  *restrict c_i = c + i*n_rows_b;
+
+    for (int j = 0; j < n_rows_b; j++) {
+
+      const cs_real_t  *restrict b_j = b + j*n_cols;
+
+      cs_real_t  dp = 0;
+      for (int k = 0; k < n_cols; k++)
+        dp += a_i[k] * b_j[k];
+      c_i[j] += dp;
+
+    } /* Loop on b rows */
+  } /* Loop on a rows */
+}
+
 /*============================================================================
  * Public function prototypes
  *============================================================================*/
@@ -629,6 +698,25 @@ cs_sdm_multiply_rowrow(const cs_sdm_t   *a,
          a->n_rows == c->n_rows &&
          c->n_cols == b->n_rows);
 
+  /* Specialized versions for the sizes related to the most common cell
+     types (tetrahedra, prisms, hexahedra) */
+  switch (a->n_cols) {
+
+  case 4:
+    _multiply_rowrow_n(4, a->n_rows, b->n_rows, a->val, b->val, c->val);
+    return;
+  case 6:
+    _multiply_rowrow_n(6, a->n_rows, b->n_rows, a->val, b->val, c->val);
+    return;
+  case 8:
+    _multiply_rowrow_n(8, a->n_rows, b->n_rows, a->val, b->val, c->val);
+    return;
+
+  default:
+    break;
+
+  }
+
   for (short int i = 0; i < a->n_rows; i++) {
 
     const cs_real_t  *av_i = a->val + i*a->n_cols;
@@ -836,6 +924,25 @@ cs_sdm_square_matvec(const cs_sdm_t    *mat,
 
   const int  n = mat->n_rows;
 
+  /* Specialized versions for the sizes related to the most common cell
+     types (tetrahedra, prisms, hexahedra) */
+  switch (n) {
+
+  case 4:
+    _square_matvec_n(4, mat->val, vec, mv);
+    return;
+  case 6:
+    _square_matvec_n(6, mat->val, vec, mv);
+    return;
+  case 8:
+    _square_matvec_n(8, mat->val, vec, mv);
+    return;
+
+  default:
+    break;
+
+  }
+
   /* Initialize mv */
   const cs_real_t  v = vec[0];
   for (short int i = 0; i < n; i++)
@@ -719,6 +719,8 @@ _update_extents(int               dim,
  *                         extent = base_extent * (1 + tolerance)
  *   extents           <-> extents associated with section:
  *                         x_min, y_min, ..., x_max, y_max, ... (size: 2*dim)
+ *   elt_extents_out   --> optional extents associated with each element
+ *                         (size: 2*dim*n_elements), or NULL
  *----------------------------------------------------------------------------*/
 
 static void
@@ -727,7 +729,8 @@ _nodal_section_extents(const fvm_nodal_section_t  *this_section,
                        const cs_lnum_t            *parent_vertex_num,
                        const cs_coord_t            vertex_coords[],
                        double                      tolerance,
-                       double                      extents[])
+                       double                      extents[],
+                       double                      elt_extents_out[])
 {
   cs_lnum_t   i, j, k, face_id, vertex_id;
   double elt_extents[6];
@@ -768,6 +771,11 @@ _nodal_section_extents(const fvm_nodal_section_t  *this_section,
       _elt_extents_finalize(dim, 3, tolerance, elt_extents);
       _update_extents(dim, elt_extents, extents);
 
+      if (elt_extents_out != NULL) {
+        for (k = 0; k < 2*dim; k++)
+          elt_extents_out[i*2*dim + k] = elt_extents[k];
+      }
+
     }
 
   }
@@ -800,6 +808,11 @@ _nodal_section_extents(const fvm_nodal_section_t  *this_section,
       _elt_extents_finalize(dim, 2, tolerance, elt_extents);
       _update_extents(dim, elt_extents, extents);
 
+      if (elt_extents_out != NULL) {
+        for (k = 0; k < 2*dim; k++)
+          elt_extents_out[i*2*dim + k] = elt_extents[k];
+      }
+
     }
 
   }
@@ -831,6 +844,11 @@ _nodal_section_extents(const fvm_nodal_section_t  *this_section,
                             elt_extents);
       _update_extents(dim, elt_extents, extents);
 
+      if (elt_extents_out != NULL) {
+        for (k = 0; k < 2*dim; k++)
+          elt_extents_out[i*2*dim + k] = elt_extents[k];
+      }
+
     }
   }
 }
@@ -1448,7 +1466,8 @@ fvm_nodal_extents(const fvm_nodal_t  *this_nodal,
                            this_nodal->parent_vertex_num,
                            this_nodal->vertex_coords,
                            tolerance,
-                           section_extents);
+                           section_extents,
+                           NULL);
 
     for (j = 0; j < this_nodal->dim; j++) {
       if (section_extents[j] < extents[j])
@@ -1459,6 +1478,59 @@ fvm_nodal_extents(const fvm_nodal_t  *this_nodal,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Compute extents of elements of a nodal mesh representation.
+ *
+ * Only elements of the highest entity dimension are considered, in the
+ * order of their sections.
+ *
+ * parameters:
+ *   this_nodal   <-- pointer to mesh representation structure
+ *   tolerance    <-- addition to local extents of each element:
+ *                    extent = base_extent * (1 + tolerance)
+ *   extents      --> extents associated with each element:
+ *                    x_min, y_min, ..., x_max, y_max, ...
+ *                    (size: 2*dim*n_elements)
+ *
+ * returns:
+ *   number of elements whose extents were computed
+ *----------------------------------------------------------------------------*/
+
+cs_lnum_t
+fvm_nodal_element_extents(const fvm_nodal_t  *this_nodal,
+                          double              tolerance,
+                          double              extents[])
+{
+  double section_extents[6];
+  cs_lnum_t n_elts = 0;
+
+  if (this_nodal == NULL)
+    return 0;
+
+  const int dim = this_nodal->dim;
+  const int max_entity_dim = fvm_nodal_get_max_entity_dim(this_nodal);
+
+  for (int i = 0; i < this_nodal->n_sections; i++) {
+
+    const fvm_nodal_section_t  *section = this_nodal->sections[i];
+
+    if (section->entity_dim != max_entity_dim)
+      continue;
+
+    _nodal_section_extents(section,
+                           dim,
+                           this_nodal->parent_vertex_num,
+                           this_nodal->vertex_coords,
+                           tolerance,
+                           section_extents,
+                           extents + 2*dim*n_elts);
+
+    n_elts += section->n_elements;
+  }
+
+  return n_elts;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
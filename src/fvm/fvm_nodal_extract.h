@@ -192,6 +192,29 @@ fvm_nodal_extents(const fvm_nodal_t  *this_nodal,
                   double              tolerance,
                   double              extents[]);
 
+/*----------------------------------------------------------------------------
+ * Compute extents of elements of a nodal mesh representation.
+ *
+ * Only elements of the highest entity dimension are considered, in the
+ * order of their sections.
+ *
+ * parameters:
+ *   this_nodal   <-- pointer to mesh representation structure
+ *   tolerance    <-- addition to local extents of each element:
+ *                    extent = base_extent * (1 + tolerance)
+ *   extents      --> extents associated with each element:
+ *                    x_min, y_min, ..., x_max, y_max, ...
+ *                    (size: 2*dim*n_elements)
+ *
+ * returns:
+ *   number of elements whose extents were computed
+ *----------------------------------------------------------------------------*/
+
+cs_lnum_t
+fvm_nodal_element_extents(const fvm_nodal_t  *this_nodal,
+                          double              tolerance,
+                          double              extents[]);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -90,6 +90,14 @@ enum {X, Y, Z};
 #define _DOT_PRODUCT_2D(vect1, vect2) \
   (vect1[X] * vect2[X] + vect1[Y] * vect2[Y])
 
+/* Number of points handled together by batched location tests */
+
+#define _LOCATE_BLOCK_SIZE 64
+
+/* Number of bits per coordinate used for binning points among threads */
+
+#define _THREAD_BIN_BITS 4
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -684,6 +692,8 @@ _build_octree_leaves(int                level,
  *
  * parameters:
  *   n_points        <-- number of points to locate
+ *   point_ids       <-- optional subset of point ids (0 to n-1), or NULL
+ *                       (size: n_points)
  *   point_coords    <-- point coordinates
  *
  * returns:
@@ -692,9 +702,11 @@ _build_octree_leaves(int                level,
 
 static _octree_t
 _build_octree(cs_lnum_t         n_points,
+              const cs_lnum_t   point_ids[],
               const cs_coord_t  point_coords[])
 {
   size_t i;
+  int j;
   cs_lnum_t point_range[2];
   _octree_t _octree;
 
@@ -713,16 +725,31 @@ _build_octree(cs_lnum_t         n_points,
 
   if (n_points > 0) {
 
-    _point_extents(3,
-                   n_points,
-                   NULL,
-                   point_coords,
-                   _octree.extents);
-
     BFT_MALLOC(_octree.point_ids, _octree.n_points, cs_lnum_t);
 
-    for (i = 0; i < _octree.n_points; i++)
-      _octree.point_ids[i] = i;
+    if (point_ids != NULL) {
+      for (i = 0; i < _octree.n_points; i++)
+        _octree.point_ids[i] = point_ids[i];
+    }
+    else {
+      for (i = 0; i < _octree.n_points; i++)
+        _octree.point_ids[i] = i;
+    }
+
+    for (j = 0; j < 3; j++) {
+      _octree.extents[j]     =  HUGE_VAL;
+      _octree.extents[j + 3] = -HUGE_VAL;
+    }
+
+    for (i = 0; i < _octree.n_points; i++) {
+      const cs_coord_t *p = point_coords + _octree.point_ids[i]*3;
+      for (j = 0; j < 3; j++) {
+        if (_octree.extents[j]     > p[j])
+          _octree.extents[j]     = p[j];
+        if (_octree.extents[j + 3] < p[j])
+          _octree.extents[j + 3] = p[j];
+      }
+    }
 
     BFT_MALLOC(point_ids_tmp, n_points, cs_lnum_t);
 
@@ -762,6 +789,88 @@ _free_octree(_octree_t *octree)
   BFT_FREE(octree->point_ids);
 }
 
+/*----------------------------------------------------------------------------
+ * Distribute 3d points among threads based on a coarse Morton (Z) order
+ * binning, so that each thread handles a spatially compact subset.
+ *
+ * Points are sorted by bin using a counting sort, then split into
+ * contiguous ranges of similar size.
+ *
+ * parameters:
+ *   n_threads    <-- number of threads
+ *   n_points     <-- number of points
+ *   point_coords <-- point coordinates
+ *   t_idx        --> start index of each thread's points in point_ids
+ *                    (size: n_threads + 1)
+ *   point_ids    --> point ids, ordered by thread (size: n_points)
+ *----------------------------------------------------------------------------*/
+
+static void
+_thread_point_partition(int               n_threads,
+                        cs_lnum_t         n_points,
+                        const cs_coord_t  point_coords[],
+                        cs_lnum_t         t_idx[],
+                        cs_lnum_t         point_ids[])
+{
+  const int n_bins = 1 << (3*_THREAD_BIN_BITS);
+  const int n_cells = 1 << _THREAD_BIN_BITS;
+
+  double extents[6], scale[3];
+  cs_lnum_t *bin_idx = NULL;
+  int *bin_id = NULL;
+
+  _point_extents(3, n_points, NULL, point_coords, extents);
+
+  for (int j = 0; j < 3; j++) {
+    double d = extents[j+3] - extents[j];
+    scale[j] = (d > 0) ? n_cells / d : 0;
+  }
+
+  BFT_MALLOC(bin_idx, n_bins + 1, cs_lnum_t);
+  BFT_MALLOC(bin_id, n_points, int);
+
+  /* Compute bin (interleaved coarse grid coordinates) for each point */
+
+# pragma omp parallel for if (n_points > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_points; i++) {
+    int code = 0;
+    for (int j = 0; j < 3; j++) {
+      int c = (point_coords[i*3 + j] - extents[j]) * scale[j];
+      if (c < 0)
+        c = 0;
+      else if (c >= n_cells)
+        c = n_cells - 1;
+      for (int b = 0; b < _THREAD_BIN_BITS; b++)
+        code |= ((c >> b) & 1) << (3*b + 2 - j);
+    }
+    bin_id[i] = code;
+  }
+
+  /* Counting sort */
+
+  for (int b = 0; b < n_bins + 1; b++)
+    bin_idx[b] = 0;
+
+  for (cs_lnum_t i = 0; i < n_points; i++)
+    bin_idx[bin_id[i] + 1] += 1;
+
+  for (int b = 0; b < n_bins; b++)
+    bin_idx[b+1] += bin_idx[b];
+
+  for (cs_lnum_t i = 0; i < n_points; i++) {
+    point_ids[bin_idx[bin_id[i]]] = i;
+    bin_idx[bin_id[i]] += 1;
+  }
+
+  BFT_FREE(bin_id);
+  BFT_FREE(bin_idx);
+
+  /* Split ordered points into ranges of similar size */
+
+  for (int t_id = 0; t_id < n_threads + 1; t_id++)
+    t_idx[t_id] = ((cs_gnum_t)n_points * (cs_gnum_t)t_id) / n_threads;
+}
+
 /*----------------------------------------------------------------------------
  * locate points in box defined by extents in an octant.
  *
@@ -1816,12 +1925,12 @@ _locate_in_tetra(cs_lnum_t         elt_num,
                  float             distance[])
 {
   double vol6;
-  double dist, max_dist;
-  int i, j, k;
+  int i;
 
-  double isop_0, isop_1, isop_2;
-  double t00, t10, t20, t01, t02, t03, t11, t12, t13, t21, t22, t23;
-  double v01[3], v02[3], v03[3], shapef[4];
+  double t01, t02, t03, t11, t12, t13, t21, t22, t23;
+  double c00, c01, c02, c10, c11, c12, c20, c21, c22;
+  double v01[3], v02[3], v03[3];
+  double b_dist[_LOCATE_BLOCK_SIZE];
 
   for (i = 0; i < 3; i++) {
     v01[i] = tetra_coords[1][i] - tetra_coords[0][i];
@@ -1836,55 +1945,83 @@ _locate_in_tetra(cs_lnum_t         elt_num,
   if (vol6 < _epsilon_denom)
     return;
 
-  for (k = 0; k < n_points_in_extents; k++) {
+  /* Cofactors do not depend on the point, so compute them only once */
 
-    i = points_in_extents[k];
+  t01  = - tetra_coords[0][0] + tetra_coords[1][0];
+  t02  = - tetra_coords[0][0] + tetra_coords[2][0];
+  t03  = - tetra_coords[0][0] + tetra_coords[3][0];
 
-    t00  =   point_coords[i*3]     - tetra_coords[0][0];
-    t10  =   point_coords[i*3 + 1] - tetra_coords[0][1];
-    t20  =   point_coords[i*3 + 2] - tetra_coords[0][2];
+  t11  = - tetra_coords[0][1] + tetra_coords[1][1];
+  t12  = - tetra_coords[0][1] + tetra_coords[2][1];
+  t13  = - tetra_coords[0][1] + tetra_coords[3][1];
 
-    t01  = - tetra_coords[0][0] + tetra_coords[1][0];
-    t02  = - tetra_coords[0][0] + tetra_coords[2][0];
-    t03  = - tetra_coords[0][0] + tetra_coords[3][0];
+  t21  = - tetra_coords[0][2] + tetra_coords[1][2];
+  t22  = - tetra_coords[0][2] + tetra_coords[2][2];
+  t23  = - tetra_coords[0][2] + tetra_coords[3][2];
 
-    t11  = - tetra_coords[0][1] + tetra_coords[1][1];
-    t12  = - tetra_coords[0][1] + tetra_coords[2][1];
-    t13  = - tetra_coords[0][1] + tetra_coords[3][1];
+  c00 = t12*t23 - t13*t22;
+  c01 = t02*t23 - t22*t03;
+  c02 = t02*t13 - t12*t03;
+  c10 = t11*t23 - t13*t21;
+  c11 = t01*t23 - t21*t03;
+  c12 = t01*t13 - t03*t11;
+  c20 = t11*t22 - t21*t12;
+  c21 = t01*t22 - t21*t02;
+  c22 = t01*t12 - t11*t02;
 
-    t21  = - tetra_coords[0][2] + tetra_coords[1][2];
-    t22  = - tetra_coords[0][2] + tetra_coords[2][2];
-    t23  = - tetra_coords[0][2] + tetra_coords[3][2];
+  /* Process points by blocks, computing distances in a vectorizable
+     loop, then updating location and distance arrays */
 
-    isop_0 = (  t00 * (t12*t23 - t13*t22)
-              - t10 * (t02*t23 - t22*t03)
-              + t20 * (t02*t13 - t12*t03)) / vol6;
-    isop_1 = (- t00 * (t11*t23 - t13*t21)
-              + t10 * (t01*t23 - t21*t03)
-              - t20 * (t01*t13 - t03*t11)) / vol6;
-    isop_2 = (  t00 * (t11*t22 - t21*t12)
-              - t10 * (t01*t22 - t21*t02)
-              + t20 * (t01*t12 - t11*t02)) / vol6;
+  for (cs_lnum_t s_id = 0;
+       s_id < n_points_in_extents;
+       s_id += _LOCATE_BLOCK_SIZE) {
 
-    shapef[0] = 1. - isop_0 - isop_1 - isop_2;
-    shapef[1] =      isop_0;
-    shapef[2] =               isop_1;
-    shapef[3] =                        isop_2;
+    const cs_lnum_t *_ids = points_in_extents + s_id;
+    const cs_lnum_t n = CS_MIN(_LOCATE_BLOCK_SIZE,
+                               n_points_in_extents - s_id);
 
-    max_dist = -1.0;
+#   pragma omp simd
+    for (cs_lnum_t k = 0; k < n; k++) {
 
-    for (j = 0; j < 4; j++){
+      const cs_coord_t *p = point_coords + _ids[k]*3;
 
-      dist = 2.*CS_ABS(shapef[j] - 0.5);
+      double t00  =   p[0] - tetra_coords[0][0];
+      double t10  =   p[1] - tetra_coords[0][1];
+      double t20  =   p[2] - tetra_coords[0][2];
+
+      double isop_0 = (  t00 * c00 - t10 * c01 + t20 * c02) / vol6;
+      double isop_1 = (- t00 * c10 + t10 * c11 - t20 * c12) / vol6;
+      double isop_2 = (  t00 * c20 - t10 * c21 + t20 * c22) / vol6;
+
+      double shapef[4] = {1. - isop_0 - isop_1 - isop_2,
+                          isop_0,
+                          isop_1,
+                          isop_2};
+
+      double max_dist = -1.0;
+
+      for (int j = 0; j < 4; j++) {
+        double dist = 2.*CS_ABS(shapef[j] - 0.5);
+        if (max_dist < dist)
+          max_dist = dist;
+      }
+
+      b_dist[k] = max_dist;
 
-      if (max_dist < dist)
-        max_dist = dist;
     }
 
-    if (   (max_dist > -0.5 && max_dist < (1. + 2.*tolerance))
-        && (max_dist < distance[i] || distance[i] < 0)) {
-      location[i] = elt_num;
-      distance[i] = max_dist;
+    for (cs_lnum_t k = 0; k < n; k++) {
+
+      double max_dist = b_dist[k];
+
+      i = _ids[k];
+
+      if (   (max_dist > -0.5 && max_dist < (1. + 2.*tolerance))
+          && (max_dist < distance[i] || distance[i] < 0)) {
+        location[i] = elt_num;
+        distance[i] = max_dist;
+      }
+
     }
 
   }
@@ -2153,6 +2290,154 @@ _compute_uvw(fvm_element_t      elt_type,
   return 0;
 }
 
+/*----------------------------------------------------------------------------
+ * Locate points in a hexahedron whose coordinates are pre-computed,
+ * updating the location[] and distance[] arrays associated with a set
+ * of points.
+ *
+ * This is a batched variant of _compute_uvw() for hexahedra: Newton
+ * iterations are run simultaneously for blocks of points, so that the
+ * per-point operations may be vectorized. Results are the same as those
+ * of the per-point algorithm.
+ *
+ * parameters:
+ *   elt_num             <-- element number
+ *   vertex_coords[]     <-- hexahedron vertex coordinates
+ *   point_coords        <-- point coordinates
+ *   n_points_in_extents <-- number of points in element extents
+ *   points_in_extents   <-- ids of points in extents
+ *   tolerance           <-- associated tolerance
+ *   location            <-> number of element containing or closest to each
+ *                           point (size: n_points)
+ *   distance            <-> distance from point to element indicated by
+ *                           location[]: < 0 if unlocated, 0 - 1 if inside,
+ *                           > 1 if outside (size: n_points)
+ *----------------------------------------------------------------------------*/
+
+static void
+_locate_in_hexa(cs_lnum_t         elt_num,
+                double            vertex_coords[8][3],
+                const cs_coord_t  point_coords[],
+                cs_lnum_t         n_points_in_extents,
+                const cs_lnum_t   points_in_extents[],
+                double            tolerance,
+                cs_lnum_t         location[],
+                float             distance[])
+{
+  const int max_iter = 20;
+
+  double b_uvw[_LOCATE_BLOCK_SIZE][3];
+  int    b_state[_LOCATE_BLOCK_SIZE]; /* 0: active, 1: converged, -1: failed */
+
+  for (cs_lnum_t s_id = 0;
+       s_id < n_points_in_extents;
+       s_id += _LOCATE_BLOCK_SIZE) {
+
+    const cs_lnum_t *_ids = points_in_extents + s_id;
+    const cs_lnum_t n = CS_MIN(_LOCATE_BLOCK_SIZE,
+                               n_points_in_extents - s_id);
+
+    for (cs_lnum_t k = 0; k < n; k++) {
+      b_uvw[k][0] = 0.5;
+      b_uvw[k][1] = 0.5;
+      b_uvw[k][2] = 0.5;
+      b_state[k] = 0;
+    }
+
+    /* Newton iterations, in lockstep for all points of block */
+
+    for (int iter = 0; iter < max_iter; iter++) {
+
+      int n_active = 0;
+
+#     pragma omp simd reduction(+:n_active)
+      for (cs_lnum_t k = 0; k < n; k++) {
+
+        if (b_state[k] != 0)
+          continue;
+
+        const cs_coord_t *p = point_coords + _ids[k]*3;
+        double a[3][3], b[3], x[3], shapef[8], dw[8][3];
+
+        _compute_shapef_3d(FVM_CELL_HEXA, b_uvw[k], shapef, dw);
+
+        b[0] = - p[0];
+        b[1] = - p[1];
+        b[2] = - p[2];
+
+        for (int i = 0; i < 3; i++) {
+          for (int j = 0; j < 3; j++)
+            a[i][j] = 0.0;
+        }
+
+        for (int i = 0; i < 8; i++) {
+
+          b[0] += (shapef[i] * vertex_coords[i][0]);
+          b[1] += (shapef[i] * vertex_coords[i][1]);
+          b[2] += (shapef[i] * vertex_coords[i][2]);
+
+          for (int j = 0; j < 3; j++) {
+            a[0][j] -= (dw[i][j] * vertex_coords[i][0]);
+            a[1][j] -= (dw[i][j] * vertex_coords[i][1]);
+            a[2][j] -= (dw[i][j] * vertex_coords[i][2]);
+          }
+
+        }
+
+        if (_inverse_3x3(a, b, x)) {
+          b_state[k] = -1;
+          continue;
+        }
+
+        double dist = 0.0;
+
+        for (int i = 0; i < 3; i++) {
+          dist += x[i] * x[i];
+          b_uvw[k][i] += x[i];
+        }
+
+        if (dist <= (tolerance * tolerance))
+          b_state[k] = 1;
+        else
+          n_active += 1;
+
+      }
+
+      if (n_active == 0)
+        break;
+
+    }
+
+    /* Update location and distance arrays for converged points;
+       for hexahedra, the 3 parametric coordinates are used directly */
+
+    for (cs_lnum_t k = 0; k < n; k++) {
+
+      if (b_state[k] != 1)
+        continue;
+
+      double max_dist = -1.0;
+
+      for (int j = 0; j < 3; j++) {
+        double dist = 2.*CS_ABS(b_uvw[k][j] - 0.5);
+        if (max_dist < dist)
+          max_dist = dist;
+      }
+
+      cs_lnum_t i = _ids[k];
+
+      if (   (max_dist > -0.5 && max_dist < (1. + 2.*tolerance))
+          && (max_dist < distance[i] || distance[i] < 0)) {
+        location[i] = elt_num;
+        distance[i] = max_dist;
+      }
+
+    }
+
+  }
+
+}
+
 /*----------------------------------------------------------------------------
  * Locate points in a given 3d cell (other than tetrahedra or polyhedra,
  * handled elsewhere), updating the location[] and distance[] arrays
@@ -2223,7 +2508,20 @@ _locate_in_cell_3d(cs_lnum_t          elt_num,
                      location,
                      distance);
 
-  /* For cell shapes other than tetrahedra, find shape functions iteratively */
+  /* For hexahedra, find parametric coordinates iteratively, by blocks */
+
+  else if (elt_type == FVM_CELL_HEXA)
+
+    _locate_in_hexa(elt_num,
+                    _vertex_coords,
+                    point_coords,
+                    n_points_in_extents,
+                    points_in_extents,
+                    tolerance,
+                    location,
+                    distance);
+
+  /* For other cell shapes, find shape functions iteratively */
 
   else {
 
@@ -2239,35 +2537,16 @@ _locate_in_cell_3d(cs_lnum_t          elt_num,
 
         max_dist = -1.0;
 
-        /* For hexahedra, no need to compute shape functions, as
-           the 3 parametric coordinates are simpler to use */
-
-        if (elt_type == FVM_CELL_HEXA) {
-
-          for (j = 0; j < 3; j++){
-
-            dist = 2.*CS_ABS(uvw[j] - 0.5);
-
-            if (max_dist < dist)
-              max_dist = dist;
-          }
-
-        }
-
         /* For pyramids ands prisms, we need to compute shape functions */
 
-        else {
-
-          _compute_shapef_3d(elt_type, uvw, shapef, NULL);
+        _compute_shapef_3d(elt_type, uvw, shapef, NULL);
 
-          for (j = 0; j < n_vertices; j++){
+        for (j = 0; j < n_vertices; j++){
 
-            dist = 2.*CS_ABS(shapef[j] - 0.5);
+          dist = 2.*CS_ABS(shapef[j] - 0.5);
 
           if (max_dist < dist)
             max_dist = dist;
-          }
-
         }
 
         /* For all element types, update location and distance arrays */
@@ -3283,40 +3562,90 @@ fvm_point_location_nodal(const fvm_nodal_t  *this_nodal,
 
   BFT_MALLOC(points_in_extents, n_points, cs_lnum_t);
 
-  /* Use octree for 3d point location */
+  /* Use octree for 3d point location.
+
+     When using multiple threads, points are distributed among threads,
+     each thread building an octree for its own points and running the
+     element loop for those points only, so that location[] and distance[]
+     updates never conflict, and results do not depend on the number
+     of threads. */
 
   if (this_nodal->dim == 3) {
 
-    _octree_t  octree = _build_octree(n_points, point_coords);
+    int n_threads = 1;
+    cs_lnum_t *t_idx = NULL, *t_point_ids = NULL;
 
-    /* Locate for all sections */
+#if defined(HAVE_OPENMP)
+    if (!omp_in_parallel() && n_points > CS_THR_MIN)
+      n_threads = CS_MIN(cs_glob_n_threads, n_points / CS_THR_MIN);
+#endif
 
-    for (i = 0; i < this_nodal->n_sections; i++) {
+    if (n_threads > 1) {
+      BFT_MALLOC(t_idx, n_threads + 1, cs_lnum_t);
+      BFT_MALLOC(t_point_ids, n_points, cs_lnum_t);
+      _thread_point_partition(n_threads,
+                              n_points,
+                              point_coords,
+                              t_idx,
+                              t_point_ids);
+    }
 
-      const fvm_nodal_section_t  *this_section = this_nodal->sections[i];
+#   pragma omp parallel if (n_threads > 1) num_threads(n_threads)
+    {
+      cs_lnum_t t_n_points = n_points;
+      cs_lnum_t *_point_ids = NULL;
+      cs_lnum_t *_points_in_extents = points_in_extents;
+      cs_lnum_t _base_element_num = base_element_num;
+
+#if defined(HAVE_OPENMP)
+      if (n_threads > 1) {
+        int t_id = omp_get_thread_num();
+        t_n_points = t_idx[t_id + 1] - t_idx[t_id];
+        _point_ids = t_point_ids + t_idx[t_id];
+        BFT_MALLOC(_points_in_extents, t_n_points, cs_lnum_t);
+      }
+#endif
 
-      if (this_section->entity_dim == max_entity_dim) {
+      _octree_t  octree = _build_octree(t_n_points, _point_ids, point_coords);
 
-        _nodal_section_locate_3d(this_section,
-                                 this_nodal->parent_vertex_num,
-                                 this_nodal->vertex_coords,
-                                 tolerance,
-                                 base_element_num,
-                                 point_tag,
-                                 point_coords,
-                                 &octree,
-                                 points_in_extents,
-                                 location,
-                                 distance);
+      /* Locate for all sections */
 
-        if (base_element_num > -1)
-          base_element_num += this_section->n_elements;
+      for (int s_id = 0; s_id < this_nodal->n_sections; s_id++) {
+
+        const fvm_nodal_section_t  *this_section = this_nodal->sections[s_id];
+
+        if (t_n_points < 1)
+          break;
+
+        if (this_section->entity_dim == max_entity_dim) {
+
+          _nodal_section_locate_3d(this_section,
+                                   this_nodal->parent_vertex_num,
+                                   this_nodal->vertex_coords,
+                                   tolerance,
+                                   _base_element_num,
+                                   point_tag,
+                                   point_coords,
+                                   &octree,
+                                   _points_in_extents,
+                                   location,
+                                   distance);
+
+          if (_base_element_num > -1)
+            _base_element_num += this_section->n_elements;
+
+        }
 
       }
 
+      _free_octree(&octree);
+
+      if (_points_in_extents != points_in_extents)
+        BFT_FREE(_points_in_extents);
     }
 
-    _free_octree(&octree);
+    BFT_FREE(t_point_ids);
+    BFT_FREE(t_idx);
   }
 
   /* Use quadtree for 2d point location */
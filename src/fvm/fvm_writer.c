@@ -40,6 +40,10 @@
 #include <dlfcn.h>
 #endif
 
+#if defined(HAVE_PTHREAD)
+#include <pthread.h>
+#endif
+
 /*----------------------------------------------------------------------------
  *  Local headers
  *----------------------------------------------------------------------------*/
@@ -87,10 +91,6 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
-/*============================================================================
- * Local Type Definitions
- *============================================================================*/
-
 /*============================================================================
  * Local macro definitions
  *============================================================================*/
@@ -101,6 +101,83 @@ BEGIN_C_DECLS
 
 #define DIR_SEPARATOR '/'
 
+/* Asynchronous output requires POSIX threads, and OpenMP locks
+   for thread-safe memory management */
+
+#if defined(HAVE_PTHREAD) && defined(HAVE_OPENMP)
+#define FVM_WRITER_HAVE_ASYNC 1
+#endif
+
+/*============================================================================
+ * Local Type Definitions
+ *============================================================================*/
+
+#if defined(FVM_WRITER_HAVE_ASYNC)
+
+/* Type of queued output operation */
+
+typedef enum {
+
+  FVM_WRITER_TASK_FIELD,        /* Export field values */
+  FVM_WRITER_TASK_FLUSH         /* Flush format writers */
+
+} fvm_writer_task_type_t;
+
+/* Queued output operation (with a private copy of field values) */
+
+typedef struct _fvm_writer_task_t {
+
+  fvm_writer_task_type_t   type;              /* Operation type */
+
+  int                      n_format_writers;  /* Number of format writers */
+  void                   **format_writer;     /* Associated format writers */
+
+  const fvm_nodal_t       *mesh;              /* Associated mesh */
+  char                    *name;              /* Variable name */
+  fvm_writer_var_loc_t     location;          /* Variable location */
+  int                      dimension;         /* Variable dimension */
+  cs_interlace_t           interlace;         /* Variable interlace */
+  int                      n_parent_lists;    /* Number of parent lists */
+  cs_lnum_t               *parent_num_shift;  /* Parent number shifts */
+  cs_datatype_t            datatype;          /* Variable data type */
+  int                      time_step;         /* Time step number */
+  double                   time_value;        /* Time value */
+
+  int                      n_values;          /* Number of value arrays */
+  void                   **values;            /* Staged value arrays */
+
+  struct _fvm_writer_task_t  *next;           /* Next queued operation */
+
+} fvm_writer_task_t;
+
+/* Asynchronous output state (one I/O thread per writer) */
+
+typedef struct _fvm_writer_async_t {
+
+  pthread_t            thread;          /* Background I/O thread */
+  pthread_mutex_t      mutex;           /* Lock for queue and timers */
+  pthread_cond_t       queued;          /* Signaled when a task is queued */
+  pthread_cond_t       done;            /* Signaled when a task is done */
+
+  fvm_writer_task_t   *head;            /* First queued task */
+  fvm_writer_task_t   *tail;            /* Last queued task */
+  int                  n_tasks;         /* Number of queued or running
+                                           tasks */
+  int                  n_flush_queued;  /* Number of queued flushes */
+  int                  n_flush_done;    /* Number of completed flushes */
+  bool                 stop;            /* Request thread termination */
+
+#if defined(HAVE_MPI)
+  MPI_Comm             comm;            /* Communicator used by format
+                                           writers (duplicated so that
+                                           operations in the I/O thread do
+                                           not interfere with others) */
+#endif
+
+} fvm_writer_async_t;
+
+#endif /* defined(FVM_WRITER_HAVE_ASYNC) */
+
 /*============================================================================
  * Static and constant variables
  *============================================================================*/
@@ -712,11 +789,16 @@ _format_writer_init(fvm_writer_t  *this_writer,
     cs_fp_exception_disable_trap();
 
 #if defined(HAVE_MPI)
+    MPI_Comm comm = cs_glob_mpi_comm;
+#if defined(FVM_WRITER_HAVE_ASYNC)
+    if (this_writer->async != NULL)
+      comm = this_writer->async->comm;
+#endif
     format_writer = init_func(name,
                               path,
                               this_writer->options,
                               this_writer->time_dep,
-                              cs_glob_mpi_comm);
+                              comm);
 #else
     format_writer = init_func(name,
                               path,
@@ -769,6 +851,8 @@ _find_or_add_format_writer(fvm_writer_t        *this_writer,
         break;
     }
     if (i >= this_writer->n_format_writers) {
+      /* Format writer initialization may require collective operations */
+      fvm_writer_sync(this_writer);
       BFT_REALLOC(this_writer->format_writer, i + 1, void *);
       BFT_REALLOC(this_writer->mesh_names, i + 1, char *);
       BFT_MALLOC(this_writer->mesh_names[i], strlen(name) + 1, char);
@@ -784,6 +868,529 @@ _find_or_add_format_writer(fvm_writer_t        *this_writer,
   return format_writer;
 }
 
+#if defined(FVM_WRITER_HAVE_ASYNC)
+
+/*----------------------------------------------------------------------------
+ * Update the number of values referenced in each parent value array
+ * for a given list of entities.
+ *
+ * parameters:
+ *   n_ents           <-- number of entities
+ *   parent_num       <-- parent entity numbers (1 to n), or NULL
+ *   n_parent_lists   <-- number of parent lists
+ *   parent_num_shift <-- parent number to value array index shifts;
+ *                        size: n_parent_lists
+ *   n_vals           <-> number of values in each parent value array;
+ *                        size: n_parent_lists
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_update_parent_n_vals(cs_lnum_t        n_ents,
+                            const cs_lnum_t  parent_num[],
+                            int              n_parent_lists,
+                            const cs_lnum_t  parent_num_shift[],
+                            cs_lnum_t        n_vals[])
+{
+  for (cs_lnum_t j = 0; j < n_ents; j++) {
+    int pl;
+    cs_lnum_t parent_id = (parent_num != NULL) ? parent_num[j] - 1 : j;
+    for (pl = n_parent_lists - 1;
+         pl > 0 && parent_id < parent_num_shift[pl];
+         pl--);
+    parent_id -= parent_num_shift[pl];
+    if (parent_id >= n_vals[pl])
+      n_vals[pl] = parent_id + 1;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the number of values referenced in each field value array
+ * for a given field output, following the same access rules as
+ * fvm_convert_array().
+ *
+ * parameters:
+ *   mesh             <-- pointer to associated nodal mesh structure
+ *   location         <-- variable definition location
+ *   n_parent_lists   <-- number of parent lists
+ *   parent_num_shift <-- parent number to value array index shifts;
+ *                        size: n_parent_lists
+ *   n_vals           --> number of values in each value array
+ *                        size: max(n_parent_lists, 1)
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_field_n_vals(const fvm_nodal_t     *mesh,
+                    fvm_writer_var_loc_t   location,
+                    int                    n_parent_lists,
+                    const cs_lnum_t        parent_num_shift[],
+                    cs_lnum_t              n_vals[])
+{
+  for (int i = 0; i < CS_MAX(n_parent_lists, 1); i++)
+    n_vals[i] = 0;
+
+  /* Values per element (only entities of highest dimension are output) */
+
+  if (location == FVM_WRITER_PER_ELEMENT) {
+
+    const int entity_dim = fvm_nodal_get_max_entity_dim(mesh);
+
+    for (int s_id = 0; s_id < mesh->n_sections; s_id++) {
+      const fvm_nodal_section_t  *section = mesh->sections[s_id];
+      if (section->entity_dim != entity_dim)
+        continue;
+      if (n_parent_lists == 0)
+        n_vals[0] += section->n_elements;
+      else
+        _async_update_parent_n_vals(section->n_elements,
+                                    section->parent_element_num,
+                                    n_parent_lists,
+                                    parent_num_shift,
+                                    n_vals);
+    }
+
+  }
+
+  /* Values per node or particle */
+
+  else {
+
+    if (n_parent_lists == 0)
+      n_vals[0] = mesh->n_vertices;
+    else
+      _async_update_parent_n_vals(mesh->n_vertices,
+                                  mesh->parent_vertex_num,
+                                  n_parent_lists,
+                                  parent_num_shift,
+                                  n_vals);
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Create a field output task, with a private copy of field values.
+ *
+ * parameters: see fvm_writer_export_field().
+ *
+ * returns:
+ *   pointer to newly created task
+ *----------------------------------------------------------------------------*/
+
+static fvm_writer_task_t *
+_async_task_field_create(void                         *format_writer,
+                         const fvm_nodal_t            *mesh,
+                         const char                   *name,
+                         fvm_writer_var_loc_t          location,
+                         int                           dimension,
+                         cs_interlace_t                interlace,
+                         int                           n_parent_lists,
+                         const cs_lnum_t               parent_num_shift[],
+                         cs_datatype_t                 datatype,
+                         int                           time_step,
+                         double                        time_value,
+                         const void             *const field_values[])
+{
+  fvm_writer_task_t  *task;
+
+  BFT_MALLOC(task, 1, fvm_writer_task_t);
+
+  task->type = FVM_WRITER_TASK_FIELD;
+
+  task->n_format_writers = 1;
+  BFT_MALLOC(task->format_writer, 1, void *);
+  task->format_writer[0] = format_writer;
+
+  task->mesh = mesh;
+  BFT_MALLOC(task->name, strlen(name) + 1, char);
+  strcpy(task->name, name);
+  task->location = location;
+  task->dimension = dimension;
+  task->interlace = interlace;
+  task->n_parent_lists = n_parent_lists;
+  task->parent_num_shift = NULL;
+  if (n_parent_lists > 0) {
+    BFT_MALLOC(task->parent_num_shift, n_parent_lists, cs_lnum_t);
+    for (int i = 0; i < n_parent_lists; i++)
+      task->parent_num_shift[i] = parent_num_shift[i];
+  }
+  task->datatype = datatype;
+  task->time_step = time_step;
+  task->time_value = time_value;
+
+  /* Stage values (one array per parent list, or per parent list
+     and component for non-interlaced values) */
+
+  const int n_lists = CS_MAX(n_parent_lists, 1);
+  const int n_comp_arrays = (interlace == CS_INTERLACE) ? 1 : dimension;
+  const size_t elt_size = cs_datatype_size[datatype];
+
+  cs_lnum_t *n_vals;
+  BFT_MALLOC(n_vals, n_lists, cs_lnum_t);
+
+  _async_field_n_vals(mesh, location, n_parent_lists, parent_num_shift,
+                      n_vals);
+
+  task->n_values = n_lists * n_comp_arrays;
+  BFT_MALLOC(task->values, task->n_values, void *);
+
+  for (int pl = 0; pl < n_lists; pl++) {
+    size_t size = (size_t)n_vals[pl] * elt_size;
+    if (interlace == CS_INTERLACE)
+      size *= dimension;
+    for (int j = 0; j < n_comp_arrays; j++) {
+      int k = pl*n_comp_arrays + j;
+      unsigned char *_values = NULL;
+      if (size > 0 && field_values[k] != NULL) {
+        BFT_MALLOC(_values, size, unsigned char);
+        memcpy(_values, field_values[k], size);
+      }
+      task->values[k] = _values;
+    }
+  }
+
+  BFT_FREE(n_vals);
+
+  task->next = NULL;
+
+  return task;
+}
+
+/*----------------------------------------------------------------------------
+ * Create a flush task.
+ *
+ * parameters:
+ *   this_writer <-- pointer to mesh and field output writer
+ *
+ * returns:
+ *   pointer to newly created task
+ *----------------------------------------------------------------------------*/
+
+static fvm_writer_task_t *
+_async_task_flush_create(const fvm_writer_t  *this_writer)
+{
+  fvm_writer_task_t  *task;
+
+  BFT_MALLOC(task, 1, fvm_writer_task_t);
+
+  memset(task, 0, sizeof(fvm_writer_task_t));
+
+  task->type = FVM_WRITER_TASK_FLUSH;
+
+  task->n_format_writers = this_writer->n_format_writers;
+  BFT_MALLOC(task->format_writer, task->n_format_writers, void *);
+  for (int i = 0; i < this_writer->n_format_writers; i++)
+    task->format_writer[i] = this_writer->format_writer[i];
+
+  task->next = NULL;
+
+  return task;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a task.
+ *
+ * parameters:
+ *   task <-> pointer to task structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_task_destroy(fvm_writer_task_t  *task)
+{
+  for (int i = 0; i < task->n_values; i++)
+    BFT_FREE(task->values[i]);
+  BFT_FREE(task->values);
+
+  BFT_FREE(task->parent_num_shift);
+  BFT_FREE(task->name);
+  BFT_FREE(task->format_writer);
+
+  BFT_FREE(task);
+}
+
+/*----------------------------------------------------------------------------
+ * Run a task (called from the background I/O thread).
+ *
+ * Floating-point exception trapping is already disabled for this thread,
+ * as it inherits the environment of the thread which created it.
+ *
+ * parameters:
+ *   this_writer <-> pointer to mesh and field output writer
+ *   task        <-- pointer to task structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_task_run(fvm_writer_t       *this_writer,
+                fvm_writer_task_t  *task)
+{
+  fvm_writer_async_t  *async = this_writer->async;
+  cs_timer_counter_t  *counter = NULL;
+
+  cs_timer_t t0 = cs_timer_time();
+
+  if (task->type == FVM_WRITER_TASK_FIELD) {
+
+    fvm_writer_export_field_t  *export_field_func
+      = this_writer->format->export_field_func;
+
+    if (export_field_func != NULL)
+      export_field_func(task->format_writer[0],
+                        task->mesh,
+                        task->name,
+                        task->location,
+                        task->dimension,
+                        task->interlace,
+                        task->n_parent_lists,
+                        task->parent_num_shift,
+                        task->datatype,
+                        task->time_step,
+                        task->time_value,
+                        (const void *const *)task->values);
+
+    counter = &(this_writer->field_time);
+
+  }
+  else { /* if (task->type == FVM_WRITER_TASK_FLUSH) */
+
+    fvm_writer_flush_t  *flush_func = this_writer->format->flush_func;
+
+    if (flush_func != NULL) {
+      for (int i = 0; i < task->n_format_writers; i++)
+        flush_func(task->format_writer[i]);
+    }
+
+    counter = &(this_writer->flush_time);
+
+  }
+
+  cs_timer_t t1 = cs_timer_time();
+
+  pthread_mutex_lock(&(async->mutex));
+  cs_timer_counter_add_diff(counter, &t0, &t1);
+  pthread_mutex_unlock(&(async->mutex));
+}
+
+/*----------------------------------------------------------------------------
+ * Main function of the background I/O thread.
+ *
+ * Tasks are run in the order in which they were queued, until
+ * termination is requested and the queue is empty.
+ *
+ * parameters:
+ *   arg <-> pointer to mesh and field output writer
+ *
+ * returns:
+ *   NULL pointer
+ *----------------------------------------------------------------------------*/
+
+static void *
+_async_thread_main(void  *arg)
+{
+  fvm_writer_t  *this_writer = arg;
+  fvm_writer_async_t  *async = this_writer->async;
+
+  pthread_mutex_lock(&(async->mutex));
+
+  while (true) {
+
+    while (async->head == NULL && async->stop == false)
+      pthread_cond_wait(&(async->queued), &(async->mutex));
+
+    fvm_writer_task_t  *task = async->head;
+
+    if (task == NULL)
+      break;
+
+    /* Run task without holding the lock, so that other tasks
+       may be queued in the meantime */
+
+    pthread_mutex_unlock(&(async->mutex));
+
+    _async_task_run(this_writer, task);
+
+    pthread_mutex_lock(&(async->mutex));
+
+    async->head = task->next;
+    if (async->head == NULL)
+      async->tail = NULL;
+    async->n_tasks -= 1;
+    if (task->type == FVM_WRITER_TASK_FLUSH)
+      async->n_flush_done += 1;
+
+    _async_task_destroy(task);
+
+    pthread_cond_broadcast(&(async->done));
+
+  }
+
+  pthread_mutex_unlock(&(async->mutex));
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Append a task to the queue of the background I/O thread.
+ *
+ * parameters:
+ *   async <-> pointer to asynchronous output state
+ *   task  <-- pointer to task structure (ownership is transferred)
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_queue(fvm_writer_async_t  *async,
+             fvm_writer_task_t   *task)
+{
+  pthread_mutex_lock(&(async->mutex));
+
+  if (async->tail != NULL)
+    async->tail->next = task;
+  else
+    async->head = task;
+  async->tail = task;
+
+  async->n_tasks += 1;
+  if (task->type == FVM_WRITER_TASK_FLUSH)
+    async->n_flush_queued += 1;
+
+  pthread_cond_signal(&(async->queued));
+
+  pthread_mutex_unlock(&(async->mutex));
+}
+
+/*----------------------------------------------------------------------------
+ * Check if asynchronous output may be used for a given format.
+ *
+ * parameters:
+ *   format <-- pointer to format information structure
+ *
+ * returns:
+ *   true if asynchronous output is possible, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_async_is_possible(const fvm_writer_format_t  *format)
+{
+  /* External libraries are not assumed to be thread-safe */
+
+  if (format->info_mask & FVM_WRITER_FORMAT_USE_EXTERNAL)
+    return false;
+
+  /* MPI calls will be made concurrently from the I/O thread */
+
+#if defined(HAVE_MPI)
+  if (cs_glob_mpi_comm != MPI_COMM_NULL) {
+    int thread_level = MPI_THREAD_SINGLE;
+    MPI_Query_thread(&thread_level);
+    if (thread_level < MPI_THREAD_MULTIPLE)
+      return false;
+  }
+#endif
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Initialize asynchronous output state and start the associated
+ * background I/O thread.
+ *
+ * parameters:
+ *   this_writer <-> pointer to mesh and field output writer
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_create(fvm_writer_t  *this_writer)
+{
+  fvm_writer_async_t  *async;
+
+  BFT_MALLOC(async, 1, fvm_writer_async_t);
+
+  pthread_mutex_init(&(async->mutex), NULL);
+  pthread_cond_init(&(async->queued), NULL);
+  pthread_cond_init(&(async->done), NULL);
+
+  async->head = NULL;
+  async->tail = NULL;
+  async->n_tasks = 0;
+  async->n_flush_queued = 0;
+  async->n_flush_done = 0;
+  async->stop = false;
+
+#if defined(HAVE_MPI)
+  async->comm = MPI_COMM_NULL;
+  if (cs_glob_mpi_comm != MPI_COMM_NULL)
+    MPI_Comm_dup(cs_glob_mpi_comm, &(async->comm));
+#endif
+
+  this_writer->async = async;
+
+  bft_mem_background_threads_add(1);
+
+  /* The new thread inherits the floating-point environment */
+
+  cs_fp_exception_disable_trap();
+
+  int retval = pthread_create(&(async->thread),
+                              NULL,
+                              _async_thread_main,
+                              this_writer);
+
+  cs_fp_exception_restore_trap();
+
+  if (retval != 0)
+    bft_error(__FILE__, __LINE__, retval,
+              _("Error creating output thread for writer \"%s\"."),
+              this_writer->name);
+}
+
+/*----------------------------------------------------------------------------
+ * Stop the background I/O thread once pending tasks are completed.
+ *
+ * parameters:
+ *   this_writer <-> pointer to mesh and field output writer
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_stop(fvm_writer_t  *this_writer)
+{
+  fvm_writer_async_t  *async = this_writer->async;
+
+  pthread_mutex_lock(&(async->mutex));
+  async->stop = true;
+  pthread_cond_signal(&(async->queued));
+  pthread_mutex_unlock(&(async->mutex));
+
+  pthread_join(async->thread, NULL);
+
+  bft_mem_background_threads_add(-1);
+}
+
+/*----------------------------------------------------------------------------
+ * Free asynchronous output state (the associated thread must have been
+ * stopped, and format writers finalized).
+ *
+ * parameters:
+ *   this_writer <-> pointer to mesh and field output writer
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_destroy(fvm_writer_t  *this_writer)
+{
+  fvm_writer_async_t  *async = this_writer->async;
+
+  assert(async->head == NULL);
+
+#if defined(HAVE_MPI)
+  if (async->comm != MPI_COMM_NULL)
+    MPI_Comm_free(&(async->comm));
+#endif
+
+  pthread_cond_destroy(&(async->done));
+  pthread_cond_destroy(&(async->queued));
+  pthread_mutex_destroy(&(async->mutex));
+
+  BFT_FREE(this_writer->async);
+}
+
+#endif /* defined(FVM_WRITER_HAVE_ASYNC) */
+
 /*============================================================================
  * Semi-private function definitions (prototypes in fvm_writer_priv.h)
  *============================================================================*/
@@ -1067,6 +1674,10 @@ fvm_writer_filter_option(char        *format_options,
  *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
  *                       (adding a vertex near each polyhedron's center)
  *   separate_meshes     use a different writer for each mesh
+ *   async               export fields and flush output asynchronously,
+ *                       using a background I/O thread (ignored for formats
+ *                       relying on external libraries, or if POSIX threads
+ *                       or MPI_THREAD_MULTIPLE support are not available)
  *
  * parameters:
  *   name            <-- base name of output
@@ -1092,6 +1703,7 @@ fvm_writer_init(const char             *name,
   char  *tmp_options = NULL;
   fvm_writer_t  *this_writer = NULL;
   bool separate_meshes = false;
+  bool async = false;
 
   /* Find corresponding format and check coherency */
 
@@ -1127,9 +1739,20 @@ fvm_writer_init(const char             *name,
       for (i1 = i0; tmp_options[i1] != '\0' && tmp_options[i1] != ' '; i1++);
       int l_opt = i1 - i0;
 
+      bool consumed = false;
+
       if (   (l_opt == 15)
           && (strncmp(tmp_options + i0, "separate_meshes", l_opt) == 0)) {
         separate_meshes = true;
+        consumed = true;
+      }
+      else if (   (l_opt == 5)
+               && (strncmp(tmp_options + i0, "async", l_opt) == 0)) {
+        async = true;
+        consumed = true;
+      }
+
+      if (consumed) {
         if (tmp_options[i1] == ' ')
           strcpy(tmp_options + i0, tmp_options + i1 + 1);
         else {
@@ -1204,6 +1827,19 @@ fvm_writer_init(const char             *name,
 
   this_writer->mesh_names = NULL;
 
+  /* Start background I/O thread if required and possible
+     (before format-specific writer initialization, as the communicator
+     used by format-specific writers differs in this case) */
+
+  this_writer->async = NULL;
+
+#if defined(FVM_WRITER_HAVE_ASYNC)
+  if (async && _async_is_possible(this_writer->format))
+    _async_create(this_writer);
+#else
+  CS_UNUSED(async);
+#endif
+
   /* Initialize format-specific writer */
 
   if  (this_writer->n_format_writers > 0) {
@@ -1241,6 +1877,13 @@ fvm_writer_finalize(fvm_writer_t  *this_writer)
   BFT_FREE(this_writer->path);
   BFT_FREE(this_writer->options);
 
+  /* Complete pending output operations */
+
+#if defined(FVM_WRITER_HAVE_ASYNC)
+  if (this_writer->async != NULL)
+    _async_stop(this_writer);
+#endif
+
   finalize_func = this_writer->format->finalize_func;
 
   if (finalize_func != NULL) {
@@ -1259,6 +1902,11 @@ fvm_writer_finalize(fvm_writer_t  *this_writer)
   }
   BFT_FREE(this_writer->mesh_names);
 
+#if defined(FVM_WRITER_HAVE_ASYNC)
+  if (this_writer->async != NULL)
+    _async_destroy(this_writer);
+#endif
+
   /* Unload plugin if required */
 
 #if defined(HAVE_DLOPEN)
@@ -1379,6 +2027,7 @@ fvm_writer_set_mesh_time(fvm_writer_t  *this_writer,
   set_mesh_time_func = this_writer->format->set_mesh_time_func;
 
   if (set_mesh_time_func != NULL) {
+    fvm_writer_sync(this_writer);
     cs_fp_exception_disable_trap();
     for (int i = 0; i < this_writer->n_format_writers; i++)
       set_mesh_time_func(this_writer->format_writer[i],
@@ -1442,6 +2091,10 @@ fvm_writer_export_nodal(fvm_writer_t        *this_writer,
 
   void  *format_writer = _find_or_add_format_writer(this_writer, mesh);
 
+  /* Meshes are output synchronously, after pending field output */
+
+  fvm_writer_sync(this_writer);
+
   t0 = cs_timer_time();
 
   export_nodal_func = this_writer->format->export_nodal_func;
@@ -1509,6 +2162,40 @@ fvm_writer_export_field(fvm_writer_t                 *this_writer,
 
   export_field_func = this_writer->format->export_field_func;
 
+#if defined(FVM_WRITER_HAVE_ASYNC)
+
+  /* Queue output of a private copy of values in asynchronous mode */
+
+  if (this_writer->async != NULL) {
+
+    fvm_writer_async_t  *async = this_writer->async;
+
+    if (export_field_func != NULL)
+      _async_queue(async,
+                   _async_task_field_create(format_writer,
+                                            mesh,
+                                            name,
+                                            location,
+                                            dimension,
+                                            interlace,
+                                            n_parent_lists,
+                                            parent_num_shift,
+                                            datatype,
+                                            time_step,
+                                            time_value,
+                                            field_values));
+
+    t1 = cs_timer_time();
+
+    pthread_mutex_lock(&(async->mutex));
+    cs_timer_counter_add_diff(&(this_writer->field_time), &t0, &t1);
+    pthread_mutex_unlock(&(async->mutex));
+
+    return;
+  }
+
+#endif /* defined(FVM_WRITER_HAVE_ASYNC) */
+
   if (export_field_func != NULL) {
     cs_fp_exception_disable_trap();
     export_field_func(format_writer,
@@ -1548,6 +2235,27 @@ fvm_writer_flush(fvm_writer_t  *this_writer)
   assert(this_writer != NULL);
   assert(this_writer->format != NULL);
 
+#if defined(FVM_WRITER_HAVE_ASYNC)
+
+  /* In asynchronous mode, wait for the previous flush, then queue
+     this one (which also marks the end of the current output step) */
+
+  if (this_writer->async != NULL) {
+
+    fvm_writer_async_t  *async = this_writer->async;
+
+    pthread_mutex_lock(&(async->mutex));
+    while (async->n_flush_done < async->n_flush_queued)
+      pthread_cond_wait(&(async->done), &(async->mutex));
+    pthread_mutex_unlock(&(async->mutex));
+
+    _async_queue(async, _async_task_flush_create(this_writer));
+
+    return;
+  }
+
+#endif /* defined(FVM_WRITER_HAVE_ASYNC) */
+
   flush_func = this_writer->format->flush_func;
 
   if (flush_func != NULL) {
@@ -1570,6 +2278,36 @@ fvm_writer_flush(fvm_writer_t  *this_writer)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Wait for completion of pending output operations of a given writer.
+ *
+ * This is needed only for asynchronous writers, before modifying or
+ * destroying meshes or associated structures which might still be
+ * referenced by pending operations.
+ *
+ * parameters:
+ *   this_writer      <-- pointer to mesh and field output writer
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_writer_sync(fvm_writer_t  *this_writer)
+{
+  assert(this_writer != NULL);
+
+#if defined(FVM_WRITER_HAVE_ASYNC)
+
+  fvm_writer_async_t  *async = this_writer->async;
+
+  if (async != NULL) {
+    pthread_mutex_lock(&(async->mutex));
+    while (async->n_tasks > 0)
+      pthread_cond_wait(&(async->done), &(async->mutex));
+    pthread_mutex_unlock(&(async->mutex));
+  }
+
+#endif /* defined(FVM_WRITER_HAVE_ASYNC) */
+}
+
 /*----------------------------------------------------------------------------
  * Return accumulated times associated with output for a given writer.
  *
@@ -1588,12 +2326,22 @@ fvm_writer_get_times(fvm_writer_t        *this_writer,
 {
   assert(this_writer != NULL);
 
+#if defined(FVM_WRITER_HAVE_ASYNC)
+  if (this_writer->async != NULL)
+    pthread_mutex_lock(&(this_writer->async->mutex));
+#endif
+
   if (mesh_time != NULL)
     *mesh_time = this_writer->mesh_time;
   if (field_time != NULL)
     *field_time = this_writer->field_time;
   if (flush_time != NULL)
     *flush_time = this_writer->flush_time;
+
+#if defined(FVM_WRITER_HAVE_ASYNC)
+  if (this_writer->async != NULL)
+    pthread_mutex_unlock(&(this_writer->async->mutex));
+#endif
 }
 
 /*----------------------------------------------------------------------------*/
@@ -219,6 +219,10 @@ fvm_writer_filter_option(char        *format_options,
  *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
  *                       (adding a vertex near each polyhedron's center)
  *   separate_meshes     use a different writer for each mesh
+ *   async               export fields and flush output asynchronously,
+ *                       using a background I/O thread (ignored for formats
+ *                       relying on external libraries, or if POSIX threads
+ *                       or MPI_THREAD_MULTIPLE support are not available)
  *
  * parameters:
  *   name            <-- base name of output
@@ -406,6 +410,10 @@ fvm_writer_export_field(fvm_writer_t                 *this_writer,
 /*----------------------------------------------------------------------------
  * Flush files associated with a given writer.
  *
+ * For asynchronous writers, this queues the flush operation, and waits
+ * only for completion of output operations preceding the previous flush,
+ * so that output of at most one time step is pending.
+ *
  * parameters:
  *   this_writer      <-- pointer to mesh and field output writer
  *----------------------------------------------------------------------------*/
@@ -413,6 +421,20 @@ fvm_writer_export_field(fvm_writer_t                 *this_writer,
 void
 fvm_writer_flush(fvm_writer_t  *this_writer);
 
+/*----------------------------------------------------------------------------
+ * Wait for completion of pending output operations of a given writer.
+ *
+ * This is needed only for asynchronous writers, before modifying or
+ * destroying meshes or associated structures which might still be
+ * referenced by pending operations.
+ *
+ * parameters:
+ *   this_writer      <-- pointer to mesh and field output writer
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_writer_sync(fvm_writer_t  *this_writer);
+
 /*----------------------------------------------------------------------------
  * Return accumulated times associated with output for a given writer.
  *
@@ -184,6 +184,9 @@ struct _fvm_writer_t {
   cs_timer_counter_t      field_time;        /* Fields output timer */
   cs_timer_counter_t      flush_time;        /* output "completion" timer */
 
+  struct _fvm_writer_async_t  *async;        /* Asynchronous output state,
+                                                or NULL */
+
 };
 
 /*----------------------------------------------------------------------------*/
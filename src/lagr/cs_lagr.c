@@ -56,6 +56,7 @@
 #include "cs_field.h"
 #include "cs_field_pointer.h"
 
+#include "cs_halo.h"
 #include "cs_math.h"
 #include "cs_mesh_location.h"
 
@@ -1147,6 +1148,26 @@ cs_lagr_init_c_arrays(int          dim_cs_glob_lagr_source_terms[2],
   dim_cs_glob_lagr_source_terms[1] = cs_glob_lagr_dim->ntersl;
 }
 
+/*----------------------------------------------------------------------------
+ * Return pointers to already allocated lagrangian arrays
+ *
+ * This function is intended for use by Fortran wrappers, to update
+ * mappings after arrays have been reallocated.
+ *
+ * parameters:
+ *   dim_cs_glob_lagr_source_terms --> dimensions for source terms pointer
+ *   p_cs_glob_lagr_source_terms   --> source terms pointer
+ *----------------------------------------------------------------------------*/
+
+void
+cs_lagr_get_c_arrays(int          dim_cs_glob_lagr_source_terms[2],
+                     cs_real_t  **p_cs_glob_lagr_source_terms)
+{
+  *p_cs_glob_lagr_source_terms     = cs_glob_lagr_source_terms->st_val;
+  dim_cs_glob_lagr_source_terms[0] = cs_glob_mesh->n_cells_with_ghosts;
+  dim_cs_glob_lagr_source_terms[1] = cs_glob_lagr_dim->ntersl;
+}
+
 /*----------------------------------------------------------------------------
  * Free lagrangian arrays
  *
@@ -1213,6 +1234,103 @@ cs_lagr_finalize(void)
     BFT_FREE(extra->grad_vel);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Transfer Lagrangian arrays and particles after a mesh
+ *        redistribution.
+ *
+ * Boundary statistics, two-way coupling source terms, fluid gradients,
+ * and internal face conditions are transferred to the new distribution,
+ * and particles are migrated to the ranks owning their cells.
+ *
+ * \param[in, out]  mt  pointer to mesh transfer structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_mesh_transfer(cs_mesh_transfer_t  *mt)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  /* Boundary statistics (non-interlaced) */
+
+  const int n_boundary_stats = cs_glob_lagr_dim->n_boundary_stats;
+
+  if (n_boundary_stats > 0) {
+
+    const cs_lnum_t n_b_faces_prev
+      = cs_mesh_transfer_get_n_elts_prev(mt,
+                                         CS_MESH_LOCATION_BOUNDARY_FACES)[0];
+
+    cs_real_t *bound_stat_prev = bound_stat;
+    bound_stat = NULL;
+    BFT_MALLOC(bound_stat, m->n_b_faces * n_boundary_stats, cs_real_t);
+
+    for (int i = 0; i < n_boundary_stats; i++)
+      cs_mesh_transfer_copy_array(mt,
+                                  CS_MESH_LOCATION_BOUNDARY_FACES,
+                                  CS_REAL_TYPE,
+                                  1,
+                                  bound_stat_prev + i*n_b_faces_prev,
+                                  bound_stat + i*m->n_b_faces);
+
+    BFT_FREE(bound_stat_prev);
+
+  }
+
+  /* Two-way coupling source terms (non-interlaced) */
+
+  const int ntersl = cs_glob_lagr_dim->ntersl;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+
+  if (ntersl > 0) {
+
+    const cs_lnum_t n_cells_ext_prev
+      = cs_mesh_transfer_get_n_elts_prev(mt, CS_MESH_LOCATION_CELLS)[2];
+
+    cs_real_t *st_val_prev = cs_glob_lagr_source_terms->st_val;
+    cs_real_t *st_val = NULL;
+    BFT_MALLOC(st_val, ntersl * n_cells_ext, cs_real_t);
+
+    for (int i = 0; i < ntersl; i++) {
+      cs_mesh_transfer_copy_array(mt,
+                                  CS_MESH_LOCATION_CELLS,
+                                  CS_REAL_TYPE,
+                                  1,
+                                  st_val_prev + i*n_cells_ext_prev,
+                                  st_val + i*n_cells_ext);
+      if (m->halo != NULL)
+        cs_halo_sync_var(m->halo, CS_HALO_EXTENDED, st_val + i*n_cells_ext);
+    }
+
+    BFT_FREE(st_val_prev);
+    cs_glob_lagr_source_terms->st_val = st_val;
+
+  }
+
+  /* Fluid gradients */
+
+  cs_lagr_extra_module_t *extra = cs_glob_lagr_extra_module;
+
+  cs_mesh_transfer_array(mt, CS_MESH_LOCATION_CELLS, CS_REAL_TYPE, 3,
+                         (void **)&(extra->grad_pr));
+  cs_mesh_transfer_array(mt, CS_MESH_LOCATION_CELLS, CS_REAL_TYPE, 9,
+                         (void **)&(extra->grad_vel));
+
+  /* Internal face conditions */
+
+  cs_lagr_internal_condition_t *internal_cond
+    = cs_glob_lagr_internal_conditions;
+
+  if (internal_cond != NULL)
+    cs_mesh_transfer_array(mt, CS_MESH_LOCATION_INTERIOR_FACES, CS_INT_TYPE, 1,
+                           (void **)&(internal_cond->i_face_zone_id));
+
+  /* Particles */
+
+  cs_lagr_tracking_mesh_transfer(mt);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Provide access to injection set structure.
@@ -2362,24 +2480,25 @@ cs_lagr_solve_time_step(const int         itypfb[],
           for (cs_lnum_t i = start_part; i < end_part; ++i) {
             if (cs_lagr_particles_get_flag(p_set, i,
                                            CS_LAGR_PART_TO_DELETE)) {
-              memcpy(deleted_buffer + p_set->p_am->extents * count_del,
-                     p_set->p_buffer + p_set->p_am->extents * i,
-                     p_set->p_am->extents);
+              cs_lagr_particles_pack(p_set, i, 1,
+                                       deleted_buffer
+                                       + p_set->p_am->extents * count_del);
               count_del++;
             }
             else {
-              memcpy(swap_buffer + p_set->p_am->extents * count_swap,
-                     p_set->p_buffer + p_set->p_am->extents * i,
-                     p_set->p_am->extents);
+              cs_lagr_particles_pack(p_set, i, 1,
+                                     swap_buffer
+                                     + p_set->p_am->extents * count_swap);
               count_swap++;
             }
           }
 
-          memcpy(p_set->p_buffer + p_set->p_am->extents * start_part,
-                 swap_buffer, swap_buffer_size);
-          memcpy(  p_set->p_buffer
-                 + p_set->p_am->extents * (local_size-deleted_parts+start_part),
-                 deleted_buffer, swap_buffer_deleted);
+          cs_lagr_particles_unpack(p_set, start_part, count_swap,
+                                   swap_buffer);
+          cs_lagr_particles_unpack(p_set,
+                                   local_size-deleted_parts+start_part,
+                                   count_del,
+                                   deleted_buffer);
 
           BFT_FREE(deleted_buffer);
           BFT_FREE(swap_buffer);
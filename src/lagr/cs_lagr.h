@@ -41,6 +41,7 @@
 
 #include "cs_base.h"
 #include "cs_field.h"
+#include "cs_mesh_transfer.h"
 
 #include "cs_lagr_injection.h"
 
@@ -1074,6 +1075,22 @@ extern cs_real_33_t  *cs_glob_lagr_b_face_proj;
  * Public function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Transfer Lagrangian arrays and particles after a mesh
+ *        redistribution.
+ *
+ * Boundary statistics, two-way coupling source terms, fluid gradients,
+ * and internal face conditions are transferred to the new distribution,
+ * and particles are migrated to the ranks owning their cells.
+ *
+ * \param[in, out]  mt  pointer to mesh transfer structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_mesh_transfer(cs_mesh_transfer_t  *mt);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Provide access to injection set structure.
@@ -1343,6 +1360,21 @@ void
 cs_lagr_init_c_arrays(int          dim_cs_glob_lagr_source_terms[2],
                       cs_real_t  **p_cs_glob_lagr_source_terms);
 
+/*----------------------------------------------------------------------------
+ * Return pointers to already allocated lagrangian arrays
+ *
+ * This function is intended for use by Fortran wrappers, to update
+ * mappings after arrays have been reallocated.
+ *
+ * parameters:
+ *   dim_cs_glob_lagr_source_terms --> dimensions for source terms pointer
+ *   p_cs_glob_lagr_source_terms   --> source terms pointer
+ *----------------------------------------------------------------------------*/
+
+void
+cs_lagr_get_c_arrays(int          dim_cs_glob_lagr_source_terms[2],
+                     cs_real_t  **p_cs_glob_lagr_source_terms);
+
 /*----------------------------------------------------------------------------
  * Free lagrangian arrays
  *
@@ -151,8 +151,6 @@ cs_lagr_get_particle_list(cs_lnum_t         n_cells,
 
   assert(p_set != NULL);
 
-  size_t extents = p_set->p_am->extents;
-
   if (density < 1) {
 
     size_t  _extents, size;
@@ -204,11 +202,8 @@ cs_lagr_get_particle_list(cs_lnum_t         n_cells,
       double r;
       if (displ < 0)
         r = (double)rand() / RAND_MAX;
-      else {
-        const unsigned char
-          *p = (const unsigned char *)(p_set->p_buffer + i*extents) + displ;
-        r = *(const cs_real_t *)p;
-      }
+      else
+        r = cs_lagr_particles_get_real(p_set, i, CS_LAGR_RANDOM_VALUE);
       if (r > density)
         continue;
     }
@@ -308,8 +303,7 @@ cs_lagr_get_particle_values(const cs_lagr_particle_set_t  *particles,
     for (i = 0; i < n_particles; i++) {
       unsigned char *dest = _values + i*_length;
       const unsigned char
-        *src = (const unsigned char *)(particles->p_buffer + i*extents)
-               + displ
+        *src = cs_lagr_particles_data(particles, i, displ, size)
                + component_id * _length;
       for (j = 0; j < _length; j++)
         dest[j] = src[j];
@@ -322,8 +316,7 @@ cs_lagr_get_particle_values(const cs_lagr_particle_set_t  *particles,
       cs_lnum_t p_id = particle_list[i] - 1;
       unsigned char *dest = _values + i*_length;
       const unsigned char
-        *src = (const unsigned char *)(particles->p_buffer + p_id*extents)
-               + displ
+        *src = cs_lagr_particles_data(particles, p_id, displ, size)
                + component_id * _length;
       for (j = 0; j < _length; j++)
         dest[j] = src[j];
@@ -379,8 +372,6 @@ cs_lagr_get_trajectory_values(const cs_lagr_particle_set_t  *particles,
 
   assert(particles != NULL);
 
-  const unsigned char *p_buffer = particles->p_buffer;
-
   cs_lagr_get_attr_info(particles, 0, attr,
                         &extents, &size, &displ, &_datatype, &_count);
 
@@ -419,12 +410,10 @@ cs_lagr_get_trajectory_values(const cs_lagr_particle_set_t  *particles,
       for (i = 0; i < n_particles; i++) {
         unsigned char *dest = _values + i*_length*2;
         const unsigned char
-          *src = (const unsigned char *)(p_buffer + i*extents)
-                  + displ
+          *src = cs_lagr_particles_data(particles, i, displ, size)
                   + component_id * _length;
         const unsigned char
-          *srcp = (const unsigned char *)(p_buffer + i*extents)
-                   + displ_p
+          *srcp = cs_lagr_particles_data(particles, i, displ_p, size)
                    + component_id * _length;
         for (j = 0; j < _length; j++) {
           dest[j] = src[j];
@@ -439,8 +428,7 @@ cs_lagr_get_trajectory_values(const cs_lagr_particle_set_t  *particles,
       for (i = 0; i < n_particles; i++) {
         unsigned char *dest = _values + i*_length*2;
         const unsigned char
-          *src = (const unsigned char *)(p_buffer + i*extents)
-                  + displ
+          *src = cs_lagr_particles_data(particles, i, displ, size)
                   + component_id * _length;
         for (j = 0; j < _length; j++) {
           dest[j] = src[j];
@@ -461,12 +449,10 @@ cs_lagr_get_trajectory_values(const cs_lagr_particle_set_t  *particles,
         cs_lnum_t p_id = particle_list[i] - 1;
         unsigned char *dest = _values + i*_length*2;
         const unsigned char
-          *src = (const unsigned char *)(p_buffer + p_id*extents)
-                  + displ
+          *src = cs_lagr_particles_data(particles, p_id, displ, size)
                   + component_id * _length;
         const unsigned char
-          *srcp = (const unsigned char *)(p_buffer + p_id*extents)
-                   + displ_p
+          *srcp = cs_lagr_particles_data(particles, p_id, displ_p, size)
                    + component_id * _length;
         for (j = 0; j < _length; j++) {
           dest[j] = src[j];
@@ -482,8 +468,7 @@ cs_lagr_get_trajectory_values(const cs_lagr_particle_set_t  *particles,
         cs_lnum_t p_id = particle_list[i] - 1;
         unsigned char *dest = _values + i*_length*2;
         const unsigned char
-          *src = (const unsigned char *)(p_buffer + p_id*extents)
-                  + displ
+          *src = cs_lagr_particles_data(particles, p_id, displ, size)
                   + component_id * _length;
         for (j = 0; j < _length; j++) {
           dest[j] = src[j];
@@ -219,6 +219,15 @@ const char *cs_lagr_attribute_name[] = {
 
 static cs_lagr_attribute_map_t  *_p_attr_map = NULL;
 
+/* Particle data layout, and associated data blocks
+   (displacement and size in particle record) */
+
+static cs_lagr_particle_layout_t  _p_layout = CS_LAGR_PARTICLE_LAYOUT_AOS;
+
+static int         _n_p_blocks = 0;
+static ptrdiff_t  *_p_block_displ = NULL;
+static size_t     *_p_block_size = NULL;
+
 /* Particle set reallocation parameters */
 
 static  double              _reallocation_factor = 2.0;
@@ -310,6 +319,10 @@ _create_attr_map(cs_lnum_t attr_keys[CS_LAGR_N_ATTRIBUTES][3])
 
   p_am->source_term_displ = NULL;
 
+  p_am->layout = _p_layout;
+  p_am->soa_buffer = NULL;
+  p_am->soa_n_max = 0;
+
   for (attr = 0; attr < CS_LAGR_N_ATTRIBUTES; attr++) {
     p_am->size[attr] = 0;
     p_am->datatype[attr] = CS_REAL_TYPE;
@@ -458,6 +471,75 @@ _destroy_attr_map(cs_lagr_attribute_map_t  **p_am)
 
     BFT_FREE(*p_am);
   }
+
+  BFT_FREE(_p_block_displ);
+  BFT_FREE(_p_block_size);
+  _n_p_blocks = 0;
+}
+
+/*----------------------------------------------------------------------------*
+ * Build list of contiguous data blocks of a particle record.
+ *
+ * Blocks are the private tracking info, each attribute at each time value,
+ * and source terms. Padding is not included.
+ *
+ * parameters:
+ *   p_am  <-- particle attributes map
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_data_blocks(const cs_lagr_attribute_map_t  *p_am)
+{
+  int n_max_blocks = 1 + (p_am->n_time_vals + 1)*CS_LAGR_N_ATTRIBUTES;
+
+  BFT_REALLOC(_p_block_displ, n_max_blocks, ptrdiff_t);
+  BFT_REALLOC(_p_block_size, n_max_blocks, size_t);
+
+  _n_p_blocks = 0;
+
+  _p_block_displ[_n_p_blocks] = 0;
+  _p_block_size[_n_p_blocks] = p_am->lb;
+  _n_p_blocks++;
+
+  for (int time_id = 0; time_id < p_am->n_time_vals; time_id++) {
+    for (int attr = 0; attr < CS_LAGR_N_ATTRIBUTES; attr++) {
+      if (p_am->count[time_id][attr] > 0 && p_am->displ[time_id][attr] > -1) {
+        _p_block_displ[_n_p_blocks] = p_am->displ[time_id][attr];
+        _p_block_size[_n_p_blocks] = p_am->size[attr];
+        _n_p_blocks++;
+      }
+    }
+  }
+
+  if (p_am->source_term_displ != NULL) {
+    for (int attr = 0; attr < CS_LAGR_N_ATTRIBUTES; attr++) {
+      if (p_am->source_term_displ[attr] > -1) {
+        _p_block_displ[_n_p_blocks] = p_am->source_term_displ[attr];
+        _p_block_size[_n_p_blocks] = p_am->size[attr];
+        _n_p_blocks++;
+      }
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*
+ * Update the main particle map's reference to a particle set's buffer
+ * (required by particle-level accessors for the structure of arrays layout).
+ *
+ * parameters:
+ *   particle_set <-- pointer to a cs_lagr_particle_set_t structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_map_buffer(const cs_lagr_particle_set_t  *particle_set)
+{
+  if (particle_set == NULL || particle_set->p_am != _p_attr_map)
+    return;
+
+  if (_p_attr_map->layout == CS_LAGR_PARTICLE_LAYOUT_SOA) {
+    _p_attr_map->soa_buffer = particle_set->p_buffer;
+    _p_attr_map->soa_n_max = particle_set->n_particles_max;
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -622,12 +704,37 @@ _particle_set_resize(cs_lagr_particle_set_t   *particle_set,
     if (particle_set->n_particles_max == 0)
       particle_set->n_particles_max = 1;
 
+    cs_lnum_t n_particles_max_prev = particle_set->n_particles_max;
+
     while (particle_set->n_particles_max < n_particles_max_min)
       particle_set->n_particles_max *= _reallocation_factor;
 
-    BFT_REALLOC(particle_set->p_buffer,
-                particle_set->n_particles_max * particle_set->p_am->extents,
-                unsigned char);
+    const cs_lnum_t n_max = particle_set->n_particles_max;
+    const size_t extents = particle_set->p_am->extents;
+
+    /* With the structure of arrays layout, each data block
+       is moved to its new position */
+
+    if (particle_set->p_am->layout == CS_LAGR_PARTICLE_LAYOUT_SOA) {
+
+      unsigned char *p_buffer_prev = particle_set->p_buffer;
+
+      BFT_MALLOC(particle_set->p_buffer, n_max*extents, unsigned char);
+
+      for (int b_id = 0; b_id < _n_p_blocks; b_id++) {
+        const ptrdiff_t displ = _p_block_displ[b_id];
+        memcpy(particle_set->p_buffer + n_max*displ,
+               p_buffer_prev + n_particles_max_prev*displ,
+               n_particles_max_prev*_p_block_size[b_id]);
+      }
+
+      BFT_FREE(p_buffer_prev);
+
+    }
+    else
+      BFT_REALLOC(particle_set->p_buffer, n_max*extents, unsigned char);
+
+    _update_map_buffer(particle_set);
 
     retval = 1;
   }
@@ -923,6 +1030,8 @@ cs_lagr_particle_attr_initialize(void)
      then built) */
 
   _p_attr_map = _create_attr_map(attr_keys);
+
+  _build_data_blocks(_p_attr_map);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -951,6 +1060,8 @@ cs_lagr_particle_set_create(void)
 {
   cs_glob_lagr_particle_set = _create_particle_set(128, _p_attr_map);
 
+  _update_map_buffer(cs_glob_lagr_particle_set);
+
 #if 0 && defined(DEBUG) && !defined(NDEBUG)
   bft_printf("\n PARTICLE SET AFTER CREATION\n");
   cs_lagr_particle_set_dump(cs_glob_lagr_particle_set);
@@ -987,9 +1098,7 @@ cs_lagr_part_copy(cs_lnum_t  dest,
                   cs_lnum_t  src)
 {
   cs_lagr_particle_set_t  *particles = cs_glob_lagr_particle_set;
-  memcpy(particles->p_buffer + particles->p_am->extents*(dest),
-         particles->p_buffer + particles->p_am->extents*(src),
-         particles->p_am->extents);
+  cs_lagr_particles_copy(particles, dest, src, 1);
   cs_real_t random = -1;
   cs_random_uniform(1, &random);
   cs_lagr_particles_set_real(particles, (dest-1), CS_LAGR_RANDOM_VALUE,
@@ -1242,18 +1351,144 @@ cs_lagr_particles_current_to_previous(cs_lagr_particle_set_t  *particles,
                                       cs_lnum_t                particle_id)
 {
   const cs_lagr_attribute_map_t  *p_am = particles->p_am;
-  unsigned char *p_buf = particles->p_buffer + p_am->extents*(particle_id);
 
   for (cs_lagr_attribute_t attr = 0;
        attr < CS_LAGR_N_ATTRIBUTES;
        attr++) {
     if (p_am->count[1][attr] > 0 && p_am->count[0][attr] > 0) {
-      memcpy(p_buf + p_am->displ[1][attr],
-             p_buf + p_am->displ[0][attr],
+      memcpy(cs_lagr_particles_attr_data(particles, particle_id, 1, attr),
+             cs_lagr_particles_attr_data(particles, particle_id, 0, attr),
              p_am->size[attr]);
     }
   }
-  *((cs_lnum_t *)(p_buf + p_am->displ[1][CS_LAGR_RANK_ID])) = cs_glob_rank_id;
+  cs_lagr_particles_set_lnum_n(particles, particle_id, 1, CS_LAGR_RANK_ID,
+                               cs_glob_rank_id);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Copy data of a range of particles to an array of particle records.
+ *
+ * The destination buffer uses the array of structures layout, whatever
+ * the particle set's layout, so that it may be used for exchanges or
+ * temporary storage (each particle using extents bytes).
+ *
+ * \param[in]   particles    associated particle set
+ * \param[in]   start_id     id of first particle to copy
+ * \param[in]   n_particles  number of particles to copy
+ * \param[out]  buffer       destination buffer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particles_pack(const cs_lagr_particle_set_t  *particles,
+                       cs_lnum_t                      start_id,
+                       cs_lnum_t                      n_particles,
+                       void                          *buffer)
+{
+  const cs_lagr_attribute_map_t  *p_am = particles->p_am;
+  const size_t extents = p_am->extents;
+
+  unsigned char *_buffer = buffer;
+
+  if (p_am->layout == CS_LAGR_PARTICLE_LAYOUT_SOA) {
+    for (int b_id = 0; b_id < _n_p_blocks; b_id++) {
+      const ptrdiff_t displ = _p_block_displ[b_id];
+      const size_t size = _p_block_size[b_id];
+      const unsigned char *src
+        = cs_lagr_particles_data(particles, start_id, displ, size);
+      for (cs_lnum_t i = 0; i < n_particles; i++)
+        memcpy(_buffer + extents*i + displ, src + size*i, size);
+    }
+  }
+  else
+    memcpy(_buffer,
+           particles->p_buffer + extents*start_id,
+           extents*n_particles);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Copy data of a range of particles from an array of
+ *        particle records.
+ *
+ * This is the reverse operation of \ref cs_lagr_particles_pack.
+ * The particle set must already be sized to hold the copied particles.
+ *
+ * \param[in, out]  particles    associated particle set
+ * \param[in]       start_id     id of first particle to copy to
+ * \param[in]       n_particles  number of particles to copy
+ * \param[in]       buffer       source buffer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particles_unpack(cs_lagr_particle_set_t  *particles,
+                         cs_lnum_t                start_id,
+                         cs_lnum_t                n_particles,
+                         const void              *buffer)
+{
+  const cs_lagr_attribute_map_t  *p_am = particles->p_am;
+  const size_t extents = p_am->extents;
+
+  const unsigned char *_buffer = buffer;
+
+  assert(start_id + n_particles <= particles->n_particles_max);
+
+  if (p_am->layout == CS_LAGR_PARTICLE_LAYOUT_SOA) {
+    for (int b_id = 0; b_id < _n_p_blocks; b_id++) {
+      const ptrdiff_t displ = _p_block_displ[b_id];
+      const size_t size = _p_block_size[b_id];
+      unsigned char *dest
+        = cs_lagr_particles_data(particles, start_id, displ, size);
+      for (cs_lnum_t i = 0; i < n_particles; i++)
+        memcpy(dest + size*i, _buffer + extents*i + displ, size);
+    }
+  }
+  else
+    memcpy(particles->p_buffer + extents*start_id,
+           _buffer,
+           extents*n_particles);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Copy data of a range of particles to another position
+ *        in the same set.
+ *
+ * Source and destination ranges may overlap.
+ *
+ * \param[in, out]  particles    associated particle set
+ * \param[in]       dest_id      id of first destination particle
+ * \param[in]       src_id       id of first source particle
+ * \param[in]       n_particles  number of particles to copy
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particles_copy(cs_lagr_particle_set_t  *particles,
+                       cs_lnum_t                dest_id,
+                       cs_lnum_t                src_id,
+                       cs_lnum_t                n_particles)
+{
+  const cs_lagr_attribute_map_t  *p_am = particles->p_am;
+
+  if (dest_id == src_id || n_particles < 1)
+    return;
+
+  if (p_am->layout == CS_LAGR_PARTICLE_LAYOUT_SOA) {
+    for (int b_id = 0; b_id < _n_p_blocks; b_id++) {
+      const ptrdiff_t displ = _p_block_displ[b_id];
+      const size_t size = _p_block_size[b_id];
+      memmove(cs_lagr_particles_data(particles, dest_id, displ, size),
+              cs_lagr_particles_data(particles, src_id, displ, size),
+              size*n_particles);
+    }
+  }
+  else
+    memmove(particles->p_buffer + p_am->extents*dest_id,
+            particles->p_buffer + p_am->extents*src_id,
+            p_am->extents*n_particles);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1298,6 +1533,34 @@ cs_lagr_set_n_user_variables(int  n_user_variables)
   cs_glob_lagr_model->n_user_variables = n_user_variables;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set data storage layout for particle sets.
+ *
+ * The default \ref CS_LAGR_PARTICLE_LAYOUT_AOS layout stores all data of
+ * a given particle contiguously. The \ref CS_LAGR_PARTICLE_LAYOUT_SOA
+ * layout stores values of a given attribute (at a given time) contiguously
+ * for all particles, reducing memory traffic in loops accessing only a few
+ * attributes.
+ *
+ * This function must be called before the particle attribute map is
+ * defined, for example in \ref cs_user_lagr_model.
+ *
+ * \param[in]  layout  particle data storage layout
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_set_particle_layout(cs_lagr_particle_layout_t  layout)
+{
+  if (_p_attr_map != NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: the particle attribute map is already defined."),
+              __func__);
+
+  _p_layout = layout;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -181,6 +181,19 @@ typedef enum {
 
 } cs_lagr_attribute_t;
 
+/*! Particle data storage layout */
+/* ------------------------------ */
+
+typedef enum {
+
+  CS_LAGR_PARTICLE_LAYOUT_AOS,   /*!< array of structures: all data of a
+                                      given particle is contiguous */
+  CS_LAGR_PARTICLE_LAYOUT_SOA    /*!< structure of arrays: values of a given
+                                      attribute (at a given time) for all
+                                      particles are contiguous */
+
+} cs_lagr_particle_layout_t;
+
 /*! Particle attribute structure mapping */
 /* ------------------------------------- */
 
@@ -213,6 +226,16 @@ typedef struct {
                                                       for second-order scheme,
                                                       or NULL */
 
+  cs_lagr_particle_layout_t  layout;               /* data storage layout */
+
+  unsigned char  *soa_buffer;                      /* associated particle set
+                                                      buffer (for structure of
+                                                      arrays layout only) */
+  cs_lnum_t       soa_n_max;                       /* associated particle set
+                                                      allocated size (for
+                                                      structure of arrays
+                                                      layout only) */
+
 } cs_lagr_attribute_map_t;
 
 /* Particle set */
@@ -395,6 +418,234 @@ cs_lagr_particle_attr_in_range(int  attr);
 cs_lagr_particle_set_t  *
 cs_lagr_get_particle_set(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get pointer to a data block of a given particle in a set.
+ *
+ * Particle data is defined by blocks (private tracking info, attribute
+ * values at a given time, source terms), each with a displacement
+ * relative to the start of a particle record, and a size. With the
+ * \ref CS_LAGR_PARTICLE_LAYOUT_AOS layout, blocks are contiguous for a
+ * given particle. With the \ref CS_LAGR_PARTICLE_LAYOUT_SOA layout,
+ * a given block is contiguous for all particles, starting at
+ * n_particles_max*displ in the particle set's buffer.
+ *
+ * \param[in]  particle_set  pointer to particle set
+ * \param[in]  particle_id   particle id
+ * \param[in]  displ         displacement of block in particle record
+ * \param[in]  size          size of block
+ *
+ * \return    pointer to block data
+ */
+/*----------------------------------------------------------------------------*/
+
+inline static unsigned char *
+cs_lagr_particles_data(const cs_lagr_particle_set_t  *particle_set,
+                       cs_lnum_t                      particle_id,
+                       ptrdiff_t                      displ,
+                       size_t                         size)
+{
+  if (particle_set->p_am->layout == CS_LAGR_PARTICLE_LAYOUT_SOA)
+    return   particle_set->p_buffer
+           + particle_set->n_particles_max*displ
+           + size*particle_id;
+  else
+    return   particle_set->p_buffer
+           + particle_set->p_am->extents*particle_id
+           + displ;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get pointer to attribute data of a given particle in a set
+ *        at a given time, independently of data layout.
+ *
+ * \param[in]  particle_set  pointer to particle set
+ * \param[in]  particle_id   particle id
+ * \param[in]  time_id       0 for current, 1 for previous
+ * \param[in]  attr          requested attribute id
+ *
+ * \return    pointer to attribute data
+ */
+/*----------------------------------------------------------------------------*/
+
+inline static unsigned char *
+cs_lagr_particles_attr_data(const cs_lagr_particle_set_t  *particle_set,
+                            cs_lnum_t                      particle_id,
+                            int                            time_id,
+                            cs_lagr_attribute_t            attr)
+{
+  return cs_lagr_particles_data(particle_set,
+                                particle_id,
+                                particle_set->p_am->displ[time_id][attr],
+                                particle_set->p_am->size[attr]);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get pointer to 2nd order scheme source terms data of a given
+ *        particle in a set, independently of data layout.
+ *
+ * \param[in]  particle_set  pointer to particle set
+ * \param[in]  particle_id   particle id
+ * \param[in]  attr          requested attribute id
+ *
+ * \return    pointer to source terms data
+ */
+/*----------------------------------------------------------------------------*/
+
+inline static unsigned char *
+cs_lagr_particles_st_data(const cs_lagr_particle_set_t  *particle_set,
+                          cs_lnum_t                      particle_id,
+                          cs_lagr_attribute_t            attr)
+{
+  return cs_lagr_particles_data(particle_set,
+                                particle_id,
+                                particle_set->p_am->source_term_displ[attr],
+                                particle_set->p_am->size[attr]);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get pointer to a data block of a particle.
+ *
+ * With the \ref CS_LAGR_PARTICLE_LAYOUT_SOA layout, the particle pointer
+ * is only a handle (p_buffer + extents*particle_id) from which the
+ * particle id is deduced, so only pointers to particles of the set
+ * associated with the attribute map may be used.
+ *
+ * \param[in]  particle  pointer to particle data
+ * \param[in]  attr_map  pointer to attribute map
+ * \param[in]  displ     displacement of block in particle record
+ * \param[in]  size      size of block
+ *
+ * \return  pointer to block data
+ */
+/*----------------------------------------------------------------------------*/
+
+inline static unsigned char *
+cs_lagr_particle_data(void                           *particle,
+                      const cs_lagr_attribute_map_t  *attr_map,
+                      ptrdiff_t                       displ,
+                      size_t                          size)
+{
+  if (attr_map->layout == CS_LAGR_PARTICLE_LAYOUT_SOA) {
+    size_t p_id = (  (const unsigned char *)particle
+                   - attr_map->soa_buffer) / attr_map->extents;
+    return   attr_map->soa_buffer
+           + attr_map->soa_n_max*displ
+           + size*p_id;
+  }
+  else
+    return (unsigned char *)particle + displ;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get const pointer to a data block of a particle.
+ *
+ * \param[in]  particle  pointer to particle data
+ * \param[in]  attr_map  pointer to attribute map
+ * \param[in]  displ     displacement of block in particle record
+ * \param[in]  size      size of block
+ *
+ * \return  const pointer to block data
+ */
+/*----------------------------------------------------------------------------*/
+
+inline static const unsigned char *
+cs_lagr_particle_data_const(const void                     *particle,
+                            const cs_lagr_attribute_map_t  *attr_map,
+                            ptrdiff_t                       displ,
+                            size_t                          size)
+{
+  if (attr_map->layout == CS_LAGR_PARTICLE_LAYOUT_SOA) {
+    size_t p_id = (  (const unsigned char *)particle
+                   - attr_map->soa_buffer) / attr_map->extents;
+    return   attr_map->soa_buffer
+           + attr_map->soa_n_max*displ
+           + size*p_id;
+  }
+  else
+    return (const unsigned char *)particle + displ;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get pointer to attribute data of a particle at a given time,
+ *        independently of data layout.
+ *
+ * \param[in]  particle  pointer to particle data
+ * \param[in]  attr_map  pointer to attribute map
+ * \param[in]  time_id   0 for current, 1 for previous
+ * \param[in]  attr      requested attribute id
+ *
+ * \return  pointer to attribute data
+ */
+/*----------------------------------------------------------------------------*/
+
+inline static unsigned char *
+cs_lagr_particle_attr_data(void                           *particle,
+                           const cs_lagr_attribute_map_t  *attr_map,
+                           int                             time_id,
+                           cs_lagr_attribute_t             attr)
+{
+  return cs_lagr_particle_data(particle,
+                               attr_map,
+                               attr_map->displ[time_id][attr],
+                               attr_map->size[attr]);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get const pointer to attribute data of a particle at a given time,
+ *        independently of data layout.
+ *
+ * \param[in]  particle  pointer to particle data
+ * \param[in]  attr_map  pointer to attribute map
+ * \param[in]  time_id   0 for current, 1 for previous
+ * \param[in]  attr      requested attribute id
+ *
+ * \return  const pointer to attribute data
+ */
+/*----------------------------------------------------------------------------*/
+
+inline static const unsigned char *
+cs_lagr_particle_attr_data_const(const void                     *particle,
+                                 const cs_lagr_attribute_map_t  *attr_map,
+                                 int                             time_id,
+                                 cs_lagr_attribute_t             attr)
+{
+  return cs_lagr_particle_data_const(particle,
+                                     attr_map,
+                                     attr_map->displ[time_id][attr],
+                                     attr_map->size[attr]);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get pointer to 2nd order scheme source terms data of a particle,
+ *        independently of data layout.
+ *
+ * \param[in]  particle  pointer to particle data
+ * \param[in]  attr_map  pointer to attribute map
+ * \param[in]  attr      requested attribute id
+ *
+ * \return  pointer to source terms data
+ */
+/*----------------------------------------------------------------------------*/
+
+inline static unsigned char *
+cs_lagr_particle_st_data(void                           *particle,
+                         const cs_lagr_attribute_map_t  *attr_map,
+                         cs_lagr_attribute_t             attr)
+{
+  return cs_lagr_particle_data(particle,
+                               attr_map,
+                               attr_map->source_term_displ[attr],
+                               attr_map->size[attr]);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Get pointer to a current attribute of a given particle in a set.
@@ -414,9 +665,7 @@ cs_lagr_particles_attr(cs_lagr_particle_set_t  *particle_set,
 {
   assert(particle_set->p_am->count[0][attr] > 0);
 
-  return   (unsigned char *)particle_set->p_buffer
-         + particle_set->p_am->extents*particle_id
-         + particle_set->p_am->displ[0][attr];
+  return cs_lagr_particles_attr_data(particle_set, particle_id, 0, attr);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -439,9 +688,7 @@ cs_lagr_particles_attr_const(const cs_lagr_particle_set_t  *particle_set,
 {
   assert(particle_set->p_am->count[0][attr] > 0);
 
-  return   particle_set->p_buffer
-         + particle_set->p_am->extents*particle_id
-         + particle_set->p_am->displ[0][attr];
+  return cs_lagr_particles_attr_data(particle_set, particle_id, 0, attr);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -466,9 +713,7 @@ cs_lagr_particles_attr_n(cs_lagr_particle_set_t  *particle_set,
 {
   assert(particle_set->p_am->count[time_id][attr] > 0);
 
-  return   particle_set->p_buffer
-         + particle_set->p_am->extents*particle_id
-         + particle_set->p_am->displ[time_id][attr];
+  return cs_lagr_particles_attr_data(particle_set, particle_id, time_id, attr);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -493,9 +738,7 @@ cs_lagr_particles_attr_n_const(const cs_lagr_particle_set_t  *particle_set,
 {
   assert(particle_set->p_am->count[time_id][attr] > 0);
 
-  return   particle_set->p_buffer
-         + particle_set->p_am->extents*particle_id
-         + particle_set->p_am->displ[time_id][attr];
+  return cs_lagr_particles_attr_data(particle_set, particle_id, time_id, attr);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -516,9 +759,9 @@ cs_lagr_particles_get_flag(const cs_lagr_particle_set_t  *particle_set,
                            int                            mask)
 {
   int flag
-    = *((const cs_lnum_t *)(  particle_set->p_buffer
-                            + particle_set->p_am->extents*particle_id
-                            + particle_set->p_am->displ[0][CS_LAGR_P_FLAG]));
+    = *((const cs_lnum_t *)cs_lagr_particles_attr_data(particle_set,
+                                                       particle_id, 0,
+                                                       CS_LAGR_P_FLAG));
 
   return (flag & mask);
 }
@@ -539,15 +782,14 @@ cs_lagr_particles_set_flag(const cs_lagr_particle_set_t  *particle_set,
                            int                            mask)
 {
   int flag
-    = *((const cs_lnum_t *)(  particle_set->p_buffer
-                            + particle_set->p_am->extents*particle_id
-                            + particle_set->p_am->displ[0][CS_LAGR_P_FLAG]));
+    = *((const cs_lnum_t *)cs_lagr_particles_attr_data(particle_set,
+                                                       particle_id, 0,
+                                                       CS_LAGR_P_FLAG));
 
   flag = flag | mask;
 
-  *((cs_lnum_t *)(  particle_set->p_buffer
-                  + particle_set->p_am->extents*particle_id
-                  + particle_set->p_am->displ[0][CS_LAGR_P_FLAG])) = flag;
+  *((cs_lnum_t *)cs_lagr_particles_attr_data(particle_set, particle_id, 0,
+                                             CS_LAGR_P_FLAG)) = flag;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -566,15 +808,14 @@ cs_lagr_particles_unset_flag(const cs_lagr_particle_set_t  *particle_set,
                              int                            mask)
 {
   int flag
-    = *((const cs_lnum_t *)(  particle_set->p_buffer
-                            + particle_set->p_am->extents*particle_id
-                            + particle_set->p_am->displ[0][CS_LAGR_P_FLAG]));
+    = *((const cs_lnum_t *)cs_lagr_particles_attr_data(particle_set,
+                                                       particle_id, 0,
+                                                       CS_LAGR_P_FLAG));
 
   flag = (flag | mask) - mask;
 
-  *((cs_lnum_t *)(  particle_set->p_buffer
-                  + particle_set->p_am->extents*particle_id
-                  + particle_set->p_am->displ[0][CS_LAGR_P_FLAG])) = flag;
+  *((cs_lnum_t *)cs_lagr_particles_attr_data(particle_set, particle_id, 0,
+                                             CS_LAGR_P_FLAG)) = flag;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -596,9 +837,9 @@ cs_lagr_particles_get_lnum(const cs_lagr_particle_set_t  *particle_set,
 {
   assert(particle_set->p_am->count[0][attr] > 0);
 
-  return *((const cs_lnum_t *)(  particle_set->p_buffer
-                               + particle_set->p_am->extents*particle_id
-                               + particle_set->p_am->displ[0][attr]));
+  return *((const cs_lnum_t *)cs_lagr_particles_attr_data(particle_set,
+                                                          particle_id, 0,
+                                                          attr));
 }
 
 /*----------------------------------------------------------------------------*/
@@ -623,9 +864,9 @@ cs_lagr_particles_get_lnum_n(const cs_lagr_particle_set_t  *particle_set,
 {
   assert(particle_set->p_am->count[time_id][attr] > 0);
 
-  return *((const cs_lnum_t *)(  particle_set->p_buffer
-                               + particle_set->p_am->extents*particle_id
-                               + particle_set->p_am->displ[time_id][attr]));
+  return *((const cs_lnum_t *)cs_lagr_particles_attr_data(particle_set,
+                                                          particle_id, time_id,
+                                                          attr));
 }
 
 /*----------------------------------------------------------------------------*/
@@ -647,9 +888,8 @@ cs_lagr_particles_set_lnum(cs_lagr_particle_set_t  *particle_set,
 {
   assert(particle_set->p_am->count[0][attr] > 0);
 
-  *((cs_lnum_t *)(  particle_set->p_buffer
-                  + particle_set->p_am->extents*particle_id
-                  + particle_set->p_am->displ[0][attr])) = value;
+  *((cs_lnum_t *)cs_lagr_particles_attr_data(particle_set, particle_id, 0,
+                                             attr)) = value;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -674,9 +914,8 @@ cs_lagr_particles_set_lnum_n(cs_lagr_particle_set_t  *particle_set,
 {
   assert(particle_set->p_am->count[time_id][attr] > 0);
 
-  *((cs_lnum_t *)(  particle_set->p_buffer
-                  + particle_set->p_am->extents*particle_id
-                  + particle_set->p_am->displ[time_id][attr])) = value;
+  *((cs_lnum_t *)cs_lagr_particles_attr_data(particle_set, particle_id, time_id,
+                                             attr)) = value;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -698,9 +937,9 @@ cs_lagr_particles_get_gnum(const cs_lagr_particle_set_t  *particle_set,
 {
   assert(particle_set->p_am->count[0][attr] > 0);
 
-  return *((const cs_gnum_t *)(  particle_set->p_buffer
-                               + particle_set->p_am->extents*particle_id
-                               + particle_set->p_am->displ[0][attr]));
+  return *((const cs_gnum_t *)cs_lagr_particles_attr_data(particle_set,
+                                                          particle_id, 0,
+                                                          attr));
 }
 
 /*----------------------------------------------------------------------------*/
@@ -725,9 +964,9 @@ cs_lagr_particles_get_gnum_n(const cs_lagr_particle_set_t  *particle_set,
 {
   assert(particle_set->p_am->count[time_id][attr] > 0);
 
-  return *((const cs_gnum_t *)(  particle_set->p_buffer
-                               + particle_set->p_am->extents*particle_id
-                               + particle_set->p_am->displ[time_id][attr]));
+  return *((const cs_gnum_t *)cs_lagr_particles_attr_data(particle_set,
+                                                          particle_id, time_id,
+                                                          attr));
 }
 
 /*----------------------------------------------------------------------------*/
@@ -749,9 +988,8 @@ cs_lagr_particles_set_gnum(cs_lagr_particle_set_t  *particle_set,
 {
   assert(particle_set->p_am->count[0][attr] > 0);
 
-  *((cs_gnum_t *)(  particle_set->p_buffer
-                  + particle_set->p_am->extents*particle_id
-                  + particle_set->p_am->displ[0][attr])) = value;
+  *((cs_gnum_t *)cs_lagr_particles_attr_data(particle_set, particle_id, 0,
+                                             attr)) = value;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -776,9 +1014,8 @@ cs_lagr_particles_set_gnum_n(cs_lagr_particle_set_t  *particle_set,
 {
   assert(particle_set->p_am->count[time_id][attr] > 0);
 
-  *((cs_gnum_t *)(  particle_set->p_buffer
-                  + particle_set->p_am->extents*particle_id
-                  + particle_set->p_am->displ[time_id][attr])) = value;
+  *((cs_gnum_t *)cs_lagr_particles_attr_data(particle_set, particle_id, time_id,
+                                             attr)) = value;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -800,9 +1037,9 @@ cs_lagr_particles_get_real(const cs_lagr_particle_set_t  *particle_set,
 {
   assert(particle_set->p_am->count[0][attr] > 0);
 
-  return *((const cs_real_t *)(  particle_set->p_buffer
-                               + particle_set->p_am->extents*particle_id
-                               + particle_set->p_am->displ[0][attr]));
+  return *((const cs_real_t *)cs_lagr_particles_attr_data(particle_set,
+                                                          particle_id, 0,
+                                                          attr));
 }
 
 /*----------------------------------------------------------------------------*/
@@ -827,9 +1064,9 @@ cs_lagr_particles_get_real_n(const cs_lagr_particle_set_t  *particle_set,
 {
   assert(particle_set->p_am->count[time_id][attr] > 0);
 
-  return *((const cs_real_t *)(  particle_set->p_buffer
-                               + particle_set->p_am->extents*particle_id
-                               + particle_set->p_am->displ[time_id][attr]));
+  return *((const cs_real_t *)cs_lagr_particles_attr_data(particle_set,
+                                                          particle_id, time_id,
+                                                          attr));
 }
 
 /*----------------------------------------------------------------------------*/
@@ -851,9 +1088,8 @@ cs_lagr_particles_set_real(cs_lagr_particle_set_t  *particle_set,
 {
   assert(particle_set->p_am->count[0][attr] > 0);
 
-  *((cs_real_t *)(  particle_set->p_buffer
-                  + particle_set->p_am->extents*particle_id
-                  + particle_set->p_am->displ[0][attr])) = value;
+  *((cs_real_t *)cs_lagr_particles_attr_data(particle_set, particle_id, 0,
+                                             attr)) = value;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -878,9 +1114,8 @@ cs_lagr_particles_set_real_n(cs_lagr_particle_set_t  *particle_set,
 {
   assert(particle_set->p_am->count[time_id][attr] > 0);
 
-  *((cs_real_t *)(  particle_set->p_buffer
-                  + particle_set->p_am->extents*particle_id
-                  + particle_set->p_am->displ[time_id][attr])) = value;
+  *((cs_real_t *)cs_lagr_particles_attr_data(particle_set, particle_id, time_id,
+                                             attr)) = value;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -904,9 +1139,8 @@ cs_lagr_particles_source_terms(cs_lagr_particle_set_t  *particle_set,
   assert(particle_set->p_am->source_term_displ != NULL);
   assert(particle_set->p_am->source_term_displ[attr] >= 0);
 
-  return (cs_real_t *)(  (unsigned char *)particle_set->p_buffer
-                       + particle_set->p_am->extents*particle_id
-                       + particle_set->p_am->source_term_displ[attr]);
+  return (cs_real_t *)cs_lagr_particles_st_data(particle_set, particle_id,
+                                                attr);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -930,9 +1164,8 @@ cs_lagr_particles_source_terms_const(cs_lagr_particle_set_t  *particle_set,
   assert(particle_set->p_am->source_term_displ != NULL);
   assert(particle_set->p_am->source_term_displ[attr] >= 0);
 
-  return (const cs_real_t *)(  (unsigned char *)particle_set->p_buffer
-                             + particle_set->p_am->extents*particle_id
-                             + particle_set->p_am->source_term_displ[attr]);
+  return (const cs_real_t *)cs_lagr_particles_st_data(particle_set, particle_id,
+                                                      attr);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -954,7 +1187,7 @@ cs_lagr_particle_attr(void                           *particle,
 {
   assert(attr_map->count[0][attr] > 0);
 
-  return  (unsigned char *)particle + attr_map->displ[0][attr];
+  return cs_lagr_particle_attr_data(particle, attr_map, 0, attr);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -976,7 +1209,7 @@ cs_lagr_particle_attr_const(const void                     *particle,
 {
   assert(attr_map->count[0][attr] > 0);
 
-  return  (const unsigned char *)particle + attr_map->displ[0][attr];
+  return cs_lagr_particle_attr_data_const(particle, attr_map, 0, attr);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1000,7 +1233,7 @@ cs_lagr_particle_attr_n(void                           *particle,
 {
   assert(attr_map->count[time_id][attr] > 0);
 
-  return  (unsigned char *)particle + attr_map->displ[time_id][attr];
+  return cs_lagr_particle_attr_data(particle, attr_map, time_id, attr);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1024,8 +1257,8 @@ cs_lagr_particle_attr_n_const(const void                     *particle,
 {
   assert(attr_map->count[time_id][attr] > 0);
 
-  return    (const unsigned char *)particle
-          + attr_map->displ[time_id][attr];
+  return cs_lagr_particle_attr_data_const(particle, attr_map,
+                                          time_id, attr);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1047,8 +1280,8 @@ cs_lagr_particle_get_lnum(const void                     *particle,
 {
   assert(attr_map->count[0][attr] > 0);
 
-  return  *((const cs_lnum_t *)(  (const unsigned char *)particle
-                                + attr_map->displ[0][attr]));
+  return  *((const cs_lnum_t *)
+            cs_lagr_particle_attr_data_const(particle, attr_map, 0, attr));
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1073,8 +1306,9 @@ cs_lagr_particle_get_lnum_n(const void                     *particle,
 {
   assert(attr_map->count[time_id][attr] > 0);
 
-  return  *((const cs_lnum_t *)(  (const unsigned char *)particle
-                                + attr_map->displ[time_id][attr]));
+  return  *((const cs_lnum_t *)
+            cs_lagr_particle_attr_data_const(particle, attr_map,
+                                             time_id, attr));
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1096,7 +1330,7 @@ cs_lagr_particle_set_lnum(void                           *particle,
 {
   assert(attr_map->count[0][attr] > 0);
 
-  *((cs_lnum_t *)((unsigned char *)particle + attr_map->displ[0][attr]))
+  *((cs_lnum_t *)cs_lagr_particle_attr_data(particle, attr_map, 0, attr))
     = value;
 }
 
@@ -1122,8 +1356,8 @@ cs_lagr_particle_set_lnum_n(void                           *particle,
 {
   assert(attr_map->count[time_id][attr] > 0);
 
-  *((cs_lnum_t *)(  (unsigned char *)particle
-                  + attr_map->displ[time_id][attr])) = value;
+  *((cs_lnum_t *)cs_lagr_particle_attr_data(particle, attr_map, time_id,
+                                            attr)) = value;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1145,8 +1379,8 @@ cs_lagr_particle_get_gnum(const void                     *particle,
 {
   assert(attr_map->count[0][attr] > 0);
 
-  return  *((const cs_gnum_t *)(  (const unsigned char *)particle
-                                + attr_map->displ[0][attr]));
+  return  *((const cs_gnum_t *)
+            cs_lagr_particle_attr_data_const(particle, attr_map, 0, attr));
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1171,8 +1405,9 @@ cs_lagr_particle_get_gnum_n(const void                     *particle,
 {
   assert(attr_map->count[time_id][attr] > 0);
 
-  return  *((const cs_gnum_t *)(  (const unsigned char *)particle
-                                + attr_map->displ[time_id][attr]));
+  return  *((const cs_gnum_t *)
+            cs_lagr_particle_attr_data_const(particle, attr_map,
+                                             time_id, attr));
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1194,7 +1429,7 @@ cs_lagr_particle_set_gnum(void                           *particle,
 {
   assert(attr_map->count[0][attr] > 0);
 
-  *((cs_gnum_t *)((unsigned char *)particle + attr_map->displ[0][attr]))
+  *((cs_gnum_t *)cs_lagr_particle_attr_data(particle, attr_map, 0, attr))
     = value;
 }
 
@@ -1220,8 +1455,8 @@ cs_lagr_particle_set_gnum_n(void                           *particle,
 {
   assert(attr_map->count[time_id][attr] > 0);
 
-  *((cs_gnum_t *)(  (unsigned char *)particle
-                  + attr_map->displ[time_id][attr])) = value;
+  *((cs_gnum_t *)cs_lagr_particle_attr_data(particle, attr_map, time_id,
+                                            attr)) = value;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1243,8 +1478,8 @@ cs_lagr_particle_get_real(const void                     *particle,
 {
   assert(attr_map->count[0][attr] > 0);
 
-  return  *((const cs_real_t *)(  (const unsigned char *)particle
-                                + attr_map->displ[0][attr]));
+  return  *((const cs_real_t *)
+            cs_lagr_particle_attr_data_const(particle, attr_map, 0, attr));
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1269,8 +1504,9 @@ cs_lagr_particle_get_real_n(const void                     *particle,
 {
   assert(attr_map->count[time_id][attr] > 0);
 
-  return  *((const cs_real_t *)(  (const unsigned char *)particle
-                                + attr_map->displ[time_id][attr]));
+  return  *((const cs_real_t *)
+            cs_lagr_particle_attr_data_const(particle, attr_map,
+                                             time_id, attr));
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1292,7 +1528,7 @@ cs_lagr_particle_set_real(void                           *particle,
 {
   assert(attr_map->count[0][attr] > 0);
 
-  *((cs_real_t *)((unsigned char *)particle + attr_map->displ[0][attr]))
+  *((cs_real_t *)cs_lagr_particle_attr_data(particle, attr_map, 0, attr))
     = value;
 }
 
@@ -1318,8 +1554,8 @@ cs_lagr_particle_set_real_n(void                           *particle,
 {
   assert(attr_map->count[time_id][attr] > 0);
 
-  *((cs_real_t *)(  (unsigned char *)particle
-                  + attr_map->displ[time_id][attr])) = value;
+  *((cs_real_t *)cs_lagr_particle_attr_data(particle, attr_map, time_id,
+                                            attr)) = value;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1342,8 +1578,7 @@ cs_lagr_particle_source_term(void                           *particle,
   assert(attr_map->source_term_displ != NULL);
   assert(attr_map->source_term_displ[attr] >= 0);
 
-  return  (cs_real_t *)(  (unsigned char *)particle
-                        + attr_map->source_term_displ[attr]);
+  return  (cs_real_t *)cs_lagr_particle_st_data(particle, attr_map, attr);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1366,8 +1601,7 @@ cs_lagr_particle_source_term_const(void                           *particle,
   assert(attr_map->source_term_displ != NULL);
   assert(attr_map->source_term_displ[attr] >= 0);
 
-  return  (const cs_real_t *)(  (unsigned char *)particle
-                              + attr_map->source_term_displ[attr]);
+  return  (const cs_real_t *)cs_lagr_particle_st_data(particle, attr_map, attr);
 }
 
 /*----------------------------------------------------------------------------
@@ -1439,6 +1673,68 @@ void
 cs_lagr_particles_current_to_previous(cs_lagr_particle_set_t  *particles,
                                       cs_lnum_t                particle_id);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Copy data of a range of particles to an array of particle records.
+ *
+ * The destination buffer uses the array of structures layout, whatever
+ * the particle set's layout, so that it may be used for exchanges or
+ * temporary storage (each particle using extents bytes).
+ *
+ * \param[in]   particles    associated particle set
+ * \param[in]   start_id     id of first particle to copy
+ * \param[in]   n_particles  number of particles to copy
+ * \param[out]  buffer       destination buffer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particles_pack(const cs_lagr_particle_set_t  *particles,
+                       cs_lnum_t                      start_id,
+                       cs_lnum_t                      n_particles,
+                       void                          *buffer);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Copy data of a range of particles from an array of
+ *        particle records.
+ *
+ * This is the reverse operation of \ref cs_lagr_particles_pack.
+ * The particle set must already be sized to hold the copied particles.
+ *
+ * \param[in, out]  particles    associated particle set
+ * \param[in]       start_id     id of first particle to copy to
+ * \param[in]       n_particles  number of particles to copy
+ * \param[in]       buffer       source buffer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particles_unpack(cs_lagr_particle_set_t  *particles,
+                         cs_lnum_t                start_id,
+                         cs_lnum_t                n_particles,
+                         const void              *buffer);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Copy data of a range of particles to another position
+ *        in the same set.
+ *
+ * Source and destination ranges may overlap.
+ *
+ * \param[in, out]  particles    associated particle set
+ * \param[in]       dest_id      id of first destination particle
+ * \param[in]       src_id       id of first source particle
+ * \param[in]       n_particles  number of particles to copy
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particles_copy(cs_lagr_particle_set_t  *particles,
+                       cs_lnum_t                dest_id,
+                       cs_lnum_t                src_id,
+                       cs_lnum_t                n_particles);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Dump a cs_lagr_particle_set_t structure
@@ -1461,6 +1757,20 @@ cs_lagr_particle_set_dump(const cs_lagr_particle_set_t  *particles);
 void
 cs_lagr_set_n_user_variables(int  n_user_variables);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set data storage layout for particle sets.
+ *
+ * This function must be called before the particle attribute map is
+ * defined, for example in \ref cs_user_lagr_model.
+ *
+ * \param[in]  layout  particle data storage layout
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_set_particle_layout(cs_lagr_particle_layout_t  layout);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -210,9 +210,8 @@ _set_particle_values(cs_lagr_particle_set_t  *particles,
   for (i = 0; i < n_particles; i++) {
     const unsigned char *src = _values + i*_length;
     unsigned char
-      *dest = (unsigned char *)(particles->p_buffer + i*extents)
-               + displ
-               + component_id * _length;
+      *dest = cs_lagr_particles_data(particles, i, displ, size)
+              + component_id * _length;
     for (j = 0; j < _length; j++)
       dest[j] = src[j];
   }
@@ -171,7 +171,6 @@ _lages1(cs_real_t           dtp,
 {
   /* Particles management */
   cs_lagr_particle_set_t  *p_set = cs_glob_lagr_particle_set;
-  const cs_lagr_attribute_map_t  *p_am = p_set->p_am;
 
   cs_lagr_extra_module_t *extra = cs_get_lagr_extra_module();
 
@@ -179,15 +178,6 @@ _lages1(cs_real_t           dtp,
 
   cs_real_t tkelvi = cs_physical_constants_celsius_to_kelvin;
 
-  cs_real_t aux1, aux2, aux3, aux4, aux5, aux6, aux7, aux8, aux9, aux10, aux11;
-  cs_real_t ter1f, ter2f, ter3f;
-  cs_real_t ter1p, ter2p, ter3p, ter4p, ter5p;
-  cs_real_t ter1x, ter2x, ter3x, ter4x, ter5x;
-  cs_real_t p11, p21, p22, p31, p32, p33;
-  cs_real_t omega2, gama2, omegam;
-  cs_real_t grga2, gagam, gaome;
-  cs_real_t tbrix1, tbrix2, tbriu;
-
   cs_lnum_t nor = cs_glob_lagr_time_step->nor;
 
   const int _prev_id = (extra->vel->n_time_vals > 1) ? 1 : 0;
@@ -196,31 +186,39 @@ _lages1(cs_real_t           dtp,
 
   /* Integrate SDE's over particles */
 
+# pragma omp parallel for if (p_set->n_particles > CS_THR_MIN)
   for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
 
-    unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
+    cs_real_t aux1, aux2, aux3, aux4, aux5, aux6, aux7, aux8, aux9, aux10, aux11;
+    cs_real_t ter1f, ter2f, ter3f;
+    cs_real_t ter1p, ter2p, ter3p, ter4p, ter5p;
+    cs_real_t ter1x, ter2x, ter3x, ter4x, ter5x;
+    cs_real_t p11, p21, p22, p31, p32, p33;
+    cs_real_t omega2, gama2, omegam;
+    cs_real_t grga2, gagam, gaome;
+    cs_real_t tbrix1, tbrix2, tbriu;
 
     if (cs_lagr_particles_get_flag(p_set, ip, CS_LAGR_PART_FIXED))
         continue;
 
-    cs_lnum_t cell_id = cs_lagr_particle_get_lnum(particle, p_am,
-                                                  CS_LAGR_CELL_ID);
+    cs_lnum_t cell_id = cs_lagr_particles_get_lnum(p_set, ip,
+                                                   CS_LAGR_CELL_ID);
 
     if (cell_id >= 0) {
 
       /* Get particle coordinates, velocity and velocity seen*/
-      cs_real_t *old_part_vel      = cs_lagr_particle_attr_n(particle, p_am, 1,
-                                                             CS_LAGR_VELOCITY);
-      cs_real_t *old_part_vel_seen = cs_lagr_particle_attr_n(particle, p_am, 1,
-                                                             CS_LAGR_VELOCITY_SEEN);
-      cs_real_t *old_part_coords   = cs_lagr_particle_attr_n(particle, p_am, 1,
-                                                             CS_LAGR_COORDS);
-      cs_real_t *part_vel          = cs_lagr_particle_attr(particle, p_am,
-                                                           CS_LAGR_VELOCITY);
-      cs_real_t *part_vel_seen     = cs_lagr_particle_attr(particle, p_am,
-                                                           CS_LAGR_VELOCITY_SEEN);
-      cs_real_t *part_coords       = cs_lagr_particle_attr(particle, p_am,
-                                                           CS_LAGR_COORDS);
+      cs_real_t *old_part_vel      = cs_lagr_particles_attr_n(p_set, ip, 1,
+                                                              CS_LAGR_VELOCITY);
+      cs_real_t *old_part_vel_seen = cs_lagr_particles_attr_n(p_set, ip, 1,
+                                                              CS_LAGR_VELOCITY_SEEN);
+      cs_real_t *old_part_coords   = cs_lagr_particles_attr_n(p_set, ip, 1,
+                                                              CS_LAGR_COORDS);
+      cs_real_t *part_vel          = cs_lagr_particles_attr(p_set, ip,
+                                                            CS_LAGR_VELOCITY);
+      cs_real_t *part_vel_seen     = cs_lagr_particles_attr(p_set, ip,
+                                                            CS_LAGR_VELOCITY_SEEN);
+      cs_real_t *part_coords       = cs_lagr_particles_attr(p_set, ip,
+                                                            CS_LAGR_COORDS);
 
       /* Initialize (without change of frame)*/
 
@@ -247,7 +245,7 @@ _lages1(cs_real_t           dtp,
         cs_real_33_t trans_m;
         if (cs_glob_lagr_model->shape == 2 ) {
           // Use euler angles for spheroids (jeffery)
-          cs_real_t *euler = cs_lagr_particle_attr(particle, p_am,
+          cs_real_t *euler = cs_lagr_particles_attr(p_set, ip,
               CS_LAGR_EULER);
 
           trans_m[0][0] = 2.*(euler[0]*euler[0]+euler[1]*euler[1]-0.5);/* (0,0) */
@@ -262,8 +260,8 @@ _lages1(cs_real_t           dtp,
         }
         else if (cs_glob_lagr_model->shape == 1 ) {
           // Use rotation matrix for stochastic model
-          cs_real_t *orient_loc  = cs_lagr_particle_attr(particle, p_am,
-                                                         CS_LAGR_ORIENTATION);
+          cs_real_t *orient_loc  = cs_lagr_particles_attr(p_set, ip,
+                                                          CS_LAGR_ORIENTATION);
           cs_real_t axe_singularity[3] = { 1.0, 0.0, 0.0 };
           // Get vector for rotation
           cs_real_t n_rot[3];
@@ -308,10 +306,10 @@ _lages1(cs_real_t           dtp,
 
         /* 1.7 - taup  */
 
-        cs_real_t *radii = cs_lagr_particle_attr(particle, p_am,
+        cs_real_t *radii = cs_lagr_particles_attr(p_set, ip,
             CS_LAGR_RADII);
 
-        cs_real_t *s_p = cs_lagr_particle_attr(particle, p_am,
+        cs_real_t *s_p = cs_lagr_particles_attr(p_set, ip,
             CS_LAGR_SHAPE_PARAM);
 
         taup_r[0] = 3.0 / 8.0 * taup[ip] * (radii[0]*radii[0]*s_p[0]+ s_p[3])
@@ -473,7 +471,7 @@ _lages1(cs_real_t           dtp,
           else
             tempf = cs_glob_fluid_properties->t0;
 
-          cs_real_t p_mass = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_MASS);
+          cs_real_t p_mass = cs_lagr_particles_get_real(p_set, ip, CS_LAGR_MASS);
 
           cs_real_t ddbr = sqrt(2.0 * _k_boltz * tempf / (p_mass * taup_r[id]));
 
@@ -552,8 +550,8 @@ _lages1(cs_real_t           dtp,
         /* 3.0 - get rotation matrix */
         cs_real_33_t trans_m;
         if (cs_glob_lagr_model->shape == 2) {
-          cs_real_t *euler = cs_lagr_particle_attr(particle, p_am,
-                                                   CS_LAGR_EULER);
+          cs_real_t *euler = cs_lagr_particles_attr(p_set, ip,
+                                                    CS_LAGR_EULER);
           trans_m[0][0] = 2.*(euler[0]*euler[0]+euler[1]*euler[1]-0.5);/* (0,0) */
           trans_m[0][1] = 2.*(euler[1]*euler[2]-euler[0]*euler[3]);    /* (0,1) */
           trans_m[0][2] = 2.*(euler[1]*euler[3]+euler[0]*euler[2]);    /* (0,2) */
@@ -567,8 +565,8 @@ _lages1(cs_real_t           dtp,
         }
         else if (cs_glob_lagr_model->shape == 1) {
           // Use rotation matrix for stochastic model
-          cs_real_t *orient_loc  = cs_lagr_particle_attr(particle, p_am,
-                                                         CS_LAGR_ORIENTATION);
+          cs_real_t *orient_loc  = cs_lagr_particles_attr(p_set, ip,
+                                                          CS_LAGR_ORIENTATION);
           cs_real_t axe_singularity[3] = { 1.0, 0.0, 0.0 };
           // Get vector for rotation
           cs_real_t n_rot[3];
@@ -502,17 +502,14 @@ _vol_fraction(const void                 *input,
 
     for (cs_lnum_t part = 0; part < p_set->n_particles; part++) {
 
-      unsigned char *particle
-        = p_set->p_buffer + p_set->p_am->extents * part;
+      cs_real_t diam = cs_lagr_particles_get_real(p_set, part,
+                                                  CS_LAGR_DIAMETER);
 
-      cs_real_t diam = cs_lagr_particle_get_real(particle, p_set->p_am,
-                                                 CS_LAGR_DIAMETER);
+      cs_lnum_t cell_id = cs_lagr_particles_get_lnum(p_set, part,
+                                                     CS_LAGR_CELL_ID);
 
-      cs_lnum_t cell_id = cs_lagr_particle_get_lnum(particle, p_set->p_am,
-                                                    CS_LAGR_CELL_ID);
-
-      cs_real_t p_weight = cs_lagr_particle_get_real(particle, p_set->p_am,
-                                                     CS_LAGR_STAT_WEIGHT);
+      cs_real_t p_weight = cs_lagr_particles_get_real(p_set, part,
+                                                      CS_LAGR_STAT_WEIGHT);
 
       cs_real_t vol = cs_glob_mesh_quantities->cell_vol[cell_id];
 
@@ -526,22 +523,17 @@ _vol_fraction(const void                 *input,
 
     for (cs_lnum_t part = 0; part < p_set->n_particles; part++) {
 
-      unsigned char *particle
-        = p_set->p_buffer + p_set->p_am->extents * part;
-
-      int p_class = cs_lagr_particle_get_lnum(particle,
-                                              p_set->p_am,
-                                              CS_LAGR_STAT_CLASS);
+      int p_class = cs_lagr_particles_get_lnum(p_set, part, CS_LAGR_STAT_CLASS);
 
       if (p_class == class_id) {
-        cs_real_t diam = cs_lagr_particle_get_real(particle, p_set->p_am,
-                                                   CS_LAGR_DIAMETER);
+        cs_real_t diam = cs_lagr_particles_get_real(p_set, part,
+                                                    CS_LAGR_DIAMETER);
 
-        cs_lnum_t cell_id = cs_lagr_particle_get_lnum(particle, p_set->p_am,
-                                                      CS_LAGR_CELL_ID);
+        cs_lnum_t cell_id = cs_lagr_particles_get_lnum(p_set, part,
+                                                       CS_LAGR_CELL_ID);
 
-        cs_real_t p_weight = cs_lagr_particle_get_real(particle, p_set->p_am,
-                                                       CS_LAGR_STAT_WEIGHT);
+        cs_real_t p_weight = cs_lagr_particles_get_real(p_set, part,
+                                                        CS_LAGR_STAT_WEIGHT);
 
         cs_real_t vol = cs_glob_mesh_quantities->cell_vol[cell_id];
 
@@ -2924,14 +2916,13 @@ _cs_lagr_stat_update_all(void)
               unsigned char *particle
                 = p_set->p_buffer + p_set->p_am->extents * part;
 
-              cs_lnum_t cell_id = cs_lagr_particle_get_lnum(particle, p_set->p_am,
-                                                            CS_LAGR_CELL_ID);
+              cs_lnum_t cell_id = cs_lagr_particles_get_lnum(p_set, part,
+                                                             CS_LAGR_CELL_ID);
 
               int p_class = 0;
               if (p_set->p_am->displ[0][CS_LAGR_STAT_CLASS] > 0)
-                p_class = cs_lagr_particle_get_lnum(particle,
-                                                    p_set->p_am,
-                                                    CS_LAGR_STAT_CLASS);
+                p_class = cs_lagr_particles_get_lnum(p_set, part,
+                                                     CS_LAGR_STAT_CLASS);
 
               if (cell_id >= 0 && (p_class == mt->class || mt->class == 0)) {
 
@@ -2940,9 +2931,8 @@ _cs_lagr_stat_update_all(void)
                 cs_real_t p_weight;
 
                 if (mwa->p_data_func == NULL)
-                  p_weight = cs_lagr_particle_get_real(particle,
-                                                       p_set->p_am,
-                                                       CS_LAGR_STAT_WEIGHT);
+                  p_weight = cs_lagr_particles_get_real(p_set, part,
+                                                        CS_LAGR_STAT_WEIGHT);
                 else
                   mwa->p_data_func(mwa->data_input,
                                    particle,
@@ -2951,7 +2941,7 @@ _cs_lagr_stat_update_all(void)
                 p_weight *= dt_val[cell_id*dt_mult];
 
                 if (mt->p_data_func == NULL)
-                  pval = cs_lagr_particle_attr(particle, p_set->p_am, attr_id);
+                  pval = cs_lagr_particles_attr(p_set, part, attr_id);
                 else
                   mt->p_data_func(mt->data_input, particle, p_set->p_am, pval);
 
@@ -3095,14 +3085,12 @@ _cs_lagr_stat_update_all(void)
         unsigned char *particle
           = p_set->p_buffer + p_set->p_am->extents * part;
 
-        cs_lnum_t cell_id = cs_lagr_particle_get_lnum(particle, p_set->p_am,
-                                                      CS_LAGR_CELL_ID);
+        cs_lnum_t cell_id = cs_lagr_particles_get_lnum(p_set, part,
+                                                       CS_LAGR_CELL_ID);
 
         int p_class = 0;
         if (p_set->p_am->displ[0][CS_LAGR_STAT_CLASS] > 0)
-          p_class = cs_lagr_particle_get_lnum(particle,
-                                              p_set->p_am,
-                                              CS_LAGR_STAT_CLASS);
+          p_class = cs_lagr_particles_get_lnum(p_set, part, CS_LAGR_STAT_CLASS);
 
         if (cell_id >= 0 && (p_class == mwa->class || mwa->class == 0)) {
 
@@ -3111,9 +3099,8 @@ _cs_lagr_stat_update_all(void)
           cs_real_t p_weight;
 
           if (mwa->p_data_func == NULL)
-            p_weight = cs_lagr_particle_get_real(particle,
-                                                 p_set->p_am,
-                                                 CS_LAGR_STAT_WEIGHT);
+            p_weight = cs_lagr_particles_get_real(p_set, part,
+                                                  CS_LAGR_STAT_WEIGHT);
           else
             mwa->p_data_func(mwa->data_input,
                              particle,
@@ -4374,6 +4361,35 @@ cs_lagr_stat_map_cell_dt(const cs_real_t  *dt)
   _p_dt = dt;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Transfer Lagrangian statistics weight accumulators not based on
+ *        fields after a mesh redistribution.
+ *
+ * Moments are based on fields, which are transferred separately.
+ * A mapped time step values array is unmapped, so the field referenced
+ * by field pointer CS_F_(dt) is used after this call.
+ *
+ * \param[in, out]  mt  pointer to mesh transfer structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_stat_mesh_transfer(cs_mesh_transfer_t  *mt)
+{
+  _p_dt = NULL;
+
+  for (int i = 0; i < _n_lagr_moments_wa; i++) {
+    cs_lagr_moment_wa_t *mwa = _lagr_moments_wa + i;
+    if (mwa->f_id < 0 && mwa->location_id != CS_MESH_LOCATION_NONE)
+      cs_mesh_transfer_array(mt,
+                             mwa->location_id,
+                             CS_REAL_TYPE,
+                             1,
+                             (void **)&(mwa->val));
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Lagrangian statistics initialization.
@@ -32,6 +32,7 @@
 #include "assert.h"
 #include "cs_base.h"
 #include "cs_field.h"
+#include "cs_mesh_transfer.h"
 #include "cs_restart.h"
 
 #include "cs_lagr.h"
@@ -577,6 +578,22 @@ cs_lagr_stat_type_by_name(const char  *name);
 void
 cs_lagr_stat_map_cell_dt(const cs_real_t  *dt);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Transfer Lagrangian statistics weight accumulators not based on
+ *        fields after a mesh redistribution.
+ *
+ * Moments are based on fields, which are transferred separately.
+ * A mapped time step values array is unmapped, so the field referenced
+ * by field pointer CS_F_(dt) is used after this call.
+ *
+ * \param[in, out]  mt  pointer to mesh transfer structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_stat_mesh_transfer(cs_mesh_transfer_t  *mt);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Lagrangian statistics initialization.
@@ -54,6 +54,7 @@
 
 #include "fvm_periodicity.h"
 
+#include "cs_all_to_all.h"
 #include "cs_base.h"
 #include "cs_boundary_zone.h"
 #include "cs_physical_constants.h"
@@ -69,6 +70,7 @@
 #include "cs_random.h"
 #include "cs_rotation.h"
 #include "cs_search.h"
+#include "cs_sort.h"
 #include "cs_timer_stats.h"
 #include "cs_turbomachinery.h"
 
@@ -189,6 +191,25 @@ typedef struct {
 
 } cs_lagr_halo_t;
 
+/* Lists of particles requiring additional handling after the
+   (possibly threaded) local propagation stage */
+/* ---------------------------------------------------------------*/
+
+typedef struct {
+
+  cs_lnum_t     n_sync;          /* Number of particles changing rank */
+  cs_lnum_t     n_sync_max;      /* Allocated size of sync_ids */
+  cs_lnum_t     n_deferred;      /* Number of particles whose propagation
+                                    was interrupted by a face interaction */
+  cs_lnum_t     n_deferred_max;  /* Allocated size of deferred arrays */
+
+  cs_lnum_t    *sync_ids;        /* Ids of particles changing rank */
+  cs_lnum_t    *deferred_ids;    /* Ids of deferred particles */
+  cs_lnum_t    *deferred_loop;   /* Propagation loop count of deferred
+                                    particles */
+
+} cs_lagr_track_list_t;
+
 /* Structures useful to build and manage the Lagrangian computation:
    - exchanging of particles between communicating ranks
    - finding the next cells where the particle moves on to
@@ -206,6 +227,12 @@ typedef struct {
 
   cs_interface_set_t  *face_ifs;
 
+  /* Thread-local particle lists, and merged list */
+
+  int                    n_lists;
+  cs_lagr_track_list_t  *lists;
+  cs_lagr_track_list_t   merged;
+
 } cs_lagr_track_builder_t;
 
 /*============================================================================
@@ -247,8 +274,9 @@ inline static cs_lagr_tracking_info_t *
 _tracking_info(cs_lagr_particle_set_t  *particle_set,
                cs_lnum_t                particle_id)
 {
-  return (cs_lagr_tracking_info_t *)(  particle_set->p_buffer
-                                     + particle_set->p_am->extents*particle_id);
+  return (cs_lagr_tracking_info_t *)
+    cs_lagr_particles_data(particle_set, particle_id,
+                           0, particle_set->p_am->lb);
 }
 
 /*----------------------------------------------------------------------------
@@ -267,7 +295,8 @@ _get_tracking_info(const cs_lagr_particle_set_t  *particle_set,
                    cs_lnum_t                      particle_id)
 {
   return (const cs_lagr_tracking_info_t *)
-    (particle_set->p_buffer + particle_set->p_am->extents*particle_id);
+    cs_lagr_particles_data(particle_set, particle_id,
+                           0, particle_set->p_am->lb);
 }
 
 /*----------------------------------------------------------------------------
@@ -736,6 +765,146 @@ _define_cell_face_connect(cs_lagr_track_builder_t   *builder)
   BFT_FREE(counter);
 }
 
+/*----------------------------------------------------------------------------
+ * Initialize a particle list structure.
+ *
+ * parameters:
+ *   l <-> pointer to particle list structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_track_list_init(cs_lagr_track_list_t  *l)
+{
+  l->n_sync = 0;
+  l->n_sync_max = 0;
+  l->n_deferred = 0;
+  l->n_deferred_max = 0;
+
+  l->sync_ids = NULL;
+  l->deferred_ids = NULL;
+  l->deferred_loop = NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Free arrays of a particle list structure.
+ *
+ * parameters:
+ *   l <-> pointer to particle list structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_track_list_free(cs_lagr_track_list_t  *l)
+{
+  BFT_FREE(l->sync_ids);
+  BFT_FREE(l->deferred_ids);
+  BFT_FREE(l->deferred_loop);
+
+  _track_list_init(l);
+}
+
+/*----------------------------------------------------------------------------
+ * Add a particle changing rank to a particle list.
+ *
+ * parameters:
+ *   l    <-> pointer to particle list structure
+ *   p_id <-- particle id
+ *----------------------------------------------------------------------------*/
+
+static void
+_track_list_add_sync(cs_lagr_track_list_t  *l,
+                     cs_lnum_t              p_id)
+{
+  if (l->n_sync >= l->n_sync_max) {
+    l->n_sync_max = CS_MAX(l->n_sync_max*2, CS_LAGR_MIN_COMM_BUF_SIZE);
+    BFT_REALLOC(l->sync_ids, l->n_sync_max, cs_lnum_t);
+  }
+
+  l->sync_ids[l->n_sync] = p_id;
+  l->n_sync += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Add a particle whose propagation was interrupted to a particle list.
+ *
+ * parameters:
+ *   l       <-> pointer to particle list structure
+ *   p_id    <-- particle id
+ *   loop_id <-- propagation loop count at interruption
+ *----------------------------------------------------------------------------*/
+
+static void
+_track_list_add_deferred(cs_lagr_track_list_t  *l,
+                         cs_lnum_t              p_id,
+                         int                    loop_id)
+{
+  if (l->n_deferred >= l->n_deferred_max) {
+    l->n_deferred_max = CS_MAX(l->n_deferred_max*2, CS_LAGR_MIN_COMM_BUF_SIZE);
+    BFT_REALLOC(l->deferred_ids, l->n_deferred_max, cs_lnum_t);
+    BFT_REALLOC(l->deferred_loop, l->n_deferred_max, cs_lnum_t);
+  }
+
+  l->deferred_ids[l->n_deferred] = p_id;
+  l->deferred_loop[l->n_deferred] = loop_id;
+  l->n_deferred += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Merge thread-local particle lists.
+ *
+ * As threads may handle particle chunks in any order, the merged list
+ * of deferred particles is sorted by particle id, so that the result
+ * does not depend on the number of threads or on scheduling.
+ *
+ * parameters:
+ *   builder <-> pointer to a cs_lagr_track_builder_t structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_merge_track_lists(cs_lagr_track_builder_t  *builder)
+{
+  cs_lagr_track_list_t  *m = &(builder->merged);
+
+  m->n_sync = 0;
+  m->n_deferred = 0;
+
+  for (int t_id = 0; t_id < builder->n_lists; t_id++) {
+
+    cs_lagr_track_list_t  *l = builder->lists + t_id;
+
+    for (cs_lnum_t i = 0; i < l->n_sync; i++)
+      _track_list_add_sync(m, l->sync_ids[i]);
+
+    for (cs_lnum_t i = 0; i < l->n_deferred; i++)
+      _track_list_add_deferred(m, l->deferred_ids[i], l->deferred_loop[i]);
+
+    l->n_sync = 0;
+    l->n_deferred = 0;
+
+  }
+
+  if (builder->n_lists > 1 && m->n_deferred > 1) {
+
+    cs_lnum_t  *order, *tmp;
+    BFT_MALLOC(order, m->n_deferred, cs_lnum_t);
+    BFT_MALLOC(tmp, m->n_deferred, cs_lnum_t);
+
+    cs_order_lnum_allocated(NULL, m->deferred_ids, order, m->n_deferred);
+
+    for (cs_lnum_t i = 0; i < m->n_deferred; i++)
+      tmp[i] = m->deferred_ids[order[i]];
+    for (cs_lnum_t i = 0; i < m->n_deferred; i++) {
+      m->deferred_ids[i] = tmp[i];
+      tmp[i] = m->deferred_loop[order[i]];
+    }
+    for (cs_lnum_t i = 0; i < m->n_deferred; i++)
+      m->deferred_loop[i] = tmp[i];
+
+    BFT_FREE(tmp);
+    BFT_FREE(order);
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Initialize a cs_lagr_track_builder_t structure.
  *
@@ -792,6 +961,16 @@ _init_track_builder(cs_lnum_t  n_particles_max,
   }
 #endif
 
+  /* Thread-local particle lists */
+
+  builder->n_lists = cs_glob_n_threads;
+  BFT_MALLOC(builder->lists, builder->n_lists, cs_lagr_track_list_t);
+
+  for (int t_id = 0; t_id < builder->n_lists; t_id++)
+    _track_list_init(builder->lists + t_id);
+
+  _track_list_init(&(builder->merged));
+
   return builder;
 }
 
@@ -819,6 +998,14 @@ _destroy_track_builder(cs_lagr_track_builder_t  *builder)
   _delete_lagr_halo(&(builder->halo));
   cs_interface_set_destroy(&(builder->face_ifs));
 
+  /* Destroy particle lists */
+
+  for (int t_id = 0; t_id < builder->n_lists; t_id++)
+    _track_list_free(builder->lists + t_id);
+  BFT_FREE(builder->lists);
+
+  _track_list_free(&(builder->merged));
+
   /* Destroy the builder structure */
 
   BFT_FREE(builder);
@@ -848,8 +1035,12 @@ _manage_error(cs_lnum_t                       failsafe_mode,
   cs_real_t *part_coord
     = cs_lagr_particle_attr(particle, attr_map, CS_LAGR_COORDS);
 
-  const cs_real_t  *prev_location
-    = ((const cs_lagr_tracking_info_t *)particle)->start_coords;
+  const cs_lagr_tracking_info_t *p_info
+    = (const cs_lagr_tracking_info_t *)cs_lagr_particle_data_const(particle,
+                                                                   attr_map,
+                                                                   0,
+                                                                   attr_map->lb);
+  const cs_real_t  *prev_location = p_info->start_coords;
 
   cs_real_t d0 = cs_math_3_distance(part_coord, prev_part_coord);
   cs_real_t d1 = cs_math_3_distance(part_coord, prev_location);
@@ -918,7 +1109,7 @@ _internal_treatment(cs_lagr_particle_set_t  *particles,
 
   cs_real_t  disp[3], face_normal[3], intersect_pt[3];
 
-  cs_lagr_tracking_info_t *p_info = (cs_lagr_tracking_info_t *)particle;
+  cs_lagr_tracking_info_t *p_info = _tracking_info(particles, p_id);
 
   cs_real_t  *particle_coord
     = cs_lagr_particle_attr(particle, p_am, CS_LAGR_COORDS);
@@ -1135,7 +1326,7 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
   cs_real_t* deposit_height_var = NULL;
   cs_real_t* deposit_diameter_sum = NULL;
 
-  cs_lagr_tracking_info_t *p_info = (cs_lagr_tracking_info_t *)particle;
+  cs_lagr_tracking_info_t *p_info = _tracking_info(particles, p_id);
 
   cs_real_t  *particle_coord
     = cs_lagr_particle_attr(particle, p_am, CS_LAGR_COORDS);
@@ -1838,10 +2029,21 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
  *   particles                <-> pointer to particle set
  *   events                   <-> events structure
  *   p_id                     <-- particle id
- *   displacement_step_id     <-- id of displacement step
+ *   displacement_step_id     <-- initial value of the propagation loop
+ *                                counter (checked against the maximum
+ *                                number of loops): the id of the current
+ *                                displacement step in the threaded stage,
+ *                                or the count returned in deferred_loop
+ *                                when resuming a deferred propagation
  *   failsafe_mode            <-- with (0) / without (1) failure capability
  *   b_face_zone_id           <-- boundary face zone id
  *   visc_length              <-- viscous layer thickness
+ *   u                        <-- pointer to fluid velocity field
+ *   deferred_loop            --> if non-NULL, interactions modifying data
+ *                                shared with other particles are not
+ *                                handled; the propagation stops before
+ *                                such an interaction, and the associated
+ *                                loop count is returned here (-1 otherwise)
  *
  * returns:
  *   a state associated to the status of the particle (treated, to be deleted,
@@ -1856,7 +2058,8 @@ _local_propagation(cs_lagr_particle_set_t         *particles,
                    int                             failsafe_mode,
                    const int                       b_face_zone_id[],
                    const cs_real_t                 visc_length[],
-                   const cs_field_t               *u)
+                   const cs_field_t               *u,
+                   int                            *deferred_loop)
 {
   cs_lnum_t  i;
   cs_real_t  disp[3];
@@ -1882,7 +2085,7 @@ _local_propagation(cs_lagr_particle_set_t         *particles,
 
   const cs_lagr_attribute_map_t  *p_am = particles->p_am;
   unsigned char *particle = particles->p_buffer + p_am->extents * p_id;
-  cs_lagr_tracking_info_t *p_info = (cs_lagr_tracking_info_t *)particle;
+  cs_lagr_tracking_info_t *p_info = _tracking_info(particles, p_id);
 
   cs_real_t  *particle_coord
     = cs_lagr_particle_attr(particle, p_am, CS_LAGR_COORDS);
@@ -2118,6 +2321,37 @@ _local_propagation(cs_lagr_particle_set_t         *particles,
       goto reloop_cen;
     }
 
+    /* Boundary faces, internal conditions and deposition events update
+       data shared with other particles (counters, events, boundary
+       statistics, random number generator); when requested, interrupt
+       the propagation so that they are handled later, in a fixed order.
+       As the face intersection is a function of the particle's data only,
+       resuming at the same loop count is equivalent to continuing here. */
+
+    if (deferred_loop != NULL && exit_face != 0) {
+
+      const cs_lagr_internal_condition_t *internal_conditions
+        = cs_glob_lagr_internal_conditions;
+
+      bool defer = false;
+
+      if (exit_face < 0)
+        defer = true;
+      else if (internal_conditions != NULL) {
+        if (internal_conditions->i_face_zone_id[exit_face - 1] > -1)
+          defer = true;
+      }
+      if (   lagr_model->deposition
+          && cs_lagr_particles_get_flag(particles, p_id, CS_LAGR_PART_ROLLING))
+        defer = true;
+
+      if (defer) {
+        *deferred_loop = n_loops;
+        return CS_LAGR_PART_TO_SYNC;
+      }
+
+    }
+
     /* Update boundary events when particle changes */
 
     if (lagr_model->deposition && exit_face != 0) {
@@ -2371,6 +2605,22 @@ _exchange_particles(const cs_halo_t         *halo,
 
   cs_lnum_t  n_recv_particles = 0;
 
+  /* With the structure of arrays layout, received particles are first
+     stored in a temporary buffer; otherwise, they are received
+     directly at the end of the particle set */
+
+  unsigned char *recv_buf = NULL, *_recv_buf = NULL;
+
+  if (particles->p_am->layout == CS_LAGR_PARTICLE_LAYOUT_SOA) {
+    cs_lnum_t n_recv_max = 0;
+    for (int rank = 0; rank < halo->n_c_domains; rank++)
+      n_recv_max += lag_halo->recv_count[rank];
+    BFT_MALLOC(_recv_buf, n_recv_max*tot_extents, unsigned char);
+    recv_buf = _recv_buf;
+  }
+  else
+    recv_buf = particles->p_buffer + tot_extents*particles->n_particles;
+
 #if defined(HAVE_MPI)
 
   if (cs_glob_n_ranks > 1) {
@@ -2383,15 +2633,13 @@ _exchange_particles(const cs_halo_t         *halo,
 
     for (rank = 0; rank < halo->n_c_domains; rank++) {
 
-      cs_lnum_t shift =   particles->n_particles
-                        + lag_halo->recv_shift[rank];
+      cs_lnum_t shift = lag_halo->recv_shift[rank];
 
       if (lag_halo->recv_count[rank] > 0) {
 
         if (halo->c_domain_rank[rank] != local_rank) {
-          void  *recv_buf = particles->p_buffer + tot_extents*shift;
           n_recv_particles += lag_halo->recv_count[rank];
-          MPI_Irecv(recv_buf,
+          MPI_Irecv(recv_buf + tot_extents*shift,
                     lag_halo->recv_count[rank],
                     _cs_mpi_particle_type,
                     halo->c_domain_rank[rank],
@@ -2447,8 +2695,7 @@ _exchange_particles(const cs_halo_t         *halo,
   if (halo->n_transforms > 0) {
     if (local_rank_id > -1) {
 
-      cs_lnum_t  recv_shift =   particles->n_particles
-                              + lag_halo->recv_shift[local_rank_id];
+      cs_lnum_t  recv_shift = lag_halo->recv_shift[local_rank_id];
       cs_lnum_t  send_shift = lag_halo->send_shift[local_rank_id];
 
       assert(   lag_halo->recv_count[local_rank_id]
@@ -2457,13 +2704,21 @@ _exchange_particles(const cs_halo_t         *halo,
       n_recv_particles += lag_halo->send_count[local_rank_id];
 
       for (cs_lnum_t i = 0; i < lag_halo->send_count[local_rank_id]; i++) {
-        memcpy(particles->p_buffer + tot_extents*(recv_shift + i),
+        memcpy(recv_buf + tot_extents*(recv_shift + i),
                lag_halo->send_buf + tot_extents*(send_shift + i),
                tot_extents);
       }
     }
   }
 
+  if (_recv_buf != NULL) {
+    cs_lagr_particles_unpack(particles,
+                             particles->n_particles,
+                             n_recv_particles,
+                             _recv_buf);
+    BFT_FREE(_recv_buf);
+  }
+
   /* Update particle count and weight */
 
   cs_real_t tot_weight = 0.;
@@ -2492,12 +2747,16 @@ _exchange_particles(const cs_halo_t         *halo,
  *   mesh      <-- pointer to associated mesh
  *   lag_halo  <-> pointer to particle halo structure to update
  *   particles <-- set of particles to update
+ *   n_sync    <-- number of particles changing rank
+ *   sync_ids  <-- ids of particles changing rank
  *----------------------------------------------------------------------------*/
 
 static void
 _lagr_halo_count(const cs_mesh_t               *mesh,
                  cs_lagr_halo_t                *lag_halo,
-                 const cs_lagr_particle_set_t  *particles)
+                 const cs_lagr_particle_set_t  *particles,
+                 cs_lnum_t                      n_sync,
+                 const cs_lnum_t                sync_ids[])
 {
   cs_lnum_t  i, ghost_id;
 
@@ -2512,19 +2771,21 @@ _lagr_halo_count(const cs_mesh_t               *mesh,
     lag_halo->recv_count[i] = 0;
   }
 
-  /* Loop on particles to count number of particles to send on each rank */
+  /* Loop on particles changing rank to count number of particles
+     to send on each rank */
 
-  for (i = 0; i < particles->n_particles; i++) {
+  for (cs_lnum_t j = 0; j < n_sync; j++) {
 
-    if (_get_tracking_info(particles, i)->state == CS_LAGR_PART_TO_SYNC_NEXT) {
+    i = sync_ids[j];
 
-      ghost_id =   cs_lagr_particles_get_lnum(particles, i, CS_LAGR_CELL_ID)
-                 - mesh->n_cells;
+    assert(   _get_tracking_info(particles, i)->state
+           == CS_LAGR_PART_TO_SYNC_NEXT);
 
-      assert(ghost_id >= 0);
-      lag_halo->send_count[lag_halo->rank[ghost_id]] += 1;
+    ghost_id =   cs_lagr_particles_get_lnum(particles, i, CS_LAGR_CELL_ID)
+               - mesh->n_cells;
 
-    }
+    assert(ghost_id >= 0);
+    lag_halo->send_count[lag_halo->rank[ghost_id]] += 1;
 
   } /* End of loop on particles */
 
@@ -2588,7 +2849,6 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
   cs_lagr_track_builder_t  *builder = _particle_track_builder;
   cs_lagr_halo_t  *lag_halo = builder->halo;
 
-  const cs_lagr_attribute_map_t *p_am = particles->p_am;
   const size_t extents = particles->p_am->extents;
 
   const cs_mesh_t  *mesh = cs_glob_mesh;
@@ -2600,7 +2860,11 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
 
   if (halo != NULL) {
 
-    _lagr_halo_count(mesh, lag_halo, particles);
+    _lagr_halo_count(mesh,
+                     lag_halo,
+                     particles,
+                     builder->merged.n_sync,
+                     builder->merged.sync_ids);
 
     for (i = 0; i < halo->n_c_domains; i++) {
       n_recv_particles += lag_halo->recv_count[i];
@@ -2754,9 +3018,8 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
 
       } /* End of periodicity treatment */
 
-      memcpy(lag_halo->send_buf + extents*shift,
-             particles->p_buffer + extents*i,
-             extents);
+      cs_lagr_particles_pack(particles, i, 1,
+                             lag_halo->send_buf + extents*shift);
 
       lag_halo->send_count[rank] += 1;
 
@@ -2773,11 +3036,8 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
 
     else if (cur_part_state < CS_LAGR_PART_OUT) {
 
-      if (particle_count < i) {
-        memcpy(particles->p_buffer + p_am->extents*particle_count,
-               particles->p_buffer + p_am->extents*i,
-               p_am->extents);
-      }
+      if (particle_count < i)
+        cs_lagr_particles_copy(particles, particle_count, i, 1);
 
       particle_count += 1;
       tot_weight += cur_part_stat_weight;
@@ -2967,7 +3227,7 @@ _finalize_displacement(cs_lagr_particle_set_t  *particles)
   for (cs_lnum_t i = 0; i < n_cells+1; i++)
     cell_idx[i] = 0;
 
-  /* Copy unordered particle data to buffer */
+  /* Count particles per cell */
 
   for (cs_lnum_t i = 0; i < n_particles; i++) {
 
@@ -2979,14 +3239,14 @@ _finalize_displacement(cs_lagr_particle_set_t  *particles)
     cs_lnum_t cell_id = cs_lagr_particles_get_lnum(particles, i,
                                                    CS_LAGR_CELL_ID);
 
-    memcpy(swap_buffer + p_am->extents*i,
-           particles->p_buffer + p_am->extents*i,
-           p_am->extents);
-
     cell_idx[cell_id+1] += 1;
 
   }
 
+  /* Copy unordered particle data to buffer */
+
+  cs_lagr_particles_pack(particles, 0, n_particles, swap_buffer);
+
   /* Convert count to index */
 
   for (cs_lnum_t i = 1; i < n_cells; i++)
@@ -3010,9 +3270,8 @@ _finalize_displacement(cs_lagr_particle_set_t  *particles)
 
     cell_idx[cell_id] += 1;
 
-    memcpy(particles->p_buffer + p_am->extents*particle_id,
-           swap_buffer + p_am->extents*i,
-           p_am->extents);
+    cs_lagr_particles_unpack(particles, particle_id, 1,
+                             swap_buffer + p_am->extents*i);
 
   }
 
@@ -3116,38 +3375,99 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[])
 
   _initialize_displacement(particles);
 
+  /* Interactions with boundaries may be deferred so that the local
+     propagation stage may be threaded, except with the clogging model,
+     for which deposition depends on the state of other particles */
+
+  cs_lagr_track_builder_t  *builder = _particle_track_builder;
+
+  const bool allow_defer = (lagr_model->clogging) ? false : true;
+  const int n_threads = (allow_defer) ? builder->n_lists : 1;
+
   /* Main loop on particles: global propagation */
 
   while (continue_displacement) {
 
+    const cs_lnum_t n_particles = particles->n_particles;
+
     /* Local propagation */
 
-    for (cs_lnum_t i = 0; i < particles->n_particles; i++) {
+#   pragma omp parallel if (n_threads > 1 && n_particles > CS_THR_MIN)
+    {
+#if defined(HAVE_OPENMP)
+      int t_id = omp_get_thread_num();
+#else
+      int t_id = 0;
+#endif
 
-      /* Local copies of the current and previous particles state vectors
-         to be used in case of the first pass of _local_propagation fails */
+      assert(t_id < builder->n_lists);
 
-      cs_lagr_tracking_state_t cur_part_state
-        = _get_tracking_info(particles, i)->state;
+      cs_lagr_track_list_t  *t_list = builder->lists + t_id;
 
-      if (cur_part_state == CS_LAGR_PART_TO_SYNC) {
+#     pragma omp for schedule(dynamic, CS_CL_SIZE)
+      for (cs_lnum_t i = 0; i < n_particles; i++) {
 
-        /* Main particle displacement stage */
+        cs_lagr_tracking_state_t cur_part_state
+          = _get_tracking_info(particles, i)->state;
 
-        cur_part_state = _local_propagation(particles,
-                                            events,
-                                            i,
-                                            displacement_step_id,
-                                            failsafe_mode,
-                                            b_face_zone_id,
-                                            visc_length,
-                                            u);
+        if (cur_part_state == CS_LAGR_PART_TO_SYNC) {
 
-        _tracking_info(particles, i)->state = cur_part_state;
+          int deferred_loop = -1;
 
-      }
+          /* Main particle displacement stage */
+
+          cur_part_state = _local_propagation(particles,
+                                              events,
+                                              i,
+                                              displacement_step_id,
+                                              failsafe_mode,
+                                              b_face_zone_id,
+                                              visc_length,
+                                              u,
+                                              (allow_defer) ?
+                                                &deferred_loop : NULL);
+
+          _tracking_info(particles, i)->state = cur_part_state;
+
+          if (deferred_loop > -1)
+            _track_list_add_deferred(t_list, i, deferred_loop);
+          else if (cur_part_state == CS_LAGR_PART_TO_SYNC_NEXT)
+            _track_list_add_sync(t_list, i);
+
+        }
+
+      } /* End of loop on particles */
+
+    }
+
+    /* Merge thread-local lists, then handle interrupted propagations
+       in particle id order */
+
+    _merge_track_lists(builder);
+
+    cs_lagr_track_list_t  *m_list = &(builder->merged);
+
+    for (cs_lnum_t j = 0; j < m_list->n_deferred; j++) {
+
+      cs_lnum_t i = m_list->deferred_ids[j];
+
+      cs_lagr_tracking_state_t cur_part_state
+        = _local_propagation(particles,
+                             events,
+                             i,
+                             m_list->deferred_loop[j],
+                             failsafe_mode,
+                             b_face_zone_id,
+                             visc_length,
+                             u,
+                             NULL);
+
+      _tracking_info(particles, i)->state = cur_part_state;
 
-    } /* End of loop on particles */
+      if (cur_part_state == CS_LAGR_PART_TO_SYNC_NEXT)
+        _track_list_add_sync(m_list, i);
+
+    }
 
     /* Update of the particle set structure. Delete exited particles,
        update for particles which change domain. */
@@ -3334,6 +3654,127 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[])
   cs_timer_stats_switch(t_top_id);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Migrate particles after a mesh redistribution.
+ *
+ * Each particle is sent to the rank now owning its cell, and its cell
+ * and rank ids are updated. Tracking structures, which depend on the
+ * mesh, are rebuilt at the next displacement.
+ *
+ * \param[in, out]  mt  pointer to mesh transfer structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_tracking_mesh_transfer(cs_mesh_transfer_t  *mt)
+{
+  _particle_track_builder = _destroy_track_builder(_particle_track_builder);
+
+  cs_lagr_particle_set_t *particles = cs_glob_lagr_particle_set;
+
+  if (particles == NULL)
+    return;
+
+  const cs_lagr_attribute_map_t  *p_am = particles->p_am;
+
+  const cs_lnum_t n_particles = particles->n_particles;
+
+  /* Destination rank and cell of each particle */
+
+  int *c_dest_rank = NULL;
+  cs_lnum_t *c_dest_id = NULL;
+
+  cs_mesh_transfer_cell_dest(mt, &c_dest_rank, &c_dest_id);
+
+  int *dest_rank;
+  cs_lnum_t *cell_id;
+  BFT_MALLOC(dest_rank, n_particles, int);
+  BFT_MALLOC(cell_id, n_particles, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_particles; i++) {
+    cs_lnum_t c_id = cs_lagr_particles_get_lnum(particles, i, CS_LAGR_CELL_ID);
+    dest_rank[i] = c_dest_rank[c_id];
+    cell_id[i] = c_dest_id[c_id];
+  }
+
+  BFT_FREE(c_dest_id);
+  BFT_FREE(c_dest_rank);
+
+  cs_lnum_t n_recv_particles = n_particles;
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    const size_t extents = p_am->extents;
+
+    unsigned char *send_buf;
+    BFT_MALLOC(send_buf, n_particles*extents, unsigned char);
+
+    cs_lagr_particles_pack(particles, 0, n_particles, send_buf);
+
+    cs_all_to_all_t *d = cs_all_to_all_create(n_particles,
+                                              0, /* flags */
+                                              NULL,
+                                              dest_rank,
+                                              cs_glob_mpi_comm);
+
+    cs_all_to_all_transfer_dest_rank(d, &dest_rank);
+
+    unsigned char *recv_buf = cs_all_to_all_copy_array(d,
+                                                       CS_CHAR,
+                                                       extents,
+                                                       false,
+                                                       send_buf,
+                                                       NULL);
+
+    cs_lnum_t *recv_cell_id = cs_all_to_all_copy_array(d,
+                                                       CS_LNUM_TYPE,
+                                                       1,
+                                                       false,
+                                                       cell_id,
+                                                       NULL);
+
+    n_recv_particles = cs_all_to_all_n_elts_dest(d);
+
+    cs_all_to_all_destroy(&d);
+
+    BFT_FREE(send_buf);
+    BFT_FREE(cell_id);
+    cell_id = recv_cell_id;
+
+    cs_lagr_particle_set_resize(n_recv_particles);
+
+    particles->n_particles = n_recv_particles;
+    cs_lagr_particles_unpack(particles, 0, n_recv_particles, recv_buf);
+
+    BFT_FREE(recv_buf);
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  BFT_FREE(dest_rank);
+
+  /* Update cell and rank ids */
+
+  const int rank_id = CS_MAX(cs_glob_rank_id, 0);
+
+  for (cs_lnum_t i = 0; i < n_recv_particles; i++) {
+    for (int time_id = 0; time_id < p_am->n_time_vals; time_id++) {
+      if (p_am->count[time_id][CS_LAGR_CELL_ID] > 0)
+        cs_lagr_particles_set_lnum_n(particles, i, time_id,
+                                     CS_LAGR_CELL_ID, cell_id[i]);
+      if (p_am->count[time_id][CS_LAGR_RANK_ID] > 0)
+        cs_lagr_particles_set_lnum_n(particles, i, time_id,
+                                     CS_LAGR_RANK_ID, rank_id);
+    }
+  }
+
+  BFT_FREE(cell_id);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Finalize Lagrangian module.
@@ -33,6 +33,8 @@
  *  Local headers
  *----------------------------------------------------------------------------*/
 
+#include "cs_mesh_transfer.h"
+
 #include "cs_lagr_particle.h"
 
 /*----------------------------------------------------------------------------*/
@@ -89,6 +91,21 @@ cs_lagr_tracking_initialize(void);
 void
 cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Migrate particles after a mesh redistribution.
+ *
+ * Each particle is sent to the rank now owning its cell, and its cell
+ * and rank ids are updated. Tracking structures, which depend on the
+ * mesh, are rebuilt at the next displacement.
+ *
+ * \param[in, out]  mt  pointer to mesh transfer structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_tracking_mesh_transfer(cs_mesh_transfer_t  *mt);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Finalize Lagrangian module.
@@ -143,7 +143,9 @@ _print_mesh_counts(const cs_mesh_t  *m,
  * \brief Build cells equivalence id array.
  *
  * Cells can only be merged when all cells they should be merged with
- * are also flagged for merging (isotropic merging).
+ * are also flagged for merging (isotropic merging), and are all local
+ * (cells built from a parent split across ranks or periodic boundaries
+ * are not merged).
  *
  * The caller is responsible for freeing the returned array.
  *
@@ -197,8 +199,6 @@ _cell_equiv(cs_mesh_t  *m,
                          c_r_level);
 
   /* Now determine cells built from the same parent */
-  /* TODO handle parallelism, with parent split across
-     multiple ranks */
 
   int reloop = 0;
 
@@ -211,6 +211,8 @@ _cell_equiv(cs_mesh_t  *m,
         continue;
       cs_lnum_t c_id0 = m->i_face_cells[f_id][0];
       cs_lnum_t c_id1 = m->i_face_cells[f_id][1];
+      if (c_id0 >= n_cells || c_id1 >= n_cells)
+        continue;
       if (   m->i_face_r_gen[f_id] == c_r_level[c_id0]
           && m->i_face_r_gen[f_id] == c_r_level[c_id1]) {
         cs_lnum_t min_equiv = CS_MIN(c_equiv[c_id0], c_equiv[c_id1]);
@@ -227,14 +229,40 @@ _cell_equiv(cs_mesh_t  *m,
 
   } while (reloop);
 
+  /* Cells whose parent is split across ranks or periodic boundaries
+     are not merged */
+
+  int *c_merge;
+  BFT_MALLOC(c_merge, n_cells, int);
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    c_merge[i] = cell_flag[i];
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    if (m->i_face_r_gen[f_id] < 1)
+      continue;
+    cs_lnum_t c_id0 = m->i_face_cells[f_id][0];
+    cs_lnum_t c_id1 = m->i_face_cells[f_id][1];
+    if (c_id0 < n_cells && c_id1 < n_cells)
+      continue;
+    if (   m->i_face_r_gen[f_id] == c_r_level[c_id0]
+        && m->i_face_r_gen[f_id] == c_r_level[c_id1]) {
+      if (c_id0 < n_cells)
+        c_merge[c_id0] = 0;
+      if (c_id1 < n_cells)
+        c_merge[c_id1] = 0;
+    }
+  }
+
   /* Now determine whether all subcells of a given parent are flagged
      for merging; otherwise do not merge */
 
   for (cs_lnum_t i = 0; i < n_cells; i++) {
     cs_lnum_t j = c_equiv[i];
-    if (cell_flag[i] == 0)
+    if (c_merge[i] == 0)
       c_r_level[j] = 0;
   }
+
+  BFT_FREE(c_merge);
   for (cs_lnum_t i = 0; i < n_cells; i++) {
     cs_lnum_t j = c_equiv[i];
     if (j != i) {
@@ -691,32 +719,26 @@ _build_merged_face(cs_lnum_t                    n_faces,
   return n_vertices;
 }
 
-/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
-
-/*============================================================================
- * Public function definitions
- *============================================================================*/
-
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Coarsen flagged mesh cells.
+/*----------------------------------------------------------------------------
+ * Coarsen flagged mesh cells.
  *
- * \param[in, out]  m           mesh
- * \param[in]       cell_flag   subdivision type for each cell
- *                              (0: none; 1: isotropic)
- */
-/*----------------------------------------------------------------------------*/
+ * parameters:
+ *   m         <-> mesh
+ *   cell_flag <-- coarsening type for each cell (0: none; 1: isotropic)
+ *   c_o2n_p   --> if non-NULL, old to new cell ids
+ *----------------------------------------------------------------------------*/
 
-void
-cs_mesh_coarsen_simple(cs_mesh_t  *m,
-                       const int   cell_flag[])
+static void
+_coarsen_simple(cs_mesh_t   *m,
+                const int    cell_flag[],
+                cs_lnum_t  **c_o2n_p)
 {
   /* Timers:
      0: total
   */
 
   cs_timer_counter_t  timers[1];
-  for (int i = 0; i < 2; i++)
+  for (int i = 0; i < 1; i++)
     CS_TIMER_COUNTER_INIT(timers[i]);
 
   /* Build ghosts in case they are not present */
@@ -731,6 +753,12 @@ cs_mesh_coarsen_simple(cs_mesh_t  *m,
     cs_mesh_update_auxiliary(cs_glob_mesh);
   }
 
+  /* Determine cells that should be merged (before freeing halos,
+     which are needed to compare levels with adjacent ghost cells) */
+
+  cs_lnum_t  *c_o2n = NULL;
+  cs_lnum_t  n_c_new = _cell_equiv(m, cell_flag, &c_o2n);
+
   /* Free data that will be rebuilt */
 
   cs_mesh_free_rebuildable(m, true);
@@ -754,14 +782,12 @@ cs_mesh_coarsen_simple(cs_mesh_t  *m,
 
   cs_timer_counter_add_diff(&(timers[0]), &t0, &t2);
 
-  /* Determine cells that should be merged */
-
-  cs_lnum_t  *c_o2n = NULL;
-  cs_lnum_t  n_c_new = _cell_equiv(m, cell_flag, &c_o2n);
-
   _merge_cells(m, n_c_new, c_o2n);
 
-  BFT_FREE(c_o2n);
+  if (c_o2n_p != NULL)
+    *c_o2n_p = c_o2n;
+  else
+    BFT_FREE(c_o2n);
 
   m->modified = CS_MAX(m->modified, 1);
 
@@ -803,6 +829,52 @@ cs_mesh_coarsen_simple(cs_mesh_t  *m,
   }
 }
 
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Coarsen flagged mesh cells.
+ *
+ * \param[in, out]  m           mesh
+ * \param[in]       cell_flag   subdivision type for each cell
+ *                              (0: none; 1: isotropic)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_coarsen_simple(cs_mesh_t  *m,
+                       const int   cell_flag[])
+{
+  _coarsen_simple(m, cell_flag, NULL);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Coarsen flagged mesh cells, returning the matching cell renumbering.
+ *
+ * Each old cell is mapped to the new cell containing it, so that the
+ * caller may transfer cell-based values to the coarsened mesh.
+ * The caller is responsible for freeing the returned array.
+ *
+ * \param[in, out]  m           mesh
+ * \param[in]       cell_flag   subdivision type for each cell
+ *                              (0: none; 1: isotropic)
+ * \param[out]      c_o2n       old to new cell ids (size: initial n_cells)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_coarsen_simple_map(cs_mesh_t   *m,
+                           const int    cell_flag[],
+                           cs_lnum_t  **c_o2n)
+{
+  _coarsen_simple(m, cell_flag, c_o2n);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Refine selected mesh cells.
@@ -64,6 +64,26 @@ void
 cs_mesh_coarsen_simple(cs_mesh_t  *m,
                        const int   cell_flag[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Coarsen flagged mesh cells, returning the matching cell renumbering.
+ *
+ * Each old cell is mapped to the new cell containing it, so that the
+ * caller may transfer cell-based values to the coarsened mesh.
+ * The caller is responsible for freeing the returned array.
+ *
+ * \param[in, out]  m           mesh
+ * \param[in]       cell_flag   subdivision type for each cell
+ *                              (0: none; 1: isotropic)
+ * \param[out]      c_o2n       old to new cell ids (size: initial n_cells)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_coarsen_simple_map(cs_mesh_t   *m,
+                           const int    cell_flag[],
+                           cs_lnum_t  **c_o2n);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Coarsen selected mesh cells.
@@ -1248,21 +1248,32 @@ _sync_edges_flag(const cs_mesh_t        *m,
     }
   }
 
+  /* Vertices are not necessarily ordered by global number
+     (such as when the mesh has been renumbered) */
+
+  cs_lnum_t *order = NULL;
+  if (cs_glob_n_ranks > 1)
+    order = cs_order_gnum_s(NULL, g_e_vtx, 2, n_edges);
+
   fvm_io_num_t *edge_io_num
-    = fvm_io_num_create_from_adj_s(NULL, g_e_vtx, n_edges, 2);
+    = fvm_io_num_create_from_adj_s(order, g_e_vtx, n_edges, 2);
 
   BFT_FREE(g_e_vtx);
 
   if (cs_glob_n_ranks > 1 || g_edges_num != NULL) {
     n_g_edges = fvm_io_num_get_global_count(edge_io_num);
     const cs_gnum_t *_g_num =  fvm_io_num_get_global_num(edge_io_num);
-    for (cs_lnum_t i = 0; i < n_edges; i++)
-      g_edges_num[i] = _g_num[i];
+    for (cs_lnum_t i = 0; i < n_edges; i++) {
+      cs_lnum_t e_id = (order != NULL) ? order[i] : i;
+      g_edges_num[e_id] = _g_num[i];
+    }
     /* Rebuild as shared to free a bit of memory */
     edge_io_num = fvm_io_num_destroy(edge_io_num);
     edge_io_num = fvm_io_num_create_shared(g_edges_num, n_g_edges, n_edges);
   }
 
+  BFT_FREE(order);
+
   cs_interface_set_t *e_if
     = cs_interface_set_create(n_edges,
                               NULL,
@@ -1948,6 +1959,84 @@ _build_cell_vertices(cs_mesh_t                    *m,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build global numbers for sub-entities of given elements.
+ *
+ * Sub-entities of a same element have contiguous global numbers.
+ * Elements need not be ordered by global number (as is the case once
+ * the mesh has been renumbered).
+ *
+ * \param[in]   n_elts     number of parent elements
+ * \param[in]   n_g_elts   global number of parent elements
+ * \param[in]   g_elt_num  global number of each element
+ * \param[in]   elt_idx    for each element, start index of sub-entities
+ * \param[out]  sub_g_num  global number of each sub-entity, based
+ *                         on elt_idx (shifted by elt_idx[0])
+ *
+ * \return  global number of sub-entities
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_sub_global_num(cs_lnum_t         n_elts,
+                cs_gnum_t         n_g_elts,
+                const cs_gnum_t   g_elt_num[],
+                const cs_lnum_t   elt_idx[],
+                cs_gnum_t         sub_g_num[])
+{
+  /* Sub-entity numbering requires elements ordered by global number */
+
+  cs_lnum_t *order = NULL;
+  cs_gnum_t *g_elt_num_o = NULL;
+  const cs_gnum_t *_g_elt_num = g_elt_num;
+
+  if (!cs_order_gnum_test(NULL, g_elt_num, n_elts)) {
+    order = cs_order_gnum(NULL, g_elt_num, n_elts);
+    BFT_MALLOC(g_elt_num_o, n_elts, cs_gnum_t);
+    for (cs_lnum_t i = 0; i < n_elts; i++)
+      g_elt_num_o[i] = g_elt_num[order[i]];
+    _g_elt_num = g_elt_num_o;
+  }
+
+  fvm_io_num_t *elt_io_num
+    = fvm_io_num_create_shared(_g_elt_num, n_g_elts, n_elts);
+
+  cs_lnum_t *n_sub;
+  BFT_MALLOC(n_sub, n_elts, cs_lnum_t);
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    cs_lnum_t e_id = (order != NULL) ? order[i] : i;
+    n_sub[i] = elt_idx[e_id+1] - elt_idx[e_id];
+  }
+
+  fvm_io_num_t *sub_io_num
+    = fvm_io_num_create_from_sub(elt_io_num, n_sub);
+
+  elt_io_num = fvm_io_num_destroy(elt_io_num);
+
+  BFT_FREE(n_sub);
+  BFT_FREE(g_elt_num_o);
+
+  assert(   elt_idx[n_elts] - elt_idx[0]
+         == fvm_io_num_get_local_count(sub_io_num));
+
+  const cs_gnum_t *_sub_g_num = fvm_io_num_get_global_num(sub_io_num);
+  cs_gnum_t n_g_sub = fvm_io_num_get_global_count(sub_io_num);
+
+  cs_lnum_t k = 0;
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    cs_lnum_t e_id = (order != NULL) ? order[i] : i;
+    for (cs_lnum_t j = elt_idx[e_id]; j < elt_idx[e_id+1]; j++, k++)
+      sub_g_num[j - elt_idx[0]] = _sub_g_num[k];
+  }
+
+  sub_io_num = fvm_io_num_destroy(sub_io_num);
+
+  BFT_FREE(order);
+
+  return n_g_sub;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Build global numbers for new vertices on edges, faces, or cells.
@@ -1995,38 +2084,21 @@ _build_vertices_gnum(cs_mesh_t       *m,
 
     /* Build associated global numbering */
 
-    fvm_io_num_t *elt_io_num
-      = fvm_io_num_create_shared(g_elt_num, n_g_elts, n_elts);
-
-    cs_lnum_t *n_sub;
-    BFT_MALLOC(n_sub, n_elts, cs_lnum_t);
-    cs_lnum_t *restrict _n_sub = n_sub;
-    for (cs_lnum_t i = 0; i < n_elts; i++)
-      _n_sub[i] = elt_v_idx[i+1] - elt_v_idx[i];
-    _n_sub = NULL;
-
-    fvm_io_num_t *vtx_io_num
-      = fvm_io_num_create_from_sub(elt_io_num, n_sub);
+    cs_lnum_t n_add_vtx = elt_v_idx[n_elts] - elt_v_idx[0];
 
-    elt_io_num = fvm_io_num_destroy(elt_io_num);
+    cs_gnum_t *add_vtx_gnum;
+    BFT_MALLOC(add_vtx_gnum, n_add_vtx, cs_gnum_t);
 
-    BFT_FREE(n_sub);
-
-    const cs_gnum_t *add_vtx_gnum = fvm_io_num_get_global_num(vtx_io_num);
-    n_g_add_vtx = fvm_io_num_get_global_count(vtx_io_num);
-
-    assert(   elt_v_idx[n_elts] - elt_v_idx[0]
-           == fvm_io_num_get_local_count(vtx_io_num));
+    n_g_add_vtx = _sub_global_num(n_elts, n_g_elts, g_elt_num,
+                                  elt_v_idx, add_vtx_gnum);
 
     if (m->global_vtx_num != NULL) {
-      cs_lnum_t k = 0;
-      for (cs_lnum_t i = 0; i < n_elts; i++) {
-        for (cs_lnum_t j = elt_v_idx[i]; j < elt_v_idx[i+1]; j++, k++)
-          m->global_vtx_num[j] = add_vtx_gnum[k] + m->n_g_vertices;
-      }
+      cs_gnum_t *g_vtx_num = m->global_vtx_num + elt_v_idx[0];
+      for (cs_lnum_t i = 0; i < n_add_vtx; i++)
+        g_vtx_num[i] = add_vtx_gnum[i] + m->n_g_vertices;
     }
 
-    vtx_io_num = fvm_io_num_destroy(vtx_io_num);
+    BFT_FREE(add_vtx_gnum);
 
   }
 
@@ -3886,29 +3958,14 @@ _o2n_idx_update_global_num(cs_lnum_t          n_old,
   if (cs_glob_n_ranks == 1 && *global_num == NULL)
     return n_g_new;
 
-  fvm_io_num_t *o_io_num
-    = fvm_io_num_create_shared(*global_num, n_g_old, n_old);
-
-  cs_lnum_t *n_sub;
-  BFT_MALLOC(n_sub, n_old, cs_lnum_t);
-  cs_lnum_t *restrict _n_sub = n_sub;
-  for (cs_lnum_t i = 0; i < n_old; i++)
-    _n_sub[i] = o2n_idx[i+1] - o2n_idx[i];
-  _n_sub = NULL;
-
-  fvm_io_num_t *n_io_num
-    = fvm_io_num_create_from_sub(o_io_num, n_sub);
+  cs_gnum_t *_global_num;
+  BFT_MALLOC(_global_num, o2n_idx[n_old], cs_gnum_t);
 
-  o_io_num = fvm_io_num_destroy(o_io_num);
+  n_g_new = _sub_global_num(n_old, n_g_old, *global_num,
+                            o2n_idx, _global_num);
 
-  BFT_FREE(n_sub);
   BFT_FREE(*global_num);
-
-  *global_num = fvm_io_num_transfer_global_num(n_io_num);
-
-  n_g_new = fvm_io_num_get_global_count(n_io_num);
-
-  n_io_num = fvm_io_num_destroy(n_io_num);
+  *global_num = _global_num;
 
   return n_g_new;
 }
@@ -3938,7 +3995,6 @@ _o2n_idx_complete_global_num(cs_lnum_t          n_old,
 {
   cs_gnum_t n_g_new = global_num_shift;
   cs_gnum_t *_old_global_num = NULL;
-  const cs_gnum_t *_new_global_num = NULL;
 
   const cs_lnum_t n_new = o2n_idx[n_old] - o2n_idx[0];
 
@@ -3949,31 +4005,13 @@ _o2n_idx_complete_global_num(cs_lnum_t          n_old,
     old_global_num = _old_global_num;
   }
 
-  fvm_io_num_t *o_io_num
-    = fvm_io_num_create_shared(old_global_num, n_g_old, n_old);
+  n_g_new += _sub_global_num(n_old, n_g_old, old_global_num,
+                             o2n_idx, new_global_num);
 
-  cs_lnum_t *n_sub;
-  BFT_MALLOC(n_sub, n_old, cs_lnum_t);
-  cs_lnum_t *restrict _n_sub = n_sub;
-  for (cs_lnum_t i = 0; i < n_old; i++)
-    _n_sub[i] = o2n_idx[i+1] - o2n_idx[i];
-  _n_sub = NULL;
-
-  fvm_io_num_t *n_io_num
-    = fvm_io_num_create_from_sub(o_io_num, n_sub);
-
-  o_io_num = fvm_io_num_destroy(o_io_num);
-
-  BFT_FREE(n_sub);
   BFT_FREE(_old_global_num);
 
-  n_g_new += fvm_io_num_get_global_count(n_io_num);
-
-  _new_global_num = fvm_io_num_get_global_num(n_io_num);
   for (cs_lnum_t i = 0; i < n_new; i++)
-    new_global_num[i] = _new_global_num[i] + global_num_shift;
-
-  n_io_num = fvm_io_num_destroy(n_io_num);
+    new_global_num[i] += global_num_shift;
 
   return n_g_new;
 }
@@ -4183,20 +4221,32 @@ _o2n_idx_update_b_face_arrays(cs_mesh_t        *m,
 
 /*----------------------------------------------------------------------------*/
 /*!
- * \brief Refine flagged mesh cells.
+ * \brief Refine flagged mesh cells, returning the matching cell and
+ *        boundary face indexes.
  *
- * \param[in, out]  m           mesh
- * \param[in]       conforming  if true, propagate refinement to ensure
- *                              subdivision is conforming
- * \param[in]       cell_flag   subdivision type for each cell
- *                              (0: none; 1: isotropic)
+ * The cells (resp. boundary faces) obtained from a given initial element
+ * of id i have ids o2n_idx[i] to o2n_idx[i+1] - 1, so that the caller may
+ * transfer values to the refined mesh. The caller is responsible for
+ * freeing the returned arrays.
+ *
+ * \param[in, out]  m               mesh
+ * \param[in]       conforming      if true, propagate refinement to ensure
+ *                                  subdivision is conforming
+ * \param[in]       cell_flag       subdivision type for each cell
+ *                                  (0: none; 1: isotropic)
+ * \param[out]      c_o2n_idx       old to new cells index
+ *                                  (size: initial n_cells + 1), or NULL
+ * \param[out]      b_face_o2n_idx  old to new boundary faces index
+ *                                  (size: initial n_b_faces + 1), or NULL
  */
 /*----------------------------------------------------------------------------*/
 
 void
-cs_mesh_refine_simple(cs_mesh_t  *m,
-                      bool        conforming,
-                      const int   cell_flag[])
+cs_mesh_refine_simple_map(cs_mesh_t   *m,
+                          bool         conforming,
+                          const int    cell_flag[],
+                          cs_lnum_t  **c_o2n_idx,
+                          cs_lnum_t  **b_face_o2n_idx)
 {
   /* Timers:
      0: total
@@ -4464,9 +4514,9 @@ cs_mesh_refine_simple(cs_mesh_t  *m,
      will be transformed to index later so named as index,
      and values for f_id placed in position f_id+1 */
 
-  cs_lnum_t *b_face_o2n_idx, *b_face_o2n_connect_idx;
+  cs_lnum_t *_b_face_o2n_idx, *b_face_o2n_connect_idx;
 
-  BFT_MALLOC(b_face_o2n_idx, m->n_b_faces + 1, cs_lnum_t);
+  BFT_MALLOC(_b_face_o2n_idx, m->n_b_faces + 1, cs_lnum_t);
   BFT_MALLOC(b_face_o2n_connect_idx, m->n_b_faces + 1, cs_lnum_t);
 
   _subdivided_faces_sizes(v2v,
@@ -4475,7 +4525,7 @@ cs_mesh_refine_simple(cs_mesh_t  *m,
                           f_r_flag,
                           m->b_face_vtx_idx,
                           m->b_face_vtx_lst,
-                          b_face_o2n_idx,
+                          _b_face_o2n_idx,
                           b_face_o2n_connect_idx);
 
   cs_lnum_t *i_face_o2n_idx, *i_face_o2n_connect_idx;
@@ -4497,24 +4547,24 @@ cs_mesh_refine_simple(cs_mesh_t  *m,
      because they were built to be transformed as indexes, with
      initial values shifted by 1). */
 
-  cs_lnum_t *c_o2n_idx, *c_i_face_idx, *c_i_face_connect_idx;
+  cs_lnum_t *_c_o2n_idx, *c_i_face_idx, *c_i_face_connect_idx;
 
-  BFT_MALLOC(c_o2n_idx, n_c_ini + 1, cs_lnum_t);
+  BFT_MALLOC(_c_o2n_idx, n_c_ini + 1, cs_lnum_t);
   BFT_MALLOC(c_i_face_idx, n_c_ini + 1, cs_lnum_t);
   BFT_MALLOC(c_i_face_connect_idx, n_c_ini + 1, cs_lnum_t);
 
   _new_cells_i_faces_count(m,
                            c2f,
                            c_r_flag,
-                           b_face_o2n_idx + 1,
+                           _b_face_o2n_idx + 1,
                            b_face_o2n_connect_idx + 1,
                            i_face_o2n_idx + 1,
                            i_face_o2n_connect_idx + 1,
-                           c_o2n_idx + 1,
+                           _c_o2n_idx + 1,
                            c_i_face_idx + 1,
                            c_i_face_connect_idx + 1);
 
-  _counts_to_index(n_c_ini, c_o2n_idx);
+  _counts_to_index(n_c_ini, _c_o2n_idx);
 
   t2 = cs_timer_time();
   cs_timer_counter_add_diff(&(timers[5]), &t1, &t2);
@@ -4530,7 +4580,7 @@ cs_mesh_refine_simple(cs_mesh_t  *m,
                                                          m->n_b_faces,
                                                          m->n_cells,
                                                          f_r_flag,
-                                                         b_face_o2n_idx,
+                                                         _b_face_o2n_idx,
                                                          b_face_o2n_connect_idx,
                                                          NULL,
                                                          NULL,
@@ -4557,7 +4607,7 @@ cs_mesh_refine_simple(cs_mesh_t  *m,
 
   /* Update arrays and counts based on faces (families) and number of faces */
 
-  _o2n_idx_update_b_face_arrays(m, b_face_o2n_idx);
+  _o2n_idx_update_b_face_arrays(m, _b_face_o2n_idx);
   _o2n_idx_update_i_face_arrays(m, i_face_o2n_idx, c_i_face_idx);
 
   t2 = cs_timer_time();
@@ -4566,14 +4616,14 @@ cs_mesh_refine_simple(cs_mesh_t  *m,
 
   /* Now subdivide cells */
 
-  _o2n_idx_update_cell_arrays(m, c_o2n_idx);
+  _o2n_idx_update_cell_arrays(m, _c_o2n_idx);
 
   _subdivide_cells(m,
                    n_c_ini,
                    n_b_f_ini,
-                   c_o2n_idx,
+                   _c_o2n_idx,
                    i_face_o2n_idx,
-                   b_face_o2n_idx,
+                   _b_face_o2n_idx,
                    c2f,
                    c2f2v_start,
                    c_v_idx,
@@ -4589,7 +4639,10 @@ cs_mesh_refine_simple(cs_mesh_t  *m,
 
   BFT_FREE(c2f2v_start);
 
-  BFT_FREE(c_o2n_idx);
+  if (c_o2n_idx != NULL)
+    *c_o2n_idx = _c_o2n_idx;
+  else
+    BFT_FREE(_c_o2n_idx);
   BFT_FREE(c_i_face_idx);
   BFT_FREE(c_i_face_connect_idx);
 
@@ -4602,7 +4655,10 @@ cs_mesh_refine_simple(cs_mesh_t  *m,
   cs_adjacency_destroy(&v2v);
 
   BFT_FREE(i_face_o2n_idx);
-  BFT_FREE(b_face_o2n_idx);
+  if (b_face_o2n_idx != NULL)
+    *b_face_o2n_idx = _b_face_o2n_idx;
+  else
+    BFT_FREE(_b_face_o2n_idx);
 
   BFT_FREE(c_r_level);
   BFT_FREE(c_r_flag);
@@ -4663,6 +4719,26 @@ cs_mesh_refine_simple(cs_mesh_t  *m,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Refine flagged mesh cells.
+ *
+ * \param[in, out]  m           mesh
+ * \param[in]       conforming  if true, propagate refinement to ensure
+ *                              subdivision is conforming
+ * \param[in]       cell_flag   subdivision type for each cell
+ *                              (0: none; 1: isotropic)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_refine_simple(cs_mesh_t  *m,
+                      bool        conforming,
+                      const int   cell_flag[])
+{
+  cs_mesh_refine_simple_map(m, conforming, cell_flag, NULL, NULL);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Refine selected mesh cells.
@@ -67,6 +67,35 @@ cs_mesh_refine_simple(cs_mesh_t  *m,
                       bool        conforming,
                       const int   cell_flag[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Refine flagged mesh cells, returning the matching cell and
+ *        boundary face indexes.
+ *
+ * The cells (resp. boundary faces) obtained from a given initial element
+ * of id i have ids o2n_idx[i] to o2n_idx[i+1] - 1, so that the caller may
+ * transfer values to the refined mesh. The caller is responsible for
+ * freeing the returned arrays.
+ *
+ * \param[in, out]  m               mesh
+ * \param[in]       conforming      if true, propagate refinement to ensure
+ *                                  subdivision is conforming
+ * \param[in]       cell_flag       subdivision type for each cell
+ *                                  (0: none; 1: isotropic)
+ * \param[out]      c_o2n_idx       old to new cells index
+ *                                  (size: initial n_cells + 1), or NULL
+ * \param[out]      b_face_o2n_idx  old to new boundary faces index
+ *                                  (size: initial n_b_faces + 1), or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_refine_simple_map(cs_mesh_t   *m,
+                          bool         conforming,
+                          const int    cell_flag[],
+                          cs_lnum_t  **c_o2n_idx,
+                          cs_lnum_t  **b_face_o2n_idx);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Refine selected mesh cells.
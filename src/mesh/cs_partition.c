@@ -32,6 +32,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <limits.h>
 #include <locale.h>
 #include <math.h>
 #include <stdio.h>
@@ -210,6 +211,11 @@ static int                       *_part_extra_partitions_list = NULL;
 
 static bool                       _part_uniform_sfc_block_size = false;
 
+static cs_lnum_t                  _part_n_weighted_cells = 0;
+static cs_gnum_t                 *_part_cell_gnum = NULL;
+static float                     *_part_cell_weight = NULL;
+static float                      _part_cell_weight_max = 0;
+
 #if defined(WIN32) || defined(_WIN32)
 static const char _dir_separator = '\\';
 #else
@@ -936,6 +942,219 @@ _precompute_cell_center_l(const cs_mesh_builder_t  *mb,
   BFT_FREE(weight);
 }
 
+/*----------------------------------------------------------------------------
+ * Distribute cell weights to a given block distribution.
+ *
+ * parameters:
+ *   bi <-- destination block distribution info
+ *
+ * returns:
+ *   cell weights in block distribution, or NULL if no weights are defined
+ *----------------------------------------------------------------------------*/
+
+static float *
+_block_cell_weights(cs_block_dist_info_t  bi)
+{
+  if (_part_cell_weight == NULL)
+    return NULL;
+
+  cs_lnum_t n_b_cells = 0;
+  if (bi.gnum_range[1] > bi.gnum_range[0])
+    n_b_cells = bi.gnum_range[1] - bi.gnum_range[0];
+
+  float *b_weight;
+  BFT_MALLOC(b_weight, n_b_cells, float);
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    cs_part_to_block_t *d
+      = cs_part_to_block_create_by_gnum(cs_glob_mpi_comm,
+                                        bi,
+                                        _part_n_weighted_cells,
+                                        _part_cell_gnum);
+
+    cs_part_to_block_copy_array(d,
+                                CS_FLOAT,
+                                1,
+                                _part_cell_weight,
+                                b_weight);
+
+    cs_part_to_block_destroy(&d);
+
+    return b_weight;
+  }
+
+#endif
+
+  for (cs_lnum_t i = 0; i < _part_n_weighted_cells; i++)
+    b_weight[_part_cell_gnum[i] - bi.gnum_range[0]] = _part_cell_weight[i];
+
+  return b_weight;
+}
+
+/*----------------------------------------------------------------------------
+ * Convert cell weights to integer weights for graph partitioners.
+ *
+ * Weights are scaled so that the maximum weight maps to 100, or less if
+ * needed to avoid overflow of the global weight sum.
+ *
+ * parameters:
+ *   n_cells   <-- number of local cells
+ *   n_g_cells <-- global number of cells
+ *   weight    <-- cell weights, or NULL
+ *
+ * returns:
+ *   integer cell weights, or NULL if no weights are given
+ *----------------------------------------------------------------------------*/
+
+static int *
+_integer_cell_weights(cs_lnum_t         n_cells,
+                      cs_gnum_t         n_g_cells,
+                      const float       weight[])
+{
+  if (weight == NULL)
+    return NULL;
+
+  double w_int_max = 100;
+  if (n_g_cells > 0) {
+    double w_lim = (double)(INT_MAX/2) / (double)n_g_cells;
+    if (w_int_max > w_lim)
+      w_int_max = w_lim;
+  }
+  if (w_int_max < 1)
+    w_int_max = 1;
+
+  double scale = (_part_cell_weight_max > 0) ?
+    w_int_max / _part_cell_weight_max : 1.;
+
+  int *i_weight;
+  BFT_MALLOC(i_weight, n_cells, int);
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    int w = weight[i]*scale + 0.5;
+    i_weight[i] = (w > 1) ? w : 1;
+  }
+
+  return i_weight;
+}
+
+/*----------------------------------------------------------------------------
+ * Define cell ranks based on cumulative weights along a space-filling curve.
+ *
+ * parameters:
+ *   n_cells     <-- number of local cells
+ *   n_g_cells   <-- global number of cells
+ *   n_ranks     <-- number of ranks in partition
+ *   cell_num    <-- global cell number along the curve (1 to n)
+ *   cell_weight <-- cell weights
+ *   cell_rank   --> cell rank
+ *----------------------------------------------------------------------------*/
+
+static void
+_cell_rank_by_sfc_weight(cs_lnum_t        n_cells,
+                         cs_gnum_t        n_g_cells,
+                         int              n_ranks,
+                         const cs_gnum_t  cell_num[],
+                         const float      cell_weight[],
+                         int              cell_rank[])
+{
+  cs_lnum_t n_sfc_cells = n_cells;
+  float *sfc_weight = NULL;
+  int *sfc_rank = NULL;
+
+  /* Order weights along curve */
+
+#if defined(HAVE_MPI)
+
+  cs_all_to_all_t *d = NULL;
+
+  if (cs_glob_n_ranks > 1) {
+
+    cs_block_dist_info_t bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                                          cs_glob_n_ranks,
+                                                          1,
+                                                          0,
+                                                          n_g_cells);
+
+    d = cs_all_to_all_create_from_block(n_cells,
+                                        CS_ALL_TO_ALL_USE_DEST_ID,
+                                        cell_num,
+                                        bi,
+                                        cs_glob_mpi_comm);
+
+    n_sfc_cells = cs_all_to_all_n_elts_dest(d);
+
+    sfc_weight = cs_all_to_all_copy_array(d,
+                                          CS_FLOAT,
+                                          1,
+                                          false, /* reverse */
+                                          cell_weight,
+                                          NULL);
+  }
+
+#endif
+
+  if (sfc_weight == NULL) {
+    BFT_MALLOC(sfc_weight, n_cells, float);
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      sfc_weight[cell_num[i] - 1] = cell_weight[i];
+  }
+
+  /* Cumulative weights */
+
+  double w_sum = 0;
+  for (cs_lnum_t i = 0; i < n_sfc_cells; i++)
+    w_sum += sfc_weight[i];
+
+  double w_start = 0, w_tot = w_sum;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    MPI_Exscan(&w_sum, &w_start, 1, MPI_DOUBLE, MPI_SUM, cs_glob_mpi_comm);
+    if (cs_glob_rank_id == 0)
+      w_start = 0;
+    MPI_Allreduce(&w_sum, &w_tot, 1, MPI_DOUBLE, MPI_SUM, cs_glob_mpi_comm);
+  }
+#endif
+
+  BFT_MALLOC(sfc_rank, n_sfc_cells, int);
+
+  double w_c = w_start;
+  for (cs_lnum_t i = 0; i < n_sfc_cells; i++) {
+    double w_mid = w_c + 0.5*sfc_weight[i];
+    w_c += sfc_weight[i];
+    int r = (w_tot > 0) ? w_mid / w_tot * n_ranks : 0;
+    sfc_rank[i] = CS_MIN(CS_MAX(r, 0), n_ranks - 1);
+  }
+
+  BFT_FREE(sfc_weight);
+
+  /* Return ranks to initial distribution */
+
+#if defined(HAVE_MPI)
+
+  if (d != NULL) {
+    cs_all_to_all_copy_array(d,
+                             (sizeof(int) == 8) ? CS_INT64 : CS_INT32,
+                             1,
+                             true, /* reverse */
+                             sfc_rank,
+                             cell_rank);
+    cs_all_to_all_destroy(&d);
+    BFT_FREE(sfc_rank);
+    return;
+  }
+
+#endif
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    cell_rank[i] = sfc_rank[cell_num[i] - 1];
+
+  BFT_FREE(sfc_rank);
+}
+
 /*----------------------------------------------------------------------------
  * Define cell ranks using a space-filling curve.
  *
@@ -1019,7 +1238,22 @@ _cell_rank_by_sfc(cs_gnum_t                 n_g_cells,
 
   /* Determine rank based on global numbering with SFC ordering; */
 
-  if (_part_uniform_sfc_block_size == false) {
+  float *cell_weight = _block_cell_weights(mb->cell_bi);
+
+  if (cell_weight != NULL) {
+
+    _cell_rank_by_sfc_weight(n_cells,
+                             n_g_cells,
+                             n_ranks,
+                             cell_num,
+                             cell_weight,
+                             cell_rank);
+
+    BFT_FREE(cell_weight);
+
+  }
+
+  else if (_part_uniform_sfc_block_size == false) {
 
     cs_gnum_t cells_per_rank = n_g_cells / n_ranks;
     cs_lnum_t rmdr = n_g_cells - cells_per_rank * (cs_gnum_t)n_ranks;
@@ -1354,15 +1588,17 @@ _metis_cell_cells(size_t       n_cells,
  *   n_parts       <-- number of partitions
  *   cell_cell_idx <-- cell->cells index
  *   cell_cell     <-- cell->cells connectivity
+ *   cell_weight   <-- cell weights, or NULL
  *   cell_part     --> cell partition
  *----------------------------------------------------------------------------*/
 
 static void
-_part_metis(size_t   n_cells,
-            int      n_parts,
-            idx_t   *cell_idx,
-            idx_t   *cell_neighbors,
-            int     *cell_part)
+_part_metis(size_t      n_cells,
+            int         n_parts,
+            idx_t      *cell_idx,
+            idx_t      *cell_neighbors,
+            const int  *cell_weight,
+            int        *cell_part)
 {
   size_t i;
   double  start_time, end_time;
@@ -1374,9 +1610,16 @@ _part_metis(size_t   n_cells,
   idx_t   _n_cells = n_cells;
   idx_t   _n_parts = n_parts;
   idx_t  *_cell_part = NULL;
+  idx_t  *_cell_weight = NULL;
 
   start_time = cs_timer_wtime();
 
+  if (cell_weight != NULL) {
+    BFT_MALLOC(_cell_weight, n_cells, idx_t);
+    for (i = 0; i < n_cells; i++)
+      _cell_weight[i] = cell_weight[i];
+  }
+
   if (sizeof(idx_t) == sizeof(int))
     _cell_part = (idx_t *)cell_part;
 
@@ -1394,7 +1637,7 @@ _part_metis(size_t   n_cells,
                              &_n_constraints,
                              cell_idx,
                              cell_neighbors,
-                             NULL,       /* vwgt:   cell weights */
+                             _cell_weight, /* vwgt: cell weights */
                              NULL,       /* vsize:  size of the vertices */
                              NULL,       /* adjwgt: face weights */
                              &_n_parts,
@@ -1417,7 +1660,7 @@ _part_metis(size_t   n_cells,
                         &_n_constraints,
                         cell_idx,
                         cell_neighbors,
-                        NULL,       /* vwgt:   cell weights */
+                        _cell_weight, /* vwgt: cell weights */
                         NULL,       /* vsize:  size of the vertices */
                         NULL,       /* adjwgt: face weights */
                         &_n_parts,
@@ -1429,6 +1672,8 @@ _part_metis(size_t   n_cells,
 
   }
 
+  BFT_FREE(_cell_weight);
+
   end_time = cs_timer_wtime();
 
   bft_printf(_("\n"
@@ -1461,6 +1706,7 @@ _part_metis(size_t   n_cells,
  *   n_parts       <-- number of partitions
  *   cell_cell_idx <-- cell->cells index
  *   cell_cell     <-- cell->cells connectivity
+ *   cell_weight   <-- cell weights, or NULL
  *   cell_part     --> cell partition
  *   comm          <-- associated MPI communicator
  *----------------------------------------------------------------------------*/
@@ -1471,6 +1717,7 @@ _part_parmetis(cs_gnum_t   n_g_cells,
                int         n_parts,
                idx_t      *cell_idx,
                idx_t      *cell_neighbors,
+               const int  *cell_weight,
                int        *cell_part,
                MPI_Comm    comm)
 {
@@ -1532,6 +1779,14 @@ _part_parmetis(cs_gnum_t   n_g_cells,
     idx_t  options[3] = {0, 1, 15}; /* By default if options[0] = 0 */
     idx_t  numflag  = 0; /* 0 to n-1 numbering (C type) */
     idx_t  wgtflag  = 0; /* No weighting for faces or cells */
+    idx_t  *_cell_weight = NULL;
+
+    if (cell_weight != NULL) {
+      wgtflag = 2;       /* Weights on cells only */
+      BFT_MALLOC(_cell_weight, n_cells, idx_t);
+      for (i = 0; i < n_cells; i++)
+        _cell_weight[i] = cell_weight[i];
+    }
 
     real_t wgt = 1.0/n_parts;
     real_t ubvec[]  = {1.5};
@@ -1546,7 +1801,7 @@ _part_parmetis(cs_gnum_t   n_g_cells,
                    (vtxdist,
                     cell_idx,
                     cell_neighbors,
-                    NULL,       /* vwgt:   cell weights */
+                    _cell_weight, /* vwgt: cell weights */
                     NULL,       /* adjwgt: face weights */
                     &wgtflag,
                     &numflag,
@@ -1560,6 +1815,7 @@ _part_parmetis(cs_gnum_t   n_g_cells,
                     &comm);
 
     BFT_FREE(tpwgts);
+    BFT_FREE(_cell_weight);
 
     edgecut = _edgecut;
 
@@ -1851,6 +2107,7 @@ _scotch_cell_cells(size_t        n_cells,
  *   n_parts       <-- number of partitions
  *   cell_cell_idx <-- cell->cells index
  *   cell_cell     <-- cell->cells connectivity
+ *   cell_weight   <-- cell weights, or NULL
  *   cell_part     --> cell partition
  *----------------------------------------------------------------------------*/
 
@@ -1859,6 +2116,7 @@ _part_scotch(SCOTCH_Num   n_cells,
              int          n_parts,
              SCOTCH_Num  *cell_idx,
              SCOTCH_Num  *cell_neighbors,
+             const int   *cell_weight,
              int         *cell_part)
 {
   SCOTCH_Num  i;
@@ -1871,11 +2129,18 @@ _part_scotch(SCOTCH_Num   n_cells,
 
   SCOTCH_Num    edgecut = 0; /* <-- Number of faces on partition */
   SCOTCH_Num  *_cell_part = NULL;
+  SCOTCH_Num  *_cell_weight = NULL;
 
   /* Initialization */
 
   start_time = cs_timer_wtime();
 
+  if (cell_weight != NULL) {
+    BFT_MALLOC(_cell_weight, n_cells, SCOTCH_Num);
+    for (i = 0; i < n_cells; i++)
+      _cell_weight[i] = cell_weight[i];
+  }
+
   if (sizeof(SCOTCH_Num) == sizeof(int))
     _cell_part = (SCOTCH_Num *)cell_part;
   else
@@ -1896,7 +2161,7 @@ _part_scotch(SCOTCH_Num   n_cells,
                         n_cells,            /* vertnbr */
                         cell_idx,           /* verttab */
                         NULL,               /* vendtab: verttab + 1 or NULL */
-                        NULL,               /* velotab: vertex weights */
+                        _cell_weight,       /* velotab: vertex weights */
                         NULL,               /* vlbltab; vertex labels */
                         cell_idx[n_cells],  /* edgenbr */
                         cell_neighbors,     /* edgetab */
@@ -1914,6 +2179,8 @@ _part_scotch(SCOTCH_Num   n_cells,
 
   SCOTCH_graphExit(&grafdat);
 
+  BFT_FREE(_cell_weight);
+
   /* Shift cell_part values to 1 to n numbering and free possible temporary */
 
   if (sizeof(SCOTCH_Num) != sizeof(int)) {
@@ -1972,6 +2239,7 @@ _part_scotch(SCOTCH_Num   n_cells,
  *   n_parts       <-- number of partitions
  *   cell_cell_idx <-- cell->cells index
  *   cell_cell     <-- cell->cells connectivity
+ *   cell_weight   <-- cell weights, or NULL
  *   cell_part     --> cell partition
  *   comm          <-- associated MPI communicator
  *----------------------------------------------------------------------------*/
@@ -1982,6 +2250,7 @@ _part_ptscotch(cs_gnum_t    n_g_cells,
                int          n_parts,
                SCOTCH_Num  *cell_idx,
                SCOTCH_Num  *cell_neighbors,
+               const int   *cell_weight,
                int         *cell_part,
                MPI_Comm     comm)
 {
@@ -1996,11 +2265,18 @@ _part_ptscotch(cs_gnum_t    n_g_cells,
 
   SCOTCH_Num    n_cells = cell_range[1] - cell_range[0];
   SCOTCH_Num  *_cell_part = NULL;
+  SCOTCH_Num  *_cell_weight = NULL;
 
   /* Initialization */
 
   start_time = cs_timer_wtime();
 
+  if (cell_weight != NULL) {
+    BFT_MALLOC(_cell_weight, n_cells, SCOTCH_Num);
+    for (i = 0; i < n_cells; i++)
+      _cell_weight[i] = cell_weight[i];
+  }
+
   MPI_Comm_size(comm, &n_ranks);
 
   if (sizeof(SCOTCH_Num) == sizeof(int))
@@ -2025,7 +2301,7 @@ _part_ptscotch(cs_gnum_t    n_g_cells,
                 n_cells,            /* vertlocmax (= vertlocnbr) */
                 cell_idx,           /* vertloctab */
                 NULL,               /* vendloctab: vertloctab + 1 or NULL */
-                NULL,               /* veloloctab: vertex weights */
+                _cell_weight,       /* veloloctab: vertex weights */
                 NULL,               /* vlblloctab; vertex labels */
                 cell_idx[n_cells],  /* edgelocnbr */
                 cell_idx[n_cells],  /* edgelocsiz */
@@ -2046,6 +2322,8 @@ _part_ptscotch(cs_gnum_t    n_g_cells,
 
   SCOTCH_dgraphExit(&grafdat);
 
+  BFT_FREE(_cell_weight);
+
   /* Shift cell_part values to 1 to n numbering and free possible temporary */
 
   if (sizeof(SCOTCH_Num) != sizeof(int)) {
@@ -3055,6 +3333,71 @@ cs_partition_add_partitions(int  n_extra_partitions,
            sizeof(int)*n_extra_partitions);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define cell weights for the next partitioning.
+ *
+ * Weights are associated with the cells of the given mesh using their
+ * global numbers, so they are only valid until the mesh is modified.
+ * They are used (and reset) by the next call to \ref cs_partition.
+ *
+ * Graph-based partitioners use these weights (converted to integers) as
+ * vertex weights, while space-filling curve partitionings split the curve
+ * based on cumulative weights instead of cell counts.
+ *
+ * This is a collective operation.
+ *
+ * \param[in]  mesh    pointer to mesh structure, or NULL to reset weights
+ * \param[in]  weight  strictly positive weight for each local cell,
+ *                     or NULL to reset weights
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_cell_weights(const cs_mesh_t  *mesh,
+                              const float       weight[])
+{
+  BFT_FREE(_part_cell_gnum);
+  BFT_FREE(_part_cell_weight);
+  _part_n_weighted_cells = 0;
+  _part_cell_weight_max = 0;
+
+  if (mesh == NULL || weight == NULL)
+    return;
+
+  const cs_lnum_t n_cells = mesh->n_cells;
+
+  _part_n_weighted_cells = n_cells;
+
+  BFT_MALLOC(_part_cell_gnum, n_cells, cs_gnum_t);
+  BFT_MALLOC(_part_cell_weight, n_cells, float);
+
+  float w_min = (n_cells > 0) ? weight[0] : 1;
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    _part_cell_gnum[i] = (mesh->global_cell_num != NULL) ?
+      mesh->global_cell_num[i] : (cs_gnum_t)i + 1;
+    _part_cell_weight[i] = weight[i];
+    w_min = CS_MIN(w_min, weight[i]);
+    _part_cell_weight_max = CS_MAX(_part_cell_weight_max, weight[i]);
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    float w_max = _part_cell_weight_max;
+    MPI_Allreduce(&w_max, &_part_cell_weight_max, 1, MPI_FLOAT, MPI_MAX,
+                  cs_glob_mpi_comm);
+    float _w_min = w_min;
+    MPI_Allreduce(&_w_min, &w_min, 1, MPI_FLOAT, MPI_MIN, cs_glob_mpi_comm);
+  }
+#endif
+
+  if (w_min <= 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: cell weights must be strictly positive."),
+              __func__);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Partition mesh based on current options.
@@ -3080,6 +3423,7 @@ cs_partition(cs_mesh_t             *mesh,
   int  n_extra_partitions = 0;
 
   int  *cell_part = NULL;
+  int  *cell_weight = NULL;
 
   cs_gnum_t  cell_range[2] = {0, 0};
   cs_lnum_t  n_cells = 0;
@@ -3112,13 +3456,17 @@ cs_partition(cs_mesh_t             *mesh,
     if (   stage != CS_PARTITION_MAIN
         || cs_partition_get_preprocess() == false) {
       _read_cell_rank(mesh, mb, CS_IO_ECHO_OPEN_CLOSE);
-      if (mb->have_cell_rank)
+      if (mb->have_cell_rank) {
+        cs_partition_set_cell_weights(NULL, NULL);
         return;
+      }
     }
   }
   else { /* if (cs_glob_n_ranks == 1) */
-    if (stage != CS_PARTITION_MAIN || n_extra_partitions < 1)
+    if (stage != CS_PARTITION_MAIN || n_extra_partitions < 1) {
+      cs_partition_set_cell_weights(NULL, NULL);
       return;
+    }
   }
 
   (void)cs_timer_wtime();
@@ -3149,6 +3497,20 @@ cs_partition(cs_mesh_t             *mesh,
 
     n_cells = cell_range[1] - cell_range[0];
 
+    if (_part_cell_weight != NULL) {
+      cs_block_dist_info_t part_bi
+        = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                      cs_glob_n_ranks,
+                                      _part_rank_step[stage],
+                                      0,
+                                      mesh->n_g_cells);
+      float *b_weight = _block_cell_weights(part_bi);
+      cell_weight = _integer_cell_weights(n_cells,
+                                          mesh->n_g_cells,
+                                          b_weight);
+      BFT_FREE(b_weight);
+    }
+
   }
   else {
 
@@ -3216,6 +3578,7 @@ cs_partition(cs_mesh_t             *mesh,
                          n_ranks,
                          cell_idx,
                          cell_neighbors,
+                         cell_weight,
                          cell_part,
                          part_comm);
 
@@ -3263,6 +3626,7 @@ cs_partition(cs_mesh_t             *mesh,
                       n_ranks,
                       cell_idx,
                       cell_neighbors,
+                      cell_weight,
                       cell_part);
 
         _distribute_output(mb,
@@ -3343,6 +3707,7 @@ cs_partition(cs_mesh_t             *mesh,
                          n_ranks,
                          cell_idx,
                          cell_neighbors,
+                         cell_weight,
                          cell_part,
                          part_comm);
 
@@ -3390,6 +3755,7 @@ cs_partition(cs_mesh_t             *mesh,
                        n_ranks,
                        cell_idx,
                        cell_neighbors,
+                       cell_weight,
                        cell_part);
 
         _distribute_output(mb,
@@ -3468,6 +3834,8 @@ cs_partition(cs_mesh_t             *mesh,
 
   }
 
+  BFT_FREE(cell_weight);
+
   /* Reset extra partitions list if used */
 
   if (n_extra_partitions > 0) {
@@ -3475,6 +3843,10 @@ cs_partition(cs_mesh_t             *mesh,
     _part_n_extra_partitions = 0;
   }
 
+  /* Reset cell weights, which are only valid for the current mesh */
+
+  cs_partition_set_cell_weights(NULL, NULL);
+
   /* Copy to mesh builder */
 
   mb->have_cell_rank = true;
@@ -224,6 +224,25 @@ void
 cs_partition_add_partitions(int  n_extra_partitions,
                             int  extra_partitions_list[]);
 
+/*----------------------------------------------------------------------------
+ * Define cell weights for the next partitioning.
+ *
+ * Weights are associated with the cells of the given mesh using their
+ * global numbers, so they are only valid until the mesh is modified.
+ * They are used (and reset) by the next call to cs_partition().
+ *
+ * This is a collective operation.
+ *
+ * parameters:
+ *   mesh   <-- pointer to mesh structure, or NULL to reset weights
+ *   weight <-- strictly positive weight for each local cell,
+ *              or NULL to reset weights
+ *----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_cell_weights(const cs_mesh_t  *mesh,
+                              const float       weight[]);
+
 /*----------------------------------------------------------------------------
  * Compute partitioning for a given mesh.
  *
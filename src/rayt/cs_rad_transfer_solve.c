@@ -522,7 +522,6 @@ _cs_rad_transfer_sol(int                        gg_id,
    *                            /2PI
    */
 
-  cs_real_t aa;
   if (!one_dir) {
     for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++)
       f_snplus->val[face_id] = 0.0;
@@ -537,7 +536,8 @@ _cs_rad_transfer_sol(int                        gg_id,
             vect_s[2] = kk * rt_params->vect_s[dir_id][2];
             domegat = rt_params->angsol[dir_id];
             for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
-              aa = cs_math_3_dot_product(vect_s, b_face_normal[face_id]);
+              cs_real_t aa = cs_math_3_dot_product(vect_s,
+                                                   b_face_normal[face_id]);
               aa /= b_face_surf[face_id];
               f_snplus->val[face_id] += 0.5 * (-aa + CS_ABS(aa)) * domegat;
             }
@@ -639,9 +639,11 @@ _cs_rad_transfer_sol(int                        gg_id,
           if (rt_params->atmo_model != CS_RAD_ATMO_3D_NONE) {
 
             const cs_real_t *grav = cs_glob_physical_constants->gravity;
+            const bool upwards = (cs_math_3_dot_product(grav, vect_s) < 0.0);
 
+#           pragma omp parallel for if (n_cells > CS_THR_MIN)
             for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
-              if (cs_math_3_dot_product(grav, vect_s) < 0.0)
+              if (upwards)
                 ck_u_d[cell_id] = ck_u[gg_id + cell_id * stride] * 3./5.;
               else
                 ck_u_d[cell_id] = ck_d[gg_id + cell_id * stride] * 3./5.;
@@ -658,6 +660,7 @@ _cs_rad_transfer_sol(int                        gg_id,
             }
           }
           else {
+#           pragma omp parallel for if (n_cells > CS_THR_MIN)
             for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
               rhs[cell_id] = rhs0[cell_id];
           }
@@ -673,28 +676,34 @@ _cs_rad_transfer_sol(int                        gg_id,
                  / (2. * pi - domegat);
             const cs_real_t *i_face_surf = cs_glob_mesh_quantities->i_face_surf;
 
+#           pragma omp parallel for if (n_i_faces > CS_THR_MIN)
             for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++)
               viscf[face_id] = disp_coeff * tan_alpha * i_face_surf[face_id];
           }
 
           else {
+#           pragma omp parallel for if (n_i_faces > CS_THR_MIN)
             for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++)
               viscf[face_id] = 0.0;
           }
 
+#         pragma omp parallel for if (n_b_faces > CS_THR_MIN)
           for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++)
             viscb[face_id] = 0.0;
 
+#         pragma omp parallel for if (n_cells_ext > CS_THR_MIN)
           for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++) {
             radiance[cell_id] = 0.0;
             radiance_prev[cell_id] = 0.0;
           }
 
+#         pragma omp parallel for if (n_i_faces > CS_THR_MIN)
           for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++)
             flurds[face_id] = cs_math_3_dot_product(vect_s,
                                                     i_face_normal[face_id]);
 
 
+#         pragma omp parallel for if (n_b_faces > CS_THR_MIN)
           for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++)
             flurdb[face_id] =  cs_math_3_dot_product(vect_s,
                                                      b_face_normal[face_id]);
@@ -742,8 +751,9 @@ _cs_rad_transfer_sol(int                        gg_id,
 
           if (rt_params->atmo_model != CS_RAD_ATMO_3D_NONE) {
 
+#           pragma omp parallel for if (n_cells > CS_THR_MIN)
             for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
-              aa = radiance[cell_id] * domegat;
+              cs_real_t aa = radiance[cell_id] * domegat;
               int_rad_domega[cell_id]  += aa;
               /* Absorption */
               int_abso[cell_id] += ck_u_d[cell_id] * aa;
@@ -764,8 +774,9 @@ _cs_rad_transfer_sol(int                        gg_id,
           }
           else {
 
+#           pragma omp parallel for if (n_cells > CS_THR_MIN)
             for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
-              aa = radiance[cell_id] * domegat;
+              cs_real_t aa = radiance[cell_id] * domegat;
               int_rad_domega[cell_id]  += aa;
               q[cell_id][0] += aa * vect_s[0];
               q[cell_id][1] += aa * vect_s[1];
@@ -776,9 +787,11 @@ _cs_rad_transfer_sol(int                        gg_id,
 
           /* Flux incident to boundary */
 
+#         pragma omp parallel for if (n_b_faces > CS_THR_MIN)
           for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
             cs_lnum_t cell_id = cs_glob_mesh->b_face_cells[face_id];
-            aa = cs_math_3_dot_product(vect_s, b_face_normal[face_id]);
+            cs_real_t aa = cs_math_3_dot_product(vect_s,
+                                                 b_face_normal[face_id]);
             aa /= b_face_surf[face_id];
             aa = 0.5 * (aa + CS_ABS(aa)) * domegat;
             f_snplus->val[face_id] += aa;
@@ -789,11 +802,13 @@ _cs_rad_transfer_sol(int                        gg_id,
           /* Specific to Atmo (Direct Solar, diFfuse Solar, Infra Red) */
           if (cs_math_3_dot_product(cs_glob_physical_constants->gravity,
                                     vect_s) < 0.0 && f_up != NULL) {
+#           pragma omp parallel for if (n_cells > CS_THR_MIN)
             for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
               f_up->val[gg_id + cell_id * stride] += radiance[cell_id] * domegat * vect_s[2];//FIXME S.g/||g||
           }
           else if (cs_math_3_dot_product(cs_glob_physical_constants->gravity,
                                          vect_s) > 0.0 && f_down != NULL) {
+#           pragma omp parallel for if (n_cells > CS_THR_MIN)
             for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
               f_down->val[gg_id + cell_id * stride] += radiance[cell_id] * domegat * vect_s[2];
           }
@@ -833,45 +833,162 @@ _synthetic_eddy_method(cs_lnum_t         n_points,
 
 #endif
 
+  /* Binning of the eddies */
+  /*------------------------*/
+
+  /* Bins are at least as large as the largest eddy in each direction,
+     so that each point only needs to visit neighboring bins */
+
+  int n_bins[3] = {1, 1, 1};
+  double bin_size_inv[3] = {0., 0., 0.};
+
+  {
+    double ls_max[3] = {0., 0., 0.};
+
+    for (point_id = 0; point_id < n_points; point_id++) {
+      for (coo_id = 0; coo_id < 3; coo_id++)
+        ls_max[coo_id] = CS_MAX(ls_max[coo_id],
+                                length_scale[3*point_id + coo_id]);
+    }
+
+#if defined(HAVE_MPI)
+
+    if (cs_glob_rank_id >= 0) {
+      double max_glob[3];
+      MPI_Allreduce(ls_max, max_glob, 3, MPI_DOUBLE, MPI_MAX,
+                    cs_glob_mpi_comm);
+      for (coo_id = 0; coo_id < 3; coo_id++)
+        ls_max[coo_id] = max_glob[coo_id];
+    }
+
+#endif
+
+    for (coo_id = 0; coo_id < 3; coo_id++) {
+      if (ls_max[coo_id] > 0. && box_length[coo_id] > ls_max[coo_id])
+        n_bins[coo_id] = CS_MIN(box_length[coo_id] / ls_max[coo_id], 1024);
+    }
+
+    /* Limit total number of bins to the number of structures */
+
+    while (   n_bins[0]*n_bins[1]*n_bins[2] > inflow->n_structures
+           && n_bins[0]*n_bins[1]*n_bins[2] > 1) {
+      int k = 0;
+      if (n_bins[1] > n_bins[k]) k = 1;
+      if (n_bins[2] > n_bins[k]) k = 2;
+      n_bins[k] = (n_bins[k] + 1) / 2;
+    }
+
+    for (coo_id = 0; coo_id < 3; coo_id++) {
+      if (box_length[coo_id] > 0.)
+        bin_size_inv[coo_id] = n_bins[coo_id] / box_length[coo_id];
+    }
+  }
+
+  const cs_lnum_t n_bins_tot = (cs_lnum_t)n_bins[0]*n_bins[1]*n_bins[2];
+
+  cs_lnum_t *bin_idx, *bin_struct;
+  int *struct_bin;
+
+  BFT_MALLOC(bin_idx, n_bins_tot + 1, cs_lnum_t);
+  BFT_MALLOC(bin_struct, inflow->n_structures, cs_lnum_t);
+  BFT_MALLOC(struct_bin, inflow->n_structures, int);
+
+  for (cs_lnum_t b_id = 0; b_id < n_bins_tot + 1; b_id++)
+    bin_idx[b_id] = 0;
+
+  for (struct_id = 0; struct_id < inflow->n_structures; struct_id++) {
+    int b[3];
+    for (coo_id = 0; coo_id < 3; coo_id++) {
+      b[coo_id] = (inflow->position[struct_id*3 + coo_id]
+                   - box_min_coord[coo_id]) * bin_size_inv[coo_id];
+      b[coo_id] = CS_MIN(CS_MAX(b[coo_id], 0), n_bins[coo_id] - 1);
+    }
+    struct_bin[struct_id] = (b[2]*n_bins[1] + b[1])*n_bins[0] + b[0];
+    bin_idx[struct_bin[struct_id] + 1] += 1;
+  }
+
+  for (cs_lnum_t b_id = 0; b_id < n_bins_tot; b_id++)
+    bin_idx[b_id + 1] += bin_idx[b_id];
+
+  for (struct_id = 0; struct_id < inflow->n_structures; struct_id++) {
+    int b_id = struct_bin[struct_id];
+    bin_struct[bin_idx[b_id]] = struct_id;
+    bin_idx[b_id] += 1;
+  }
+
+  for (cs_lnum_t b_id = n_bins_tot; b_id > 0; b_id--)
+    bin_idx[b_id] = bin_idx[b_id - 1];
+  bin_idx[0] = 0;
+
+  BFT_FREE(struct_bin);
+
   /* Computation of the eddy signal */
   /*--------------------------------*/
 
   alpha = sqrt(box_volume / (double) inflow->n_structures);
 
-  for (point_id = 0; point_id < n_points; point_id++) {
+  const double *restrict position = inflow->position;
+  const double *restrict energy = inflow->energy;
 
-    double distance[3];
+# pragma omp parallel for if (n_points > CS_THR_MIN)
+  for (cs_lnum_t p_id = 0; p_id < n_points; p_id++) {
 
-    for (struct_id = 0; struct_id < inflow->n_structures; struct_id++) {
+    const cs_real_t *x = point_coordinates + p_id*3;
+    const double *ls = length_scale + p_id*3;
 
-      for (coo_id = 0; coo_id < 3; coo_id++)
-        distance[coo_id] =
-          CS_ABS(point_coordinates[point_id*3 + coo_id]
-                 - inflow->position[struct_id*3 + coo_id]);
+    int b_min[3], b_max[3];
 
-      if (distance[0] < length_scale[point_id*3 + 0] &&
-          distance[1] < length_scale[point_id*3 + 1] &&
-          distance[2] < length_scale[point_id*3 + 2]) {
+    for (int k = 0; k < 3; k++) {
+      b_min[k] = (x[k] - ls[k] - box_min_coord[k]) * bin_size_inv[k];
+      b_max[k] = (x[k] + ls[k] - box_min_coord[k]) * bin_size_inv[k];
+      b_min[k] = CS_MIN(CS_MAX(b_min[k], 0), n_bins[k] - 1);
+      b_max[k] = CS_MIN(CS_MAX(b_max[k], 0), n_bins[k] - 1);
+    }
 
-        double form_function = 1.;
-        for (coo_id = 0; coo_id < 3; coo_id++)
-          form_function *=
-            (1.-distance[coo_id]/length_scale[point_id*3 + coo_id])
-            /sqrt(2./3.*length_scale[point_id*3 + coo_id]);
+    double f_p[3] = {0., 0., 0.};
 
-        for (coo_id = 0; coo_id < 3; coo_id++)
-          fluctuations[point_id*3 + coo_id] +=
-            inflow->energy[struct_id*3 + coo_id]*form_function;
+    for (int b2 = b_min[2]; b2 <= b_max[2]; b2++) {
+      for (int b1 = b_min[1]; b1 <= b_max[1]; b1++) {
+        for (int b0 = b_min[0]; b0 <= b_max[0]; b0++) {
 
-      }
+          cs_lnum_t b_id = (b2*n_bins[1] + b1)*n_bins[0] + b0;
+
+          for (cs_lnum_t i = bin_idx[b_id]; i < bin_idx[b_id+1]; i++) {
+
+            cs_lnum_t s_id = bin_struct[i];
+
+            double distance[3];
+            for (int k = 0; k < 3; k++)
+              distance[k] = CS_ABS(x[k] - position[s_id*3 + k]);
+
+            if (   distance[0] < ls[0]
+                && distance[1] < ls[1]
+                && distance[2] < ls[2]) {
+
+              double form_function = 1.;
+              for (int k = 0; k < 3; k++)
+                form_function *=   (1.-distance[k]/ls[k])
+                                 / sqrt(2./3.*ls[k]);
+
+              for (int k = 0; k < 3; k++)
+                f_p[k] += energy[s_id*3 + k]*form_function;
 
+            }
+
+          }
+
+        }
+      }
     }
 
-    for (coo_id = 0; coo_id < 3; coo_id++)
-      fluctuations[point_id*3 + coo_id] *= alpha;
+    for (int k = 0; k < 3; k++)
+      fluctuations[p_id*3 + k] = (fluctuations[p_id*3 + k] + f_p[k]) * alpha;
 
   }
 
+  BFT_FREE(bin_idx);
+  BFT_FREE(bin_struct);
+
   BFT_FREE(length_scale);
 }
 
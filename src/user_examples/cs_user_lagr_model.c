@@ -305,6 +305,17 @@ cs_user_lagr_model(void)
 
   cs_lagr_set_n_user_variables(0);
 
+  /* Particle data storage layout
+   * ----------------------------
+   *   CS_LAGR_PARTICLE_LAYOUT_AOS (default): all data of a given particle
+   *     is contiguous
+   *   CS_LAGR_PARTICLE_LAYOUT_SOA: values of a given attribute are
+   *     contiguous, which reduces memory traffic for loops (such as
+   *     statistics or stochastic differential equations) using only
+   *     a few attributes */
+
+  cs_lagr_set_particle_layout(CS_LAGR_PARTICLE_LAYOUT_AOS);
+
   /* Steady or unsteady continuous phase
    * -----------------------------------
    *   if steady: isttio = 1
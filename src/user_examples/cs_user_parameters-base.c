@@ -1036,6 +1036,46 @@ cs_user_parameters(cs_domain_t *domain)
 
   /*! [param_var_q_criterion] */
 
+  /* Example: adapt the mesh based on the temperature */
+  /*--------------------------------------------------*/
+
+  /*! [param_mesh_adapt] */
+
+  cs_mesh_adapt_define("temperature",
+                       0.5,    /* refine if indicator > 0.5*max */
+                       0.05,   /* coarsen if indicator < 0.05*max */
+                       3,      /* maximum refinement level */
+                       1.2);   /* repartition if max/mean cells > 1.2 */
+
+  cs_mesh_adapt_set_interval(20);  /* adapt every 20 time steps */
+
+  /*! [param_mesh_adapt] */
+
+  /* Example: rebalance the mesh based on particle counts */
+  /*------------------------------------------------------*/
+
+  /*! [param_load_balance] */
+
+  cs_load_balance_define(0.1,    /* cost of a particle relative to a cell */
+                         1.15);  /* repartition if max/mean cost > 1.15 */
+
+  cs_load_balance_set_interval(50);  /* also check every 50 time steps */
+
+  /*! [param_load_balance] */
+
+  /* Example: tabulate properties from the thermal table library */
+  /*-------------------------------------------------------------*/
+
+  /*! [param_thermal_table_tabulation] */
+
+  cs_thermal_table_set_tabulation(7.e6, 2.e7,    /* pressure range (Pa) */
+                                  300., 400.,    /* temperature range */
+                                  33,            /* initial nodes per axis */
+                                  1.e-6,         /* relative tolerance */
+                                  "../../tables"); /* cache directory */
+
+  /*! [param_thermal_table_tabulation] */
+
   /* Example: homogeneous mixture physical properties */
   /*--------------------------------------------------*/
 
@@ -1106,6 +1146,19 @@ cs_user_parameters(cs_domain_t *domain)
   /*! [change_nsave_checkpoint_files] */
   cs_restart_set_n_max_checkpoints(2);
   /*! [change_nsave_checkpoint_files] */
+
+  /* Example: write checkpoint files asynchronously, so that computation
+   * resumes while a background thread writes the files. */
+
+  /*! [async_checkpoint_files] */
+  cs_restart_checkpoint_set_async_mode(1);
+  /*! [async_checkpoint_files] */
+
+  /* Example: compress checkpoint files (byte shuffle + deflate) */
+
+  /*! [compress_checkpoint_files] */
+  cs_restart_checkpoint_set_compression(2);
+  /*! [compress_checkpoint_files] */
 }
 
 /*----------------------------------------------------------------------------*/
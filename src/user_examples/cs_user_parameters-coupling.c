@@ -115,6 +115,19 @@ cs_user_parameters(cs_domain_t  *domain)
     cs_coupling_set_ts_multiplier(10.);
     /*! [coupling_1] */
   }
+
+  /*-------------------------------------------------------------------------
+   * Example: describe the coupled mesh of each rank with up to 16 bounding
+   * boxes for point location, instead of a single one.
+   *
+   * This reduces the number of ranks to which points are sent when
+   * coupling surfaces are thin or curved.
+   *-------------------------------------------------------------------------*/
+  {
+    /*! [coupling_locator_extents] */
+    cs_coupling_set_locator_max_rank_extents(16);
+    /*! [coupling_locator_extents] */
+  }
 }
 
 /*----------------------------------------------------------------------------*/
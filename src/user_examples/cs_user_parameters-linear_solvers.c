@@ -290,6 +290,9 @@ cs_user_linear_solvers(void)
    *  CS_SLES_P_GAUSS_SEIDEL      (process-local Gauss-Seidel)
    *  CS_SLES_P_SYM_GAUSS_SEIDEL  (process-local symmetric Gauss-Seidel)
    *  CS_SLES_PCR3                (3-layer conjugate residual)
+   *  CS_SLES_PCG_PIPELINED       (pipelined conjugate gradient, with
+   *                               a single non-blocking reduction
+   *                               per iteration)
    *
    *  The multigrid solver uses the conjugate gradient as a smoother
    *  and coarse solver by default, but this behavior may be modified. */
@@ -371,6 +374,11 @@ cs_user_linear_solvers(void)
        -1.0,           /* precision multiplier ascent (< 0 forces max iters) */
        0.1);           /* requested precision multiplier coarse (default 1) */
 
+    /* Store coarse level extra-diagonal coefficients in single precision
+       (default: false) */
+
+    cs_multigrid_set_precision_options(mg, true);
+
   }
   /*! [sles_mgp_1] */
 
@@ -425,6 +433,25 @@ cs_user_linear_solvers(void)
   }
   /*! [sles_mgp_2] */
 
+  /* Example: BiCGStab preconditioned by ILU(0) for velocity */
+  /*---------------------------------------------------------*/
+
+  /*! [sles_ilu0_1] */
+  {
+    cs_sles_it_t *c = cs_sles_it_define(CS_F_(vel)->id,
+                                        NULL,
+                                        CS_SLES_BICGSTAB,
+                                        -1,
+                                        1000);
+    cs_sles_pc_t *pc = cs_sles_pc_ilu0_create();
+    cs_sles_it_transfer_pc(c, &pc);
+
+    /* ILU(0) requires MSR storage (here, for 3x3 diagonal blocks);
+       this is done in cs_user_matrix_tuning (cs_user_performance_tuning.c):
+       cs_matrix_default_set_type(CS_MATRIX_BLOCK_D, CS_MATRIX_MSR); */
+  }
+  /*! [sles_ilu0_1] */
+
   /* Set a non-default linear solver for DOM radiation. */
   /*----------------------------------------------------*/
 
@@ -91,6 +91,16 @@ cs_user_matrix_tuning(void)
   cs_grid_set_matrix_tuning(CS_MATRIX_SCALAR_SYM, 12);
 
   /*! [performance_tuning_matrix] */
+
+  /*! [performance_tuning_matrix_free] */
+
+  /* Compute extra-diagonal terms of velocity and Reynolds stress
+     systems on the fly rather than storing them */
+
+  cs_matrix_default_set_matrix_free(CS_MATRIX_BLOCK_D, true);
+  cs_matrix_default_set_matrix_free(CS_MATRIX_BLOCK_D_66, true);
+
+  /*! [performance_tuning_matrix_free] */
 }
 
 /*----------------------------------------------------------------------------*/
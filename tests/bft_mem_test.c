@@ -103,6 +103,35 @@ main (int argc, char *argv[])
 
   bft_mem_end();
 
+  /* Sampled call site statistics, with threaded allocations */
+
+  bft_mem_sampling_set(4);
+  bft_mem_init("bft_mem_sampled_log_file");
+
+  {
+    void *p[256];
+
+#   pragma omp parallel for
+    for (int i = 0; i < 256; i++)
+      BFT_MALLOC(p[i], i+1, double);
+
+#   pragma omp parallel for
+    for (int i = 0; i < 256; i++)
+      BFT_REALLOC(p[i], 2*(i+1), double);
+
+    for (int i = 0; i < 128; i++)
+      BFT_FREE(p[i]);
+
+    printf("current sampled memory: %lu kB\n",
+           (unsigned long) bft_mem_size_current());
+
+    for (int i = 128; i < 256; i++)
+      BFT_FREE(p[i]);
+  }
+
+  bft_mem_end();
+  bft_mem_sampling_set(0);
+
   printf("max memory usage: %lu kB\n",
          (unsigned long) bft_mem_usage_max_pr_size());
 
@@ -0,0 +1,314 @@
+/*============================================================================
+ * Unit test for pipelined conjugate gradient solver
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_halo.h"
+#include "cs_matrix.h"
+#include "cs_sles.h"
+#include "cs_sles_it.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Build an SPD matrix (shifted 5-point Laplacian on an nx*ny grid).
+ *
+ * parameters:
+ *   nx      <-- number of rows in x direction
+ *   ny      <-- number of rows in y direction
+ *   n_edges --> number of edges
+ *   edges   --> edges (row couples)
+ *   da      --> diagonal values
+ *   xa      --> extra-diagonal values
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_laplacian(cs_lnum_t      nx,
+                 cs_lnum_t      ny,
+                 cs_lnum_t     *n_edges,
+                 cs_lnum_2_t  **edges,
+                 cs_real_t    **da,
+                 cs_real_t    **xa)
+{
+  cs_lnum_t n_rows = nx*ny;
+  cs_lnum_t _n_edges = (nx-1)*ny + nx*(ny-1);
+
+  cs_lnum_2_t *_edges;
+  cs_real_t *_da, *_xa;
+
+  BFT_MALLOC(_edges, _n_edges, cs_lnum_2_t);
+  BFT_MALLOC(_da, n_rows, cs_real_t);
+  BFT_MALLOC(_xa, _n_edges, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    _da[i] = 1e-3 * (1. + (double)(i%7));
+
+  cs_lnum_t e_id = 0;
+  for (cs_lnum_t j = 0; j < ny; j++) {
+    for (cs_lnum_t i = 0; i < nx; i++) {
+      cs_lnum_t r_id = j*nx + i;
+      if (i < nx-1) {
+        _edges[e_id][0] = r_id;
+        _edges[e_id][1] = r_id + 1;
+        e_id++;
+      }
+      if (j < ny-1) {
+        _edges[e_id][0] = r_id;
+        _edges[e_id][1] = r_id + nx;
+        e_id++;
+      }
+    }
+  }
+
+  /* Anisotropic coefficients, so that the problem is not too easy */
+
+  for (e_id = 0; e_id < _n_edges; e_id++) {
+    cs_lnum_t r0 = _edges[e_id][0], r1 = _edges[e_id][1];
+    double c = (r1 == r0 + 1) ? 1. : 0.1;
+    c *= 1. + 0.5*sin(0.01*r0);
+    _xa[e_id] = -c;
+    _da[r0] += c;
+    _da[r1] += c;
+  }
+
+  *n_edges = _n_edges;
+  *edges = _edges;
+  *da = _da;
+  *xa = _xa;
+}
+
+/*----------------------------------------------------------------------------
+ * Solve a system with a given solver type.
+ *
+ * parameters:
+ *   a           <-- matrix
+ *   type        <-- solver type
+ *   poly_degree <-- preconditioning polynomial degree (< 0 for none)
+ *   precision   <-- solver precision
+ *   r_norm      <-- residue normalization
+ *   rhs         <-- right hand side
+ *   vx          --> solution
+ *   n_iter      --> number of iterations
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_solve(const cs_matrix_t  *a,
+       cs_sles_it_type_t   type,
+       int                 poly_degree,
+       double              precision,
+       double              r_norm,
+       const cs_real_t    *rhs,
+       cs_real_t          *vx,
+       int                *n_iter)
+{
+  cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+  double residue = -1;
+
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    vx[i] = 0;
+
+  cs_sles_it_t *c = cs_sles_it_create(type, poly_degree, 10000, false);
+
+  cs_sles_it_setup(c, "test", a, 0);
+
+  cs_sles_convergence_state_t cvg
+    = cs_sles_it_solve(c, "test", a, 0, CS_HALO_ROTATION_COPY,
+                       precision, r_norm, n_iter, &residue,
+                       rhs, vx, 0, NULL);
+
+  cs_sles_it_destroy((void **)&c);
+
+  return cvg;
+}
+
+/*----------------------------------------------------------------------------
+ * Compare pipelined and standard conjugate gradient on a given system.
+ *
+ * parameters:
+ *   a           <-- matrix
+ *   poly_degree <-- preconditioning polynomial degree (< 0 for none)
+ *   rhs         <-- right hand side
+ *
+ * returns:
+ *   number of errors
+ *----------------------------------------------------------------------------*/
+
+static int
+_compare(const cs_matrix_t  *a,
+         int                 poly_degree,
+         const cs_real_t    *rhs)
+{
+  int n_errors = 0;
+
+  const double precision = 1e-8;
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+
+  cs_real_t *x_ref, *x, *r;
+  BFT_MALLOC(x_ref, n_rows, cs_real_t);
+  BFT_MALLOC(x, n_rows, cs_real_t);
+  BFT_MALLOC(r, n_rows, cs_real_t);
+
+  double r_norm = 0;
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    r_norm += rhs[i]*rhs[i];
+  r_norm = sqrt(r_norm);
+
+  int n_iter_ref = 0, n_iter = 0;
+
+  cs_sles_convergence_state_t cvg_ref
+    = _solve(a, CS_SLES_PCG, poly_degree, precision, r_norm,
+             rhs, x_ref, &n_iter_ref);
+  cs_sles_convergence_state_t cvg
+    = _solve(a, CS_SLES_PCG_PIPELINED, poly_degree, precision, r_norm,
+             rhs, x, &n_iter);
+
+  if (cvg_ref != CS_SLES_CONVERGED || cvg != CS_SLES_CONVERGED) {
+    bft_printf("  poly_degree %d: convergence state %d (PCG) and %d "
+               "(pipelined)\n", poly_degree, (int)cvg_ref, (int)cvg);
+    n_errors++;
+  }
+
+  /* Iteration counts should be the same, up to round-off
+     differences at the convergence threshold */
+
+  if (abs(n_iter - n_iter_ref) > 2) {
+    bft_printf("  poly_degree %d: %d iterations (PCG) and %d (pipelined)\n",
+               poly_degree, n_iter_ref, n_iter);
+    n_errors++;
+  }
+
+  /* Check solution difference and true residual */
+
+  cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, a, x, r);
+
+  double d_norm = 0, x_norm = 0, res = 0;
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+    d_norm += (x[i] - x_ref[i])*(x[i] - x_ref[i]);
+    x_norm += x_ref[i]*x_ref[i];
+    res += (rhs[i] - r[i])*(rhs[i] - r[i]);
+  }
+  d_norm = sqrt(d_norm / x_norm);
+  res = sqrt(res) / r_norm;
+
+  bft_printf("  poly_degree %2d: iterations %4d (PCG), %4d (pipelined); "
+             "rel. difference %.3e; rel. residual %.3e\n",
+             poly_degree, n_iter_ref, n_iter, d_norm, res);
+
+  if (d_norm > 1e-5 || res > 1e3*precision) {
+    bft_printf("  poly_degree %d: solutions differ\n", poly_degree);
+    n_errors++;
+  }
+
+  BFT_FREE(r);
+  BFT_FREE(x);
+  BFT_FREE(x_ref);
+
+  return n_errors;
+}
+
+/*============================================================================
+ * Main program
+ *============================================================================*/
+
+int
+main(int    argc,
+     char  *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+  int n_errors = 0;
+
+  bft_mem_init(getenv("CS_MEM_LOG"));
+
+  const cs_lnum_t nx = 64, ny = 48;
+  const cs_lnum_t n_rows = nx*ny;
+
+  cs_lnum_t n_edges = 0;
+  cs_lnum_2_t *edges = NULL;
+  cs_real_t *da = NULL, *xa = NULL, *rhs = NULL;
+
+  _build_laplacian(nx, ny, &n_edges, &edges, &da, &xa);
+
+  BFT_MALLOC(rhs, n_rows, cs_real_t);
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    rhs[i] = cos(0.37*i) + 0.1;
+
+  cs_matrix_structure_t *ms
+    = cs_matrix_structure_create(CS_MATRIX_NATIVE, true, n_rows, n_rows,
+                                 n_edges, (const cs_lnum_2_t *)edges,
+                                 NULL, NULL);
+  cs_matrix_t *a = cs_matrix_create(ms);
+
+  cs_matrix_set_coefficients(a, true, NULL, NULL,
+                             n_edges, (const cs_lnum_2_t *)edges, da, xa);
+
+  bft_printf("\nPipelined and standard conjugate gradient, "
+             "%d rows:\n\n", (int)n_rows);
+
+  /* No, Jacobi, and polynomial preconditioning */
+
+  for (int poly_degree = -1; poly_degree < 2; poly_degree++)
+    n_errors += _compare(a, poly_degree, rhs);
+
+  cs_matrix_destroy(&a);
+  cs_matrix_structure_destroy(&ms);
+
+  BFT_FREE(rhs);
+  BFT_FREE(xa);
+  BFT_FREE(da);
+  BFT_FREE(edges);
+
+  bft_mem_end();
+
+  if (n_errors > 0) {
+    bft_printf("\n%d errors\n", n_errors);
+    exit (EXIT_FAILURE);
+  }
+
+  exit (EXIT_SUCCESS);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -625,27 +625,32 @@ main (int argc, char *argv[])
 #endif
 
     /* Create associated structures and matrices
-       (2 matrices are created simultaneously, to exercice
+       (3 matrices are created simultaneously, to exercice
        the const/shareable aspect of the assembler) */
 
     cs_matrix_structure_t  *ms_0
       = cs_matrix_structure_create_from_assembler(CS_MATRIX_CSR, ma);
     cs_matrix_structure_t  *ms_1
       = cs_matrix_structure_create_from_assembler(CS_MATRIX_MSR, ma);
+    cs_matrix_structure_t  *ms_2
+      = cs_matrix_structure_create_from_assembler(CS_MATRIX_SELL, ma);
 
     cs_matrix_t  *m_0 = cs_matrix_create(ms_0);
     cs_matrix_t  *m_1 = cs_matrix_create(ms_1);
+    cs_matrix_t  *m_2 = cs_matrix_create(ms_2);
 
     /* Now prepare to add values */
 
-    for (int mav_id = 0; mav_id < 2; mav_id++) {
+    for (int mav_id = 0; mav_id < 3; mav_id++) {
 
       cs_matrix_assembler_values_t *mav = NULL;
 
       if (mav_id == 0)
         mav = cs_matrix_assembler_values_init(m_0, NULL, NULL);
-      else
+      else if (mav_id == 1)
         mav = cs_matrix_assembler_values_init(m_1, NULL, NULL);
+      else
+        mav = cs_matrix_assembler_values_init(m_2, NULL, NULL);
 
       /* Same ids required as for assembler (at least, no additional ids),
          so loop in a similar manner for safety, but with different
@@ -703,32 +708,38 @@ main (int argc, char *argv[])
     cs_lnum_t n_rows = cs_matrix_get_n_rows(m_0);
     cs_lnum_t n_cols = cs_matrix_get_n_columns(m_0);
 
-    cs_real_t *x, *y_0, *y_1;
+    cs_real_t *x, *y_0, *y_1, *y_2;
     BFT_MALLOC(x, n_cols, cs_real_t);
     BFT_MALLOC(y_0, n_cols, cs_real_t);
     BFT_MALLOC(y_1, n_cols, cs_real_t);
+    BFT_MALLOC(y_2, n_cols, cs_real_t);
     for (cs_lnum_t i = 0; i < n_rows; i++)
       x[i] = (i+1)*0.5;
 
     cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m_0, x, y_0);
     cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m_1, x, y_1);
+    cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m_2, x, y_2);
 
     bft_printf("\nSpMV pass %d\n", id_ie);
     for (cs_lnum_t i = 0; i < n_rows; i++)
-      bft_printf("%d: %f %f\n", i, y_0[i], y_1[i]);
+      bft_printf("%d: %f %f %f\n", i, y_0[i], y_1[i], y_2[i]);
 
     BFT_FREE(x);
     BFT_FREE(y_0);
     BFT_FREE(y_1);
+    BFT_FREE(y_2);
 
     cs_matrix_release_coefficients(m_0);
     cs_matrix_release_coefficients(m_1);
+    cs_matrix_release_coefficients(m_2);
 
     cs_matrix_destroy(&m_0);
     cs_matrix_destroy(&m_1);
+    cs_matrix_destroy(&m_2);
 
     cs_matrix_structure_destroy(&ms_0);
     cs_matrix_structure_destroy(&ms_1);
+    cs_matrix_structure_destroy(&ms_2);
 
     cs_matrix_assembler_destroy(&ma);
   }
@@ -0,0 +1,393 @@
+/*============================================================================
+ * Unit test for cs_order.c sorting algorithms
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_order.h"
+
+/*---------------------------------------------------------------------------*/
+
+/* Internal ordering algorithms, defined in cs_order.c
+   when built with _CS_UNIT_ORDER_TEST */
+
+bool
+cs_order_unit_test_gnum_s(const cs_gnum_t   number[],
+                          size_t            stride,
+                          cs_lnum_t         order[],
+                          size_t            nb_ent,
+                          bool              heapsort);
+
+bool
+cs_order_unit_test_gnum_i(const cs_gnum_t   number[],
+                          const cs_lnum_t   index[],
+                          cs_lnum_t         order[],
+                          size_t            nb_ent,
+                          bool              heapsort);
+
+void
+cs_order_unit_test_real(const cs_real_t   value[],
+                        cs_lnum_t         order[],
+                        size_t            nb_ent,
+                        bool              heapsort);
+
+/*---------------------------------------------------------------------------*/
+
+static unsigned long long _rand_state = 88172645463325252ULL;
+
+/*----------------------------------------------------------------------------
+ * Return a pseudo-random 64-bit value (xorshift generator).
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_rand_gnum(void)
+{
+  _rand_state ^= _rand_state << 13;
+  _rand_state ^= _rand_state >> 7;
+  _rand_state ^= _rand_state << 17;
+
+  return (cs_gnum_t)_rand_state;
+}
+
+/*----------------------------------------------------------------------------
+ * Check that an ordering is a permutation.
+ *
+ * parameters:
+ *   order   <-- ordering to check
+ *   nb_ent  <-- number of entities
+ *
+ * returns:
+ *   number of errors
+ *----------------------------------------------------------------------------*/
+
+static int
+_check_permutation(const cs_lnum_t  order[],
+                   size_t           nb_ent)
+{
+  int n_errors = 0;
+  char *count = NULL;
+
+  BFT_MALLOC(count, nb_ent, char);
+  memset(count, 0, nb_ent);
+
+  for (size_t i = 0; i < nb_ent; i++) {
+    if (order[i] < 0 || (size_t)order[i] >= nb_ent)
+      n_errors++;
+    else if (count[order[i]]++ > 0)
+      n_errors++;
+  }
+
+  BFT_FREE(count);
+
+  return n_errors;
+}
+
+/*----------------------------------------------------------------------------
+ * Compare strided global number orderings using radix sort and heapsort.
+ *
+ * As heapsort is not stable, the ordered values (not the orderings)
+ * are compared.
+ *
+ * parameters:
+ *   name    <-- test case name
+ *   number  <-- array of entity numbers
+ *   stride  <-- stride of array
+ *   nb_ent  <-- number of entities
+ *
+ * returns:
+ *   number of errors
+ *----------------------------------------------------------------------------*/
+
+static int
+_test_gnum_s(const char       *name,
+             const cs_gnum_t   number[],
+             size_t            stride,
+             size_t            nb_ent)
+{
+  int n_errors = 0;
+  cs_lnum_t *order_r = NULL, *order_h = NULL;
+
+  BFT_MALLOC(order_r, nb_ent, cs_lnum_t);
+  BFT_MALLOC(order_h, nb_ent, cs_lnum_t);
+
+  if (cs_order_unit_test_gnum_s(number, stride, order_r, nb_ent, false)) {
+
+    cs_order_unit_test_gnum_s(number, stride, order_h, nb_ent, true);
+
+    n_errors += _check_permutation(order_r, nb_ent);
+
+    for (size_t i = 0; i < nb_ent; i++) {
+      const cs_gnum_t *n_r = number + (size_t)order_r[i]*stride;
+      const cs_gnum_t *n_h = number + (size_t)order_h[i]*stride;
+      if (memcmp(n_r, n_h, stride*sizeof(cs_gnum_t)) != 0)
+        n_errors++;
+    }
+
+  }
+  else {
+    bft_printf("  %s: radix sort not used\n", name);
+    n_errors++;
+  }
+
+  bft_printf("  %-32s (n = %llu, stride %d): %d errors\n",
+             name, (unsigned long long)nb_ent, (int)stride, n_errors);
+
+  BFT_FREE(order_h);
+  BFT_FREE(order_r);
+
+  return n_errors;
+}
+
+/*----------------------------------------------------------------------------
+ * Compare indexed global number orderings using radix sort and heapsort.
+ *
+ * parameters:
+ *   name    <-- test case name
+ *   number  <-- array of entity numbers
+ *   index   <-- number of values to compare for each entity
+ *   nb_ent  <-- number of entities
+ *
+ * returns:
+ *   number of errors
+ *----------------------------------------------------------------------------*/
+
+static int
+_test_gnum_i(const char       *name,
+             const cs_gnum_t   number[],
+             const cs_lnum_t   index[],
+             size_t            nb_ent)
+{
+  int n_errors = 0;
+  cs_lnum_t *order_r = NULL, *order_h = NULL;
+
+  BFT_MALLOC(order_r, nb_ent, cs_lnum_t);
+  BFT_MALLOC(order_h, nb_ent, cs_lnum_t);
+
+  if (cs_order_unit_test_gnum_i(number, index, order_r, nb_ent, false)) {
+
+    cs_order_unit_test_gnum_i(number, index, order_h, nb_ent, true);
+
+    n_errors += _check_permutation(order_r, nb_ent);
+
+    for (size_t i = 0; i < nb_ent; i++) {
+      cs_lnum_t e_r = order_r[i], e_h = order_h[i];
+      cs_lnum_t l_r = index[e_r+1] - index[e_r];
+      cs_lnum_t l_h = index[e_h+1] - index[e_h];
+      if (   l_r != l_h
+          || memcmp(number + index[e_r], number + index[e_h],
+                    l_r*sizeof(cs_gnum_t)) != 0)
+        n_errors++;
+    }
+
+  }
+  else {
+    bft_printf("  %s: radix sort not used\n", name);
+    n_errors++;
+  }
+
+  bft_printf("  %-32s (n = %llu): %d errors\n",
+             name, (unsigned long long)nb_ent, n_errors);
+
+  BFT_FREE(order_h);
+  BFT_FREE(order_r);
+
+  return n_errors;
+}
+
+/*----------------------------------------------------------------------------
+ * Compare real value orderings using merge sort and heapsort.
+ *
+ * parameters:
+ *   name    <-- test case name
+ *   value   <-- array of entity values
+ *   nb_ent  <-- number of entities
+ *
+ * returns:
+ *   number of errors
+ *----------------------------------------------------------------------------*/
+
+static int
+_test_real(const char       *name,
+           const cs_real_t   value[],
+           size_t            nb_ent)
+{
+  int n_errors = 0;
+  cs_lnum_t *order_m = NULL, *order_h = NULL;
+
+  BFT_MALLOC(order_m, nb_ent, cs_lnum_t);
+  BFT_MALLOC(order_h, nb_ent, cs_lnum_t);
+
+  cs_order_unit_test_real(value, order_m, nb_ent, false);
+  cs_order_unit_test_real(value, order_h, nb_ent, true);
+
+  n_errors += _check_permutation(order_m, nb_ent);
+
+  for (size_t i = 0; i < nb_ent; i++) {
+    if (memcmp(value + order_m[i], value + order_h[i], sizeof(cs_real_t)))
+      n_errors++;
+  }
+
+  /* Merge sort is stable */
+
+  for (size_t i = 1; i < nb_ent; i++) {
+    if (   memcmp(value + order_m[i-1], value + order_m[i],
+                  sizeof(cs_real_t)) == 0
+        && order_m[i-1] > order_m[i])
+      n_errors++;
+  }
+
+  bft_printf("  %-32s (n = %llu): %d errors\n",
+             name, (unsigned long long)nb_ent, n_errors);
+
+  BFT_FREE(order_h);
+  BFT_FREE(order_m);
+
+  return n_errors;
+}
+
+/*---------------------------------------------------------------------------*/
+
+int
+main (int argc, char *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+  int n_errors = 0;
+
+  const size_t n_sizes = 3;
+  const size_t sizes[] = {4096, 10007, 100000};
+
+  const size_t max_stride = 3;
+  const cs_gnum_t top = ~((cs_gnum_t)0);
+
+  bft_mem_init(getenv("CS_MEM_LOG"));
+
+  bft_printf("Radix sort / heapsort comparison:\n");
+
+  for (size_t s_id = 0; s_id < n_sizes; s_id++) {
+
+    const size_t n = sizes[s_id];
+
+    cs_gnum_t *number = NULL;
+    BFT_MALLOC(number, n*max_stride, cs_gnum_t);
+
+    /* Plain arrays, with duplicates */
+
+    for (size_t i = 0; i < n; i++)
+      number[i] = _rand_gnum() % (n/2) + 1;
+    n_errors += _test_gnum_s("plain", number, 1, n);
+
+    /* Keys near the top of the cs_gnum_t range */
+
+    for (size_t i = 0; i < n; i++)
+      number[i] = top - (_rand_gnum() % (1 << 20));
+    number[n/3] = top;
+    n_errors += _test_gnum_s("plain, near top", number, 1, n);
+
+    /* Full range keys */
+
+    for (size_t i = 0; i < n; i++)
+      number[i] = _rand_gnum();
+    n_errors += _test_gnum_s("plain, full range", number, 1, n);
+
+    /* Strided arrays, with some equal leading values and keys
+       near the top of the range */
+
+    for (size_t i = 0; i < n; i++) {
+      number[i*2] = _rand_gnum() % 64;
+      number[i*2 + 1] = top - (_rand_gnum() % (1 << 16));
+    }
+    n_errors += _test_gnum_s("strided", number, 2, n);
+
+    for (size_t i = 0; i < n; i++) {
+      number[i*3] = top - (_rand_gnum() % 16);
+      number[i*3 + 1] = _rand_gnum() % 1000;
+      number[i*3 + 2] = _rand_gnum() % (1 << 24);
+    }
+    n_errors += _test_gnum_s("strided, near top", number, 3, n);
+
+    BFT_FREE(number);
+
+    /* Indexed arrays, with entities whose values are prefixes
+       of those of other entities */
+
+    cs_lnum_t *index = NULL;
+    BFT_MALLOC(index, n+1, cs_lnum_t);
+    BFT_MALLOC(number, n*4, cs_gnum_t);
+
+    index[0] = 0;
+    for (size_t i = 0; i < n; i++) {
+      cs_lnum_t s_id_i = index[i];
+      if (i > 0 && i % 3 == 0) {
+        /* Prefix (possibly empty) of previous entity */
+        cs_lnum_t l_prev = index[i] - index[i-1];
+        cs_lnum_t l = _rand_gnum() % (l_prev + 1);
+        for (cs_lnum_t j = 0; j < l; j++)
+          number[s_id_i + j] = number[index[i-1] + j];
+        index[i+1] = s_id_i + l;
+      }
+      else {
+        cs_lnum_t l = _rand_gnum() % 5;
+        for (cs_lnum_t j = 0; j < l; j++)
+          number[s_id_i + j] = (j == 0) ?
+            top - (_rand_gnum() % 8) : top - (_rand_gnum() % 4096);
+        index[i+1] = s_id_i + l;
+      }
+    }
+    n_errors += _test_gnum_i("indexed, prefixes", number, index, n);
+
+    BFT_FREE(number);
+    BFT_FREE(index);
+
+    /* Real values, with duplicates */
+
+    cs_real_t *value = NULL;
+    BFT_MALLOC(value, n, cs_real_t);
+
+    for (size_t i = 0; i < n; i++)
+      value[i] = (cs_real_t)((cs_lnum_t)(_rand_gnum() % n) - (cs_lnum_t)n/2)
+                 * 0.25;
+    n_errors += _test_real("real", value, n);
+
+    BFT_FREE(value);
+  }
+
+  bft_mem_end();
+
+  if (n_errors > 0) {
+    bft_printf("\n%d errors\n", n_errors);
+    exit (EXIT_FAILURE);
+  }
+
+  exit (EXIT_SUCCESS);
+}
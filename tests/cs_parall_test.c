@@ -0,0 +1,289 @@
+/*============================================================================
+ * Unit test for deferred (packed) reductions of cs_parall.c;
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2020 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <bft_mem.h>
+#include <bft_printf.h>
+
+#include "cs_base.h"
+
+#include "cs_parall.h"
+
+/*---------------------------------------------------------------------------*/
+
+/* Values reduced in a test; packed and unpacked reductions are applied
+   to distinct copies, which must match exactly upon completion */
+
+typedef struct {
+
+  double    d_sum[4];
+  int32_t   i_min[3];
+  float     f_max[2];
+  uint64_t  u_sum[2];
+  int64_t   l_max[1];
+  double    d_min[2];
+  double    d_min_loc[3];    /* compared value, then associated values */
+  double    d_max_loc[2];    /* compared value, then associated values */
+
+} _test_values_t;
+
+/*----------------------------------------------------------------------------
+ * Initialize local values for a given rank and test.
+ *
+ * Floating-point values are exactly representable and their sums exact,
+ * so that results do not depend on the reduction order.
+ *
+ * parameters:
+ *   rank    <-- rank id
+ *   test_id <-- test id
+ *   v       --> values to initialize
+ *----------------------------------------------------------------------------*/
+
+static void
+_init_values(int              rank,
+             int              test_id,
+             _test_values_t  *v)
+{
+  memset(v, 0, sizeof(_test_values_t));
+
+  for (int i = 0; i < 4; i++)
+    v->d_sum[i] = (rank + 1) * 0.25 * (i + 1 + test_id);
+
+  for (int i = 0; i < 3; i++)
+    v->i_min[i] = (rank*7 + i*3 + test_id) % 11 - 5;
+
+  for (int i = 0; i < 2; i++)
+    v->f_max[i] = ((rank*5 + i + test_id) % 4) * 0.5f - 1.f;
+
+  for (int i = 0; i < 2; i++)
+    v->u_sum[i] = (uint64_t)rank + ((uint64_t)1 << 40)*(i + test_id);
+
+  v->l_max[0] = -((int64_t)1 << 35) + (rank*13 + test_id) % 5;
+
+  for (int i = 0; i < 2; i++)
+    v->d_min[i] = ((rank*3 + i) % 5) * 0.125 - 0.5;
+
+  /* Minimum reached on a single rank (for more than 2 ranks),
+     maximum reached on all ranks (lowest rank is selected) */
+
+  v->d_min_loc[0] = ((rank + test_id) % 3) * 1.5;
+  v->d_min_loc[1] = rank;
+  v->d_min_loc[2] = -2.*rank;
+
+  v->d_max_loc[0] = 2.5;
+  v->d_max_loc[1] = rank + 0.5;
+}
+
+/*----------------------------------------------------------------------------
+ * Reduce values with one collective operation per array.
+ *
+ * parameters:
+ *   v <-> local values in, global values out
+ *----------------------------------------------------------------------------*/
+
+static void
+_reduce_unpacked(_test_values_t  *v)
+{
+  cs_parall_sum(4, CS_DOUBLE, v->d_sum);
+  cs_parall_min(3, CS_INT32, v->i_min);
+  cs_parall_max(2, CS_FLOAT, v->f_max);
+  cs_parall_sum(2, CS_UINT64, v->u_sum);
+  cs_parall_max(1, CS_INT64, v->l_max);
+  cs_parall_min(2, CS_DOUBLE, v->d_min);
+  cs_parall_min_loc_vals(2, v->d_min_loc, v->d_min_loc + 1);
+  cs_parall_max_loc_vals(1, v->d_max_loc, v->d_max_loc + 1);
+}
+
+/*----------------------------------------------------------------------------
+ * Start a packed reduction of values.
+ *
+ * parameters:
+ *   r <-> deferred reduction structure
+ *   v <-> local values in, global values out (after wait)
+ *----------------------------------------------------------------------------*/
+
+static void
+_reduce_packed_start(cs_parall_reduce_t  *r,
+                     _test_values_t      *v)
+{
+  cs_parall_reduce_add(r, CS_PARALL_REDUCE_SUM, CS_DOUBLE, 4, v->d_sum);
+  cs_parall_reduce_add(r, CS_PARALL_REDUCE_MIN, CS_INT32, 3, v->i_min);
+  cs_parall_reduce_add(r, CS_PARALL_REDUCE_MAX, CS_FLOAT, 2, v->f_max);
+  cs_parall_reduce_add(r, CS_PARALL_REDUCE_SUM, CS_UINT64, 2, v->u_sum);
+  cs_parall_reduce_add(r, CS_PARALL_REDUCE_MAX, CS_INT64, 1, v->l_max);
+  cs_parall_reduce_add(r, CS_PARALL_REDUCE_MIN, CS_DOUBLE, 2, v->d_min);
+  cs_parall_reduce_add(r, CS_PARALL_REDUCE_MIN_LOC, CS_DOUBLE, 3,
+                       v->d_min_loc);
+  cs_parall_reduce_add(r, CS_PARALL_REDUCE_MAX_LOC, CS_DOUBLE, 2,
+                       v->d_max_loc);
+
+  cs_parall_reduce_start(r);
+}
+
+/*----------------------------------------------------------------------------
+ * Compare arrays of values, printing differences.
+ *
+ * parameters:
+ *   name    <-- array name
+ *   n       <-- number of values
+ *   v_size  <-- size of each value
+ *   v_ref   <-- reference values
+ *   v       <-- compared values
+ *
+ * returns:
+ *   number of errors
+ *----------------------------------------------------------------------------*/
+
+static int
+_compare(const char  *name,
+         int          n,
+         size_t       v_size,
+         const void  *v_ref,
+         const void  *v)
+{
+  const unsigned char *_v_ref = v_ref;
+  const unsigned char *_v = v;
+
+  int n_errors = 0;
+
+  for (int i = 0; i < n; i++) {
+    if (memcmp(_v_ref + i*v_size, _v + i*v_size, v_size) != 0) {
+      bft_printf("  %s[%d]: packed and unpacked results differ\n", name, i);
+      n_errors++;
+    }
+  }
+
+  return n_errors;
+}
+
+/*---------------------------------------------------------------------------*/
+
+int
+main (int argc, char *argv[])
+{
+  int size = 1;
+  int rank = 0;
+
+#if defined(HAVE_MPI)
+
+  /* Initialization */
+
+  cs_base_mpi_init(&argc, &argv);
+
+  if (cs_glob_mpi_comm != MPI_COMM_NULL) {
+    MPI_Comm_rank(cs_glob_mpi_comm, &rank);
+    MPI_Comm_size(cs_glob_mpi_comm, &size);
+  }
+
+#else
+
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+#endif /* (HAVE_MPI) */
+
+  bft_mem_init(getenv("CS_MEM_LOG"));
+
+  int n_errors = 0;
+
+  cs_parall_reduce_t *r = cs_parall_reduce_create();
+
+  /* The same structure is reused for successive reductions */
+
+  for (int test_id = 0; test_id < 3; test_id++) {
+
+    _test_values_t v_ref, v;
+
+    _init_values(rank, test_id, &v_ref);
+    _init_values(rank, test_id, &v);
+
+    _reduce_packed_start(r, &v);
+
+    _reduce_unpacked(&v_ref);
+
+    cs_parall_reduce_wait(r);
+
+    n_errors += _compare("d_sum", 4, sizeof(double), v_ref.d_sum, v.d_sum);
+    n_errors += _compare("i_min", 3, sizeof(int32_t), v_ref.i_min, v.i_min);
+    n_errors += _compare("f_max", 2, sizeof(float), v_ref.f_max, v.f_max);
+    n_errors += _compare("u_sum", 2, sizeof(uint64_t), v_ref.u_sum, v.u_sum);
+    n_errors += _compare("l_max", 1, sizeof(int64_t), v_ref.l_max, v.l_max);
+    n_errors += _compare("d_min", 2, sizeof(double), v_ref.d_min, v.d_min);
+    n_errors += _compare("d_min_loc", 3, sizeof(double),
+                         v_ref.d_min_loc, v.d_min_loc);
+    n_errors += _compare("d_max_loc", 2, sizeof(double),
+                         v_ref.d_max_loc, v.d_max_loc);
+
+    /* Check a few values against their expected global values */
+
+    double d_sum_0 = 0.;
+    for (int i = 0; i < size; i++)
+      d_sum_0 += (i + 1) * 0.25 * (1 + test_id);
+
+    if (v.d_sum[0] != d_sum_0 || v.d_max_loc[1] > 0.5) {
+      bft_printf("  test %d: unexpected global values\n", test_id);
+      n_errors++;
+    }
+
+    if (rank == 0)
+      bft_printf("test %d: sum %g, min %d, max %g, min loc %g (%g %g)\n",
+                 test_id, v.d_sum[0], (int)v.i_min[0], (double)v.f_max[0],
+                 v.d_min_loc[0], v.d_min_loc[1], v.d_min_loc[2]);
+
+  }
+
+  cs_parall_reduce_destroy(&r);
+
+  bft_mem_end();
+
+#if defined(HAVE_MPI)
+  if (size > 1) {
+    int n_errors_l = n_errors;
+    MPI_Allreduce(&n_errors_l, &n_errors, 1, MPI_INT, MPI_SUM,
+                  cs_glob_mpi_comm);
+  }
+  {
+    int mpi_flag;
+    MPI_Initialized(&mpi_flag);
+    if (mpi_flag != 0)
+      MPI_Finalize();
+  }
+#endif
+
+  if (n_errors > 0) {
+    if (rank == 0)
+      bft_printf("\n%d errors on %d ranks\n", n_errors, size);
+    exit (EXIT_FAILURE);
+  }
+
+  exit (EXIT_SUCCESS);
+}